@@ -0,0 +1,408 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+* A native benchmark harness that calls the CLBlast C API directly, with
+* the same routines, shapes and run loop as the JMH benchmarks in
+* src/jmh/java. Comparing both results shows the per-call overhead of
+* the Java bindings. The results are printed as CSV, with the columns
+*
+*     benchmark,size,ns_per_op
+*
+* Usage: JOCLBlastBenchmark [platformIndex] [deviceIndex]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <functional>
+
+#include <clblast_c.h>
+
+/**
+* The number of calls after which the queue is finished. This has to
+* match BenchmarkQueue.FINISH_INTERVAL on the Java side.
+*/
+static const int FINISH_INTERVAL = 64;
+
+/**
+* The number of seconds for the warmup and for the measurement, matching
+* the @Warmup and @Measurement settings of the JMH benchmarks
+*/
+static const double WARMUP_SECONDS = 3.0;
+static const double MEASUREMENT_SECONDS = 5.0;
+
+/**
+* The shapes of the batched and convolution benchmarks, matching the
+* constants in BatchedBenchmark and ConvolutionBenchmark
+*/
+static const size_t BATCHED_N = 1024;
+static const size_t BATCHED_M = 32;
+static const size_t CONV_CHANNELS = 16;
+static const size_t CONV_NUM_KERNELS = 32;
+static const size_t CONV_BATCH_COUNT = 4;
+static const size_t CONV_KERNEL_SIZE = 3;
+
+/**
+* A single CLBlast call that is benchmarked
+*/
+typedef std::function<CLBlastStatusCode(cl_command_queue*)> Call;
+
+/**
+* The OpenCL context and queue, and the buffers that have been created
+*/
+struct BenchmarkQueue
+{
+    cl_context context;
+    cl_command_queue queue;
+    std::vector<cl_mem> buffers;
+};
+
+/**
+* Print the given error message and exit
+*/
+static void fail(const std::string &message, int code)
+{
+    fprintf(stderr, "JOCLBlastBenchmark: %s (%d)\n", message.c_str(), code);
+    exit(1);
+}
+
+/**
+* Create a buffer for the given number of float values, filled with the
+* given value
+*/
+static cl_mem createBuffer(BenchmarkQueue &bq, size_t elements, float value)
+{
+    size_t size = (elements > 0 ? elements : 1) * sizeof(float);
+    cl_int err = CL_SUCCESS;
+    cl_mem buffer = clCreateBuffer(
+        bq.context, CL_MEM_READ_WRITE, size, NULL, &err);
+    if (err != CL_SUCCESS)
+    {
+        fail("Could not create buffer", err);
+    }
+    bq.buffers.push_back(buffer);
+    err = clEnqueueFillBuffer(bq.queue, buffer, &value, sizeof(float),
+        0, size, 0, NULL, NULL);
+    if (err != CL_SUCCESS)
+    {
+        fail("Could not fill buffer", err);
+    }
+    clFinish(bq.queue);
+    return buffer;
+}
+
+/**
+* Release all buffers that have been created
+*/
+static void releaseBuffers(BenchmarkQueue &bq)
+{
+    clFinish(bq.queue);
+    for (size_t i = 0; i < bq.buffers.size(); i++)
+    {
+        clReleaseMemObject(bq.buffers[i]);
+    }
+    bq.buffers.clear();
+}
+
+/**
+* Execute the given call in blocks of FINISH_INTERVAL calls, finishing
+* the queue after each block, until the given number of seconds have
+* passed. Returns the average time per call, in nanoseconds.
+*/
+static double run(BenchmarkQueue &bq, const char *name, const Call &call,
+    double seconds)
+{
+    typedef std::chrono::high_resolution_clock Clock;
+    Clock::time_point before = Clock::now();
+    long long calls = 0;
+    double elapsedNs = 0.0;
+    while (elapsedNs < seconds * 1e9)
+    {
+        for (int i = 0; i < FINISH_INTERVAL; i++)
+        {
+            CLBlastStatusCode status = call(&bq.queue);
+            if (status != CLBlastSuccess)
+            {
+                fail(std::string("Call failed in ") + name, status);
+            }
+        }
+        clFinish(bq.queue);
+        calls += FINISH_INTERVAL;
+        elapsedNs = static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                Clock::now() - before).count());
+    }
+    return elapsedNs / calls;
+}
+
+/**
+* Warm up and measure the given call, and print the result
+*/
+static void benchmark(BenchmarkQueue &bq, const char *name, size_t size,
+    const Call &call)
+{
+    run(bq, name, call, WARMUP_SECONDS);
+    double nsPerOp = run(bq, name, call, MEASUREMENT_SECONDS);
+    printf("%s,%zu,%.3f\n", name, size, nsPerOp);
+    fflush(stdout);
+}
+
+/**
+* The level 1 benchmarks, matching Level1Benchmark
+*/
+static void benchmarkLevel1(BenchmarkQueue &bq)
+{
+    size_t sizes[] = { 1024, 65536, 1048576 };
+    for (size_t size : sizes)
+    {
+        cl_mem x = createBuffer(bq, size, 0.5f);
+        cl_mem y = createBuffer(bq, size, 0.5f);
+        cl_mem result = createBuffer(bq, 1, 0.0f);
+        benchmark(bq, "saxpy", size, [=](cl_command_queue *queue) {
+            return CLBlastSaxpy(size, 1.0f, x, 0, 1, y, 0, 1, queue, NULL);
+        });
+        benchmark(bq, "sscal", size, [=](cl_command_queue *queue) {
+            return CLBlastSscal(size, 1.0f, x, 0, 1, queue, NULL);
+        });
+        benchmark(bq, "scopy", size, [=](cl_command_queue *queue) {
+            return CLBlastScopy(size, x, 0, 1, y, 0, 1, queue, NULL);
+        });
+        benchmark(bq, "sdot", size, [=](cl_command_queue *queue) {
+            return CLBlastSdot(size, result, 0, x, 0, 1, y, 0, 1,
+                queue, NULL);
+        });
+        benchmark(bq, "snrm2", size, [=](cl_command_queue *queue) {
+            return CLBlastSnrm2(size, result, 0, x, 0, 1, queue, NULL);
+        });
+        benchmark(bq, "isamax", size, [=](cl_command_queue *queue) {
+            return CLBlastiSamax(size, result, 0, x, 0, 1, queue, NULL);
+        });
+        releaseBuffers(bq);
+    }
+}
+
+/**
+* The level 2 benchmarks, matching Level2Benchmark
+*/
+static void benchmarkLevel2(BenchmarkQueue &bq)
+{
+    size_t sizes[] = { 64, 512, 2048 };
+    for (size_t size : sizes)
+    {
+        cl_mem a = createBuffer(bq, size * size, 0.5f);
+        cl_mem x = createBuffer(bq, size, 0.5f);
+        cl_mem y = createBuffer(bq, size, 0.5f);
+        benchmark(bq, "sgemv", size, [=](cl_command_queue *queue) {
+            return CLBlastSgemv(CLBlastLayoutRowMajor, CLBlastTransposeNo,
+                size, size, 1.0f, a, 0, size, x, 0, 1, 0.0f, y, 0, 1,
+                queue, NULL);
+        });
+        benchmark(bq, "sger", size, [=](cl_command_queue *queue) {
+            return CLBlastSger(CLBlastLayoutRowMajor, size, size, 1.0f,
+                x, 0, 1, y, 0, 1, a, 0, size, queue, NULL);
+        });
+        benchmark(bq, "strsv", size, [=](cl_command_queue *queue) {
+            return CLBlastStrsv(CLBlastLayoutRowMajor, CLBlastTriangleUpper,
+                CLBlastTransposeNo, CLBlastDiagonalUnit, size, a, 0, size,
+                x, 0, 1, queue, NULL);
+        });
+        releaseBuffers(bq);
+    }
+}
+
+/**
+* The level 3 benchmarks, matching Level3Benchmark
+*/
+static void benchmarkLevel3(BenchmarkQueue &bq)
+{
+    size_t sizes[] = { 32, 256, 1024 };
+    for (size_t size : sizes)
+    {
+        cl_mem a = createBuffer(bq, size * size, 0.5f);
+        cl_mem b = createBuffer(bq, size * size, 0.5f);
+        cl_mem c = createBuffer(bq, size * size, 0.0f);
+        benchmark(bq, "sgemm", size, [=](cl_command_queue *queue) {
+            return CLBlastSgemm(CLBlastLayoutRowMajor, CLBlastTransposeNo,
+                CLBlastTransposeNo, size, size, size, 1.0f, a, 0, size,
+                b, 0, size, 0.0f, c, 0, size, queue, NULL);
+        });
+        benchmark(bq, "ssyrk", size, [=](cl_command_queue *queue) {
+            return CLBlastSsyrk(CLBlastLayoutRowMajor, CLBlastTriangleUpper,
+                CLBlastTransposeNo, size, size, 1.0f, a, 0, size,
+                0.0f, c, 0, size, queue, NULL);
+        });
+        benchmark(bq, "strsm", size, [=](cl_command_queue *queue) {
+            return CLBlastStrsm(CLBlastLayoutRowMajor, CLBlastSideLeft,
+                CLBlastTriangleUpper, CLBlastTransposeNo, CLBlastDiagonalUnit,
+                size, size, 1.0f, a, 0, size, b, 0, size, queue, NULL);
+        });
+        releaseBuffers(bq);
+    }
+}
+
+/**
+* The batched benchmarks, matching BatchedBenchmark. The size is the
+* batch count.
+*/
+static void benchmarkBatched(BenchmarkQueue &bq)
+{
+    const size_t n = BATCHED_N;
+    const size_t m = BATCHED_M;
+    size_t sizes[] = { 8, 64, 512 };
+    for (size_t size : sizes)
+    {
+        cl_mem x = createBuffer(bq, size * n, 0.5f);
+        cl_mem y = createBuffer(bq, size * n, 0.5f);
+        cl_mem a = createBuffer(bq, size * m * m, 0.5f);
+        cl_mem b = createBuffer(bq, size * m * m, 0.5f);
+        cl_mem c = createBuffer(bq, size * m * m, 0.0f);
+        std::vector<float> alphas(size, 1.0f);
+        std::vector<float> betas(size, 0.0f);
+        std::vector<size_t> vectorOffsets(size);
+        std::vector<size_t> matrixOffsets(size);
+        for (size_t i = 0; i < size; i++)
+        {
+            vectorOffsets[i] = i * n;
+            matrixOffsets[i] = i * m * m;
+        }
+        const float *alphasPtr = alphas.data();
+        const float *betasPtr = betas.data();
+        const size_t *vectorOffsetsPtr = vectorOffsets.data();
+        const size_t *matrixOffsetsPtr = matrixOffsets.data();
+        benchmark(bq, "saxpyBatched", size, [=](cl_command_queue *queue) {
+            return CLBlastSaxpyBatched(n, alphasPtr, x, vectorOffsetsPtr, 1,
+                y, vectorOffsetsPtr, 1, size, queue, NULL);
+        });
+        benchmark(bq, "sgemmBatched", size, [=](cl_command_queue *queue) {
+            return CLBlastSgemmBatched(CLBlastLayoutRowMajor,
+                CLBlastTransposeNo, CLBlastTransposeNo, m, m, m,
+                alphasPtr, a, matrixOffsetsPtr, m, b, matrixOffsetsPtr, m,
+                betasPtr, c, matrixOffsetsPtr, m, size, queue, NULL);
+        });
+        benchmark(bq, "sgemmStridedBatched", size,
+            [=](cl_command_queue *queue) {
+            return CLBlastSgemmStridedBatched(CLBlastLayoutRowMajor,
+                CLBlastTransposeNo, CLBlastTransposeNo, m, m, m,
+                1.0f, a, 0, m, m * m, b, 0, m, m * m,
+                0.0f, c, 0, m, m * m, size, queue, NULL);
+        });
+        releaseBuffers(bq);
+    }
+}
+
+/**
+* The convolution benchmarks, matching ConvolutionBenchmark. The size is
+* the image height and width.
+*/
+static void benchmarkConvolution(BenchmarkQueue &bq)
+{
+    const size_t channels = CONV_CHANNELS;
+    const size_t numKernels = CONV_NUM_KERNELS;
+    const size_t batchCount = CONV_BATCH_COUNT;
+    const size_t kernelSize = CONV_KERNEL_SIZE;
+    size_t sizes[] = { 16, 64 };
+    for (size_t size : sizes)
+    {
+        size_t pixels = size * size;
+        size_t kernelElements = channels * kernelSize * kernelSize;
+        cl_mem im = createBuffer(bq, batchCount * channels * pixels, 0.5f);
+        cl_mem col = createBuffer(bq, kernelElements * pixels, 0.0f);
+        cl_mem kernel = createBuffer(bq, numKernels * kernelElements, 0.5f);
+        cl_mem result = createBuffer(
+            bq, batchCount * numKernels * pixels, 0.0f);
+        benchmark(bq, "sim2col", size, [=](cl_command_queue *queue) {
+            return CLBlastSim2col(CLBlastKernelModeCrossCorrelation,
+                channels, size, size, kernelSize, kernelSize, 1, 1, 1, 1,
+                1, 1, im, 0, col, 0, queue, NULL);
+        });
+        benchmark(bq, "sconvgemm", size, [=](cl_command_queue *queue) {
+            return CLBlastSconvgemm(CLBlastKernelModeCrossCorrelation,
+                channels, size, size, kernelSize, kernelSize, 1, 1, 1, 1,
+                1, 1, numKernels, batchCount, im, 0, kernel, 0,
+                result, 0, queue, NULL);
+        });
+        releaseBuffers(bq);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    cl_uint platformIndex = argc > 1 ? (cl_uint)atoi(argv[1]) : 0;
+    cl_uint deviceIndex = argc > 2 ? (cl_uint)atoi(argv[2]) : 0;
+
+    cl_uint numPlatforms = 0;
+    clGetPlatformIDs(0, NULL, &numPlatforms);
+    if (platformIndex >= numPlatforms)
+    {
+        fail("Invalid platform index", (int)platformIndex);
+    }
+    std::vector<cl_platform_id> platforms(numPlatforms);
+    clGetPlatformIDs(numPlatforms, platforms.data(), NULL);
+    cl_platform_id platform = platforms[platformIndex];
+
+    cl_uint numDevices = 0;
+    clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 0, NULL, &numDevices);
+    if (deviceIndex >= numDevices)
+    {
+        fail("Invalid device index", (int)deviceIndex);
+    }
+    std::vector<cl_device_id> devices(numDevices);
+    clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL,
+        numDevices, devices.data(), NULL);
+    cl_device_id device = devices[deviceIndex];
+
+    cl_context_properties contextProperties[] = {
+        CL_CONTEXT_PLATFORM, (cl_context_properties)platform, 0
+    };
+    cl_int err = CL_SUCCESS;
+    BenchmarkQueue bq;
+    bq.context = clCreateContext(
+        contextProperties, 1, &device, NULL, NULL, &err);
+    if (err != CL_SUCCESS)
+    {
+        fail("Could not create context", err);
+    }
+    bq.queue = clCreateCommandQueue(bq.context, device, 0, &err);
+    if (err != CL_SUCCESS)
+    {
+        fail("Could not create command queue", err);
+    }
+
+    printf("benchmark,size,ns_per_op\n");
+    benchmarkLevel1(bq);
+    benchmarkLevel2(bq);
+    benchmarkLevel3(bq);
+    benchmarkBatched(bq);
+    benchmarkConvolution(bq);
+
+    clReleaseCommandQueue(bq.queue);
+    clReleaseContext(bq.context);
+    return 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast.benchmark;
+
+import static org.jocl.blast.CLBlastLayout.CLBlastLayoutRowMajor;
+import static org.jocl.blast.CLBlastTranspose.CLBlastTransposeNo;
+
+import java.util.concurrent.TimeUnit;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_mem;
+import org.jocl.blast.CLBlast;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Benchmarks for batched routines, with the given batch count. The
+ * vectors have {@link #N} elements, and the matrices are square, with
+ * {@link #M} rows.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+public class BatchedBenchmark
+{
+    /**
+     * The size of the vectors
+     */
+    static final int N = 1024;
+
+    /**
+     * The size of the matrices
+     */
+    static final int M = 32;
+
+    @Param({ "8", "64", "512" })
+    public int size;
+
+    private BenchmarkQueue benchmarkQueue;
+    private cl_command_queue queue;
+    private cl_mem x;
+    private cl_mem y;
+    private cl_mem a;
+    private cl_mem b;
+    private cl_mem c;
+    private float alphas[];
+    private float betas[];
+    private long vectorOffsets[];
+    private long matrixOffsets[];
+
+    @Setup(Level.Trial)
+    public void setUp()
+    {
+        benchmarkQueue = new BenchmarkQueue();
+        queue = benchmarkQueue.getQueue();
+        x = benchmarkQueue.createBuffer((long)size * N, 0.5f);
+        y = benchmarkQueue.createBuffer((long)size * N, 0.5f);
+        a = benchmarkQueue.createBuffer((long)size * M * M, 0.5f);
+        b = benchmarkQueue.createBuffer((long)size * M * M, 0.5f);
+        c = benchmarkQueue.createBuffer((long)size * M * M, 0.0f);
+        alphas = new float[size];
+        betas = new float[size];
+        vectorOffsets = new long[size];
+        matrixOffsets = new long[size];
+        for (int i = 0; i < size; i++)
+        {
+            alphas[i] = 1.0f;
+            vectorOffsets[i] = (long)i * N;
+            matrixOffsets[i] = (long)i * M * M;
+        }
+    }
+
+    @TearDown(Level.Iteration)
+    public void finishIteration()
+    {
+        benchmarkQueue.finish();
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown()
+    {
+        benchmarkQueue.release();
+    }
+
+    @Benchmark
+    public void saxpyBatched()
+    {
+        CLBlast.CLBlastSaxpyBatched(N, alphas, x, vectorOffsets, 1, 
+            y, vectorOffsets, 1, size, queue, null);
+        benchmarkQueue.afterCall();
+    }
+
+    @Benchmark
+    public void sgemmBatched()
+    {
+        CLBlast.CLBlastSgemmBatched(CLBlastLayoutRowMajor, 
+            CLBlastTransposeNo, CLBlastTransposeNo, M, M, M, 
+            alphas, a, matrixOffsets, M, b, matrixOffsets, M, 
+            betas, c, matrixOffsets, M, size, queue, null);
+        benchmarkQueue.afterCall();
+    }
+
+    @Benchmark
+    public void sgemmStridedBatched()
+    {
+        CLBlast.CLBlastSgemmStridedBatched(CLBlastLayoutRowMajor, 
+            CLBlastTransposeNo, CLBlastTransposeNo, M, M, M, 
+            1.0f, a, 0, M, M * M, b, 0, M, M * M, 
+            0.0f, c, 0, M, M * M, size, queue, null);
+        benchmarkQueue.afterCall();
+    }
+}
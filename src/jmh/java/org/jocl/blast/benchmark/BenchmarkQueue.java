@@ -0,0 +1,199 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast.benchmark;
+
+import static org.jocl.CL.CL_CONTEXT_PLATFORM;
+import static org.jocl.CL.CL_DEVICE_TYPE_ALL;
+import static org.jocl.CL.CL_MEM_READ_WRITE;
+import static org.jocl.CL.clCreateBuffer;
+import static org.jocl.CL.clCreateCommandQueue;
+import static org.jocl.CL.clCreateContext;
+import static org.jocl.CL.clEnqueueFillBuffer;
+import static org.jocl.CL.clFinish;
+import static org.jocl.CL.clGetDeviceIDs;
+import static org.jocl.CL.clGetPlatformIDs;
+import static org.jocl.CL.clReleaseCommandQueue;
+import static org.jocl.CL.clReleaseContext;
+import static org.jocl.CL.clReleaseMemObject;
+
+import java.util.ArrayList;
+import java.util.List;
+
+import org.jocl.CL;
+import org.jocl.Pointer;
+import org.jocl.Sizeof;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_context_properties;
+import org.jocl.cl_device_id;
+import org.jocl.cl_mem;
+import org.jocl.cl_platform_id;
+import org.jocl.blast.CLBlast;
+
+/**
+ * The OpenCL context, queue and buffers for one benchmark.
+ * <p>
+ * The platform and device are selected with the system properties
+ * <code>jocl.blast.benchmark.platform</code> and 
+ * <code>jocl.blast.benchmark.device</code>, which are both 0 by default.
+ * <p>
+ * Each benchmark operation is a single CLBlast call. After every
+ * {@link #FINISH_INTERVAL} calls, the queue is finished, so that the 
+ * queue does not grow without bounds. The native harness in 
+ * <code>src/benchmark/native</code> does the same, so that the 
+ * difference of the times is the overhead of the Java bindings.
+ */
+final class BenchmarkQueue
+{
+    /**
+     * The number of calls after which the queue is finished
+     */
+    static final int FINISH_INTERVAL = 64;
+    
+    /**
+     * The context
+     */
+    private final cl_context context;
+    
+    /**
+     * The queue
+     */
+    private final cl_command_queue queue;
+    
+    /**
+     * The buffers that have been created
+     */
+    private final List<cl_mem> buffers = new ArrayList<cl_mem>();
+    
+    /**
+     * The number of calls since the queue was finished
+     */
+    private int calls;
+    
+    /**
+     * Creates the context and queue for the selected device
+     */
+    BenchmarkQueue()
+    {
+        CL.setExceptionsEnabled(true);
+        CLBlast.setExceptionsEnabled(true);
+        
+        int platformIndex = Integer.getInteger(
+            "jocl.blast.benchmark.platform", 0);
+        int deviceIndex = Integer.getInteger(
+            "jocl.blast.benchmark.device", 0);
+
+        int numPlatforms[] = new int[1];
+        clGetPlatformIDs(0, null, numPlatforms);
+        cl_platform_id platforms[] = new cl_platform_id[numPlatforms[0]];
+        clGetPlatformIDs(platforms.length, platforms, null);
+        cl_platform_id platform = platforms[platformIndex];
+        
+        int numDevices[] = new int[1];
+        clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 0, null, numDevices);
+        cl_device_id devices[] = new cl_device_id[numDevices[0]];
+        clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 
+            devices.length, devices, null);
+        cl_device_id device = devices[deviceIndex];
+        
+        cl_context_properties contextProperties = 
+            new cl_context_properties();
+        contextProperties.addProperty(CL_CONTEXT_PLATFORM, platform);
+        context = clCreateContext(
+            contextProperties, 1, new cl_device_id[] { device }, 
+            null, null, null);
+        queue = clCreateCommandQueue(context, device, 0, null);
+    }
+    
+    /**
+     * Returns the queue
+     * 
+     * @return The queue
+     */
+    cl_command_queue getQueue()
+    {
+        return queue;
+    }
+    
+    /**
+     * Create a buffer for the given number of float values, filled with
+     * the given value
+     * 
+     * @param elements The number of float values
+     * @param value The value
+     * @return The buffer
+     */
+    cl_mem createBuffer(long elements, float value)
+    {
+        long size = Math.max(1, elements) * Sizeof.cl_float;
+        cl_mem buffer = clCreateBuffer(
+            context, CL_MEM_READ_WRITE, size, null, null);
+        buffers.add(buffer);
+        clEnqueueFillBuffer(queue, buffer, Pointer.to(new float[] { value }),
+            Sizeof.cl_float, 0, size, 0, null, null);
+        clFinish(queue);
+        return buffer;
+    }
+    
+    /**
+     * To be called after each CLBlast call. This finishes the queue after
+     * every {@link #FINISH_INTERVAL} calls.
+     */
+    void afterCall()
+    {
+        calls++;
+        if (calls == FINISH_INTERVAL)
+        {
+            clFinish(queue);
+            calls = 0;
+        }
+    }
+    
+    /**
+     * Finish the queue
+     */
+    void finish()
+    {
+        clFinish(queue);
+        calls = 0;
+    }
+    
+    /**
+     * Release all buffers, the queue and the context
+     */
+    void release()
+    {
+        clFinish(queue);
+        for (cl_mem buffer : buffers)
+        {
+            clReleaseMemObject(buffer);
+        }
+        buffers.clear();
+        clReleaseCommandQueue(queue);
+        clReleaseContext(context);
+    }
+}
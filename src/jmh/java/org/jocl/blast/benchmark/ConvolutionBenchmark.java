@@ -0,0 +1,141 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast.benchmark;
+
+import static org.jocl.blast.CLBlastKernelMode.CLBlastKernelModeCrossCorrelation;
+
+import java.util.concurrent.TimeUnit;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_mem;
+import org.jocl.blast.CLBlast;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Benchmarks for the convolution routines, on square images with the 
+ * given height and width. The images have {@link #CHANNELS} channels,
+ * and are convolved with {@link #NUM_KERNELS} kernels of size 3x3, 
+ * with a padding of 1, a stride of 1 and no dilation. The convgemm
+ * processes {@link #BATCH_COUNT} images.
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+public class ConvolutionBenchmark
+{
+    /**
+     * The number of channels of the images
+     */
+    static final int CHANNELS = 16;
+
+    /**
+     * The number of kernels for the convgemm
+     */
+    static final int NUM_KERNELS = 32;
+
+    /**
+     * The number of images for the convgemm
+     */
+    static final int BATCH_COUNT = 4;
+
+    /**
+     * The size of the kernels
+     */
+    static final int KERNEL_SIZE = 3;
+
+    @Param({ "16", "64" })
+    public int size;
+
+    private BenchmarkQueue benchmarkQueue;
+    private cl_command_queue queue;
+    private cl_mem im;
+    private cl_mem col;
+    private cl_mem kernel;
+    private cl_mem result;
+
+    @Setup(Level.Trial)
+    public void setUp()
+    {
+        benchmarkQueue = new BenchmarkQueue();
+        queue = benchmarkQueue.getQueue();
+        long pixels = (long)size * size;
+        long kernelElements = (long)CHANNELS * KERNEL_SIZE * KERNEL_SIZE;
+        im = benchmarkQueue.createBuffer(
+            BATCH_COUNT * CHANNELS * pixels, 0.5f);
+        col = benchmarkQueue.createBuffer(kernelElements * pixels, 0.0f);
+        kernel = benchmarkQueue.createBuffer(
+            NUM_KERNELS * kernelElements, 0.5f);
+        result = benchmarkQueue.createBuffer(
+            BATCH_COUNT * NUM_KERNELS * pixels, 0.0f);
+    }
+
+    @TearDown(Level.Iteration)
+    public void finishIteration()
+    {
+        benchmarkQueue.finish();
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown()
+    {
+        benchmarkQueue.release();
+    }
+
+    @Benchmark
+    public void sim2col()
+    {
+        CLBlast.CLBlastSim2col(CLBlastKernelModeCrossCorrelation, 
+            CHANNELS, size, size, KERNEL_SIZE, KERNEL_SIZE, 1, 1, 1, 1, 
+            1, 1, im, 0, col, 0, queue, null);
+        benchmarkQueue.afterCall();
+    }
+
+    @Benchmark
+    public void sconvgemm()
+    {
+        CLBlast.CLBlastSconvgemm(CLBlastKernelModeCrossCorrelation, 
+            CHANNELS, size, size, KERNEL_SIZE, KERNEL_SIZE, 1, 1, 1, 1, 
+            1, 1, NUM_KERNELS, BATCH_COUNT, im, 0, kernel, 0, 
+            result, 0, queue, null);
+        benchmarkQueue.afterCall();
+    }
+}
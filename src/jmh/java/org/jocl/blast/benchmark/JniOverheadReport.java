@@ -0,0 +1,337 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast.benchmark;
+
+import java.io.BufferedReader;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.Map.Entry;
+
+/**
+ * Creates a report about the overhead of the Java bindings, by comparing
+ * the results of the JMH benchmarks with the results of the native 
+ * harness for the same routines and shapes.
+ * <p>
+ * Usage:
+ * <pre><code>
+ * JniOverheadReport &lt;jmh.csv&gt; &lt;native.csv&gt; 
+ *     [--baseline &lt;report.csv&gt;] [--threshold &lt;fraction&gt;]
+ * </code></pre>
+ * The JMH results are the CSV file that is written with 
+ * <code>-rf csv</code>. The native results are the CSV output of the 
+ * native harness. The report is printed as CSV, with the columns
+ * <code>benchmark,size,java_ns,native_ns,overhead_ns</code>.
+ * <p>
+ * If a baseline report is given, then the overhead of each routine is
+ * compared with the overhead in the baseline. When it increased by more
+ * than the threshold fraction (default: 0.25) and by more than 
+ * {@link #MIN_REGRESSION_NS}, then the routine is reported as a 
+ * regression, and the exit code is 1.
+ */
+public class JniOverheadReport
+{
+    /**
+     * The minimum increase of the overhead that is reported as a 
+     * regression, in nanoseconds, to avoid reports that are only
+     * caused by noise
+     */
+    static final double MIN_REGRESSION_NS = 100.0;
+    
+    /**
+     * The default threshold for regressions
+     */
+    private static final double DEFAULT_THRESHOLD = 0.25;
+    
+    /**
+     * The entry point of the report
+     * 
+     * @param args The command line arguments
+     * @throws IOException If a file cannot be read
+     */
+    public static void main(String[] args) throws IOException
+    {
+        if (args.length < 2)
+        {
+            System.err.println("Usage: JniOverheadReport <jmh.csv> " + 
+                "<native.csv> [--baseline <report.csv>] " + 
+                "[--threshold <fraction>]");
+            System.exit(2);
+        }
+        String baselineFileName = null;
+        double threshold = DEFAULT_THRESHOLD;
+        for (int i = 2; i < args.length - 1; i += 2)
+        {
+            if (args[i].equals("--baseline"))
+            {
+                baselineFileName = args[i + 1];
+            }
+            else if (args[i].equals("--threshold"))
+            {
+                threshold = Double.parseDouble(args[i + 1]);
+            }
+        }
+        
+        Map<String, Double> javaTimes = readJmhResults(args[0]);
+        Map<String, Double> nativeTimes = readNativeResults(args[1]);
+        Map<String, Double> overheads = new LinkedHashMap<String, Double>();
+        System.out.println("benchmark,size,java_ns,native_ns,overhead_ns");
+        for (Entry<String, Double> entry : javaTimes.entrySet())
+        {
+            Double nativeTime = nativeTimes.get(entry.getKey());
+            if (nativeTime == null)
+            {
+                continue;
+            }
+            double overhead = entry.getValue() - nativeTime;
+            overheads.put(entry.getKey(), overhead);
+            System.out.println(String.format(Locale.ENGLISH, 
+                "%s,%.1f,%.1f,%.1f", entry.getKey(), entry.getValue(), 
+                nativeTime, overhead));
+        }
+        
+        if (baselineFileName != null)
+        {
+            Map<String, Double> baseline = readReport(baselineFileName);
+            List<String> regressions = 
+                findRegressions(overheads, baseline, threshold);
+            for (String regression : regressions)
+            {
+                System.err.println("Regression: " + regression);
+            }
+            if (!regressions.isEmpty())
+            {
+                System.exit(1);
+            }
+        }
+    }
+    
+    /**
+     * Returns descriptions of all entries whose overhead increased by
+     * more than the given fraction and by more than 
+     * {@link #MIN_REGRESSION_NS}, compared to the baseline. 
+     * 
+     * @param overheads The overheads
+     * @param baseline The baseline overheads
+     * @param threshold The threshold
+     * @return The regressions
+     */
+    static List<String> findRegressions(Map<String, Double> overheads, 
+        Map<String, Double> baseline, double threshold)
+    {
+        List<String> regressions = new ArrayList<String>();
+        for (Entry<String, Double> entry : overheads.entrySet())
+        {
+            Double before = baseline.get(entry.getKey());
+            if (before == null)
+            {
+                continue;
+            }
+            double after = entry.getValue();
+            double increase = after - before;
+            if (increase > MIN_REGRESSION_NS && 
+                increase > threshold * Math.abs(before))
+            {
+                regressions.add(String.format(Locale.ENGLISH, 
+                    "%s: overhead %.1f ns, was %.1f ns", 
+                    entry.getKey(), after, before));
+            }
+        }
+        return regressions;
+    }
+    
+    /**
+     * Read the JMH results from the given CSV file. The keys of the 
+     * returned map are the simple benchmark method names and the size
+     * parameter, separated by a comma. The values are the scores.
+     * 
+     * @param fileName The file name
+     * @return The results
+     * @throws IOException If the file cannot be read
+     */
+    static Map<String, Double> readJmhResults(String fileName) 
+        throws IOException
+    {
+        List<List<String>> rows = readCsv(fileName);
+        Map<String, Double> results = new LinkedHashMap<String, Double>();
+        if (rows.isEmpty())
+        {
+            return results;
+        }
+        List<String> header = rows.get(0);
+        int benchmarkColumn = header.indexOf("Benchmark");
+        int scoreColumn = header.indexOf("Score");
+        int sizeColumn = header.indexOf("Param: size");
+        if (benchmarkColumn < 0 || scoreColumn < 0 || sizeColumn < 0)
+        {
+            throw new IOException("Unexpected JMH result format in " + 
+                fileName + ": " + header);
+        }
+        for (int i = 1; i < rows.size(); i++)
+        {
+            List<String> row = rows.get(i);
+            String benchmark = row.get(benchmarkColumn);
+            String method = benchmark.substring(
+                benchmark.lastIndexOf('.') + 1);
+            results.put(method + "," + row.get(sizeColumn), 
+                Double.parseDouble(row.get(scoreColumn)));
+        }
+        return results;
+    }
+    
+    /**
+     * Read the results of the native harness from the given CSV file,
+     * with the columns <code>benchmark,size,ns_per_op</code>
+     * 
+     * @param fileName The file name
+     * @return The results
+     * @throws IOException If the file cannot be read
+     */
+    static Map<String, Double> readNativeResults(String fileName) 
+        throws IOException
+    {
+        return readColumn(fileName, 2);
+    }
+    
+    /**
+     * Read the overheads from a report that was written by this class
+     * 
+     * @param fileName The file name
+     * @return The overheads
+     * @throws IOException If the file cannot be read
+     */
+    static Map<String, Double> readReport(String fileName) 
+        throws IOException
+    {
+        return readColumn(fileName, 4);
+    }
+    
+    /**
+     * Read the given column from a CSV file with a header, where the
+     * first two columns are the benchmark name and size
+     * 
+     * @param fileName The file name
+     * @param column The column
+     * @return The values
+     * @throws IOException If the file cannot be read
+     */
+    private static Map<String, Double> readColumn(
+        String fileName, int column) throws IOException
+    {
+        List<List<String>> rows = readCsv(fileName);
+        Map<String, Double> results = new LinkedHashMap<String, Double>();
+        for (int i = 1; i < rows.size(); i++)
+        {
+            List<String> row = rows.get(i);
+            if (row.size() <= column)
+            {
+                continue;
+            }
+            results.put(row.get(0) + "," + row.get(1), 
+                Double.parseDouble(row.get(column)));
+        }
+        return results;
+    }
+    
+    /**
+     * Read the given CSV file. Empty lines are skipped.
+     * 
+     * @param fileName The file name
+     * @return The rows
+     * @throws IOException If the file cannot be read
+     */
+    private static List<List<String>> readCsv(String fileName) 
+        throws IOException
+    {
+        List<List<String>> rows = new ArrayList<List<String>>();
+        BufferedReader reader = new BufferedReader(new InputStreamReader(
+            new FileInputStream(fileName), "UTF-8"));
+        try
+        {
+            String line = null;
+            while ((line = reader.readLine()) != null)
+            {
+                if (line.trim().length() > 0)
+                {
+                    rows.add(parseCsvLine(line));
+                }
+            }
+        }
+        finally
+        {
+            reader.close();
+        }
+        return rows;
+    }
+    
+    /**
+     * Parse a single line of a CSV file, where values may be enclosed 
+     * in double quotes 
+     * 
+     * @param line The line
+     * @return The values
+     */
+    static List<String> parseCsvLine(String line)
+    {
+        List<String> values = new ArrayList<String>();
+        StringBuilder sb = new StringBuilder();
+        boolean quoted = false;
+        for (int i = 0; i < line.length(); i++)
+        {
+            char c = line.charAt(i);
+            if (c == '"')
+            {
+                if (quoted && i + 1 < line.length() && 
+                    line.charAt(i + 1) == '"')
+                {
+                    sb.append('"');
+                    i++;
+                }
+                else
+                {
+                    quoted = !quoted;
+                }
+            }
+            else if (c == ',' && !quoted)
+            {
+                values.add(sb.toString().trim());
+                sb.setLength(0);
+            }
+            else
+            {
+                sb.append(c);
+            }
+        }
+        values.add(sb.toString().trim());
+        return values;
+    }
+}
@@ -0,0 +1,131 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast.benchmark;
+
+import java.util.concurrent.TimeUnit;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_mem;
+import org.jocl.blast.CLBlast;
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Level;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.TearDown;
+import org.openjdk.jmh.annotations.Warmup;
+
+/**
+ * Benchmarks for level-1 routines, on vectors with the given size
+ */
+@State(Scope.Benchmark)
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@Warmup(iterations = 3, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(1)
+public class Level1Benchmark
+{
+    @Param({ "1024", "65536", "1048576" })
+    public int size;
+
+    private BenchmarkQueue benchmarkQueue;
+    private cl_command_queue queue;
+    private cl_mem x;
+    private cl_mem y;
+    private cl_mem result;
+
+    @Setup(Level.Trial)
+    public void setUp()
+    {
+        benchmarkQueue = new BenchmarkQueue();
+        queue = benchmarkQueue.getQueue();
+        x = benchmarkQueue.createBuffer(size, 0.5f);
+        y = benchmarkQueue.createBuffer(size, 0.5f);
+        result = benchmarkQueue.createBuffer(1, 0.0f);
+    }
+
+    @TearDown(Level.Iteration)
+    public void finishIteration()
+    {
+        benchmarkQueue.finish();
+    }
+
+    @TearDown(Level.Trial)
+    public void tearDown()
+    {
+        benchmarkQueue.release();
+    }
+
+    @Benchmark
+    public void saxpy()
+    {
+        CLBlast.CLBlastSaxpy(size, 1.0f, x, 0, 1, y, 0, 1, queue, null);
+        benchmarkQueue.afterCall();
+    }
+
+    @Benchmark
+    public void sscal()
+    {
+        CLBlast.CLBlastSscal(size, 1.0f, x, 0, 1, queue, null);
+        benchmarkQueue.afterCall();
+    }
+
+    @Benchmark
+    public void scopy()
+    {
+        CLBlast.CLBlastScopy(size, x, 0, 1, y, 0, 1, queue, null);
+        benchmarkQueue.afterCall();
+    }
+
+    @Benchmark
+    public void sdot()
+    {
+        CLBlast.CLBlastSdot(size, result, 0, x, 0, 1, y, 0, 1, queue, null);
+        benchmarkQueue.afterCall();
+    }
+
+    @Benchmark
+    public void snrm2()
+    {
+        CLBlast.CLBlastSnrm2(size, result, 0, x, 0, 1, queue, null);
+        benchmarkQueue.afterCall();
+    }
+
+    @Benchmark
+    public void isamax()
+    {
+        CLBlast.CLBlastiSamax(size, result, 0, x, 0, 1, queue, null);
+        benchmarkQueue.afterCall();
+    }
+}
@@ -26,6 +26,14 @@
  */
 package org.jocl.blast;
 
+import java.io.File;
+import java.io.IOException;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.FloatBuffer;
+import java.nio.LongBuffer;
+import java.nio.ShortBuffer;
+
 import org.jocl.CL;
 import org.jocl.CLException;
 import org.jocl.LibUtils;
@@ -37,6 +45,24 @@ import org.jocl.CL.LogLevel;
 
 /**
  * CLBlast
+ * <p>
+ * The scalar arguments of the half-precision (H) routines are passed as
+ * <code>float</code> values, and converted into <code>cl_half</code>
+ * values internally. The buffers of these routines contain 16-bit
+ * half-precision values.
+ * <p>
+ * Each routine that receives a <code>queue</code> and an <code>event</code>
+ * also has an overload that receives a <code>cl_event[] waitList</code>.
+ * When this list is not empty, a barrier that waits for these events is
+ * enqueued into the queue, in the same native call, before the routine.
+ * <p>
+ * The complex-precision (C and Z) routines receive their scalar 
+ * arguments as <code>float[2]</code> or <code>double[2]</code> arrays.
+ * Each of these routines also has an overload that receives the real
+ * and imaginary parts as separate primitive values, for example, 
+ * <code>alpha_real</code> and <code>alpha_imag</code>. These overloads
+ * do not require an array allocation on the Java side, and no JNI array
+ * access in the native code.
  */
 public class CLBlast
 {
@@ -58,6 +84,15 @@ public class CLBlast
         }
     }
     
+    /**
+     * Makes sure that the native library has been loaded. This is called 
+     * by the other classes of this package that contain native methods.
+     */
+    static void initialize()
+    {
+        // The native library is loaded in the static initializer
+    }
+    
     /**
      * Indicates whether exceptions are enabled. When exceptions are
      * enabled, CLException is thrown if a method is about to return
@@ -91,7 +126,7 @@ public class CLBlast
      * @throws CLException If exceptions have been enabled and
      * the given result code is not CL_SUCCESS
      */
-    private static int checkResult(int result)
+    static int checkResult(int result)
     {
         if (exceptionsEnabled && result != CL.CL_SUCCESS)
         {
@@ -119,6 +154,82 @@ public class CLBlast
         return result;
     }
     
+    /**
+     * Make sure that the given buffer, if it is not <code>null</code>,
+     * has the native byte order.
+     * 
+     * @param buffer The buffer
+     * @param name The name of the buffer, for the error message
+     * @throws IllegalArgumentException If the buffer does not have the
+     * native byte order
+     */
+    private static void checkNativeOrder(FloatBuffer buffer, String name)
+    {
+        if (buffer != null)
+        {
+            checkNativeOrder(buffer.order(), name);
+        }
+    }
+    
+    /**
+     * See {@link #checkNativeOrder(FloatBuffer, String)}
+     * 
+     * @param buffer The buffer
+     * @param name The name of the buffer, for the error message
+     */
+    private static void checkNativeOrder(DoubleBuffer buffer, String name)
+    {
+        if (buffer != null)
+        {
+            checkNativeOrder(buffer.order(), name);
+        }
+    }
+    
+    /**
+     * See {@link #checkNativeOrder(FloatBuffer, String)}
+     * 
+     * @param buffer The buffer
+     * @param name The name of the buffer, for the error message
+     */
+    private static void checkNativeOrder(ShortBuffer buffer, String name)
+    {
+        if (buffer != null)
+        {
+            checkNativeOrder(buffer.order(), name);
+        }
+    }
+    
+    /**
+     * See {@link #checkNativeOrder(FloatBuffer, String)}
+     * 
+     * @param buffer The buffer
+     * @param name The name of the buffer, for the error message
+     */
+    private static void checkNativeOrder(LongBuffer buffer, String name)
+    {
+        if (buffer != null)
+        {
+            checkNativeOrder(buffer.order(), name);
+        }
+    }
+    
+    /**
+     * Make sure that the given byte order is the native byte order
+     * 
+     * @param order The byte order
+     * @param name The name of the buffer, for the error message
+     * @throws IllegalArgumentException If the given order is not the
+     * native byte order
+     */
+    private static void checkNativeOrder(ByteOrder order, String name)
+    {
+        if (order != ByteOrder.nativeOrder())
+        {
+            throw new IllegalArgumentException(
+                "The buffer '" + name + "' must have the native byte order");
+        }
+    }
+    
     /**
      * Set the specified log level for the library.
      * <p>
@@ -136,6 +247,455 @@ public class CLBlast
     }
     private static native void setLogLevelNative(int logLevel);
     
+    /**
+     * The names of the routines, in the order in which their statistics
+     * are returned by the native library. Obtained lazily.
+     */
+    private static String statisticsRoutineNames[];
+    
+    /**
+     * Enable or disable the collection of statistics for the calls of the
+     * CLBlast routines. When disabled (the default), this causes only a
+     * negligible overhead. When enabled, the number of calls, the number
+     * of failures, and the time that was spent in the JNI layer and in
+     * the CLBlast functions is recorded for each routine. The calls of
+     * the {@link CLBlastFast} and {@link CLBlastCommandList} methods are
+     * not recorded.
+     * 
+     * @param enabled Whether the statistics should be collected
+     */
+    public static void setStatisticsEnabled(boolean enabled)
+    {
+        setStatisticsEnabledNative(enabled);
+    }
+    private static native void setStatisticsEnabledNative(boolean enabled);
+    
+    /**
+     * Returns a snapshot of the statistics that have been collected since
+     * the last reset.
+     * 
+     * @return The statistics
+     * @see #setStatisticsEnabled(boolean)
+     */
+    public static CLBlastStatistics getStatistics()
+    {
+        return getStatistics(false);
+    }
+    
+    /**
+     * Returns a snapshot of the statistics that have been collected since
+     * the last reset. If <code>reset</code> is <code>true</code>, then 
+     * the statistics are reset while taking the snapshot, so that no 
+     * calls are lost between subsequent snapshots.
+     * 
+     * @param reset Whether the statistics should be reset
+     * @return The statistics
+     * @see #setStatisticsEnabled(boolean)
+     */
+    public static synchronized CLBlastStatistics getStatistics(boolean reset)
+    {
+        if (statisticsRoutineNames == null)
+        {
+            statisticsRoutineNames = getStatisticsRoutineNamesNative();
+        }
+        return new CLBlastStatistics(
+            statisticsRoutineNames, getStatisticsNative(reset));
+    }
+    private static native String[] getStatisticsRoutineNamesNative();
+    private static native long[] getStatisticsNative(boolean reset);
+    
+    /**
+     * Reset all statistics that have been collected
+     * 
+     * @see #setStatisticsEnabled(boolean)
+     */
+    public static void resetStatistics()
+    {
+        getStatisticsNative(true);
+    }
+    
+    /**
+     * Enable or disable the device-side profiling of the CLBlast routines.
+     * When enabled, each call of a CLBlast routine on a command queue that
+     * was created with <code>CL_QUEUE_PROFILING_ENABLE</code> produces an
+     * event, even when no event was given, and a callback is attached to
+     * this event. This callback records the time from the start of the
+     * call until the completion of its last command on the device, 
+     * together with the number of floating point operations and bytes 
+     * that are estimated from the dimensions of the call. These values 
+     * are collected for each routine, device and shape. Calls on queues
+     * without profiling, and the calls of the {@link CLBlastFast} and the
+     * {@link CLBlastCommandList} methods, are not profiled.<br>
+     * <br>
+     * Enabling the profiling causes an additional marker to be enqueued
+     * for each call, and should therefore only be done for measurements.
+     * 
+     * @param enabled Whether the profiling should be enabled
+     * @see #getProfile()
+     */
+    public static void setProfilingEnabled(boolean enabled)
+    {
+        setProfilingEnabledNative(enabled);
+    }
+    private static native void setProfilingEnabledNative(boolean enabled);
+    
+    /**
+     * Returns a snapshot of the device-side profile that has been 
+     * collected since the last reset. Only the calls whose commands have
+     * already completed on the device are contained in the profile.
+     * 
+     * @return The profile
+     * @see #setProfilingEnabled(boolean)
+     */
+    public static CLBlastProfile getProfile()
+    {
+        return getProfile(false);
+    }
+    
+    /**
+     * Returns a snapshot of the device-side profile that has been 
+     * collected since the last reset. If <code>reset</code> is 
+     * <code>true</code>, then the profile is reset while taking the 
+     * snapshot.
+     * 
+     * @param reset Whether the profile should be reset
+     * @return The profile
+     * @see #setProfilingEnabled(boolean)
+     */
+    public static CLBlastProfile getProfile(boolean reset)
+    {
+        Object data[] = getProfileNative(reset);
+        return new CLBlastProfile((String[])data[0], (long[])data[1]);
+    }
+    private static native Object[] getProfileNative(boolean reset);
+    
+    /**
+     * Reset the device-side profile that has been collected
+     * 
+     * @see #setProfilingEnabled(boolean)
+     */
+    public static void resetProfile()
+    {
+        getProfileNative(true);
+    }
+    
+    /**
+     * Set whether the kernels that are compiled by the routines should be
+     * tracked in the kernel cache accounting. If this is enabled, then 
+     * each successful call of a routine records the device, operation 
+     * and precision of the call, together with the number of calls and
+     * the time of the last call. The accounting allows inspecting the 
+     * cache with {@link #getKernelCache()}, evicting parts of it with 
+     * {@link #evictKernelCache(cl_device_id, String, int)}, and limiting
+     * its size with {@link #setKernelCacheLimit(int)}.<br>
+     * <br>
+     * The batched level-2 routines record the operations whose kernels 
+     * they use: A batched GEMV records <code>"gemmBatched"</code> and 
+     * <code>"gemv"</code>, because it is executed with the batched GEMM
+     * where possible, and the batched TRSV and GER record 
+     * <code>"trsv"</code> and <code>"ger"</code>. The calls of the 
+     * {@link CLBlastFast}, {@link CLBlastCommandList}, 
+     * {@link CLBlastReduction} and {@link CLBlastGroupedGemm} methods 
+     * and of the GEMM, GEMV and convgemm plans are recorded as well, 
+     * as calls of the CLBlast routines that they use.<br>
+     * <br>
+     * Disabling the tracking does not clear the accounting that has been
+     * collected so far.
+     * 
+     * @param enabled Whether the tracking should be enabled
+     */
+    public static void setKernelCacheTrackingEnabled(boolean enabled)
+    {
+        setKernelCacheTrackingEnabledNative(enabled);
+    }
+    private static native void setKernelCacheTrackingEnabledNative(
+        boolean enabled);
+    
+    /**
+     * Returns a snapshot of the kernel cache accounting
+     * 
+     * @return The kernel cache accounting
+     * @see #setKernelCacheTrackingEnabled(boolean)
+     */
+    public static CLBlastKernelCache getKernelCache()
+    {
+        Object data[] = getKernelCacheNative();
+        return new CLBlastKernelCache((String[])data[0], (long[])data[1]);
+    }
+    private static native Object[] getKernelCacheNative();
+    
+    /**
+     * Evict the tracked kernel cache entries that match the given 
+     * device, operation and precision. A <code>null</code> device or 
+     * operation, and a precision of 0, match all entries.<br>
+     * <br>
+     * The CLBlast library only offers clearing its whole program cache.
+     * So the cache is cleared, and the entries that are not evicted are
+     * compiled again in a background thread, in the same way as for
+     * {@link CLBlastWarmup}. Until this is finished, the first call of 
+     * such an entry may have to wait for the compilation. When one of
+     * the entries that are not evicted can not be compiled by the 
+     * warmup (see {@link CLBlastKernelCache.Entry#isRebuildable()}), 
+     * then nothing is evicted, and 0 is returned. Evicting all entries
+     * is always possible.
+     * 
+     * @param device The device
+     * @param operation The operation, e.g. <code>"gemm"</code>
+     * @param precision The {@link CLBlastPrecision}
+     * @return The number of evicted entries
+     * @see #setKernelCacheTrackingEnabled(boolean)
+     */
+    public static int evictKernelCache(
+        cl_device_id device, String operation, int precision)
+    {
+        long deviceHandle = device == null ? 0 : CLBlastFast.getHandle(device);
+        return evictKernelCacheNative(deviceHandle, operation, precision);
+    }
+    private static native int evictKernelCacheNative(
+        long device, String operation, int precision);
+    
+    /**
+     * Set the maximum number of tracked kernel cache entries. When a call
+     * of a routine adds an entry so that the limit is exceeded, then 
+     * the least recently used entries are evicted, until only three 
+     * quarters of the limit are used, as described in 
+     * {@link #evictKernelCache(cl_device_id, String, int)}. Only the 
+     * entries that have not been used since the limit was last found to
+     * be exceeded are evicted, and only when they are at least a quarter
+     * of the limit. So a working set that is larger than the limit may 
+     * exceed it, instead of causing the whole cache to be cleared and 
+     * compiled again repeatedly. A limit of 0 means that the number of
+     * entries is not limited. This is the default.
+     * 
+     * @param maxEntries The maximum number of entries
+     * @throws IllegalArgumentException If the given number is negative
+     * @see #setKernelCacheTrackingEnabled(boolean)
+     */
+    public static void setKernelCacheLimit(int maxEntries)
+    {
+        if (maxEntries < 0)
+        {
+            throw new IllegalArgumentException(
+                "The maximum number of entries may not be negative, " + 
+                "but is " + maxEntries);
+        }
+        setKernelCacheLimitNative(maxEntries);
+    }
+    private static native void setKernelCacheLimitNative(int maxEntries);
+    
+    /**
+     * Set whether the calls of the routines should be recorded in the
+     * call trace. If this is enabled, then each call of a routine 
+     * appends a compact binary record to a ring buffer in the native 
+     * library. The record contains the routine, the status, a timestamp,
+     * the host time of the call, and all arguments: The scalar and shape
+     * arguments, the contents of host arrays, the size and identity of
+     * the memory objects, and the identity of the queue. This includes 
+     * the <code>Pooled</code> GEMM routines and the batched level-2 
+     * routines. The calls of the {@link CLBlastFast} and 
+     * {@link CLBlastCommandList} methods are not recorded, so a trace 
+     * of an application that uses them does not describe its whole 
+     * workload.<br>
+     * <br>
+     * The trace can be obtained with {@link #getCallTrace()}, written 
+     * into a file, and replayed with the {@link CLBlastTraceReplay}.
+     * 
+     * @param enabled Whether the call trace should be enabled
+     * @see #setCallTraceCapacity(int)
+     */
+    public static void setCallTraceEnabled(boolean enabled)
+    {
+        setCallTraceEnabledNative(enabled);
+    }
+    private static native void setCallTraceEnabledNative(boolean enabled);
+    
+    /**
+     * Set the capacity of the ring buffer of the call trace, in bytes. 
+     * When the ring buffer is full, the oldest records are dropped. The
+     * default capacity is 16 MB, which is sufficient for about 80000
+     * calls of a routine like <code>CLBlastSgemm</code>. Setting
+     * the capacity resets the call trace.
+     * 
+     * @param capacity The capacity
+     * @throws IllegalArgumentException If the given capacity is not 
+     * positive
+     * @see #setCallTraceEnabled(boolean)
+     */
+    public static void setCallTraceCapacity(int capacity)
+    {
+        if (capacity <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The capacity must be positive, but is " + capacity);
+        }
+        setCallTraceCapacityNative(capacity);
+    }
+    private static native void setCallTraceCapacityNative(int capacity);
+    
+    /**
+     * Returns a snapshot of the call trace that has been recorded since 
+     * the last reset
+     * 
+     * @return The call trace
+     * @see #setCallTraceEnabled(boolean)
+     */
+    public static CLBlastCallTrace getCallTrace()
+    {
+        return getCallTrace(false);
+    }
+    
+    /**
+     * Returns a snapshot of the call trace that has been recorded since 
+     * the last reset. If <code>reset</code> is <code>true</code>, then 
+     * the call trace is reset while taking the snapshot.
+     * 
+     * @param reset Whether the call trace should be reset
+     * @return The call trace
+     * @see #setCallTraceEnabled(boolean)
+     */
+    public static CLBlastCallTrace getCallTrace(boolean reset)
+    {
+        Object data[] = getCallTraceNative(reset);
+        return new CLBlastCallTrace(
+            (String[])data[0], (byte[])data[1], (long[])data[2]);
+    }
+    private static native Object[] getCallTraceNative(boolean reset);
+    
+    /**
+     * Reset the call trace that has been recorded
+     * 
+     * @see #setCallTraceEnabled(boolean)
+     */
+    public static void resetCallTrace()
+    {
+        getCallTraceNative(true);
+    }
+    
+    /**
+     * Set the maximum number of bytes of idle temporary buffers that are
+     * kept for each context by the <code>CLBlastXgemmPooled</code> 
+     * routines, like {@link #CLBlastSgemmPooled}. A GEMM that requires a
+     * larger temporary buffer than this limit will not use the pool, and
+     * CLBlast will allocate the temporary buffer internally. When the 
+     * limit is lowered, the largest idle buffers of each context are 
+     * released until the idle buffers no longer exceed the new limit. 
+     * Buffers that are still in use by pending GEMM calls are checked 
+     * against the limit when they are returned to the pool. The default
+     * limit is 256 MB.
+     * 
+     * @param limit The limit, in bytes
+     * @throws IllegalArgumentException If the limit is negative
+     */
+    public static void setTempBufferPoolLimit(long limit)
+    {
+        if (limit < 0)
+        {
+            throw new IllegalArgumentException(
+                "The limit may not be negative, but is " + limit);
+        }
+        setTempBufferPoolLimitNative(limit);
+    }
+    private static native void setTempBufferPoolLimitNative(long limit);
+    
+    /**
+     * Set the maximum number of temporary buffers that may be checked out
+     * of the pool of the <code>CLBlastXgemmPooled</code> routines at the
+     * same time. When this number is reached, further GEMM calls do not 
+     * use the pool until one of the pending calls is complete, and CLBlast
+     * will allocate their temporary buffers internally. The default is 16.
+     * 
+     * @param count The maximum number of outstanding buffers
+     * @throws IllegalArgumentException If the count is negative
+     */
+    public static void setTempBufferPoolMaxOutstanding(int count)
+    {
+        if (count < 0)
+        {
+            throw new IllegalArgumentException(
+                "The count may not be negative, but is " + count);
+        }
+        setTempBufferPoolMaxOutstandingNative(count);
+    }
+    private static native void setTempBufferPoolMaxOutstandingNative(int count);
+    
+    /**
+     * Set the maximum ratio between the size of an idle temporary buffer
+     * and the size that is required by a <code>CLBlastXgemmPooled</code>
+     * call for which the idle buffer is reused. When the smallest idle 
+     * buffer that is large enough exceeds this ratio, it stays in the 
+     * pool, and a new buffer is created. This prevents one large GEMM
+     * from keeping a large buffer occupied for many small GEMMs. The 
+     * default is 2.0.
+     * 
+     * @param ratio The maximum ratio
+     * @throws IllegalArgumentException If the ratio is smaller than 1.0
+     * or not a number
+     */
+    public static void setTempBufferPoolMaxReuseRatio(double ratio)
+    {
+        if (!(ratio >= 1.0))
+        {
+            throw new IllegalArgumentException(
+                "The ratio must be at least 1.0, but is " + ratio);
+        }
+        setTempBufferPoolMaxReuseRatioNative(ratio);
+    }
+    private static native void setTempBufferPoolMaxReuseRatioNative(double ratio);
+    
+    /**
+     * Returns the maximum ratio between the size of an idle temporary 
+     * buffer and the required size for which the idle buffer is reused.
+     * 
+     * @return The maximum ratio
+     * @see #setTempBufferPoolMaxReuseRatio(double)
+     */
+    public static double getTempBufferPoolMaxReuseRatio()
+    {
+        return getTempBufferPoolMaxReuseRatioNative();
+    }
+    private static native double getTempBufferPoolMaxReuseRatioNative();
+    
+    /**
+     * Returns the number of temporary buffers that are currently checked
+     * out of the pool of the <code>CLBlastXgemmPooled</code> routines, by
+     * GEMM calls that are not complete yet.
+     * 
+     * @return The number of outstanding buffers
+     * @see #setTempBufferPoolMaxOutstanding(int)
+     */
+    public static int getTempBufferPoolOutstanding()
+    {
+        return getTempBufferPoolOutstandingNative();
+    }
+    private static native int getTempBufferPoolOutstandingNative();
+    
+    /**
+     * Returns the total number of bytes of the temporary buffers that are 
+     * currently idle in the pool of the <code>CLBlastXgemmPooled</code>
+     * routines.
+     * 
+     * @return The size of the idle buffers, in bytes
+     */
+    public static long getTempBufferPoolSize()
+    {
+        return getTempBufferPoolSizeNative();
+    }
+    private static native long getTempBufferPoolSizeNative();
+    
+    /**
+     * Release all idle temporary buffers of the pool that is used by the 
+     * <code>CLBlastXgemmPooled</code> routines, and clear the cached 
+     * temporary buffer sizes. Buffers that are still in use by pending 
+     * GEMM calls are returned to the pool when these calls are complete.
+     * The idle buffers keep their context alive, so this should be called
+     * before a context is released.
+     */
+    public static void trimTempBufferPool()
+    {
+        trimTempBufferPoolNative();
+    }
+    private static native void trimTempBufferPoolNative();
+    
     
     public static final int JOCL_BLAST_STATUS_INTERNAL_ERROR = -32786;
     
@@ -155,7 +715,22 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSrotgNative(sa_buffer, sa_offset, sb_buffer, sb_offset, sc_buffer, sc_offset, ss_buffer, ss_offset, queue, event));
+        return checkResult(CLBlastSrotgNative(sa_buffer, sa_offset, sb_buffer, sb_offset, sc_buffer, sc_offset, ss_buffer, ss_offset, queue, null, event));
+    }
+    public static int CLBlastSrotg(
+        cl_mem sa_buffer, 
+        long sa_offset, 
+        cl_mem sb_buffer, 
+        long sb_offset, 
+        cl_mem sc_buffer, 
+        long sc_offset, 
+        cl_mem ss_buffer, 
+        long ss_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSrotgNative(sa_buffer, sa_offset, sb_buffer, sb_offset, sc_buffer, sc_offset, ss_buffer, ss_offset, queue, waitList, event));
     }
     private static native int CLBlastSrotgNative(
         cl_mem sa_buffer, 
@@ -167,6 +742,7 @@ public class CLBlast
         cl_mem ss_buffer, 
         long ss_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
@@ -182,7 +758,22 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDrotgNative(sa_buffer, sa_offset, sb_buffer, sb_offset, sc_buffer, sc_offset, ss_buffer, ss_offset, queue, event));
+        return checkResult(CLBlastDrotgNative(sa_buffer, sa_offset, sb_buffer, sb_offset, sc_buffer, sc_offset, ss_buffer, ss_offset, queue, null, event));
+    }
+    public static int CLBlastDrotg(
+        cl_mem sa_buffer, 
+        long sa_offset, 
+        cl_mem sb_buffer, 
+        long sb_offset, 
+        cl_mem sc_buffer, 
+        long sc_offset, 
+        cl_mem ss_buffer, 
+        long ss_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDrotgNative(sa_buffer, sa_offset, sb_buffer, sb_offset, sc_buffer, sc_offset, ss_buffer, ss_offset, queue, waitList, event));
     }
     private static native int CLBlastDrotgNative(
         cl_mem sa_buffer, 
@@ -194,6 +785,7 @@ public class CLBlast
         cl_mem ss_buffer, 
         long ss_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
@@ -212,7 +804,24 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSrotmgNative(sd1_buffer, sd1_offset, sd2_buffer, sd2_offset, sx1_buffer, sx1_offset, sy1_buffer, sy1_offset, sparam_buffer, sparam_offset, queue, event));
+        return checkResult(CLBlastSrotmgNative(sd1_buffer, sd1_offset, sd2_buffer, sd2_offset, sx1_buffer, sx1_offset, sy1_buffer, sy1_offset, sparam_buffer, sparam_offset, queue, null, event));
+    }
+    public static int CLBlastSrotmg(
+        cl_mem sd1_buffer, 
+        long sd1_offset, 
+        cl_mem sd2_buffer, 
+        long sd2_offset, 
+        cl_mem sx1_buffer, 
+        long sx1_offset, 
+        cl_mem sy1_buffer, 
+        long sy1_offset, 
+        cl_mem sparam_buffer, 
+        long sparam_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSrotmgNative(sd1_buffer, sd1_offset, sd2_buffer, sd2_offset, sx1_buffer, sx1_offset, sy1_buffer, sy1_offset, sparam_buffer, sparam_offset, queue, waitList, event));
     }
     private static native int CLBlastSrotmgNative(
         cl_mem sd1_buffer, 
@@ -226,6 +835,7 @@ public class CLBlast
         cl_mem sparam_buffer, 
         long sparam_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
@@ -243,7 +853,24 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDrotmgNative(sd1_buffer, sd1_offset, sd2_buffer, sd2_offset, sx1_buffer, sx1_offset, sy1_buffer, sy1_offset, sparam_buffer, sparam_offset, queue, event));
+        return checkResult(CLBlastDrotmgNative(sd1_buffer, sd1_offset, sd2_buffer, sd2_offset, sx1_buffer, sx1_offset, sy1_buffer, sy1_offset, sparam_buffer, sparam_offset, queue, null, event));
+    }
+    public static int CLBlastDrotmg(
+        cl_mem sd1_buffer, 
+        long sd1_offset, 
+        cl_mem sd2_buffer, 
+        long sd2_offset, 
+        cl_mem sx1_buffer, 
+        long sx1_offset, 
+        cl_mem sy1_buffer, 
+        long sy1_offset, 
+        cl_mem sparam_buffer, 
+        long sparam_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDrotmgNative(sd1_buffer, sd1_offset, sd2_buffer, sd2_offset, sx1_buffer, sx1_offset, sy1_buffer, sy1_offset, sparam_buffer, sparam_offset, queue, waitList, event));
     }
     private static native int CLBlastDrotmgNative(
         cl_mem sd1_buffer, 
@@ -257,6 +884,7 @@ public class CLBlast
         cl_mem sparam_buffer, 
         long sparam_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
@@ -274,7 +902,23 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSrotNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, cos, sin, queue, event));
+        return checkResult(CLBlastSrotNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, cos, sin, queue, null, event));
+    }
+    public static int CLBlastSrot(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float cos, 
+        float sin, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSrotNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, cos, sin, queue, waitList, event));
     }
     private static native int CLBlastSrotNative(
         long n, 
@@ -287,6 +931,7 @@ public class CLBlast
         float cos, 
         float sin, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
@@ -303,9 +948,9 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDrotNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, cos, sin, queue, event));
+        return checkResult(CLBlastDrotNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, cos, sin, queue, null, event));
     }
-    private static native int CLBlastDrotNative(
+    public static int CLBlastDrot(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -316,26 +961,12 @@ public class CLBlast
         double cos, 
         double sin, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    // Apply modified givens plane rotation: SROTM/DROTM
-    public static int CLBlastSrotm(
-        long n, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem sparam_buffer, 
-        long sparam_offset, 
-        cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSrotmNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, sparam_buffer, sparam_offset, queue, event));
+        return checkResult(CLBlastDrotNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, cos, sin, queue, waitList, event));
     }
-    private static native int CLBlastSrotmNative(
+    private static native int CLBlastDrotNative(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -343,13 +974,15 @@ public class CLBlast
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
-        cl_mem sparam_buffer, 
-        long sparam_offset, 
+        double cos, 
+        double sin, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDrotm(
+    // Apply modified givens plane rotation: SROTM/DROTM
+    public static int CLBlastSrotm(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -362,9 +995,9 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDrotmNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, sparam_buffer, sparam_offset, queue, event));
+        return checkResult(CLBlastSrotmNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, sparam_buffer, sparam_offset, queue, null, event));
     }
-    private static native int CLBlastDrotmNative(
+    public static int CLBlastSrotm(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -375,24 +1008,12 @@ public class CLBlast
         cl_mem sparam_buffer, 
         long sparam_offset, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    // Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
-    public static int CLBlastSswap(
-        long n, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastSrotmNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, sparam_buffer, sparam_offset, queue, waitList, event));
     }
-    private static native int CLBlastSswapNative(
+    private static native int CLBlastSrotmNative(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -400,11 +1021,14 @@ public class CLBlast
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
+        cl_mem sparam_buffer, 
+        long sparam_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDswap(
+    public static int CLBlastDrotm(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -412,24 +1036,14 @@ public class CLBlast
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
+        cl_mem sparam_buffer, 
+        long sparam_offset, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastDrotmNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, sparam_buffer, sparam_offset, queue, null, event));
     }
-    private static native int CLBlastDswapNative(
-        long n, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCswap(
+    public static int CLBlastDrotm(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -437,12 +1051,15 @@ public class CLBlast
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
+        cl_mem sparam_buffer, 
+        long sparam_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastDrotmNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, sparam_buffer, sparam_offset, queue, waitList, event));
     }
-    private static native int CLBlastCswapNative(
+    private static native int CLBlastDrotmNative(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -450,11 +1067,15 @@ public class CLBlast
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
+        cl_mem sparam_buffer, 
+        long sparam_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZswap(
+    // Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
+    public static int CLBlastSswap(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -465,9 +1086,9 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastSswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZswapNative(
+    public static int CLBlastSswap(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -476,96 +1097,78 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    // Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
-    public static int CLBlastSscal(
-        long n, 
-        float alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastSswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastSscalNative(
+    private static native int CLBlastSswapNative(
         long n, 
-        float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDscal(
+    public static int CLBlastDswap(
         long n, 
-        double alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastDswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDscalNative(
-        long n, 
-        double alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCscal(
+    public static int CLBlastDswap(
         long n, 
-        float[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastDswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastCscalNative(
+    private static native int CLBlastDswapNative(
         long n, 
-        float[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZscal(
+    public static int CLBlastCswap(
         long n, 
-        double[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastCswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZscalNative(
-        long n, 
-        double[] alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY/HCOPY
-    public static int CLBlastScopy(
+    public static int CLBlastCswap(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -574,11 +1177,12 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastScopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastCswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastScopyNative(
+    private static native int CLBlastCswapNative(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -587,10 +1191,11 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDcopy(
+    public static int CLBlastZswap(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -601,9 +1206,9 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastZswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDcopyNative(
+    public static int CLBlastZswap(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -612,10 +1217,12 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCcopy(
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZswapNative(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -624,11 +1231,11 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
-        cl_event event)
-    {
-        return checkResult(CLBlastCcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
-    }
-    private static native int CLBlastCcopyNative(
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHswap(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -637,10 +1244,11 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZcopy(
+        cl_event event)
+    {
+        return checkResult(CLBlastHswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastHswap(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -649,11 +1257,12 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastHswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastZcopyNative(
+    private static native int CLBlastHswapNative(
         long n, 
         cl_mem x_buffer, 
         long x_offset, 
@@ -662,211 +1271,258 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
-    public static int CLBlastSaxpy(
+    // Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
+    public static int CLBlastSscal(
         long n, 
         float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastSscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastSaxpyNative(
+    public static int CLBlastSscal(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastSscalNative(
         long n, 
         float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDaxpy(
+    public static int CLBlastDscal(
         long n, 
         double alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastDscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDaxpyNative(
+    public static int CLBlastDscal(
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDscalNative(
         long n, 
         double alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastCaxpy(
+    public static int CLBlastCscal(
         long n, 
         float[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastCscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastCaxpyNative(
+    public static int CLBlastCscal(
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastCscalNative(
         long n, 
         float[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZaxpy(
+    public static int CLBlastCscal(
         long n, 
-        double[] alpha, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastCscalSplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZaxpyNative(
+    public static int CLBlastCscal(
         long n, 
-        double[] alpha, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCscalSplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastCscalSplitNative(
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Dot product of two vectors: SDOT/DDOT/HDOT
-    public static int CLBlastSdot(
+    public static int CLBlastZscal(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
+        double[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSdotNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastZscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastSdotNative(
+    public static int CLBlastZscal(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
+        double[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZscalNative(
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDdot(
+    public static int CLBlastZscal(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDdotNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastZscalSplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDdotNative(
+    public static int CLBlastZscal(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZscalSplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZscalSplitNative(
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Dot product of two complex vectors: CDOTU/ZDOTU
-    public static int CLBlastCdotu(
+    public static int CLBlastHscal(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
+        float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCdotuNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastHscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastCdotuNative(
+    public static int CLBlastHscal(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastHscalNative(
+        long n, 
+        float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZdotu(
+    // Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY/HCOPY
+    public static int CLBlastScopy(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
@@ -876,27 +1532,10 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZdotuNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastScopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZdotuNative(
-        long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Dot product of two complex vectors, one conjugated: CDOTC/ZDOTC
-    public static int CLBlastCdotc(
+    public static int CLBlastScopy(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
@@ -904,14 +1543,13 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCdotcNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastScopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastCdotcNative(
+    private static native int CLBlastScopyNative(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
@@ -919,13 +1557,12 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZdotc(
+    public static int CLBlastDcopy(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
@@ -935,12 +1572,10 @@ public class CLBlast
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZdotcNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastDcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZdotcNative(
+    public static int CLBlastDcopy(
         long n, 
-        cl_mem dot_buffer, 
-        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
@@ -948,4867 +1583,12667 @@ public class CLBlast
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    // Euclidian norm of a vector: SNRM2/DNRM2/ScNRM2/DzNRM2/HNRM2
-    public static int CLBlastSnrm2(
-        long n, 
-        cl_mem nrm2_buffer, 
-        long nrm2_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastDcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastSnrm2Native(
+    private static native int CLBlastDcopyNative(
         long n, 
-        cl_mem nrm2_buffer, 
-        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDnrm2(
+    public static int CLBlastCcopy(
         long n, 
-        cl_mem nrm2_buffer, 
-        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastCcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDnrm2Native(
-        long n, 
-        cl_mem nrm2_buffer, 
-        long nrm2_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastScnrm2(
+    public static int CLBlastCcopy(
         long n, 
-        cl_mem nrm2_buffer, 
-        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastScnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastCcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastScnrm2Native(
+    private static native int CLBlastCcopyNative(
         long n, 
-        cl_mem nrm2_buffer, 
-        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDznrm2(
+    public static int CLBlastZcopy(
         long n, 
-        cl_mem nrm2_buffer, 
-        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDznrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastZcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDznrm2Native(
-        long n, 
-        cl_mem nrm2_buffer, 
-        long nrm2_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Absolute sum of values in a vector: SASUM/DASUM/ScASUM/DzASUM/HASUM
-    public static int CLBlastSasum(
+    public static int CLBlastZcopy(
         long n, 
-        cl_mem asum_buffer, 
-        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastZcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastSasumNative(
+    private static native int CLBlastZcopyNative(
         long n, 
-        cl_mem asum_buffer, 
-        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDasum(
+    public static int CLBlastHcopy(
         long n, 
-        cl_mem asum_buffer, 
-        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastHcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDasumNative(
-        long n, 
-        cl_mem asum_buffer, 
-        long asum_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastScasum(
+    public static int CLBlastHcopy(
         long n, 
-        cl_mem asum_buffer, 
-        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastScasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastHcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastScasumNative(
+    private static native int CLBlastHcopyNative(
         long n, 
-        cl_mem asum_buffer, 
-        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDzasum(
+    // Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
+    public static int CLBlastSaxpy(
         long n, 
-        cl_mem asum_buffer, 
-        long asum_offset, 
+        float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDzasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastSaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDzasumNative(
-        long n, 
-        cl_mem asum_buffer, 
-        long asum_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Sum of values in a vector (non-BLAS function): SSUM/DSUM/ScSUM/DzSUM/HSUM
-    public static int CLBlastSsum(
+    public static int CLBlastSaxpy(
         long n, 
-        cl_mem sum_buffer, 
-        long sum_offset, 
+        float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastSaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastSsumNative(
+    private static native int CLBlastSaxpyNative(
         long n, 
-        cl_mem sum_buffer, 
-        long sum_offset, 
+        float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDsum(
+    public static int CLBlastDaxpy(
         long n, 
-        cl_mem sum_buffer, 
-        long sum_offset, 
+        double alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastDaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDsumNative(
+    public static int CLBlastDaxpy(
         long n, 
-        cl_mem sum_buffer, 
-        long sum_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastScsum(
-        long n, 
-        cl_mem sum_buffer, 
-        long sum_offset, 
+        double alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastScsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastDaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastScsumNative(
+    private static native int CLBlastDaxpyNative(
         long n, 
-        cl_mem sum_buffer, 
-        long sum_offset, 
+        double alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDzsum(
+    public static int CLBlastCaxpy(
         long n, 
-        cl_mem sum_buffer, 
-        long sum_offset, 
+        float[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDzsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastCaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDzsumNative(
-        long n, 
-        cl_mem sum_buffer, 
-        long sum_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Index of absolute maximum value in a vector: iSAMAX/iDAMAX/iCAMAX/iZAMAX/iHAMAX
-    public static int CLBlastiSamax(
+    public static int CLBlastCaxpy(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        float[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastiSamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastCaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastiSamaxNative(
+    private static native int CLBlastCaxpyNative(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        float[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastiDamax(
+    public static int CLBlastCaxpy(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastiDamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastCaxpySplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastiDamaxNative(
-        long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastiCamax(
+    public static int CLBlastCaxpy(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastiCamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastCaxpySplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastiCamaxNative(
+    private static native int CLBlastCaxpySplitNative(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastiZamax(
+    public static int CLBlastZaxpy(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        double[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastiZamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastZaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastiZamaxNative(
-        long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Index of absolute minimum value in a vector (non-BLAS function): iSAMIN/iDAMIN/iCAMIN/iZAMIN/iHAMIN
-    public static int CLBlastiSamin(
+    public static int CLBlastZaxpy(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        double[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastiSaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastZaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastiSaminNative(
+    private static native int CLBlastZaxpyNative(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        double[] alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastiDamin(
+    public static int CLBlastZaxpy(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastiDaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastZaxpySplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastiDaminNative(
-        long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastiCamin(
+    public static int CLBlastZaxpy(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastiCaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastZaxpySplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastiCaminNative(
+    private static native int CLBlastZaxpySplitNative(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastiZamin(
+    public static int CLBlastHaxpy(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastiZaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastHaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastiZaminNative(
-        long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Index of maximum value in a vector (non-BLAS function): iSMAX/iDMAX/iCMAX/iZMAX/iHMAX
-    public static int CLBlastiSmax(
+    public static int CLBlastHaxpy(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastiSmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastHaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastiSmaxNative(
+    private static native int CLBlastHaxpyNative(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastiDmax(
+    // Dot product of two vectors: SDOT/DDOT/HDOT
+    public static int CLBlastSdot(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastiDmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastSdotNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastiDmaxNative(
-        long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastiCmax(
+    public static int CLBlastSdot(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastiCmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastSdotNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastiCmaxNative(
+    private static native int CLBlastSdotNative(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastiZmax(
+    public static int CLBlastDdot(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastiZmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastDdotNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastiZmaxNative(
+    public static int CLBlastDdot(
         long n, 
-        cl_mem imax_buffer, 
-        long imax_offset, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    // Index of minimum value in a vector (non-BLAS function): iSMIN/iDMIN/iCMIN/iZMIN/iHMIN
-    public static int CLBlastiSmin(
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDdotNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDdotNative(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event)
-    {
-        return checkResult(CLBlastiSminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, event));
-    }
-    private static native int CLBlastiSminNative(
-        long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastiDmin(
+    public static int CLBlastHdot(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastiDminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastHdotNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastiDminNative(
-        long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastiCmin(
+    public static int CLBlastHdot(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastiCminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastHdotNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastiCminNative(
+    private static native int CLBlastHdotNative(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastiZmin(
+    // Dot product of two complex vectors: CDOTU/ZDOTU
+    public static int CLBlastCdotu(
         long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastiZminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastCdotuNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastiZminNative(
-        long n, 
-        cl_mem imin_buffer, 
-        long imin_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // =================================================================================================
-    // BLAS level-2 (matrix-vector) routines
-    // =================================================================================================
-    // General matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
-    public static int CLBlastSgemv(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    public static int CLBlastCdotu(
         long n, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastCdotuNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastSgemvNative(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    private static native int CLBlastCdotuNative(
         long n, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDgemv(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    public static int CLBlastZdotu(
         long n, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastZdotuNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDgemvNative(
-        int layout, 
-        int a_transpose, 
-        long m, 
-        long n, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        double beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCgemv(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    public static int CLBlastZdotu(
         long n, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float[] beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastZdotuNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastCgemvNative(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    private static native int CLBlastZdotuNative(
         long n, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float[] beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZgemv(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    // Dot product of two complex vectors, one conjugated: CDOTC/ZDOTC
+    public static int CLBlastCdotc(
         long n, 
-        double[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double[] beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastCdotcNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZgemvNative(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    public static int CLBlastCdotc(
         long n, 
-        double[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double[] beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    // General banded matrix-vector multiplication: SGBMV/DGBMV/CGBMV/ZGBMV/HGBMV
-    public static int CLBlastSgbmv(
-        int layout, 
-        int a_transpose, 
-        long m, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCdotcNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastCdotcNative(
         long n, 
-        long kl, 
-        long ku, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
-        cl_event event)
-    {
-        return checkResult(CLBlastSgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
-    }
-    private static native int CLBlastSgbmvNative(
-        int layout, 
-        int a_transpose, 
-        long m, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZdotc(
         long n, 
-        long kl, 
-        long ku, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastDgbmv(
-        int layout, 
-        int a_transpose, 
-        long m, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZdotcNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastZdotc(
         long n, 
-        long kl, 
-        long ku, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastDgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastZdotcNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastDgbmvNative(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    private static native int CLBlastZdotcNative(
         long n, 
-        long kl, 
-        long ku, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastCgbmv(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    // Euclidian norm of a vector: SNRM2/DNRM2/ScNRM2/DzNRM2/HNRM2
+    public static int CLBlastSnrm2(
         long n, 
-        long kl, 
-        long ku, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastSnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastCgbmvNative(
-        int layout, 
-        int a_transpose, 
-        long m, 
-        long n, 
-        long kl, 
-        long ku, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        float[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZgbmv(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    public static int CLBlastSnrm2(
         long n, 
-        long kl, 
-        long ku, 
-        double[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastSnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastZgbmvNative(
-        int layout, 
-        int a_transpose, 
-        long m, 
+    private static native int CLBlastSnrm2Native(
         long n, 
-        long kl, 
-        long ku, 
-        double[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Hermitian matrix-vector multiplication: CHEMV/ZHEMV
-    public static int CLBlastChemv(
-        int layout, 
-        int triangle, 
+    public static int CLBlastDnrm2(
         long n, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastChemvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastDnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastChemvNative(
-        int layout, 
-        int triangle, 
-        long n, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        float[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZhemv(
-        int layout, 
-        int triangle, 
+    public static int CLBlastDnrm2(
         long n, 
-        double[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZhemvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastDnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastZhemvNative(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastDnrm2Native(
         long n, 
-        double[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Hermitian banded matrix-vector multiplication: CHBMV/ZHBMV
-    public static int CLBlastChbmv(
-        int layout, 
-        int triangle, 
+    public static int CLBlastScnrm2(
         long n, 
-        long k, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastChbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastScnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastChbmvNative(
-        int layout, 
-        int triangle, 
-        long n, 
-        long k, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        float[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZhbmv(
-        int layout, 
-        int triangle, 
+    public static int CLBlastScnrm2(
         long n, 
-        long k, 
-        double[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZhbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastScnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastZhbmvNative(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastScnrm2Native(
         long n, 
-        long k, 
-        double[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Hermitian packed matrix-vector multiplication: CHPMV/ZHPMV
-    public static int CLBlastChpmv(
-        int layout, 
-        int triangle, 
+    public static int CLBlastDznrm2(
         long n, 
-        float[] alpha, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastChpmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastDznrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastChpmvNative(
-        int layout, 
-        int triangle, 
+    public static int CLBlastDznrm2(
         long n, 
-        float[] alpha, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDznrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDznrm2Native(
+        long n, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZhpmv(
-        int layout, 
-        int triangle, 
+    public static int CLBlastHnrm2(
         long n, 
-        double[] alpha, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZhpmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastHnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZhpmvNative(
-        int layout, 
-        int triangle, 
+    public static int CLBlastHnrm2(
         long n, 
-        double[] alpha, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        double[] beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Symmetric matrix-vector multiplication: SSYMV/DSYMV/HSYMV
-    public static int CLBlastSsymv(
-        int layout, 
-        int triangle, 
-        long n, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSsymvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastHnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastSsymvNative(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastHnrm2Native(
         long n, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDsymv(
-        int layout, 
-        int triangle, 
+    // Absolute sum of values in a vector: SASUM/DASUM/ScASUM/DzASUM/HASUM
+    public static int CLBlastSasum(
         long n, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDsymvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastSasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDsymvNative(
-        int layout, 
-        int triangle, 
-        long n, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        double beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Symmetric banded matrix-vector multiplication: SSBMV/DSBMV/HSBMV
-    public static int CLBlastSsbmv(
-        int layout, 
-        int triangle, 
+    public static int CLBlastSasum(
         long n, 
-        long k, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSsbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastSasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastSsbmvNative(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastSasumNative(
         long n, 
-        long k, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDsbmv(
-        int layout, 
-        int triangle, 
+    public static int CLBlastDasum(
         long n, 
-        long k, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDsbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastDasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDsbmvNative(
-        int layout, 
-        int triangle, 
-        long n, 
-        long k, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        double beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Symmetric packed matrix-vector multiplication: SSPMV/DSPMV/HSPMV
-    public static int CLBlastSspmv(
-        int layout, 
-        int triangle, 
+    public static int CLBlastDasum(
         long n, 
-        float alpha, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSspmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastDasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastSspmvNative(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastDasumNative(
         long n, 
-        float alpha, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        float beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDspmv(
-        int layout, 
-        int triangle, 
+    public static int CLBlastScasum(
         long n, 
-        double alpha, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDspmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+        return checkResult(CLBlastScasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDspmvNative(
-        int layout, 
-        int triangle, 
+    public static int CLBlastScasum(
         long n, 
-        double alpha, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastScasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastScasumNative(
+        long n, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        double beta, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Triangular matrix-vector multiplication: STRMV/DTRMV/CTRMV/ZTRMV/HTRMV
-    public static int CLBlastStrmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastDzasum(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastStrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastDzasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastStrmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastDzasum(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDzasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDzasumNative(
+        long n, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDtrmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastHasum(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastHasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDtrmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastHasum(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCtrmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastHasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastCtrmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    private static native int CLBlastHasumNative(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZtrmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    // Sum of values in a vector (non-BLAS function): SSUM/DSUM/ScSUM/DzSUM/HSUM
+    public static int CLBlastSsum(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastSsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZtrmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Triangular banded matrix-vector multiplication: STBMV/DTBMV/CTBMV/ZTBMV/HTBMV
-    public static int CLBlastStbmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastSsum(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastStbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastSsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastStbmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    private static native int CLBlastSsumNative(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDtbmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastDsum(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastDsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDtbmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCtbmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastDsum(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastDsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastCtbmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    private static native int CLBlastDsumNative(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZtbmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastScsum(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastScsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZtbmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Triangular packed matrix-vector multiplication: STPMV/DTPMV/CTPMV/ZTPMV/HTPMV
-    public static int CLBlastStpmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastScsum(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastStpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastScsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastStpmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    private static native int CLBlastScsumNative(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDtpmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastDzsum(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastDzsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDtpmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastDzsum(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDzsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDzsumNative(
+        long n, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastCtpmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastHsum(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastHsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastCtpmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastHsum(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsumNative(n, sum_buffer, sum_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastHsumNative(
+        long n, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZtpmv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    // Index of absolute maximum value in a vector: iSAMAX/iDAMAX/iCAMAX/iZAMAX/iHAMAX
+    public static int CLBlastiSamax(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiSamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZtpmvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Solves a triangular system of equations: STRSV/DTRSV/CTRSV/ZTRSV
-    public static int CLBlastStrsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiSamax(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastStrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiSamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastStrsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    private static native int CLBlastiSamaxNative(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDtrsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiDamax(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDtrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiDamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDtrsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCtrsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiDamax(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCtrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiDamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastCtrsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    private static native int CLBlastiDamaxNative(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZtrsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiCamax(
         long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZtrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiCamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZtrsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
-    public static int CLBlastStbsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiCamax(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastStbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiCamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastStbsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    private static native int CLBlastiCamaxNative(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDtbsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiZamax(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDtbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiZamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDtbsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCtbsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiZamax(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCtbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiZamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastCtbsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    private static native int CLBlastiZamaxNative(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZtbsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiHamax(
         long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZtbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiHamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZtbsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        long k, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
-    public static int CLBlastStpsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiHamax(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastStpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiHamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastStpsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    private static native int CLBlastiHamaxNative(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDtpsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    // Index of absolute minimum value in a vector (non-BLAS function): iSAMIN/iDAMIN/iCAMIN/iZAMIN/iHAMIN
+    public static int CLBlastiSamin(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDtpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiSaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDtpsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiSamin(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCtpsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCtpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiSaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastCtpsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    private static native int CLBlastiSaminNative(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZtpsv(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
+    public static int CLBlastiDamin(
         long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZtpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, event));
+        return checkResult(CLBlastiDaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZtpsvNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long n, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // General rank-1 matrix update: SGER/DGER/HGER
-    public static int CLBlastSger(
-        int layout, 
-        long m, 
+    public static int CLBlastiDamin(
         long n, 
-        float alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSgerNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiDaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastSgerNative(
-        int layout, 
-        long m, 
+    private static native int CLBlastiDaminNative(
         long n, 
-        float alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDger(
-        int layout, 
-        long m, 
+    public static int CLBlastiCamin(
         long n, 
-        double alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDgerNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiCaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDgerNative(
-        int layout, 
-        long m, 
-        long n, 
-        double alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // General rank-1 complex matrix update: CGERU/ZGERU
-    public static int CLBlastCgeru(
-        int layout, 
-        long m, 
+    public static int CLBlastiCamin(
         long n, 
-        float[] alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCgeruNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiCaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastCgeruNative(
-        int layout, 
-        long m, 
+    private static native int CLBlastiCaminNative(
         long n, 
-        float[] alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZgeru(
-        int layout, 
-        long m, 
+    public static int CLBlastiZamin(
         long n, 
-        double[] alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZgeruNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiZaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZgeruNative(
-        int layout, 
-        long m, 
-        long n, 
-        double[] alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // General rank-1 complex conjugated matrix update: CGERC/ZGERC
-    public static int CLBlastCgerc(
-        int layout, 
-        long m, 
+    public static int CLBlastiZamin(
         long n, 
-        float[] alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCgercNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiZaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastCgercNative(
-        int layout, 
-        long m, 
+    private static native int CLBlastiZaminNative(
         long n, 
-        float[] alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZgerc(
-        int layout, 
-        long m, 
+    public static int CLBlastiHamin(
         long n, 
-        double[] alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZgercNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiHaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZgercNative(
-        int layout, 
-        long m, 
-        long n, 
-        double[] alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Hermitian rank-1 matrix update: CHER/ZHER
-    public static int CLBlastCher(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiHamin(
         long n, 
-        float alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCherNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiHaminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastCherNative(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastiHaminNative(
         long n, 
-        float alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZher(
-        int layout, 
-        int triangle, 
+    // Index of maximum value in a vector (non-BLAS function): iSMAX/iDMAX/iCMAX/iZMAX/iHMAX
+    public static int CLBlastiSmax(
         long n, 
-        double alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZherNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiSmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZherNative(
-        int layout, 
-        int triangle, 
-        long n, 
-        double alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Hermitian packed rank-1 matrix update: CHPR/ZHPR
-    public static int CLBlastChpr(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiSmax(
         long n, 
-        float alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastChprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, event));
+        return checkResult(CLBlastiSmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastChprNative(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastiSmaxNative(
         long n, 
-        float alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZhpr(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiDmax(
         long n, 
-        double alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZhprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, event));
+        return checkResult(CLBlastiDmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZhprNative(
-        int layout, 
-        int triangle, 
-        long n, 
-        double alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Hermitian rank-2 matrix update: CHER2/ZHER2
-    public static int CLBlastCher2(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiDmax(
         long n, 
-        float[] alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCher2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiDmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastCher2Native(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastiDmaxNative(
         long n, 
-        float[] alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZher2(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiCmax(
         long n, 
-        double[] alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZher2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiCmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZher2Native(
-        int layout, 
-        int triangle, 
-        long n, 
-        double[] alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Hermitian packed rank-2 matrix update: CHPR2/ZHPR2
-    public static int CLBlastChpr2(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiCmax(
         long n, 
-        float[] alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastChpr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, event));
+        return checkResult(CLBlastiCmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastChpr2Native(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastiCmaxNative(
         long n, 
-        float[] alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZhpr2(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiZmax(
         long n, 
-        double[] alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZhpr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, event));
+        return checkResult(CLBlastiZmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastZhpr2Native(
-        int layout, 
-        int triangle, 
-        long n, 
-        double[] alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Symmetric rank-1 matrix update: SSYR/DSYR/HSYR
-    public static int CLBlastSsyr(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiZmax(
         long n, 
-        float alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSsyrNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiZmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastSsyrNative(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastiZmaxNative(
         long n, 
-        float alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDsyr(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiHmax(
         long n, 
-        double alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDsyrNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiHmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDsyrNative(
-        int layout, 
-        int triangle, 
-        long n, 
-        double alpha, 
-        cl_mem x_buffer, 
-        long x_offset, 
-        long x_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Symmetric packed rank-1 matrix update: SSPR/DSPR/HSPR
-    public static int CLBlastSspr(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiHmax(
         long n, 
-        float alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSsprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, event));
+        return checkResult(CLBlastiHmaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
     }
-    private static native int CLBlastSsprNative(
-        int layout, 
-        int triangle, 
+    private static native int CLBlastiHmaxNative(
         long n, 
-        float alpha, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDspr(
-        int layout, 
-        int triangle, 
+    // Index of minimum value in a vector (non-BLAS function): iSMIN/iDMIN/iCMIN/iZMIN/iHMIN
+    public static int CLBlastiSmin(
         long n, 
-        double alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDsprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, event));
+        return checkResult(CLBlastiSminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDsprNative(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiSmin(
         long n, 
-        double alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    // Symmetric rank-2 matrix update: SSYR2/DSYR2/HSYR2
-    public static int CLBlastSsyr2(
-        int layout, 
-        int triangle, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastiSminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastiSminNative(
         long n, 
-        float alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastiDmin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSsyr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiDminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastSsyr2Native(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiDmin(
         long n, 
-        float alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastiDminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastiDminNative(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDsyr2(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiCmin(
         long n, 
-        double alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDsyr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+        return checkResult(CLBlastiCminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDsyr2Native(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiCmin(
         long n, 
-        double alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastiCminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastiCminNative(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Symmetric packed rank-2 matrix update: SSPR2/DSPR2/HSPR2
-    public static int CLBlastSspr2(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiZmin(
         long n, 
-        float alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSspr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, event));
+        return checkResult(CLBlastiZminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastSspr2Native(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiZmin(
         long n, 
-        float alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastiZminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastiZminNative(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDspr2(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiHmin(
         long n, 
-        double alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDspr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, event));
+        return checkResult(CLBlastiHminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, null, event));
     }
-    private static native int CLBlastDspr2Native(
-        int layout, 
-        int triangle, 
+    public static int CLBlastiHmin(
         long n, 
-        double alpha, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
-        cl_mem y_buffer, 
-        long y_offset, 
-        long y_inc, 
-        cl_mem ap_buffer, 
-        long ap_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastiHminNative(n, imin_buffer, imin_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastiHminNative(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
     // =================================================================================================
-    // BLAS level-3 (matrix-matrix) routines
+    // BLAS level-2 (matrix-vector) routines
     // =================================================================================================
-    // General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
-    public static int CLBlastSgemm(
+    // General matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
+    public static int CLBlastSgemv(
         int layout, 
         int a_transpose, 
-        int b_transpose, 
         long m, 
         long n, 
-        long k, 
         float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastSgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastSgemmNative(
+    public static int CLBlastSgemv(
         int layout, 
         int a_transpose, 
-        int b_transpose, 
         long m, 
         long n, 
-        long k, 
         float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastSgemvNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDgemm(
+    public static int CLBlastDgemv(
         int layout, 
         int a_transpose, 
-        int b_transpose, 
         long m, 
         long n, 
-        long k, 
         double alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastDgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDgemmNative(
+    public static int CLBlastDgemv(
         int layout, 
         int a_transpose, 
-        int b_transpose, 
         long m, 
         long n, 
-        long k, 
         double alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCgemm(
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDgemvNative(
         int layout, 
         int a_transpose, 
-        int b_transpose, 
         long m, 
         long n, 
-        long k, 
-        float[] alpha, 
+        double alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
-        cl_event event)
-    {
-        return checkResult(CLBlastCgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
-    }
-    private static native int CLBlastCgemmNative(
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemv(
         int layout, 
         int a_transpose, 
-        int b_transpose, 
         long m, 
         long n, 
-        long k, 
         float[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         float[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZgemm(
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastCgemv(
         int layout, 
         int a_transpose, 
-        int b_transpose, 
         long m, 
         long n, 
-        long k, 
-        double[] alpha, 
+        float[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        double[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastCgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastZgemmNative(
+    private static native int CLBlastCgemvNative(
         int layout, 
         int a_transpose, 
-        int b_transpose, 
         long m, 
         long n, 
-        long k, 
-        double[] alpha, 
+        float[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        double[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM/HSYMM
-    public static int CLBlastSsymm(
+    public static int CLBlastCgemv(
         int layout, 
-        int side, 
-        int triangle, 
+        int a_transpose, 
         long m, 
         long n, 
-        float alpha, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastCgemvSplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastSsymmNative(
-        int layout, 
-        int side, 
-        int triangle, 
-        long m, 
-        long n, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastDsymm(
+    public static int CLBlastCgemv(
         int layout, 
-        int side, 
-        int triangle, 
+        int a_transpose, 
         long m, 
         long n, 
-        double alpha, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastDsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastCgemvSplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastDsymmNative(
+    private static native int CLBlastCgemvSplitNative(
         int layout, 
-        int side, 
-        int triangle, 
+        int a_transpose, 
         long m, 
         long n, 
-        double alpha, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastCsymm(
+    public static int CLBlastZgemv(
         int layout, 
-        int side, 
-        int triangle, 
+        int a_transpose, 
         long m, 
         long n, 
-        float[] alpha, 
+        double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastZgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastCsymmNative(
-        int layout, 
-        int side, 
-        int triangle, 
-        long m, 
-        long n, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZsymm(
+    public static int CLBlastZgemv(
         int layout, 
-        int side, 
-        int triangle, 
+        int a_transpose, 
         long m, 
         long n, 
         double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         double[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastZgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastZsymmNative(
+    private static native int CLBlastZgemvNative(
         int layout, 
-        int side, 
-        int triangle, 
+        int a_transpose, 
         long m, 
         long n, 
         double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         double[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
-    public static int CLBlastChemm(
+    public static int CLBlastZgemv(
         int layout, 
-        int side, 
-        int triangle, 
+        int a_transpose, 
         long m, 
         long n, 
-        float[] alpha, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastChemmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastZgemvSplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastChemmNative(
+    public static int CLBlastZgemv(
         int layout, 
-        int side, 
-        int triangle, 
-        long m, 
-        long n, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZhemm(
-        int layout, 
-        int side, 
-        int triangle, 
+        int a_transpose, 
         long m, 
         long n, 
-        double[] alpha, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        double[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZhemmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastZgemvSplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastZhemmNative(
+    private static native int CLBlastZgemvSplitNative(
         int layout, 
-        int side, 
-        int triangle, 
+        int a_transpose, 
         long m, 
         long n, 
-        double[] alpha, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        double[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK/HSYRK
-    public static int CLBlastSsyrk(
+    public static int CLBlastHgemv(
         int layout, 
-        int triangle, 
         int a_transpose, 
+        long m, 
         long n, 
-        long k, 
         float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastHgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastSsyrkNative(
+    public static int CLBlastHgemv(
         int layout, 
-        int triangle, 
         int a_transpose, 
+        long m, 
         long n, 
-        long k, 
         float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastDsyrk(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        long n, 
-        long k, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastDsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastHgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastDsyrkNative(
+    private static native int CLBlastHgemvNative(
         int layout, 
-        int triangle, 
         int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        double alpha, 
+        float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastCsyrk(
+    // General banded matrix-vector multiplication: SGBMV/DGBMV/CGBMV/ZGBMV/HGBMV
+    public static int CLBlastSgbmv(
         int layout, 
-        int triangle, 
         int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        float[] alpha, 
+        long kl, 
+        long ku, 
+        float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        float[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastSgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastCsyrkNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        long n, 
-        long k, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        float[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZsyrk(
+    public static int CLBlastSgbmv(
         int layout, 
-        int triangle, 
         int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        double[] alpha, 
+        long kl, 
+        long ku, 
+        float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        double[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastSgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastZsyrkNative(
+    private static native int CLBlastSgbmvNative(
         int layout, 
-        int triangle, 
         int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        double[] alpha, 
+        long kl, 
+        long ku, 
+        float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        double[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Rank-K update of a hermitian matrix: CHERK/ZHERK
-    public static int CLBlastCherk(
+    public static int CLBlastDgbmv(
         int layout, 
-        int triangle, 
         int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        float alpha, 
+        long kl, 
+        long ku, 
+        double alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCherkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastDgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastCherkNative(
-        int layout, 
-        int triangle, 
-        int a_transpose, 
-        long n, 
-        long k, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZherk(
+    public static int CLBlastDgbmv(
         int layout, 
-        int triangle, 
         int a_transpose, 
+        long m, 
         long n, 
-        long k, 
+        long kl, 
+        long ku, 
         double alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZherkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastDgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastZherkNative(
+    private static native int CLBlastDgbmvNative(
         int layout, 
-        int triangle, 
         int a_transpose, 
+        long m, 
         long n, 
-        long k, 
+        long kl, 
+        long ku, 
         double alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K/HSYR2K
-    public static int CLBlastSsyr2k(
+    public static int CLBlastCgbmv(
         int layout, 
-        int triangle, 
-        int ab_transpose, 
+        int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        float alpha, 
+        long kl, 
+        long ku, 
+        float[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastCgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastSsyr2kNative(
-        int layout, 
-        int triangle, 
-        int ab_transpose, 
-        long n, 
-        long k, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastDsyr2k(
+    public static int CLBlastCgbmv(
         int layout, 
-        int triangle, 
-        int ab_transpose, 
+        int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        double alpha, 
+        long kl, 
+        long ku, 
+        float[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastDsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastCgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastDsyr2kNative(
+    private static native int CLBlastCgbmvNative(
         int layout, 
-        int triangle, 
-        int ab_transpose, 
+        int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        double alpha, 
+        long kl, 
+        long ku, 
+        float[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastCsyr2k(
+    public static int CLBlastCgbmv(
         int layout, 
-        int triangle, 
-        int ab_transpose, 
+        int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        float[] alpha, 
+        long kl, 
+        long ku, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastCgbmvSplitNative(layout, a_transpose, m, n, kl, ku, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastCsyr2kNative(
+    public static int CLBlastCgbmv(
         int layout, 
-        int triangle, 
-        int ab_transpose, 
+        int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        float[] alpha, 
+        long kl, 
+        long ku, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgbmvSplitNative(layout, a_transpose, m, n, kl, ku, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastCgbmvSplitNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        long kl, 
+        long ku, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZsyr2k(
+    public static int CLBlastZgbmv(
         int layout, 
-        int triangle, 
-        int ab_transpose, 
+        int a_transpose, 
+        long m, 
         long n, 
-        long k, 
+        long kl, 
+        long ku, 
         double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         double[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastZgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZsyr2kNative(
+    public static int CLBlastZgbmv(
         int layout, 
-        int triangle, 
-        int ab_transpose, 
+        int a_transpose, 
+        long m, 
         long n, 
-        long k, 
+        long kl, 
+        long ku, 
         double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         double[] beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
-    public static int CLBlastCher2k(
-        int layout, 
-        int triangle, 
-        int ab_transpose, 
-        long n, 
-        long k, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCher2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastZgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastCher2kNative(
+    private static native int CLBlastZgbmvNative(
         int layout, 
-        int triangle, 
-        int ab_transpose, 
+        int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        float[] alpha, 
+        long kl, 
+        long ku, 
+        double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        float beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZher2k(
+    public static int CLBlastZgbmv(
         int layout, 
-        int triangle, 
-        int ab_transpose, 
+        int a_transpose, 
+        long m, 
         long n, 
-        long k, 
-        double[] alpha, 
+        long kl, 
+        long ku, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZher2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+        return checkResult(CLBlastZgbmvSplitNative(layout, a_transpose, m, n, kl, ku, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZher2kNative(
-        int layout, 
-        int triangle, 
-        int ab_transpose, 
-        long n, 
-        long k, 
-        double[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        double beta, 
-        cl_mem c_buffer, 
-        long c_offset, 
-        long c_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM/HTRMM
-    public static int CLBlastStrmm(
+    public static int CLBlastZgbmv(
         int layout, 
-        int side, 
-        int triangle, 
         int a_transpose, 
-        int diagonal, 
         long m, 
         long n, 
-        float alpha, 
+        long kl, 
+        long ku, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastStrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastZgbmvSplitNative(layout, a_transpose, m, n, kl, ku, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastStrmmNative(
+    private static native int CLBlastZgbmvSplitNative(
         int layout, 
-        int side, 
-        int triangle, 
         int a_transpose, 
-        int diagonal, 
         long m, 
         long n, 
-        float alpha, 
+        long kl, 
+        long ku, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDtrmm(
+    public static int CLBlastHgbmv(
         int layout, 
-        int side, 
-        int triangle, 
         int a_transpose, 
-        int diagonal, 
         long m, 
         long n, 
-        double alpha, 
+        long kl, 
+        long ku, 
+        float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastHgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDtrmmNative(
-        int layout, 
-        int side, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
-        long n, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCtrmm(
+    public static int CLBlastHgbmv(
         int layout, 
-        int side, 
-        int triangle, 
         int a_transpose, 
-        int diagonal, 
         long m, 
         long n, 
-        float[] alpha, 
+        long kl, 
+        long ku, 
+        float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastHgbmvNative(layout, a_transpose, m, n, kl, ku, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastCtrmmNative(
+    private static native int CLBlastHgbmvNative(
         int layout, 
-        int side, 
-        int triangle, 
         int a_transpose, 
-        int diagonal, 
         long m, 
         long n, 
-        float[] alpha, 
+        long kl, 
+        long ku, 
+        float alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZtrmm(
+    // Hermitian matrix-vector multiplication: CHEMV/ZHEMV
+    public static int CLBlastChemv(
         int layout, 
-        int side, 
         int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
         long n, 
-        double[] alpha, 
+        float[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastChemvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZtrmmNative(
-        int layout, 
-        int side, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
-        long n, 
-        double[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Solves a triangular system of equations: STRSM/DTRSM/CTRSM/ZTRSM
-    public static int CLBlastStrsm(
+    public static int CLBlastChemv(
         int layout, 
-        int side, 
         int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
         long n, 
-        float alpha, 
+        float[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastStrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastChemvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastStrsmNative(
+    private static native int CLBlastChemvNative(
         int layout, 
-        int side, 
         int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
         long n, 
-        float alpha, 
+        float[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDtrsm(
+    public static int CLBlastChemv(
         int layout, 
-        int side, 
         int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
         long n, 
-        double alpha, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDtrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastChemvSplitNative(layout, triangle, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDtrsmNative(
+    public static int CLBlastChemv(
         int layout, 
-        int side, 
         int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
         long n, 
-        double alpha, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastCtrsm(
-        int layout, 
-        int side, 
-        int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
-        long n, 
-        float[] alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastCtrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastChemvSplitNative(layout, triangle, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastCtrsmNative(
+    private static native int CLBlastChemvSplitNative(
         int layout, 
-        int side, 
         int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
         long n, 
-        float[] alpha, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZtrsm(
+    public static int CLBlastZhemv(
         int layout, 
-        int side, 
         int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
         long n, 
         double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZtrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastZhemvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZtrsmNative(
+    public static int CLBlastZhemv(
         int layout, 
-        int side, 
         int triangle, 
-        int a_transpose, 
-        int diagonal, 
-        long m, 
         long n, 
         double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // =================================================================================================
-    // Extra non-BLAS routines (level-X)
-    // =================================================================================================
-    // Element-wise vector product (Hadamard): SHAD/DHAD/CHAD/ZHAD/HHAD
-    public static int CLBlastShad(
-        long n, 
-        float alpha, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        double[] beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
-        float beta, 
-        cl_mem z_buffer, 
-        long z_offset, 
-        long z_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastShadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, event));
+        return checkResult(CLBlastZhemvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastShadNative(
+    private static native int CLBlastZhemvNative(
+        int layout, 
+        int triangle, 
         long n, 
-        float alpha, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        double[] beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
-        float beta, 
-        cl_mem z_buffer, 
-        long z_offset, 
-        long z_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDhad(
+    public static int CLBlastZhemv(
+        int layout, 
+        int triangle, 
         long n, 
-        double alpha, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        double beta_real, 
+        double beta_imag, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
-        double beta, 
-        cl_mem z_buffer, 
-        long z_offset, 
-        long z_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDhadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, event));
+        return checkResult(CLBlastZhemvSplitNative(layout, triangle, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDhadNative(
+    public static int CLBlastZhemv(
+        int layout, 
+        int triangle, 
         long n, 
-        double alpha, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhemvSplitNative(layout, triangle, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZhemvSplitNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
-        double beta, 
-        cl_mem z_buffer, 
-        long z_offset, 
-        long z_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastChad(
+    // Hermitian banded matrix-vector multiplication: CHBMV/ZHBMV
+    public static int CLBlastChbmv(
+        int layout, 
+        int triangle, 
         long n, 
+        long k, 
         float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        float[] beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
-        float[] beta, 
-        cl_mem z_buffer, 
-        long z_offset, 
-        long z_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastChadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, event));
+        return checkResult(CLBlastChbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastChadNative(
+    public static int CLBlastChbmv(
+        int layout, 
+        int triangle, 
         long n, 
+        long k, 
         float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        float[] beta, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastChbmvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
         float[] beta, 
-        cl_mem z_buffer, 
-        long z_offset, 
-        long z_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZhad(
+    public static int CLBlastChbmv(
+        int layout, 
+        int triangle, 
         long n, 
-        double[] alpha, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        float beta_real, 
+        float beta_imag, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
-        double[] beta, 
-        cl_mem z_buffer, 
-        long z_offset, 
-        long z_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZhadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, event));
+        return checkResult(CLBlastChbmvSplitNative(layout, triangle, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZhadNative(
+    public static int CLBlastChbmv(
+        int layout, 
+        int triangle, 
         long n, 
-        double[] alpha, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
         cl_mem x_buffer, 
         long x_offset, 
         long x_inc, 
+        float beta_real, 
+        float beta_imag, 
         cl_mem y_buffer, 
         long y_offset, 
         long y_inc, 
-        double[] beta, 
-        cl_mem z_buffer, 
-        long z_offset, 
-        long z_inc, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
-    public static int CLBlastSomatcopy(
-        int layout, 
-        int a_transpose, 
-        long m, 
-        long n, 
-        float alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastChbmvSplitNative(layout, triangle, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastSomatcopyNative(
+    private static native int CLBlastChbmvSplitNative(
         int layout, 
-        int a_transpose, 
-        long m, 
+        int triangle, 
         long n, 
-        float alpha, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDomatcopy(
+    public static int CLBlastZhbmv(
         int layout, 
-        int a_transpose, 
-        long m, 
+        int triangle, 
         long n, 
-        double alpha, 
+        long k, 
+        double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        cl_command_queue queue, 
-        cl_event event)
-    {
-        return checkResult(CLBlastDomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
-    }
-    private static native int CLBlastDomatcopyNative(
-        int layout, 
-        int a_transpose, 
-        long m, 
-        long n, 
-        double alpha, 
-        cl_mem a_buffer, 
-        long a_offset, 
-        long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastComatcopy(
+        cl_event event)
+    {
+        return checkResult(CLBlastZhbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastZhbmv(
         int layout, 
-        int a_transpose, 
-        long m, 
+        int triangle, 
         long n, 
-        float[] alpha, 
+        long k, 
+        double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastComatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastZhbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastComatcopyNative(
+    private static native int CLBlastZhbmvNative(
         int layout, 
-        int a_transpose, 
-        long m, 
+        int triangle, 
         long n, 
-        float[] alpha, 
+        long k, 
+        double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastZomatcopy(
+    public static int CLBlastZhbmv(
         int layout, 
-        int a_transpose, 
-        long m, 
+        int triangle, 
         long n, 
-        double[] alpha, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+        return checkResult(CLBlastZhbmvSplitNative(layout, triangle, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastZomatcopyNative(
+    public static int CLBlastZhbmv(
         int layout, 
-        int a_transpose, 
-        long m, 
+        int triangle, 
         long n, 
-        double[] alpha, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        cl_mem b_buffer, 
-        long b_offset, 
-        long b_ld, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    // Im2col function (non-BLAS function): SIM2COL/DIM2COL/CIM2COL/ZIM2COL/HIM2COL
-    public static int CLBlastSim2col(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem col_buffer, 
-        long col_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastSim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, event));
+        return checkResult(CLBlastZhbmvSplitNative(layout, triangle, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastSim2colNative(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem col_buffer, 
-        long col_offset, 
+    private static native int CLBlastZhbmvSplitNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDim2col(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem col_buffer, 
-        long col_offset, 
+    // Hermitian packed matrix-vector multiplication: CHPMV/ZHPMV
+    public static int CLBlastChpmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, event));
+        return checkResult(CLBlastChpmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastDim2colNative(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem col_buffer, 
-        long col_offset, 
+    public static int CLBlastChpmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChpmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastChpmvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastCim2col(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem col_buffer, 
-        long col_offset, 
+    public static int CLBlastChpmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, event));
+        return checkResult(CLBlastChpmvSplitNative(layout, triangle, n, alpha_real, alpha_imag, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastCim2colNative(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem col_buffer, 
-        long col_offset, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZim2col(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem col_buffer, 
-        long col_offset, 
+    public static int CLBlastChpmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, event));
+        return checkResult(CLBlastChpmvSplitNative(layout, triangle, n, alpha_real, alpha_imag, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastZim2colNative(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem col_buffer, 
-        long col_offset, 
+    private static native int CLBlastChpmvSplitNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Col2im function (non-BLAS function): SCOL2IM/DCOL2IM/CCOL2IM/ZCOL2IM/HCOL2IM
-    public static int CLBlastScol2im(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem col_buffer, 
-        long col_offset, 
-        cl_mem im_buffer, 
-        long im_offset, 
+    public static int CLBlastZhpmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastScol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, event));
+        return checkResult(CLBlastZhpmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastScol2imNative(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem col_buffer, 
-        long col_offset, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastDcol2im(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem col_buffer, 
-        long col_offset, 
-        cl_mem im_buffer, 
-        long im_offset, 
+    public static int CLBlastZhpmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastDcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, event));
+        return checkResult(CLBlastZhpmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
     }
-    private static native int CLBlastDcol2imNative(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem col_buffer, 
-        long col_offset, 
-        cl_mem im_buffer, 
-        long im_offset, 
+    private static native int CLBlastZhpmvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastCcol2im(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem col_buffer, 
-        long col_offset, 
-        cl_mem im_buffer, 
-        long im_offset, 
+    public static int CLBlastZhpmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, event));
+        return checkResult(CLBlastZhpmvSplitNative(layout, triangle, n, alpha_real, alpha_imag, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, null, event));
     }
-    private static native int CLBlastCcol2imNative(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem col_buffer, 
-        long col_offset, 
-        cl_mem im_buffer, 
-        long im_offset, 
+    public static int CLBlastZhpmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZcol2im(
-        int kernel_mode, 
-        long channels, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhpmvSplitNative(layout, triangle, n, alpha_real, alpha_imag, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta_real, beta_imag, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZhpmvSplitNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Symmetric matrix-vector multiplication: SSYMV/DSYMV/HSYMV
+    public static int CLBlastSsymv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsymvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastSsymv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsymvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastSsymvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDsymv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsymvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastDsymv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsymvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDsymvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHsymv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsymvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastHsymv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsymvNative(layout, triangle, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastHsymvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Symmetric banded matrix-vector multiplication: SSBMV/DSBMV/HSBMV
+    public static int CLBlastSsbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastSsbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastSsbmvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDsbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastDsbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDsbmvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHsbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastHsbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsbmvNative(layout, triangle, n, k, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastHsbmvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Symmetric packed matrix-vector multiplication: SSPMV/DSPMV/HSPMV
+    public static int CLBlastSspmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSspmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastSspmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSspmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastSspmvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDspmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDspmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastDspmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDspmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDspmvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHspmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHspmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, null, event));
+    }
+    public static int CLBlastHspmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHspmvNative(layout, triangle, n, alpha, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, waitList, event));
+    }
+    private static native int CLBlastHspmvNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Triangular matrix-vector multiplication: STRMV/DTRMV/CTRMV/ZTRMV/HTRMV
+    public static int CLBlastStrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastStrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastStrmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDtrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastDtrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDtrmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastCtrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastCtrmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastZtrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZtrmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHtrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastHtrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHtrmvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastHtrmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Triangular banded matrix-vector multiplication: STBMV/DTBMV/CTBMV/ZTBMV/HTBMV
+    public static int CLBlastStbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastStbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastStbmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDtbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastDtbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDtbmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastCtbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastCtbmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastZtbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZtbmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHtbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastHtbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHtbmvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastHtbmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Triangular packed matrix-vector multiplication: STPMV/DTPMV/CTPMV/ZTPMV/HTPMV
+    public static int CLBlastStpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastStpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastStpmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDtpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastDtpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDtpmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastCtpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastCtpmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastZtpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZtpmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHtpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastHtpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHtpmvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastHtpmvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Solves a triangular system of equations: STRSV/DTRSV/CTRSV/ZTRSV
+    public static int CLBlastStrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastStrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastStrsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDtrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastDtrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDtrsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastCtrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastCtrsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastZtrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrsvNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZtrsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
+    public static int CLBlastStbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastStbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastStbsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDtbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastDtbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDtbsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastCtbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastCtbsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastZtbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtbsvNative(layout, triangle, a_transpose, diagonal, n, k, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZtbsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
+    public static int CLBlastStpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastStpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastStpsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDtpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastDtpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDtpsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastCtpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastCtpsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, null, event));
+    }
+    public static int CLBlastZtpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtpsvNative(layout, triangle, a_transpose, diagonal, n, ap_buffer, ap_offset, x_buffer, x_offset, x_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZtpsvNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // General rank-1 matrix update: SGER/DGER/HGER
+    public static int CLBlastSger(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgerNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastSger(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgerNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastSgerNative(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDger(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgerNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastDger(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgerNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastDgerNative(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHger(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHgerNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastHger(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHgerNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastHgerNative(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // General rank-1 complex matrix update: CGERU/ZGERU
+    public static int CLBlastCgeru(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgeruNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastCgeru(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgeruNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCgeruNative(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgeru(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgeruSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastCgeru(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgeruSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCgeruSplitNative(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgeru(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgeruNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastZgeru(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgeruNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZgeruNative(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgeru(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgeruSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastZgeru(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgeruSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZgeruSplitNative(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // General rank-1 complex conjugated matrix update: CGERC/ZGERC
+    public static int CLBlastCgerc(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgercNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastCgerc(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgercNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCgercNative(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgerc(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgercSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastCgerc(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgercSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCgercSplitNative(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgerc(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgercNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastZgerc(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgercNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZgercNative(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgerc(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgercSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastZgerc(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgercSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZgercSplitNative(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Hermitian rank-1 matrix update: CHER/ZHER
+    public static int CLBlastCher(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCherNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastCher(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCherNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCherNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZher(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZherNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastZher(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZherNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZherNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Hermitian packed rank-1 matrix update: CHPR/ZHPR
+    public static int CLBlastChpr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastChpr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastChprNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZhpr(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastZhpr(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastZhprNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Hermitian rank-2 matrix update: CHER2/ZHER2
+    public static int CLBlastCher2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCher2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastCher2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCher2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCher2Native(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCher2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCher2SplitNative(layout, triangle, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastCher2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCher2SplitNative(layout, triangle, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCher2SplitNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZher2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZher2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastZher2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZher2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZher2Native(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZher2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZher2SplitNative(layout, triangle, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastZher2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZher2SplitNative(layout, triangle, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZher2SplitNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Hermitian packed rank-2 matrix update: CHPR2/ZHPR2
+    public static int CLBlastChpr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChpr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastChpr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChpr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastChpr2Native(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastChpr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChpr2SplitNative(layout, triangle, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastChpr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChpr2SplitNative(layout, triangle, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastChpr2SplitNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZhpr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhpr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastZhpr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhpr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastZhpr2Native(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZhpr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhpr2SplitNative(layout, triangle, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastZhpr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhpr2SplitNative(layout, triangle, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastZhpr2SplitNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Symmetric rank-1 matrix update: SSYR/DSYR/HSYR
+    public static int CLBlastSsyr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsyrNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastSsyr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsyrNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastSsyrNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDsyr(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsyrNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastDsyr(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsyrNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastDsyrNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHsyr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsyrNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastHsyr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsyrNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastHsyrNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Symmetric packed rank-1 matrix update: SSPR/DSPR/HSPR
+    public static int CLBlastSspr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastSspr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastSsprNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDspr(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastDspr(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastDsprNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHspr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastHspr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsprNative(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastHsprNative(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Symmetric rank-2 matrix update: SSYR2/DSYR2/HSYR2
+    public static int CLBlastSsyr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsyr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastSsyr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsyr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastSsyr2Native(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDsyr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsyr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastDsyr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsyr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastDsyr2Native(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHsyr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsyr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, null, event));
+    }
+    public static int CLBlastHsyr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsyr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, waitList, event));
+    }
+    private static native int CLBlastHsyr2Native(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Symmetric packed rank-2 matrix update: SSPR2/DSPR2/HSPR2
+    public static int CLBlastSspr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSspr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastSspr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSspr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastSspr2Native(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDspr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDspr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastDspr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDspr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastDspr2Native(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHspr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHspr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, null, event));
+    }
+    public static int CLBlastHspr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHspr2Native(layout, triangle, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, ap_buffer, ap_offset, queue, waitList, event));
+    }
+    private static native int CLBlastHspr2Native(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // =================================================================================================
+    // BLAS level-3 (matrix-matrix) routines
+    // =================================================================================================
+    // General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+    public static int CLBlastSgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastSgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastSgemmNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastDgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastDgemmNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCgemmNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCgemmSplitNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZgemmNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZgemmSplitNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastHgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastHgemmNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM/HSYMM
+    public static int CLBlastSsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastSsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastSsymmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastDsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastDsymmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCsymmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsymmSplitNative(layout, side, triangle, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsymmSplitNative(layout, side, triangle, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCsymmSplitNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZsymmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsymmSplitNative(layout, side, triangle, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsymmSplitNative(layout, side, triangle, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZsymmSplitNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastHsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsymmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastHsymmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
+    public static int CLBlastChemm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChemmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastChemm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChemmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastChemmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastChemm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChemmSplitNative(layout, side, triangle, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastChemm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChemmSplitNative(layout, side, triangle, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastChemmSplitNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZhemm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhemmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZhemm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhemmNative(layout, side, triangle, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZhemmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZhemm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhemmSplitNative(layout, side, triangle, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZhemm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhemmSplitNative(layout, side, triangle, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZhemmSplitNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK/HSYRK
+    public static int CLBlastSsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastSsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastSsyrkNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastDsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastDsyrkNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCsyrkNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsyrkSplitNative(layout, triangle, a_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsyrkSplitNative(layout, triangle, a_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCsyrkSplitNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZsyrkNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsyrkSplitNative(layout, triangle, a_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsyrkSplitNative(layout, triangle, a_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZsyrkSplitNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastHsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsyrkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastHsyrkNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Rank-K update of a hermitian matrix: CHERK/ZHERK
+    public static int CLBlastCherk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCherkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCherk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCherkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCherkNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZherk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZherkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZherk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZherkNative(layout, triangle, a_transpose, n, k, alpha, a_buffer, a_offset, a_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZherkNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K/HSYR2K
+    public static int CLBlastSsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastSsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastSsyr2kNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastDsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastDsyr2kNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCsyr2kNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsyr2kSplitNative(layout, triangle, ab_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCsyr2kSplitNative(layout, triangle, ab_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCsyr2kSplitNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZsyr2kNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsyr2kSplitNative(layout, triangle, ab_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZsyr2kSplitNative(layout, triangle, ab_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZsyr2kSplitNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastHsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHsyr2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastHsyr2kNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
+    public static int CLBlastCher2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCher2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCher2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCher2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCher2kNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCher2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCher2kSplitNative(layout, triangle, ab_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCher2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCher2kSplitNative(layout, triangle, ab_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCher2kSplitNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZher2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZher2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZher2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZher2kNative(layout, triangle, ab_transpose, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZher2kNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZher2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZher2kSplitNative(layout, triangle, ab_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZher2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZher2kSplitNative(layout, triangle, ab_transpose, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZher2kSplitNative(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM/HTRMM
+    public static int CLBlastStrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastStrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastStrmmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastDtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastDtrmmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastCtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCtrmmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrmmSplitNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastCtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrmmSplitNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCtrmmSplitNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastZtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZtrmmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrmmSplitNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastZtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrmmSplitNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZtrmmSplitNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastHtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHtrmmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastHtrmmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Solves a triangular system of equations: STRSM/DTRSM/CTRSM/ZTRSM
+    public static int CLBlastStrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastStrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastStrsmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastDtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastDtrsmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastCtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCtrsmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrsmSplitNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastCtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrsmSplitNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCtrsmSplitNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastZtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrsmNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZtrsmNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrsmSplitNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastZtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrsmSplitNative(layout, side, triangle, a_transpose, diagonal, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZtrsmSplitNative(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // =================================================================================================
+    // Extra non-BLAS routines (level-X)
+    // =================================================================================================
+    // Element-wise vector product (Hadamard): SHAD/DHAD/CHAD/ZHAD/HHAD
+    public static int CLBlastShad(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastShadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, null, event));
+    }
+    public static int CLBlastShad(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastShadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, waitList, event));
+    }
+    private static native int CLBlastShadNative(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDhad(
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDhadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, null, event));
+    }
+    public static int CLBlastDhad(
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDhadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, waitList, event));
+    }
+    private static native int CLBlastDhadNative(
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastChad(
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float[] beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, null, event));
+    }
+    public static int CLBlastChad(
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float[] beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, waitList, event));
+    }
+    private static native int CLBlastChadNative(
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float[] beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastChad(
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChadSplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta_real, beta_imag, z_buffer, z_offset, z_inc, queue, null, event));
+    }
+    public static int CLBlastChad(
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastChadSplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta_real, beta_imag, z_buffer, z_offset, z_inc, queue, waitList, event));
+    }
+    private static native int CLBlastChadSplitNative(
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZhad(
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double[] beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, null, event));
+    }
+    public static int CLBlastZhad(
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double[] beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZhadNative(
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double[] beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZhad(
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhadSplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta_real, beta_imag, z_buffer, z_offset, z_inc, queue, null, event));
+    }
+    public static int CLBlastZhad(
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZhadSplitNative(n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta_real, beta_imag, z_buffer, z_offset, z_inc, queue, waitList, event));
+    }
+    private static native int CLBlastZhadSplitNative(
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHhad(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHhadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, null, event));
+    }
+    public static int CLBlastHhad(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHhadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, waitList, event));
+    }
+    private static native int CLBlastHhadNative(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
+    public static int CLBlastSomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastSomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastSomatcopyNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastDomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastDomatcopyNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastComatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastComatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastComatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastComatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastComatcopyNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastComatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastComatcopySplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastComatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastComatcopySplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastComatcopySplitNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastZomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZomatcopyNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZomatcopySplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastZomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZomatcopySplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZomatcopySplitNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, null, event));
+    }
+    public static int CLBlastHomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, waitList, event));
+    }
+    private static native int CLBlastHomatcopyNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Im2col function (non-BLAS function): SIM2COL/DIM2COL/CIM2COL/ZIM2COL/HIM2COL
+    public static int CLBlastSim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, null, event));
+    }
+    public static int CLBlastSim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, waitList, event));
+    }
+    private static native int CLBlastSim2colNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, null, event));
+    }
+    public static int CLBlastDim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, waitList, event));
+    }
+    private static native int CLBlastDim2colNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, null, event));
+    }
+    public static int CLBlastCim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, waitList, event));
+    }
+    private static native int CLBlastCim2colNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, null, event));
+    }
+    public static int CLBlastZim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, waitList, event));
+    }
+    private static native int CLBlastZim2colNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, null, event));
+    }
+    public static int CLBlastHim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHim2colNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, im_buffer, im_offset, col_buffer, col_offset, queue, waitList, event));
+    }
+    private static native int CLBlastHim2colNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Col2im function (non-BLAS function): SCOL2IM/DCOL2IM/CCOL2IM/ZCOL2IM/HCOL2IM
+    public static int CLBlastScol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastScol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, null, event));
+    }
+    public static int CLBlastScol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastScol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, waitList, event));
+    }
+    private static native int CLBlastScol2imNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, null, event));
+    }
+    public static int CLBlastDcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, waitList, event));
+    }
+    private static native int CLBlastDcol2imNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, null, event));
+    }
+    public static int CLBlastCcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, waitList, event));
+    }
+    private static native int CLBlastCcol2imNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, null, event));
+    }
+    public static int CLBlastZcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, waitList, event));
+    }
+    private static native int CLBlastZcol2imNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, null, event));
+    }
+    public static int CLBlastHcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, waitList, event));
+    }
+    private static native int CLBlastHcol2imNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Batched convolution as GEMM (non-BLAS function): SCONVGEMM/DCONVGEMM/HCONVGEMM
+    public static int CLBlastSconvgemm(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSconvgemmNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer, kernel_offset, result_buffer, result_offset, queue, null, event));
+    }
+    public static int CLBlastSconvgemm(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSconvgemmNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer, kernel_offset, result_buffer, result_offset, queue, waitList, event));
+    }
+    private static native int CLBlastSconvgemmNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDconvgemm(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDconvgemmNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer, kernel_offset, result_buffer, result_offset, queue, null, event));
+    }
+    public static int CLBlastDconvgemm(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDconvgemmNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer, kernel_offset, result_buffer, result_offset, queue, waitList, event));
+    }
+    private static native int CLBlastDconvgemmNative(
+        int kernel_mode, 
+        long channels, 
         long height, 
         long width, 
         long kernel_h, 
@@ -5819,447 +14254,4664 @@ public class CLBlast
         long stride_w, 
         long dilation_h, 
         long dilation_w, 
-        cl_mem col_buffer, 
-        long col_offset, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHconvgemm(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHconvgemmNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer, kernel_offset, result_buffer, result_offset, queue, null, event));
+    }
+    public static int CLBlastHconvgemm(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHconvgemmNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer, kernel_offset, result_buffer, result_offset, queue, waitList, event));
+    }
+    private static native int CLBlastHconvgemmNative(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
         cl_mem im_buffer, 
         long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
+    public static int CLBlastSaxpyBatched(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastSaxpyBatched(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastSaxpyBatchedNative(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDaxpyBatched(
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastDaxpyBatched(
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDaxpyBatchedNative(
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCaxpyBatched(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastCaxpyBatched(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCaxpyBatchedNative(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZaxpyBatched(
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastZaxpyBatched(
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZaxpyBatchedNative(
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHaxpyBatched(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastHaxpyBatched(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastHaxpyBatchedNative(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Variants that receive the scalars and offsets in direct buffers with native byte order.
+    // The contents of these buffers, starting at their position, are passed to CLBlast without
+    // copying, so that precomputed tables can be reused across calls. The offsets buffers
+    // contain size_t values. ComplexSingle/ComplexDouble scalars are stored as (real,imag)
+    // pairs, and half-precision scalars are stored as the raw 16-bit cl_half values.
+    public static int CLBlastSaxpyBatched(
+        long n, 
+        FloatBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(x_offsets, "x_offsets");
+        checkNativeOrder(y_offsets, "y_offsets");
+        return checkResult(CLBlastSaxpyBatchedDirectNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastSaxpyBatched(
+        long n, 
+        FloatBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(x_offsets, "x_offsets");
+        checkNativeOrder(y_offsets, "y_offsets");
+        return checkResult(CLBlastSaxpyBatchedDirectNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastSaxpyBatchedDirectNative(
+        long n, 
+        FloatBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDaxpyBatched(
+        long n, 
+        DoubleBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(x_offsets, "x_offsets");
+        checkNativeOrder(y_offsets, "y_offsets");
+        return checkResult(CLBlastDaxpyBatchedDirectNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastDaxpyBatched(
+        long n, 
+        DoubleBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(x_offsets, "x_offsets");
+        checkNativeOrder(y_offsets, "y_offsets");
+        return checkResult(CLBlastDaxpyBatchedDirectNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDaxpyBatchedDirectNative(
+        long n, 
+        DoubleBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCaxpyBatched(
+        long n, 
+        FloatBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(x_offsets, "x_offsets");
+        checkNativeOrder(y_offsets, "y_offsets");
+        return checkResult(CLBlastCaxpyBatchedDirectNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastCaxpyBatched(
+        long n, 
+        FloatBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(x_offsets, "x_offsets");
+        checkNativeOrder(y_offsets, "y_offsets");
+        return checkResult(CLBlastCaxpyBatchedDirectNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCaxpyBatchedDirectNative(
+        long n, 
+        FloatBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZaxpyBatched(
+        long n, 
+        DoubleBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(x_offsets, "x_offsets");
+        checkNativeOrder(y_offsets, "y_offsets");
+        return checkResult(CLBlastZaxpyBatchedDirectNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastZaxpyBatched(
+        long n, 
+        DoubleBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(x_offsets, "x_offsets");
+        checkNativeOrder(y_offsets, "y_offsets");
+        return checkResult(CLBlastZaxpyBatchedDirectNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZaxpyBatchedDirectNative(
+        long n, 
+        DoubleBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHaxpyBatched(
+        long n, 
+        ShortBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(x_offsets, "x_offsets");
+        checkNativeOrder(y_offsets, "y_offsets");
+        return checkResult(CLBlastHaxpyBatchedDirectNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastHaxpyBatched(
+        long n, 
+        ShortBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(x_offsets, "x_offsets");
+        checkNativeOrder(y_offsets, "y_offsets");
+        return checkResult(CLBlastHaxpyBatchedDirectNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastHaxpyBatchedDirectNative(
+        long n, 
+        ShortBuffer alphas, 
+        cl_mem x_buffer, 
+        LongBuffer x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        LongBuffer y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+    public static int CLBlastSgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastSgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastSgemmBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        double[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastDgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        double[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDgemmBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        double[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgemmBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        double[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        double[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgemmBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        double[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastHgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastHgemmBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Variants that receive the scalars and offsets in direct buffers with native byte order.
+    // The contents of these buffers, starting at their position, are passed to CLBlast without
+    // copying, so that precomputed tables can be reused across calls. The offsets buffers
+    // contain size_t values. ComplexSingle/ComplexDouble scalars are stored as (real,imag)
+    // pairs, and half-precision scalars are stored as the raw 16-bit cl_half values.
+    public static int CLBlastSgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        FloatBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        FloatBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(a_offsets, "a_offsets");
+        checkNativeOrder(b_offsets, "b_offsets");
+        checkNativeOrder(betas, "betas");
+        checkNativeOrder(c_offsets, "c_offsets");
+        return checkResult(CLBlastSgemmBatchedDirectNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastSgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        FloatBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        FloatBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(a_offsets, "a_offsets");
+        checkNativeOrder(b_offsets, "b_offsets");
+        checkNativeOrder(betas, "betas");
+        checkNativeOrder(c_offsets, "c_offsets");
+        return checkResult(CLBlastSgemmBatchedDirectNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastSgemmBatchedDirectNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        FloatBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        FloatBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        DoubleBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        DoubleBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(a_offsets, "a_offsets");
+        checkNativeOrder(b_offsets, "b_offsets");
+        checkNativeOrder(betas, "betas");
+        checkNativeOrder(c_offsets, "c_offsets");
+        return checkResult(CLBlastDgemmBatchedDirectNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastDgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        DoubleBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        DoubleBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(a_offsets, "a_offsets");
+        checkNativeOrder(b_offsets, "b_offsets");
+        checkNativeOrder(betas, "betas");
+        checkNativeOrder(c_offsets, "c_offsets");
+        return checkResult(CLBlastDgemmBatchedDirectNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDgemmBatchedDirectNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        DoubleBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        DoubleBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        FloatBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        FloatBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(a_offsets, "a_offsets");
+        checkNativeOrder(b_offsets, "b_offsets");
+        checkNativeOrder(betas, "betas");
+        checkNativeOrder(c_offsets, "c_offsets");
+        return checkResult(CLBlastCgemmBatchedDirectNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        FloatBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        FloatBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(a_offsets, "a_offsets");
+        checkNativeOrder(b_offsets, "b_offsets");
+        checkNativeOrder(betas, "betas");
+        checkNativeOrder(c_offsets, "c_offsets");
+        return checkResult(CLBlastCgemmBatchedDirectNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgemmBatchedDirectNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        FloatBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        FloatBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        DoubleBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        DoubleBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(a_offsets, "a_offsets");
+        checkNativeOrder(b_offsets, "b_offsets");
+        checkNativeOrder(betas, "betas");
+        checkNativeOrder(c_offsets, "c_offsets");
+        return checkResult(CLBlastZgemmBatchedDirectNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        DoubleBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        DoubleBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(a_offsets, "a_offsets");
+        checkNativeOrder(b_offsets, "b_offsets");
+        checkNativeOrder(betas, "betas");
+        checkNativeOrder(c_offsets, "c_offsets");
+        return checkResult(CLBlastZgemmBatchedDirectNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgemmBatchedDirectNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        DoubleBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        DoubleBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        ShortBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        ShortBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(a_offsets, "a_offsets");
+        checkNativeOrder(b_offsets, "b_offsets");
+        checkNativeOrder(betas, "betas");
+        checkNativeOrder(c_offsets, "c_offsets");
+        return checkResult(CLBlastHgemmBatchedDirectNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastHgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        ShortBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        ShortBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        checkNativeOrder(alphas, "alphas");
+        checkNativeOrder(a_offsets, "a_offsets");
+        checkNativeOrder(b_offsets, "b_offsets");
+        checkNativeOrder(betas, "betas");
+        checkNativeOrder(c_offsets, "c_offsets");
+        return checkResult(CLBlastHgemmBatchedDirectNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastHgemmBatchedDirectNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        ShortBuffer alphas, 
+        cl_mem a_buffer, 
+        LongBuffer a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        LongBuffer b_offsets, 
+        long b_ld, 
+        ShortBuffer betas, 
+        cl_mem c_buffer, 
+        LongBuffer c_offsets, 
+        long c_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
+    public static int CLBlastSgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastSgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastSgemmStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastDgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDgemmStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgemmStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmStridedBatchedSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta_real, beta_imag, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmStridedBatchedSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta_real, beta_imag, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgemmStridedBatchedSplitNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgemmStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmStridedBatchedSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta_real, beta_imag, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmStridedBatchedSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta_real, beta_imag, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgemmStridedBatchedSplitNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastHgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastHgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastHgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastHgemmStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Batched version of GEMV: SGEMVBATCHED/DGEMVBATCHED/CGEMVBATCHED/ZGEMVBATCHED
+    // Mapped onto the batched GEMM where possible, otherwise a native loop over the GEMV calls
+    // For the loop, the event is a marker for all calls, and is also valid on out-of-order queues
+    public static int CLBlastSgemvBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        float[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemvBatchedNative(layout, a_transpose, m, n, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastSgemvBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        float[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemvBatchedNative(layout, a_transpose, m, n, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastSgemvBatchedNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        float[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDgemvBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        double[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemvBatchedNative(layout, a_transpose, m, n, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastDgemvBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        double[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemvBatchedNative(layout, a_transpose, m, n, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDgemvBatchedNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        double[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemvBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        float[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemvBatchedNative(layout, a_transpose, m, n, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgemvBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        float[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemvBatchedNative(layout, a_transpose, m, n, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgemvBatchedNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        float[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgemvBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        double[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemvBatchedNative(layout, a_transpose, m, n, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas, y_buffer, y_offsets, y_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgemvBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        double[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemvBatchedNative(layout, a_transpose, m, n, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, betas, y_buffer, y_offsets, y_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgemvBatchedNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        double[] betas, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // StridedBatched version of GEMV: SGEMVSTRIDEDBATCHED/DGEMVSTRIDEDBATCHED/CGEMVSTRIDEDBATCHED/ZGEMVSTRIDEDBATCHED
+    // Mapped onto the strided batched GEMM where possible, otherwise a native loop over the GEMV calls
+    // For the loop, the event is a marker for all calls, and is also valid on out-of-order queues
+    public static int CLBlastSgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemvStridedBatchedNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastSgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemvStridedBatchedNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastSgemvStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemvStridedBatchedNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastDgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemvStridedBatchedNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDgemvStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemvStridedBatchedNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemvStridedBatchedNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgemvStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemvStridedBatchedSplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta_real, beta_imag, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemvStridedBatchedSplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta_real, beta_imag, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgemvStridedBatchedSplitNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemvStridedBatchedNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemvStridedBatchedNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgemvStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemvStridedBatchedSplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta_real, beta_imag, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgemvStridedBatched(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemvStridedBatchedSplitNative(layout, a_transpose, m, n, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, beta_real, beta_imag, y_buffer, y_offset, y_inc, y_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgemvStridedBatchedSplitNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        double beta_real, 
+        double beta_imag, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Batched version of TRSV: STRSVBATCHED/DTRSVBATCHED/CTRSVBATCHED/ZTRSVBATCHED
+    // Executed as a native loop over the individual TRSV calls
+    // For the loop, the event is a marker for all calls, and is also valid on out-of-order queues
+    public static int CLBlastStrsvBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrsvBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastStrsvBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrsvBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastStrsvBatchedNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDtrsvBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrsvBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastDtrsvBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrsvBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDtrsvBatchedNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtrsvBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrsvBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastCtrsvBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrsvBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCtrsvBatchedNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtrsvBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrsvBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, batch_count, queue, null, event));
+    }
+    public static int CLBlastZtrsvBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrsvBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, x_inc, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZtrsvBatchedNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // StridedBatched version of TRSV: STRSVSTRIDEDBATCHED/DTRSVSTRIDEDBATCHED/CTRSVSTRIDEDBATCHED/ZTRSVSTRIDEDBATCHED
+    // Executed as a native loop over the individual TRSV calls
+    // For the loop, the event is a marker for all calls, and is also valid on out-of-order queues
+    public static int CLBlastStrsvStridedBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrsvStridedBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastStrsvStridedBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastStrsvStridedBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastStrsvStridedBatchedNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDtrsvStridedBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrsvStridedBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastDtrsvStridedBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDtrsvStridedBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDtrsvStridedBatchedNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCtrsvStridedBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrsvStridedBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastCtrsvStridedBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCtrsvStridedBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCtrsvStridedBatchedNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZtrsvStridedBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrsvStridedBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastZtrsvStridedBatched(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZtrsvStridedBatchedNative(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, x_inc, x_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZtrsvStridedBatchedNative(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Batched version of GER: SGERBATCHED/DGERBATCHED
+    // Executed as a native loop over the individual GER calls
+    // For the loop, the event is a marker for all calls, and is also valid on out-of-order queues
+    public static int CLBlastSgerBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgerBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastSgerBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgerBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastSgerBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDgerBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgerBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastDgerBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgerBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDgerBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // StridedBatched version of GER: SGERSTRIDEDBATCHED/DGERSTRIDEDBATCHED
+    // Executed as a native loop over the individual GER calls
+    // For the loop, the event is a marker for all calls, and is also valid on out-of-order queues
+    public static int CLBlastSgerStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgerStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastSgerStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgerStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastSgerStridedBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDgerStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgerStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastDgerStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastDgerStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastDgerStridedBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Batched version of GERU: CGERUBATCHED/ZGERUBATCHED
+    // Executed as a native loop over the individual GERU calls
+    // For the loop, the event is a marker for all calls, and is also valid on out-of-order queues
+    public static int CLBlastCgeruBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgeruBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgeruBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgeruBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgeruBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgeruBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgeruBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgeruBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgeruBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgeruBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // StridedBatched version of GERU: CGERUSTRIDEDBATCHED/ZGERUSTRIDEDBATCHED
+    // Executed as a native loop over the individual GERU calls
+    // For the loop, the event is a marker for all calls, and is also valid on out-of-order queues
+    public static int CLBlastCgeruStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgeruStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgeruStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgeruStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgeruStridedBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgeruStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgeruStridedBatchedSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgeruStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgeruStridedBatchedSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgeruStridedBatchedSplitNative(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgeruStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgeruStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgeruStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastZcol2imNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, col_buffer, col_offset, im_buffer, im_offset, queue, event));
+        return checkResult(CLBlastZgeruStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, waitList, event));
     }
-    private static native int CLBlastZcol2imNative(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        cl_mem col_buffer, 
-        long col_offset, 
-        cl_mem im_buffer, 
-        long im_offset, 
+    private static native int CLBlastZgeruStridedBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgeruStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgeruStridedBatchedSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgeruStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgeruStridedBatchedSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgeruStridedBatchedSplitNative(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // Batched version of GERC: CGERCBATCHED/ZGERCBATCHED
+    // Executed as a native loop over the individual GERC calls
+    // For the loop, the event is a marker for all calls, and is also valid on out-of-order queues
+    public static int CLBlastCgercBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgercBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgercBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgercBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgercBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgercBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgercBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, null, event));
+    }
+    public static int CLBlastZgercBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgercBatchedNative(layout, m, n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, a_buffer, a_offsets, a_ld, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgercBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // StridedBatched version of GERC: CGERCSTRIDEDBATCHED/ZGERCSTRIDEDBATCHED
+    // Executed as a native loop over the individual GERC calls
+    // For the loop, the event is a marker for all calls, and is also valid on out-of-order queues
+    public static int CLBlastCgercStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgercStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, null, event));
+    }
+    public static int CLBlastCgercStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgercStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgercStridedBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Batched convolution as GEMM (non-BLAS function): SCONVGEMM/DCONVGEMM/HCONVGEMM
-    public static int CLBlastSconvgemm(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        long num_kernels, 
+    public static int CLBlastCgercStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
         long batch_count, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem kernel_buffer, 
-        long kernel_offset, 
-        cl_mem result_buffer, 
-        long result_offset, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSconvgemmNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer, kernel_offset, result_buffer, result_offset, queue, event));
+        return checkResult(CLBlastCgercStridedBatchedSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, null, event));
     }
-    private static native int CLBlastSconvgemmNative(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        long num_kernels, 
+    public static int CLBlastCgercStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgercStridedBatchedSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastCgercStridedBatchedSplitNative(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
         long batch_count, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem kernel_buffer, 
-        long kernel_offset, 
-        cl_mem result_buffer, 
-        long result_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastDconvgemm(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        long num_kernels, 
+    public static int CLBlastZgercStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
         long batch_count, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem kernel_buffer, 
-        long kernel_offset, 
-        cl_mem result_buffer, 
-        long result_offset, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastDconvgemmNative(kernel_mode, channels, height, width, kernel_h, kernel_w, pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, num_kernels, batch_count, im_buffer, im_offset, kernel_buffer, kernel_offset, result_buffer, result_offset, queue, event));
+        return checkResult(CLBlastZgercStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, null, event));
     }
-    private static native int CLBlastDconvgemmNative(
-        int kernel_mode, 
-        long channels, 
-        long height, 
-        long width, 
-        long kernel_h, 
-        long kernel_w, 
-        long pad_h, 
-        long pad_w, 
-        long stride_h, 
-        long stride_w, 
-        long dilation_h, 
-        long dilation_w, 
-        long num_kernels, 
+    public static int CLBlastZgercStridedBatched(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgercStridedBatchedNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgercStridedBatchedNative(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
         long batch_count, 
-        cl_mem im_buffer, 
-        long im_offset, 
-        cl_mem kernel_buffer, 
-        long kernel_offset, 
-        cl_mem result_buffer, 
-        long result_offset, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    // Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
-    public static int CLBlastSaxpyBatched(
+    public static int CLBlastZgercStridedBatched(
+        int layout, 
+        long m, 
         long n, 
-        float[] alphas, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem x_buffer, 
-        long[] x_offsets, 
+        long x_offset, 
         long x_inc, 
+        long x_stride, 
         cl_mem y_buffer, 
-        long[] y_offsets, 
+        long y_offset, 
         long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
         long batch_count, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastSaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, event));
+        return checkResult(CLBlastZgercStridedBatchedSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, null, event));
     }
-    private static native int CLBlastSaxpyBatchedNative(
+    public static int CLBlastZgercStridedBatched(
+        int layout, 
+        long m, 
         long n, 
-        float[] alphas, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem x_buffer, 
-        long[] x_offsets, 
+        long x_offset, 
         long x_inc, 
+        long x_stride, 
         cl_mem y_buffer, 
-        long[] y_offsets, 
+        long y_offset, 
+        long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long batch_count, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgercStridedBatchedSplitNative(layout, m, n, alpha_real, alpha_imag, x_buffer, x_offset, x_inc, x_stride, y_buffer, y_offset, y_inc, y_stride, a_buffer, a_offset, a_ld, a_stride, batch_count, queue, waitList, event));
+    }
+    private static native int CLBlastZgercStridedBatchedSplitNative(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha_real, 
+        double alpha_imag, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long x_stride, 
+        cl_mem y_buffer, 
+        long y_offset, 
         long y_inc, 
+        long y_stride, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
         long batch_count, 
         cl_command_queue queue, 
-        cl_event event);
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    // =================================================================================================
+    // General matrix-matrix multiplication with temporary buffer from user (optional, for advanced users): SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+    public static int CLBlastSgemmWithTempBuffer(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event, 
+        cl_mem temp_buffer)
+    {
+        return checkResult(CLBlastSgemmWithTempBufferNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
+    }
+    private static native int CLBlastSgemmWithTempBufferNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        cl_event event, 
+        cl_mem temp_buffer);
 
 
-    public static int CLBlastDaxpyBatched(
+    public static int CLBlastDgemmWithTempBuffer(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
         long n, 
-        double[] alphas, 
-        cl_mem x_buffer, 
-        long[] x_offsets, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long[] y_offsets, 
-        long y_inc, 
-        long batch_count, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
         cl_command_queue queue, 
-        cl_event event)
+        cl_event event, 
+        cl_mem temp_buffer)
     {
-        return checkResult(CLBlastDaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, event));
+        return checkResult(CLBlastDgemmWithTempBufferNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
     }
-    private static native int CLBlastDaxpyBatchedNative(
+    private static native int CLBlastDgemmWithTempBufferNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
         long n, 
-        double[] alphas, 
-        cl_mem x_buffer, 
-        long[] x_offsets, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long[] y_offsets, 
-        long y_inc, 
-        long batch_count, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
         cl_command_queue queue, 
-        cl_event event);
+        cl_event event, 
+        cl_mem temp_buffer);
 
 
-    public static int CLBlastCaxpyBatched(
+    public static int CLBlastCgemmWithTempBuffer(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
         long n, 
-        float[] alphas, 
-        cl_mem x_buffer, 
-        long[] x_offsets, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long[] y_offsets, 
-        long y_inc, 
-        long batch_count, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
         cl_command_queue queue, 
-        cl_event event)
+        cl_event event, 
+        cl_mem temp_buffer)
     {
-        return checkResult(CLBlastCaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, event));
+        return checkResult(CLBlastCgemmWithTempBufferNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
     }
-    private static native int CLBlastCaxpyBatchedNative(
+    private static native int CLBlastCgemmWithTempBufferNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
         long n, 
-        float[] alphas, 
-        cl_mem x_buffer, 
-        long[] x_offsets, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long[] y_offsets, 
-        long y_inc, 
-        long batch_count, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
         cl_command_queue queue, 
-        cl_event event);
+        cl_event event, 
+        cl_mem temp_buffer);
 
 
-    public static int CLBlastZaxpyBatched(
+    public static int CLBlastCgemmWithTempBuffer(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
         long n, 
-        double[] alphas, 
-        cl_mem x_buffer, 
-        long[] x_offsets, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long[] y_offsets, 
-        long y_inc, 
-        long batch_count, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
         cl_command_queue queue, 
-        cl_event event)
+        cl_event event, 
+        cl_mem temp_buffer)
     {
-        return checkResult(CLBlastZaxpyBatchedNative(n, alphas, x_buffer, x_offsets, x_inc, y_buffer, y_offsets, y_inc, batch_count, queue, event));
+        return checkResult(CLBlastCgemmWithTempBufferSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
     }
-    private static native int CLBlastZaxpyBatchedNative(
+    private static native int CLBlastCgemmWithTempBufferSplitNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
         long n, 
-        double[] alphas, 
-        cl_mem x_buffer, 
-        long[] x_offsets, 
-        long x_inc, 
-        cl_mem y_buffer, 
-        long[] y_offsets, 
-        long y_inc, 
-        long batch_count, 
+        long k, 
+        float alpha_real, 
+        float alpha_imag, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta_real, 
+        float beta_imag, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
         cl_command_queue queue, 
-        cl_event event);
+        cl_event event, 
+        cl_mem temp_buffer);
 
 
-    // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
-    public static int CLBlastSgemmBatched(
+    public static int CLBlastZgemmWithTempBuffer(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        float[] alphas, 
+        double[] alpha, 
         cl_mem a_buffer, 
-        long[] a_offsets, 
+        long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
-        long[] b_offsets, 
+        long b_offset, 
         long b_ld, 
-        float[] betas, 
+        double[] beta, 
         cl_mem c_buffer, 
-        long[] c_offsets, 
+        long c_offset, 
         long c_ld, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event)
+        cl_event event, 
+        cl_mem temp_buffer)
     {
-        return checkResult(CLBlastSgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, event));
+        return checkResult(CLBlastZgemmWithTempBufferNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
     }
-    private static native int CLBlastSgemmBatchedNative(
+    private static native int CLBlastZgemmWithTempBufferNative(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        float[] alphas, 
+        double[] alpha, 
         cl_mem a_buffer, 
-        long[] a_offsets, 
+        long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
-        long[] b_offsets, 
+        long b_offset, 
         long b_ld, 
-        float[] betas, 
+        double[] beta, 
         cl_mem c_buffer, 
-        long[] c_offsets, 
+        long c_offset, 
         long c_ld, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event);
+        cl_event event, 
+        cl_mem temp_buffer);
 
 
-    public static int CLBlastDgemmBatched(
+    public static int CLBlastZgemmWithTempBuffer(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        double[] alphas, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
-        long[] a_offsets, 
+        long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
-        long[] b_offsets, 
+        long b_offset, 
         long b_ld, 
-        double[] betas, 
+        double beta_real, 
+        double beta_imag, 
         cl_mem c_buffer, 
-        long[] c_offsets, 
+        long c_offset, 
         long c_ld, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event)
+        cl_event event, 
+        cl_mem temp_buffer)
     {
-        return checkResult(CLBlastDgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, event));
+        return checkResult(CLBlastZgemmWithTempBufferSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
     }
-    private static native int CLBlastDgemmBatchedNative(
+    private static native int CLBlastZgemmWithTempBufferSplitNative(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        double[] alphas, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
-        long[] a_offsets, 
+        long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
-        long[] b_offsets, 
+        long b_offset, 
         long b_ld, 
-        double[] betas, 
+        double beta_real, 
+        double beta_imag, 
         cl_mem c_buffer, 
-        long[] c_offsets, 
+        long c_offset, 
         long c_ld, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event);
+        cl_event event, 
+        cl_mem temp_buffer);
 
 
-    public static int CLBlastCgemmBatched(
+    public static int CLBlastHgemmWithTempBuffer(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        float[] alphas, 
+        float alpha, 
         cl_mem a_buffer, 
-        long[] a_offsets, 
+        long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
-        long[] b_offsets, 
+        long b_offset, 
         long b_ld, 
-        float[] betas, 
+        float beta, 
         cl_mem c_buffer, 
-        long[] c_offsets, 
+        long c_offset, 
         long c_ld, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event)
+        cl_event event, 
+        cl_mem temp_buffer)
     {
-        return checkResult(CLBlastCgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, event));
+        return checkResult(CLBlastHgemmWithTempBufferNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
     }
-    private static native int CLBlastCgemmBatchedNative(
+    private static native int CLBlastHgemmWithTempBufferNative(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        float[] alphas, 
+        float alpha, 
         cl_mem a_buffer, 
-        long[] a_offsets, 
+        long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
-        long[] b_offsets, 
+        long b_offset, 
         long b_ld, 
-        float[] betas, 
+        float beta, 
         cl_mem c_buffer, 
-        long[] c_offsets, 
+        long c_offset, 
         long c_ld, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event);
+        cl_event event, 
+        cl_mem temp_buffer);
 
 
-    public static int CLBlastZgemmBatched(
+    // Variants of GEMM that obtain the temporary buffer from a pool: SGEMM/DGEMM/CGEMM/ZGEMM
+    // See setTempBufferPoolLimit and trimTempBufferPool
+    public static int CLBlastSgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        double[] alphas, 
+        float alpha, 
         cl_mem a_buffer, 
-        long[] a_offsets, 
+        long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
-        long[] b_offsets, 
+        long b_offset, 
         long b_ld, 
-        double[] betas, 
+        float beta, 
         cl_mem c_buffer, 
-        long[] c_offsets, 
+        long c_offset, 
         long c_ld, 
-        long batch_count, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastZgemmBatchedNative(layout, a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets, a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets, c_ld, batch_count, queue, event));
+        return checkResult(CLBlastSgemmPooledNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
     }
-    private static native int CLBlastZgemmBatchedNative(
+    public static int CLBlastSgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        double[] alphas, 
+        float alpha, 
         cl_mem a_buffer, 
-        long[] a_offsets, 
+        long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
-        long[] b_offsets, 
+        long b_offset, 
         long b_ld, 
-        double[] betas, 
+        float beta, 
         cl_mem c_buffer, 
-        long[] c_offsets, 
+        long c_offset, 
         long c_ld, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    // StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
-    public static int CLBlastSgemmStridedBatched(
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastSgemmPooledNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastSgemmPooledNative(
         int layout, 
         int a_transpose, 
         int b_transpose, 
@@ -6270,49 +18922,42 @@ public class CLBlast
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        long a_stride, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        long b_stride, 
         float beta, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
-        long c_stride, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event)
-    {
-        return checkResult(CLBlastSgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
-    }
-    private static native int CLBlastSgemmStridedBatchedNative(
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastDgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        float alpha, 
+        double alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        long a_stride, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        long b_stride, 
-        float beta, 
+        double beta, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
-        long c_stride, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastDgemmStridedBatched(
+        cl_event event)
+    {
+        return checkResult(CLBlastDgemmPooledNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastDgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
@@ -6323,23 +18968,20 @@ public class CLBlast
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        long a_stride, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        long b_stride, 
         double beta, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
-        long c_stride, 
-        long batch_count, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event)
     {
-        return checkResult(CLBlastDgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
+        return checkResult(CLBlastDgemmPooledNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
     }
-    private static native int CLBlastDgemmStridedBatchedNative(
+    private static native int CLBlastDgemmPooledNative(
         int layout, 
         int a_transpose, 
         int b_transpose, 
@@ -6350,22 +18992,19 @@ public class CLBlast
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        long a_stride, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        long b_stride, 
         double beta, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
-        long c_stride, 
-        long batch_count, 
         cl_command_queue queue, 
+        cl_event[] waitList, 
         cl_event event);
 
 
-    public static int CLBlastCgemmStridedBatched(
+    public static int CLBlastCgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
@@ -6376,23 +19015,19 @@ public class CLBlast
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        long a_stride, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        long b_stride, 
         float[] beta, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
-        long c_stride, 
-        long batch_count, 
         cl_command_queue queue, 
         cl_event event)
     {
-        return checkResult(CLBlastCgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
+        return checkResult(CLBlastCgemmPooledNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
     }
-    private static native int CLBlastCgemmStridedBatchedNative(
+    public static int CLBlastCgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
@@ -6403,262 +19038,262 @@ public class CLBlast
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        long a_stride, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        long b_stride, 
         float[] beta, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
-        long c_stride, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    public static int CLBlastZgemmStridedBatched(
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmPooledNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastCgemmPooledNative(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        double[] alpha, 
+        float[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        long a_stride, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        long b_stride, 
-        double[] beta, 
+        float[] beta, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
-        long c_stride, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event)
-    {
-        return checkResult(CLBlastZgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
-    }
-    private static native int CLBlastZgemmStridedBatchedNative(
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastCgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        double[] alpha, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
-        long a_stride, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        long b_stride, 
-        double[] beta, 
+        float beta_real, 
+        float beta_imag, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
-        long c_stride, 
-        long batch_count, 
         cl_command_queue queue, 
-        cl_event event);
-
-
-    // =================================================================================================
-    // General matrix-matrix multiplication with temporary buffer from user (optional, for advanced users): SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
-    public static int CLBlastSgemmWithTempBuffer(
+        cl_event event)
+    {
+        return checkResult(CLBlastCgemmPooledSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastCgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        float alpha, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        float beta, 
+        float beta_real, 
+        float beta_imag, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
         cl_command_queue queue, 
-        cl_event event, 
-        cl_mem temp_buffer)
+        cl_event[] waitList, 
+        cl_event event)
     {
-        return checkResult(CLBlastSgemmWithTempBufferNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
+        return checkResult(CLBlastCgemmPooledSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
     }
-    private static native int CLBlastSgemmWithTempBufferNative(
+    private static native int CLBlastCgemmPooledSplitNative(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        float alpha, 
+        float alpha_real, 
+        float alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        float beta, 
+        float beta_real, 
+        float beta_imag, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
         cl_command_queue queue, 
-        cl_event event, 
-        cl_mem temp_buffer);
+        cl_event[] waitList, 
+        cl_event event);
 
 
-    public static int CLBlastDgemmWithTempBuffer(
+    public static int CLBlastZgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        double alpha, 
+        double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        double beta, 
+        double[] beta, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
         cl_command_queue queue, 
-        cl_event event, 
-        cl_mem temp_buffer)
+        cl_event event)
     {
-        return checkResult(CLBlastDgemmWithTempBufferNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
+        return checkResult(CLBlastZgemmPooledNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, null, event));
     }
-    private static native int CLBlastDgemmWithTempBufferNative(
+    public static int CLBlastZgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        double alpha, 
+        double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        double beta, 
+        double[] beta, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
         cl_command_queue queue, 
-        cl_event event, 
-        cl_mem temp_buffer);
-
-
-    public static int CLBlastCgemmWithTempBuffer(
+        cl_event[] waitList, 
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmPooledNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, waitList, event));
+    }
+    private static native int CLBlastZgemmPooledNative(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        float[] alpha, 
+        double[] alpha, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        float[] beta, 
+        double[] beta, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
         cl_command_queue queue, 
-        cl_event event, 
-        cl_mem temp_buffer)
-    {
-        return checkResult(CLBlastCgemmWithTempBufferNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
-    }
-    private static native int CLBlastCgemmWithTempBufferNative(
+        cl_event[] waitList, 
+        cl_event event);
+
+
+    public static int CLBlastZgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        float[] alpha, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        float[] beta, 
+        double beta_real, 
+        double beta_imag, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
         cl_command_queue queue, 
-        cl_event event, 
-        cl_mem temp_buffer);
-
-
-    public static int CLBlastZgemmWithTempBuffer(
+        cl_event event)
+    {
+        return checkResult(CLBlastZgemmPooledSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, null, event));
+    }
+    public static int CLBlastZgemmPooled(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        double[] alpha, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        double[] beta, 
+        double beta_real, 
+        double beta_imag, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
         cl_command_queue queue, 
-        cl_event event, 
-        cl_mem temp_buffer)
+        cl_event[] waitList, 
+        cl_event event)
     {
-        return checkResult(CLBlastZgemmWithTempBufferNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event, temp_buffer));
+        return checkResult(CLBlastZgemmPooledSplitNative(layout, a_transpose, b_transpose, m, n, k, alpha_real, alpha_imag, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta_real, beta_imag, c_buffer, c_offset, c_ld, queue, waitList, event));
     }
-    private static native int CLBlastZgemmWithTempBufferNative(
+    private static native int CLBlastZgemmPooledSplitNative(
         int layout, 
         int a_transpose, 
         int b_transpose, 
         long m, 
         long n, 
         long k, 
-        double[] alpha, 
+        double alpha_real, 
+        double alpha_imag, 
         cl_mem a_buffer, 
         long a_offset, 
         long a_ld, 
         cl_mem b_buffer, 
         long b_offset, 
         long b_ld, 
-        double[] beta, 
+        double beta_real, 
+        double beta_imag, 
         cl_mem c_buffer, 
         long c_offset, 
         long c_ld, 
         cl_command_queue queue, 
-        cl_event event, 
-        cl_mem temp_buffer);
+        cl_event[] waitList, 
+        cl_event event);
 
 
     // =================================================================================================
@@ -6803,6 +19438,41 @@ public class CLBlast
         long[] temp_buffer_size);
 
 
+    public static int CLBlastHGemmTempBufferSize(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        long a_offset, 
+        long a_ld, 
+        long b_offset, 
+        long b_ld, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        long[] temp_buffer_size)
+    {
+        return checkResult(CLBlastHGemmTempBufferSizeNative(layout, a_transpose, b_transpose, m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld, queue, temp_buffer_size));
+    }
+    private static native int CLBlastHGemmTempBufferSizeNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        long a_offset, 
+        long a_ld, 
+        long b_offset, 
+        long b_ld, 
+        long c_offset, 
+        long c_ld, 
+        cl_command_queue queue, 
+        long[] temp_buffer_size);
+
+
     // =================================================================================================
     // CLBlast stores binaries of compiled kernels into a cache in case the same kernel is used later on
     // for the same device. This cache can be cleared to free up system memory or in case of debugging.
@@ -6846,6 +19516,88 @@ public class CLBlast
         long[] parameters_values);
 
 
+    // =================================================================================================
+    // Loads a database of tuning parameters for a specific device and applies all of them in a single
+    // call, or exports the parameters that have been applied for a device.
+    
+    /**
+     * Load the tuning parameters from the given file, and apply them for
+     * the given device, as if {@link #CLBlastOverrideParameters} was called
+     * for each kernel. The file is parsed natively, and all parameters are
+     * applied in a single native call.
+     * <p>
+     * The file is a JSON file. It may either contain an object with an
+     * <code>"entries"</code> array, an array of entries, or a single entry.
+     * Each entry is either an object with <code>"kernel"</code>, 
+     * <code>"precision"</code> and <code>"parameters"</code> (as written by
+     * {@link #exportTuningDatabase(cl_device_id, File)}), or the JSON 
+     * output of the CLBlast tuners, with <code>"kernel_family"</code>, 
+     * <code>"precision"</code> and <code>"best_parameters"</code>.
+     * <p>
+     * Entries that cannot be applied are skipped, and an error message is
+     * printed when the log level is at least <code>LOG_ERROR</code>.
+     * 
+     * @param device The device
+     * @param file The file
+     * @return The kernels for which the parameters have been applied, as
+     * strings like <code>"Xgemm/32"</code>, containing the kernel name and
+     * the precision
+     * @throws IOException If the file cannot be read or is not valid
+     */
+    public static String[] loadTuningDatabase(cl_device_id device, File file)
+        throws IOException
+    {
+        return loadTuningDatabaseNative(device, file.getPath());
+    }
+    private static native String[] loadTuningDatabaseNative(
+        cl_device_id device, 
+        String fileName) throws IOException;
+    
+    /**
+     * Export all tuning parameters that have been applied for the given
+     * device, with {@link #CLBlastOverrideParameters} or with
+     * {@link #loadTuningDatabase(cl_device_id, File)}, into the given file.
+     * The file may later be loaded with 
+     * {@link #loadTuningDatabase(cl_device_id, File)}.
+     * 
+     * @param device The device
+     * @param file The file
+     * @throws IOException If the file cannot be written
+     */
+    public static void exportTuningDatabase(cl_device_id device, File file)
+        throws IOException
+    {
+        exportTuningDatabaseNative(device, file.getPath());
+    }
+    private static native void exportTuningDatabaseNative(
+        cl_device_id device, 
+        String fileName) throws IOException;
+    
+    /**
+     * Returns the tuning parameters that have been applied for the given
+     * device, kernel and precision, with {@link #CLBlastOverrideParameters}
+     * or with {@link #loadTuningDatabase(cl_device_id, File)}, as an array
+     * containing the <code>String[]</code> of the parameter names and the
+     * <code>long[]</code> of their values. Returns <code>null</code> if
+     * no parameters have been applied, and the kernel still uses the 
+     * parameters from the CLBlast database.
+     * 
+     * @param device The device
+     * @param kernel_name The kernel name
+     * @param precision The {@link CLBlastPrecision}
+     * @return The parameters, or <code>null</code>
+     */
+    static Object[] getTuningParameters(
+        cl_device_id device, String kernel_name, int precision)
+    {
+        return getTuningParametersNative(device, kernel_name, precision);
+    }
+    private static native Object[] getTuningParametersNative(
+        cl_device_id device, 
+        String kernel_name, 
+        int precision);
+
+
     /**
      * Private constructor to prevent instantiation
      */
@@ -0,0 +1,432 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_COMPLETE;
+import static org.jocl.CL.clFlush;
+import static org.jocl.CL.clReleaseEvent;
+
+import java.util.concurrent.CompletableFuture;
+
+import org.jocl.CL;
+import org.jocl.CLException;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * Asynchronous execution of the CLBlast routines.<br>
+ * <br>
+ * The methods of this class enqueue a routine, and return a
+ * <code>CompletableFuture</code> that is completed when the event of
+ * the routine is complete. The completion is signalled by a native
+ * event callback, so that no Java thread has to wait for the event:
+ * <pre><code>
+ * CompletableFuture&lt;Integer&gt; future =
+ *     CLBlastAsync.CLBlastSgemmBatchedAsync(..., queue, null);
+ * future.thenRunAsync(() -&gt; processResult(), executor);
+ * </code></pre>
+ * Any routine can be executed asynchronously with
+ * {@link #submit(cl_command_queue, Routine)}, which receives the
+ * routine call for a given event:
+ * <pre><code>
+ * CompletableFuture&lt;Integer&gt; future = CLBlastAsync.submit(queue,
+ *     event -&gt; CLBlast.CLBlastSsyrk(..., queue, event));
+ * </code></pre>
+ * The result of the future is <code>CLBlastSuccess</code> when the
+ * routine completed, or the status code of the routine when it could
+ * not be enqueued. When exceptions are enabled, or when the commands of
+ * the routine terminated abnormally, the future is completed
+ * exceptionally with a <code>CLException</code>.<br>
+ * <br>
+ * The futures are completed on the threads of the OpenCL implementation
+ * that execute the event callbacks. These threads should not be blocked,
+ * so dependent actions that are not trivial should be executed with the
+ * <code>...Async</code> methods of the future, using an executor.
+ */
+public final class CLBlastAsync
+{
+    // Initialization of the native library
+    static
+    {
+        CLBlast.initialize();
+    }
+
+    /**
+     * A routine call that can be executed asynchronously
+     */
+    @FunctionalInterface
+    public interface Routine
+    {
+        /**
+         * Enqueue the routine, and store the event of the routine in the
+         * given event object.
+         *
+         * @param event The event
+         * @return The status code of the routine
+         */
+        int enqueue(cl_event event);
+    }
+
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private CLBlastAsync()
+    {
+        // Private constructor to prevent instantiation
+    }
+
+    /**
+     * Enqueue the given routine, and return a future that is completed
+     * when the routine is complete. The queue is flushed, so that the
+     * routine is submitted to the device.
+     *
+     * @param queue The queue that the routine is enqueued in
+     * @param routine The routine
+     * @return The future
+     */
+    public static CompletableFuture<Integer> submit(
+        cl_command_queue queue, Routine routine)
+    {
+        CompletableFuture<Integer> future = new CompletableFuture<>();
+        cl_event event = new cl_event();
+        int status;
+        try
+        {
+            status = routine.enqueue(event);
+        }
+        catch (RuntimeException e)
+        {
+            future.completeExceptionally(e);
+            return future;
+        }
+        if (status != CLBlastStatusCode.CLBlastSuccess)
+        {
+            future.complete(status);
+            return future;
+        }
+        try
+        {
+            register(event, future);
+        }
+        finally
+        {
+            if (CLBlastFast.getHandle(event) != 0)
+            {
+                clReleaseEvent(event);
+            }
+        }
+        clFlush(queue);
+        return future;
+    }
+
+    /**
+     * Returns a future that is completed when the given event is
+     * complete. The caller remains the owner of the event, and may
+     * release it at any time. The queue of the event has to be flushed
+     * for the future to complete.
+     *
+     * @param event The event
+     * @return The future
+     */
+    public static CompletableFuture<Integer> onCompletion(cl_event event)
+    {
+        CompletableFuture<Integer> future = new CompletableFuture<>();
+        register(event, future);
+        return future;
+    }
+
+    /**
+     * Register the callback for completing the given future when the
+     * given event is complete. If this fails, then the future is
+     * completed exceptionally.
+     *
+     * @param event The event
+     * @param future The future
+     */
+    private static void register(
+        cl_event event, CompletableFuture<Integer> future)
+    {
+        long handle = CLBlastFast.getHandle(event);
+        if (handle == 0)
+        {
+            future.completeExceptionally(new IllegalArgumentException(
+                "The routine did not produce an event"));
+            return;
+        }
+        int result = setCompletionCallbackNative(handle, future);
+        if (result != CL.CL_SUCCESS)
+        {
+            future.completeExceptionally(new CLException(
+                "Could not set the event callback: " +
+                CL.stringFor_errorCode(result), result));
+        }
+    }
+
+    /**
+     * Complete the given future with the given execution status of an
+     * event. This is called from the native event callback.
+     *
+     * @param future The future
+     * @param executionStatus The execution status
+     */
+    static void completed(
+        CompletableFuture<Integer> future, int executionStatus)
+    {
+        if (executionStatus == CL_COMPLETE)
+        {
+            future.complete(CLBlastStatusCode.CLBlastSuccess);
+        }
+        else
+        {
+            future.completeExceptionally(new CLException(
+                "The routine terminated abnormally: " +
+                CL.stringFor_errorCode(executionStatus), executionStatus));
+        }
+    }
+
+    /**
+     * Set the native event callback for the given event, which completes
+     * the given future
+     *
+     * @param event The native event handle
+     * @param future The future
+     * @return The OpenCL error code
+     */
+    private static native int setCompletionCallbackNative(
+        long event, CompletableFuture<Integer> future);
+
+    /**
+     * Asynchronous version of
+     * {@link CLBlast#CLBlastSgemm(int, int, int, long, long, long, float, cl_mem, long, long, cl_mem, long, long, float, cl_mem, long, long, cl_command_queue, cl_event[], cl_event)}
+     *
+     * @return The future
+     */
+    public static CompletableFuture<Integer> CLBlastSgemmAsync(
+        int layout,
+        int a_transpose,
+        int b_transpose,
+        long m,
+        long n,
+        long k,
+        float alpha,
+        cl_mem a_buffer,
+        long a_offset,
+        long a_ld,
+        cl_mem b_buffer,
+        long b_offset,
+        long b_ld,
+        float beta,
+        cl_mem c_buffer,
+        long c_offset,
+        long c_ld,
+        cl_command_queue queue,
+        cl_event[] waitList)
+    {
+        return submit(queue, event -> CLBlast.CLBlastSgemm(layout,
+            a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset,
+            a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld,
+            queue, waitList, event));
+    }
+
+    /**
+     * Asynchronous version of
+     * {@link CLBlast#CLBlastDgemm(int, int, int, long, long, long, double, cl_mem, long, long, cl_mem, long, long, double, cl_mem, long, long, cl_command_queue, cl_event[], cl_event)}
+     *
+     * @return The future
+     */
+    public static CompletableFuture<Integer> CLBlastDgemmAsync(
+        int layout,
+        int a_transpose,
+        int b_transpose,
+        long m,
+        long n,
+        long k,
+        double alpha,
+        cl_mem a_buffer,
+        long a_offset,
+        long a_ld,
+        cl_mem b_buffer,
+        long b_offset,
+        long b_ld,
+        double beta,
+        cl_mem c_buffer,
+        long c_offset,
+        long c_ld,
+        cl_command_queue queue,
+        cl_event[] waitList)
+    {
+        return submit(queue, event -> CLBlast.CLBlastDgemm(layout,
+            a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset,
+            a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld,
+            queue, waitList, event));
+    }
+
+    /**
+     * Asynchronous version of
+     * {@link CLBlast#CLBlastSgemmBatched(int, int, int, long, long, long, float[], cl_mem, long[], long, cl_mem, long[], long, float[], cl_mem, long[], long, long, cl_command_queue, cl_event[], cl_event)}
+     *
+     * @return The future
+     */
+    public static CompletableFuture<Integer> CLBlastSgemmBatchedAsync(
+        int layout,
+        int a_transpose,
+        int b_transpose,
+        long m,
+        long n,
+        long k,
+        float[] alphas,
+        cl_mem a_buffer,
+        long[] a_offsets,
+        long a_ld,
+        cl_mem b_buffer,
+        long[] b_offsets,
+        long b_ld,
+        float[] betas,
+        cl_mem c_buffer,
+        long[] c_offsets,
+        long c_ld,
+        long batch_count,
+        cl_command_queue queue,
+        cl_event[] waitList)
+    {
+        return submit(queue, event -> CLBlast.CLBlastSgemmBatched(layout,
+            a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets,
+            a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets,
+            c_ld, batch_count, queue, waitList, event));
+    }
+
+    /**
+     * Asynchronous version of
+     * {@link CLBlast#CLBlastDgemmBatched(int, int, int, long, long, long, double[], cl_mem, long[], long, cl_mem, long[], long, double[], cl_mem, long[], long, long, cl_command_queue, cl_event[], cl_event)}
+     *
+     * @return The future
+     */
+    public static CompletableFuture<Integer> CLBlastDgemmBatchedAsync(
+        int layout,
+        int a_transpose,
+        int b_transpose,
+        long m,
+        long n,
+        long k,
+        double[] alphas,
+        cl_mem a_buffer,
+        long[] a_offsets,
+        long a_ld,
+        cl_mem b_buffer,
+        long[] b_offsets,
+        long b_ld,
+        double[] betas,
+        cl_mem c_buffer,
+        long[] c_offsets,
+        long c_ld,
+        long batch_count,
+        cl_command_queue queue,
+        cl_event[] waitList)
+    {
+        return submit(queue, event -> CLBlast.CLBlastDgemmBatched(layout,
+            a_transpose, b_transpose, m, n, k, alphas, a_buffer, a_offsets,
+            a_ld, b_buffer, b_offsets, b_ld, betas, c_buffer, c_offsets,
+            c_ld, batch_count, queue, waitList, event));
+    }
+
+    /**
+     * Asynchronous version of
+     * {@link CLBlast#CLBlastSgemmStridedBatched(int, int, int, long, long, long, float, cl_mem, long, long, long, cl_mem, long, long, long, float, cl_mem, long, long, long, long, cl_command_queue, cl_event[], cl_event)}
+     *
+     * @return The future
+     */
+    public static CompletableFuture<Integer> CLBlastSgemmStridedBatchedAsync(
+        int layout,
+        int a_transpose,
+        int b_transpose,
+        long m,
+        long n,
+        long k,
+        float alpha,
+        cl_mem a_buffer,
+        long a_offset,
+        long a_ld,
+        long a_stride,
+        cl_mem b_buffer,
+        long b_offset,
+        long b_ld,
+        long b_stride,
+        float beta,
+        cl_mem c_buffer,
+        long c_offset,
+        long c_ld,
+        long c_stride,
+        long batch_count,
+        cl_command_queue queue,
+        cl_event[] waitList)
+    {
+        return submit(queue, event -> CLBlast.CLBlastSgemmStridedBatched(
+            layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer,
+            a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride,
+            beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue,
+            waitList, event));
+    }
+
+    /**
+     * Asynchronous version of
+     * {@link CLBlast#CLBlastDgemmStridedBatched(int, int, int, long, long, long, double, cl_mem, long, long, long, cl_mem, long, long, long, double, cl_mem, long, long, long, long, cl_command_queue, cl_event[], cl_event)}
+     *
+     * @return The future
+     */
+    public static CompletableFuture<Integer> CLBlastDgemmStridedBatchedAsync(
+        int layout,
+        int a_transpose,
+        int b_transpose,
+        long m,
+        long n,
+        long k,
+        double alpha,
+        cl_mem a_buffer,
+        long a_offset,
+        long a_ld,
+        long a_stride,
+        cl_mem b_buffer,
+        long b_offset,
+        long b_ld,
+        long b_stride,
+        double beta,
+        cl_mem c_buffer,
+        long c_offset,
+        long c_ld,
+        long c_stride,
+        long batch_count,
+        cl_command_queue queue,
+        cl_event[] waitList)
+    {
+        return submit(queue, event -> CLBlast.CLBlastDgemmStridedBatched(
+            layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer,
+            a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride,
+            beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue,
+            waitList, event));
+    }
+}
@@ -0,0 +1,629 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import java.io.DataInputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Collections;
+import java.util.List;
+
+/**
+ * A snapshot of the call trace of the {@link CLBlast} routines, as 
+ * returned by {@link CLBlast#getCallTrace()}.
+ * <p>
+ * The call trace is only recorded when it has been enabled with
+ * {@link CLBlast#setCallTraceEnabled(boolean)}. It contains one 
+ * {@link Call} for each call of a routine, with the status, a timestamp,
+ * the host time of the call, and all arguments: The scalar and shape 
+ * arguments, the contents of host arrays, the size and identity of 
+ * the memory objects, and the identity of the queue. The contents of
+ * the memory objects are not recorded. The calls of the 
+ * {@link CLBlastFast} and {@link CLBlastCommandList} methods are not 
+ * contained in the trace. The native library records the
+ * calls in a ring buffer with a fixed size, as described in
+ * {@link CLBlast#setCallTraceCapacity(int)}, so that it can remain 
+ * enabled in long-running applications.
+ * <p>
+ * A call trace can be written into a stream with 
+ * {@link #write(OutputStream)}, and read with 
+ * {@link #read(InputStream)}, to replay it later with the
+ * {@link CLBlastTraceReplay}.
+ */
+public final class CLBlastCallTrace
+{
+    // The kinds of the arguments of the records. These values must 
+    // match the ArgumentKind enum in JOCLBlastRoutines.hpp
+    static final int ARGUMENT_SIZE = 0;
+    static final int ARGUMENT_ENUM = 1;
+    static final int ARGUMENT_FLOAT = 2;
+    static final int ARGUMENT_DOUBLE = 3;
+    static final int ARGUMENT_HALF = 4;
+    static final int ARGUMENT_COMPLEX_FLOAT = 5;
+    static final int ARGUMENT_COMPLEX_DOUBLE = 6;
+    static final int ARGUMENT_MEM = 7;
+    static final int ARGUMENT_DEVICE = 8;
+    static final int ARGUMENT_QUEUE = 9;
+    static final int ARGUMENT_QUEUE_WAIT_LIST = 10;
+    static final int ARGUMENT_EVENT = 11;
+    static final int ARGUMENT_FLOAT2_VALUE = 12;
+    static final int ARGUMENT_DOUBLE2_VALUE = 13;
+    static final int ARGUMENT_FLOAT_ARRAY = 14;
+    static final int ARGUMENT_DOUBLE_ARRAY = 15;
+    static final int ARGUMENT_FLOAT2_ARRAY = 16;
+    static final int ARGUMENT_DOUBLE2_ARRAY = 17;
+    static final int ARGUMENT_HALF_ARRAY = 18;
+    static final int ARGUMENT_SIZE_ARRAY = 19;
+    static final int ARGUMENT_DIRECT_FLOAT = 20;
+    static final int ARGUMENT_DIRECT_DOUBLE = 21;
+    static final int ARGUMENT_DIRECT_FLOAT2 = 22;
+    static final int ARGUMENT_DIRECT_DOUBLE2 = 23;
+    static final int ARGUMENT_DIRECT_HALF = 24;
+    static final int ARGUMENT_DIRECT_SIZE = 25;
+
+    /**
+     * The size of the header of each record, in bytes
+     */
+    private static final int HEADER_SIZE = 28;
+
+    /**
+     * The magic number at the beginning of a call trace stream
+     */
+    private static final int MAGIC = 0x4A434254;
+
+    /**
+     * The version of the call trace stream format
+     */
+    private static final int VERSION = 1;
+
+    /**
+     * A single call of a routine
+     */
+    public static final class Call
+    {
+        /**
+         * The name of the routine
+         */
+        private final String routine;
+
+        /**
+         * The status that was returned by the routine
+         */
+        private final int status;
+
+        /**
+         * The timestamp, in nanoseconds
+         */
+        private final long timestampNanos;
+
+        /**
+         * The host duration, in nanoseconds
+         */
+        private final long durationNanos;
+
+        /**
+         * The kinds of the arguments
+         */
+        private final int kinds[];
+
+        /**
+         * The values of the arguments
+         */
+        private final Object values[];
+
+        /**
+         * Creates a new call
+         *
+         * @param routine The routine name
+         * @param status The status
+         * @param timestampNanos The timestamp
+         * @param durationNanos The duration
+         * @param kinds The argument kinds
+         * @param values The argument values
+         */
+        Call(String routine, int status, long timestampNanos, 
+            long durationNanos, int kinds[], Object values[])
+        {
+            this.routine = routine;
+            this.status = status;
+            this.timestampNanos = timestampNanos;
+            this.durationNanos = durationNanos;
+            this.kinds = kinds;
+            this.values = values;
+        }
+
+        /**
+         * Returns the name of the routine, e.g. <code>"CLBlastSgemm"</code>
+         *
+         * @return The name
+         */
+        public String getRoutine()
+        {
+            return routine;
+        }
+
+        /**
+         * Returns the {@link CLBlastStatusCode} that was returned by the
+         * routine
+         *
+         * @return The status
+         */
+        public int getStatus()
+        {
+            return status;
+        }
+
+        /**
+         * Returns the time when the routine was called, in nanoseconds,
+         * relative to the time when the trace was enabled or reset
+         *
+         * @return The timestamp
+         */
+        public long getTimestampNanos()
+        {
+            return timestampNanos;
+        }
+
+        /**
+         * Returns the host time of the call, in nanoseconds. For 
+         * asynchronous routines, this is the time that was required for
+         * enqueueing the kernels, and not the device time.
+         *
+         * @return The duration
+         */
+        public long getDurationNanos()
+        {
+            return durationNanos;
+        }
+
+        /**
+         * Returns the sizes of the memory objects that have been passed
+         * to the routine, in bytes, in the order of the parameters
+         *
+         * @return The sizes
+         */
+        public long[] getMemorySizes()
+        {
+            int count = 0;
+            for (int kind : kinds)
+            {
+                if (kind == ARGUMENT_MEM)
+                {
+                    count++;
+                }
+            }
+            long result[] = new long[count];
+            int index = 0;
+            for (int i = 0; i < kinds.length; i++)
+            {
+                if (kinds[i] == ARGUMENT_MEM)
+                {
+                    result[index++] = ((long[])values[i])[1];
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Returns the number of arguments
+         *
+         * @return The number of arguments
+         */
+        int getArgumentCount()
+        {
+            return kinds.length;
+        }
+
+        /**
+         * Returns the kind of the argument with the given index
+         *
+         * @param index The index
+         * @return The kind
+         */
+        int getKind(int index)
+        {
+            return kinds[index];
+        }
+
+        /**
+         * Returns the value of the argument with the given index. This
+         * is a <code>Long</code>, <code>Integer</code>, <code>Float</code>,
+         * <code>Double</code> or <code>Boolean</code> for scalar values,
+         * and an array for complex values and host arrays. For memory
+         * objects, it is a <code>long[]</code> with the handle and size.
+         * For queues with a wait list, it is a <code>long[]</code> with 
+         * the handle and the length of the wait list, which is -1 for
+         * a <code>null</code> wait list.
+         *
+         * @param index The index
+         * @return The value
+         */
+        Object getValue(int index)
+        {
+            return values[index];
+        }
+
+        @Override
+        public String toString()
+        {
+            StringBuilder sb = new StringBuilder();
+            sb.append(routine).append("(");
+            for (int i = 0; i < kinds.length; i++)
+            {
+                if (i > 0)
+                {
+                    sb.append(", ");
+                }
+                sb.append(valueString(kinds[i], values[i]));
+            }
+            sb.append(") = ").append(CLBlastStatusCode.stringFor(status));
+            return sb.toString();
+        }
+    }
+
+    /**
+     * The names of the routines that the records refer to
+     */
+    private final String routineNames[];
+
+    /**
+     * The records
+     */
+    private final byte records[];
+
+    /**
+     * The byte order of the records
+     */
+    private final ByteOrder byteOrder;
+
+    /**
+     * The number of records that have been dropped
+     */
+    private final long droppedCount;
+
+    /**
+     * The calls
+     */
+    private final List<Call> calls;
+
+    /**
+     * Creates a new snapshot from the given data, as it was obtained 
+     * from the native library. The records have the native byte order.
+     * The counts contain the number of records and the number of 
+     * dropped records.
+     *
+     * @param routineNames The routine names
+     * @param records The records
+     * @param counts The counts
+     */
+    CLBlastCallTrace(String routineNames[], byte records[], long counts[])
+    {
+        this(routineNames, records, ByteOrder.nativeOrder(), counts[1]);
+    }
+
+    /**
+     * Creates a new snapshot from the given data
+     *
+     * @param routineNames The routine names
+     * @param records The records
+     * @param byteOrder The byte order of the records
+     * @param droppedCount The number of dropped records
+     */
+    private CLBlastCallTrace(String routineNames[], byte records[], 
+        ByteOrder byteOrder, long droppedCount)
+    {
+        this.routineNames = routineNames;
+        this.records = records;
+        this.byteOrder = byteOrder;
+        this.droppedCount = droppedCount;
+        this.calls = Collections.unmodifiableList(parseCalls());
+    }
+
+    /**
+     * Parse all records
+     *
+     * @return The calls
+     */
+    private List<Call> parseCalls()
+    {
+        List<Call> result = new ArrayList<Call>();
+        ByteBuffer bb = ByteBuffer.wrap(records).order(byteOrder);
+        while (bb.remaining() >= HEADER_SIZE)
+        {
+            int start = bb.position();
+            int size = bb.getInt();
+            String routine = routineNames[bb.getShort() & 0xFFFF];
+            int argumentCount = bb.getShort() & 0xFFFF;
+            int status = bb.getInt();
+            long timestampNanos = bb.getLong();
+            long durationNanos = bb.getLong();
+            int kinds[] = new int[argumentCount];
+            Object values[] = new Object[argumentCount];
+            for (int i = 0; i < argumentCount; i++)
+            {
+                kinds[i] = bb.get() & 0xFF;
+                values[i] = parseValue(kinds[i], bb);
+            }
+            if (bb.position() != start + size)
+            {
+                throw new IllegalArgumentException(
+                    "Invalid call trace record for " + routine);
+            }
+            result.add(new Call(routine, status, timestampNanos, 
+                durationNanos, kinds, values));
+        }
+        return result;
+    }
+
+    /**
+     * Parse the value of an argument with the given kind from the given
+     * buffer
+     *
+     * @param kind The kind
+     * @param bb The buffer
+     * @return The value
+     */
+    private static Object parseValue(int kind, ByteBuffer bb)
+    {
+        switch (kind)
+        {
+            case ARGUMENT_SIZE:
+            case ARGUMENT_DEVICE:
+            case ARGUMENT_QUEUE:
+                return bb.getLong();
+
+            case ARGUMENT_ENUM:
+                return bb.getInt();
+
+            case ARGUMENT_FLOAT:
+            case ARGUMENT_HALF:
+                return bb.getFloat();
+
+            case ARGUMENT_DOUBLE:
+                return bb.getDouble();
+
+            case ARGUMENT_COMPLEX_FLOAT:
+                return new float[] { bb.getFloat(), bb.getFloat() };
+
+            case ARGUMENT_COMPLEX_DOUBLE:
+                return new double[] { bb.getDouble(), bb.getDouble() };
+
+            case ARGUMENT_MEM:
+                return new long[] { bb.getLong(), bb.getLong() };
+
+            case ARGUMENT_QUEUE_WAIT_LIST:
+                return new long[] { bb.getLong(), bb.getInt() };
+
+            case ARGUMENT_EVENT:
+                return bb.get() != 0;
+
+            case ARGUMENT_FLOAT2_VALUE:
+            case ARGUMENT_FLOAT_ARRAY:
+            case ARGUMENT_FLOAT2_ARRAY:
+            case ARGUMENT_HALF_ARRAY:
+            case ARGUMENT_DIRECT_FLOAT:
+            case ARGUMENT_DIRECT_FLOAT2:
+            {
+                float array[] = new float[bb.getInt()];
+                bb.asFloatBuffer().get(array);
+                bb.position(bb.position() + array.length * 4);
+                return array;
+            }
+
+            case ARGUMENT_DOUBLE2_VALUE:
+            case ARGUMENT_DOUBLE_ARRAY:
+            case ARGUMENT_DOUBLE2_ARRAY:
+            case ARGUMENT_DIRECT_DOUBLE:
+            case ARGUMENT_DIRECT_DOUBLE2:
+            {
+                double array[] = new double[bb.getInt()];
+                bb.asDoubleBuffer().get(array);
+                bb.position(bb.position() + array.length * 8);
+                return array;
+            }
+
+            case ARGUMENT_SIZE_ARRAY:
+            case ARGUMENT_DIRECT_SIZE:
+            {
+                long array[] = new long[bb.getInt()];
+                bb.asLongBuffer().get(array);
+                bb.position(bb.position() + array.length * 8);
+                return array;
+            }
+
+            case ARGUMENT_DIRECT_HALF:
+            {
+                short array[] = new short[bb.getInt()];
+                bb.asShortBuffer().get(array);
+                bb.position(bb.position() + array.length * 2);
+                return array;
+            }
+
+            default:
+                throw new IllegalArgumentException(
+                    "Invalid argument kind in call trace: " + kind);
+        }
+    }
+
+    /**
+     * Returns a string representation of the given argument value
+     *
+     * @param kind The kind
+     * @param value The value
+     * @return The string
+     */
+    private static String valueString(int kind, Object value)
+    {
+        switch (kind)
+        {
+            case ARGUMENT_MEM:
+            {
+                long mem[] = (long[])value;
+                return "mem[0x" + Long.toHexString(mem[0]) + 
+                    ", " + mem[1] + " bytes]";
+            }
+            case ARGUMENT_DEVICE:
+            case ARGUMENT_QUEUE:
+                return "0x" + Long.toHexString((Long)value);
+            case ARGUMENT_QUEUE_WAIT_LIST:
+            {
+                long queue[] = (long[])value;
+                return "0x" + Long.toHexString(queue[0]) + 
+                    ", waitList=" + queue[1];
+            }
+            case ARGUMENT_EVENT:
+                return Boolean.TRUE.equals(value) ? "event" : "null";
+            default:
+                break;
+        }
+        if (value instanceof float[])
+        {
+            return Arrays.toString((float[])value);
+        }
+        if (value instanceof double[])
+        {
+            return Arrays.toString((double[])value);
+        }
+        if (value instanceof long[])
+        {
+            return Arrays.toString((long[])value);
+        }
+        if (value instanceof short[])
+        {
+            return Arrays.toString((short[])value);
+        }
+        return String.valueOf(value);
+    }
+
+    /**
+     * Returns an unmodifiable list with all calls, in the order in which
+     * they have been made
+     *
+     * @return The calls
+     */
+    public List<Call> getCalls()
+    {
+        return calls;
+    }
+
+    /**
+     * Returns the number of calls that have been dropped from the ring 
+     * buffer of the native library since the trace was enabled or reset,
+     * because the ring buffer was full
+     *
+     * @return The number of dropped calls
+     */
+    public long getDroppedCount()
+    {
+        return droppedCount;
+    }
+
+    /**
+     * Write this call trace into the given stream. The stream is not
+     * closed.
+     *
+     * @param outputStream The stream
+     * @throws IOException If an IO error occurs
+     */
+    public void write(OutputStream outputStream) throws IOException
+    {
+        DataOutputStream dos = new DataOutputStream(outputStream);
+        dos.writeInt(MAGIC);
+        dos.writeInt(VERSION);
+        dos.writeBoolean(byteOrder == ByteOrder.BIG_ENDIAN);
+        dos.writeLong(droppedCount);
+        dos.writeInt(routineNames.length);
+        for (String routineName : routineNames)
+        {
+            dos.writeUTF(routineName);
+        }
+        dos.writeInt(records.length);
+        dos.write(records);
+        dos.flush();
+    }
+
+    /**
+     * Read a call trace from the given stream, as it was written with
+     * {@link #write(OutputStream)}. The stream is not closed.
+     *
+     * @param inputStream The stream
+     * @return The call trace
+     * @throws IOException If an IO error occurs, or the stream does not
+     * contain a valid call trace
+     */
+    public static CLBlastCallTrace read(InputStream inputStream) 
+        throws IOException
+    {
+        DataInputStream dis = new DataInputStream(inputStream);
+        if (dis.readInt() != MAGIC)
+        {
+            throw new IOException("The stream does not contain a call trace");
+        }
+        int version = dis.readInt();
+        if (version != VERSION)
+        {
+            throw new IOException(
+                "Unsupported call trace version: " + version);
+        }
+        ByteOrder byteOrder = dis.readBoolean() ? 
+            ByteOrder.BIG_ENDIAN : ByteOrder.LITTLE_ENDIAN;
+        long droppedCount = dis.readLong();
+        String routineNames[] = new String[dis.readInt()];
+        for (int i = 0; i < routineNames.length; i++)
+        {
+            routineNames[i] = dis.readUTF();
+        }
+        byte records[] = new byte[dis.readInt()];
+        dis.readFully(records);
+        try
+        {
+            return new CLBlastCallTrace(
+                routineNames, records, byteOrder, droppedCount);
+        }
+        catch (RuntimeException e)
+        {
+            throw new IOException("Invalid call trace: " + e.getMessage(), e);
+        }
+    }
+
+    @Override
+    public String toString()
+    {
+        StringBuilder sb = new StringBuilder();
+        for (Call call : calls)
+        {
+            sb.append(call).append(String.format("%n"));
+        }
+        return sb.toString();
+    }
+}
@@ -0,0 +1,7635 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.IdentityHashMap;
+import java.util.List;
+import java.util.Map;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * A list of CLBlast calls that can be recorded once and then executed
+ * with a single native call.
+ * <p>
+ * The methods of this class correspond to the methods of the 
+ * {@link CLBlast} class, without the <code>queue</code> and 
+ * <code>event</code> parameters. Each call is recorded into a compact,
+ * direct buffer. Calling {@link #execute(cl_command_queue, cl_event)} 
+ * will issue all recorded calls, in the order in which they have been 
+ * recorded, on the given queue, in a single JNI call.
+ * <p>
+ * All arguments are recorded by value. This includes the contents of
+ * the arrays that are passed to the complex and batched routines, so 
+ * later modifications of these arrays will not affect the recorded 
+ * calls. The <code>cl_mem</code> objects are stored by reference, and 
+ * must not be released while the list is in use.
+ * <p>
+ * This class is not thread-safe.
+ */
+public final class CLBlastCommandList
+{
+    // Initialization of the native library
+    static
+    {
+        CLBlast.initialize();
+    }
+    
+    // The identifiers of the recorded commands. These have to match the
+    // values that are used in the native implementation
+    private static final int COMMAND_SROTG = 1;
+    private static final int COMMAND_DROTG = 2;
+    private static final int COMMAND_SROTMG = 3;
+    private static final int COMMAND_DROTMG = 4;
+    private static final int COMMAND_SROT = 5;
+    private static final int COMMAND_DROT = 6;
+    private static final int COMMAND_SROTM = 7;
+    private static final int COMMAND_DROTM = 8;
+    private static final int COMMAND_SSWAP = 9;
+    private static final int COMMAND_DSWAP = 10;
+    private static final int COMMAND_CSWAP = 11;
+    private static final int COMMAND_ZSWAP = 12;
+    private static final int COMMAND_HSWAP = 13;
+    private static final int COMMAND_SSCAL = 14;
+    private static final int COMMAND_DSCAL = 15;
+    private static final int COMMAND_CSCAL = 16;
+    private static final int COMMAND_ZSCAL = 17;
+    private static final int COMMAND_HSCAL = 18;
+    private static final int COMMAND_SCOPY = 19;
+    private static final int COMMAND_DCOPY = 20;
+    private static final int COMMAND_CCOPY = 21;
+    private static final int COMMAND_ZCOPY = 22;
+    private static final int COMMAND_HCOPY = 23;
+    private static final int COMMAND_SAXPY = 24;
+    private static final int COMMAND_DAXPY = 25;
+    private static final int COMMAND_CAXPY = 26;
+    private static final int COMMAND_ZAXPY = 27;
+    private static final int COMMAND_HAXPY = 28;
+    private static final int COMMAND_SDOT = 29;
+    private static final int COMMAND_DDOT = 30;
+    private static final int COMMAND_HDOT = 31;
+    private static final int COMMAND_CDOTU = 32;
+    private static final int COMMAND_ZDOTU = 33;
+    private static final int COMMAND_CDOTC = 34;
+    private static final int COMMAND_ZDOTC = 35;
+    private static final int COMMAND_SNRM2 = 36;
+    private static final int COMMAND_DNRM2 = 37;
+    private static final int COMMAND_SCNRM2 = 38;
+    private static final int COMMAND_DZNRM2 = 39;
+    private static final int COMMAND_HNRM2 = 40;
+    private static final int COMMAND_SASUM = 41;
+    private static final int COMMAND_DASUM = 42;
+    private static final int COMMAND_SCASUM = 43;
+    private static final int COMMAND_DZASUM = 44;
+    private static final int COMMAND_HASUM = 45;
+    private static final int COMMAND_SSUM = 46;
+    private static final int COMMAND_DSUM = 47;
+    private static final int COMMAND_SCSUM = 48;
+    private static final int COMMAND_DZSUM = 49;
+    private static final int COMMAND_HSUM = 50;
+    private static final int COMMAND_ISAMAX = 51;
+    private static final int COMMAND_IDAMAX = 52;
+    private static final int COMMAND_ICAMAX = 53;
+    private static final int COMMAND_IZAMAX = 54;
+    private static final int COMMAND_IHAMAX = 55;
+    private static final int COMMAND_ISAMIN = 56;
+    private static final int COMMAND_IDAMIN = 57;
+    private static final int COMMAND_ICAMIN = 58;
+    private static final int COMMAND_IZAMIN = 59;
+    private static final int COMMAND_IHAMIN = 60;
+    private static final int COMMAND_ISMAX = 61;
+    private static final int COMMAND_IDMAX = 62;
+    private static final int COMMAND_ICMAX = 63;
+    private static final int COMMAND_IZMAX = 64;
+    private static final int COMMAND_IHMAX = 65;
+    private static final int COMMAND_ISMIN = 66;
+    private static final int COMMAND_IDMIN = 67;
+    private static final int COMMAND_ICMIN = 68;
+    private static final int COMMAND_IZMIN = 69;
+    private static final int COMMAND_IHMIN = 70;
+    private static final int COMMAND_SGEMV = 71;
+    private static final int COMMAND_DGEMV = 72;
+    private static final int COMMAND_CGEMV = 73;
+    private static final int COMMAND_ZGEMV = 74;
+    private static final int COMMAND_HGEMV = 75;
+    private static final int COMMAND_SGBMV = 76;
+    private static final int COMMAND_DGBMV = 77;
+    private static final int COMMAND_CGBMV = 78;
+    private static final int COMMAND_ZGBMV = 79;
+    private static final int COMMAND_HGBMV = 80;
+    private static final int COMMAND_CHEMV = 81;
+    private static final int COMMAND_ZHEMV = 82;
+    private static final int COMMAND_CHBMV = 83;
+    private static final int COMMAND_ZHBMV = 84;
+    private static final int COMMAND_CHPMV = 85;
+    private static final int COMMAND_ZHPMV = 86;
+    private static final int COMMAND_SSYMV = 87;
+    private static final int COMMAND_DSYMV = 88;
+    private static final int COMMAND_HSYMV = 89;
+    private static final int COMMAND_SSBMV = 90;
+    private static final int COMMAND_DSBMV = 91;
+    private static final int COMMAND_HSBMV = 92;
+    private static final int COMMAND_SSPMV = 93;
+    private static final int COMMAND_DSPMV = 94;
+    private static final int COMMAND_HSPMV = 95;
+    private static final int COMMAND_STRMV = 96;
+    private static final int COMMAND_DTRMV = 97;
+    private static final int COMMAND_CTRMV = 98;
+    private static final int COMMAND_ZTRMV = 99;
+    private static final int COMMAND_HTRMV = 100;
+    private static final int COMMAND_STBMV = 101;
+    private static final int COMMAND_DTBMV = 102;
+    private static final int COMMAND_CTBMV = 103;
+    private static final int COMMAND_ZTBMV = 104;
+    private static final int COMMAND_HTBMV = 105;
+    private static final int COMMAND_STPMV = 106;
+    private static final int COMMAND_DTPMV = 107;
+    private static final int COMMAND_CTPMV = 108;
+    private static final int COMMAND_ZTPMV = 109;
+    private static final int COMMAND_HTPMV = 110;
+    private static final int COMMAND_STRSV = 111;
+    private static final int COMMAND_DTRSV = 112;
+    private static final int COMMAND_CTRSV = 113;
+    private static final int COMMAND_ZTRSV = 114;
+    private static final int COMMAND_STBSV = 115;
+    private static final int COMMAND_DTBSV = 116;
+    private static final int COMMAND_CTBSV = 117;
+    private static final int COMMAND_ZTBSV = 118;
+    private static final int COMMAND_STPSV = 119;
+    private static final int COMMAND_DTPSV = 120;
+    private static final int COMMAND_CTPSV = 121;
+    private static final int COMMAND_ZTPSV = 122;
+    private static final int COMMAND_SGER = 123;
+    private static final int COMMAND_DGER = 124;
+    private static final int COMMAND_HGER = 125;
+    private static final int COMMAND_CGERU = 126;
+    private static final int COMMAND_ZGERU = 127;
+    private static final int COMMAND_CGERC = 128;
+    private static final int COMMAND_ZGERC = 129;
+    private static final int COMMAND_CHER = 130;
+    private static final int COMMAND_ZHER = 131;
+    private static final int COMMAND_CHPR = 132;
+    private static final int COMMAND_ZHPR = 133;
+    private static final int COMMAND_CHER2 = 134;
+    private static final int COMMAND_ZHER2 = 135;
+    private static final int COMMAND_CHPR2 = 136;
+    private static final int COMMAND_ZHPR2 = 137;
+    private static final int COMMAND_SSYR = 138;
+    private static final int COMMAND_DSYR = 139;
+    private static final int COMMAND_HSYR = 140;
+    private static final int COMMAND_SSPR = 141;
+    private static final int COMMAND_DSPR = 142;
+    private static final int COMMAND_HSPR = 143;
+    private static final int COMMAND_SSYR2 = 144;
+    private static final int COMMAND_DSYR2 = 145;
+    private static final int COMMAND_HSYR2 = 146;
+    private static final int COMMAND_SSPR2 = 147;
+    private static final int COMMAND_DSPR2 = 148;
+    private static final int COMMAND_HSPR2 = 149;
+    private static final int COMMAND_SGEMM = 150;
+    private static final int COMMAND_DGEMM = 151;
+    private static final int COMMAND_CGEMM = 152;
+    private static final int COMMAND_ZGEMM = 153;
+    private static final int COMMAND_HGEMM = 154;
+    private static final int COMMAND_SSYMM = 155;
+    private static final int COMMAND_DSYMM = 156;
+    private static final int COMMAND_CSYMM = 157;
+    private static final int COMMAND_ZSYMM = 158;
+    private static final int COMMAND_HSYMM = 159;
+    private static final int COMMAND_CHEMM = 160;
+    private static final int COMMAND_ZHEMM = 161;
+    private static final int COMMAND_SSYRK = 162;
+    private static final int COMMAND_DSYRK = 163;
+    private static final int COMMAND_CSYRK = 164;
+    private static final int COMMAND_ZSYRK = 165;
+    private static final int COMMAND_HSYRK = 166;
+    private static final int COMMAND_CHERK = 167;
+    private static final int COMMAND_ZHERK = 168;
+    private static final int COMMAND_SSYR2K = 169;
+    private static final int COMMAND_DSYR2K = 170;
+    private static final int COMMAND_CSYR2K = 171;
+    private static final int COMMAND_ZSYR2K = 172;
+    private static final int COMMAND_HSYR2K = 173;
+    private static final int COMMAND_CHER2K = 174;
+    private static final int COMMAND_ZHER2K = 175;
+    private static final int COMMAND_STRMM = 176;
+    private static final int COMMAND_DTRMM = 177;
+    private static final int COMMAND_CTRMM = 178;
+    private static final int COMMAND_ZTRMM = 179;
+    private static final int COMMAND_HTRMM = 180;
+    private static final int COMMAND_STRSM = 181;
+    private static final int COMMAND_DTRSM = 182;
+    private static final int COMMAND_CTRSM = 183;
+    private static final int COMMAND_ZTRSM = 184;
+    private static final int COMMAND_SHAD = 185;
+    private static final int COMMAND_DHAD = 186;
+    private static final int COMMAND_CHAD = 187;
+    private static final int COMMAND_ZHAD = 188;
+    private static final int COMMAND_HHAD = 189;
+    private static final int COMMAND_SOMATCOPY = 190;
+    private static final int COMMAND_DOMATCOPY = 191;
+    private static final int COMMAND_COMATCOPY = 192;
+    private static final int COMMAND_ZOMATCOPY = 193;
+    private static final int COMMAND_HOMATCOPY = 194;
+    private static final int COMMAND_SIM2COL = 195;
+    private static final int COMMAND_DIM2COL = 196;
+    private static final int COMMAND_CIM2COL = 197;
+    private static final int COMMAND_ZIM2COL = 198;
+    private static final int COMMAND_HIM2COL = 199;
+    private static final int COMMAND_SCOL2IM = 200;
+    private static final int COMMAND_DCOL2IM = 201;
+    private static final int COMMAND_CCOL2IM = 202;
+    private static final int COMMAND_ZCOL2IM = 203;
+    private static final int COMMAND_HCOL2IM = 204;
+    private static final int COMMAND_SCONVGEMM = 205;
+    private static final int COMMAND_DCONVGEMM = 206;
+    private static final int COMMAND_HCONVGEMM = 207;
+    private static final int COMMAND_SAXPYBATCHED = 208;
+    private static final int COMMAND_DAXPYBATCHED = 209;
+    private static final int COMMAND_CAXPYBATCHED = 210;
+    private static final int COMMAND_ZAXPYBATCHED = 211;
+    private static final int COMMAND_HAXPYBATCHED = 212;
+    private static final int COMMAND_SGEMMBATCHED = 213;
+    private static final int COMMAND_DGEMMBATCHED = 214;
+    private static final int COMMAND_CGEMMBATCHED = 215;
+    private static final int COMMAND_ZGEMMBATCHED = 216;
+    private static final int COMMAND_HGEMMBATCHED = 217;
+    private static final int COMMAND_SGEMMSTRIDEDBATCHED = 218;
+    private static final int COMMAND_DGEMMSTRIDEDBATCHED = 219;
+    private static final int COMMAND_CGEMMSTRIDEDBATCHED = 220;
+    private static final int COMMAND_ZGEMMSTRIDEDBATCHED = 221;
+    private static final int COMMAND_HGEMMSTRIDEDBATCHED = 222;
+    private static final int COMMAND_SGEMMWITHTEMPBUFFER = 223;
+    private static final int COMMAND_DGEMMWITHTEMPBUFFER = 224;
+    private static final int COMMAND_CGEMMWITHTEMPBUFFER = 225;
+    private static final int COMMAND_ZGEMMWITHTEMPBUFFER = 226;
+    private static final int COMMAND_HGEMMWITHTEMPBUFFER = 227;
+
+    /**
+     * The size of the header of each record: The command identifier 
+     * and the size of the record, in bytes
+     */
+    private static final int HEADER_SIZE = 16;
+    
+    /**
+     * The size of one argument slot, in bytes
+     */
+    private static final int SLOT_SIZE = 8;
+    
+    /**
+     * The direct buffer containing the records
+     */
+    private ByteBuffer data;
+    
+    /**
+     * The number of bytes of the data buffer that are used
+     */
+    private int dataSize;
+    
+    /**
+     * The number of recorded commands
+     */
+    private int commandCount;
+    
+    /**
+     * The memory objects that are referred to by the records
+     */
+    private final List<cl_mem> mems;
+    
+    /**
+     * The indices of the memory objects in the list of mems
+     */
+    private final Map<cl_mem, Integer> memIndices;
+    
+    /**
+     * The array of the memory objects that is passed to the native
+     * method. This is created lazily, and reset when a new memory 
+     * object is added.
+     */
+    private cl_mem memsArray[];
+    
+    /**
+     * The position (in the data buffer) where the arguments of the
+     * current record start
+     */
+    private int argumentsStart;
+    
+    /**
+     * The position (in the data buffer) of the next argument slot of 
+     * the current record
+     */
+    private int slotPosition;
+    
+    /**
+     * The position (in the data buffer) where the next array of the
+     * current record will be stored
+     */
+    private int tailPosition;
+    
+    /**
+     * Creates a new, empty command list
+     */
+    public CLBlastCommandList()
+    {
+        this(4096);
+    }
+    
+    /**
+     * Creates a new, empty command list with the given initial capacity 
+     * of the internal buffer, in bytes. The buffer grows as necessary.
+     * 
+     * @param initialCapacity The initial capacity
+     * @throws IllegalArgumentException If the given capacity is negative
+     */
+    public CLBlastCommandList(int initialCapacity)
+    {
+        if (initialCapacity < 0)
+        {
+            throw new IllegalArgumentException(
+                "The initial capacity may not be negative, but is " + 
+                initialCapacity);
+        }
+        this.data = ByteBuffer.allocateDirect(initialCapacity).order(
+            ByteOrder.nativeOrder());
+        this.mems = new ArrayList<cl_mem>();
+        this.memIndices = new IdentityHashMap<cl_mem, Integer>();
+    }
+    
+    /**
+     * Returns the number of commands that have been recorded
+     * 
+     * @return The number of commands
+     */
+    public int size()
+    {
+        return commandCount;
+    }
+    
+    /**
+     * Removes all recorded commands
+     */
+    public void clear()
+    {
+        dataSize = 0;
+        tailPosition = 0;
+        commandCount = 0;
+        mems.clear();
+        memIndices.clear();
+        memsArray = null;
+    }
+    
+    /**
+     * Execute all recorded commands on the given queue, in the order in
+     * which they have been recorded. If one of the commands does not
+     * return <code>CLBlastSuccess</code>, then the remaining commands 
+     * are not executed, and the status code of the failing command is 
+     * returned. The given event, if it is not <code>null</code>, will 
+     * receive a marker event that completes when all commands have 
+     * completed, also on an out-of-order queue.
+     * 
+     * @param queue The command queue
+     * @param event The event of all commands. May be <code>null</code>.
+     * @return The status code
+     */
+    public int execute(cl_command_queue queue, cl_event event)
+    {
+        return execute(queue, null, event);
+    }
+    
+    /**
+     * Execute all recorded commands on the given queue, after all events
+     * of the given wait list have completed. The barrier for the wait
+     * list is enqueued in the same native call as the commands. Apart 
+     * from that, this behaves like {@link #execute(cl_command_queue, 
+     * cl_event)}.
+     * 
+     * @param queue The command queue
+     * @param waitList The events to wait for. May be <code>null</code>.
+     * @param event The event of all commands. May be <code>null</code>.
+     * @return The status code
+     */
+    public int execute(
+        cl_command_queue queue, cl_event[] waitList, cl_event event)
+    {
+        if (memsArray == null)
+        {
+            memsArray = mems.toArray(new cl_mem[mems.size()]);
+        }
+        return CLBlast.checkResult(executeNative(
+            data, dataSize, commandCount, memsArray, queue, waitList, event));
+    }
+    private static native int executeNative(
+        ByteBuffer data, 
+        long dataSize, 
+        int commandCount, 
+        cl_mem[] mems, 
+        cl_command_queue queue, 
+        cl_event[] waitList, 
+        cl_event event);
+    
+    /**
+     * Begin a new record for the given command, with the given number
+     * of argument slots
+     * 
+     * @param command The command identifier
+     * @param slots The number of slots
+     */
+    private void begin(int command, int slots)
+    {
+        int recordStart = dataSize;
+        ensureCapacity(recordStart + HEADER_SIZE + slots * SLOT_SIZE);
+        data.putLong(recordStart, command);
+        argumentsStart = recordStart + HEADER_SIZE;
+        slotPosition = argumentsStart;
+        tailPosition = argumentsStart + slots * SLOT_SIZE;
+    }
+    
+    /**
+     * Finish the current record
+     */
+    private void end()
+    {
+        int recordStart = argumentsStart - HEADER_SIZE;
+        data.putLong(recordStart + 8, tailPosition - recordStart);
+        dataSize = tailPosition;
+        commandCount++;
+    }
+    
+    /**
+     * Make sure that the data buffer has at least the given capacity
+     * 
+     * @param capacity The capacity
+     */
+    private void ensureCapacity(int capacity)
+    {
+        if (capacity <= data.capacity())
+        {
+            return;
+        }
+        int newCapacity = Math.max(capacity, data.capacity() * 2);
+        ByteBuffer newData = ByteBuffer.allocateDirect(newCapacity).order(
+            ByteOrder.nativeOrder());
+        ByteBuffer oldData = data.duplicate();
+        oldData.position(0);
+        oldData.limit(tailPosition);
+        newData.put(oldData);
+        newData.clear();
+        data = newData;
+    }
+    
+    private void putInt(int value)
+    {
+        data.putLong(slotPosition, value);
+        slotPosition += SLOT_SIZE;
+    }
+    
+    private void putLong(long value)
+    {
+        data.putLong(slotPosition, value);
+        slotPosition += SLOT_SIZE;
+    }
+    
+    private void putFloat(float value)
+    {
+        data.putLong(slotPosition, 0);
+        data.putFloat(slotPosition, value);
+        slotPosition += SLOT_SIZE;
+    }
+    
+    private void putDouble(double value)
+    {
+        data.putDouble(slotPosition, value);
+        slotPosition += SLOT_SIZE;
+    }
+    
+    private void putMem(cl_mem mem, String name)
+    {
+        if (mem == null)
+        {
+            throw new NullPointerException(
+                "Parameter '" + name + "' is null");
+        }
+        Integer index = memIndices.get(mem);
+        if (index == null)
+        {
+            index = mems.size();
+            mems.add(mem);
+            memIndices.put(mem, index);
+            memsArray = null;
+        }
+        putLong(index);
+    }
+    
+    /**
+     * Store the offset of the array data in the current slot, and begin 
+     * a new array with the given number of elements at the tail of the
+     * current record. The array consists of the number of elements, 
+     * followed by the elements themselves. Returns the position where 
+     * the elements should be written.
+     * 
+     * @param length The number of elements
+     * @param elementSize The size of each element, in bytes
+     * @return The position of the first element
+     */
+    private int beginArray(int length, int elementSize)
+    {
+        int arraySize = SLOT_SIZE + length * elementSize;
+        arraySize = (arraySize + SLOT_SIZE - 1) / SLOT_SIZE * SLOT_SIZE;
+        ensureCapacity(tailPosition + arraySize);
+        putLong(tailPosition - argumentsStart);
+        data.putLong(tailPosition, length);
+        int elementsPosition = tailPosition + SLOT_SIZE;
+        tailPosition += arraySize;
+        return elementsPosition;
+    }
+    
+    private void putArray(float array[], String name)
+    {
+        checkArray(array, name);
+        int position = beginArray(array.length, 4);
+        for (int i = 0; i < array.length; i++)
+        {
+            data.putFloat(position + i * 4, array[i]);
+        }
+    }
+    
+    private void putArray(double array[], String name)
+    {
+        checkArray(array, name);
+        int position = beginArray(array.length, 8);
+        for (int i = 0; i < array.length; i++)
+        {
+            data.putDouble(position + i * 8, array[i]);
+        }
+    }
+    
+    private void putArray(long array[], String name)
+    {
+        checkArray(array, name);
+        int position = beginArray(array.length, 8);
+        for (int i = 0; i < array.length; i++)
+        {
+            data.putLong(position + i * 8, array[i]);
+        }
+    }
+    
+    private static void checkArray(Object array, String name)
+    {
+        if (array == null)
+        {
+            throw new NullPointerException(
+                "Parameter '" + name + "' is null");
+        }
+    }
+    
+    
+    // Generate givens plane rotation: SROTG/DROTG
+    public CLBlastCommandList Srotg(
+        cl_mem sa_buffer, 
+        long sa_offset, 
+        cl_mem sb_buffer, 
+        long sb_offset, 
+        cl_mem sc_buffer, 
+        long sc_offset, 
+        cl_mem ss_buffer, 
+        long ss_offset)
+    {
+        begin(COMMAND_SROTG, 8);
+        putMem(sa_buffer, "sa_buffer");
+        putLong(sa_offset);
+        putMem(sb_buffer, "sb_buffer");
+        putLong(sb_offset);
+        putMem(sc_buffer, "sc_buffer");
+        putLong(sc_offset);
+        putMem(ss_buffer, "ss_buffer");
+        putLong(ss_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Drotg(
+        cl_mem sa_buffer, 
+        long sa_offset, 
+        cl_mem sb_buffer, 
+        long sb_offset, 
+        cl_mem sc_buffer, 
+        long sc_offset, 
+        cl_mem ss_buffer, 
+        long ss_offset)
+    {
+        begin(COMMAND_DROTG, 8);
+        putMem(sa_buffer, "sa_buffer");
+        putLong(sa_offset);
+        putMem(sb_buffer, "sb_buffer");
+        putLong(sb_offset);
+        putMem(sc_buffer, "sc_buffer");
+        putLong(sc_offset);
+        putMem(ss_buffer, "ss_buffer");
+        putLong(ss_offset);
+        end();
+        return this;
+    }
+
+    // Generate modified givens plane rotation: SROTMG/DROTMG
+    public CLBlastCommandList Srotmg(
+        cl_mem sd1_buffer, 
+        long sd1_offset, 
+        cl_mem sd2_buffer, 
+        long sd2_offset, 
+        cl_mem sx1_buffer, 
+        long sx1_offset, 
+        cl_mem sy1_buffer, 
+        long sy1_offset, 
+        cl_mem sparam_buffer, 
+        long sparam_offset)
+    {
+        begin(COMMAND_SROTMG, 10);
+        putMem(sd1_buffer, "sd1_buffer");
+        putLong(sd1_offset);
+        putMem(sd2_buffer, "sd2_buffer");
+        putLong(sd2_offset);
+        putMem(sx1_buffer, "sx1_buffer");
+        putLong(sx1_offset);
+        putMem(sy1_buffer, "sy1_buffer");
+        putLong(sy1_offset);
+        putMem(sparam_buffer, "sparam_buffer");
+        putLong(sparam_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Drotmg(
+        cl_mem sd1_buffer, 
+        long sd1_offset, 
+        cl_mem sd2_buffer, 
+        long sd2_offset, 
+        cl_mem sx1_buffer, 
+        long sx1_offset, 
+        cl_mem sy1_buffer, 
+        long sy1_offset, 
+        cl_mem sparam_buffer, 
+        long sparam_offset)
+    {
+        begin(COMMAND_DROTMG, 10);
+        putMem(sd1_buffer, "sd1_buffer");
+        putLong(sd1_offset);
+        putMem(sd2_buffer, "sd2_buffer");
+        putLong(sd2_offset);
+        putMem(sx1_buffer, "sx1_buffer");
+        putLong(sx1_offset);
+        putMem(sy1_buffer, "sy1_buffer");
+        putLong(sy1_offset);
+        putMem(sparam_buffer, "sparam_buffer");
+        putLong(sparam_offset);
+        end();
+        return this;
+    }
+
+    // Apply givens plane rotation: SROT/DROT
+    public CLBlastCommandList Srot(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float cos, 
+        float sin)
+    {
+        begin(COMMAND_SROT, 9);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putFloat(cos);
+        putFloat(sin);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Drot(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double cos, 
+        double sin)
+    {
+        begin(COMMAND_DROT, 9);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putDouble(cos);
+        putDouble(sin);
+        end();
+        return this;
+    }
+
+    // Apply modified givens plane rotation: SROTM/DROTM
+    public CLBlastCommandList Srotm(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem sparam_buffer, 
+        long sparam_offset)
+    {
+        begin(COMMAND_SROTM, 9);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(sparam_buffer, "sparam_buffer");
+        putLong(sparam_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Drotm(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem sparam_buffer, 
+        long sparam_offset)
+    {
+        begin(COMMAND_DROTM, 9);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(sparam_buffer, "sparam_buffer");
+        putLong(sparam_offset);
+        end();
+        return this;
+    }
+
+    // Swap two vectors: SSWAP/DSWAP/CSWAP/ZSWAP/HSWAP
+    public CLBlastCommandList Sswap(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_SSWAP, 7);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dswap(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_DSWAP, 7);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Cswap(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_CSWAP, 7);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zswap(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_ZSWAP, 7);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hswap(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_HSWAP, 7);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Vector scaling: SSCAL/DSCAL/CSCAL/ZSCAL/HSCAL
+    public CLBlastCommandList Sscal(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_SSCAL, 5);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dscal(
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DSCAL, 5);
+        putLong(n);
+        putDouble(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Cscal(
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_CSCAL, 6);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zscal(
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ZSCAL, 6);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hscal(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_HSCAL, 5);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Vector copy: SCOPY/DCOPY/CCOPY/ZCOPY/HCOPY
+    public CLBlastCommandList Scopy(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_SCOPY, 7);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dcopy(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_DCOPY, 7);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ccopy(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_CCOPY, 7);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zcopy(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_ZCOPY, 7);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hcopy(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_HCOPY, 7);
+        putLong(n);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Vector-times-constant plus vector: SAXPY/DAXPY/CAXPY/ZAXPY/HAXPY
+    public CLBlastCommandList Saxpy(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_SAXPY, 8);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Daxpy(
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_DAXPY, 8);
+        putLong(n);
+        putDouble(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Caxpy(
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_CAXPY, 9);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zaxpy(
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_ZAXPY, 9);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Haxpy(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_HAXPY, 8);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Dot product of two vectors: SDOT/DDOT/HDOT
+    public CLBlastCommandList Sdot(
+        long n, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_SDOT, 9);
+        putLong(n);
+        putMem(dot_buffer, "dot_buffer");
+        putLong(dot_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ddot(
+        long n, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_DDOT, 9);
+        putLong(n);
+        putMem(dot_buffer, "dot_buffer");
+        putLong(dot_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hdot(
+        long n, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_HDOT, 9);
+        putLong(n);
+        putMem(dot_buffer, "dot_buffer");
+        putLong(dot_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Dot product of two complex vectors: CDOTU/ZDOTU
+    public CLBlastCommandList Cdotu(
+        long n, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_CDOTU, 9);
+        putLong(n);
+        putMem(dot_buffer, "dot_buffer");
+        putLong(dot_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zdotu(
+        long n, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_ZDOTU, 9);
+        putLong(n);
+        putMem(dot_buffer, "dot_buffer");
+        putLong(dot_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Dot product of two complex vectors, one conjugated: CDOTC/ZDOTC
+    public CLBlastCommandList Cdotc(
+        long n, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_CDOTC, 9);
+        putLong(n);
+        putMem(dot_buffer, "dot_buffer");
+        putLong(dot_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zdotc(
+        long n, 
+        cl_mem dot_buffer, 
+        long dot_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_ZDOTC, 9);
+        putLong(n);
+        putMem(dot_buffer, "dot_buffer");
+        putLong(dot_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Euclidian norm of a vector: SNRM2/DNRM2/ScNRM2/DzNRM2/HNRM2
+    public CLBlastCommandList Snrm2(
+        long n, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_SNRM2, 6);
+        putLong(n);
+        putMem(nrm2_buffer, "nrm2_buffer");
+        putLong(nrm2_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dnrm2(
+        long n, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DNRM2, 6);
+        putLong(n);
+        putMem(nrm2_buffer, "nrm2_buffer");
+        putLong(nrm2_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Scnrm2(
+        long n, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_SCNRM2, 6);
+        putLong(n);
+        putMem(nrm2_buffer, "nrm2_buffer");
+        putLong(nrm2_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dznrm2(
+        long n, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DZNRM2, 6);
+        putLong(n);
+        putMem(nrm2_buffer, "nrm2_buffer");
+        putLong(nrm2_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hnrm2(
+        long n, 
+        cl_mem nrm2_buffer, 
+        long nrm2_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_HNRM2, 6);
+        putLong(n);
+        putMem(nrm2_buffer, "nrm2_buffer");
+        putLong(nrm2_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Absolute sum of values in a vector: SASUM/DASUM/ScASUM/DzASUM/HASUM
+    public CLBlastCommandList Sasum(
+        long n, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_SASUM, 6);
+        putLong(n);
+        putMem(asum_buffer, "asum_buffer");
+        putLong(asum_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dasum(
+        long n, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DASUM, 6);
+        putLong(n);
+        putMem(asum_buffer, "asum_buffer");
+        putLong(asum_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Scasum(
+        long n, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_SCASUM, 6);
+        putLong(n);
+        putMem(asum_buffer, "asum_buffer");
+        putLong(asum_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dzasum(
+        long n, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DZASUM, 6);
+        putLong(n);
+        putMem(asum_buffer, "asum_buffer");
+        putLong(asum_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hasum(
+        long n, 
+        cl_mem asum_buffer, 
+        long asum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_HASUM, 6);
+        putLong(n);
+        putMem(asum_buffer, "asum_buffer");
+        putLong(asum_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Sum of values in a vector (non-BLAS function): SSUM/DSUM/ScSUM/DzSUM/HSUM
+    public CLBlastCommandList Ssum(
+        long n, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_SSUM, 6);
+        putLong(n);
+        putMem(sum_buffer, "sum_buffer");
+        putLong(sum_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dsum(
+        long n, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DSUM, 6);
+        putLong(n);
+        putMem(sum_buffer, "sum_buffer");
+        putLong(sum_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Scsum(
+        long n, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_SCSUM, 6);
+        putLong(n);
+        putMem(sum_buffer, "sum_buffer");
+        putLong(sum_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dzsum(
+        long n, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DZSUM, 6);
+        putLong(n);
+        putMem(sum_buffer, "sum_buffer");
+        putLong(sum_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hsum(
+        long n, 
+        cl_mem sum_buffer, 
+        long sum_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_HSUM, 6);
+        putLong(n);
+        putMem(sum_buffer, "sum_buffer");
+        putLong(sum_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Index of absolute maximum value in a vector: iSAMAX/iDAMAX/iCAMAX/iZAMAX/iHAMAX
+    public CLBlastCommandList iSamax(
+        long n, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ISAMAX, 6);
+        putLong(n);
+        putMem(imax_buffer, "imax_buffer");
+        putLong(imax_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iDamax(
+        long n, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IDAMAX, 6);
+        putLong(n);
+        putMem(imax_buffer, "imax_buffer");
+        putLong(imax_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iCamax(
+        long n, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ICAMAX, 6);
+        putLong(n);
+        putMem(imax_buffer, "imax_buffer");
+        putLong(imax_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iZamax(
+        long n, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IZAMAX, 6);
+        putLong(n);
+        putMem(imax_buffer, "imax_buffer");
+        putLong(imax_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iHamax(
+        long n, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IHAMAX, 6);
+        putLong(n);
+        putMem(imax_buffer, "imax_buffer");
+        putLong(imax_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Index of absolute minimum value in a vector (non-BLAS function): iSAMIN/iDAMIN/iCAMIN/iZAMIN/iHAMIN
+    public CLBlastCommandList iSamin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ISAMIN, 6);
+        putLong(n);
+        putMem(imin_buffer, "imin_buffer");
+        putLong(imin_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iDamin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IDAMIN, 6);
+        putLong(n);
+        putMem(imin_buffer, "imin_buffer");
+        putLong(imin_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iCamin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ICAMIN, 6);
+        putLong(n);
+        putMem(imin_buffer, "imin_buffer");
+        putLong(imin_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iZamin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IZAMIN, 6);
+        putLong(n);
+        putMem(imin_buffer, "imin_buffer");
+        putLong(imin_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iHamin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IHAMIN, 6);
+        putLong(n);
+        putMem(imin_buffer, "imin_buffer");
+        putLong(imin_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Index of maximum value in a vector (non-BLAS function): iSMAX/iDMAX/iCMAX/iZMAX/iHMAX
+    public CLBlastCommandList iSmax(
+        long n, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ISMAX, 6);
+        putLong(n);
+        putMem(imax_buffer, "imax_buffer");
+        putLong(imax_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iDmax(
+        long n, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IDMAX, 6);
+        putLong(n);
+        putMem(imax_buffer, "imax_buffer");
+        putLong(imax_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iCmax(
+        long n, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ICMAX, 6);
+        putLong(n);
+        putMem(imax_buffer, "imax_buffer");
+        putLong(imax_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iZmax(
+        long n, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IZMAX, 6);
+        putLong(n);
+        putMem(imax_buffer, "imax_buffer");
+        putLong(imax_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iHmax(
+        long n, 
+        cl_mem imax_buffer, 
+        long imax_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IHMAX, 6);
+        putLong(n);
+        putMem(imax_buffer, "imax_buffer");
+        putLong(imax_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Index of minimum value in a vector (non-BLAS function): iSMIN/iDMIN/iCMIN/iZMIN/iHMIN
+    public CLBlastCommandList iSmin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ISMIN, 6);
+        putLong(n);
+        putMem(imin_buffer, "imin_buffer");
+        putLong(imin_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iDmin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IDMIN, 6);
+        putLong(n);
+        putMem(imin_buffer, "imin_buffer");
+        putLong(imin_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iCmin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ICMIN, 6);
+        putLong(n);
+        putMem(imin_buffer, "imin_buffer");
+        putLong(imin_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iZmin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IZMIN, 6);
+        putLong(n);
+        putMem(imin_buffer, "imin_buffer");
+        putLong(imin_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList iHmin(
+        long n, 
+        cl_mem imin_buffer, 
+        long imin_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_IHMIN, 6);
+        putLong(n);
+        putMem(imin_buffer, "imin_buffer");
+        putLong(imin_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // General matrix-vector multiplication: SGEMV/DGEMV/CGEMV/ZGEMV/HGEMV
+    public CLBlastCommandList Sgemv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_SGEMV, 15);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dgemv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_DGEMV, 15);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putDouble(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Cgemv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_CGEMV, 17);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zgemv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_ZGEMV, 17);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hgemv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_HGEMV, 15);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // General banded matrix-vector multiplication: SGBMV/DGBMV/CGBMV/ZGBMV/HGBMV
+    public CLBlastCommandList Sgbmv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        long kl, 
+        long ku, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_SGBMV, 17);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(kl);
+        putLong(ku);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dgbmv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        long kl, 
+        long ku, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_DGBMV, 17);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(kl);
+        putLong(ku);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putDouble(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Cgbmv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        long kl, 
+        long ku, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_CGBMV, 19);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(kl);
+        putLong(ku);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zgbmv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        long kl, 
+        long ku, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_ZGBMV, 19);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(kl);
+        putLong(ku);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hgbmv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        long kl, 
+        long ku, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_HGBMV, 17);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(kl);
+        putLong(ku);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Hermitian matrix-vector multiplication: CHEMV/ZHEMV
+    public CLBlastCommandList Chemv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_CHEMV, 16);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zhemv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_ZHEMV, 16);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Hermitian banded matrix-vector multiplication: CHBMV/ZHBMV
+    public CLBlastCommandList Chbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_CHBMV, 17);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zhbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_ZHBMV, 17);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Hermitian packed matrix-vector multiplication: CHPMV/ZHPMV
+    public CLBlastCommandList Chpmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_CHPMV, 15);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zhpmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double[] beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_ZHPMV, 15);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Symmetric matrix-vector multiplication: SSYMV/DSYMV/HSYMV
+    public CLBlastCommandList Ssymv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_SSYMV, 14);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dsymv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_DSYMV, 14);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putDouble(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hsymv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_HSYMV, 14);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Symmetric banded matrix-vector multiplication: SSBMV/DSBMV/HSBMV
+    public CLBlastCommandList Ssbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_SSBMV, 15);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dsbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_DSBMV, 15);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putDouble(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hsbmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_HSBMV, 15);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Symmetric packed matrix-vector multiplication: SSPMV/DSPMV/HSPMV
+    public CLBlastCommandList Sspmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_SSPMV, 13);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dspmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_DSPMV, 13);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putDouble(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hspmv(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc)
+    {
+        begin(COMMAND_HSPMV, 13);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putFloat(beta);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        end();
+        return this;
+    }
+
+    // Triangular matrix-vector multiplication: STRMV/DTRMV/CTRMV/ZTRMV/HTRMV
+    public CLBlastCommandList Strmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_STRMV, 11);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dtrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DTRMV, 11);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ctrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_CTRMV, 11);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ztrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ZTRMV, 11);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Htrmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_HTRMV, 11);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Triangular banded matrix-vector multiplication: STBMV/DTBMV/CTBMV/ZTBMV/HTBMV
+    public CLBlastCommandList Stbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_STBMV, 12);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putLong(k);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dtbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DTBMV, 12);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putLong(k);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ctbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_CTBMV, 12);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putLong(k);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ztbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ZTBMV, 12);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putLong(k);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Htbmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_HTBMV, 12);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putLong(k);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Triangular packed matrix-vector multiplication: STPMV/DTPMV/CTPMV/ZTPMV/HTPMV
+    public CLBlastCommandList Stpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_STPMV, 10);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dtpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DTPMV, 10);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ctpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_CTPMV, 10);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ztpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ZTPMV, 10);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Htpmv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_HTPMV, 10);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Solves a triangular system of equations: STRSV/DTRSV/CTRSV/ZTRSV
+    public CLBlastCommandList Strsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_STRSV, 11);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dtrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DTRSV, 11);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ctrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_CTRSV, 11);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ztrsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ZTRSV, 11);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Solves a banded triangular system of equations: STBSV/DTBSV/CTBSV/ZTBSV
+    public CLBlastCommandList Stbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_STBSV, 12);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putLong(k);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dtbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DTBSV, 12);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putLong(k);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ctbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_CTBSV, 12);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putLong(k);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ztbsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        long k, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ZTBSV, 12);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putLong(k);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // Solves a packed triangular system of equations: STPSV/DTPSV/CTPSV/ZTPSV
+    public CLBlastCommandList Stpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_STPSV, 10);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dtpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_DTPSV, 10);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ctpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_CTPSV, 10);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ztpsv(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long n, 
+        cl_mem ap_buffer, 
+        long ap_offset, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc)
+    {
+        begin(COMMAND_ZTPSV, 10);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(n);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        end();
+        return this;
+    }
+
+    // General rank-1 matrix update: SGER/DGER/HGER
+    public CLBlastCommandList Sger(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_SGER, 13);
+        putInt(layout);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dger(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_DGER, 13);
+        putInt(layout);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hger(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_HGER, 13);
+        putInt(layout);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    // General rank-1 complex matrix update: CGERU/ZGERU
+    public CLBlastCommandList Cgeru(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_CGERU, 14);
+        putInt(layout);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zgeru(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_ZGERU, 14);
+        putInt(layout);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    // General rank-1 complex conjugated matrix update: CGERC/ZGERC
+    public CLBlastCommandList Cgerc(
+        int layout, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_CGERC, 14);
+        putInt(layout);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zgerc(
+        int layout, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_ZGERC, 14);
+        putInt(layout);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    // Hermitian rank-1 matrix update: CHER/ZHER
+    public CLBlastCommandList Cher(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_CHER, 10);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zher(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_ZHER, 10);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    // Hermitian packed rank-1 matrix update: CHPR/ZHPR
+    public CLBlastCommandList Chpr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset)
+    {
+        begin(COMMAND_CHPR, 9);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zhpr(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset)
+    {
+        begin(COMMAND_ZHPR, 9);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        end();
+        return this;
+    }
+
+    // Hermitian rank-2 matrix update: CHER2/ZHER2
+    public CLBlastCommandList Cher2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_CHER2, 14);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zher2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_ZHER2, 14);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    // Hermitian packed rank-2 matrix update: CHPR2/ZHPR2
+    public CLBlastCommandList Chpr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset)
+    {
+        begin(COMMAND_CHPR2, 13);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zhpr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset)
+    {
+        begin(COMMAND_ZHPR2, 13);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        end();
+        return this;
+    }
+
+    // Symmetric rank-1 matrix update: SSYR/DSYR/HSYR
+    public CLBlastCommandList Ssyr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_SSYR, 10);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dsyr(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_DSYR, 10);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hsyr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_HSYR, 10);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    // Symmetric packed rank-1 matrix update: SSPR/DSPR/HSPR
+    public CLBlastCommandList Sspr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset)
+    {
+        begin(COMMAND_SSPR, 9);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dspr(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset)
+    {
+        begin(COMMAND_DSPR, 9);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hspr(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset)
+    {
+        begin(COMMAND_HSPR, 9);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        end();
+        return this;
+    }
+
+    // Symmetric rank-2 matrix update: SSYR2/DSYR2/HSYR2
+    public CLBlastCommandList Ssyr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_SSYR2, 13);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dsyr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_DSYR2, 13);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hsyr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld)
+    {
+        begin(COMMAND_HSYR2, 13);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        end();
+        return this;
+    }
+
+    // Symmetric packed rank-2 matrix update: SSPR2/DSPR2/HSPR2
+    public CLBlastCommandList Sspr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset)
+    {
+        begin(COMMAND_SSPR2, 12);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dspr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset)
+    {
+        begin(COMMAND_DSPR2, 12);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putDouble(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hspr2(
+        int layout, 
+        int triangle, 
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_mem ap_buffer, 
+        long ap_offset)
+    {
+        begin(COMMAND_HSPR2, 12);
+        putInt(layout);
+        putInt(triangle);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putMem(ap_buffer, "ap_buffer");
+        putLong(ap_offset);
+        end();
+        return this;
+    }
+
+    // General matrix-matrix multiplication: SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+    public CLBlastCommandList Sgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_SGEMM, 17);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_DGEMM, 17);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putDouble(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Cgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_CGEMM, 19);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_ZGEMM, 19);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_HGEMM, 17);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    // Symmetric matrix-matrix multiplication: SSYMM/DSYMM/CSYMM/ZSYMM/HSYMM
+    public CLBlastCommandList Ssymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_SSYMM, 16);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_DSYMM, 16);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putDouble(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Csymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_CSYMM, 18);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_ZSYMM, 18);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hsymm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_HSYMM, 16);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    // Hermitian matrix-matrix multiplication: CHEMM/ZHEMM
+    public CLBlastCommandList Chemm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_CHEMM, 18);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zhemm(
+        int layout, 
+        int side, 
+        int triangle, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_ZHEMM, 18);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    // Rank-K update of a symmetric matrix: SSYRK/DSYRK/CSYRK/ZSYRK/HSYRK
+    public CLBlastCommandList Ssyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_SSYRK, 13);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_DSYRK, 13);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putDouble(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Csyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_CSYRK, 15);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_ZSYRK, 15);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hsyrk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_HSYRK, 13);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    // Rank-K update of a hermitian matrix: CHERK/ZHERK
+    public CLBlastCommandList Cherk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_CHERK, 13);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zherk(
+        int layout, 
+        int triangle, 
+        int a_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_ZHERK, 13);
+        putInt(layout);
+        putInt(triangle);
+        putInt(a_transpose);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putDouble(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    // Rank-2K update of a symmetric matrix: SSYR2K/DSYR2K/CSYR2K/ZSYR2K/HSYR2K
+    public CLBlastCommandList Ssyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_SSYR2K, 16);
+        putInt(layout);
+        putInt(triangle);
+        putInt(ab_transpose);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_DSYR2K, 16);
+        putInt(layout);
+        putInt(triangle);
+        putInt(ab_transpose);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putDouble(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Csyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_CSYR2K, 18);
+        putInt(layout);
+        putInt(triangle);
+        putInt(ab_transpose);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_ZSYR2K, 18);
+        putInt(layout);
+        putInt(triangle);
+        putInt(ab_transpose);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hsyr2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_HSYR2K, 16);
+        putInt(layout);
+        putInt(triangle);
+        putInt(ab_transpose);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    // Rank-2K update of a hermitian matrix: CHER2K/ZHER2K
+    public CLBlastCommandList Cher2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_CHER2K, 17);
+        putInt(layout);
+        putInt(triangle);
+        putInt(ab_transpose);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zher2k(
+        int layout, 
+        int triangle, 
+        int ab_transpose, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld)
+    {
+        begin(COMMAND_ZHER2K, 17);
+        putInt(layout);
+        putInt(triangle);
+        putInt(ab_transpose);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putDouble(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        end();
+        return this;
+    }
+
+    // Triangular matrix-matrix multiplication: STRMM/DTRMM/CTRMM/ZTRMM/HTRMM
+    public CLBlastCommandList Strmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_STRMM, 14);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dtrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_DTRMM, 14);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ctrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_CTRMM, 15);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ztrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_ZTRMM, 15);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Htrmm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_HTRMM, 14);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    // Solves a triangular system of equations: STRSM/DTRSM/CTRSM/ZTRSM
+    public CLBlastCommandList Strsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_STRSM, 14);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dtrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_DTRSM, 14);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ctrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_CTRSM, 15);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ztrsm(
+        int layout, 
+        int side, 
+        int triangle, 
+        int a_transpose, 
+        int diagonal, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_ZTRSM, 15);
+        putInt(layout);
+        putInt(side);
+        putInt(triangle);
+        putInt(a_transpose);
+        putInt(diagonal);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    // Element-wise vector product (Hadamard): SHAD/DHAD/CHAD/ZHAD/HHAD
+    public CLBlastCommandList Shad(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc)
+    {
+        begin(COMMAND_SHAD, 12);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putFloat(beta);
+        putMem(z_buffer, "z_buffer");
+        putLong(z_offset);
+        putLong(z_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dhad(
+        long n, 
+        double alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc)
+    {
+        begin(COMMAND_DHAD, 12);
+        putLong(n);
+        putDouble(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putDouble(beta);
+        putMem(z_buffer, "z_buffer");
+        putLong(z_offset);
+        putLong(z_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Chad(
+        long n, 
+        float[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float[] beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc)
+    {
+        begin(COMMAND_CHAD, 14);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(z_buffer, "z_buffer");
+        putLong(z_offset);
+        putLong(z_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zhad(
+        long n, 
+        double[] alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double[] beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc)
+    {
+        begin(COMMAND_ZHAD, 14);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(z_buffer, "z_buffer");
+        putLong(z_offset);
+        putLong(z_inc);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hhad(
+        long n, 
+        float alpha, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta, 
+        cl_mem z_buffer, 
+        long z_offset, 
+        long z_inc)
+    {
+        begin(COMMAND_HHAD, 12);
+        putLong(n);
+        putFloat(alpha);
+        putMem(x_buffer, "x_buffer");
+        putLong(x_offset);
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putLong(y_offset);
+        putLong(y_inc);
+        putFloat(beta);
+        putMem(z_buffer, "z_buffer");
+        putLong(z_offset);
+        putLong(z_inc);
+        end();
+        return this;
+    }
+
+    // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY/COMATCOPY/ZOMATCOPY/HOMATCOPY
+    public CLBlastCommandList Somatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_SOMATCOPY, 11);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Domatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_DOMATCOPY, 11);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Comatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_COMATCOPY, 12);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zomatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_ZOMATCOPY, 12);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Homatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld)
+    {
+        begin(COMMAND_HOMATCOPY, 11);
+        putInt(layout);
+        putInt(a_transpose);
+        putLong(m);
+        putLong(n);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        end();
+        return this;
+    }
+
+    // Im2col function (non-BLAS function): SIM2COL/DIM2COL/CIM2COL/ZIM2COL/HIM2COL
+    public CLBlastCommandList Sim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset)
+    {
+        begin(COMMAND_SIM2COL, 16);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        putMem(col_buffer, "col_buffer");
+        putLong(col_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset)
+    {
+        begin(COMMAND_DIM2COL, 16);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        putMem(col_buffer, "col_buffer");
+        putLong(col_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Cim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset)
+    {
+        begin(COMMAND_CIM2COL, 16);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        putMem(col_buffer, "col_buffer");
+        putLong(col_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zim2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset)
+    {
+        begin(COMMAND_ZIM2COL, 16);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        putMem(col_buffer, "col_buffer");
+        putLong(col_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Him2col(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem col_buffer, 
+        long col_offset)
+    {
+        begin(COMMAND_HIM2COL, 16);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        putMem(col_buffer, "col_buffer");
+        putLong(col_offset);
+        end();
+        return this;
+    }
+
+    // Col2im function (non-BLAS function): SCOL2IM/DCOL2IM/CCOL2IM/ZCOL2IM/HCOL2IM
+    public CLBlastCommandList Scol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset)
+    {
+        begin(COMMAND_SCOL2IM, 16);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putMem(col_buffer, "col_buffer");
+        putLong(col_offset);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset)
+    {
+        begin(COMMAND_DCOL2IM, 16);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putMem(col_buffer, "col_buffer");
+        putLong(col_offset);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Ccol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset)
+    {
+        begin(COMMAND_CCOL2IM, 16);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putMem(col_buffer, "col_buffer");
+        putLong(col_offset);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Zcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset)
+    {
+        begin(COMMAND_ZCOL2IM, 16);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putMem(col_buffer, "col_buffer");
+        putLong(col_offset);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hcol2im(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        cl_mem col_buffer, 
+        long col_offset, 
+        cl_mem im_buffer, 
+        long im_offset)
+    {
+        begin(COMMAND_HCOL2IM, 16);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putMem(col_buffer, "col_buffer");
+        putLong(col_offset);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        end();
+        return this;
+    }
+
+    // Batched convolution as GEMM (non-BLAS function): SCONVGEMM/DCONVGEMM/HCONVGEMM
+    public CLBlastCommandList Sconvgemm(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset)
+    {
+        begin(COMMAND_SCONVGEMM, 20);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putLong(num_kernels);
+        putLong(batch_count);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        putMem(kernel_buffer, "kernel_buffer");
+        putLong(kernel_offset);
+        putMem(result_buffer, "result_buffer");
+        putLong(result_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Dconvgemm(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset)
+    {
+        begin(COMMAND_DCONVGEMM, 20);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putLong(num_kernels);
+        putLong(batch_count);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        putMem(kernel_buffer, "kernel_buffer");
+        putLong(kernel_offset);
+        putMem(result_buffer, "result_buffer");
+        putLong(result_offset);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList Hconvgemm(
+        int kernel_mode, 
+        long channels, 
+        long height, 
+        long width, 
+        long kernel_h, 
+        long kernel_w, 
+        long pad_h, 
+        long pad_w, 
+        long stride_h, 
+        long stride_w, 
+        long dilation_h, 
+        long dilation_w, 
+        long num_kernels, 
+        long batch_count, 
+        cl_mem im_buffer, 
+        long im_offset, 
+        cl_mem kernel_buffer, 
+        long kernel_offset, 
+        cl_mem result_buffer, 
+        long result_offset)
+    {
+        begin(COMMAND_HCONVGEMM, 20);
+        putInt(kernel_mode);
+        putLong(channels);
+        putLong(height);
+        putLong(width);
+        putLong(kernel_h);
+        putLong(kernel_w);
+        putLong(pad_h);
+        putLong(pad_w);
+        putLong(stride_h);
+        putLong(stride_w);
+        putLong(dilation_h);
+        putLong(dilation_w);
+        putLong(num_kernels);
+        putLong(batch_count);
+        putMem(im_buffer, "im_buffer");
+        putLong(im_offset);
+        putMem(kernel_buffer, "kernel_buffer");
+        putLong(kernel_offset);
+        putMem(result_buffer, "result_buffer");
+        putLong(result_offset);
+        end();
+        return this;
+    }
+
+    // Batched version of AXPY: SAXPYBATCHED/DAXPYBATCHED/CAXPYBATCHED/ZAXPYBATCHED/HAXPYBATCHED
+    public CLBlastCommandList SaxpyBatched(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count)
+    {
+        begin(COMMAND_SAXPYBATCHED, 9);
+        putLong(n);
+        putArray(alphas, "alphas");
+        putMem(x_buffer, "x_buffer");
+        putArray(x_offsets, "x_offsets");
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putArray(y_offsets, "y_offsets");
+        putLong(y_inc);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList DaxpyBatched(
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count)
+    {
+        begin(COMMAND_DAXPYBATCHED, 9);
+        putLong(n);
+        putArray(alphas, "alphas");
+        putMem(x_buffer, "x_buffer");
+        putArray(x_offsets, "x_offsets");
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putArray(y_offsets, "y_offsets");
+        putLong(y_inc);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList CaxpyBatched(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count)
+    {
+        begin(COMMAND_CAXPYBATCHED, 9);
+        putLong(n);
+        putArray(alphas, "alphas");
+        putMem(x_buffer, "x_buffer");
+        putArray(x_offsets, "x_offsets");
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putArray(y_offsets, "y_offsets");
+        putLong(y_inc);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList ZaxpyBatched(
+        long n, 
+        double[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count)
+    {
+        begin(COMMAND_ZAXPYBATCHED, 9);
+        putLong(n);
+        putArray(alphas, "alphas");
+        putMem(x_buffer, "x_buffer");
+        putArray(x_offsets, "x_offsets");
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putArray(y_offsets, "y_offsets");
+        putLong(y_inc);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList HaxpyBatched(
+        long n, 
+        float[] alphas, 
+        cl_mem x_buffer, 
+        long[] x_offsets, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long[] y_offsets, 
+        long y_inc, 
+        long batch_count)
+    {
+        begin(COMMAND_HAXPYBATCHED, 9);
+        putLong(n);
+        putArray(alphas, "alphas");
+        putMem(x_buffer, "x_buffer");
+        putArray(x_offsets, "x_offsets");
+        putLong(x_inc);
+        putMem(y_buffer, "y_buffer");
+        putArray(y_offsets, "y_offsets");
+        putLong(y_inc);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    // Batched version of GEMM: SGEMMBATCHED/DGEMMBATCHED/CGEMMBATCHED/ZGEMMBATCHED/HGEMMBATCHED
+    public CLBlastCommandList SgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count)
+    {
+        begin(COMMAND_SGEMMBATCHED, 18);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putArray(alphas, "alphas");
+        putMem(a_buffer, "a_buffer");
+        putArray(a_offsets, "a_offsets");
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putArray(b_offsets, "b_offsets");
+        putLong(b_ld);
+        putArray(betas, "betas");
+        putMem(c_buffer, "c_buffer");
+        putArray(c_offsets, "c_offsets");
+        putLong(c_ld);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList DgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        double[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count)
+    {
+        begin(COMMAND_DGEMMBATCHED, 18);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putArray(alphas, "alphas");
+        putMem(a_buffer, "a_buffer");
+        putArray(a_offsets, "a_offsets");
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putArray(b_offsets, "b_offsets");
+        putLong(b_ld);
+        putArray(betas, "betas");
+        putMem(c_buffer, "c_buffer");
+        putArray(c_offsets, "c_offsets");
+        putLong(c_ld);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList CgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count)
+    {
+        begin(COMMAND_CGEMMBATCHED, 18);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putArray(alphas, "alphas");
+        putMem(a_buffer, "a_buffer");
+        putArray(a_offsets, "a_offsets");
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putArray(b_offsets, "b_offsets");
+        putLong(b_ld);
+        putArray(betas, "betas");
+        putMem(c_buffer, "c_buffer");
+        putArray(c_offsets, "c_offsets");
+        putLong(c_ld);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList ZgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        double[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count)
+    {
+        begin(COMMAND_ZGEMMBATCHED, 18);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putArray(alphas, "alphas");
+        putMem(a_buffer, "a_buffer");
+        putArray(a_offsets, "a_offsets");
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putArray(b_offsets, "b_offsets");
+        putLong(b_ld);
+        putArray(betas, "betas");
+        putMem(c_buffer, "c_buffer");
+        putArray(c_offsets, "c_offsets");
+        putLong(c_ld);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList HgemmBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alphas, 
+        cl_mem a_buffer, 
+        long[] a_offsets, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long[] b_offsets, 
+        long b_ld, 
+        float[] betas, 
+        cl_mem c_buffer, 
+        long[] c_offsets, 
+        long c_ld, 
+        long batch_count)
+    {
+        begin(COMMAND_HGEMMBATCHED, 18);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putArray(alphas, "alphas");
+        putMem(a_buffer, "a_buffer");
+        putArray(a_offsets, "a_offsets");
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putArray(b_offsets, "b_offsets");
+        putLong(b_ld);
+        putArray(betas, "betas");
+        putMem(c_buffer, "c_buffer");
+        putArray(c_offsets, "c_offsets");
+        putLong(c_ld);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    // StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/CGEMMSTRIDEDBATCHED/ZGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
+    public CLBlastCommandList SgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count)
+    {
+        begin(COMMAND_SGEMMSTRIDEDBATCHED, 21);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putLong(a_stride);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putLong(b_stride);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        putLong(c_stride);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList DgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count)
+    {
+        begin(COMMAND_DGEMMSTRIDEDBATCHED, 21);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putLong(a_stride);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putLong(b_stride);
+        putDouble(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        putLong(c_stride);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList CgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count)
+    {
+        begin(COMMAND_CGEMMSTRIDEDBATCHED, 23);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putLong(a_stride);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putLong(b_stride);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        putLong(c_stride);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList ZgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count)
+    {
+        begin(COMMAND_ZGEMMSTRIDEDBATCHED, 23);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putLong(a_stride);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putLong(b_stride);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        putLong(c_stride);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList HgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count)
+    {
+        begin(COMMAND_HGEMMSTRIDEDBATCHED, 21);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putLong(a_stride);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putLong(b_stride);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        putLong(c_stride);
+        putLong(batch_count);
+        end();
+        return this;
+    }
+
+    // General matrix-matrix multiplication with temporary buffer from user (optional, for advanced users): SGEMM/DGEMM/CGEMM/ZGEMM/HGEMM
+    public CLBlastCommandList SgemmWithTempBuffer(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_mem temp_buffer)
+    {
+        begin(COMMAND_SGEMMWITHTEMPBUFFER, 18);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        putMem(temp_buffer, "temp_buffer");
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList DgemmWithTempBuffer(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_mem temp_buffer)
+    {
+        begin(COMMAND_DGEMMWITHTEMPBUFFER, 18);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putDouble(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        putMem(temp_buffer, "temp_buffer");
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList CgemmWithTempBuffer(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_mem temp_buffer)
+    {
+        begin(COMMAND_CGEMMWITHTEMPBUFFER, 20);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha[0]);
+        putFloat(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta[0]);
+        putFloat(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        putMem(temp_buffer, "temp_buffer");
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList ZgemmWithTempBuffer(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double[] alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double[] beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_mem temp_buffer)
+    {
+        begin(COMMAND_ZGEMMWITHTEMPBUFFER, 20);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putDouble(alpha[0]);
+        putDouble(alpha[1]);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putDouble(beta[0]);
+        putDouble(beta[1]);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        putMem(temp_buffer, "temp_buffer");
+        end();
+        return this;
+    }
+
+    public CLBlastCommandList HgemmWithTempBuffer(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        cl_mem a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        cl_mem b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        cl_mem c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        cl_mem temp_buffer)
+    {
+        begin(COMMAND_HGEMMWITHTEMPBUFFER, 18);
+        putInt(layout);
+        putInt(a_transpose);
+        putInt(b_transpose);
+        putLong(m);
+        putLong(n);
+        putLong(k);
+        putFloat(alpha);
+        putMem(a_buffer, "a_buffer");
+        putLong(a_offset);
+        putLong(a_ld);
+        putMem(b_buffer, "b_buffer");
+        putLong(b_offset);
+        putLong(b_ld);
+        putFloat(beta);
+        putMem(c_buffer, "c_buffer");
+        putLong(c_offset);
+        putLong(c_ld);
+        putMem(temp_buffer, "temp_buffer");
+        end();
+        return this;
+    }
+
+}
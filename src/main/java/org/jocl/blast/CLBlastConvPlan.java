@@ -0,0 +1,658 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_MEM_READ_WRITE;
+import static org.jocl.CL.CL_QUEUE_CONTEXT;
+import static org.jocl.CL.clCreateBuffer;
+import static org.jocl.CL.clFinish;
+import static org.jocl.CL.clGetCommandQueueInfo;
+import static org.jocl.CL.clReleaseMemObject;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import org.jocl.CLException;
+import org.jocl.Pointer;
+import org.jocl.Sizeof;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * A plan for a convolution with a fixed set of parameters, that selects
+ * the faster of the two ways of computing it.
+ * <p>
+ * The result of {@link CLBlast#CLBlastSconvgemm} can either be computed
+ * with the convgemm routine itself, or with one im2col and one GEMM for
+ * each image of the batch. Which of these is faster depends on the 
+ * number of channels, the kernel size, the stride and the batch count.
+ * When a plan is executed for the first time, both strategies are 
+ * measured with the given buffers, and the faster one is used for all 
+ * further executions. The plans are cached for each context, keyed by 
+ * the precision and all parameters of the convgemm routine, and the 
+ * im2col workspace buffer of a plan is kept alive across calls.
+ * <p>
+ * Example:
+ * <pre><code>
+ * CLBlastConvPlan plan = CLBlastConvPlan.get(queue, 
+ *     CLBlastPrecisionSingle, CLBlastKernelModeCrossCorrelation, 
+ *     channels, height, width, kernel_h, kernel_w, pad_h, pad_w, 
+ *     stride_h, stride_w, dilation_h, dilation_w, 
+ *     num_kernels, batch_count);
+ * plan.execute(im_buffer, 0, kernel_buffer, 0, result_buffer, 0, 
+ *     queue, null);
+ * ...
+ * CLBlastConvPlan.release(context);
+ * </code></pre>
+ * The first execution of a plan blocks until the measurement is 
+ * complete. The queues must be in-order queues, because the workspace 
+ * is reused between the images of a batch. Instances of this class are
+ * thread-safe, and executions of the same plan are serialized.
+ */
+public final class CLBlastConvPlan
+{
+    /**
+     * The strategy of a plan that was not executed yet
+     */
+    public static final int STRATEGY_UNDECIDED = 0;
+    
+    /**
+     * The strategy that uses the convgemm routine
+     */
+    public static final int STRATEGY_CONVGEMM = 1;
+    
+    /**
+     * The strategy that uses one im2col and one GEMM for each image
+     */
+    public static final int STRATEGY_IM2COL_GEMM = 2;
+    
+    /**
+     * The number of timed runs of each strategy in the measurement, 
+     * after one untimed run that compiles the kernels
+     */
+    private static final int MEASUREMENT_RUNS = 3;
+    
+    /**
+     * The plans, for each context, keyed by the native context handle, 
+     * and then by the precision and parameters of the plan
+     */
+    private static final Map<Long, Map<List<Long>, CLBlastConvPlan>> plans =
+        new HashMap<Long, Map<List<Long>, CLBlastConvPlan>>();
+    
+    /**
+     * The context of this plan
+     */
+    private final cl_context context;
+    
+    /**
+     * The {@link CLBlastPrecision}
+     */
+    private final int precision;
+    
+    /**
+     * The {@link CLBlastKernelMode}
+     */
+    private final int kernelMode;
+    
+    /**
+     * The convolution parameters, as they are passed to convgemm
+     */
+    private final long channels;
+    private final long height;
+    private final long width;
+    private final long kernelH;
+    private final long kernelW;
+    private final long padH;
+    private final long padW;
+    private final long strideH;
+    private final long strideW;
+    private final long dilationH;
+    private final long dilationW;
+    private final long numKernels;
+    private final long batchCount;
+    
+    /**
+     * The number of elements in one image, one column buffer and one 
+     * result, respectively
+     */
+    private final long imageSize;
+    private final long colSize;
+    private final long resultSize;
+    
+    /**
+     * The number of output pixels of one image
+     */
+    private final long numPatches;
+    
+    /**
+     * The number of elements of one patch
+     */
+    private final long patchSize;
+    
+    /**
+     * The selected strategy
+     */
+    private int strategy;
+    
+    /**
+     * The im2col workspace, or <code>null</code> if it was not created 
+     * yet
+     */
+    private cl_mem workspace;
+    
+    /**
+     * The queue on which the workspace was used last, or 
+     * <code>null</code>
+     */
+    private cl_command_queue workspaceQueue;
+    
+    /**
+     * Private constructor for a plan with the given parameters
+     * 
+     * @param context The context
+     * @param precision The {@link CLBlastPrecision}
+     * @param parameters The convgemm parameters, after the kernel mode 
+     */
+    private CLBlastConvPlan(cl_context context, int precision, 
+        int kernelMode, long parameters[])
+    {
+        this.context = context;
+        this.precision = precision;
+        this.kernelMode = kernelMode;
+        this.channels = parameters[0];
+        this.height = parameters[1];
+        this.width = parameters[2];
+        this.kernelH = parameters[3];
+        this.kernelW = parameters[4];
+        this.padH = parameters[5];
+        this.padW = parameters[6];
+        this.strideH = parameters[7];
+        this.strideW = parameters[8];
+        this.dilationH = parameters[9];
+        this.dilationW = parameters[10];
+        this.numKernels = parameters[11];
+        this.batchCount = parameters[12];
+        
+        long outputH = outputSize(height, kernelH, padH, strideH, dilationH);
+        long outputW = outputSize(width, kernelW, padW, strideW, dilationW);
+        this.numPatches = outputH * outputW;
+        this.patchSize = channels * kernelH * kernelW;
+        this.imageSize = channels * height * width;
+        this.colSize = patchSize * numPatches;
+        this.resultSize = numKernels * numPatches;
+        this.strategy = STRATEGY_UNDECIDED;
+    }
+    
+    /**
+     * Returns the plan for the given parameters, creating it if 
+     * necessary. The parameters correspond to those of the convgemm 
+     * routines.
+     *
+     * @param queue The command queue, used to determine the context
+     * @param precision The {@link CLBlastPrecision}. Only half, single
+     * and double precision are supported.
+     * @param kernel_mode The {@link CLBlastKernelMode}
+     * @param channels The number of channels
+     * @param height The image height
+     * @param width The image width
+     * @param kernel_h The kernel height
+     * @param kernel_w The kernel width
+     * @param pad_h The padding in y-direction
+     * @param pad_w The padding in x-direction
+     * @param stride_h The stride in y-direction
+     * @param stride_w The stride in x-direction
+     * @param dilation_h The dilation in y-direction
+     * @param dilation_w The dilation in x-direction
+     * @param num_kernels The number of kernels
+     * @param batch_count The number of images
+     * @return The plan
+     * @throws IllegalArgumentException If the precision is not supported,
+     * or the parameters do not describe a valid convolution
+     */
+    public static CLBlastConvPlan get(cl_command_queue queue, 
+        int precision, int kernel_mode, long channels, long height, 
+        long width, long kernel_h, long kernel_w, long pad_h, long pad_w, 
+        long stride_h, long stride_w, long dilation_h, long dilation_w, 
+        long num_kernels, long batch_count)
+    {
+        if (precision != CLBlastPrecision.CLBlastPrecisionHalf &&
+            precision != CLBlastPrecision.CLBlastPrecisionSingle &&
+            precision != CLBlastPrecision.CLBlastPrecisionDouble)
+        {
+            throw new IllegalArgumentException(
+                "Only half, single and double precision are supported, " +
+                "but the precision is " + precision);
+        }
+        long parameters[] = { channels, height, width, kernel_h, kernel_w, 
+            pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, 
+            num_kernels, batch_count };
+        if (outputSize(height, kernel_h, pad_h, stride_h, dilation_h) <= 0 ||
+            outputSize(width, kernel_w, pad_w, stride_w, dilation_w) <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The parameters do not describe a valid convolution: " + 
+                Arrays.toString(parameters));
+        }
+        List<Long> key = new ArrayList<Long>();
+        key.add((long)precision);
+        key.add((long)kernel_mode);
+        for (long parameter : parameters)
+        {
+            key.add(parameter);
+        }
+        cl_context context = getContext(queue);
+        Long contextKey = CLBlastFast.getHandle(context);
+        synchronized (plans)
+        {
+            Map<List<Long>, CLBlastConvPlan> contextPlans = 
+                plans.get(contextKey);
+            if (contextPlans == null)
+            {
+                contextPlans = new HashMap<List<Long>, CLBlastConvPlan>();
+                plans.put(contextKey, contextPlans);
+            }
+            CLBlastConvPlan plan = contextPlans.get(key);
+            if (plan == null)
+            {
+                plan = new CLBlastConvPlan(
+                    context, precision, kernel_mode, parameters);
+                contextPlans.put(key, plan);
+            }
+            return plan;
+        }
+    }
+    
+    /**
+     * Release the workspaces of all plans for the given context, and 
+     * remove these plans from the cache. This must be called before the
+     * context is released. Plans that have been obtained before must 
+     * not be used any more.
+     * 
+     * @param context The context
+     */
+    public static void release(cl_context context)
+    {
+        Map<List<Long>, CLBlastConvPlan> contextPlans = null;
+        synchronized (plans)
+        {
+            contextPlans = plans.remove(CLBlastFast.getHandle(context));
+        }
+        if (contextPlans == null)
+        {
+            return;
+        }
+        for (CLBlastConvPlan plan : contextPlans.values())
+        {
+            plan.releaseWorkspace();
+        }
+    }
+    
+    /**
+     * Returns the output size of a convolution in one dimension, as it
+     * is computed by CLBlast
+     * 
+     * @param size The input size
+     * @param kernelSize The kernel size
+     * @param pad The padding
+     * @param stride The stride
+     * @param dilation The dilation
+     * @return The output size
+     */
+    static long outputSize(
+        long size, long kernelSize, long pad, long stride, long dilation)
+    {
+        long padded = size + 2 * pad;
+        long extent = dilation * (kernelSize - 1) + 1;
+        if (stride <= 0 || padded < extent)
+        {
+            return 0;
+        }
+        return (padded - extent) / stride + 1;
+    }
+    
+    /**
+     * Returns the strategy that was selected for this plan. This is
+     * {@link #STRATEGY_UNDECIDED} until the plan was executed for the
+     * first time.
+     * 
+     * @return The strategy
+     */
+    public synchronized int getStrategy()
+    {
+        return strategy;
+    }
+    
+    /**
+     * Returns the size of the im2col workspace of this plan, in bytes. 
+     * The workspace is only allocated when the im2col strategy is used.
+     * 
+     * @return The workspace size
+     */
+    public long getWorkspaceSize()
+    {
+        return colSize * elementSize();
+    }
+    
+    /**
+     * Execute this plan with the given buffers. The buffers have the
+     * same layout as for the convgemm routines. When this is called for
+     * the first time, then both strategies are measured and the call
+     * blocks until the measurement is complete.
+     * 
+     * @param im_buffer The image buffer
+     * @param im_offset The image offset
+     * @param kernel_buffer The kernel buffer
+     * @param kernel_offset The kernel offset
+     * @param result_buffer The result buffer
+     * @param result_offset The result offset
+     * @param queue The command queue
+     * @param event The event of the last command. May be <code>null</code>.
+     * @return The CLBlast status code
+     */
+    public synchronized int execute(
+        cl_mem im_buffer, long im_offset, 
+        cl_mem kernel_buffer, long kernel_offset, 
+        cl_mem result_buffer, long result_offset, 
+        cl_command_queue queue, cl_event event)
+    {
+        if (strategy == STRATEGY_UNDECIDED)
+        {
+            long convgemmNs = measure(STRATEGY_CONVGEMM, im_buffer, im_offset,
+                kernel_buffer, kernel_offset, result_buffer, result_offset, 
+                queue);
+            long im2colNs = measure(STRATEGY_IM2COL_GEMM, im_buffer, 
+                im_offset, kernel_buffer, kernel_offset, result_buffer, 
+                result_offset, queue);
+            if (convgemmNs >= 0 && (im2colNs < 0 || convgemmNs <= im2colNs))
+            {
+                strategy = STRATEGY_CONVGEMM;
+                releaseWorkspace();
+            }
+            else
+            {
+                strategy = STRATEGY_IM2COL_GEMM;
+            }
+        }
+        return run(strategy, im_buffer, im_offset, kernel_buffer, 
+            kernel_offset, result_buffer, result_offset, queue, event);
+    }
+    
+    /**
+     * Measure the given strategy, and return the average duration of one
+     * run, in nanoseconds, or -1 if the strategy failed
+     * 
+     * @param strategy The strategy
+     * @param im_buffer The image buffer
+     * @param im_offset The image offset
+     * @param kernel_buffer The kernel buffer
+     * @param kernel_offset The kernel offset
+     * @param result_buffer The result buffer
+     * @param result_offset The result offset
+     * @param queue The command queue
+     * @return The duration
+     */
+    private long measure(int strategy, 
+        cl_mem im_buffer, long im_offset, 
+        cl_mem kernel_buffer, long kernel_offset, 
+        cl_mem result_buffer, long result_offset, 
+        cl_command_queue queue)
+    {
+        try
+        {
+            long before = 0;
+            for (int i = 0; i <= MEASUREMENT_RUNS; i++)
+            {
+                if (i == 1)
+                {
+                    before = System.nanoTime();
+                }
+                int status = run(strategy, im_buffer, im_offset, 
+                    kernel_buffer, kernel_offset, result_buffer, 
+                    result_offset, queue, null);
+                if (status != CLBlastStatusCode.CLBlastSuccess)
+                {
+                    clFinish(queue);
+                    return -1;
+                }
+                clFinish(queue);
+            }
+            return (System.nanoTime() - before) / MEASUREMENT_RUNS;
+        }
+        catch (CLException e)
+        {
+            clFinish(queue);
+            return -1;
+        }
+    }
+    
+    /**
+     * Run the given strategy
+     * 
+     * @param strategy The strategy
+     * @param im_buffer The image buffer
+     * @param im_offset The image offset
+     * @param kernel_buffer The kernel buffer
+     * @param kernel_offset The kernel offset
+     * @param result_buffer The result buffer
+     * @param result_offset The result offset
+     * @param queue The command queue
+     * @param event The event of the last command. May be <code>null</code>.
+     * @return The CLBlast status code
+     */
+    private int run(int strategy, 
+        cl_mem im_buffer, long im_offset, 
+        cl_mem kernel_buffer, long kernel_offset, 
+        cl_mem result_buffer, long result_offset, 
+        cl_command_queue queue, cl_event event)
+    {
+        if (strategy == STRATEGY_CONVGEMM)
+        {
+            if (precision == CLBlastPrecision.CLBlastPrecisionHalf)
+            {
+                return CLBlast.CLBlastHconvgemm(kernelMode, channels, 
+                    height, width, kernelH, kernelW, padH, padW, strideH, 
+                    strideW, dilationH, dilationW, numKernels, batchCount, 
+                    im_buffer, im_offset, kernel_buffer, kernel_offset, 
+                    result_buffer, result_offset, queue, event);
+            }
+            if (precision == CLBlastPrecision.CLBlastPrecisionSingle)
+            {
+                return CLBlast.CLBlastSconvgemm(kernelMode, channels, 
+                    height, width, kernelH, kernelW, padH, padW, strideH, 
+                    strideW, dilationH, dilationW, numKernels, batchCount, 
+                    im_buffer, im_offset, kernel_buffer, kernel_offset, 
+                    result_buffer, result_offset, queue, event);
+            }
+            return CLBlast.CLBlastDconvgemm(kernelMode, channels, 
+                height, width, kernelH, kernelW, padH, padW, strideH, 
+                strideW, dilationH, dilationW, numKernels, batchCount, 
+                im_buffer, im_offset, kernel_buffer, kernel_offset, 
+                result_buffer, result_offset, queue, event);
+        }
+        
+        cl_mem col = obtainWorkspace(queue);
+        for (long b = 0; b < batchCount; b++)
+        {
+            long imOffset = im_offset + b * imageSize;
+            long resultOffset = result_offset + b * resultSize;
+            cl_event gemmEvent = b == batchCount - 1 ? event : null;
+            int status = 0;
+            if (precision == CLBlastPrecision.CLBlastPrecisionHalf)
+            {
+                status = CLBlast.CLBlastHim2col(kernelMode, channels, 
+                    height, width, kernelH, kernelW, padH, padW, 
+                    strideH, strideW, dilationH, dilationW, 
+                    im_buffer, imOffset, col, 0, queue, null);
+            }
+            else if (precision == CLBlastPrecision.CLBlastPrecisionSingle)
+            {
+                status = CLBlast.CLBlastSim2col(kernelMode, channels, 
+                    height, width, kernelH, kernelW, padH, padW, 
+                    strideH, strideW, dilationH, dilationW, 
+                    im_buffer, imOffset, col, 0, queue, null);
+            }
+            else
+            {
+                status = CLBlast.CLBlastDim2col(kernelMode, channels, 
+                    height, width, kernelH, kernelW, padH, padW, 
+                    strideH, strideW, dilationH, dilationW, 
+                    im_buffer, imOffset, col, 0, queue, null);
+            }
+            if (status != CLBlastStatusCode.CLBlastSuccess)
+            {
+                return status;
+            }
+            
+            // The column buffer is a column-major (numPatches x patchSize)
+            // matrix, and the kernels are a column-major 
+            // (patchSize x numKernels) matrix. The result of one image 
+            // is a column-major (numPatches x numKernels) matrix.
+            if (precision == CLBlastPrecision.CLBlastPrecisionHalf)
+            {
+                status = CLBlast.CLBlastHgemm(
+                    CLBlastLayout.CLBlastLayoutColMajor, 
+                    CLBlastTranspose.CLBlastTransposeNo, 
+                    CLBlastTranspose.CLBlastTransposeNo, 
+                    numPatches, numKernels, patchSize, 1.0f, 
+                    col, 0, numPatches, 
+                    kernel_buffer, kernel_offset, patchSize, 0.0f, 
+                    result_buffer, resultOffset, numPatches, 
+                    queue, gemmEvent);
+            }
+            else if (precision == CLBlastPrecision.CLBlastPrecisionSingle)
+            {
+                status = CLBlast.CLBlastSgemm(
+                    CLBlastLayout.CLBlastLayoutColMajor, 
+                    CLBlastTranspose.CLBlastTransposeNo, 
+                    CLBlastTranspose.CLBlastTransposeNo, 
+                    numPatches, numKernels, patchSize, 1.0f, 
+                    col, 0, numPatches, 
+                    kernel_buffer, kernel_offset, patchSize, 0.0f, 
+                    result_buffer, resultOffset, numPatches, 
+                    queue, gemmEvent);
+            }
+            else
+            {
+                status = CLBlast.CLBlastDgemm(
+                    CLBlastLayout.CLBlastLayoutColMajor, 
+                    CLBlastTranspose.CLBlastTransposeNo, 
+                    CLBlastTranspose.CLBlastTransposeNo, 
+                    numPatches, numKernels, patchSize, 1.0, 
+                    col, 0, numPatches, 
+                    kernel_buffer, kernel_offset, patchSize, 0.0, 
+                    result_buffer, resultOffset, numPatches, 
+                    queue, gemmEvent);
+            }
+            if (status != CLBlastStatusCode.CLBlastSuccess)
+            {
+                return status;
+            }
+        }
+        return CLBlastStatusCode.CLBlastSuccess;
+    }
+    
+    /**
+     * Returns the workspace, creating it if necessary. If the workspace
+     * was last used on a different queue, then that queue is finished,
+     * so that the workspace is not used concurrently.
+     * 
+     * @param queue The queue on which the workspace will be used
+     * @return The workspace
+     * @throws CLException If the workspace cannot be created
+     */
+    private cl_mem obtainWorkspace(cl_command_queue queue)
+    {
+        if (workspace == null)
+        {
+            int errorCode[] = new int[1];
+            cl_mem mem = clCreateBuffer(context, CL_MEM_READ_WRITE, 
+                Math.max(1, getWorkspaceSize()), null, errorCode);
+            CLBlastTiledGemm.check(errorCode[0], "clCreateBuffer");
+            workspace = mem;
+        }
+        else if (workspaceQueue != null && 
+            CLBlastFast.getHandle(workspaceQueue) != 
+            CLBlastFast.getHandle(queue))
+        {
+            clFinish(workspaceQueue);
+        }
+        workspaceQueue = queue;
+        return workspace;
+    }
+    
+    /**
+     * Release the workspace, if it was created
+     */
+    private synchronized void releaseWorkspace()
+    {
+        if (workspace != null)
+        {
+            clFinish(workspaceQueue);
+            clReleaseMemObject(workspace);
+            workspace = null;
+            workspaceQueue = null;
+        }
+    }
+    
+    /**
+     * Returns the size of one element, in bytes
+     * 
+     * @return The element size
+     */
+    private int elementSize()
+    {
+        if (precision == CLBlastPrecision.CLBlastPrecisionHalf)
+        {
+            return 2;
+        }
+        if (precision == CLBlastPrecision.CLBlastPrecisionSingle)
+        {
+            return Sizeof.cl_float;
+        }
+        return Sizeof.cl_double;
+    }
+    
+    /**
+     * Returns the context of the given queue
+     * 
+     * @param queue The queue
+     * @return The context
+     */
+    private static cl_context getContext(cl_command_queue queue)
+    {
+        cl_context context = new cl_context();
+        CLBlastTiledGemm.check(clGetCommandQueueInfo(queue, CL_QUEUE_CONTEXT, 
+            Sizeof.cl_context, Pointer.to(context), null), 
+            "clGetCommandQueueInfo");
+        return context;
+    }
+}
@@ -0,0 +1,258 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import java.util.Arrays;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * A prebound convgemm: A convolution with fixed dimensions and buffers, 
+ * for calls that are repeated many times with the same parameters.
+ * <p>
+ * All parameters are validated once when the plan is created, and an 
+ * execution only passes the plan handle, the offsets, and the queue and
+ * event to the native library. The executions are not logged, and not 
+ * recorded in the statistics, the profile or the call trace. The plan 
+ * retains its buffers until it is released.
+ * <p>
+ * In contrast to a {@link CLBlastConvPlan}, which selects the fastest 
+ * strategy for a convolution and is executed with arbitrary buffers,
+ * this plan always uses the convgemm routine, and is bound to its 
+ * buffers.
+ */
+public final class CLBlastConvgemmPlan
+{
+    // Initialization of the native library
+    static
+    {
+        CLBlast.initialize();
+    }
+
+    /**
+     * The handle of the native plan
+     */
+    private long handle;
+
+    /**
+     * Whether this plan was released
+     */
+    private boolean released;
+
+    /**
+     * The {@link CLBlastPrecision}
+     */
+    private final int precision;
+
+    /**
+     * The offsets that are used by default
+     */
+    private final long im_offset;
+    private final long kernel_offset;
+    private final long result_offset;
+
+    /**
+     * Creates a new plan
+     *
+     * @param handle The native handle
+     * @param precision The precision
+     * @param im_offset The image offset
+     * @param kernel_offset The kernel offset
+     * @param result_offset The result offset
+     */
+    private CLBlastConvgemmPlan(long handle, int precision, 
+        long im_offset, long kernel_offset, long result_offset)
+    {
+        this.handle = handle;
+        this.precision = precision;
+        this.im_offset = im_offset;
+        this.kernel_offset = kernel_offset;
+        this.result_offset = result_offset;
+    }
+
+    /**
+     * Create a new plan for a convgemm with the given parameters. The 
+     * buffers have the same layout as for the convgemm routines.
+     *
+     * @param precision The {@link CLBlastPrecision}
+     * @param kernel_mode The {@link CLBlastKernelMode}
+     * @param channels The number of channels
+     * @param height The image height
+     * @param width The image width
+     * @param kernel_h The kernel height
+     * @param kernel_w The kernel width
+     * @param pad_h The padding in y-direction
+     * @param pad_w The padding in x-direction
+     * @param stride_h The stride in y-direction
+     * @param stride_w The stride in x-direction
+     * @param dilation_h The dilation in y-direction
+     * @param dilation_w The dilation in x-direction
+     * @param num_kernels The number of kernels
+     * @param batch_count The number of images
+     * @param im_buffer The image buffer
+     * @param im_offset The image offset
+     * @param kernel_buffer The kernel buffer
+     * @param kernel_offset The kernel offset
+     * @param result_buffer The result buffer
+     * @param result_offset The result offset
+     * @return The plan
+     * @throws NullPointerException If a buffer is <code>null</code>
+     * @throws IllegalArgumentException If the precision is not supported,
+     * an offset is negative, or the parameters do not describe a valid 
+     * convolution
+     */
+    public static CLBlastConvgemmPlan create(int precision, 
+        int kernel_mode, long channels, long height, long width, 
+        long kernel_h, long kernel_w, long pad_h, long pad_w, 
+        long stride_h, long stride_w, long dilation_h, long dilation_w, 
+        long num_kernels, long batch_count, 
+        cl_mem im_buffer, long im_offset, 
+        cl_mem kernel_buffer, long kernel_offset, 
+        cl_mem result_buffer, long result_offset)
+    {
+        CLBlastGemmPlan.checkPrecision(precision, false);
+        if (kernel_mode != CLBlastKernelMode.CLBlastKernelModeCrossCorrelation &&
+            kernel_mode != CLBlastKernelMode.CLBlastKernelModeConvolution)
+        {
+            throw new IllegalArgumentException("Invalid kernel mode: " + 
+                CLBlastKernelMode.stringFor(kernel_mode));
+        }
+        long parameters[] = { channels, height, width, kernel_h, kernel_w, 
+            pad_h, pad_w, stride_h, stride_w, dilation_h, dilation_w, 
+            num_kernels, batch_count };
+        if (CLBlastConvPlan.outputSize(
+                height, kernel_h, pad_h, stride_h, dilation_h) <= 0 ||
+            CLBlastConvPlan.outputSize(
+                width, kernel_w, pad_w, stride_w, dilation_w) <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The parameters do not describe a valid convolution: " + 
+                Arrays.toString(parameters));
+        }
+        CLBlastGemmPlan.checkNotNull(im_buffer, "im_buffer");
+        CLBlastGemmPlan.checkNotNull(kernel_buffer, "kernel_buffer");
+        CLBlastGemmPlan.checkNotNull(result_buffer, "result_buffer");
+        CLBlastGemmPlan.checkNonNegative(im_offset, "im_offset");
+        CLBlastGemmPlan.checkNonNegative(kernel_offset, "kernel_offset");
+        CLBlastGemmPlan.checkNonNegative(result_offset, "result_offset");
+
+        long handle = createNative(precision, kernel_mode, channels, 
+            height, width, kernel_h, kernel_w, pad_h, pad_w, 
+            stride_h, stride_w, dilation_h, dilation_w, 
+            num_kernels, batch_count, 
+            im_buffer, kernel_buffer, result_buffer);
+        return new CLBlastConvgemmPlan(handle, precision, 
+            im_offset, kernel_offset, result_offset);
+    }
+    private static native long createNative(int precision, 
+        int kernel_mode, long channels, long height, long width, 
+        long kernel_h, long kernel_w, long pad_h, long pad_w, 
+        long stride_h, long stride_w, long dilation_h, long dilation_w, 
+        long num_kernels, long batch_count, 
+        cl_mem im_buffer, cl_mem kernel_buffer, cl_mem result_buffer);
+
+    /**
+     * Returns the {@link CLBlastPrecision} of this plan
+     *
+     * @return The precision
+     */
+    public int getPrecision()
+    {
+        return precision;
+    }
+
+    /**
+     * Execute this plan with the offsets that have been given when it 
+     * was created
+     *
+     * @param queue The queue
+     * @param event The event, may be <code>null</code>
+     * @return The {@link CLBlastStatusCode}
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was already released
+     */
+    public int execute(cl_command_queue queue, cl_event event)
+    {
+        return execute(im_offset, kernel_offset, result_offset, 
+            queue, event);
+    }
+
+    /**
+     * Execute this plan with the given offsets
+     *
+     * @param im_offset The image offset
+     * @param kernel_offset The kernel offset
+     * @param result_offset The result offset
+     * @param queue The queue
+     * @param event The event, may be <code>null</code>
+     * @return The {@link CLBlastStatusCode}
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was already released
+     */
+    public synchronized int execute(long im_offset, long kernel_offset, 
+        long result_offset, cl_command_queue queue, cl_event event)
+    {
+        CLBlastGemmPlan.checkExecute(released, queue);
+        return CLBlast.checkResult(executeNative(handle, 
+            im_offset, kernel_offset, result_offset, queue, event));
+    }
+    private static native int executeNative(long handle, 
+        long im_offset, long kernel_offset, long result_offset, 
+        cl_command_queue queue, cl_event event);
+
+    /**
+     * Release this plan and the buffers that it retains. Calling this
+     * method on a plan that was already released has no effect. If the
+     * plan is currently executed by another thread, then this waits 
+     * until the execution was enqueued.
+     */
+    public synchronized void release()
+    {
+        if (!released)
+        {
+            releaseNative(handle);
+            handle = 0;
+            released = true;
+        }
+    }
+    private static native void releaseNative(long handle);
+
+    @Override
+    protected void finalize() throws Throwable
+    {
+        try
+        {
+            release();
+        }
+        finally
+        {
+            super.finalize();
+        }
+    }
+}
@@ -0,0 +1,1130 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.clEnqueueReadBufferRect;
+import static org.jocl.CL.clEnqueueWriteBufferRect;
+import static org.jocl.CL.clFinish;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.FloatBuffer;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import org.jocl.CLException;
+import org.jocl.Pointer;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_mem;
+
+/**
+ * Blocked Cholesky and LU factorizations of matrices that reside in
+ * device memory.
+ * <p>
+ * CLBlast does not offer LAPACK-level routines. The methods of this
+ * class implement the blocked <code>potrf</code> and <code>getrf</code>
+ * algorithms on top of the {@link CLBlast} TRSM, SYRK, GEMM and SWAP
+ * routines, so that the matrix stays on the device:
+ * <ul>
+ *   <li>
+ *     For the Cholesky factorization, only the diagonal blocks of the
+ *     block size are copied to the host, factored there, and copied
+ *     back. The updates of the diagonal blocks and the panels below
+ *     them are done with SYRK, GEMM and TRSM on the device.
+ *   </li>
+ *   <li>
+ *     For the LU factorization with partial pivoting, the pivot search
+ *     requires the full column of the current panel. Therefore, each
+ *     panel of the block size is factored on the host. The row
+ *     interchanges are applied to the remaining columns with SWAP, and
+ *     the trailing matrix is updated with TRSM and GEMM on the device.
+ *   </li>
+ * </ul>
+ * The batched variants factor many matrices of the same size in the
+ * same buffer. They perform the steps of all matrices together, so that
+ * the host is only synchronized once per block step for the whole batch,
+ * and use the batched GEMM for the updates.
+ * <p>
+ * Only single and double precision are supported. All methods block
+ * until the factorization is complete. The results follow the LAPACK
+ * conventions: They return 0 for a successful factorization, or the
+ * 1-based index <code>i</code> of the first leading minor that is not
+ * positive definite (for <code>potrf</code>) or of the first zero
+ * pivot (for <code>getrf</code>). The pivot indices are 1-based.
+ * Errors of the CLBlast or OpenCL calls cause a {@link CLException}.
+ */
+public final class CLBlastFactorization
+{
+    /**
+     * The default block size
+     */
+    public static final int DEFAULT_BLOCK_SIZE = 64;
+
+    /**
+     * The block size that is used for the factorizations
+     */
+    private static volatile int blockSize = DEFAULT_BLOCK_SIZE;
+
+    /**
+     * Set the block size that is used for the factorizations. This is
+     * the size of the diagonal blocks that are factored on the host
+     * for a Cholesky factorization, and the width of the panels for an
+     * LU factorization.
+     *
+     * @param newBlockSize The block size
+     * @throws IllegalArgumentException If the block size is not positive
+     */
+    public static void setBlockSize(int newBlockSize)
+    {
+        if (newBlockSize <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The block size must be positive, but is " + newBlockSize);
+        }
+        blockSize = newBlockSize;
+    }
+
+    /**
+     * Returns the block size that is used for the factorizations
+     *
+     * @return The block size
+     */
+    public static int getBlockSize()
+    {
+        return blockSize;
+    }
+
+    /**
+     * A block of a matrix that has been copied to the host. The
+     * elements are stored in the same layout as on the device, with
+     * a leading dimension that is the number of rows (for column-major
+     * order) or columns (for row-major order).
+     */
+    static final class Block
+    {
+        /**
+         * The first row of the block in the matrix
+         */
+        final long row;
+
+        /**
+         * The first column of the block in the matrix
+         */
+        final long col;
+
+        /**
+         * The number of rows
+         */
+        final int rows;
+
+        /**
+         * The number of columns
+         */
+        final int cols;
+
+        /**
+         * Whether the block is stored in column-major order
+         */
+        final boolean colMajor;
+
+        /**
+         * The data of the block, which is accessed asynchronously
+         */
+        final ByteBuffer data;
+
+        /**
+         * The view on the data for single precision
+         */
+        private final FloatBuffer floats;
+
+        /**
+         * The view on the data for double precision
+         */
+        private final DoubleBuffer doubles;
+
+        /**
+         * Creates a new block
+         *
+         * @param precision The {@link CLBlastPrecision}
+         * @param colMajor Whether the block is in column-major order
+         * @param row The first row
+         * @param col The first column
+         * @param rows The number of rows
+         * @param cols The number of columns
+         */
+        Block(int precision, boolean colMajor,
+            long row, long col, int rows, int cols)
+        {
+            this.row = row;
+            this.col = col;
+            this.rows = rows;
+            this.cols = cols;
+            this.colMajor = colMajor;
+            long size = (long)rows * cols *
+                CLBlastTiledGemm.elementSize(precision);
+            this.data = ByteBuffer.allocateDirect((int)size).order(
+                ByteOrder.nativeOrder());
+            if (precision == CLBlastPrecision.CLBlastPrecisionSingle)
+            {
+                this.floats = data.asFloatBuffer();
+                this.doubles = null;
+            }
+            else
+            {
+                this.floats = null;
+                this.doubles = data.asDoubleBuffer();
+            }
+        }
+
+        /**
+         * Returns the index of the given element in the data
+         *
+         * @param i The row
+         * @param j The column
+         * @return The index
+         */
+        private int index(int i, int j)
+        {
+            return colMajor ? i + j * rows : i * cols + j;
+        }
+
+        /**
+         * Returns the value of the given element
+         *
+         * @param i The row
+         * @param j The column
+         * @return The value
+         */
+        double get(int i, int j)
+        {
+            if (floats != null)
+            {
+                return floats.get(index(i, j));
+            }
+            return doubles.get(index(i, j));
+        }
+
+        /**
+         * Set the value of the given element
+         *
+         * @param i The row
+         * @param j The column
+         * @param value The value
+         */
+        void set(int i, int j, double value)
+        {
+            if (floats != null)
+            {
+                floats.put(index(i, j), (float)value);
+            }
+            else
+            {
+                doubles.put(index(i, j), value);
+            }
+        }
+    }
+
+    /**
+     * A matrix in a device buffer
+     */
+    private static final class Matrix
+    {
+        /**
+         * The command queue
+         */
+        final cl_command_queue queue;
+
+        /**
+         * The {@link CLBlastPrecision}
+         */
+        final int precision;
+
+        /**
+         * The {@link CLBlastLayout}
+         */
+        final int layout;
+
+        /**
+         * The buffer
+         */
+        final cl_mem buffer;
+
+        /**
+         * The offset of the first element, in elements
+         */
+        final long offset;
+
+        /**
+         * The leading dimension
+         */
+        final long ld;
+
+        /**
+         * Creates a new instance
+         *
+         * @param queue The queue
+         * @param precision The precision
+         * @param layout The layout
+         * @param buffer The buffer
+         * @param offset The offset
+         * @param ld The leading dimension
+         */
+        Matrix(cl_command_queue queue, int precision, int layout,
+            cl_mem buffer, long offset, long ld)
+        {
+            this.queue = queue;
+            this.precision = precision;
+            this.layout = layout;
+            this.buffer = buffer;
+            this.offset = offset;
+            this.ld = ld;
+        }
+
+        /**
+         * Returns whether the matrix is stored in column-major order
+         *
+         * @return Whether the matrix is column-major
+         */
+        boolean isColMajor()
+        {
+            return layout == CLBlastLayout.CLBlastLayoutColMajor;
+        }
+
+        /**
+         * Returns the offset of the given element in the buffer
+         *
+         * @param i The row
+         * @param j The column
+         * @return The offset, in elements
+         */
+        long at(long i, long j)
+        {
+            return isColMajor() ? offset + i + j * ld : offset + i * ld + j;
+        }
+    }
+
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private CLBlastFactorization()
+    {
+        // Private constructor to prevent instantiation
+    }
+
+    /**
+     * Computes the Cholesky factorization of a symmetric positive
+     * definite n-by-n matrix A. For the lower triangle, the result is
+     * <code>A = L * L^T</code>, where L is stored in the lower triangle.
+     * For the upper triangle, the result is <code>A = U^T * U</code>,
+     * where U is stored in the upper triangle. The other triangle is
+     * not modified.
+     *
+     * @param queue The command queue
+     * @param precision The {@link CLBlastPrecision}
+     * @param layout The {@link CLBlastLayout}
+     * @param triangle The {@link CLBlastTriangle}
+     * @param n The size of the matrix
+     * @param a_buffer The buffer of A
+     * @param a_offset The offset of A
+     * @param a_ld The leading dimension of A
+     * @return 0 if the factorization succeeded, or the 1-based index of
+     * the first leading minor that is not positive definite
+     * @throws IllegalArgumentException If the precision is not supported,
+     * or the leading dimension is too small
+     * @throws CLException If a CLBlast or OpenCL call fails
+     */
+    public static int potrf(cl_command_queue queue, int precision,
+        int layout, int triangle, long n,
+        cl_mem a_buffer, long a_offset, long a_ld)
+    {
+        int info[] = new int[1];
+        potrfBatched(queue, precision, layout, triangle, n,
+            a_buffer, new long[] { a_offset }, a_ld, info, 1);
+        return info[0];
+    }
+
+    /**
+     * Computes the Cholesky factorizations of a batch of symmetric
+     * positive definite n-by-n matrices, as described in
+     * {@link #potrf}.
+     *
+     * @param queue The command queue
+     * @param precision The {@link CLBlastPrecision}
+     * @param layout The {@link CLBlastLayout}
+     * @param triangle The {@link CLBlastTriangle}
+     * @param n The size of the matrices
+     * @param a_buffer The buffer of the matrices
+     * @param a_offsets The offsets of the matrices
+     * @param a_ld The leading dimension of the matrices
+     * @param info Will store the result for each matrix, as described
+     * in {@link #potrf}
+     * @param batch_count The number of matrices
+     * @throws IllegalArgumentException If the precision is not supported,
+     * the leading dimension is too small, or the arrays are too small
+     * @throws CLException If a CLBlast or OpenCL call fails
+     */
+    public static void potrfBatched(cl_command_queue queue,
+        int precision, int layout, int triangle, long n,
+        cl_mem a_buffer, long a_offsets[], long a_ld,
+        int info[], long batch_count)
+    {
+        int count = validate(precision, layout, n, n, a_ld,
+            a_offsets, batch_count);
+        checkLength(info, count, "info");
+        Arrays.fill(info, 0, count, 0);
+
+        // The upper triangle in one layout is the lower triangle of the
+        // same memory in the other layout, so only the lower triangle
+        // has to be handled
+        int lowerLayout = layout;
+        if (triangle == CLBlastTriangle.CLBlastTriangleUpper)
+        {
+            lowerLayout = (layout == CLBlastLayout.CLBlastLayoutColMajor) ?
+                CLBlastLayout.CLBlastLayoutRowMajor :
+                CLBlastLayout.CLBlastLayoutColMajor;
+        }
+        Matrix matrices[] = new Matrix[count];
+        for (int b = 0; b < count; b++)
+        {
+            matrices[b] = new Matrix(queue, precision, lowerLayout,
+                a_buffer, a_offsets[b], a_ld);
+        }
+
+        int nb = blockSize;
+        List<Block> pending = new ArrayList<Block>();
+        for (long j = 0; j < n; j += nb)
+        {
+            int jb = (int)Math.min(nb, n - j);
+            long below = n - j - jb;
+
+            // Update the diagonal blocks with the previous columns
+            if (j > 0)
+            {
+                for (int b = 0; b < count; b++)
+                {
+                    if (info[b] == 0)
+                    {
+                        Matrix a = matrices[b];
+                        syrk(a, jb, j, a.at(j, 0), a.at(j, j));
+                    }
+                }
+            }
+
+            // Factor the diagonal blocks on the host
+            Block blocks[] = new Block[count];
+            for (int b = 0; b < count; b++)
+            {
+                if (info[b] == 0)
+                {
+                    blocks[b] = read(matrices[b], j, j, jb, jb);
+                }
+            }
+            finish(queue, pending);
+            for (int b = 0; b < count; b++)
+            {
+                if (blocks[b] != null)
+                {
+                    int blockInfo = factorCholesky(blocks[b]);
+                    if (blockInfo != 0)
+                    {
+                        info[b] = (int)(j + blockInfo);
+                    }
+                    else
+                    {
+                        write(matrices[b], blocks[b], pending);
+                    }
+                }
+            }
+            if (below == 0)
+            {
+                continue;
+            }
+
+            // Update the panels below the diagonal blocks with the
+            // previous columns
+            if (j > 0)
+            {
+                gemmBatched(matrices, info, CLBlastTranspose.CLBlastTransposeNo,
+                    CLBlastTranspose.CLBlastTransposeYes, below, jb, j,
+                    j + jb, 0, j, 0, j + jb, j);
+            }
+
+            // Solve for the panels below the diagonal blocks
+            for (int b = 0; b < count; b++)
+            {
+                if (info[b] == 0)
+                {
+                    Matrix a = matrices[b];
+                    trsm(a, CLBlastSide.CLBlastSideRight,
+                        CLBlastTranspose.CLBlastTransposeYes,
+                        CLBlastDiagonal.CLBlastDiagonalNonUnit, below, jb,
+                        a.at(j, j), a.at(j + jb, j));
+                }
+            }
+        }
+        finish(queue, pending);
+    }
+
+    /**
+     * Computes the LU factorization of a general m-by-n matrix A with
+     * partial pivoting and row interchanges. The result is
+     * <code>A = P * L * U</code>, where P is a permutation matrix, L is
+     * lower triangular with unit diagonal elements (lower trapezoidal
+     * if m &gt; n), and U is upper triangular (upper trapezoidal if
+     * m &lt; n). L and U are stored in A, and the unit diagonal elements
+     * of L are not stored.
+     *
+     * @param queue The command queue
+     * @param precision The {@link CLBlastPrecision}
+     * @param layout The {@link CLBlastLayout}
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param a_buffer The buffer of A
+     * @param a_offset The offset of A
+     * @param a_ld The leading dimension of A
+     * @param ipiv Will store the <code>min(m,n)</code> 1-based pivot
+     * indices: Row <code>i</code> was interchanged with row
+     * <code>ipiv[i]-1</code>.
+     * @return 0 if the factorization succeeded, or the 1-based index of
+     * the first zero pivot. In this case, the factorization was
+     * completed, but U is singular.
+     * @throws IllegalArgumentException If the precision is not supported,
+     * the leading dimension is too small, or the pivot array is too
+     * small
+     * @throws CLException If a CLBlast or OpenCL call fails
+     */
+    public static int getrf(cl_command_queue queue, int precision,
+        int layout, long m, long n,
+        cl_mem a_buffer, long a_offset, long a_ld, int ipiv[])
+    {
+        int info[] = new int[1];
+        getrfBatched(queue, precision, layout, m, n,
+            a_buffer, new long[] { a_offset }, a_ld, ipiv, info, 1);
+        return info[0];
+    }
+
+    /**
+     * Computes the LU factorizations of a batch of general m-by-n
+     * matrices, as described in {@link #getrf}.
+     *
+     * @param queue The command queue
+     * @param precision The {@link CLBlastPrecision}
+     * @param layout The {@link CLBlastLayout}
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param a_buffer The buffer of the matrices
+     * @param a_offsets The offsets of the matrices
+     * @param a_ld The leading dimension of the matrices
+     * @param ipiv Will store the pivot indices of all matrices, where
+     * the indices of matrix <code>b</code> start at
+     * <code>b*min(m,n)</code>
+     * @param info Will store the result for each matrix, as described
+     * in {@link #getrf}
+     * @param batch_count The number of matrices
+     * @throws IllegalArgumentException If the precision is not supported,
+     * the leading dimension is too small, or the arrays are too small
+     * @throws CLException If a CLBlast or OpenCL call fails
+     */
+    public static void getrfBatched(cl_command_queue queue,
+        int precision, int layout, long m, long n,
+        cl_mem a_buffer, long a_offsets[], long a_ld,
+        int ipiv[], int info[], long batch_count)
+    {
+        int count = validate(precision, layout, m, n, a_ld,
+            a_offsets, batch_count);
+        checkLength(info, count, "info");
+        int mn = (int)Math.min(m, n);
+        checkLength(ipiv, (long)count * mn, "ipiv");
+        Arrays.fill(info, 0, count, 0);
+        Matrix matrices[] = new Matrix[count];
+        for (int b = 0; b < count; b++)
+        {
+            matrices[b] = new Matrix(queue, precision, layout,
+                a_buffer, a_offsets[b], a_ld);
+        }
+        int noInfo[] = new int[count];
+
+        int nb = blockSize;
+        List<Block> pending = new ArrayList<Block>();
+        for (long j = 0; j < mn; j += nb)
+        {
+            int jb = (int)Math.min(nb, mn - j);
+            long right = n - j - jb;
+            long below = m - j - jb;
+
+            // Factor the panels on the host
+            Block panels[] = new Block[count];
+            for (int b = 0; b < count; b++)
+            {
+                panels[b] = read(matrices[b], j, j, (int)(m - j), jb);
+            }
+            finish(queue, pending);
+            for (int b = 0; b < count; b++)
+            {
+                int panelInfo = factorLu(panels[b], ipiv, b * mn + (int)j);
+                if (panelInfo != 0 && info[b] == 0)
+                {
+                    info[b] = (int)(j + panelInfo);
+                }
+                write(matrices[b], panels[b], pending);
+            }
+
+            // Apply the row interchanges to the columns on the left
+            // and on the right of the panels
+            for (int b = 0; b < count; b++)
+            {
+                Matrix a = matrices[b];
+                for (int i = 0; i < jb; i++)
+                {
+                    long row = j + i;
+                    long pivotRow = ipiv[b * mn + (int)row] - 1;
+                    if (pivotRow != row)
+                    {
+                        if (j > 0)
+                        {
+                            swapRows(a, row, pivotRow, 0, j);
+                        }
+                        if (right > 0)
+                        {
+                            swapRows(a, row, pivotRow, j + jb, right);
+                        }
+                    }
+                }
+            }
+            if (right == 0)
+            {
+                continue;
+            }
+
+            // Compute the block rows of U on the right of the panels
+            for (int b = 0; b < count; b++)
+            {
+                Matrix a = matrices[b];
+                trsm(a, CLBlastSide.CLBlastSideLeft,
+                    CLBlastTranspose.CLBlastTransposeNo,
+                    CLBlastDiagonal.CLBlastDiagonalUnit, jb, right,
+                    a.at(j, j), a.at(j, j + jb));
+            }
+
+            // Update the trailing matrices
+            if (below > 0)
+            {
+                gemmBatched(matrices, noInfo,
+                    CLBlastTranspose.CLBlastTransposeNo,
+                    CLBlastTranspose.CLBlastTransposeNo, below, right, jb,
+                    j + jb, j, j, j + jb, j + jb, j + jb);
+            }
+        }
+        finish(queue, pending);
+    }
+
+    /**
+     * Computes the Cholesky factorization <code>A = L * L^T</code> of
+     * the given block in place, using its lower triangle.
+     *
+     * @param block The block
+     * @return 0 if the factorization succeeded, or the 1-based index
+     * of the first leading minor that is not positive definite
+     */
+    static int factorCholesky(Block block)
+    {
+        int n = block.rows;
+        for (int j = 0; j < n; j++)
+        {
+            double d = block.get(j, j);
+            for (int k = 0; k < j; k++)
+            {
+                double l = block.get(j, k);
+                d -= l * l;
+            }
+            if (!(d > 0.0))
+            {
+                return j + 1;
+            }
+            d = Math.sqrt(d);
+            block.set(j, j, d);
+            for (int i = j + 1; i < n; i++)
+            {
+                double s = block.get(i, j);
+                for (int k = 0; k < j; k++)
+                {
+                    s -= block.get(i, k) * block.get(j, k);
+                }
+                block.set(i, j, s / d);
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * Computes the LU factorization with partial pivoting of the given
+     * panel in place. The panel must have at least as many rows as
+     * columns. The 1-based pivot indices, relative to the matrix that
+     * contains the panel, are written into the given array.
+     *
+     * @param panel The panel
+     * @param ipiv The pivot indices
+     * @param ipivOffset The index for the first column of the panel
+     * @return 0 if the factorization succeeded, or the 1-based index
+     * of the first zero pivot in the panel
+     */
+    static int factorLu(Block panel, int ipiv[], int ipivOffset)
+    {
+        int info = 0;
+        for (int c = 0; c < panel.cols; c++)
+        {
+            int pivot = c;
+            double max = Math.abs(panel.get(c, c));
+            for (int r = c + 1; r < panel.rows; r++)
+            {
+                double value = Math.abs(panel.get(r, c));
+                if (value > max)
+                {
+                    max = value;
+                    pivot = r;
+                }
+            }
+            ipiv[ipivOffset + c] = (int)(panel.row + pivot + 1);
+            if (max == 0.0)
+            {
+                if (info == 0)
+                {
+                    info = c + 1;
+                }
+                continue;
+            }
+            if (pivot != c)
+            {
+                for (int k = 0; k < panel.cols; k++)
+                {
+                    double t = panel.get(c, k);
+                    panel.set(c, k, panel.get(pivot, k));
+                    panel.set(pivot, k, t);
+                }
+            }
+            double d = panel.get(c, c);
+            for (int r = c + 1; r < panel.rows; r++)
+            {
+                double l = panel.get(r, c) / d;
+                panel.set(r, c, l);
+                for (int k = c + 1; k < panel.cols; k++)
+                {
+                    panel.set(r, k, panel.get(r, k) - l * panel.get(c, k));
+                }
+            }
+        }
+        return info;
+    }
+
+    /**
+     * Check the arguments of a factorization, and return the number of
+     * matrices
+     *
+     * @param precision The precision
+     * @param layout The layout
+     * @param rows The number of rows
+     * @param cols The number of columns
+     * @param ld The leading dimension
+     * @param offsets The offsets
+     * @param batch_count The number of matrices
+     * @return The number of matrices
+     * @throws IllegalArgumentException If the arguments are not valid
+     */
+    private static int validate(int precision, int layout,
+        long rows, long cols, long ld, long offsets[], long batch_count)
+    {
+        if (precision != CLBlastPrecision.CLBlastPrecisionSingle &&
+            precision != CLBlastPrecision.CLBlastPrecisionDouble)
+        {
+            throw new IllegalArgumentException(
+                "Only single and double precision are supported, " +
+                "but the precision is " +
+                CLBlastPrecision.stringFor(precision));
+        }
+        if (rows < 0 || cols < 0 || batch_count < 0)
+        {
+            throw new IllegalArgumentException(
+                "The sizes must not be negative, but are " + rows +
+                ", " + cols + " and " + batch_count);
+        }
+        long minLd = (layout == CLBlastLayout.CLBlastLayoutColMajor) ?
+            rows : cols;
+        if (ld < Math.max(1, minLd))
+        {
+            throw new IllegalArgumentException(
+                "The leading dimension must be at least " +
+                Math.max(1, minLd) + ", but is " + ld);
+        }
+        checkLength(offsets, batch_count, "a_offsets");
+        return (int)batch_count;
+    }
+
+    /**
+     * Make sure that the given array has at least the given length
+     *
+     * @param array The array
+     * @param length The length
+     * @param name The name of the array, for the error message
+     * @throws IllegalArgumentException If the array is too small
+     */
+    private static void checkLength(int array[], long length, String name)
+    {
+        checkLength(array.length, length, name);
+    }
+
+    /**
+     * Make sure that the given array has at least the given length
+     *
+     * @param array The array
+     * @param length The length
+     * @param name The name of the array, for the error message
+     * @throws IllegalArgumentException If the array is too small
+     */
+    private static void checkLength(long array[], long length, String name)
+    {
+        checkLength(array.length, length, name);
+    }
+
+    /**
+     * Make sure that the given actual length is at least the given length
+     *
+     * @param actual The actual length
+     * @param length The length
+     * @param name The name of the array, for the error message
+     * @throws IllegalArgumentException If the array is too small
+     */
+    private static void checkLength(int actual, long length, String name)
+    {
+        if (actual < length)
+        {
+            throw new IllegalArgumentException("The array '" + name +
+                "' must have a length of at least " + length +
+                ", but only has " + actual);
+        }
+    }
+
+    /**
+     * Enqueue the read operation of the given block of the given matrix
+     *
+     * @param a The matrix
+     * @param row The first row
+     * @param col The first column
+     * @param rows The number of rows
+     * @param cols The number of columns
+     * @return The block
+     * @throws CLException If the read operation cannot be enqueued
+     */
+    private static Block read(Matrix a, long row, long col,
+        int rows, int cols)
+    {
+        Block block = new Block(a.precision, a.isColMajor(),
+            row, col, rows, cols);
+        transfer(a, block, false);
+        return block;
+    }
+
+    /**
+     * Enqueue the write operation of the given block into the given
+     * matrix. The block is added to the given list, so that its data
+     * is kept until the queue is finished.
+     *
+     * @param a The matrix
+     * @param block The block
+     * @param pending The blocks that are written
+     * @throws CLException If the write operation cannot be enqueued
+     */
+    private static void write(Matrix a, Block block, List<Block> pending)
+    {
+        transfer(a, block, true);
+        pending.add(block);
+    }
+
+    /**
+     * Enqueue a non-blocking transfer between the given matrix and block
+     *
+     * @param a The matrix
+     * @param block The block
+     * @param write Whether the block is written to the matrix
+     * @throws CLException If the transfer cannot be enqueued
+     */
+    private static void transfer(Matrix a, Block block, boolean write)
+    {
+        long elementSize = CLBlastTiledGemm.elementSize(a.precision);
+        long first = a.at(block.row, block.col);
+        long width = a.isColMajor() ? block.rows : block.cols;
+        long height = a.isColMajor() ? block.cols : block.rows;
+        long bufferOrigin[] = { (first % a.ld) * elementSize, first / a.ld, 0 };
+        long hostOrigin[] = { 0, 0, 0 };
+        long region[] = { width * elementSize, height, 1 };
+        Pointer host = Pointer.to(block.data);
+        if (write)
+        {
+            CLBlastTiledGemm.check(clEnqueueWriteBufferRect(a.queue,
+                a.buffer, false, bufferOrigin, hostOrigin, region,
+                a.ld * elementSize, 0, width * elementSize, 0,
+                host, 0, null, null), "clEnqueueWriteBufferRect");
+        }
+        else
+        {
+            CLBlastTiledGemm.check(clEnqueueReadBufferRect(a.queue,
+                a.buffer, false, bufferOrigin, hostOrigin, region,
+                a.ld * elementSize, 0, width * elementSize, 0,
+                host, 0, null, null), "clEnqueueReadBufferRect");
+        }
+    }
+
+    /**
+     * Wait until all commands in the given queue have completed, and
+     * clear the given list of blocks that have been written
+     *
+     * @param queue The queue
+     * @param pending The pending blocks
+     * @throws CLException If the queue cannot be finished
+     */
+    private static void finish(cl_command_queue queue, List<Block> pending)
+    {
+        CLBlastTiledGemm.check(clFinish(queue), "clFinish");
+        pending.clear();
+    }
+
+    /**
+     * Computes <code>C = C - A * A^T</code> for the n-by-n lower
+     * triangle of C and the n-by-k matrix A, with the SYRK routine
+     *
+     * @param a The matrix that contains A and C
+     * @param n The size of C
+     * @param k The number of columns of A
+     * @param aOffset The offset of A
+     * @param cOffset The offset of C
+     * @throws CLException If the call fails
+     */
+    private static void syrk(Matrix a, long n, long k,
+        long aOffset, long cOffset)
+    {
+        int status;
+        if (a.precision == CLBlastPrecision.CLBlastPrecisionSingle)
+        {
+            status = CLBlast.CLBlastSsyrk(a.layout,
+                CLBlastTriangle.CLBlastTriangleLower,
+                CLBlastTranspose.CLBlastTransposeNo, n, k, -1.0f,
+                a.buffer, aOffset, a.ld, 1.0f, a.buffer, cOffset, a.ld,
+                a.queue, null);
+        }
+        else
+        {
+            status = CLBlast.CLBlastDsyrk(a.layout,
+                CLBlastTriangle.CLBlastTriangleLower,
+                CLBlastTranspose.CLBlastTransposeNo, n, k, -1.0,
+                a.buffer, aOffset, a.ld, 1.0, a.buffer, cOffset, a.ld,
+                a.queue, null);
+        }
+        check(status, "SYRK");
+    }
+
+    /**
+     * Solves <code>op(T) * X = B</code> or <code>X * op(T) = B</code>
+     * for the m-by-n matrix B, with the lower triangular matrix T and
+     * the TRSM routine
+     *
+     * @param a The matrix that contains T and B
+     * @param side The {@link CLBlastSide}
+     * @param transpose The {@link CLBlastTranspose} for T
+     * @param diagonal The {@link CLBlastDiagonal}
+     * @param m The number of rows of B
+     * @param n The number of columns of B
+     * @param tOffset The offset of T
+     * @param bOffset The offset of B
+     * @throws CLException If the call fails
+     */
+    private static void trsm(Matrix a, int side, int transpose,
+        int diagonal, long m, long n, long tOffset, long bOffset)
+    {
+        int status;
+        if (a.precision == CLBlastPrecision.CLBlastPrecisionSingle)
+        {
+            status = CLBlast.CLBlastStrsm(a.layout, side,
+                CLBlastTriangle.CLBlastTriangleLower, transpose, diagonal,
+                m, n, 1.0f, a.buffer, tOffset, a.ld, a.buffer, bOffset,
+                a.ld, a.queue, null);
+        }
+        else
+        {
+            status = CLBlast.CLBlastDtrsm(a.layout, side,
+                CLBlastTriangle.CLBlastTriangleLower, transpose, diagonal,
+                m, n, 1.0, a.buffer, tOffset, a.ld, a.buffer, bOffset,
+                a.ld, a.queue, null);
+        }
+        check(status, "TRSM");
+    }
+
+    /**
+     * Computes <code>C = C - op(A) * op(B)</code> with the batched GEMM
+     * for all given matrices whose info value is 0. The sub-matrices
+     * A, B and C are given by the row and column of their first
+     * element, which are the same for all matrices.
+     *
+     * @param matrices The matrices that contain A, B and C
+     * @param info The info values
+     * @param a_transpose The {@link CLBlastTranspose} for A
+     * @param b_transpose The {@link CLBlastTranspose} for B
+     * @param m The number of rows of C
+     * @param n The number of columns of C
+     * @param k The inner dimension
+     * @param aRow The first row of A
+     * @param aCol The first column of A
+     * @param bRow The first row of B
+     * @param bCol The first column of B
+     * @param cRow The first row of C
+     * @param cCol The first column of C
+     * @throws CLException If the call fails
+     */
+    private static void gemmBatched(Matrix matrices[], int info[],
+        int a_transpose, int b_transpose, long m, long n, long k,
+        long aRow, long aCol, long bRow, long bCol, long cRow, long cCol)
+    {
+        int count = 0;
+        for (int b = 0; b < matrices.length; b++)
+        {
+            if (info[b] == 0)
+            {
+                count++;
+            }
+        }
+        if (count == 0)
+        {
+            return;
+        }
+        long aOffsets[] = new long[count];
+        long bOffsets[] = new long[count];
+        long cOffsets[] = new long[count];
+        int index = 0;
+        for (int b = 0; b < matrices.length; b++)
+        {
+            if (info[b] == 0)
+            {
+                Matrix a = matrices[b];
+                aOffsets[index] = a.at(aRow, aCol);
+                bOffsets[index] = a.at(bRow, bCol);
+                cOffsets[index] = a.at(cRow, cCol);
+                index++;
+            }
+        }
+        Matrix a = matrices[0];
+        int status;
+        if (a.precision == CLBlastPrecision.CLBlastPrecisionSingle)
+        {
+            float alphas[] = new float[count];
+            float betas[] = new float[count];
+            Arrays.fill(alphas, -1.0f);
+            Arrays.fill(betas, 1.0f);
+            if (count == 1)
+            {
+                status = CLBlast.CLBlastSgemm(a.layout, a_transpose,
+                    b_transpose, m, n, k, -1.0f, a.buffer, aOffsets[0],
+                    a.ld, a.buffer, bOffsets[0], a.ld, 1.0f, a.buffer,
+                    cOffsets[0], a.ld, a.queue, null);
+            }
+            else
+            {
+                status = CLBlast.CLBlastSgemmBatched(a.layout, a_transpose,
+                    b_transpose, m, n, k, alphas, a.buffer, aOffsets,
+                    a.ld, a.buffer, bOffsets, a.ld, betas, a.buffer,
+                    cOffsets, a.ld, count, a.queue, null);
+            }
+        }
+        else
+        {
+            double alphas[] = new double[count];
+            double betas[] = new double[count];
+            Arrays.fill(alphas, -1.0);
+            Arrays.fill(betas, 1.0);
+            if (count == 1)
+            {
+                status = CLBlast.CLBlastDgemm(a.layout, a_transpose,
+                    b_transpose, m, n, k, -1.0, a.buffer, aOffsets[0],
+                    a.ld, a.buffer, bOffsets[0], a.ld, 1.0, a.buffer,
+                    cOffsets[0], a.ld, a.queue, null);
+            }
+            else
+            {
+                status = CLBlast.CLBlastDgemmBatched(a.layout, a_transpose,
+                    b_transpose, m, n, k, alphas, a.buffer, aOffsets,
+                    a.ld, a.buffer, bOffsets, a.ld, betas, a.buffer,
+                    cOffsets, a.ld, count, a.queue, null);
+            }
+        }
+        check(status, "GEMM");
+    }
+
+    /**
+     * Interchange two rows of the given matrix, in the given range of
+     * columns, with the SWAP routine
+     *
+     * @param a The matrix
+     * @param row0 The first row
+     * @param row1 The second row
+     * @param col The first column
+     * @param cols The number of columns
+     * @throws CLException If the call fails
+     */
+    private static void swapRows(Matrix a, long row0, long row1,
+        long col, long cols)
+    {
+        long inc = a.isColMajor() ? a.ld : 1;
+        int status;
+        if (a.precision == CLBlastPrecision.CLBlastPrecisionSingle)
+        {
+            status = CLBlast.CLBlastSswap(cols, a.buffer, a.at(row0, col),
+                inc, a.buffer, a.at(row1, col), inc, a.queue, null);
+        }
+        else
+        {
+            status = CLBlast.CLBlastDswap(cols, a.buffer, a.at(row0, col),
+                inc, a.buffer, a.at(row1, col), inc, a.queue, null);
+        }
+        check(status, "SWAP");
+    }
+
+    /**
+     * Throw a CLException if the given CLBlast status is not
+     * CLBlastSuccess
+     *
+     * @param status The status
+     * @param routineName The name of the routine, for the message
+     * @throws CLException If the status is not CLBlastSuccess
+     */
+    private static void check(int status, String routineName)
+    {
+        if (status != CLBlastStatusCode.CLBlastSuccess)
+        {
+            throw new CLException("CLBlast " + routineName + " failed: " +
+                CLBlastStatusCode.stringFor(status), status);
+        }
+    }
+}
@@ -0,0 +1,1193 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import java.nio.Buffer;
+
+import org.jocl.NativePointerObject;
+import org.jocl.cl_event;
+
+/**
+ * Raw-handle variants of frequently used CLBlast routines.
+ * <p>
+ * The methods of this class receive the native handles of the
+ * <code>cl_mem</code> and <code>cl_command_queue</code> objects as
+ * <code>long</code> values, which may be obtained once with
+ * {@link #getHandle(NativePointerObject)}. The arguments are passed
+ * directly to the CLBlast functions, without null checks and without
+ * logging. Passing invalid handles causes undefined behavior.
+ * <p>
+ * The <code>event</code> may be <code>null</code>. Otherwise, it will
+ * receive the event of the enqueued operation, like in the methods
+ * of the {@link CLBlast} class.
+ */
+public final class CLBlastFast
+{
+    // Initialization of the native library
+    static
+    {
+        CLBlast.initialize();
+    }
+
+    /**
+     * Returns the native handle of the given object, which may be
+     * passed to the methods of this class. If the given object is
+     * <code>null</code>, then 0 is returned.
+     *
+     * @param object The object, e.g. a cl_mem or cl_command_queue
+     * @return The native handle
+     */
+    public static long getHandle(NativePointerObject object)
+    {
+        if (object == null)
+        {
+            return 0;
+        }
+        return getHandleNative(object);
+    }
+    private static native long getHandleNative(
+        NativePointerObject object);
+
+    /**
+     * Returns the native address of the given direct buffer. If the
+     * given buffer is <code>null</code> or not a direct buffer, then
+     * 0 is returned.
+     *
+     * @param buffer The buffer
+     * @return The address
+     */
+    public static long getAddress(Buffer buffer)
+    {
+        if (buffer == null || !buffer.isDirect())
+        {
+            return 0;
+        }
+        return getAddressNative(buffer);
+    }
+    private static native long getAddressNative(Buffer buffer);
+
+
+    // Swap two vectors: SSWAP/DSWAP
+    public static int Sswap(
+        long n, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(SswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int SswapNative(
+        long n, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Dswap(
+        long n, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DswapNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int DswapNative(
+        long n, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    // Vector scaling: SSCAL/DSCAL/HSCAL
+    public static int Sscal(
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(SscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, event));
+    }
+    private static native int SscalNative(
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Dscal(
+        long n, 
+        double alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, event));
+    }
+    private static native int DscalNative(
+        long n, 
+        double alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Hscal(
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(HscalNative(n, alpha, x_buffer, x_offset, x_inc, queue, event));
+    }
+    private static native int HscalNative(
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event);
+
+
+    // Vector copy: SCOPY/DCOPY
+    public static int Scopy(
+        long n, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(ScopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int ScopyNative(
+        long n, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Dcopy(
+        long n, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DcopyNative(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int DcopyNative(
+        long n, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    // Vector-times-constant plus vector: SAXPY/DAXPY/HAXPY
+    public static int Saxpy(
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(SaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int SaxpyNative(
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Daxpy(
+        long n, 
+        double alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int DaxpyNative(
+        long n, 
+        double alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Haxpy(
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(HaxpyNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int HaxpyNative(
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    // Dot product of two vectors: SDOT/DDOT
+    public static int Sdot(
+        long n, 
+        long dot_buffer, 
+        long dot_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(SdotNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int SdotNative(
+        long n, 
+        long dot_buffer, 
+        long dot_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Ddot(
+        long n, 
+        long dot_buffer, 
+        long dot_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DdotNative(n, dot_buffer, dot_offset, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int DdotNative(
+        long n, 
+        long dot_buffer, 
+        long dot_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    // Euclidian norm of a vector: SNRM2/DNRM2
+    public static int Snrm2(
+        long n, 
+        long nrm2_buffer, 
+        long nrm2_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(Snrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, event));
+    }
+    private static native int Snrm2Native(
+        long n, 
+        long nrm2_buffer, 
+        long nrm2_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Dnrm2(
+        long n, 
+        long nrm2_buffer, 
+        long nrm2_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(Dnrm2Native(n, nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc, queue, event));
+    }
+    private static native int Dnrm2Native(
+        long n, 
+        long nrm2_buffer, 
+        long nrm2_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event);
+
+
+    // Absolute sum of values in a vector: SASUM/DASUM
+    public static int Sasum(
+        long n, 
+        long asum_buffer, 
+        long asum_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(SasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, event));
+    }
+    private static native int SasumNative(
+        long n, 
+        long asum_buffer, 
+        long asum_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Dasum(
+        long n, 
+        long asum_buffer, 
+        long asum_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DasumNative(n, asum_buffer, asum_offset, x_buffer, x_offset, x_inc, queue, event));
+    }
+    private static native int DasumNative(
+        long n, 
+        long asum_buffer, 
+        long asum_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event);
+
+
+    // Index of absolute maximum value in a vector: iSAMAX/iDAMAX
+    public static int iSamax(
+        long n, 
+        long imax_buffer, 
+        long imax_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(iSamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, event));
+    }
+    private static native int iSamaxNative(
+        long n, 
+        long imax_buffer, 
+        long imax_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int iDamax(
+        long n, 
+        long imax_buffer, 
+        long imax_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(iDamaxNative(n, imax_buffer, imax_offset, x_buffer, x_offset, x_inc, queue, event));
+    }
+    private static native int iDamaxNative(
+        long n, 
+        long imax_buffer, 
+        long imax_offset, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long queue, 
+        cl_event event);
+
+
+    // General matrix-vector multiplication: SGEMV/DGEMV/HGEMV
+    public static int Sgemv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(SgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int SgemvNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Dgemv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int DgemvNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        double beta, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Hgemv(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(HgemvNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, x_buffer, x_offset, x_inc, beta, y_buffer, y_offset, y_inc, queue, event));
+    }
+    private static native int HgemvNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        float beta, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long queue, 
+        cl_event event);
+
+
+    // General rank-1 matrix update: SGER/DGER
+    public static int Sger(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(SgerNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+    }
+    private static native int SgerNative(
+        int layout, 
+        long m, 
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Dger(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DgerNative(layout, m, n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, a_buffer, a_offset, a_ld, queue, event));
+    }
+    private static native int DgerNative(
+        int layout, 
+        long m, 
+        long n, 
+        double alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long queue, 
+        cl_event event);
+
+
+    // General matrix-matrix multiplication: SGEMM/DGEMM/HGEMM
+    public static int Sgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(SgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+    }
+    private static native int SgemmNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Dgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+    }
+    private static native int DgemmNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        double beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Hgemm(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(HgemmNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event));
+    }
+    private static native int HgemmNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        float beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long queue, 
+        cl_event event);
+
+
+    // Element-wise vector product (Hadamard): SHAD/DHAD
+    public static int Shad(
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta, 
+        long z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(ShadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, event));
+    }
+    private static native int ShadNative(
+        long n, 
+        float alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        float beta, 
+        long z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Dhad(
+        long n, 
+        double alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double beta, 
+        long z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DhadNative(n, alpha, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, beta, z_buffer, z_offset, z_inc, queue, event));
+    }
+    private static native int DhadNative(
+        long n, 
+        double alpha, 
+        long x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        long y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        double beta, 
+        long z_buffer, 
+        long z_offset, 
+        long z_inc, 
+        long queue, 
+        cl_event event);
+
+
+    // Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY
+    public static int Somatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(SomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+    }
+    private static native int SomatcopyNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long queue, 
+        cl_event event);
+
+
+    public static int Domatcopy(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DomatcopyNative(layout, a_transpose, m, n, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, queue, event));
+    }
+    private static native int DomatcopyNative(
+        int layout, 
+        int a_transpose, 
+        long m, 
+        long n, 
+        double alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long queue, 
+        cl_event event);
+
+
+    // StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
+    public static int SgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(SgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
+    }
+    private static native int SgemmStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        long queue, 
+        cl_event event);
+
+
+    public static int DgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(DgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
+    }
+    private static native int DgemmStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        double alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        double beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        long queue, 
+        cl_event event);
+
+
+    public static int HgemmStridedBatched(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        long queue, 
+        cl_event event)
+    {
+        return checkResult(HgemmStridedBatchedNative(layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, a_stride, b_buffer, b_offset, b_ld, b_stride, beta, c_buffer, c_offset, c_ld, c_stride, batch_count, queue, event));
+    }
+    private static native int HgemmStridedBatchedNative(
+        int layout, 
+        int a_transpose, 
+        int b_transpose, 
+        long m, 
+        long n, 
+        long k, 
+        float alpha, 
+        long a_buffer, 
+        long a_offset, 
+        long a_ld, 
+        long a_stride, 
+        long b_buffer, 
+        long b_offset, 
+        long b_ld, 
+        long b_stride, 
+        float beta, 
+        long c_buffer, 
+        long c_offset, 
+        long c_ld, 
+        long c_stride, 
+        long batch_count, 
+        long queue, 
+        cl_event event);
+
+
+    /**
+     * Delegates to {@link CLBlast#checkResult(int)}
+     *
+     * @param result The result to check
+     * @return The result that was given as the parameter
+     */
+    private static int checkResult(int result)
+    {
+        return CLBlast.checkResult(result);
+    }
+
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private CLBlastFast()
+    {
+        // Private constructor to prevent instantiation
+    }
+}
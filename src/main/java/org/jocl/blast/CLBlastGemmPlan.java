@@ -0,0 +1,454 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * A prebound GEMM: A GEMM with a fixed layout, transposes, sizes, 
+ * buffers and leading dimensions, for calls that are repeated many 
+ * times with the same parameters.
+ * <p>
+ * When a plan is created, all parameters are validated once, and the 
+ * native handles of the buffers are stored in a native structure. When 
+ * the plan is executed, only the plan handle, the scalars and offsets,
+ * and the queue and event are passed to the native library, so that 
+ * the host overhead of a call is almost independent of the number of 
+ * parameters. The scalars and offsets that are given when the plan is 
+ * created are used by {@link #execute(cl_command_queue, cl_event)}, and
+ * may be replaced for single executions:
+ * <pre><code>
+ * CLBlastGemmPlan plan = CLBlastGemmPlan.create(CLBlastPrecisionSingle,
+ *     CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo,
+ *     m, n, k, 1.0, a_buffer, 0, k, b_buffer, 0, n, 0.0, c_buffer, 0, n);
+ * for (...)
+ * {
+ *     plan.execute(queue, null);
+ * }
+ * plan.release();
+ * </code></pre>
+ * Like the methods of {@link CLBlastFast}, the executions are not 
+ * logged, and not recorded in the statistics, the profile or the call 
+ * trace. The plan retains its buffers until it is released. A plan may
+ * be used by multiple threads. Its executions and its release are 
+ * serialized, so that a plan is never released while it is executed.
+ */
+public final class CLBlastGemmPlan
+{
+    // Initialization of the native library
+    static
+    {
+        CLBlast.initialize();
+    }
+
+    /**
+     * The handle of the native plan
+     */
+    private long handle;
+
+    /**
+     * Whether this plan was released
+     */
+    private boolean released;
+
+    /**
+     * The {@link CLBlastPrecision}
+     */
+    private final int precision;
+
+    /**
+     * The scalars that are used by default
+     */
+    private final double alpha;
+    private final double beta;
+
+    /**
+     * The offsets that are used by default
+     */
+    private final long a_offset;
+    private final long b_offset;
+    private final long c_offset;
+
+    /**
+     * Creates a new plan
+     *
+     * @param handle The native handle
+     * @param precision The precision
+     * @param alpha The alpha value
+     * @param beta The beta value
+     * @param a_offset The offset of A
+     * @param b_offset The offset of B
+     * @param c_offset The offset of C
+     */
+    private CLBlastGemmPlan(long handle, int precision, double alpha, 
+        double beta, long a_offset, long b_offset, long c_offset)
+    {
+        this.handle = handle;
+        this.precision = precision;
+        this.alpha = alpha;
+        this.beta = beta;
+        this.a_offset = a_offset;
+        this.b_offset = b_offset;
+        this.c_offset = c_offset;
+    }
+
+    /**
+     * Create a new plan for a GEMM with the given parameters. For the 
+     * complex precisions, the given scalars are the real parts, and the
+     * imaginary parts are 0. Complex scalars may be passed to 
+     * {@link #execute(double, double, double, double, long, long, long, 
+     * cl_command_queue, cl_event)}.
+     *
+     * @param precision The {@link CLBlastPrecision}
+     * @param layout The {@link CLBlastLayout}
+     * @param a_transpose The {@link CLBlastTranspose} of A
+     * @param b_transpose The {@link CLBlastTranspose} of B
+     * @param m The number of rows of C
+     * @param n The number of columns of C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value
+     * @param a_buffer The buffer of A
+     * @param a_offset The offset of A
+     * @param a_ld The leading dimension of A
+     * @param b_buffer The buffer of B
+     * @param b_offset The offset of B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value
+     * @param c_buffer The buffer of C
+     * @param c_offset The offset of C
+     * @param c_ld The leading dimension of C
+     * @return The plan
+     * @throws NullPointerException If a buffer is <code>null</code>
+     * @throws IllegalArgumentException If the precision, layout or 
+     * transposes are not valid, a size or offset is negative, or a 
+     * leading dimension is too small
+     */
+    public static CLBlastGemmPlan create(int precision, int layout,
+        int a_transpose, int b_transpose, long m, long n, long k, 
+        double alpha, cl_mem a_buffer, long a_offset, long a_ld, 
+        cl_mem b_buffer, long b_offset, long b_ld, double beta, 
+        cl_mem c_buffer, long c_offset, long c_ld)
+    {
+        checkPrecision(precision, true);
+        checkLayout(layout);
+        checkTranspose(a_transpose, "a_transpose");
+        checkTranspose(b_transpose, "b_transpose");
+        checkNonNegative(m, "m");
+        checkNonNegative(n, "n");
+        checkNonNegative(k, "k");
+        checkNotNull(a_buffer, "a_buffer");
+        checkNotNull(b_buffer, "b_buffer");
+        checkNotNull(c_buffer, "c_buffer");
+        checkNonNegative(a_offset, "a_offset");
+        checkNonNegative(b_offset, "b_offset");
+        checkNonNegative(c_offset, "c_offset");
+
+        // The leading dimension must be at least the number of rows of
+        // the stored matrix for column-major, and the number of columns
+        // for row-major layout
+        boolean colMajor = layout == CLBlastLayout.CLBlastLayoutColMajor;
+        boolean aTrans = a_transpose != CLBlastTranspose.CLBlastTransposeNo;
+        boolean bTrans = b_transpose != CLBlastTranspose.CLBlastTransposeNo;
+        checkLeadingDimension(a_ld, colMajor != aTrans ? m : k, "a_ld");
+        checkLeadingDimension(b_ld, colMajor != bTrans ? k : n, "b_ld");
+        checkLeadingDimension(c_ld, colMajor ? m : n, "c_ld");
+
+        long handle = createNative(precision, layout, a_transpose, 
+            b_transpose, m, n, k, a_buffer, a_ld, b_buffer, b_ld, 
+            c_buffer, c_ld);
+        return new CLBlastGemmPlan(handle, precision, alpha, beta, 
+            a_offset, b_offset, c_offset);
+    }
+    private static native long createNative(int precision, int layout,
+        int a_transpose, int b_transpose, long m, long n, long k, 
+        cl_mem a_buffer, long a_ld, cl_mem b_buffer, long b_ld, 
+        cl_mem c_buffer, long c_ld);
+
+    /**
+     * Returns the {@link CLBlastPrecision} of this plan
+     *
+     * @return The precision
+     */
+    public int getPrecision()
+    {
+        return precision;
+    }
+
+    /**
+     * Execute this plan with the scalars and offsets that have been 
+     * given when it was created
+     *
+     * @param queue The queue
+     * @param event The event, may be <code>null</code>
+     * @return The {@link CLBlastStatusCode}
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was already released
+     */
+    public int execute(cl_command_queue queue, cl_event event)
+    {
+        return execute(alpha, 0.0, beta, 0.0, 
+            a_offset, b_offset, c_offset, queue, event);
+    }
+
+    /**
+     * Execute this plan with the given scalars, and the offsets that 
+     * have been given when it was created
+     *
+     * @param alpha The alpha value
+     * @param beta The beta value
+     * @param queue The queue
+     * @param event The event, may be <code>null</code>
+     * @return The {@link CLBlastStatusCode}
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was already released
+     */
+    public int execute(double alpha, double beta, 
+        cl_command_queue queue, cl_event event)
+    {
+        return execute(alpha, 0.0, beta, 0.0, 
+            a_offset, b_offset, c_offset, queue, event);
+    }
+
+    /**
+     * Execute this plan with the given scalars and offsets
+     *
+     * @param alpha The alpha value
+     * @param beta The beta value
+     * @param a_offset The offset of A
+     * @param b_offset The offset of B
+     * @param c_offset The offset of C
+     * @param queue The queue
+     * @param event The event, may be <code>null</code>
+     * @return The {@link CLBlastStatusCode}
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was already released
+     */
+    public int execute(double alpha, double beta, 
+        long a_offset, long b_offset, long c_offset, 
+        cl_command_queue queue, cl_event event)
+    {
+        return execute(alpha, 0.0, beta, 0.0, 
+            a_offset, b_offset, c_offset, queue, event);
+    }
+
+    /**
+     * Execute this plan with the given complex scalars and offsets. For
+     * the real precisions, the imaginary parts are ignored.
+     *
+     * @param alpha_real The real part of the alpha value
+     * @param alpha_imag The imaginary part of the alpha value
+     * @param beta_real The real part of the beta value
+     * @param beta_imag The imaginary part of the beta value
+     * @param a_offset The offset of A
+     * @param b_offset The offset of B
+     * @param c_offset The offset of C
+     * @param queue The queue
+     * @param event The event, may be <code>null</code>
+     * @return The {@link CLBlastStatusCode}
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was already released
+     */
+    public synchronized int execute(double alpha_real, double alpha_imag, 
+        double beta_real, double beta_imag, 
+        long a_offset, long b_offset, long c_offset, 
+        cl_command_queue queue, cl_event event)
+    {
+        checkExecute(released, queue);
+        return CLBlast.checkResult(executeNative(handle, 
+            alpha_real, alpha_imag, beta_real, beta_imag, 
+            a_offset, b_offset, c_offset, queue, event));
+    }
+    private static native int executeNative(long handle, 
+        double alpha_real, double alpha_imag, 
+        double beta_real, double beta_imag, 
+        long a_offset, long b_offset, long c_offset, 
+        cl_command_queue queue, cl_event event);
+
+    /**
+     * Release this plan and the buffers that it retains. Calling this
+     * method on a plan that was already released has no effect. If the
+     * plan is currently executed by another thread, then this waits 
+     * until the execution was enqueued.
+     */
+    public synchronized void release()
+    {
+        if (!released)
+        {
+            releaseNative(handle);
+            handle = 0;
+            released = true;
+        }
+    }
+    private static native void releaseNative(long handle);
+
+    @Override
+    protected void finalize() throws Throwable
+    {
+        try
+        {
+            release();
+        }
+        finally
+        {
+            super.finalize();
+        }
+    }
+
+    /**
+     * Make sure that the given precision is supported
+     *
+     * @param precision The {@link CLBlastPrecision}
+     * @param complex Whether the complex precisions are supported
+     * @throws IllegalArgumentException If the precision is not supported
+     */
+    static void checkPrecision(int precision, boolean complex)
+    {
+        switch (precision)
+        {
+            case CLBlastPrecision.CLBlastPrecisionHalf:
+            case CLBlastPrecision.CLBlastPrecisionSingle:
+            case CLBlastPrecision.CLBlastPrecisionDouble:
+                return;
+            case CLBlastPrecision.CLBlastPrecisionComplexSingle:
+            case CLBlastPrecision.CLBlastPrecisionComplexDouble:
+                if (complex)
+                {
+                    return;
+                }
+                break;
+            default:
+                break;
+        }
+        throw new IllegalArgumentException(
+            "Unsupported precision: " + CLBlastPrecision.stringFor(precision));
+    }
+
+    /**
+     * Make sure that the given value is a valid {@link CLBlastLayout}
+     *
+     * @param layout The layout
+     * @throws IllegalArgumentException If the layout is not valid
+     */
+    static void checkLayout(int layout)
+    {
+        if (layout != CLBlastLayout.CLBlastLayoutRowMajor &&
+            layout != CLBlastLayout.CLBlastLayoutColMajor)
+        {
+            throw new IllegalArgumentException(
+                "Invalid layout: " + CLBlastLayout.stringFor(layout));
+        }
+    }
+
+    /**
+     * Make sure that the given value is a valid {@link CLBlastTranspose}
+     *
+     * @param transpose The transpose
+     * @param name The name of the parameter
+     * @throws IllegalArgumentException If the transpose is not valid
+     */
+    static void checkTranspose(int transpose, String name)
+    {
+        if (transpose != CLBlastTranspose.CLBlastTransposeNo &&
+            transpose != CLBlastTranspose.CLBlastTransposeYes &&
+            transpose != CLBlastTranspose.CLBlastTransposeConjugate)
+        {
+            throw new IllegalArgumentException("Invalid value for '" + 
+                name + "': " + CLBlastTranspose.stringFor(transpose));
+        }
+    }
+
+    /**
+     * Make sure that the given value is not negative
+     *
+     * @param value The value
+     * @param name The name of the parameter
+     * @throws IllegalArgumentException If the value is negative
+     */
+    static void checkNonNegative(long value, String name)
+    {
+        if (value < 0)
+        {
+            throw new IllegalArgumentException("Parameter '" + name + 
+                "' may not be negative, but is " + value);
+        }
+    }
+
+    /**
+     * Make sure that the given leading dimension is at least the given
+     * minimum, and at least 1
+     *
+     * @param ld The leading dimension
+     * @param minimum The minimum
+     * @param name The name of the parameter
+     * @throws IllegalArgumentException If the leading dimension is too
+     * small
+     */
+    static void checkLeadingDimension(long ld, long minimum, String name)
+    {
+        long required = Math.max(1, minimum);
+        if (ld < required)
+        {
+            throw new IllegalArgumentException("Parameter '" + name + 
+                "' must be at least " + required + ", but is " + ld);
+        }
+    }
+
+    /**
+     * Make sure that the given object is not <code>null</code>
+     *
+     * @param object The object
+     * @param name The name of the parameter
+     * @throws NullPointerException If the object is <code>null</code>
+     */
+    static void checkNotNull(Object object, String name)
+    {
+        if (object == null)
+        {
+            throw new NullPointerException(
+                "Parameter '" + name + "' is null");
+        }
+    }
+
+    /**
+     * Make sure that a plan may be executed on the given queue
+     *
+     * @param released Whether the plan was released
+     * @param queue The queue
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was released
+     */
+    static void checkExecute(boolean released, cl_command_queue queue)
+    {
+        if (released)
+        {
+            throw new IllegalStateException("The plan was already released");
+        }
+        checkNotNull(queue, "queue");
+    }
+}
@@ -0,0 +1,308 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * A prebound GEMV: A GEMV with a fixed layout, transpose, sizes, 
+ * buffers, leading dimension and increments, for calls that are 
+ * repeated many times with the same parameters.
+ * <p>
+ * This is the counterpart of {@link CLBlastGemmPlan} for matrix-vector
+ * multiplications: All parameters are validated once when the plan is 
+ * created, and an execution only passes the plan handle, the scalars 
+ * and offsets, and the queue and event to the native library. The 
+ * executions are not logged, and not recorded in the statistics, the 
+ * profile or the call trace. The plan retains its buffers until it is 
+ * released.
+ */
+public final class CLBlastGemvPlan
+{
+    // Initialization of the native library
+    static
+    {
+        CLBlast.initialize();
+    }
+
+    /**
+     * The handle of the native plan
+     */
+    private long handle;
+
+    /**
+     * Whether this plan was released
+     */
+    private boolean released;
+
+    /**
+     * The {@link CLBlastPrecision}
+     */
+    private final int precision;
+
+    /**
+     * The scalars that are used by default
+     */
+    private final double alpha;
+    private final double beta;
+
+    /**
+     * The offsets that are used by default
+     */
+    private final long a_offset;
+    private final long x_offset;
+    private final long y_offset;
+
+    /**
+     * Creates a new plan
+     *
+     * @param handle The native handle
+     * @param precision The precision
+     * @param alpha The alpha value
+     * @param beta The beta value
+     * @param a_offset The offset of A
+     * @param x_offset The offset of X
+     * @param y_offset The offset of Y
+     */
+    private CLBlastGemvPlan(long handle, int precision, double alpha, 
+        double beta, long a_offset, long x_offset, long y_offset)
+    {
+        this.handle = handle;
+        this.precision = precision;
+        this.alpha = alpha;
+        this.beta = beta;
+        this.a_offset = a_offset;
+        this.x_offset = x_offset;
+        this.y_offset = y_offset;
+    }
+
+    /**
+     * Create a new plan for a GEMV with the given parameters. For the 
+     * complex precisions, the given scalars are the real parts, and the
+     * imaginary parts are 0.
+     *
+     * @param precision The {@link CLBlastPrecision}
+     * @param layout The {@link CLBlastLayout}
+     * @param a_transpose The {@link CLBlastTranspose} of A
+     * @param m The number of rows of A
+     * @param n The number of columns of A
+     * @param alpha The alpha value
+     * @param a_buffer The buffer of A
+     * @param a_offset The offset of A
+     * @param a_ld The leading dimension of A
+     * @param x_buffer The buffer of X
+     * @param x_offset The offset of X
+     * @param x_inc The increment of X
+     * @param beta The beta value
+     * @param y_buffer The buffer of Y
+     * @param y_offset The offset of Y
+     * @param y_inc The increment of Y
+     * @return The plan
+     * @throws NullPointerException If a buffer is <code>null</code>
+     * @throws IllegalArgumentException If the precision, layout or 
+     * transpose are not valid, a size or offset is negative, the leading
+     * dimension is too small, or an increment is 0
+     */
+    public static CLBlastGemvPlan create(int precision, int layout,
+        int a_transpose, long m, long n, double alpha, 
+        cl_mem a_buffer, long a_offset, long a_ld, 
+        cl_mem x_buffer, long x_offset, long x_inc, double beta, 
+        cl_mem y_buffer, long y_offset, long y_inc)
+    {
+        CLBlastGemmPlan.checkPrecision(precision, true);
+        CLBlastGemmPlan.checkLayout(layout);
+        CLBlastGemmPlan.checkTranspose(a_transpose, "a_transpose");
+        CLBlastGemmPlan.checkNonNegative(m, "m");
+        CLBlastGemmPlan.checkNonNegative(n, "n");
+        CLBlastGemmPlan.checkNotNull(a_buffer, "a_buffer");
+        CLBlastGemmPlan.checkNotNull(x_buffer, "x_buffer");
+        CLBlastGemmPlan.checkNotNull(y_buffer, "y_buffer");
+        CLBlastGemmPlan.checkNonNegative(a_offset, "a_offset");
+        CLBlastGemmPlan.checkNonNegative(x_offset, "x_offset");
+        CLBlastGemmPlan.checkNonNegative(y_offset, "y_offset");
+        boolean colMajor = layout == CLBlastLayout.CLBlastLayoutColMajor;
+        CLBlastGemmPlan.checkLeadingDimension(a_ld, colMajor ? m : n, "a_ld");
+        checkIncrement(x_inc, "x_inc");
+        checkIncrement(y_inc, "y_inc");
+
+        long handle = createNative(precision, layout, a_transpose, m, n, 
+            a_buffer, a_ld, x_buffer, x_inc, y_buffer, y_inc);
+        return new CLBlastGemvPlan(handle, precision, alpha, beta, 
+            a_offset, x_offset, y_offset);
+    }
+    private static native long createNative(int precision, int layout,
+        int a_transpose, long m, long n, cl_mem a_buffer, long a_ld, 
+        cl_mem x_buffer, long x_inc, cl_mem y_buffer, long y_inc);
+
+    /**
+     * Returns the {@link CLBlastPrecision} of this plan
+     *
+     * @return The precision
+     */
+    public int getPrecision()
+    {
+        return precision;
+    }
+
+    /**
+     * Execute this plan with the scalars and offsets that have been 
+     * given when it was created
+     *
+     * @param queue The queue
+     * @param event The event, may be <code>null</code>
+     * @return The {@link CLBlastStatusCode}
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was already released
+     */
+    public int execute(cl_command_queue queue, cl_event event)
+    {
+        return execute(alpha, 0.0, beta, 0.0, 
+            a_offset, x_offset, y_offset, queue, event);
+    }
+
+    /**
+     * Execute this plan with the given scalars, and the offsets that 
+     * have been given when it was created
+     *
+     * @param alpha The alpha value
+     * @param beta The beta value
+     * @param queue The queue
+     * @param event The event, may be <code>null</code>
+     * @return The {@link CLBlastStatusCode}
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was already released
+     */
+    public int execute(double alpha, double beta, 
+        cl_command_queue queue, cl_event event)
+    {
+        return execute(alpha, 0.0, beta, 0.0, 
+            a_offset, x_offset, y_offset, queue, event);
+    }
+
+    /**
+     * Execute this plan with the given scalars and offsets
+     *
+     * @param alpha The alpha value
+     * @param beta The beta value
+     * @param a_offset The offset of A
+     * @param x_offset The offset of X
+     * @param y_offset The offset of Y
+     * @param queue The queue
+     * @param event The event, may be <code>null</code>
+     * @return The {@link CLBlastStatusCode}
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was already released
+     */
+    public int execute(double alpha, double beta, 
+        long a_offset, long x_offset, long y_offset, 
+        cl_command_queue queue, cl_event event)
+    {
+        return execute(alpha, 0.0, beta, 0.0, 
+            a_offset, x_offset, y_offset, queue, event);
+    }
+
+    /**
+     * Execute this plan with the given complex scalars and offsets. For
+     * the real precisions, the imaginary parts are ignored.
+     *
+     * @param alpha_real The real part of the alpha value
+     * @param alpha_imag The imaginary part of the alpha value
+     * @param beta_real The real part of the beta value
+     * @param beta_imag The imaginary part of the beta value
+     * @param a_offset The offset of A
+     * @param x_offset The offset of X
+     * @param y_offset The offset of Y
+     * @param queue The queue
+     * @param event The event, may be <code>null</code>
+     * @return The {@link CLBlastStatusCode}
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalStateException If the plan was already released
+     */
+    public synchronized int execute(double alpha_real, double alpha_imag, 
+        double beta_real, double beta_imag, 
+        long a_offset, long x_offset, long y_offset, 
+        cl_command_queue queue, cl_event event)
+    {
+        CLBlastGemmPlan.checkExecute(released, queue);
+        return CLBlast.checkResult(executeNative(handle, 
+            alpha_real, alpha_imag, beta_real, beta_imag, 
+            a_offset, x_offset, y_offset, queue, event));
+    }
+    private static native int executeNative(long handle, 
+        double alpha_real, double alpha_imag, 
+        double beta_real, double beta_imag, 
+        long a_offset, long x_offset, long y_offset, 
+        cl_command_queue queue, cl_event event);
+
+    /**
+     * Release this plan and the buffers that it retains. Calling this
+     * method on a plan that was already released has no effect. If the
+     * plan is currently executed by another thread, then this waits 
+     * until the execution was enqueued.
+     */
+    public synchronized void release()
+    {
+        if (!released)
+        {
+            releaseNative(handle);
+            handle = 0;
+            released = true;
+        }
+    }
+    private static native void releaseNative(long handle);
+
+    @Override
+    protected void finalize() throws Throwable
+    {
+        try
+        {
+            release();
+        }
+        finally
+        {
+            super.finalize();
+        }
+    }
+
+    /**
+     * Make sure that the given vector increment is not 0
+     *
+     * @param inc The increment
+     * @param name The name of the parameter
+     * @throws IllegalArgumentException If the increment is 0
+     */
+    private static void checkIncrement(long inc, String name)
+    {
+        if (inc == 0)
+        {
+            throw new IllegalArgumentException(
+                "Parameter '" + name + "' may not be 0");
+        }
+    }
+}
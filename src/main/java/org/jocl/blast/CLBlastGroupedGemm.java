@@ -0,0 +1,289 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * A grouped GEMM: Many GEMMs with different shapes, executed with a
+ * single native call.
+ * <p>
+ * The batched and strided-batched GEMM routines of CLBlast require the
+ * same transposes, sizes and leading dimensions for all entries of a
+ * batch. A plan of this class receives these parameters for each entry,
+ * and assigns the entries with identical parameters to one bucket. When
+ * the plan is executed, each bucket is computed with one CLBlast call:
+ * A strided-batched GEMM when the offsets of the entries are equally
+ * spaced and their scalars are equal, a batched GEMM otherwise, and a
+ * plain GEMM for a bucket with a single entry.
+ * <p>
+ * Plans are cached, keyed by the parameters of all entries, so that
+ * iterations with the same shapes reuse the bucketing:
+ * <pre><code>
+ * CLBlastGroupedGemm plan = CLBlastGroupedGemm.get(CLBlastLayoutRowMajor,
+ *     a_transposes, b_transposes, m, n, k, a_ld, b_ld, c_ld);
+ * plan.execute(CLBlastPrecisionSingle, alphas, a_buffer, a_offsets,
+ *     b_buffer, b_offsets, betas, c_buffer, c_offsets, queue, null, event);
+ * </code></pre>
+ * The calls for the buckets are enqueued in the given queue. The event
+ * is a marker that completes when the calls for all buckets have 
+ * completed, so it is also valid on an out-of-order queue. Plans are 
+ * immutable, and may be executed concurrently.
+ */
+public final class CLBlastGroupedGemm
+{
+    // Initialization of the native library
+    static
+    {
+        CLBlast.initialize();
+    }
+
+    /**
+     * The maximum number of plans that are kept in the cache. When more
+     * plans are created, the least recently used ones are removed.
+     */
+    private static final int MAX_CACHED_PLANS = 256;
+
+    /**
+     * The cached plans, keyed by the parameters of all entries, in the
+     * order of their last use
+     */
+    private static final Map<List<Long>, CLBlastGroupedGemm> plans =
+        new LinkedHashMap<List<Long>, CLBlastGroupedGemm>(16, 0.75f, true)
+    {
+        private static final long serialVersionUID = 1L;
+
+        @Override
+        protected boolean removeEldestEntry(
+            Map.Entry<List<Long>, CLBlastGroupedGemm> eldest)
+        {
+            return size() > MAX_CACHED_PLANS;
+        }
+    };
+
+    /**
+     * The native plan, as it is created by {@link #createPlanNative}
+     */
+    private final long plan[];
+
+    /**
+     * The number of entries
+     */
+    private final int entryCount;
+
+    /**
+     * Creates a new instance
+     *
+     * @param plan The native plan
+     * @param entryCount The number of entries
+     */
+    private CLBlastGroupedGemm(long plan[], int entryCount)
+    {
+        this.plan = plan;
+        this.entryCount = entryCount;
+    }
+
+    /**
+     * Returns the plan for a grouped GEMM with the given parameters for
+     * each entry. The plan is created if it is not cached yet.
+     *
+     * @param layout The {@link CLBlastLayout} of all matrices
+     * @param a_transposes The {@link CLBlastTranspose} of A, for each entry
+     * @param b_transposes The {@link CLBlastTranspose} of B, for each entry
+     * @param m The number of rows of C, for each entry
+     * @param n The number of columns of C, for each entry
+     * @param k The inner dimension, for each entry
+     * @param a_ld The leading dimension of A, for each entry
+     * @param b_ld The leading dimension of B, for each entry
+     * @param c_ld The leading dimension of C, for each entry
+     * @return The plan
+     * @throws IllegalArgumentException If there are no entries, or the
+     * arrays have different lengths
+     */
+    public static CLBlastGroupedGemm get(int layout,
+        int a_transposes[], int b_transposes[], long m[], long n[], long k[],
+        long a_ld[], long b_ld[], long c_ld[])
+    {
+        int count = m.length;
+        if (count == 0)
+        {
+            throw new IllegalArgumentException("No entries given");
+        }
+        checkLength(a_transposes.length, count, "a_transposes");
+        checkLength(b_transposes.length, count, "b_transposes");
+        checkLength(n.length, count, "n");
+        checkLength(k.length, count, "k");
+        checkLength(a_ld.length, count, "a_ld");
+        checkLength(b_ld.length, count, "b_ld");
+        checkLength(c_ld.length, count, "c_ld");
+
+        List<Long> key = new ArrayList<Long>(1 + 8 * count);
+        key.add((long)layout);
+        for (int i = 0; i < count; i++)
+        {
+            key.add((long)a_transposes[i]);
+            key.add((long)b_transposes[i]);
+            key.add(m[i]);
+            key.add(n[i]);
+            key.add(k[i]);
+            key.add(a_ld[i]);
+            key.add(b_ld[i]);
+            key.add(c_ld[i]);
+        }
+        synchronized (plans)
+        {
+            CLBlastGroupedGemm plan = plans.get(key);
+            if (plan == null)
+            {
+                plan = new CLBlastGroupedGemm(createPlanNative(layout,
+                    a_transposes, b_transposes, m, n, k, a_ld, b_ld, c_ld),
+                    count);
+                plans.put(key, plan);
+            }
+            return plan;
+        }
+    }
+
+    /**
+     * Remove all plans from the cache
+     */
+    public static void clearCache()
+    {
+        synchronized (plans)
+        {
+            plans.clear();
+        }
+    }
+
+    /**
+     * Returns the number of entries of this plan
+     *
+     * @return The number of entries
+     */
+    public int getEntryCount()
+    {
+        return entryCount;
+    }
+
+    /**
+     * Returns the number of CLBlast calls that are used for executing
+     * this plan. This is the number of distinct parameter sets of the
+     * entries.
+     *
+     * @return The number of calls
+     */
+    public int getCallCount()
+    {
+        return (int)plan[2];
+    }
+
+    /**
+     * Execute this plan. The offsets and scalars are given for each entry,
+     * in elements. For complex precisions, the scalar arrays contain the
+     * interleaved real and imaginary parts.
+     *
+     * @param precision The {@link CLBlastPrecision}
+     * @param alphas The alpha values
+     * @param a_buffer The buffer for all A matrices
+     * @param a_offsets The offsets of the A matrices
+     * @param b_buffer The buffer for all B matrices
+     * @param b_offsets The offsets of the B matrices
+     * @param betas The beta values
+     * @param c_buffer The buffer for all C matrices
+     * @param c_offsets The offsets of the C matrices
+     * @param queue The command queue
+     * @param waitList The events to wait for. May be <code>null</code>.
+     * @param event The event of all calls. May be <code>null</code>.
+     * @return The CLBlast status code of the first call that failed, or
+     * <code>CLBlastSuccess</code>
+     * @throws IllegalArgumentException If the lengths of the arrays do
+     * not match the number of entries
+     */
+    public int execute(int precision, double alphas[],
+        cl_mem a_buffer, long a_offsets[],
+        cl_mem b_buffer, long b_offsets[], double betas[],
+        cl_mem c_buffer, long c_offsets[],
+        cl_command_queue queue, cl_event waitList[], cl_event event)
+    {
+        int scalars = CLBlastTiledGemm.isComplex(precision) ?
+            2 * entryCount : entryCount;
+        checkLength(alphas.length, scalars, "alphas");
+        checkLength(betas.length, scalars, "betas");
+        checkLength(a_offsets.length, entryCount, "a_offsets");
+        checkLength(b_offsets.length, entryCount, "b_offsets");
+        checkLength(c_offsets.length, entryCount, "c_offsets");
+        return CLBlast.checkResult(executeNative(plan, precision, alphas,
+            a_buffer, a_offsets, b_buffer, b_offsets, betas,
+            c_buffer, c_offsets, queue, waitList, event));
+    }
+
+    /**
+     * Make sure that the given length is the expected length
+     *
+     * @param length The length
+     * @param expected The expected length
+     * @param name The name of the array
+     * @throws IllegalArgumentException If the length is not the expected one
+     */
+    private static void checkLength(int length, int expected, String name)
+    {
+        if (length != expected)
+        {
+            throw new IllegalArgumentException("The length of " + name +
+                " must be " + expected + ", but is " + length);
+        }
+    }
+
+    /**
+     * Assign the entries with the given parameters to buckets of entries
+     * with identical parameters, and return the plan that describes
+     * these buckets
+     *
+     * @return The plan
+     */
+    private static native long[] createPlanNative(int layout,
+        int a_transposes[], int b_transposes[], long m[], long n[], long k[],
+        long a_ld[], long b_ld[], long c_ld[]);
+
+    /**
+     * Execute the given plan
+     *
+     * @return The CLBlast status code
+     */
+    private static native int executeNative(long plan[], int precision,
+        double alphas[], cl_mem a_buffer, long a_offsets[],
+        cl_mem b_buffer, long b_offsets[], double betas[],
+        cl_mem c_buffer, long c_offsets[],
+        cl_command_queue queue, cl_event waitList[], cl_event event);
+}
@@ -0,0 +1,736 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_MAP_READ;
+import static org.jocl.CL.CL_MAP_WRITE;
+import static org.jocl.CL.CL_MEM_ALLOC_HOST_PTR;
+import static org.jocl.CL.CL_MEM_READ_WRITE;
+import static org.jocl.CL.CL_SUCCESS;
+import static org.jocl.CL.clCreateBuffer;
+import static org.jocl.CL.clCreateCommandQueue;
+import static org.jocl.CL.clEnqueueMapBuffer;
+import static org.jocl.CL.clEnqueueReadBuffer;
+import static org.jocl.CL.clEnqueueUnmapMemObject;
+import static org.jocl.CL.clEnqueueWriteBuffer;
+import static org.jocl.CL.clFinish;
+import static org.jocl.CL.clFlush;
+import static org.jocl.CL.clReleaseCommandQueue;
+import static org.jocl.CL.clReleaseEvent;
+import static org.jocl.CL.clReleaseMemObject;
+import static org.jocl.CL.clWaitForEvents;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.util.ArrayList;
+import java.util.List;
+
+import org.jocl.CL;
+import org.jocl.CLException;
+import org.jocl.Pointer;
+import org.jocl.Sizeof;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_device_id;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * A host-level interface for CLBlast routines that operate on data in
+ * host memory, like <code>float[]</code> arrays or <code>FloatBuffer</code>
+ * objects.
+ * <p>
+ * Instances of this class keep a pool of pinned staging buffers (created
+ * with <code>CL_MEM_ALLOC_HOST_PTR</code>) and device buffers, which are
+ * reused between calls. Large operands are split into chunks, so that the
+ * upload and download of one chunk (on a transfer queue) overlaps with
+ * the computation of another chunk (on a compute queue).
+ * <p>
+ * All matrices are in row-major order. Instances of this class are 
+ * thread-safe, but calls are serialized. The {@link #release()} method
+ * must be called when the instance is no longer used.
+ */
+public final class CLBlastHost
+{
+    /**
+     * The default chunk size, in bytes
+     */
+    private static final long DEFAULT_CHUNK_SIZE = 16 * 1024 * 1024;
+    
+    /**
+     * A buffer of the pool
+     */
+    private static final class PooledBuffer
+    {
+        /**
+         * The memory object
+         */
+        final cl_mem mem;
+        
+        /**
+         * The size, in bytes
+         */
+        final long size;
+        
+        /**
+         * The mapped host memory, for staging buffers, or <code>null</code>
+         * for device buffers
+         */
+        final ByteBuffer host;
+        
+        /**
+         * Creates a new instance
+         * 
+         * @param mem The memory object
+         * @param size The size
+         * @param host The mapped host memory
+         */
+        PooledBuffer(cl_mem mem, long size, ByteBuffer host)
+        {
+            this.mem = mem;
+            this.size = size;
+            this.host = host;
+        }
+    }
+    
+    /**
+     * The chunk of a matrix that is processed in one step of the pipeline
+     */
+    private static final class Chunk
+    {
+        /**
+         * The first row of the chunk, in C
+         */
+        int row;
+        
+        /**
+         * The number of rows
+         */
+        int rows;
+        
+        /**
+         * The event of the download of the chunk of C
+         */
+        cl_event download;
+    }
+    
+    /**
+     * The context
+     */
+    private final cl_context context;
+    
+    /**
+     * The queue for the uploads and downloads
+     */
+    private final cl_command_queue transferQueue;
+    
+    /**
+     * The queue for the CLBlast calls
+     */
+    private final cl_command_queue computeQueue;
+    
+    /**
+     * The idle pinned staging buffers
+     */
+    private final List<PooledBuffer> stagingBuffers;
+    
+    /**
+     * The idle device buffers
+     */
+    private final List<PooledBuffer> deviceBuffers;
+    
+    /**
+     * The chunk size, in bytes
+     */
+    private long chunkSize;
+    
+    /**
+     * Whether this instance was released
+     */
+    private boolean released;
+    
+    /**
+     * Creates a new instance for the given device
+     * 
+     * @param context The context
+     * @param device The device
+     * @throws CLException If the queues cannot be created
+     */
+    public CLBlastHost(cl_context context, cl_device_id device)
+    {
+        this.context = context;
+        int errorCode[] = new int[1];
+        this.transferQueue = 
+            clCreateCommandQueue(context, device, 0, errorCode);
+        check(errorCode[0], "clCreateCommandQueue");
+        this.computeQueue = 
+            clCreateCommandQueue(context, device, 0, errorCode);
+        check(errorCode[0], "clCreateCommandQueue");
+        this.stagingBuffers = new ArrayList<PooledBuffer>();
+        this.deviceBuffers = new ArrayList<PooledBuffer>();
+        this.chunkSize = DEFAULT_CHUNK_SIZE;
+    }
+    
+    /**
+     * Set the approximate size of the chunks of the matrices that are
+     * transferred and processed in one step, in bytes. Smaller chunks
+     * allow more overlap, but cause more calls. The default is 16 MB.
+     * 
+     * @param chunkSize The chunk size
+     * @throws IllegalArgumentException If the chunk size is not positive
+     */
+    public synchronized void setChunkSize(long chunkSize)
+    {
+        if (chunkSize <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The chunk size must be positive, but is " + chunkSize);
+        }
+        this.chunkSize = chunkSize;
+    }
+    
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C, for row-major matrices
+     * in host memory. See {@link #sgemm(int, int, int, int, int, float, 
+     * FloatBuffer, int, FloatBuffer, int, float, FloatBuffer, int)}.
+     * 
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     */
+    public void sgemm(int a_transpose, int b_transpose, 
+        int m, int n, int k, float alpha, 
+        float a[], int a_ld, float b[], int b_ld, 
+        float beta, float c[], int c_ld)
+    {
+        sgemm(a_transpose, b_transpose, m, n, k, alpha, 
+            FloatBuffer.wrap(a), a_ld, FloatBuffer.wrap(b), b_ld, 
+            beta, FloatBuffer.wrap(c), c_ld);
+    }
+    
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C, for row-major matrices
+     * in host memory. The matrices start at the current positions of the
+     * given buffers. The positions of the buffers are not modified.
+     * <p>
+     * B is uploaded once. When A is not transposed, A and C are split into
+     * chunks of rows, and the upload of the next chunk of A and the 
+     * download of the previous chunk of C overlap with the computation of
+     * the current chunk.
+     * 
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @throws IllegalArgumentException If one of the buffers is too small
+     * @throws IllegalStateException If this instance was released
+     * @throws CLException If an OpenCL or CLBlast call fails
+     */
+    public synchronized void sgemm(int a_transpose, int b_transpose, 
+        int m, int n, int k, float alpha, 
+        FloatBuffer a, int a_ld, FloatBuffer b, int b_ld, 
+        float beta, FloatBuffer c, int c_ld)
+    {
+        checkNotReleased();
+        if (m == 0 || n == 0)
+        {
+            return;
+        }
+        if (k == 0)
+        {
+            scale(beta, c, m, n, c_ld);
+            return;
+        }
+        boolean transposeA = 
+            a_transpose != CLBlastTranspose.CLBlastTransposeNo;
+        boolean transposeB = 
+            b_transpose != CLBlastTranspose.CLBlastTransposeNo;
+        int aRows = transposeA ? k : m;
+        int aCols = transposeA ? m : k;
+        int bRows = transposeB ? n : k;
+        int bCols = transposeB ? k : n;
+        checkSize(a, aRows, aCols, a_ld, "a");
+        checkSize(b, bRows, bCols, b_ld, "b");
+        checkSize(c, m, n, c_ld, "c");
+        
+        int chunkRows = chunkRows(m, transposeA, a_ld, c_ld, chunkSize);
+        int slots = chunkRows < m ? 2 : 1;
+        long aChunkElements = span(transposeA ? aRows : chunkRows, aCols, a_ld);
+        long cChunkElements = span(chunkRows, n, c_ld);
+        
+        List<PooledBuffer> acquired = new ArrayList<PooledBuffer>();
+        List<cl_event> events = new ArrayList<cl_event>();
+        PooledBuffer bStaging = null;
+        PooledBuffer bDevice = null;
+        PooledBuffer aStaging[] = new PooledBuffer[slots];
+        PooledBuffer aDevice[] = new PooledBuffer[slots];
+        PooledBuffer cStaging[] = new PooledBuffer[slots];
+        PooledBuffer cDevice[] = new PooledBuffer[slots];
+        Chunk pending[] = new Chunk[slots];
+        try
+        {
+            // Upload B
+            long bBytes = span(bRows, bCols, b_ld) * Sizeof.cl_float;
+            bStaging = acquire(stagingBuffers, bBytes, true, acquired);
+            bDevice = acquire(deviceBuffers, bBytes, false, acquired);
+            copyToStaging(b, 0, span(bRows, bCols, b_ld), bStaging);
+            cl_event bUpload = new cl_event();
+            check(clEnqueueWriteBuffer(transferQueue, bDevice.mem, false, 
+                0, bBytes, Pointer.to(bStaging.host), 0, null, bUpload),
+                "clEnqueueWriteBuffer");
+            events.add(bUpload);
+            for (int s = 0; s < slots; s++)
+            {
+                long aBytes = aChunkElements * Sizeof.cl_float;
+                long cBytes = cChunkElements * Sizeof.cl_float;
+                aStaging[s] = acquire(stagingBuffers, aBytes, true, acquired);
+                aDevice[s] = acquire(deviceBuffers, aBytes, false, acquired);
+                cStaging[s] = acquire(stagingBuffers, cBytes, true, acquired);
+                cDevice[s] = acquire(deviceBuffers, cBytes, false, acquired);
+            }
+            
+            int chunks = (m + chunkRows - 1) / chunkRows;
+            cl_event uploads[] = new cl_event[chunks];
+            uploads[0] = upload(0, Math.min(chunkRows, m), transposeA, 
+                a, aRows, aCols, a_ld, c, n, c_ld, 
+                aStaging[0], aDevice[0], cStaging[0], cDevice[0], events);
+            for (int i = 0; i < chunks; i++)
+            {
+                int s = i % slots;
+                Chunk chunk = new Chunk();
+                chunk.row = i * chunkRows;
+                chunk.rows = Math.min(chunkRows, m - chunk.row);
+                
+                // Compute the current chunk
+                cl_event gemm = new cl_event();
+                int status = CLBlast.CLBlastSgemm(
+                    CLBlastLayout.CLBlastLayoutRowMajor, 
+                    a_transpose, b_transpose, chunk.rows, n, k, 
+                    alpha, aDevice[s].mem, 0, a_ld, bDevice.mem, 0, b_ld, 
+                    beta, cDevice[s].mem, 0, c_ld, computeQueue, 
+                    new cl_event[] { uploads[i] }, gemm);
+                if (status != CLBlastStatusCode.CLBlastSuccess)
+                {
+                    throw new CLException("CLBlastSgemm failed: " + 
+                        CLBlastStatusCode.stringFor(status), status);
+                }
+                events.add(gemm);
+                clFlush(computeQueue);
+                
+                // Upload the next chunk, after the previous chunk that
+                // used the same slot has been downloaded
+                if (i + 1 < chunks)
+                {
+                    int t = (i + 1) % slots;
+                    if (pending[t] != null)
+                    {
+                        finishDownload(pending[t], c, n, c_ld, cStaging[t]);
+                        pending[t] = null;
+                    }
+                    int row = (i + 1) * chunkRows;
+                    uploads[i + 1] = upload(row, Math.min(chunkRows, m - row), 
+                        transposeA, a, aRows, aCols, a_ld, c, n, c_ld, 
+                        aStaging[t], aDevice[t], 
+                        cStaging[t], cDevice[t], events);
+                }
+                
+                // Download the current chunk
+                chunk.download = new cl_event();
+                check(clEnqueueReadBuffer(transferQueue, cDevice[s].mem, 
+                    false, 0, span(chunk.rows, n, c_ld) * Sizeof.cl_float, 
+                    Pointer.to(cStaging[s].host), 1, 
+                    new cl_event[] { gemm }, chunk.download),
+                    "clEnqueueReadBuffer");
+                events.add(chunk.download);
+                clFlush(transferQueue);
+                pending[s] = chunk;
+            }
+            for (int s = 0; s < slots; s++)
+            {
+                if (pending[s] != null)
+                {
+                    finishDownload(pending[s], c, n, c_ld, cStaging[s]);
+                    pending[s] = null;
+                }
+            }
+        }
+        finally
+        {
+            // When an exception was thrown, there may still be pending
+            // operations that use the buffers
+            clFinish(computeQueue);
+            clFinish(transferQueue);
+            for (cl_event event : events)
+            {
+                clReleaseEvent(event);
+            }
+            for (PooledBuffer buffer : acquired)
+            {
+                if (buffer.host != null)
+                {
+                    stagingBuffers.add(buffer);
+                }
+                else
+                {
+                    deviceBuffers.add(buffer);
+                }
+            }
+        }
+    }
+    
+    /**
+     * Copy the given chunk of A and C into the staging buffers, and 
+     * enqueue their upload into the device buffers. C is uploaded even 
+     * if beta is 0, because the device buffer may contain NaN values
+     * that would otherwise not be cleared.
+     * 
+     * @param row The first row of the chunk in C
+     * @param rows The number of rows of the chunk
+     * @param transposeA Whether A is transposed. In this case, the
+     * whole matrix A is uploaded for each chunk.
+     * @param a The matrix A
+     * @param aRows The number of rows of A
+     * @param aCols The number of columns of A
+     * @param a_ld The leading dimension of A
+     * @param c The matrix C
+     * @param n The number of columns of C
+     * @param c_ld The leading dimension of C
+     * @param aStaging The staging buffer for A
+     * @param aDevice The device buffer for A
+     * @param cStaging The staging buffer for C
+     * @param cDevice The device buffer for C
+     * @param events The list that receives all created events
+     * @return The event of the last upload
+     */
+    private cl_event upload(int row, int rows, boolean transposeA, 
+        FloatBuffer a, int aRows, int aCols, int a_ld, 
+        FloatBuffer c, int n, int c_ld,
+        PooledBuffer aStaging, PooledBuffer aDevice, 
+        PooledBuffer cStaging, PooledBuffer cDevice, 
+        List<cl_event> events)
+    {
+        long aOffset = transposeA ? 0 : (long)row * a_ld;
+        long aElements = span(transposeA ? aRows : rows, aCols, a_ld);
+        copyToStaging(a, aOffset, aElements, aStaging);
+        cl_event upload = new cl_event();
+        check(clEnqueueWriteBuffer(transferQueue, aDevice.mem, false, 
+            0, aElements * Sizeof.cl_float, Pointer.to(aStaging.host), 
+            0, null, upload), "clEnqueueWriteBuffer");
+        events.add(upload);
+        long cElements = span(rows, n, c_ld);
+        copyToStaging(c, (long)row * c_ld, cElements, cStaging);
+        upload = new cl_event();
+        check(clEnqueueWriteBuffer(transferQueue, cDevice.mem, false, 
+            0, cElements * Sizeof.cl_float, Pointer.to(cStaging.host), 
+            0, null, upload), "clEnqueueWriteBuffer");
+        events.add(upload);
+        clFlush(transferQueue);
+        return upload;
+    }
+    
+    /**
+     * Scale the given row-major matrix with the given factor. This is
+     * used for the case that k is 0, where C = beta * C.
+     * 
+     * @param beta The factor
+     * @param c The matrix
+     * @param m The number of rows
+     * @param n The number of columns
+     * @param c_ld The leading dimension
+     */
+    private static void scale(float beta, FloatBuffer c, 
+        int m, int n, int c_ld)
+    {
+        int base = c.position();
+        for (int r = 0; r < m; r++)
+        {
+            for (int j = 0; j < n; j++)
+            {
+                int index = base + r * c_ld + j;
+                c.put(index, beta == 0.0f ? 0.0f : beta * c.get(index));
+            }
+        }
+    }
+    
+    /**
+     * Wait for the download of the given chunk, and copy its rows from
+     * the staging buffer into C
+     * 
+     * @param chunk The chunk
+     * @param c The matrix C
+     * @param n The number of columns of C
+     * @param c_ld The leading dimension of C
+     * @param cStaging The staging buffer
+     */
+    private static void finishDownload(Chunk chunk, 
+        FloatBuffer c, int n, int c_ld, PooledBuffer cStaging)
+    {
+        check(clWaitForEvents(1, new cl_event[] { chunk.download }), 
+            "clWaitForEvents");
+        FloatBuffer source = cStaging.host.asFloatBuffer();
+        FloatBuffer target = c.duplicate();
+        int base = c.position() + chunk.row * c_ld;
+        for (int r = 0; r < chunk.rows; r++)
+        {
+            source.limit(r * c_ld + n);
+            source.position(r * c_ld);
+            target.position(base + r * c_ld);
+            target.put(source);
+        }
+    }
+    
+    /**
+     * Copy the given number of elements, starting at the given offset
+     * relative to the position of the given buffer, into the given
+     * staging buffer
+     * 
+     * @param source The source buffer
+     * @param offset The offset
+     * @param elements The number of elements
+     * @param staging The staging buffer
+     */
+    private static void copyToStaging(FloatBuffer source, long offset, 
+        long elements, PooledBuffer staging)
+    {
+        FloatBuffer s = source.duplicate();
+        s.position((int)(source.position() + offset));
+        s.limit((int)(source.position() + offset + elements));
+        FloatBuffer target = staging.host.asFloatBuffer();
+        target.put(s);
+    }
+    
+    /**
+     * Obtain a buffer with at least the given size from the given pool,
+     * or create a new one. The buffer is added to the given list.
+     * 
+     * @param pool The pool
+     * @param size The size, in bytes
+     * @param staging Whether a pinned staging buffer should be created
+     * @param acquired The list of acquired buffers
+     * @return The buffer
+     */
+    private PooledBuffer acquire(List<PooledBuffer> pool, long size, 
+        boolean staging, List<PooledBuffer> acquired)
+    {
+        PooledBuffer best = null;
+        for (PooledBuffer buffer : pool)
+        {
+            if (buffer.size >= size && (best == null || buffer.size < best.size))
+            {
+                best = buffer;
+            }
+        }
+        if (best != null)
+        {
+            pool.remove(best);
+            acquired.add(best);
+            return best;
+        }
+        int errorCode[] = new int[1];
+        long flags = CL_MEM_READ_WRITE;
+        if (staging)
+        {
+            flags |= CL_MEM_ALLOC_HOST_PTR;
+        }
+        cl_mem mem = clCreateBuffer(context, flags, size, null, errorCode);
+        check(errorCode[0], "clCreateBuffer");
+        ByteBuffer host = null;
+        if (staging)
+        {
+            host = clEnqueueMapBuffer(transferQueue, mem, true, 
+                CL_MAP_READ | CL_MAP_WRITE, 0, size, 0, null, null, errorCode);
+            if (errorCode[0] != CL_SUCCESS)
+            {
+                clReleaseMemObject(mem);
+                check(errorCode[0], "clEnqueueMapBuffer");
+            }
+            host.order(ByteOrder.nativeOrder());
+        }
+        PooledBuffer buffer = new PooledBuffer(mem, size, host);
+        acquired.add(buffer);
+        return buffer;
+    }
+    
+    /**
+     * Release all idle buffers of the pools
+     */
+    public synchronized void trim()
+    {
+        for (PooledBuffer buffer : stagingBuffers)
+        {
+            clEnqueueUnmapMemObject(
+                transferQueue, buffer.mem, buffer.host, 0, null, null);
+        }
+        clFinish(transferQueue);
+        for (PooledBuffer buffer : stagingBuffers)
+        {
+            clReleaseMemObject(buffer.mem);
+        }
+        for (PooledBuffer buffer : deviceBuffers)
+        {
+            clReleaseMemObject(buffer.mem);
+        }
+        stagingBuffers.clear();
+        deviceBuffers.clear();
+    }
+    
+    /**
+     * Release all resources of this instance. Afterwards, the instance
+     * may no longer be used.
+     */
+    public synchronized void release()
+    {
+        if (released)
+        {
+            return;
+        }
+        trim();
+        clReleaseCommandQueue(transferQueue);
+        clReleaseCommandQueue(computeQueue);
+        released = true;
+    }
+    
+    /**
+     * Make sure that this instance was not released
+     * 
+     * @throws IllegalStateException If this instance was released
+     */
+    private void checkNotReleased()
+    {
+        if (released)
+        {
+            throw new IllegalStateException("The CLBlastHost was released");
+        }
+    }
+    
+    /**
+     * Returns the number of rows of C that are computed in one chunk.
+     * Only a non-transposed A can be split into chunks of rows. At
+     * least one row is computed in each chunk, even if a single row
+     * exceeds the chunk size.
+     * 
+     * @param m The number of rows of C
+     * @param transposeA Whether A is transposed
+     * @param a_ld The leading dimension of A
+     * @param c_ld The leading dimension of C
+     * @param chunkSize The chunk size, in bytes
+     * @return The number of rows per chunk
+     */
+    static int chunkRows(int m, boolean transposeA,
+        int a_ld, int c_ld, long chunkSize)
+    {
+        if (transposeA)
+        {
+            return m;
+        }
+        long rowBytes = (long)Math.max(a_ld, c_ld) * Sizeof.cl_float;
+        return (int)Math.max(1, Math.min(m, chunkSize / rowBytes));
+    }
+    
+    /**
+     * Returns the number of elements that are spanned by a row-major 
+     * matrix with the given size
+     * 
+     * @param rows The number of rows
+     * @param cols The number of columns
+     * @param ld The leading dimension
+     * @return The number of elements
+     */
+    static long span(int rows, int cols, int ld)
+    {
+        if (rows == 0 || cols == 0)
+        {
+            return 0;
+        }
+        return (long)(rows - 1) * ld + cols;
+    }
+    
+    /**
+     * Make sure that the given buffer has enough remaining elements for
+     * a row-major matrix of the given size
+     * 
+     * @param buffer The buffer
+     * @param rows The number of rows
+     * @param cols The number of columns
+     * @param ld The leading dimension
+     * @param name The name of the matrix, for the error message
+     * @throws IllegalArgumentException If the buffer is too small, or
+     * the leading dimension is smaller than the number of columns
+     */
+    static void checkSize(FloatBuffer buffer, 
+        int rows, int cols, int ld, String name)
+    {
+        if (ld < cols)
+        {
+            throw new IllegalArgumentException("The leading dimension of '" + 
+                name + "' must be at least " + cols + ", but is " + ld);
+        }
+        long required = span(rows, cols, ld);
+        if (buffer.remaining() < required)
+        {
+            throw new IllegalArgumentException("The matrix '" + name + 
+                "' requires " + required + " elements, but only has " + 
+                buffer.remaining());
+        }
+    }
+    
+    /**
+     * Throw a CLException if the given error code is not CL_SUCCESS
+     * 
+     * @param errorCode The error code
+     * @param functionName The name of the function, for the message
+     * @throws CLException If the error code is not CL_SUCCESS
+     */
+    private static void check(int errorCode, String functionName)
+    {
+        if (errorCode != CL_SUCCESS)
+        {
+            throw new CLException(functionName + " failed: " + 
+                CL.stringFor_errorCode(errorCode), errorCode);
+        }
+    }
+}
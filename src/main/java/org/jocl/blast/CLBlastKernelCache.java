@@ -0,0 +1,299 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+/**
+ * A snapshot of the accounting of the CLBlast kernel cache, as returned
+ * by {@link CLBlast#getKernelCache()}.
+ * <p>
+ * The accounting is only done when it has been enabled with
+ * {@link CLBlast#setKernelCacheTrackingEnabled(boolean)}. It contains one
+ * {@link Entry} for each combination of context, device, operation and
+ * precision whose kernels have been compiled by a call of a {@link CLBlast}
+ * routine, or of one of the classes that call these routines, like
+ * {@link CLBlastFast} or {@link CLBlastGemmPlan}. The operation is the name of the routine without the
+ * precision prefix, like <code>"gemm"</code> or
+ * <code>"gemmBatched"</code>, where variants of a routine that use the
+ * same kernels are counted as one operation. CLBlast does not expose
+ * the memory that is used by the compiled programs, so the size of the
+ * cache is given as the number of entries. CLBlast compiles the programs
+ * for each context, so a device that is used in two contexts has two
+ * entries for the same operation and precision.
+ * <p>
+ * CLBlast can only clear its whole cache. An eviction therefore clears
+ * the cache, and compiles the entries that are kept again, in the same
+ * way as {@link CLBlastWarmup}. This is only possible for the 
+ * operations that are supported by the warmup, which is indicated by
+ * {@link Entry#isRebuildable()}. Entries of other operations, like 
+ * <code>"convgemm"</code>, can only be evicted together with all other
+ * entries of the cache.
+ */
+public final class CLBlastKernelCache
+{
+    /**
+     * The number of values for each entry that are passed from the
+     * native library
+     */
+    private static final int ENTRY_VALUES = 5;
+
+    /**
+     * The kernel cache accounting for one device, operation and precision
+     */
+    public static final class Entry
+    {
+        /**
+         * The name of the device
+         */
+        private final String device;
+
+        /**
+         * The native handle of the device
+         */
+        private final long deviceHandle;
+
+        /**
+         * The operation
+         */
+        private final String operation;
+
+        /**
+         * The precision
+         */
+        private final int precision;
+
+        /**
+         * The number of calls
+         */
+        private final long calls;
+
+        /**
+         * The time since the last call, in nanoseconds
+         */
+        private final long idleNanos;
+
+        /**
+         * Whether the kernels can be compiled again after an eviction
+         */
+        private final boolean rebuildable;
+
+        /**
+         * Creates a new instance from the given values, starting at the
+         * given offset
+         *
+         * @param device The device name
+         * @param operation The operation
+         * @param values The values
+         * @param offset The offset
+         */
+        Entry(String device, String operation, long values[], int offset)
+        {
+            this.device = device;
+            this.operation = operation;
+            this.deviceHandle = values[offset + 0];
+            this.precision = (int)values[offset + 1];
+            this.calls = values[offset + 2];
+            this.idleNanos = values[offset + 3];
+            this.rebuildable = values[offset + 4] != 0;
+        }
+
+        /**
+         * Returns the name of the device, as given by
+         * <code>CL_DEVICE_NAME</code>
+         *
+         * @return The device name
+         */
+        public String getDevice()
+        {
+            return device;
+        }
+
+        /**
+         * Returns the native handle of the device. This can be compared
+         * to the handle of a <code>cl_device_id</code> that is obtained
+         * with {@link CLBlastFast#getHandle(org.jocl.NativePointerObject)}.
+         *
+         * @return The device handle
+         */
+        public long getDeviceHandle()
+        {
+            return deviceHandle;
+        }
+
+        /**
+         * Returns the operation, e.g. <code>"gemm"</code>
+         *
+         * @return The operation
+         */
+        public String getOperation()
+        {
+            return operation;
+        }
+
+        /**
+         * Returns the {@link CLBlastPrecision}
+         *
+         * @return The precision
+         */
+        public int getPrecision()
+        {
+            return precision;
+        }
+
+        /**
+         * Returns the number of successful calls that used the kernels
+         *
+         * @return The number of calls
+         */
+        public long getCalls()
+        {
+            return calls;
+        }
+
+        /**
+         * Returns the time since the last call, in nanoseconds, at the
+         * time when the snapshot was taken
+         *
+         * @return The idle time
+         */
+        public long getIdleNanos()
+        {
+            return idleNanos;
+        }
+
+        /**
+         * Returns whether the kernels of this entry can be compiled again
+         * when other entries are evicted. If this is <code>false</code>,
+         * then evicting other entries would also drop the kernels of this
+         * entry, and such an eviction is not performed.
+         *
+         * @return Whether the kernels can be compiled again
+         */
+        public boolean isRebuildable()
+        {
+            return rebuildable;
+        }
+
+        @Override
+        public String toString()
+        {
+            return operation + "[device=" + device + ", precision=" +
+                CLBlastPrecision.stringFor(precision) + ", calls=" + calls +
+                ", idleNanos=" + idleNanos + 
+                (rebuildable ? "" : ", not rebuildable") + "]";
+        }
+    }
+
+    /**
+     * The entries
+     */
+    private final List<Entry> entries;
+
+    /**
+     * Creates a new snapshot from the given data. The strings contain the
+     * device name and operation of each entry. The values contain the
+     * device handle, precision, number of calls, idle time and whether
+     * the kernels can be compiled again, for each entry.
+     *
+     * @param strings The strings
+     * @param values The values
+     */
+    CLBlastKernelCache(String strings[], long values[])
+    {
+        List<Entry> entryList = new ArrayList<Entry>();
+        for (int i = 0; i < strings.length / 2; i++)
+        {
+            entryList.add(new Entry(strings[i * 2 + 0], strings[i * 2 + 1],
+                values, i * ENTRY_VALUES));
+        }
+        this.entries = Collections.unmodifiableList(entryList);
+    }
+
+    /**
+     * Returns an unmodifiable list with all entries
+     *
+     * @return The entries
+     */
+    public List<Entry> getEntries()
+    {
+        return entries;
+    }
+
+    /**
+     * Returns the number of entries, which is the number of compiled
+     * combinations of device, operation and precision
+     *
+     * @return The number of entries
+     */
+    public int getSize()
+    {
+        return entries.size();
+    }
+
+    /**
+     * Returns the number of entries for each device name
+     *
+     * @return The number of entries, for each device name
+     */
+    public Map<String, Integer> getSizeByDevice()
+    {
+        Map<String, Integer> result = new LinkedHashMap<String, Integer>();
+        for (Entry entry : entries)
+        {
+            Integer count = result.get(entry.getDevice());
+            result.put(entry.getDevice(), count == null ? 1 : count + 1);
+        }
+        return result;
+    }
+
+    /**
+     * Returns the number of entries for each operation
+     *
+     * @return The number of entries, for each operation
+     */
+    public Map<String, Integer> getSizeByOperation()
+    {
+        Map<String, Integer> result = new LinkedHashMap<String, Integer>();
+        for (Entry entry : entries)
+        {
+            Integer count = result.get(entry.getOperation());
+            result.put(entry.getOperation(), count == null ? 1 : count + 1);
+        }
+        return result;
+    }
+
+    @Override
+    public String toString()
+    {
+        return "CLBlastKernelCache[entries=" + entries + "]";
+    }
+}
@@ -0,0 +1,734 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_COMPLETE;
+import static org.jocl.CL.CL_MEM_READ_WRITE;
+import static org.jocl.CL.CL_QUEUE_CONTEXT;
+import static org.jocl.CL.clCreateBuffer;
+import static org.jocl.CL.clEnqueueMarkerWithWaitList;
+import static org.jocl.CL.clFinish;
+import static org.jocl.CL.clFlush;
+import static org.jocl.CL.clGetCommandQueueInfo;
+import static org.jocl.CL.clReleaseEvent;
+import static org.jocl.CL.clReleaseMemObject;
+import static org.jocl.CL.clSetEventCallback;
+import static org.jocl.CL.clWaitForEvents;
+
+import java.nio.Buffer;
+import java.nio.DoubleBuffer;
+import java.nio.FloatBuffer;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import org.jocl.CLException;
+import org.jocl.EventCallbackFunction;
+import org.jocl.Pointer;
+import org.jocl.Sizeof;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * A GEMM that is partitioned across several devices. 
+ * <p>
+ * Instances of this class receive one command queue for each device. 
+ * All queues must belong to the same context. For each call, C is split
+ * into blocks of rows, and the size of each block is proportional to 
+ * the throughput that was measured for the respective device in the
+ * previous calls. The blocks of A are scattered to the devices, B is 
+ * replicated, and the GEMMs for all devices are enqueued concurrently.
+ * The calls return immediately, and an optional event is completed 
+ * when the whole result has been written back to the host.
+ * <p>
+ * All matrices are in row-major order, which makes the blocks of rows
+ * of A and C contiguous. The host buffers must be direct buffers, and
+ * must not be modified or released until the operation is complete. 
+ * For complex precisions, the buffers contain interleaved real and 
+ * imaginary parts, and the leading dimensions are given in complex 
+ * elements. Instances of this class are thread-safe, but calls are 
+ * serialized: Each call waits until the previous call is complete,
+ * because the device buffers are reused. The {@link #release()} 
+ * method must be called when the instance is no longer used.
+ */
+public final class CLBlastMultiGemm
+{
+    /**
+     * The weight of a new throughput measurement, in the exponential
+     * smoothing of the throughput of each device
+     */
+    private static final double SMOOTHING = 0.5;
+    
+    /**
+     * The device buffers for one queue
+     */
+    private static final class DeviceBuffers
+    {
+        /**
+         * The buffers for A, B and C
+         */
+        final cl_mem mems[] = new cl_mem[3];
+        
+        /**
+         * The sizes of the buffers, in bytes
+         */
+        final long sizes[] = new long[3];
+    }
+    
+    /**
+     * The queues, one for each device
+     */
+    private final cl_command_queue queues[];
+    
+    /**
+     * The context of the queues
+     */
+    private final cl_context context;
+    
+    /**
+     * The device buffers, one for each queue
+     */
+    private final DeviceBuffers deviceBuffers[];
+    
+    /**
+     * The measured throughput of each device, in FLOP per nanosecond,
+     * or 0 if it was not measured yet. Access is synchronized on the 
+     * array itself, because it is written by the event callbacks.
+     */
+    private final double throughputs[];
+    
+    /**
+     * The events for the completion of the previous call
+     */
+    private final List<cl_event> pendingEvents;
+    
+    /**
+     * The pointers to the host buffers of the previous call, which are
+     * kept until the call is complete
+     */
+    private final List<Pointer> pendingPointers;
+    
+    /**
+     * Whether this instance was released
+     */
+    private boolean released;
+    
+    /**
+     * Creates a new instance for the given queues
+     * 
+     * @param queues The queues, one for each device
+     * @throws IllegalArgumentException If no queues are given, or the
+     * queues do not belong to the same context
+     * @throws CLException If the queue information cannot be obtained
+     */
+    public CLBlastMultiGemm(cl_command_queue queues[])
+    {
+        if (queues == null || queues.length == 0)
+        {
+            throw new IllegalArgumentException("No queues given");
+        }
+        this.queues = queues.clone();
+        this.context = getContext(queues[0]);
+        for (int i = 1; i < queues.length; i++)
+        {
+            if (!context.equals(getContext(queues[i])))
+            {
+                throw new IllegalArgumentException(
+                    "All queues must belong to the same context");
+            }
+        }
+        this.deviceBuffers = new DeviceBuffers[queues.length];
+        for (int i = 0; i < queues.length; i++)
+        {
+            deviceBuffers[i] = new DeviceBuffers();
+        }
+        this.throughputs = new double[queues.length];
+        this.pendingEvents = new ArrayList<cl_event>();
+        this.pendingPointers = new ArrayList<Pointer>();
+    }
+    
+    /**
+     * Returns the fraction of the rows of C that will be assigned to each
+     * device in the next call. These are derived from the measured 
+     * throughputs. Devices whose throughput was not measured yet receive
+     * the average of the measured throughputs.
+     * 
+     * @return The weights, which sum up to 1.0
+     */
+    public double[] getWeights()
+    {
+        double result[] = new double[queues.length];
+        synchronized (throughputs)
+        {
+            double measuredSum = 0;
+            int measured = 0;
+            for (double throughput : throughputs)
+            {
+                if (throughput > 0)
+                {
+                    measuredSum += throughput;
+                    measured++;
+                }
+            }
+            double fallback = measured == 0 ? 1.0 : measuredSum / measured;
+            double sum = 0;
+            for (int i = 0; i < throughputs.length; i++)
+            {
+                result[i] = throughputs[i] > 0 ? throughputs[i] : fallback;
+                sum += result[i];
+            }
+            for (int i = 0; i < result.length; i++)
+            {
+                result[i] /= sum;
+            }
+        }
+        return result;
+    }
+    
+    /**
+     * Set the relative weights of the devices, for example, from a 
+     * previous run. This replaces the measured throughputs, which will
+     * be updated again by the following calls. A weight of 0 means that
+     * the throughput is unknown.
+     * 
+     * @param weights The weights, one for each queue
+     * @throws IllegalArgumentException If the number of weights does not
+     * match the number of queues, or a weight is negative
+     */
+    public void setWeights(double weights[])
+    {
+        if (weights.length != queues.length)
+        {
+            throw new IllegalArgumentException("Expected " + queues.length + 
+                " weights, but got " + weights.length);
+        }
+        for (double weight : weights)
+        {
+            if (!(weight >= 0))
+            {
+                throw new IllegalArgumentException(
+                    "The weights may not be negative: " + 
+                    Arrays.toString(weights));
+            }
+        }
+        synchronized (throughputs)
+        {
+            System.arraycopy(weights, 0, throughputs, 0, weights.length);
+        }
+    }
+    
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C in single precision,
+     * using all devices.
+     * 
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @param event An optional event that completes when C was written
+     * back to the host. It belongs to the first queue.
+     * @throws IllegalArgumentException If a dimension is not positive,
+     * a buffer is too small or not direct
+     * @throws IllegalStateException If this instance was released
+     * @throws CLException If an OpenCL or CLBlast call fails
+     */
+    public void sgemm(int a_transpose, int b_transpose, 
+        long m, long n, long k, float alpha, 
+        FloatBuffer a, long a_ld, FloatBuffer b, long b_ld, 
+        float beta, FloatBuffer c, long c_ld, cl_event event)
+    {
+        gemm(CLBlastPrecision.CLBlastPrecisionSingle, 
+            a_transpose, b_transpose, m, n, k, 
+            new double[] { alpha, 0 }, a, a_ld, b, b_ld, 
+            new double[] { beta, 0 }, c, c_ld, event);
+    }
+    
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C in double precision,
+     * using all devices.
+     * 
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @param event An optional event that completes when C was written
+     * back to the host. It belongs to the first queue.
+     * @throws IllegalArgumentException If a dimension is not positive,
+     * a buffer is too small or not direct
+     * @throws IllegalStateException If this instance was released
+     * @throws CLException If an OpenCL or CLBlast call fails
+     */
+    public void dgemm(int a_transpose, int b_transpose, 
+        long m, long n, long k, double alpha, 
+        DoubleBuffer a, long a_ld, DoubleBuffer b, long b_ld, 
+        double beta, DoubleBuffer c, long c_ld, cl_event event)
+    {
+        gemm(CLBlastPrecision.CLBlastPrecisionDouble, 
+            a_transpose, b_transpose, m, n, k, 
+            new double[] { alpha, 0 }, a, a_ld, b, b_ld, 
+            new double[] { beta, 0 }, c, c_ld, event);
+    }
+    
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C in complex single 
+     * precision, using all devices.
+     * 
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value, as a (real, imaginary) pair
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value, as a (real, imaginary) pair
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @param event An optional event that completes when C was written
+     * back to the host. It belongs to the first queue.
+     * @throws IllegalArgumentException If a dimension is not positive,
+     * a buffer is too small or not direct
+     * @throws IllegalStateException If this instance was released
+     * @throws CLException If an OpenCL or CLBlast call fails
+     */
+    public void cgemm(int a_transpose, int b_transpose, 
+        long m, long n, long k, float alpha[], 
+        FloatBuffer a, long a_ld, FloatBuffer b, long b_ld, 
+        float beta[], FloatBuffer c, long c_ld, cl_event event)
+    {
+        gemm(CLBlastPrecision.CLBlastPrecisionComplexSingle, 
+            a_transpose, b_transpose, m, n, k, 
+            new double[] { alpha[0], alpha[1] }, a, a_ld, b, b_ld, 
+            new double[] { beta[0], beta[1] }, c, c_ld, event);
+    }
+    
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C in complex double 
+     * precision, using all devices.
+     * 
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value, as a (real, imaginary) pair
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value, as a (real, imaginary) pair
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @param event An optional event that completes when C was written
+     * back to the host. It belongs to the first queue.
+     * @throws IllegalArgumentException If a dimension is not positive,
+     * a buffer is too small or not direct
+     * @throws IllegalStateException If this instance was released
+     * @throws CLException If an OpenCL or CLBlast call fails
+     */
+    public void zgemm(int a_transpose, int b_transpose, 
+        long m, long n, long k, double alpha[], 
+        DoubleBuffer a, long a_ld, DoubleBuffer b, long b_ld, 
+        double beta[], DoubleBuffer c, long c_ld, cl_event event)
+    {
+        gemm(CLBlastPrecision.CLBlastPrecisionComplexDouble, 
+            a_transpose, b_transpose, m, n, k, 
+            alpha.clone(), a, a_ld, b, b_ld, beta.clone(), c, c_ld, event);
+    }
+    
+    /**
+     * Implementation of the multi-device GEMM for all precisions
+     * 
+     * @param precision The {@link CLBlastPrecision}
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value, as a (real, imaginary) pair
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value, as a (real, imaginary) pair
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @param event The optional completion event
+     */
+    private synchronized void gemm(int precision, 
+        int a_transpose, int b_transpose, long m, long n, long k, 
+        double alpha[], Buffer a, long a_ld, Buffer b, long b_ld, 
+        double beta[], Buffer c, long c_ld, cl_event event)
+    {
+        checkNotReleased();
+        if (m <= 0 || n <= 0 || k <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The dimensions must be positive, but are m=" + m + 
+                ", n=" + n + ", k=" + k);
+        }
+        boolean transposeA = 
+            a_transpose != CLBlastTranspose.CLBlastTransposeNo;
+        boolean transposeB = 
+            b_transpose != CLBlastTranspose.CLBlastTransposeNo;
+        boolean complex = CLBlastTiledGemm.isComplex(precision);
+        long elementSize = CLBlastTiledGemm.elementSize(precision);
+        long componentsPerElement = complex ? 2 : 1;
+        long bRows = transposeB ? n : k;
+        long bCols = transposeB ? k : n;
+        CLBlastTiledGemm.checkSize(a, transposeA ? k : m, 
+            transposeA ? m : k, a_ld, componentsPerElement, "a");
+        CLBlastTiledGemm.checkSize(b, bRows, bCols, b_ld, 
+            componentsPerElement, "b");
+        CLBlastTiledGemm.checkSize(c, m, n, c_ld, 
+            componentsPerElement, "c");
+        
+        // The device buffers are reused, so the previous call has to 
+        // be complete
+        finishPending();
+        
+        Pointer aPointer = CLBlastTiledGemm.pointerTo(a);
+        Pointer bPointer = CLBlastTiledGemm.pointerTo(b);
+        Pointer cPointer = CLBlastTiledGemm.pointerTo(c);
+        pendingPointers.add(aPointer);
+        pendingPointers.add(bPointer);
+        pendingPointers.add(cPointer);
+        
+        long rowCounts[] = partition(m, getWeights());
+        boolean success = false;
+        try
+        {
+            long row = 0;
+            for (int d = 0; d < queues.length; d++)
+            {
+                long rows = rowCounts[d];
+                if (rows == 0)
+                {
+                    continue;
+                }
+                cl_command_queue queue = queues[d];
+                DeviceBuffers buffers = deviceBuffers[d];
+                ensureSize(buffers, 0, rows * k * elementSize);
+                ensureSize(buffers, 1, bRows * bCols * elementSize);
+                ensureSize(buffers, 2, rows * n * elementSize);
+                cl_mem aDevice = buffers.mems[0];
+                cl_mem bDevice = buffers.mems[1];
+                cl_mem cDevice = buffers.mems[2];
+                long startNs = System.nanoTime();
+                
+                // Scatter the block of A, replicate B, and upload the
+                // block of C. C is uploaded even if beta is 0, because 
+                // the device buffer may contain NaN values.
+                long aLd = transposeA ? rows : k;
+                if (transposeA)
+                {
+                    CLBlastTiledGemm.transfer(queue, true, aDevice, aPointer, 
+                        0, row, k, rows, aLd, a_ld, elementSize, null, null);
+                }
+                else
+                {
+                    CLBlastTiledGemm.transfer(queue, true, aDevice, aPointer, 
+                        row, 0, rows, k, aLd, a_ld, elementSize, null, null);
+                }
+                CLBlastTiledGemm.transfer(queue, true, bDevice, bPointer, 
+                    0, 0, bRows, bCols, bCols, b_ld, elementSize, null, null);
+                CLBlastTiledGemm.transfer(queue, true, cDevice, cPointer, 
+                    row, 0, rows, n, n, c_ld, elementSize, null, null);
+                
+                // The queue is in-order, so no wait lists are required
+                CLBlastTiledGemm.enqueueGemm(precision, 
+                    a_transpose, b_transpose, rows, n, k, 
+                    alpha, aDevice, aLd, bDevice, bCols, beta, cDevice, n, 
+                    queue, null, null);
+                
+                cl_event done = new cl_event();
+                CLBlastTiledGemm.transfer(queue, false, cDevice, cPointer, 
+                    row, 0, rows, n, n, c_ld, elementSize, null, done);
+                pendingEvents.add(done);
+                clFlush(queue);
+                
+                double flops = 2.0 * rows * n * k * (complex ? 4 : 1);
+                clSetEventCallback(done, CL_COMPLETE, 
+                    createCallback(d, flops, startNs), null);
+                row += rows;
+            }
+            if (event != null)
+            {
+                cl_event waitList[] = 
+                    pendingEvents.toArray(new cl_event[0]);
+                CLBlastTiledGemm.check(clEnqueueMarkerWithWaitList(queues[0], 
+                    waitList.length, waitList, event), 
+                    "clEnqueueMarkerWithWaitList");
+                clFlush(queues[0]);
+            }
+            success = true;
+        }
+        finally
+        {
+            // When an exception was thrown, there may still be pending
+            // operations that use the host buffers
+            if (!success)
+            {
+                for (cl_command_queue queue : queues)
+                {
+                    clFinish(queue);
+                }
+                finishPending();
+            }
+        }
+    }
+    
+    /**
+     * Split the given number of rows according to the given weights.
+     * The remainder of the rounding is assigned to the devices with
+     * the largest weights.
+     * 
+     * @param m The number of rows
+     * @param weights The weights, summing up to 1.0
+     * @return The number of rows for each device
+     */
+    static long[] partition(long m, double weights[])
+    {
+        long result[] = new long[weights.length];
+        long assigned = 0;
+        for (int i = 0; i < weights.length; i++)
+        {
+            result[i] = (long)Math.floor(m * weights[i]);
+            assigned += result[i];
+        }
+        while (assigned < m)
+        {
+            int best = 0;
+            double bestRemainder = -1;
+            for (int i = 0; i < weights.length; i++)
+            {
+                double remainder = m * weights[i] - result[i];
+                if (remainder > bestRemainder)
+                {
+                    best = i;
+                    bestRemainder = remainder;
+                }
+            }
+            result[best]++;
+            assigned++;
+        }
+        return result;
+    }
+    
+    /**
+     * Creates the callback that records the throughput of the given
+     * device when its part of a call is complete
+     * 
+     * @param index The index of the device
+     * @param flops The number of floating point operations of the part
+     * @param startNs The time when the part was enqueued
+     * @return The callback
+     */
+    private EventCallbackFunction createCallback(
+        final int index, final double flops, final long startNs)
+    {
+        return new EventCallbackFunction()
+        {
+            @Override
+            public void function(cl_event event, 
+                int command_exec_callback_type, Object user_data)
+            {
+                // A negative status indicates an error
+                if (command_exec_callback_type < 0)
+                {
+                    return;
+                }
+                long elapsedNs = Math.max(1, System.nanoTime() - startNs);
+                double throughput = flops / elapsedNs;
+                synchronized (throughputs)
+                {
+                    if (throughputs[index] > 0)
+                    {
+                        throughputs[index] = SMOOTHING * throughput + 
+                            (1.0 - SMOOTHING) * throughputs[index];
+                    }
+                    else
+                    {
+                        throughputs[index] = throughput;
+                    }
+                }
+            }
+        };
+    }
+    
+    /**
+     * Make sure that the buffer with the given index has at least the
+     * given size
+     * 
+     * @param buffers The device buffers
+     * @param index The index of the buffer
+     * @param size The size, in bytes
+     * @throws CLException If the buffer cannot be created
+     */
+    private void ensureSize(DeviceBuffers buffers, int index, long size)
+    {
+        if (buffers.mems[index] != null && buffers.sizes[index] >= size)
+        {
+            return;
+        }
+        if (buffers.mems[index] != null)
+        {
+            clReleaseMemObject(buffers.mems[index]);
+            buffers.mems[index] = null;
+            buffers.sizes[index] = 0;
+        }
+        int errorCode[] = new int[1];
+        cl_mem mem = clCreateBuffer(
+            context, CL_MEM_READ_WRITE, size, null, errorCode);
+        CLBlastTiledGemm.check(errorCode[0], "clCreateBuffer");
+        buffers.mems[index] = mem;
+        buffers.sizes[index] = size;
+    }
+    
+    /**
+     * Wait until the previous call is complete
+     * 
+     * @throws IllegalStateException If this instance was released
+     * @throws CLException If the previous call failed
+     */
+    public synchronized void finish()
+    {
+        checkNotReleased();
+        finishPending();
+    }
+    
+    /**
+     * Wait for the pending events of the previous call, and release them
+     * 
+     * @throws CLException If the previous call failed
+     */
+    private void finishPending()
+    {
+        if (pendingEvents.isEmpty())
+        {
+            pendingPointers.clear();
+            return;
+        }
+        cl_event events[] = pendingEvents.toArray(new cl_event[0]);
+        pendingEvents.clear();
+        pendingPointers.clear();
+        try
+        {
+            CLBlastTiledGemm.check(
+                clWaitForEvents(events.length, events), "clWaitForEvents");
+        }
+        finally
+        {
+            for (cl_event e : events)
+            {
+                clReleaseEvent(e);
+            }
+        }
+    }
+    
+    /**
+     * Release all resources of this instance, after the previous call
+     * is complete. Afterwards, the instance may no longer be used. The
+     * queues are not released.
+     */
+    public synchronized void release()
+    {
+        if (released)
+        {
+            return;
+        }
+        try
+        {
+            finishPending();
+        }
+        finally
+        {
+            for (DeviceBuffers buffers : deviceBuffers)
+            {
+                for (cl_mem mem : buffers.mems)
+                {
+                    if (mem != null)
+                    {
+                        clReleaseMemObject(mem);
+                    }
+                }
+            }
+            released = true;
+        }
+    }
+    
+    /**
+     * Make sure that this instance was not released
+     * 
+     * @throws IllegalStateException If this instance was released
+     */
+    private void checkNotReleased()
+    {
+        if (released)
+        {
+            throw new IllegalStateException(
+                "The CLBlastMultiGemm was released");
+        }
+    }
+    
+    /**
+     * Returns the context of the given queue
+     * 
+     * @param queue The queue
+     * @return The context
+     */
+    private static cl_context getContext(cl_command_queue queue)
+    {
+        cl_context context = new cl_context();
+        CLBlastTiledGemm.check(clGetCommandQueueInfo(queue, CL_QUEUE_CONTEXT, 
+            Sizeof.cl_context, Pointer.to(context), null), 
+            "clGetCommandQueueInfo");
+        return context;
+    }
+}
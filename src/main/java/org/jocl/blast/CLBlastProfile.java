@@ -0,0 +1,424 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.Locale;
+
+/**
+ * A snapshot of the device-side profile of the calls of the 
+ * {@link CLBlast} routines, as returned by {@link CLBlast#getProfile()}.
+ * <p>
+ * The profile is only collected when it has been enabled with
+ * {@link CLBlast#setProfilingEnabled(boolean)}. It contains one 
+ * {@link Entry} for each combination of routine, device and shape, where
+ * the shape consists of the dimensions of the call, like 
+ * <code>"m=1024, n=1024, k=512"</code>. Each entry contains a histogram
+ * of the device times of the calls, together with the number of floating
+ * point operations and bytes per call, so that the achieved throughput
+ * can be compared with the peak performance and bandwidth of the device.
+ * <p>
+ * The number of floating point operations and bytes are the usual
+ * estimates for the respective operation. For example, a GEMM counts
+ * <code>2*m*n*k</code> operations, and the bytes of A and B, and of C
+ * for reading and writing. A complex multiply-add counts as 4 real
+ * operations. The actual memory traffic depends on caches and on the
+ * kernels that are chosen by CLBlast.
+ */
+public final class CLBlastProfile
+{
+    /**
+     * The number of buckets of the duration histograms
+     */
+    public static final int BUCKET_COUNT = 48;
+
+    /**
+     * The number of values for each entry that are passed from the 
+     * native library
+     */
+    private static final int ENTRY_VALUES = 6 + BUCKET_COUNT;
+
+    /**
+     * The profile of one routine, on one device, for one shape
+     */
+    public static final class Entry
+    {
+        /**
+         * The name of the routine
+         */
+        private final String routine;
+
+        /**
+         * The name of the device
+         */
+        private final String device;
+
+        /**
+         * The shape of the calls
+         */
+        private final String shape;
+
+        /**
+         * The number of calls
+         */
+        private final long calls;
+
+        /**
+         * The total device time, in nanoseconds
+         */
+        private final long totalNanos;
+
+        /**
+         * The minimum device time, in nanoseconds
+         */
+        private final long minNanos;
+
+        /**
+         * The maximum device time, in nanoseconds
+         */
+        private final long maxNanos;
+
+        /**
+         * The number of floating point operations of each call
+         */
+        private final long flops;
+
+        /**
+         * The number of bytes of each call
+         */
+        private final long bytes;
+
+        /**
+         * The histogram of the device times
+         */
+        private final long histogram[];
+
+        /**
+         * Creates a new instance from the given values, starting at the
+         * given offset
+         *
+         * @param routine The routine name
+         * @param device The device name
+         * @param shape The shape
+         * @param values The values
+         * @param offset The offset
+         */
+        Entry(String routine, String device, String shape,
+            long values[], int offset)
+        {
+            this.routine = routine;
+            this.device = device;
+            this.shape = shape;
+            this.calls = values[offset + 0];
+            this.totalNanos = values[offset + 1];
+            this.minNanos = values[offset + 2];
+            this.maxNanos = values[offset + 3];
+            this.flops = values[offset + 4];
+            this.bytes = values[offset + 5];
+            this.histogram = new long[BUCKET_COUNT];
+            System.arraycopy(values, offset + 6, histogram, 0, BUCKET_COUNT);
+        }
+
+        /**
+         * Returns the name of the routine, e.g. <code>"CLBlastSgemm"</code>
+         *
+         * @return The name
+         */
+        public String getRoutine()
+        {
+            return routine;
+        }
+
+        /**
+         * Returns the name of the device, as given by 
+         * <code>CL_DEVICE_NAME</code>
+         *
+         * @return The device name
+         */
+        public String getDevice()
+        {
+            return device;
+        }
+
+        /**
+         * Returns the shape of the calls, as a comma-separated list of
+         * the dimension parameters and their values
+         *
+         * @return The shape
+         */
+        public String getShape()
+        {
+            return shape;
+        }
+
+        /**
+         * Returns the number of calls that have completed on the device
+         *
+         * @return The number of calls
+         */
+        public long getCalls()
+        {
+            return calls;
+        }
+
+        /**
+         * Returns the total device time of all calls, in nanoseconds
+         *
+         * @return The total device time
+         */
+        public long getTotalNanos()
+        {
+            return totalNanos;
+        }
+
+        /**
+         * Returns the minimum device time of a call, in nanoseconds
+         *
+         * @return The minimum device time
+         */
+        public long getMinNanos()
+        {
+            return minNanos;
+        }
+
+        /**
+         * Returns the maximum device time of a call, in nanoseconds
+         *
+         * @return The maximum device time
+         */
+        public long getMaxNanos()
+        {
+            return maxNanos;
+        }
+
+        /**
+         * Returns the estimated number of floating point operations of 
+         * one call
+         *
+         * @return The number of floating point operations
+         */
+        public long getFlops()
+        {
+            return flops;
+        }
+
+        /**
+         * Returns the estimated number of bytes that are read or written
+         * by one call
+         *
+         * @return The number of bytes
+         */
+        public long getBytes()
+        {
+            return bytes;
+        }
+
+        /**
+         * Returns the average throughput of the calls, in GFLOP/s
+         *
+         * @return The average throughput
+         */
+        public double getGflops()
+        {
+            if (totalNanos == 0)
+            {
+                return 0.0;
+            }
+            return (double)flops * calls / totalNanos;
+        }
+
+        /**
+         * Returns the peak throughput of the calls, which is achieved by
+         * the fastest call, in GFLOP/s
+         *
+         * @return The peak throughput
+         */
+        public double getPeakGflops()
+        {
+            if (minNanos == 0)
+            {
+                return 0.0;
+            }
+            return (double)flops / minNanos;
+        }
+
+        /**
+         * Returns the average bandwidth of the calls, in GB/s
+         *
+         * @return The average bandwidth
+         */
+        public double getBandwidth()
+        {
+            if (totalNanos == 0)
+            {
+                return 0.0;
+            }
+            return (double)bytes * calls / totalNanos;
+        }
+
+        /**
+         * Returns the arithmetic intensity of the calls, in FLOPs per
+         * byte, which is the x-coordinate in a roofline diagram
+         *
+         * @return The arithmetic intensity
+         */
+        public double getArithmeticIntensity()
+        {
+            if (bytes == 0)
+            {
+                return 0.0;
+            }
+            return (double)flops / bytes;
+        }
+
+        /**
+         * Returns a copy of the histogram of the device times. The 
+         * element <code>i</code> contains the number of calls whose 
+         * device time <code>d</code> in nanoseconds was in the range 
+         * given by {@link CLBlastProfile#getBucketMinNanos(int)}.
+         *
+         * @return The histogram
+         */
+        public long[] getHistogram()
+        {
+            return histogram.clone();
+        }
+
+        @Override
+        public String toString()
+        {
+            return String.format(Locale.ENGLISH,
+                "%s[device=%s, shape=(%s), calls=%d, totalNanos=%d, " +
+                "gflops=%.3f, bandwidth=%.3f]",
+                routine, device, shape, calls, totalNanos, 
+                getGflops(), getBandwidth());
+        }
+    }
+
+    /**
+     * The entries
+     */
+    private final List<Entry> entries;
+
+    /**
+     * Creates a new snapshot from the given data. The strings contain the
+     * routine name, device name and shape of each entry. The values 
+     * contain the number of calls, total, minimum and maximum device 
+     * time, the FLOPs and bytes per call, and the histogram of each 
+     * entry.
+     *
+     * @param strings The strings
+     * @param values The values
+     */
+    CLBlastProfile(String strings[], long values[])
+    {
+        List<Entry> entryList = new ArrayList<Entry>();
+        for (int i = 0; i < strings.length / 3; i++)
+        {
+            entryList.add(new Entry(strings[i * 3 + 0], strings[i * 3 + 1], 
+                strings[i * 3 + 2], values, i * ENTRY_VALUES));
+        }
+        this.entries = Collections.unmodifiableList(entryList);
+    }
+
+    /**
+     * Returns the minimum device time, in nanoseconds, for the histogram
+     * bucket with the given index. The bucket <code>i</code> contains 
+     * the device times that are at least <code>2^i</code> nanoseconds
+     * and less than <code>2^(i+1)</code> nanoseconds. The bucket 0 also
+     * contains times of 0 nanoseconds, and the last bucket contains all
+     * larger times.
+     *
+     * @param index The bucket index
+     * @return The minimum device time
+     * @throws IndexOutOfBoundsException If the index is negative or not
+     * smaller than {@link #BUCKET_COUNT}
+     */
+    public static long getBucketMinNanos(int index)
+    {
+        if (index < 0 || index >= BUCKET_COUNT)
+        {
+            throw new IndexOutOfBoundsException(
+                "Bucket index must be in [0," + BUCKET_COUNT + 
+                "), but is " + index);
+        }
+        return index == 0 ? 0 : (1L << index);
+    }
+
+    /**
+     * Returns an unmodifiable list with all entries
+     *
+     * @return The entries
+     */
+    public List<Entry> getEntries()
+    {
+        return entries;
+    }
+
+    /**
+     * Returns an unmodifiable list with the entries of the routine with 
+     * the given name
+     *
+     * @param routine The name, e.g. <code>"CLBlastSgemm"</code>
+     * @return The entries
+     */
+    public List<Entry> getEntries(String routine)
+    {
+        List<Entry> result = new ArrayList<Entry>();
+        for (Entry entry : entries)
+        {
+            if (entry.getRoutine().equals(routine))
+            {
+                result.add(entry);
+            }
+        }
+        return Collections.unmodifiableList(result);
+    }
+
+    @Override
+    public String toString()
+    {
+        StringBuilder sb = new StringBuilder();
+        sb.append(String.format(Locale.ENGLISH,
+            "%-28s %-24s %-36s %10s %12s %10s %10s%n",
+            "Routine", "Device", "Shape", "Calls", "Mean us", 
+            "GFLOP/s", "GB/s"));
+        for (Entry entry : entries)
+        {
+            double meanMicros = entry.getCalls() == 0 ? 0.0 :
+                entry.getTotalNanos() / 1e3 / entry.getCalls();
+            sb.append(String.format(Locale.ENGLISH,
+                "%-28s %-24s %-36s %10d %12.1f %10.2f %10.2f%n",
+                entry.getRoutine(), entry.getDevice(), entry.getShape(),
+                entry.getCalls(), meanMicros, entry.getGflops(), 
+                entry.getBandwidth()));
+        }
+        return sb.toString();
+    }
+}
@@ -0,0 +1,1735 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.Future;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.TimeoutException;
+
+import org.jocl.CL;
+import org.jocl.CLException;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * Variants of the CLBlast reduction routines that return their result
+ * directly, or through a future, instead of writing it into a 
+ * <code>cl_mem</code> that has to be read by the caller.
+ * <p>
+ * The results are written into small result buffers that are kept in a
+ * pool for each context. The routine and the read operation of the 
+ * result are enqueued with a single native call, and the result is read
+ * into pinned host memory. For example:
+ * <pre><code>
+ * float norm = CLBlastReduction.Snrm2(n, x, 0, 1, queue);
+ *
+ * CLBlastReduction dot = CLBlastReduction.SdotAsync(
+ *     n, x, 0, 1, y, 0, 1, queue);
+ * ...
+ * float value = dot.get().floatValue();
+ * </code></pre>
+ * The methods without the <code>Async</code> suffix block until the 
+ * result is available. The <code>Async</code> methods return a future
+ * that receives the result as a <code>Float</code>, <code>Double</code>,
+ * or, for the index routines, as a <code>Long</code>. The computation is
+ * flushed to the device, but cannot be cancelled.
+ * <p>
+ * In contrast to the methods of the {@link CLBlast} class, these methods 
+ * always throw a <code>CLException</code> if the routine or the read
+ * operation fails, because there is no status code that could be 
+ * returned. The future of an asynchronous call that failed throws an
+ * <code>ExecutionException</code> that has the <code>CLException</code>
+ * as its cause.
+ * <p>
+ * The result buffers of a context are kept until {@link #trim()} is
+ * called. 
+ */
+public final class CLBlastReduction implements Future<Number>
+{
+    // Initialization of the native library
+    static
+    {
+        CLBlast.initialize();
+    }
+    
+    /**
+     * The interval for checking whether the waiting thread was interrupted,
+     * in milliseconds
+     */
+    private static final long WAIT_INTERVAL_MS = 100;
+    
+    // The routine IDs. The order must match the order of the routines 
+    // in JOCLBlastReduction.cpp
+    private static final int SDOT = 0;
+    private static final int DDOT = 1;
+    private static final int SNRM2 = 2;
+    private static final int DNRM2 = 3;
+    private static final int SCNRM2 = 4;
+    private static final int DZNRM2 = 5;
+    private static final int SASUM = 6;
+    private static final int DASUM = 7;
+    private static final int SCASUM = 8;
+    private static final int DZASUM = 9;
+    private static final int SSUM = 10;
+    private static final int DSUM = 11;
+    private static final int SCSUM = 12;
+    private static final int DZSUM = 13;
+    private static final int ISAMAX = 14;
+    private static final int IDAMAX = 15;
+    private static final int ICAMAX = 16;
+    private static final int IZAMAX = 17;
+    private static final int ISAMIN = 18;
+    private static final int IDAMIN = 19;
+    private static final int ICAMIN = 20;
+    private static final int IZAMIN = 21;
+    private static final int ISMAX = 22;
+    private static final int IDMAX = 23;
+    private static final int ICMAX = 24;
+    private static final int IZMAX = 25;
+    private static final int ISMIN = 26;
+    private static final int IDMIN = 27;
+    private static final int ICMIN = 28;
+    private static final int IZMIN = 29;
+    
+    // The types of the results
+    static final int TYPE_FLOAT = 0;
+    static final int TYPE_DOUBLE = 1;
+    static final int TYPE_INDEX = 2;
+    
+    /**
+     * The handle of the native task, or 0 when the result was obtained
+     */
+    private long handle;
+    
+    /**
+     * The type of the result
+     */
+    private final int type;
+    
+    /**
+     * The result, once the computation is done
+     */
+    private Number result;
+    
+    /**
+     * The exception, if the computation failed
+     */
+    private CLException exception;
+    
+
+    // Dot product of two vectors: SDOT/DDOT
+    public static float Sdot(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue)
+    {
+        return Sdot(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null);
+    }
+
+    public static float Sdot(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (float)reduceNative(SDOT, n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList);
+    }
+
+    public static CLBlastReduction SdotAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue)
+    {
+        return SdotAsync(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null);
+    }
+
+    public static CLBlastReduction SdotAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(SDOT, n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList), TYPE_FLOAT);
+    }
+
+
+    public static double Ddot(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue)
+    {
+        return Ddot(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null);
+    }
+
+    public static double Ddot(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (double)reduceNative(DDOT, n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList);
+    }
+
+    public static CLBlastReduction DdotAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue)
+    {
+        return DdotAsync(n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, null);
+    }
+
+    public static CLBlastReduction DdotAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(DDOT, n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, waitList), TYPE_DOUBLE);
+    }
+
+
+    // Euclidian norm of a vector: SNRM2/DNRM2/ScNRM2/DzNRM2
+    public static float Snrm2(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Snrm2(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static float Snrm2(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (float)reduceNative(SNRM2, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction Snrm2Async(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Snrm2Async(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction Snrm2Async(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(SNRM2, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_FLOAT);
+    }
+
+
+    public static double Dnrm2(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Dnrm2(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static double Dnrm2(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (double)reduceNative(DNRM2, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction Dnrm2Async(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Dnrm2Async(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction Dnrm2Async(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(DNRM2, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_DOUBLE);
+    }
+
+
+    public static float Scnrm2(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Scnrm2(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static float Scnrm2(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (float)reduceNative(SCNRM2, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction Scnrm2Async(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Scnrm2Async(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction Scnrm2Async(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(SCNRM2, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_FLOAT);
+    }
+
+
+    public static double Dznrm2(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Dznrm2(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static double Dznrm2(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (double)reduceNative(DZNRM2, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction Dznrm2Async(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Dznrm2Async(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction Dznrm2Async(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(DZNRM2, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_DOUBLE);
+    }
+
+
+    // Absolute sum of values in a vector: SASUM/DASUM/ScASUM/DzASUM
+    public static float Sasum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Sasum(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static float Sasum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (float)reduceNative(SASUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction SasumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return SasumAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction SasumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(SASUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_FLOAT);
+    }
+
+
+    public static double Dasum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Dasum(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static double Dasum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (double)reduceNative(DASUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction DasumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return DasumAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction DasumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(DASUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_DOUBLE);
+    }
+
+
+    public static float Scasum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Scasum(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static float Scasum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (float)reduceNative(SCASUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction ScasumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return ScasumAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction ScasumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(SCASUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_FLOAT);
+    }
+
+
+    public static double Dzasum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Dzasum(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static double Dzasum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (double)reduceNative(DZASUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction DzasumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return DzasumAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction DzasumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(DZASUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_DOUBLE);
+    }
+
+
+    // Sum of values in a vector (non-BLAS function): SSUM/DSUM/ScSUM/DzSUM
+    public static float Ssum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Ssum(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static float Ssum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (float)reduceNative(SSUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction SsumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return SsumAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction SsumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(SSUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_FLOAT);
+    }
+
+
+    public static double Dsum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Dsum(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static double Dsum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (double)reduceNative(DSUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction DsumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return DsumAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction DsumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(DSUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_DOUBLE);
+    }
+
+
+    public static float Scsum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Scsum(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static float Scsum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (float)reduceNative(SCSUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction ScsumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return ScsumAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction ScsumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(SCSUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_FLOAT);
+    }
+
+
+    public static double Dzsum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return Dzsum(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static double Dzsum(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (double)reduceNative(DZSUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction DzsumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return DzsumAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction DzsumAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(DZSUM, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_DOUBLE);
+    }
+
+
+    // Index of absolute maximum value in a vector: iSAMAX/iDAMAX/iCAMAX/iZAMAX
+    public static long iSamax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iSamax(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iSamax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(ISAMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iSamaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iSamaxAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iSamaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(ISAMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iDamax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iDamax(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iDamax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(IDAMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iDamaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iDamaxAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iDamaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(IDAMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iCamax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iCamax(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iCamax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(ICAMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iCamaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iCamaxAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iCamaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(ICAMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iZamax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iZamax(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iZamax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(IZAMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iZamaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iZamaxAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iZamaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(IZAMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    // Index of absolute minimum value in a vector (non-BLAS function): iSAMIN/iDAMIN/iCAMIN/iZAMIN
+    public static long iSamin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iSamin(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iSamin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(ISAMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iSaminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iSaminAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iSaminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(ISAMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iDamin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iDamin(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iDamin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(IDAMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iDaminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iDaminAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iDaminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(IDAMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iCamin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iCamin(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iCamin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(ICAMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iCaminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iCaminAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iCaminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(ICAMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iZamin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iZamin(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iZamin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(IZAMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iZaminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iZaminAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iZaminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(IZAMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    // Index of maximum value in a vector (non-BLAS function): iSMAX/iDMAX/iCMAX/iZMAX
+    public static long iSmax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iSmax(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iSmax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(ISMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iSmaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iSmaxAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iSmaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(ISMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iDmax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iDmax(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iDmax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(IDMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iDmaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iDmaxAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iDmaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(IDMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iCmax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iCmax(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iCmax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(ICMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iCmaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iCmaxAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iCmaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(ICMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iZmax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iZmax(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iZmax(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(IZMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iZmaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iZmaxAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iZmaxAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(IZMAX, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    // Index of minimum value in a vector (non-BLAS function): iSMIN/iDMIN/iCMIN/iZMIN
+    public static long iSmin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iSmin(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iSmin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(ISMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iSminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iSminAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iSminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(ISMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iDmin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iDmin(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iDmin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(IDMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iDminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iDminAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iDminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(IDMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iCmin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iCmin(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iCmin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(ICMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iCminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iCminAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iCminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(ICMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    public static long iZmin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iZmin(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static long iZmin(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return (long)reduceNative(IZMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList);
+    }
+
+    public static CLBlastReduction iZminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue)
+    {
+        return iZminAsync(n, x_buffer, x_offset, x_inc, queue, null);
+    }
+
+    public static CLBlastReduction iZminAsync(
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[])
+    {
+        return new CLBlastReduction(
+            reduceAsyncNative(IZMIN, n, x_buffer, x_offset, x_inc, null, 0, 0, queue, waitList), TYPE_INDEX);
+    }
+
+
+    /**
+     * Release the result buffers of all contexts for which no result is 
+     * currently pending. 
+     */
+    public static void trim()
+    {
+        trimNative();
+    }
+    private static native void trimNative();
+    
+    /**
+     * Throws a CLException for the given status. This is called from the 
+     * native code when a routine or the read operation of its result
+     * failed.
+     * 
+     * @param function The name of the routine
+     * @param status The status code
+     * @throws CLException Always
+     */
+    private static void throwStatus(String function, int status)
+    {
+        throw createException(function, status);
+    }
+
+    /**
+     * Create the exception for the given status
+     * 
+     * @param function The name of the routine
+     * @param status The status code
+     * @return The exception
+     */
+    private static CLException createException(String function, int status)
+    {
+        return new CLException(function + " failed: " + 
+            CLBlastStatusCode.stringFor(status), status);
+    }
+    
+    private static native double reduceNative(
+        int routine, 
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[]);
+    
+    private static native long reduceAsyncNative(
+        int routine, 
+        long n, 
+        cl_mem x_buffer, 
+        long x_offset, 
+        long x_inc, 
+        cl_mem y_buffer, 
+        long y_offset, 
+        long y_inc, 
+        cl_command_queue queue, 
+        cl_event waitList[]);
+    
+    /**
+     * Private constructor
+     * 
+     * @param handle The native handle
+     * @param type The type of the result
+     */
+    private CLBlastReduction(long handle, int type)
+    {
+        this.handle = handle;
+        this.type = type;
+    }
+    
+    /**
+     * The computation cannot be cancelled, so this always returns
+     * <code>false</code>
+     */
+    @Override
+    public boolean cancel(boolean mayInterruptIfRunning)
+    {
+        return false;
+    }
+
+    @Override
+    public boolean isCancelled()
+    {
+        return false;
+    }
+
+    @Override
+    public boolean isDone()
+    {
+        return poll(0);
+    }
+
+    @Override
+    public Number get() throws InterruptedException, ExecutionException
+    {
+        while (true)
+        {
+            if (await(WAIT_INTERVAL_MS))
+            {
+                return obtainResult();
+            }
+        }
+    }
+
+    @Override
+    public Number get(long timeout, TimeUnit unit)
+        throws InterruptedException, ExecutionException, TimeoutException
+    {
+        long remainingMs = unit.toMillis(timeout);
+        while (true)
+        {
+            long waitMs = Math.min(remainingMs, WAIT_INTERVAL_MS);
+            if (await(waitMs))
+            {
+                return obtainResult();
+            }
+            remainingMs -= waitMs;
+            if (remainingMs <= 0)
+            {
+                throw new TimeoutException(
+                    "Reduction not finished after " + timeout + " " + unit);
+            }
+        }
+    }
+    
+    /**
+     * Returns the result, or throws the exception if the computation
+     * failed. This may only be called when the computation is done.
+     * 
+     * @return The result
+     * @throws ExecutionException If the computation failed
+     */
+    private synchronized Number obtainResult() throws ExecutionException
+    {
+        if (exception != null)
+        {
+            throw new ExecutionException(exception);
+        }
+        return result;
+    }
+    
+    /**
+     * Wait for the given time until the computation is done. 
+     * 
+     * @param timeoutMs The timeout, in milliseconds
+     * @return Whether the computation is done
+     * @throws InterruptedException If the current thread was interrupted
+     */
+    private boolean await(long timeoutMs) throws InterruptedException
+    {
+        if (Thread.interrupted())
+        {
+            throw new InterruptedException();
+        }
+        return poll(timeoutMs);
+    }
+    
+    /**
+     * Wait for the given time until the native task is done. If it is 
+     * done, then the result or exception is stored, and the native task
+     * is released.
+     * 
+     * @param timeoutMs The timeout, in milliseconds
+     * @return Whether the computation is done
+     */
+    private synchronized boolean poll(long timeoutMs)
+    {
+        if (handle == 0)
+        {
+            return true;
+        }
+        if (!waitNative(handle, timeoutMs))
+        {
+            return false;
+        }
+        int status = getStatusNative(handle);
+        if (status != CL.CL_SUCCESS)
+        {
+            exception = createException("CLBlastReduction", status);
+        }
+        else
+        {
+            result = toResult(type, getValueNative(handle));
+        }
+        releaseNative(handle);
+        handle = 0;
+        return true;
+    }
+    
+    /**
+     * Convert the value that was read from the native task into the 
+     * result of the given type. Index results are stored as doubles,
+     * which represent all indices below 2^53 exactly.
+     * 
+     * @param type The type of the result
+     * @param value The value
+     * @return The result
+     */
+    static Number toResult(int type, double value)
+    {
+        if (type == TYPE_FLOAT)
+        {
+            return Float.valueOf((float)value);
+        }
+        if (type == TYPE_DOUBLE)
+        {
+            return Double.valueOf(value);
+        }
+        return Long.valueOf((long)value);
+    }
+    private static native boolean waitNative(long handle, long timeoutMs);
+    private static native int getStatusNative(long handle);
+    private static native double getValueNative(long handle);
+
+    @Override
+    protected void finalize() throws Throwable
+    {
+        try
+        {
+            synchronized (this)
+            {
+                if (handle != 0)
+                {
+                    releaseNative(handle);
+                    handle = 0;
+                }
+            }
+        }
+        finally
+        {
+            super.finalize();
+        }
+    }
+    private static native void releaseNative(long handle);
+}
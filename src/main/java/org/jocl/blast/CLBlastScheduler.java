@@ -0,0 +1,712 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_SUCCESS;
+import static org.jocl.CL.clCreateCommandQueue;
+import static org.jocl.CL.clFinish;
+import static org.jocl.CL.clFlush;
+import static org.jocl.CL.clReleaseCommandQueue;
+
+import java.util.concurrent.Callable;
+import java.util.concurrent.FutureTask;
+import java.util.concurrent.LinkedBlockingDeque;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
+
+import org.jocl.CL;
+import org.jocl.CLException;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_device_id;
+import org.jocl.cl_event;
+
+/**
+ * A scheduler that distributes independent CLBlast operations from many 
+ * threads across several command queues.
+ * <p>
+ * The scheduler owns one worker thread for each queue. A submitted 
+ * {@link Operation} is appended to the work deque of one worker, in a 
+ * round-robin fashion. Each worker enqueues the operations of its own 
+ * deque on its queue. When its deque is empty, it steals operations 
+ * from the other deques, so that a long-running operation does not 
+ * delay the operations that have been submitted after it. 
+ * <p>
+ * The queues may either be several in-order queues for the same device,
+ * which are created by the scheduler, or a single out-of-order queue 
+ * that is shared by all workers (created with the property
+ * <code>CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE</code>). In both cases, the submitted operations
+ * must be independent of each other. Each submission returns a 
+ * {@link Submission}, which provides the event of the operation once it
+ * has been enqueued. The caller is responsible for releasing this event.
+ * <p>
+ * The {@link #shutdown()} method must be called when the scheduler is 
+ * no longer used. Instances of this class are thread-safe.
+ */
+public final class CLBlastScheduler
+{
+    /**
+     * An operation that can be submitted to a {@link CLBlastScheduler}.
+     * Usually, this is a single call to one of the methods of 
+     * {@link CLBlast}, a {@link CLBlastCommandList}, or a short sequence
+     * of calls that depend on each other, using the given queue and 
+     * event.
+     */
+    public interface Operation
+    {
+        /**
+         * Enqueue this operation on the given queue
+         * 
+         * @param queue The command queue
+         * @param event The event that has to receive the event of the
+         * (last) command of this operation
+         * @return The CLBlast status code 
+         */
+        int execute(cl_command_queue queue, cl_event event);
+    }
+    
+    /**
+     * The result of one submission to a {@link CLBlastScheduler}. The
+     * {@link #get()} method returns the event of the operation, as soon 
+     * as it has been enqueued. If the operation threw an exception, for 
+     * example because exceptions are enabled and the call failed, then 
+     * this exception is the cause of the <code>ExecutionException</code>
+     * that is thrown by {@link #get()}. Cancelling a submission before 
+     * it has been started prevents it from being enqueued.
+     */
+    public static final class Submission extends FutureTask<cl_event>
+    {
+        /**
+         * The call that executes the operation
+         */
+        private final OperationCall call;
+        
+        /**
+         * Creates a new submission for the given call
+         * 
+         * @param call The call
+         */
+        private Submission(OperationCall call)
+        {
+            super(call);
+            this.call = call;
+        }
+        
+        /**
+         * Execute the operation on the given queue
+         * 
+         * @param queue The queue
+         */
+        private void execute(cl_command_queue queue)
+        {
+            call.queue = queue;
+            run();
+        }
+        
+        /**
+         * Returns the CLBlast status code of the operation, or 
+         * <code>null</code> if the operation was not executed yet, was 
+         * cancelled, or threw an exception.
+         * 
+         * @return The status code
+         */
+        public Integer getStatus()
+        {
+            return call.status;
+        }
+    }
+    
+    /**
+     * The callable that executes one operation on the queue of the 
+     * worker that took the submission
+     */
+    private static final class OperationCall implements Callable<cl_event>
+    {
+        /**
+         * The operation
+         */
+        private final Operation operation;
+        
+        /**
+         * The queue. This is set by the worker, before calling 
+         * {@link #call()} in the same thread.
+         */
+        private cl_command_queue queue;
+        
+        /**
+         * The status code, or <code>null</code> if the operation was not
+         * executed yet
+         */
+        private volatile Integer status;
+        
+        /**
+         * Creates a new call for the given operation
+         * 
+         * @param operation The operation
+         */
+        OperationCall(Operation operation)
+        {
+            this.operation = operation;
+        }
+        
+        @Override
+        public cl_event call()
+        {
+            cl_event event = new cl_event();
+            int result = operation.execute(queue, event);
+            status = result;
+            CLBlast.checkResult(result);
+            return event;
+        }
+    }
+    
+    /**
+     * The number of operations after which a worker flushes its queue,
+     * even when more operations are pending. The queue is also flushed
+     * whenever the worker runs out of operations.
+     */
+    static final int FLUSH_INTERVAL = 16;
+    
+    /**
+     * One worker, with its queue and deque
+     */
+    private final class Worker implements Runnable
+    {
+        /**
+         * The index of this worker
+         */
+        private final int index;
+        
+        /**
+         * The queue of this worker
+         */
+        private final cl_command_queue queue;
+        
+        /**
+         * The deque of the submissions of this worker
+         */
+        private final LinkedBlockingDeque<Submission> deque;
+        
+        /**
+         * The thread of this worker
+         */
+        private final Thread thread;
+        
+        /**
+         * The number of operations that have been enqueued since the
+         * queue was flushed
+         */
+        private int unflushed;
+        
+        /**
+         * Creates a new worker
+         * 
+         * @param index The index
+         * @param queue The queue
+         */
+        Worker(int index, cl_command_queue queue)
+        {
+            this.index = index;
+            this.queue = queue;
+            this.deque = new LinkedBlockingDeque<Submission>();
+            this.thread = new Thread(this, "CLBlastScheduler-" + index);
+            this.thread.setDaemon(true);
+        }
+
+        @Override
+        public void run()
+        {
+            while (true)
+            {
+                Submission submission = take(this);
+                if (submission == null)
+                {
+                    flush();
+                    return;
+                }
+                submission.execute(queue);
+                unflushed++;
+                if (unflushed >= flushInterval)
+                {
+                    flush();
+                }
+            }
+        }
+        
+        /**
+         * Flush the queue of this worker, if operations have been 
+         * enqueued since the last flush and flushing is enabled
+         */
+        void flush()
+        {
+            if (unflushed > 0 && flushInterval > 0)
+            {
+                clFlush(queue);
+            }
+            unflushed = 0;
+        }
+    }
+    
+    /**
+     * The workers
+     */
+    private final Worker workers[];
+    
+    /**
+     * Whether the queues have been created by this scheduler, and thus
+     * have to be released in {@link #shutdown()}
+     */
+    private final boolean ownsQueues;
+    
+    /**
+     * The number of operations after which the queues are flushed, or 
+     * 0 if the queues are never flushed explicitly
+     */
+    private final int flushInterval;
+    
+    /**
+     * The number of submissions that have not been taken by a worker
+     */
+    private final AtomicInteger pending;
+    
+    /**
+     * The counter for the round-robin distribution of submissions
+     */
+    private final AtomicInteger next;
+    
+    /**
+     * The number of submissions that have been stolen from another 
+     * worker
+     */
+    private final AtomicLong steals;
+    
+    /**
+     * The monitor for idle workers
+     */
+    private final Object idleLock = new Object();
+    
+    /**
+     * The number of idle workers. Modifications are synchronized on
+     * the {@link #idleLock}.
+     */
+    private volatile int idleWorkers;
+    
+    /**
+     * Whether {@link #shutdown()} was called. Modifications are 
+     * synchronized on the {@link #idleLock}.
+     */
+    private volatile boolean shutdown;
+    
+    /**
+     * Creates a new scheduler with the given number of in-order queues 
+     * for the given device. These queues are released when the scheduler
+     * is shut down.
+     * 
+     * @param context The context
+     * @param device The device
+     * @param queueCount The number of queues
+     * @throws IllegalArgumentException If the number of queues is not 
+     * positive
+     * @throws CLException If the queues cannot be created
+     */
+    public CLBlastScheduler(
+        cl_context context, cl_device_id device, int queueCount)
+    {
+        this(createQueues(context, device, queueCount), 
+            true, FLUSH_INTERVAL);
+    }
+    
+    /**
+     * Creates a new scheduler that uses the given queues, with one worker
+     * for each queue. The same queue may appear several times, if it is
+     * an out-of-order queue. The queues are not released when the 
+     * scheduler is shut down.
+     * 
+     * @param queues The queues
+     * @throws NullPointerException If the given array or one of its 
+     * elements is <code>null</code>
+     * @throws IllegalArgumentException If the given array is empty
+     */
+    public CLBlastScheduler(cl_command_queue queues[])
+    {
+        this(queues.clone(), false, FLUSH_INTERVAL);
+    }
+    
+    /**
+     * Creates a new scheduler that uses the given out-of-order queue,
+     * with the given number of workers. The queue is not released when 
+     * the scheduler is shut down.
+     * 
+     * @param outOfOrderQueue The out-of-order queue
+     * @param workerCount The number of workers
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalArgumentException If the number of workers is not
+     * positive
+     */
+    public CLBlastScheduler(cl_command_queue outOfOrderQueue, int workerCount)
+    {
+        this(replicate(outOfOrderQueue, workerCount), false, FLUSH_INTERVAL);
+    }
+    
+    /**
+     * Creates a new scheduler that uses the given queues
+     * 
+     * @param queues The queues
+     * @param ownsQueues Whether the queues are released on shutdown
+     * @param flushInterval The flush interval, or 0 to never flush the
+     * queues explicitly
+     */
+    CLBlastScheduler(cl_command_queue queues[], boolean ownsQueues, 
+        int flushInterval)
+    {
+        if (queues.length == 0)
+        {
+            throw new IllegalArgumentException(
+                "At least one queue is required");
+        }
+        this.ownsQueues = ownsQueues;
+        this.flushInterval = flushInterval;
+        this.pending = new AtomicInteger();
+        this.next = new AtomicInteger();
+        this.steals = new AtomicLong();
+        this.workers = new Worker[queues.length];
+        for (int i = 0; i < queues.length; i++)
+        {
+            if (queues[i] == null)
+            {
+                throw new NullPointerException(
+                    "The queue at index " + i + " is null");
+            }
+            workers[i] = new Worker(i, queues[i]);
+        }
+        for (Worker worker : workers)
+        {
+            worker.thread.start();
+        }
+    }
+    
+    /**
+     * Create the given number of in-order queues for the given device
+     * 
+     * @param context The context
+     * @param device The device
+     * @param queueCount The number of queues
+     * @return The queues
+     * @throws IllegalArgumentException If the number of queues is not 
+     * positive
+     * @throws CLException If the queues cannot be created
+     */
+    private static cl_command_queue[] createQueues(cl_context context, 
+        cl_device_id device, int queueCount)
+    {
+        if (queueCount <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The number of queues must be positive, but is " + 
+                queueCount);
+        }
+        cl_command_queue queues[] = new cl_command_queue[queueCount];
+        int errorCode[] = new int[1];
+        for (int i = 0; i < queueCount; i++)
+        {
+            queues[i] = clCreateCommandQueue(
+                context, device, 0, errorCode);
+            if (errorCode[0] != CL_SUCCESS)
+            {
+                for (int j = 0; j < i; j++)
+                {
+                    clReleaseCommandQueue(queues[j]);
+                }
+                throw new CLException("clCreateCommandQueue failed: " + 
+                    CL.stringFor_errorCode(errorCode[0]), errorCode[0]);
+            }
+        }
+        return queues;
+    }
+    
+    /**
+     * Returns an array that contains the given queue the given number 
+     * of times
+     * 
+     * @param queue The queue
+     * @param count The count
+     * @return The array
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws IllegalArgumentException If the count is not positive
+     */
+    private static cl_command_queue[] replicate(
+        cl_command_queue queue, int count)
+    {
+        if (queue == null)
+        {
+            throw new NullPointerException("The queue is null");
+        }
+        if (count <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The number of workers must be positive, but is " + count);
+        }
+        cl_command_queue queues[] = new cl_command_queue[count];
+        for (int i = 0; i < count; i++)
+        {
+            queues[i] = queue;
+        }
+        return queues;
+    }
+    
+    /**
+     * Submit the given operation. The operation will be executed by one
+     * of the workers, on the queue of that worker.
+     * 
+     * @param operation The operation
+     * @return The submission
+     * @throws NullPointerException If the operation is <code>null</code>
+     * @throws RejectedExecutionException If the scheduler was shut down
+     */
+    public Submission submit(Operation operation)
+    {
+        if (operation == null)
+        {
+            throw new NullPointerException("The operation is null");
+        }
+        if (shutdown)
+        {
+            throw new RejectedExecutionException(
+                "The scheduler was shut down");
+        }
+        Submission submission = new Submission(new OperationCall(operation));
+        int index = (next.getAndIncrement() & Integer.MAX_VALUE) % 
+            workers.length;
+        workers[index].deque.offerLast(submission);
+        pending.incrementAndGet();
+        if (idleWorkers > 0)
+        {
+            synchronized (idleLock)
+            {
+                idleLock.notify();
+            }
+        }
+        return submission;
+    }
+    
+    /**
+     * Submit the given command list. This is a convenience method that
+     * submits an operation that executes the given list. The list must 
+     * not be modified until the returned submission is done.
+     * 
+     * @param commandList The command list
+     * @return The submission
+     * @throws NullPointerException If the list is <code>null</code>
+     * @throws RejectedExecutionException If the scheduler was shut down
+     */
+    public Submission submit(final CLBlastCommandList commandList)
+    {
+        if (commandList == null)
+        {
+            throw new NullPointerException("The command list is null");
+        }
+        return submit(new Operation()
+        {
+            @Override
+            public int execute(cl_command_queue queue, cl_event event)
+            {
+                return commandList.execute(queue, event);
+            }
+        });
+    }
+    
+    /**
+     * Take the next submission for the given worker. This is the first
+     * submission from the deque of the worker, or the last submission
+     * from the deque of another worker. If there are no submissions,
+     * then the queue of the worker is flushed, and the worker waits.
+     * Returns <code>null</code> when the scheduler was shut down and 
+     * all submissions have been taken.
+     * 
+     * @param worker The worker
+     * @return The submission, or <code>null</code>
+     */
+    private Submission take(Worker worker)
+    {
+        while (true)
+        {
+            Submission submission = worker.deque.pollFirst();
+            if (submission == null)
+            {
+                submission = steal(worker);
+            }
+            if (submission != null)
+            {
+                pending.decrementAndGet();
+                return submission;
+            }
+            worker.flush();
+            synchronized (idleLock)
+            {
+                idleWorkers++;
+                try
+                {
+                    while (pending.get() <= 0 && !shutdown)
+                    {
+                        idleLock.wait();
+                    }
+                }
+                catch (InterruptedException e)
+                {
+                    Thread.currentThread().interrupt();
+                    return null;
+                }
+                finally
+                {
+                    idleWorkers--;
+                }
+                if (pending.get() <= 0 && shutdown)
+                {
+                    return null;
+                }
+            }
+        }
+    }
+    
+    /**
+     * Steal the last submission from the deque of one of the other 
+     * workers, starting with the next worker
+     * 
+     * @param worker The worker that is stealing
+     * @return The submission, or <code>null</code> if all deques are
+     * empty
+     */
+    private Submission steal(Worker worker)
+    {
+        for (int i = 1; i < workers.length; i++)
+        {
+            Worker victim = workers[(worker.index + i) % workers.length];
+            Submission submission = victim.deque.pollLast();
+            if (submission != null)
+            {
+                steals.incrementAndGet();
+                return submission;
+            }
+        }
+        return null;
+    }
+    
+    /**
+     * Returns the number of workers
+     * 
+     * @return The number of workers
+     */
+    public int getWorkerCount()
+    {
+        return workers.length;
+    }
+    
+    /**
+     * Returns the queues of the workers. If this scheduler was created 
+     * with an out-of-order queue, then all elements of the returned 
+     * array are this queue.
+     * 
+     * @return The queues
+     */
+    public cl_command_queue[] getQueues()
+    {
+        cl_command_queue queues[] = new cl_command_queue[workers.length];
+        for (int i = 0; i < workers.length; i++)
+        {
+            queues[i] = workers[i].queue;
+        }
+        return queues;
+    }
+    
+    /**
+     * Returns the number of submissions that have been executed by a 
+     * worker other than the one that they have been assigned to
+     * 
+     * @return The number of stolen submissions
+     */
+    public long getStealCount()
+    {
+        return steals.get();
+    }
+    
+    /**
+     * Shut down this scheduler. No further submissions are accepted. 
+     * This method waits until all pending submissions have been 
+     * enqueued. If the queues have been created by this scheduler, then
+     * they are finished and released. Submissions that have been made
+     * concurrently to this call may be cancelled. This method must not 
+     * be called from within an {@link Operation}.
+     */
+    public void shutdown()
+    {
+        synchronized (idleLock)
+        {
+            if (shutdown)
+            {
+                return;
+            }
+            shutdown = true;
+            idleLock.notifyAll();
+        }
+        boolean interrupted = false;
+        for (Worker worker : workers)
+        {
+            while (worker.thread.isAlive())
+            {
+                try
+                {
+                    worker.thread.join();
+                }
+                catch (InterruptedException e)
+                {
+                    interrupted = true;
+                }
+            }
+        }
+        for (Worker worker : workers)
+        {
+            Submission submission = null;
+            while ((submission = worker.deque.pollFirst()) != null)
+            {
+                submission.cancel(false);
+            }
+        }
+        if (ownsQueues)
+        {
+            for (Worker worker : workers)
+            {
+                clFinish(worker.queue);
+                clReleaseCommandQueue(worker.queue);
+            }
+        }
+        if (interrupted)
+        {
+            Thread.currentThread().interrupt();
+        }
+    }
+}
@@ -0,0 +1,265 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.TreeMap;
+
+/**
+ * A snapshot of the statistics that are collected for the calls of the
+ * {@link CLBlast} routines, as returned by {@link CLBlast#getStatistics()}.
+ * <p>
+ * The statistics are only collected when they have been enabled with
+ * {@link CLBlast#setStatisticsEnabled(boolean)}. For each routine, they
+ * contain the number of calls, the number of calls that did not return
+ * <code>CLBlastSuccess</code>, the time that was spent for converting
+ * the arguments in the JNI layer, and the time that was spent inside
+ * the CLBlast function. The latter only covers the enqueueing of the
+ * operation, and not its execution on the device.
+ */
+public final class CLBlastStatistics
+{
+    /**
+     * The statistics of a single routine
+     */
+    public static final class Routine
+    {
+        /**
+         * The name of the routine
+         */
+        private final String name;
+
+        /**
+         * The number of calls
+         */
+        private final long calls;
+
+        /**
+         * The number of calls that did not return CLBlastSuccess
+         */
+        private final long failures;
+
+        /**
+         * The time spent for converting the arguments, in nanoseconds
+         */
+        private final long unwrapNanos;
+
+        /**
+         * The time spent in the CLBlast function, in nanoseconds
+         */
+        private final long callNanos;
+
+        /**
+         * Creates a new instance
+         *
+         * @param name The name
+         * @param calls The number of calls
+         * @param failures The number of failures
+         * @param unwrapNanos The unwrap time
+         * @param callNanos The call time
+         */
+        Routine(String name, long calls, long failures,
+            long unwrapNanos, long callNanos)
+        {
+            this.name = name;
+            this.calls = calls;
+            this.failures = failures;
+            this.unwrapNanos = unwrapNanos;
+            this.callNanos = callNanos;
+        }
+
+        /**
+         * Returns the name of the routine, e.g. <code>"CLBlastSgemm"</code>
+         *
+         * @return The name
+         */
+        public String getName()
+        {
+            return name;
+        }
+
+        /**
+         * Returns the number of calls of the routine
+         *
+         * @return The number of calls
+         */
+        public long getCalls()
+        {
+            return calls;
+        }
+
+        /**
+         * Returns the number of calls that returned a status code other
+         * than <code>CLBlastSuccess</code>
+         *
+         * @return The number of failures
+         */
+        public long getFailures()
+        {
+            return failures;
+        }
+
+        /**
+         * Returns the total time that was spent for converting the
+         * arguments and writing back the results, in nanoseconds
+         *
+         * @return The unwrap time
+         */
+        public long getUnwrapNanos()
+        {
+            return unwrapNanos;
+        }
+
+        /**
+         * Returns the total time that was spent inside the CLBlast
+         * function, in nanoseconds
+         *
+         * @return The call time
+         */
+        public long getCallNanos()
+        {
+            return callNanos;
+        }
+
+        @Override
+        public String toString()
+        {
+            return String.format(Locale.ENGLISH,
+                "%s[calls=%d, failures=%d, unwrapNanos=%d, callNanos=%d]",
+                name, calls, failures, unwrapNanos, callNanos);
+        }
+    }
+
+    /**
+     * The statistics of the routines that have been called
+     */
+    private final List<Routine> routines;
+
+    /**
+     * The number of occurrences of each status code other than
+     * CLBlastSuccess
+     */
+    private final Map<Integer, Long> statusCounts;
+
+    /**
+     * Creates a new snapshot from the given data. The values contain
+     * the calls, failures, unwrap time and call time for each of the
+     * given routine names, followed by (status, count) pairs.
+     *
+     * @param names The routine names
+     * @param values The values
+     */
+    CLBlastStatistics(String names[], long values[])
+    {
+        List<Routine> routineList = new ArrayList<Routine>();
+        for (int i = 0; i < names.length; i++)
+        {
+            long calls = values[i * 4 + 0];
+            if (calls > 0)
+            {
+                routineList.add(new Routine(names[i], calls,
+                    values[i * 4 + 1], values[i * 4 + 2], values[i * 4 + 3]));
+            }
+        }
+        Map<Integer, Long> statusMap = new TreeMap<Integer, Long>();
+        for (int i = names.length * 4; i + 1 < values.length; i += 2)
+        {
+            statusMap.put((int)values[i], values[i + 1]);
+        }
+        this.routines = Collections.unmodifiableList(routineList);
+        this.statusCounts = Collections.unmodifiableMap(statusMap);
+    }
+
+    /**
+     * Returns an unmodifiable list with the statistics of all routines
+     * that have been called at least once
+     *
+     * @return The routine statistics
+     */
+    public List<Routine> getRoutines()
+    {
+        return routines;
+    }
+
+    /**
+     * Returns the statistics of the routine with the given name, or
+     * <code>null</code> if this routine has not been called
+     *
+     * @param name The name, e.g. <code>"CLBlastSgemm"</code>
+     * @return The routine statistics
+     */
+    public Routine getRoutine(String name)
+    {
+        for (Routine routine : routines)
+        {
+            if (routine.getName().equals(name))
+            {
+                return routine;
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Returns an unmodifiable map from the status codes other than
+     * <code>CLBlastSuccess</code> that have been returned by the CLBlast
+     * functions, to the number of their occurrences
+     *
+     * @return The status counts
+     */
+    public Map<Integer, Long> getStatusCounts()
+    {
+        return statusCounts;
+    }
+
+    @Override
+    public String toString()
+    {
+        StringBuilder sb = new StringBuilder();
+        sb.append(String.format(Locale.ENGLISH,
+            "%-36s %12s %10s %14s %14s%n",
+            "Routine", "Calls", "Failures", "Unwrap us", "Call us"));
+        for (Routine routine : routines)
+        {
+            sb.append(String.format(Locale.ENGLISH,
+                "%-36s %12d %10d %14.1f %14.1f%n",
+                routine.getName(), routine.getCalls(), routine.getFailures(),
+                routine.getUnwrapNanos() / 1e3, routine.getCallNanos() / 1e3));
+        }
+        for (Map.Entry<Integer, Long> entry : statusCounts.entrySet())
+        {
+            sb.append(String.format(Locale.ENGLISH, "%-36s %12d%n",
+                CLBlastStatusCode.stringFor(entry.getKey()),
+                entry.getValue()));
+        }
+        return sb.toString();
+    }
+}
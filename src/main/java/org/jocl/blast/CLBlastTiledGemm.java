@@ -0,0 +1,1025 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_DEVICE_GLOBAL_MEM_SIZE;
+import static org.jocl.CL.CL_DEVICE_MAX_MEM_ALLOC_SIZE;
+import static org.jocl.CL.CL_MEM_READ_WRITE;
+import static org.jocl.CL.CL_SUCCESS;
+import static org.jocl.CL.clCreateBuffer;
+import static org.jocl.CL.clCreateCommandQueue;
+import static org.jocl.CL.clEnqueueReadBufferRect;
+import static org.jocl.CL.clEnqueueWriteBufferRect;
+import static org.jocl.CL.clFinish;
+import static org.jocl.CL.clFlush;
+import static org.jocl.CL.clGetDeviceInfo;
+import static org.jocl.CL.clReleaseCommandQueue;
+import static org.jocl.CL.clReleaseEvent;
+import static org.jocl.CL.clReleaseMemObject;
+import static org.jocl.CL.clWaitForEvents;
+
+import java.nio.Buffer;
+import java.nio.DoubleBuffer;
+import java.nio.FloatBuffer;
+import java.util.ArrayList;
+import java.util.List;
+
+import org.jocl.CL;
+import org.jocl.CLException;
+import org.jocl.Pointer;
+import org.jocl.Sizeof;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_device_id;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+
+/**
+ * A driver for GEMM on matrices in host memory that do not fit into
+ * the memory of the device.
+ * <p>
+ * C is split into square tiles, and the inner dimension is split into
+ * panels of A and B with the same size. For each tile of C, the panels 
+ * are streamed to the device, and accumulated into the tile with the
+ * offset- and leading-dimension-aware GEMM bindings. All buffers are
+ * double-buffered: The uploads and downloads run on a transfer queue,
+ * and the GEMMs run on a compute queue, so that the transfer of the
+ * next panels overlaps with the computation of the current ones.
+ * <p>
+ * The tile size is derived from <code>CL_DEVICE_GLOBAL_MEM_SIZE</code>
+ * and <code>CL_DEVICE_MAX_MEM_ALLOC_SIZE</code>, unless it is set 
+ * explicitly. Each call returns a {@link Report} that contains the 
+ * achieved GFLOP/s.
+ * <p>
+ * All matrices are in row-major order. The host buffers must be direct
+ * buffers, because they are accessed asynchronously. For complex 
+ * precisions, the buffers contain interleaved real and imaginary parts, 
+ * and the leading dimensions are given in complex elements. Instances 
+ * of this class are thread-safe, but calls are serialized. The 
+ * {@link #release()} method must be called when the instance is no 
+ * longer used.
+ * <p>
+ * A Java buffer holds at most <code>Integer.MAX_VALUE</code> elements,
+ * so each matrix is limited to 8 GB in single and 16 GB in double 
+ * precision. A direct buffer that is allocated with 
+ * <code>ByteBuffer.allocateDirect</code> is even limited to 
+ * <code>Integer.MAX_VALUE</code> bytes. Larger products can be split 
+ * into blocks of rows: Rows <code>i0</code> to <code>i1</code> of C 
+ * only depend on the same rows of op(A), so each block of rows can be 
+ * computed with one call, with separate buffers for the rows of A and 
+ * C.
+ */
+public final class CLBlastTiledGemm
+{
+    /**
+     * The default fraction of the global memory that may be used
+     * for the tiles
+     */
+    private static final double DEFAULT_MEMORY_FRACTION = 0.5;
+    
+    /**
+     * The tile sizes that are chosen automatically are multiples of 
+     * this value
+     */
+    private static final long TILE_SIZE_GRANULARITY = 64;
+    
+    /**
+     * The number of tile-sized device buffers: Two slots for each of
+     * the panels of A and B, and the tiles of C
+     */
+    private static final int TILE_BUFFERS = 6;
+    
+    /**
+     * The report about a tiled GEMM call
+     */
+    public static final class Report
+    {
+        /**
+         * The tile size
+         */
+        private final long tileSize;
+        
+        /**
+         * The number of tiles of C
+         */
+        private final long tiles;
+        
+        /**
+         * The number of GEMM calls
+         */
+        private final long steps;
+        
+        /**
+         * The number of bytes transferred between host and device
+         */
+        private final long transferredBytes;
+        
+        /**
+         * The elapsed time, in nanoseconds
+         */
+        private final long nanoseconds;
+        
+        /**
+         * The number of floating point operations
+         */
+        private final double flops;
+        
+        /**
+         * Creates a new instance
+         * 
+         * @param tileSize The tile size
+         * @param tiles The number of tiles
+         * @param steps The number of steps
+         * @param transferredBytes The number of bytes transferred
+         * @param nanoseconds The elapsed time
+         * @param flops The number of floating point operations
+         */
+        Report(long tileSize, long tiles, long steps, 
+            long transferredBytes, long nanoseconds, double flops)
+        {
+            this.tileSize = tileSize;
+            this.tiles = tiles;
+            this.steps = steps;
+            this.transferredBytes = transferredBytes;
+            this.nanoseconds = nanoseconds;
+            this.flops = flops;
+        }
+        
+        /**
+         * Returns the tile size that was used
+         * 
+         * @return The tile size
+         */
+        public long getTileSize()
+        {
+            return tileSize;
+        }
+        
+        /**
+         * Returns the number of tiles of C
+         * 
+         * @return The number of tiles
+         */
+        public long getTiles()
+        {
+            return tiles;
+        }
+        
+        /**
+         * Returns the number of GEMM calls that have been enqueued
+         * 
+         * @return The number of steps
+         */
+        public long getSteps()
+        {
+            return steps;
+        }
+        
+        /**
+         * Returns the number of bytes that have been transferred between
+         * the host and the device
+         * 
+         * @return The number of bytes
+         */
+        public long getTransferredBytes()
+        {
+            return transferredBytes;
+        }
+        
+        /**
+         * Returns the elapsed time of the call, in nanoseconds, including
+         * all transfers
+         * 
+         * @return The elapsed time
+         */
+        public long getNanoseconds()
+        {
+            return nanoseconds;
+        }
+        
+        /**
+         * Returns the achieved GFLOP/s, based on the elapsed time. 
+         * A real GEMM counts as 2*m*n*k, and a complex GEMM as 8*m*n*k 
+         * floating point operations.
+         * 
+         * @return The GFLOP/s
+         */
+        public double getGflops()
+        {
+            if (nanoseconds == 0)
+            {
+                return 0;
+            }
+            return flops / nanoseconds;
+        }
+        
+        @Override
+        public String toString()
+        {
+            return String.format(
+                "tile size %d, %d tiles, %d steps, %.1f MB transferred, " +
+                "%.3f s, %.2f GFLOP/s", tileSize, tiles, steps, 
+                transferredBytes / 1e6, nanoseconds / 1e9, getGflops());
+        }
+    }
+    
+    /**
+     * The context
+     */
+    private final cl_context context;
+    
+    /**
+     * The queue for the uploads and downloads
+     */
+    private final cl_command_queue transferQueue;
+    
+    /**
+     * The queue for the CLBlast calls
+     */
+    private final cl_command_queue computeQueue;
+    
+    /**
+     * The global memory size of the device
+     */
+    private final long globalMemSize;
+    
+    /**
+     * The maximum allocation size of the device
+     */
+    private final long maxAllocSize;
+    
+    /**
+     * The fraction of the global memory that may be used
+     */
+    private double memoryFraction;
+    
+    /**
+     * The tile size that was set explicitly, or 0 
+     */
+    private long tileSize;
+    
+    /**
+     * Whether this instance was released
+     */
+    private boolean released;
+    
+    /**
+     * Creates a new instance for the given device
+     * 
+     * @param context The context
+     * @param device The device
+     * @throws CLException If the queues cannot be created
+     */
+    public CLBlastTiledGemm(cl_context context, cl_device_id device)
+    {
+        this.context = context;
+        this.globalMemSize = getLong(device, CL_DEVICE_GLOBAL_MEM_SIZE);
+        this.maxAllocSize = getLong(device, CL_DEVICE_MAX_MEM_ALLOC_SIZE);
+        int errorCode[] = new int[1];
+        this.transferQueue = 
+            clCreateCommandQueue(context, device, 0, errorCode);
+        check(errorCode[0], "clCreateCommandQueue");
+        this.computeQueue = 
+            clCreateCommandQueue(context, device, 0, errorCode);
+        check(errorCode[0], "clCreateCommandQueue");
+        this.memoryFraction = DEFAULT_MEMORY_FRACTION;
+    }
+    
+    /**
+     * Set the fraction of <code>CL_DEVICE_GLOBAL_MEM_SIZE</code> that may 
+     * be used for the tiles when the tile size is chosen automatically. 
+     * The default is 0.5, which leaves room for the temporary buffers 
+     * of CLBlast and other allocations.
+     * 
+     * @param memoryFraction The memory fraction
+     * @throws IllegalArgumentException If the fraction is not in (0,1]
+     */
+    public synchronized void setMemoryFraction(double memoryFraction)
+    {
+        if (!(memoryFraction > 0.0 && memoryFraction <= 1.0))
+        {
+            throw new IllegalArgumentException(
+                "The memory fraction must be in (0,1], but is " + 
+                memoryFraction);
+        }
+        this.memoryFraction = memoryFraction;
+    }
+    
+    /**
+     * Set the tile size. If this is 0, then the tile size is chosen 
+     * automatically, based on the device memory. This is the default.
+     * 
+     * @param tileSize The tile size
+     * @throws IllegalArgumentException If the tile size is negative
+     */
+    public synchronized void setTileSize(long tileSize)
+    {
+        if (tileSize < 0)
+        {
+            throw new IllegalArgumentException(
+                "The tile size may not be negative, but is " + tileSize);
+        }
+        this.tileSize = tileSize;
+    }
+    
+    /**
+     * Returns the tile size that is used for the given precision. 
+     * <br>
+     * If no tile size was set explicitly, this is the largest multiple 
+     * of 64 for which the six tile buffers fit into the memory fraction
+     * of the global memory, and each tile buffer fits into the maximum
+     * allocation size.
+     * 
+     * @param precision The {@link CLBlastPrecision}
+     * @return The tile size
+     * @throws IllegalArgumentException If the precision is not one of
+     * the single, double, complex single or complex double precisions
+     */
+    public synchronized long getTileSize(int precision)
+    {
+        if (tileSize > 0)
+        {
+            return tileSize;
+        }
+        long elementSize = elementSize(precision);
+        long budget = (long)(globalMemSize * memoryFraction) / TILE_BUFFERS;
+        long bufferSize = Math.min(budget, maxAllocSize);
+        long size = (long)Math.sqrt((double)bufferSize / elementSize);
+        if (size >= TILE_SIZE_GRANULARITY)
+        {
+            size -= size % TILE_SIZE_GRANULARITY;
+        }
+        return Math.max(1, size);
+    }
+    
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C in single precision.
+     * 
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @return The {@link Report} about the call
+     * @throws IllegalArgumentException If a dimension is not positive,
+     * a buffer is too small or not direct
+     * @throws IllegalStateException If this instance was released
+     * @throws CLException If an OpenCL or CLBlast call fails
+     */
+    public Report sgemm(int a_transpose, int b_transpose, 
+        long m, long n, long k, float alpha, 
+        FloatBuffer a, long a_ld, FloatBuffer b, long b_ld, 
+        float beta, FloatBuffer c, long c_ld)
+    {
+        return gemm(CLBlastPrecision.CLBlastPrecisionSingle, 
+            a_transpose, b_transpose, m, n, k, 
+            new double[] { alpha, 0 }, a, a_ld, b, b_ld, 
+            new double[] { beta, 0 }, c, c_ld);
+    }
+    
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C in double precision.
+     * 
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @return The {@link Report} about the call
+     * @throws IllegalArgumentException If a dimension is not positive,
+     * a buffer is too small or not direct
+     * @throws IllegalStateException If this instance was released
+     * @throws CLException If an OpenCL or CLBlast call fails
+     */
+    public Report dgemm(int a_transpose, int b_transpose, 
+        long m, long n, long k, double alpha, 
+        DoubleBuffer a, long a_ld, DoubleBuffer b, long b_ld, 
+        double beta, DoubleBuffer c, long c_ld)
+    {
+        return gemm(CLBlastPrecision.CLBlastPrecisionDouble, 
+            a_transpose, b_transpose, m, n, k, 
+            new double[] { alpha, 0 }, a, a_ld, b, b_ld, 
+            new double[] { beta, 0 }, c, c_ld);
+    }
+    
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C in complex single 
+     * precision.
+     * 
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value, as a (real, imaginary) pair
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value, as a (real, imaginary) pair
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @return The {@link Report} about the call
+     * @throws IllegalArgumentException If a dimension is not positive,
+     * a buffer is too small or not direct
+     * @throws IllegalStateException If this instance was released
+     * @throws CLException If an OpenCL or CLBlast call fails
+     */
+    public Report cgemm(int a_transpose, int b_transpose, 
+        long m, long n, long k, float alpha[], 
+        FloatBuffer a, long a_ld, FloatBuffer b, long b_ld, 
+        float beta[], FloatBuffer c, long c_ld)
+    {
+        return gemm(CLBlastPrecision.CLBlastPrecisionComplexSingle, 
+            a_transpose, b_transpose, m, n, k, 
+            new double[] { alpha[0], alpha[1] }, a, a_ld, b, b_ld, 
+            new double[] { beta[0], beta[1] }, c, c_ld);
+    }
+    
+    /**
+     * Computes C = alpha * op(A) * op(B) + beta * C in complex double 
+     * precision.
+     * 
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value, as a (real, imaginary) pair
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value, as a (real, imaginary) pair
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @return The {@link Report} about the call
+     * @throws IllegalArgumentException If a dimension is not positive,
+     * a buffer is too small or not direct
+     * @throws IllegalStateException If this instance was released
+     * @throws CLException If an OpenCL or CLBlast call fails
+     */
+    public Report zgemm(int a_transpose, int b_transpose, 
+        long m, long n, long k, double alpha[], 
+        DoubleBuffer a, long a_ld, DoubleBuffer b, long b_ld, 
+        double beta[], DoubleBuffer c, long c_ld)
+    {
+        return gemm(CLBlastPrecision.CLBlastPrecisionComplexDouble, 
+            a_transpose, b_transpose, m, n, k, 
+            alpha.clone(), a, a_ld, b, b_ld, beta.clone(), c, c_ld);
+    }
+    
+    /**
+     * Implementation of the tiled GEMM for all precisions
+     * 
+     * @param precision The {@link CLBlastPrecision}
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of op(A) and C
+     * @param n The number of columns of op(B) and C
+     * @param k The number of columns of op(A) and rows of op(B)
+     * @param alpha The alpha value, as a (real, imaginary) pair
+     * @param a The matrix A
+     * @param a_ld The leading dimension of A
+     * @param b The matrix B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value, as a (real, imaginary) pair
+     * @param c The matrix C
+     * @param c_ld The leading dimension of C
+     * @return The {@link Report} about the call
+     */
+    private synchronized Report gemm(int precision, 
+        int a_transpose, int b_transpose, long m, long n, long k, 
+        double alpha[], Buffer a, long a_ld, Buffer b, long b_ld, 
+        double beta[], Buffer c, long c_ld)
+    {
+        checkNotReleased();
+        if (m <= 0 || n <= 0 || k <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The dimensions must be positive, but are m=" + m + 
+                ", n=" + n + ", k=" + k);
+        }
+        boolean transposeA = 
+            a_transpose != CLBlastTranspose.CLBlastTransposeNo;
+        boolean transposeB = 
+            b_transpose != CLBlastTranspose.CLBlastTransposeNo;
+        long elementSize = elementSize(precision);
+        long componentsPerElement = isComplex(precision) ? 2 : 1;
+        checkSize(a, transposeA ? k : m, transposeA ? m : k, a_ld, 
+            componentsPerElement, "a");
+        checkSize(b, transposeB ? n : k, transposeB ? k : n, b_ld, 
+            componentsPerElement, "b");
+        checkSize(c, m, n, c_ld, componentsPerElement, "c");
+        
+        long tile = getTileSize(precision);
+        long tm = Math.min(tile, m);
+        long tn = Math.min(tile, n);
+        long tk = Math.min(tile, k);
+        long mTiles = (m + tm - 1) / tm;
+        long nTiles = (n + tn - 1) / tn;
+        long kTiles = (k + tk - 1) / tk;
+        double one[] = { 1.0, 0.0 };
+        
+        // The pointers are created once, and kept until all operations
+        // are finished, so that the buffers are not garbage collected
+        Pointer aPointer = pointerTo(a);
+        Pointer bPointer = pointerTo(b);
+        Pointer cPointer = pointerTo(c);
+        
+        List<cl_mem> buffers = new ArrayList<cl_mem>();
+        cl_event gemmEvents[] = new cl_event[2];
+        long transferredBytes = 0;
+        long steps = 0;
+        long before = System.nanoTime();
+        try
+        {
+            cl_mem aDevice[] = new cl_mem[2];
+            cl_mem bDevice[] = new cl_mem[2];
+            cl_mem cDevice[] = new cl_mem[2];
+            for (int s = 0; s < 2; s++)
+            {
+                aDevice[s] = createBuffer(tm * tk * elementSize, buffers);
+                bDevice[s] = createBuffer(tk * tn * elementSize, buffers);
+                cDevice[s] = createBuffer(tm * tn * elementSize, buffers);
+            }
+            long tileIndex = 0;
+            for (long ti = 0; ti < mTiles; ti++)
+            {
+                long row = ti * tm;
+                long rows = Math.min(tm, m - row);
+                for (long tj = 0; tj < nTiles; tj++)
+                {
+                    long col = tj * tn;
+                    long cols = Math.min(tn, n - col);
+                    int cs = (int)(tileIndex % 2);
+                    tileIndex++;
+                    
+                    // Upload the tile of C. The previous download from
+                    // this slot was enqueued before, on the same queue.
+                    // C is uploaded even if beta is 0, because the 
+                    // device buffer may contain NaN values.
+                    transferredBytes += transfer(transferQueue, true, 
+                        cDevice[cs], cPointer, row, col, rows, cols, 
+                        cols, c_ld, elementSize, null, null);
+                    
+                    cl_event gemm = null;
+                    for (long tp = 0; tp < kTiles; tp++)
+                    {
+                        long inner = tp * tk;
+                        long depth = Math.min(tk, k - inner);
+                        int slot = (int)(steps % 2);
+                        steps++;
+                        
+                        // Wait until the GEMM that used this slot of the 
+                        // panels is finished. This also limits the number 
+                        // of commands that are enqueued in advance.
+                        if (gemmEvents[slot] != null)
+                        {
+                            check(clWaitForEvents(1, 
+                                new cl_event[] { gemmEvents[slot] }), 
+                                "clWaitForEvents");
+                            clReleaseEvent(gemmEvents[slot]);
+                            gemmEvents[slot] = null;
+                        }
+                        
+                        // Upload the panels of A and B
+                        long aLd = transposeA ? rows : depth;
+                        if (transposeA)
+                        {
+                            transferredBytes += transfer(transferQueue, true, 
+                                aDevice[slot], aPointer, inner, row, depth, 
+                                rows, aLd, a_ld, elementSize, null, null);
+                        }
+                        else
+                        {
+                            transferredBytes += transfer(transferQueue, true, 
+                                aDevice[slot], aPointer, row, inner, rows, 
+                                depth, aLd, a_ld, elementSize, null, null);
+                        }
+                        long bLd = transposeB ? depth : cols;
+                        cl_event upload = new cl_event();
+                        if (transposeB)
+                        {
+                            transferredBytes += transfer(transferQueue, true, 
+                                bDevice[slot], bPointer, col, inner, cols, 
+                                depth, bLd, b_ld, elementSize, null, upload);
+                        }
+                        else
+                        {
+                            transferredBytes += transfer(transferQueue, true, 
+                                bDevice[slot], bPointer, inner, col, depth, 
+                                cols, bLd, b_ld, elementSize, null, upload);
+                        }
+                        clFlush(transferQueue);
+                        
+                        // Accumulate the product of the panels into the
+                        // tile of C, after all uploads are finished
+                        gemm = new cl_event();
+                        try
+                        {
+                            enqueueGemm(precision, a_transpose, b_transpose, 
+                                rows, cols, depth, alpha, aDevice[slot], aLd, 
+                                bDevice[slot], bLd, 
+                                tp == 0 ? beta : one, 
+                                cDevice[cs], cols, computeQueue, 
+                                new cl_event[] { upload }, gemm);
+                        }
+                        finally
+                        {
+                            clReleaseEvent(upload);
+                        }
+                        gemmEvents[slot] = gemm;
+                        clFlush(computeQueue);
+                    }
+                    
+                    // Download the tile of C, after the last GEMM 
+                    transferredBytes += transfer(transferQueue, false, 
+                        cDevice[cs], cPointer, row, col, rows, cols, 
+                        cols, c_ld, elementSize, gemm, null);
+                    clFlush(transferQueue);
+                }
+            }
+            check(clFinish(transferQueue), "clFinish");
+        }
+        finally
+        {
+            // When an exception was thrown, there may still be pending
+            // operations that use the buffers
+            clFinish(computeQueue);
+            clFinish(transferQueue);
+            for (int s = 0; s < 2; s++)
+            {
+                if (gemmEvents[s] != null)
+                {
+                    clReleaseEvent(gemmEvents[s]);
+                }
+            }
+            for (cl_mem buffer : buffers)
+            {
+                clReleaseMemObject(buffer);
+            }
+        }
+        long nanoseconds = System.nanoTime() - before;
+        double flops = 2.0 * m * n * k;
+        if (isComplex(precision))
+        {
+            flops *= 4;
+        }
+        return new Report(tile, mTiles * nTiles, steps, 
+            transferredBytes, nanoseconds, flops);
+    }
+    
+    /**
+     * Enqueue the transfer of a sub-matrix between the given host pointer 
+     * and the given device buffer, and return the number of bytes.
+     * 
+     * @param queue The queue
+     * @param write Whether the data is written to the device
+     * @param device The device buffer
+     * @param host The host pointer
+     * @param row The first row of the sub-matrix in the host matrix
+     * @param col The first column of the sub-matrix in the host matrix
+     * @param rows The number of rows
+     * @param cols The number of columns
+     * @param deviceLd The leading dimension in the device buffer
+     * @param hostLd The leading dimension of the host matrix
+     * @param elementSize The size of one element, in bytes
+     * @param waitEvent An optional event to wait for
+     * @param event An optional event for the transfer
+     * @return The number of bytes
+     */
+    static long transfer(cl_command_queue queue, boolean write, 
+        cl_mem device, Pointer host, long row, long col, long rows, 
+        long cols, long deviceLd, long hostLd, long elementSize, 
+        cl_event waitEvent, cl_event event)
+    {
+        long bufferOffset[] = { 0, 0, 0 };
+        long hostOffset[] = { col * elementSize, row, 0 };
+        long region[] = { cols * elementSize, rows, 1 };
+        int numWaitEvents = waitEvent == null ? 0 : 1;
+        cl_event waitList[] = 
+            waitEvent == null ? null : new cl_event[] { waitEvent };
+        if (write)
+        {
+            check(clEnqueueWriteBufferRect(queue, device, false, 
+                bufferOffset, hostOffset, region, 
+                deviceLd * elementSize, 0, hostLd * elementSize, 0, 
+                host, numWaitEvents, waitList, event), 
+                "clEnqueueWriteBufferRect");
+        }
+        else
+        {
+            check(clEnqueueReadBufferRect(queue, device, false, 
+                bufferOffset, hostOffset, region, 
+                deviceLd * elementSize, 0, hostLd * elementSize, 0, 
+                host, numWaitEvents, waitList, event), 
+                "clEnqueueReadBufferRect");
+        }
+        return rows * cols * elementSize;
+    }
+    
+    /**
+     * Enqueue a row-major GEMM on device buffers, for the given precision
+     * 
+     * @param precision The {@link CLBlastPrecision}
+     * @param a_transpose The transpose mode of A
+     * @param b_transpose The transpose mode of B
+     * @param m The number of rows of the tile
+     * @param n The number of columns of the tile
+     * @param k The depth of the panels
+     * @param alpha The alpha value, as a (real, imaginary) pair
+     * @param a The panel of A
+     * @param a_ld The leading dimension of A
+     * @param b The panel of B
+     * @param b_ld The leading dimension of B
+     * @param beta The beta value, as a (real, imaginary) pair
+     * @param c The tile of C
+     * @param c_ld The leading dimension of C
+     * @param computeQueue The queue
+     * @param waitList The optional events to wait for
+     * @param event The optional event for the GEMM
+     * @throws CLException If the CLBlast call fails
+     */
+    static void enqueueGemm(int precision, 
+        int a_transpose, int b_transpose, long m, long n, long k, 
+        double alpha[], cl_mem a, long a_ld, cl_mem b, long b_ld, 
+        double beta[], cl_mem c, long c_ld, cl_command_queue computeQueue,
+        cl_event waitList[], cl_event event)
+    {
+        enqueueGemm(precision, CLBlastLayout.CLBlastLayoutRowMajor, 
+            a_transpose, b_transpose, m, n, k, alpha, a, a_ld, b, b_ld, 
+            beta, c, c_ld, computeQueue, waitList, event);
+    }
+    
+    /**
+     * Enqueue a GEMM with the given layout on device buffers, for the 
+     * given precision. The parameters are the same as for 
+     * {@link #enqueueGemm(int, int, int, long, long, long, double[], 
+     * cl_mem, long, cl_mem, long, double[], cl_mem, long, 
+     * cl_command_queue, cl_event[], cl_event)}, with the additional
+     * {@link CLBlastLayout}.
+     */
+    static void enqueueGemm(int precision, int layout,
+        int a_transpose, int b_transpose, long m, long n, long k, 
+        double alpha[], cl_mem a, long a_ld, cl_mem b, long b_ld, 
+        double beta[], cl_mem c, long c_ld, cl_command_queue computeQueue,
+        cl_event waitList[], cl_event event)
+    {
+        int status;
+        switch (precision)
+        {
+            case CLBlastPrecision.CLBlastPrecisionSingle:
+                status = CLBlast.CLBlastSgemm(layout, a_transpose, 
+                    b_transpose, m, n, k, (float)alpha[0], a, 0, a_ld, 
+                    b, 0, b_ld, (float)beta[0], c, 0, c_ld, 
+                    computeQueue, waitList, event);
+                break;
+            
+            case CLBlastPrecision.CLBlastPrecisionDouble:
+                status = CLBlast.CLBlastDgemm(layout, a_transpose, 
+                    b_transpose, m, n, k, alpha[0], a, 0, a_ld, 
+                    b, 0, b_ld, beta[0], c, 0, c_ld, 
+                    computeQueue, waitList, event);
+                break;
+            
+            case CLBlastPrecision.CLBlastPrecisionComplexSingle:
+                status = CLBlast.CLBlastCgemm(layout, a_transpose, 
+                    b_transpose, m, n, k, 
+                    new float[] { (float)alpha[0], (float)alpha[1] }, 
+                    a, 0, a_ld, b, 0, b_ld, 
+                    new float[] { (float)beta[0], (float)beta[1] }, 
+                    c, 0, c_ld, computeQueue, waitList, event);
+                break;
+            
+            default:
+                status = CLBlast.CLBlastZgemm(layout, a_transpose, 
+                    b_transpose, m, n, k, alpha, a, 0, a_ld, 
+                    b, 0, b_ld, beta, c, 0, c_ld, 
+                    computeQueue, waitList, event);
+                break;
+        }
+        if (status != CLBlastStatusCode.CLBlastSuccess)
+        {
+            throw new CLException("CLBlast GEMM failed: " + 
+                CLBlastStatusCode.stringFor(status), status);
+        }
+    }
+    
+    /**
+     * Create a device buffer with the given size, and add it to the
+     * given list
+     * 
+     * @param size The size, in bytes
+     * @param buffers The list of buffers
+     * @return The buffer
+     * @throws CLException If the buffer cannot be created
+     */
+    private cl_mem createBuffer(long size, List<cl_mem> buffers)
+    {
+        int errorCode[] = new int[1];
+        cl_mem mem = clCreateBuffer(
+            context, CL_MEM_READ_WRITE, size, null, errorCode);
+        check(errorCode[0], "clCreateBuffer");
+        buffers.add(mem);
+        return mem;
+    }
+    
+    /**
+     * Release all resources of this instance. Afterwards, the instance
+     * may no longer be used.
+     */
+    public synchronized void release()
+    {
+        if (released)
+        {
+            return;
+        }
+        clReleaseCommandQueue(transferQueue);
+        clReleaseCommandQueue(computeQueue);
+        released = true;
+    }
+    
+    /**
+     * Make sure that this instance was not released
+     * 
+     * @throws IllegalStateException If this instance was released
+     */
+    private void checkNotReleased()
+    {
+        if (released)
+        {
+            throw new IllegalStateException(
+                "The CLBlastTiledGemm was released");
+        }
+    }
+    
+    /**
+     * Returns whether the given precision is a complex precision
+     * 
+     * @param precision The {@link CLBlastPrecision}
+     * @return Whether the precision is complex
+     */
+    static boolean isComplex(int precision)
+    {
+        return precision == CLBlastPrecision.CLBlastPrecisionComplexSingle ||
+            precision == CLBlastPrecision.CLBlastPrecisionComplexDouble;
+    }
+    
+    /**
+     * Returns the size of one element of the given precision, in bytes
+     * 
+     * @param precision The {@link CLBlastPrecision}
+     * @return The element size
+     * @throws IllegalArgumentException If the precision is not supported
+     */
+    static long elementSize(int precision)
+    {
+        switch (precision)
+        {
+            case CLBlastPrecision.CLBlastPrecisionSingle:
+                return Sizeof.cl_float;
+            case CLBlastPrecision.CLBlastPrecisionDouble:
+                return Sizeof.cl_double;
+            case CLBlastPrecision.CLBlastPrecisionComplexSingle:
+                return 2 * Sizeof.cl_float;
+            case CLBlastPrecision.CLBlastPrecisionComplexDouble:
+                return 2 * Sizeof.cl_double;
+            default:
+                throw new IllegalArgumentException(
+                    "Unsupported precision: " + 
+                    CLBlastPrecision.stringFor(precision));
+        }
+    }
+    
+    /**
+     * Creates a pointer to the current position of the given direct 
+     * buffer
+     * 
+     * @param buffer The buffer
+     * @return The pointer
+     */
+    static Pointer pointerTo(Buffer buffer)
+    {
+        if (buffer instanceof FloatBuffer)
+        {
+            return Pointer.to(((FloatBuffer)buffer).slice());
+        }
+        return Pointer.to(((DoubleBuffer)buffer).slice());
+    }
+    
+    /**
+     * Make sure that the given buffer is a direct buffer that has enough 
+     * remaining elements for a row-major matrix of the given size
+     * 
+     * @param buffer The buffer
+     * @param rows The number of rows
+     * @param cols The number of columns
+     * @param ld The leading dimension
+     * @param componentsPerElement The number of buffer elements for
+     * one matrix element
+     * @param name The name of the matrix, for the error message
+     * @throws IllegalArgumentException If the buffer is not direct or 
+     * too small, the matrix has more elements than a buffer can hold, 
+     * or the leading dimension is smaller than the number of columns
+     */
+    static void checkSize(Buffer buffer, long rows, long cols, 
+        long ld, long componentsPerElement, String name)
+    {
+        if (!buffer.isDirect())
+        {
+            throw new IllegalArgumentException(
+                "The buffer for '" + name + "' must be a direct buffer");
+        }
+        if (ld < cols)
+        {
+            throw new IllegalArgumentException("The leading dimension of '" + 
+                name + "' must be at least " + cols + ", but is " + ld);
+        }
+        long required = ((rows - 1) * ld + cols) * componentsPerElement;
+        if (required > Integer.MAX_VALUE)
+        {
+            throw new IllegalArgumentException("The matrix '" + name + 
+                "' requires " + required + " elements, but a buffer can " +
+                "hold at most " + Integer.MAX_VALUE + ". Split the product " +
+                "into blocks of rows.");
+        }
+        if (buffer.remaining() < required)
+        {
+            throw new IllegalArgumentException("The matrix '" + name + 
+                "' requires " + required + " elements, but only has " + 
+                buffer.remaining());
+        }
+    }
+    
+    /**
+     * Returns the <code>cl_ulong</code> value of the given device info
+     * 
+     * @param device The device
+     * @param paramName The parameter name
+     * @return The value
+     */
+    private static long getLong(cl_device_id device, int paramName)
+    {
+        long values[] = new long[1];
+        check(clGetDeviceInfo(device, paramName, 
+            Sizeof.cl_ulong, Pointer.to(values), null), "clGetDeviceInfo");
+        return values[0];
+    }
+    
+    /**
+     * Throw a CLException if the given error code is not CL_SUCCESS
+     * 
+     * @param errorCode The error code
+     * @param functionName The name of the function, for the message
+     * @throws CLException If the error code is not CL_SUCCESS
+     */
+    static void check(int errorCode, String functionName)
+    {
+        if (errorCode != CL_SUCCESS)
+        {
+            throw new CLException(functionName + " failed: " + 
+                CL.stringFor_errorCode(errorCode), errorCode);
+        }
+    }
+}
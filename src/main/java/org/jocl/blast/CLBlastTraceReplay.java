@@ -0,0 +1,633 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_CONTEXT_PLATFORM;
+import static org.jocl.CL.CL_DEVICE_TYPE_ALL;
+import static org.jocl.CL.CL_MEM_READ_WRITE;
+import static org.jocl.CL.CL_QUEUE_DEVICE;
+import static org.jocl.CL.CL_QUEUE_PROFILING_ENABLE;
+import static org.jocl.CL.clCreateBuffer;
+import static org.jocl.CL.clCreateCommandQueue;
+import static org.jocl.CL.clCreateContext;
+import static org.jocl.CL.clEnqueueFillBuffer;
+import static org.jocl.CL.clFinish;
+import static org.jocl.CL.clGetCommandQueueInfo;
+import static org.jocl.CL.clGetDeviceIDs;
+import static org.jocl.CL.clGetPlatformIDs;
+import static org.jocl.CL.clReleaseCommandQueue;
+import static org.jocl.CL.clReleaseContext;
+import static org.jocl.CL.clReleaseMemObject;
+
+import java.io.BufferedInputStream;
+import java.io.FileInputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.lang.reflect.InvocationTargetException;
+import java.lang.reflect.Method;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.DoubleBuffer;
+import java.nio.FloatBuffer;
+import java.nio.LongBuffer;
+import java.nio.ShortBuffer;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+import org.jocl.CL;
+import org.jocl.Pointer;
+import org.jocl.Sizeof;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_context_properties;
+import org.jocl.cl_device_id;
+import org.jocl.cl_event;
+import org.jocl.cl_mem;
+import org.jocl.cl_platform_id;
+
+/**
+ * A replay of a {@link CLBlastCallTrace}. It re-issues the recorded 
+ * calls through the same {@link CLBlast} methods, with the recorded 
+ * scalar, shape and host array arguments, in the recorded order. 
+ * <p>
+ * Each recorded memory object is replaced by a zero-filled synthetic 
+ * buffer that has the largest size with which the memory object was 
+ * used, so that calls that used the same memory object also use the 
+ * same synthetic buffer. The recorded queues are mapped to the given 
+ * queues, in the order of their first use. The recorded events and 
+ * wait lists are not replayed, so dependencies between different 
+ * queues are not preserved. Calls that did not succeed when they were
+ * recorded are skipped.
+ * <p>
+ * Usage example:
+ * <pre><code>
+ * CLBlastTraceReplay replay = new CLBlastTraceReplay(context, queue);
+ * replay.prepare(trace);
+ * long nanos = replay.run();
+ * replay.release();
+ * </code></pre>
+ * The {@link #main(String[])} method offers a command line tool that
+ * replays a call trace file on a device, to benchmark the workload that
+ * it describes.
+ */
+public final class CLBlastTraceReplay
+{
+    /**
+     * A call that has been prepared for the replay
+     */
+    private static final class PreparedCall
+    {
+        /**
+         * The method that is called
+         */
+        private final Method method;
+
+        /**
+         * The arguments for the method
+         */
+        private final Object arguments[];
+
+        /**
+         * Creates a new instance
+         *
+         * @param method The method
+         * @param arguments The arguments
+         */
+        PreparedCall(Method method, Object arguments[])
+        {
+            this.method = method;
+            this.arguments = arguments;
+        }
+    }
+
+    /**
+     * The context
+     */
+    private final cl_context context;
+
+    /**
+     * The queues
+     */
+    private final cl_command_queue queues[];
+
+    /**
+     * The device of the first queue
+     */
+    private final cl_device_id device;
+
+    /**
+     * The synthetic buffers, for the recorded memory object handles
+     */
+    private final Map<Long, cl_mem> buffers;
+
+    /**
+     * The sizes of the synthetic buffers
+     */
+    private final Map<Long, Long> bufferSizes;
+
+    /**
+     * The queues, for the recorded queue handles
+     */
+    private final Map<Long, cl_command_queue> queueMapping;
+
+    /**
+     * The methods, for the routine names and parameter types
+     */
+    private final Map<String, Method> methods;
+
+    /**
+     * The prepared calls
+     */
+    private final List<PreparedCall> preparedCalls;
+
+    /**
+     * Creates a new replay that creates its synthetic buffers in the 
+     * given context, and issues the calls on the given queues
+     *
+     * @param context The context
+     * @param queues The queues
+     * @throws IllegalArgumentException If no queues are given
+     */
+    public CLBlastTraceReplay(cl_context context, cl_command_queue... queues)
+    {
+        if (queues.length == 0)
+        {
+            throw new IllegalArgumentException("No queues given");
+        }
+        this.context = context;
+        this.queues = queues.clone();
+        this.device = new cl_device_id();
+        clGetCommandQueueInfo(queues[0], CL_QUEUE_DEVICE, 
+            Sizeof.cl_device_id, Pointer.to(device), null);
+        this.buffers = new HashMap<Long, cl_mem>();
+        this.bufferSizes = new HashMap<Long, Long>();
+        this.queueMapping = new HashMap<Long, cl_command_queue>();
+        this.methods = new HashMap<String, Method>();
+        this.preparedCalls = new ArrayList<PreparedCall>();
+    }
+
+    /**
+     * Prepare the replay of the given call trace. This creates the 
+     * synthetic buffers, resolves the methods, and creates the 
+     * arguments for all calls, so that {@link #run()} only has to issue
+     * the calls. The calls of earlier traces that have been prepared
+     * are replaced.
+     *
+     * @param trace The call trace
+     * @return The number of calls that will be replayed
+     * @throws IllegalArgumentException If the trace contains a call of
+     * a routine that can not be replayed
+     */
+    public int prepare(CLBlastCallTrace trace)
+    {
+        preparedCalls.clear();
+        List<CLBlastCallTrace.Call> calls = new ArrayList<CLBlastCallTrace.Call>();
+        for (CLBlastCallTrace.Call call : trace.getCalls())
+        {
+            if (call.getStatus() == CLBlastStatusCode.CLBlastSuccess)
+            {
+                calls.add(call);
+                prepareResources(call);
+            }
+        }
+        for (CLBlastCallTrace.Call call : calls)
+        {
+            preparedCalls.add(prepareCall(call));
+        }
+        for (cl_command_queue queue : queues)
+        {
+            clFinish(queue);
+        }
+        return preparedCalls.size();
+    }
+
+    /**
+     * Issue all prepared calls, and wait until they are finished on all
+     * queues
+     *
+     * @return The elapsed time, in nanoseconds
+     */
+    public long run()
+    {
+        long before = System.nanoTime();
+        for (PreparedCall preparedCall : preparedCalls)
+        {
+            invoke(preparedCall);
+        }
+        for (cl_command_queue queue : queues)
+        {
+            clFinish(queue);
+        }
+        return System.nanoTime() - before;
+    }
+
+    /**
+     * Release all synthetic buffers that have been created by this 
+     * replay. The queues and the context are not released.
+     */
+    public void release()
+    {
+        for (cl_mem buffer : buffers.values())
+        {
+            clReleaseMemObject(buffer);
+        }
+        buffers.clear();
+        bufferSizes.clear();
+        preparedCalls.clear();
+    }
+
+    /**
+     * Create or enlarge the synthetic buffers for the memory objects of
+     * the given call, and assign a queue to its recorded queue
+     *
+     * @param call The call
+     */
+    private void prepareResources(CLBlastCallTrace.Call call)
+    {
+        for (int i = 0; i < call.getArgumentCount(); i++)
+        {
+            int kind = call.getKind(i);
+            if (kind == CLBlastCallTrace.ARGUMENT_MEM)
+            {
+                long mem[] = (long[])call.getValue(i);
+                Long size = bufferSizes.get(mem[0]);
+                if (size == null || size < mem[1])
+                {
+                    cl_mem oldBuffer = buffers.get(mem[0]);
+                    if (oldBuffer != null)
+                    {
+                        clReleaseMemObject(oldBuffer);
+                    }
+                    buffers.put(mem[0], createBuffer(mem[1]));
+                    bufferSizes.put(mem[0], mem[1]);
+                }
+            }
+            else if (kind == CLBlastCallTrace.ARGUMENT_QUEUE || 
+                kind == CLBlastCallTrace.ARGUMENT_QUEUE_WAIT_LIST)
+            {
+                long handle = kind == CLBlastCallTrace.ARGUMENT_QUEUE ?
+                    (Long)call.getValue(i) : ((long[])call.getValue(i))[0];
+                if (!queueMapping.containsKey(handle))
+                {
+                    queueMapping.put(handle, 
+                        queues[queueMapping.size() % queues.length]);
+                }
+            }
+        }
+    }
+
+    /**
+     * Create a zero-filled synthetic buffer with the given size
+     *
+     * @param size The size, in bytes
+     * @return The buffer
+     */
+    private cl_mem createBuffer(long size)
+    {
+        long bufferSize = Math.max(size, 4);
+        long fillSize = bufferSize - bufferSize % 4;
+        cl_mem buffer = clCreateBuffer(
+            context, CL_MEM_READ_WRITE, bufferSize, null, null);
+        clEnqueueFillBuffer(queues[0], buffer, Pointer.to(new int[1]), 
+            Sizeof.cl_int, 0, fillSize, 0, null, null);
+        return buffer;
+    }
+
+    /**
+     * Create the prepared call for the given call
+     *
+     * @param call The call
+     * @return The prepared call
+     */
+    private PreparedCall prepareCall(CLBlastCallTrace.Call call)
+    {
+        List<Class<?>> types = new ArrayList<Class<?>>();
+        List<Object> arguments = new ArrayList<Object>();
+        for (int i = 0; i < call.getArgumentCount(); i++)
+        {
+            addArgument(call.getKind(i), call.getValue(i), types, arguments);
+        }
+        Class<?> typesArray[] = types.toArray(new Class<?>[0]);
+        String key = call.getRoutine() + types;
+        Method method = methods.get(key);
+        if (method == null)
+        {
+            try
+            {
+                method = CLBlast.class.getMethod(call.getRoutine(), typesArray);
+            }
+            catch (NoSuchMethodException e)
+            {
+                throw new IllegalArgumentException(
+                    "The call can not be replayed: " + call, e);
+            }
+            methods.put(key, method);
+        }
+        return new PreparedCall(method, arguments.toArray());
+    }
+
+    /**
+     * Add the Java parameter types and the arguments for the recorded
+     * argument with the given kind and value to the given lists
+     *
+     * @param kind The kind
+     * @param value The value
+     * @param types The parameter types
+     * @param arguments The arguments
+     */
+    private void addArgument(int kind, Object value, 
+        List<Class<?>> types, List<Object> arguments)
+    {
+        switch (kind)
+        {
+            case CLBlastCallTrace.ARGUMENT_SIZE:
+                types.add(long.class);
+                arguments.add(value);
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_ENUM:
+                types.add(int.class);
+                arguments.add(value);
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_FLOAT:
+            case CLBlastCallTrace.ARGUMENT_HALF:
+                types.add(float.class);
+                arguments.add(value);
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_DOUBLE:
+                types.add(double.class);
+                arguments.add(value);
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_COMPLEX_FLOAT:
+            {
+                float complex[] = (float[])value;
+                types.add(float.class);
+                types.add(float.class);
+                arguments.add(complex[0]);
+                arguments.add(complex[1]);
+                break;
+            }
+
+            case CLBlastCallTrace.ARGUMENT_COMPLEX_DOUBLE:
+            {
+                double complex[] = (double[])value;
+                types.add(double.class);
+                types.add(double.class);
+                arguments.add(complex[0]);
+                arguments.add(complex[1]);
+                break;
+            }
+
+            case CLBlastCallTrace.ARGUMENT_MEM:
+                types.add(cl_mem.class);
+                arguments.add(buffers.get(((long[])value)[0]));
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_DEVICE:
+                types.add(cl_device_id.class);
+                arguments.add(device);
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_QUEUE:
+                types.add(cl_command_queue.class);
+                arguments.add(queueMapping.get((Long)value));
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_QUEUE_WAIT_LIST:
+                types.add(cl_command_queue.class);
+                types.add(cl_event[].class);
+                arguments.add(queueMapping.get(((long[])value)[0]));
+                arguments.add(null);
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_EVENT:
+                types.add(cl_event.class);
+                arguments.add(null);
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_FLOAT2_VALUE:
+            case CLBlastCallTrace.ARGUMENT_FLOAT_ARRAY:
+            case CLBlastCallTrace.ARGUMENT_FLOAT2_ARRAY:
+            case CLBlastCallTrace.ARGUMENT_HALF_ARRAY:
+                types.add(float[].class);
+                arguments.add(value);
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_DOUBLE2_VALUE:
+            case CLBlastCallTrace.ARGUMENT_DOUBLE_ARRAY:
+            case CLBlastCallTrace.ARGUMENT_DOUBLE2_ARRAY:
+                types.add(double[].class);
+                arguments.add(value);
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_SIZE_ARRAY:
+                types.add(long[].class);
+                arguments.add(value);
+                break;
+
+            case CLBlastCallTrace.ARGUMENT_DIRECT_FLOAT:
+            case CLBlastCallTrace.ARGUMENT_DIRECT_FLOAT2:
+            {
+                float array[] = (float[])value;
+                types.add(FloatBuffer.class);
+                arguments.add(allocate(array.length * 4)
+                    .asFloatBuffer().put(array).rewind());
+                break;
+            }
+
+            case CLBlastCallTrace.ARGUMENT_DIRECT_DOUBLE:
+            case CLBlastCallTrace.ARGUMENT_DIRECT_DOUBLE2:
+            {
+                double array[] = (double[])value;
+                types.add(DoubleBuffer.class);
+                arguments.add(allocate(array.length * 8)
+                    .asDoubleBuffer().put(array).rewind());
+                break;
+            }
+
+            case CLBlastCallTrace.ARGUMENT_DIRECT_HALF:
+            {
+                short array[] = (short[])value;
+                types.add(ShortBuffer.class);
+                arguments.add(allocate(array.length * 2)
+                    .asShortBuffer().put(array).rewind());
+                break;
+            }
+
+            case CLBlastCallTrace.ARGUMENT_DIRECT_SIZE:
+            {
+                long array[] = (long[])value;
+                types.add(LongBuffer.class);
+                arguments.add(allocate(array.length * 8)
+                    .asLongBuffer().put(array).rewind());
+                break;
+            }
+
+            default:
+                throw new IllegalArgumentException(
+                    "Invalid argument kind: " + kind);
+        }
+    }
+
+    /**
+     * Allocate a direct byte buffer with the given size and the native
+     * byte order
+     *
+     * @param size The size
+     * @return The buffer
+     */
+    private static ByteBuffer allocate(int size)
+    {
+        return ByteBuffer.allocateDirect(size).order(ByteOrder.nativeOrder());
+    }
+
+    /**
+     * Invoke the given prepared call
+     *
+     * @param preparedCall The prepared call
+     */
+    private static void invoke(PreparedCall preparedCall)
+    {
+        try
+        {
+            preparedCall.method.invoke(null, preparedCall.arguments);
+        }
+        catch (IllegalAccessException e)
+        {
+            throw new IllegalStateException(e);
+        }
+        catch (InvocationTargetException e)
+        {
+            Throwable cause = e.getCause();
+            if (cause instanceof RuntimeException)
+            {
+                throw (RuntimeException)cause;
+            }
+            throw new IllegalStateException(cause);
+        }
+    }
+
+    /**
+     * Entry point of the replay tool. The arguments are the name of a 
+     * call trace file that was written with 
+     * {@link CLBlastCallTrace#write(java.io.OutputStream)}, and 
+     * optionally the number of iterations, the platform index and the
+     * device index. The tool replays the trace the given number of 
+     * times, and prints the elapsed time of each iteration, and the 
+     * device time of the routines as it is reported by
+     * {@link CLBlast#getProfile()}.
+     *
+     * @param args The command line arguments
+     * @throws IOException If the file can not be read
+     */
+    public static void main(String args[]) throws IOException
+    {
+        if (args.length < 1)
+        {
+            System.out.println("Usage: CLBlastTraceReplay <traceFile> " + 
+                "[iterations] [platformIndex] [deviceIndex]");
+            return;
+        }
+        int iterations = args.length > 1 ? Integer.parseInt(args[1]) : 10;
+        int platformIndex = args.length > 2 ? Integer.parseInt(args[2]) : 0;
+        int deviceIndex = args.length > 3 ? Integer.parseInt(args[3]) : 0;
+
+        CLBlastCallTrace trace = null;
+        try (InputStream inputStream = 
+            new BufferedInputStream(new FileInputStream(args[0])))
+        {
+            trace = CLBlastCallTrace.read(inputStream);
+        }
+
+        CL.setExceptionsEnabled(true);
+        CLBlast.setExceptionsEnabled(true);
+
+        int numPlatforms[] = new int[1];
+        clGetPlatformIDs(0, null, numPlatforms);
+        cl_platform_id platforms[] = new cl_platform_id[numPlatforms[0]];
+        clGetPlatformIDs(platforms.length, platforms, null);
+        cl_platform_id platform = platforms[platformIndex];
+        int numDevices[] = new int[1];
+        clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 0, null, numDevices);
+        cl_device_id devices[] = new cl_device_id[numDevices[0]];
+        clGetDeviceIDs(platform, CL_DEVICE_TYPE_ALL, devices.length, 
+            devices, null);
+        cl_device_id device = devices[deviceIndex];
+        cl_context_properties contextProperties = new cl_context_properties();
+        contextProperties.addProperty(CL_CONTEXT_PLATFORM, platform);
+        cl_context context = clCreateContext(
+            contextProperties, 1, new cl_device_id[] { device }, 
+            null, null, null);
+        cl_command_queue queue = clCreateCommandQueue(
+            context, device, CL_QUEUE_PROFILING_ENABLE, null);
+
+        CLBlastTraceReplay replay = new CLBlastTraceReplay(context, queue);
+        int calls = replay.prepare(trace);
+        System.out.println("Replaying " + calls + " calls of " + 
+            trace.getCalls().size() + " recorded calls");
+
+        // The first iteration includes the compilation of the kernels
+        long warmupNanos = replay.run();
+        System.out.printf("Warmup: %.3f ms%n", warmupNanos / 1e6);
+        CLBlast.setProfilingEnabled(true);
+        CLBlast.resetProfile();
+        for (int i = 0; i < iterations; i++)
+        {
+            long nanos = replay.run();
+            System.out.printf("Iteration %d: %.3f ms%n", i, nanos / 1e6);
+        }
+        CLBlast.setProfilingEnabled(false);
+        Map<String, long[]> routineTimes = new LinkedHashMap<String, long[]>();
+        for (CLBlastProfile.Entry entry : CLBlast.getProfile().getEntries())
+        {
+            long times[] = routineTimes.get(entry.getRoutine());
+            if (times == null)
+            {
+                times = new long[2];
+                routineTimes.put(entry.getRoutine(), times);
+            }
+            times[0] += entry.getCalls();
+            times[1] += entry.getTotalNanos();
+        }
+        for (Map.Entry<String, long[]> entry : routineTimes.entrySet())
+        {
+            long times[] = entry.getValue();
+            System.out.printf("%-28s %10d calls %12.3f ms device time%n", 
+                entry.getKey(), times[0], times[1] / 1e6);
+        }
+
+        replay.release();
+        clReleaseCommandQueue(queue);
+        clReleaseContext(context);
+    }
+}
@@ -0,0 +1,1344 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_DEVICE_LOCAL_MEM_SIZE;
+import static org.jocl.CL.CL_DEVICE_MAX_WORK_GROUP_SIZE;
+import static org.jocl.CL.CL_DEVICE_NAME;
+import static org.jocl.CL.CL_MEM_READ_WRITE;
+import static org.jocl.CL.CL_QUEUE_CONTEXT;
+import static org.jocl.CL.CL_QUEUE_DEVICE;
+import static org.jocl.CL.clCreateBuffer;
+import static org.jocl.CL.clEnqueueFillBuffer;
+import static org.jocl.CL.clFinish;
+import static org.jocl.CL.clGetCommandQueueInfo;
+import static org.jocl.CL.clGetDeviceInfo;
+import static org.jocl.CL.clReleaseMemObject;
+
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+import java.util.Properties;
+import java.util.Random;
+
+import org.jocl.CLException;
+import org.jocl.Pointer;
+import org.jocl.Sizeof;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_device_id;
+import org.jocl.cl_mem;
+
+/**
+ * In-process tuning of the CLBlast GEMM kernels for a specific shape.
+ * <p>
+ * The CLBlast tuners are separate executables that tune the kernels for
+ * a few default sizes. This class benchmarks candidate parameter sets
+ * for the <code>XgemmDirect</code> and <code>Xgemm</code> kernels, for
+ * one concrete GEMM shape, on a given queue. The best parameters are
+ * applied with {@link CLBlast#CLBlastOverrideParameters}. The
+ * <code>XGEMM_MIN_INDIRECT_SIZE</code> parameter of the
+ * <code>GemmRoutine</code> is adjusted so that CLBlast selects the
+ * winning kernel for the tuned shape. For example:
+ * <pre><code>
+ * CLBlastTuner tuner = new CLBlastTuner(queue);
+ * tuner.setDatabaseDirectory(new File("tuning"));
+ * CLBlastTuner.Result result = tuner.tuneGemm(
+ *     CLBlastPrecisionSingle, CLBlastLayoutRowMajor,
+ *     CLBlastTransposeNo, CLBlastTransposeYes, 3072, 77, 768);
+ * </code></pre>
+ * If a database directory is set, then the results are persisted for
+ * the device model, i.e. the <code>CL_DEVICE_NAME</code>: The applied
+ * parameters are written with
+ * {@link CLBlast#exportTuningDatabase(cl_device_id, java.io.File)}, and
+ * loaded with {@link CLBlast#loadTuningDatabase(cl_device_id,
+ * java.io.File)} when the tuner is used for the first time. The tuned
+ * shapes and their results are stored in a properties file next to the
+ * database. A shape that has already been tuned for the device model is
+ * not benchmarked again, but its stored parameters are applied.
+ * <p>
+ * Note that the parameters are applied for the device, kernel and
+ * precision, and not for a single shape. Tuning several shapes that
+ * use the same kernel will replace the parameters of the previous
+ * shapes. The benchmarks use the given queue, and the candidate
+ * parameters are applied while they are measured, so no other GEMM
+ * should be executed on the device during the tuning. The half
+ * precision is not supported.
+ * <p>
+ * The best candidate is only applied when it is faster than the 
+ * parameters that have been applied before the tuning. Otherwise, and
+ * when none of the candidates can be executed, the previous parameters
+ * are restored. CLBlast offers no way to remove an override, so this is
+ * only possible for kernels whose parameters have been applied with
+ * {@link CLBlast#CLBlastOverrideParameters} or 
+ * {@link CLBlast#loadTuningDatabase(cl_device_id, java.io.File)}. A 
+ * kernel that still used the parameters from the CLBlast database keeps
+ * the fastest candidate that was measured for it.
+ * <p>
+ * Instances of this class are thread-safe, but calls are serialized.
+ */
+public final class CLBlastTuner
+{
+    /**
+     * The default maximum number of candidate parameter sets that are
+     * benchmarked for each shape
+     */
+    private static final int DEFAULT_MAX_CANDIDATES = 64;
+
+    /**
+     * The default number of timed runs for each candidate
+     */
+    private static final int DEFAULT_RUNS = 10;
+
+    /**
+     * The seed for selecting the candidates, so that the same candidates
+     * are benchmarked for the same shape
+     */
+    private static final long CANDIDATE_SEED = 0x5DEECE66DL;
+
+    /**
+     * The name of the kernel that selects between the direct and the
+     * indirect GEMM kernel
+     */
+    private static final String GEMM_ROUTINE = "GemmRoutine";
+
+    /**
+     * The parameter of the {@link #GEMM_ROUTINE}. The direct kernel is used
+     * when m*n*k is smaller than the third power of this value.
+     */
+    private static final String MIN_INDIRECT_SIZE = "XGEMM_MIN_INDIRECT_SIZE";
+
+    /**
+     * The name of the direct GEMM kernel
+     */
+    private static final String XGEMM_DIRECT = "XgemmDirect";
+
+    /**
+     * The name of the indirect GEMM kernel
+     */
+    private static final String XGEMM = "Xgemm";
+
+    /**
+     * The parameter names of the {@link #XGEMM_DIRECT} kernel
+     */
+    private static final String XGEMM_DIRECT_PARAMETERS[] =
+    {
+        "KWID", "MDIMAD", "MDIMCD", "NDIMBD", "NDIMCD",
+        "PADA", "PADB", "VWMD", "VWND", "WGD"
+    };
+
+    /**
+     * The parameter names of the {@link #XGEMM} kernel
+     */
+    private static final String XGEMM_PARAMETERS[] =
+    {
+        "GEMMK", "KREG", "KWG", "KWI", "MDIMA", "MDIMC", "MWG",
+        "NDIMB", "NDIMC", "NWG", "SA", "SB", "STRM", "STRN", "VWM", "VWN"
+    };
+
+    /**
+     * The result of tuning a shape
+     */
+    public static final class Result
+    {
+        /**
+         * The name of the winning kernel
+         */
+        private final String kernel;
+
+        /**
+         * The parameter names
+         */
+        private final String parameterNames[];
+
+        /**
+         * The parameter values
+         */
+        private final long parameterValues[];
+
+        /**
+         * The value of the XGEMM_MIN_INDIRECT_SIZE parameter
+         */
+        private final long minIndirectSize;
+
+        /**
+         * The GFLOP/s with the winning parameters
+         */
+        private final double gflops;
+
+        /**
+         * The GFLOP/s before the tuning
+         */
+        private final double baselineGflops;
+
+        /**
+         * The number of candidates that have been benchmarked
+         */
+        private final int candidates;
+
+        /**
+         * Whether the result was read from the database
+         */
+        private final boolean cached;
+
+        /**
+         * Whether the winning parameters have been applied
+         */
+        private final boolean applied;
+
+        /**
+         * Creates a new instance
+         *
+         * @param kernel The kernel
+         * @param parameterNames The parameter names
+         * @param parameterValues The parameter values
+         * @param minIndirectSize The XGEMM_MIN_INDIRECT_SIZE
+         * @param gflops The GFLOP/s
+         * @param baselineGflops The baseline GFLOP/s
+         * @param candidates The number of candidates
+         * @param cached Whether the result was read from the database
+         * @param applied Whether the parameters have been applied
+         */
+        Result(String kernel, String parameterNames[],
+            long parameterValues[], long minIndirectSize, double gflops,
+            double baselineGflops, int candidates, boolean cached,
+            boolean applied)
+        {
+            this.kernel = kernel;
+            this.parameterNames = parameterNames.clone();
+            this.parameterValues = parameterValues.clone();
+            this.minIndirectSize = minIndirectSize;
+            this.gflops = gflops;
+            this.baselineGflops = baselineGflops;
+            this.candidates = candidates;
+            this.cached = cached;
+            this.applied = applied;
+        }
+
+        /**
+         * Returns the name of the winning kernel, which is either
+         * <code>"XgemmDirect"</code> or <code>"Xgemm"</code>
+         *
+         * @return The kernel name
+         */
+        public String getKernel()
+        {
+            return kernel;
+        }
+
+        /**
+         * Returns the names of the parameters of the winning kernel
+         *
+         * @return The parameter names
+         */
+        public String[] getParameterNames()
+        {
+            return parameterNames.clone();
+        }
+
+        /**
+         * Returns the values of the parameters of the winning kernel
+         *
+         * @return The parameter values
+         */
+        public long[] getParameterValues()
+        {
+            return parameterValues.clone();
+        }
+
+        /**
+         * Returns the value of the <code>XGEMM_MIN_INDIRECT_SIZE</code>
+         * parameter that was applied for the <code>GemmRoutine</code>
+         *
+         * @return The minimum indirect size
+         */
+        public long getMinIndirectSize()
+        {
+            return minIndirectSize;
+        }
+
+        /**
+         * Returns the GFLOP/s that have been achieved with the winning
+         * parameters
+         *
+         * @return The GFLOP/s
+         */
+        public double getGflops()
+        {
+            return gflops;
+        }
+
+        /**
+         * Returns the GFLOP/s that have been achieved with the parameters
+         * that were applied before the tuning, or <code>NaN</code> if they
+         * have not been measured
+         *
+         * @return The baseline GFLOP/s
+         */
+        public double getBaselineGflops()
+        {
+            return baselineGflops;
+        }
+
+        /**
+         * Returns the number of candidate parameter sets that have been
+         * benchmarked
+         *
+         * @return The number of candidates
+         */
+        public int getCandidates()
+        {
+            return candidates;
+        }
+
+        /**
+         * Returns whether this result was read from the database, and
+         * the shape was not benchmarked again
+         *
+         * @return Whether the result was cached
+         */
+        public boolean isCached()
+        {
+            return cached;
+        }
+
+        /**
+         * Returns whether the winning parameters have been applied. This
+         * is <code>false</code> if they have not been faster than the
+         * parameters that have been applied before the tuning, and the 
+         * previous parameters have been restored.
+         *
+         * @return Whether the parameters have been applied
+         */
+        public boolean isApplied()
+        {
+            return applied;
+        }
+
+        @Override
+        public String toString()
+        {
+            StringBuilder sb = new StringBuilder();
+            sb.append(kernel).append(" {");
+            sb.append(formatParameters(parameterNames, parameterValues));
+            sb.append("}, ").append(MIN_INDIRECT_SIZE).append("=");
+            sb.append(minIndirectSize);
+            sb.append(String.format(", %.2f GFLOP/s", gflops));
+            if (!Double.isNaN(baselineGflops))
+            {
+                sb.append(String.format(" (before: %.2f GFLOP/s)",
+                    baselineGflops));
+            }
+            if (cached)
+            {
+                sb.append(", cached");
+            }
+            if (!applied)
+            {
+                sb.append(", not applied");
+            }
+            return sb.toString();
+        }
+    }
+
+    /**
+     * A candidate parameter set for one kernel
+     */
+    private static final class Candidate
+    {
+        /**
+         * The kernel name
+         */
+        final String kernel;
+
+        /**
+         * The parameter names
+         */
+        final String names[];
+
+        /**
+         * The parameter values
+         */
+        final long values[];
+
+        /**
+         * Creates a new candidate
+         *
+         * @param kernel The kernel name
+         * @param names The parameter names
+         * @param values The parameter values
+         */
+        Candidate(String kernel, String names[], long values[])
+        {
+            this.kernel = kernel;
+            this.names = names;
+            this.values = values;
+        }
+    }
+
+    /**
+     * The queue for the benchmarks
+     */
+    private final cl_command_queue queue;
+
+    /**
+     * The context of the queue
+     */
+    private final cl_context context;
+
+    /**
+     * The device of the queue
+     */
+    private final cl_device_id device;
+
+    /**
+     * The directory for the tuning database, or <code>null</code>
+     */
+    private File databaseDirectory;
+
+    /**
+     * Whether the tuning database has already been loaded from the
+     * {@link #databaseDirectory}
+     */
+    private boolean databaseLoaded;
+
+    /**
+     * The maximum number of candidates for each shape
+     */
+    private int maxCandidates = DEFAULT_MAX_CANDIDATES;
+
+    /**
+     * The number of timed runs for each candidate
+     */
+    private int runs = DEFAULT_RUNS;
+
+    /**
+     * Creates a new tuner that runs the benchmarks on the given queue.
+     * The queue must remain valid while the tuner is used.
+     *
+     * @param queue The queue
+     * @throws NullPointerException If the queue is <code>null</code>
+     * @throws CLException If the device or context of the queue cannot
+     * be obtained
+     */
+    public CLBlastTuner(cl_command_queue queue)
+    {
+        if (queue == null)
+        {
+            throw new NullPointerException("The queue may not be null");
+        }
+        this.queue = queue;
+        this.context = new cl_context();
+        CLBlastTiledGemm.check(clGetCommandQueueInfo(queue,
+            CL_QUEUE_CONTEXT, Sizeof.cl_context, Pointer.to(context),
+            null), "clGetCommandQueueInfo");
+        this.device = new cl_device_id();
+        CLBlastTiledGemm.check(clGetCommandQueueInfo(queue,
+            CL_QUEUE_DEVICE, Sizeof.cl_device_id, Pointer.to(device),
+            null), "clGetCommandQueueInfo");
+    }
+
+    /**
+     * Set the directory where the tuning results are stored for each
+     * device model. If this is <code>null</code>, then the results are
+     * only applied, but not persisted. The directory is created when
+     * the first result is written.
+     *
+     * @param databaseDirectory The directory
+     */
+    public synchronized void setDatabaseDirectory(File databaseDirectory)
+    {
+        this.databaseDirectory = databaseDirectory;
+        this.databaseLoaded = false;
+    }
+
+    /**
+     * Set the maximum number of candidate parameter sets that are
+     * benchmarked for each shape. The candidates are selected from
+     * all valid parameter sets of both kernels.
+     *
+     * @param maxCandidates The maximum number of candidates
+     * @throws IllegalArgumentException If the value is not positive
+     */
+    public synchronized void setMaxCandidates(int maxCandidates)
+    {
+        if (maxCandidates <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The maximum number of candidates must be positive, " +
+                "but is " + maxCandidates);
+        }
+        this.maxCandidates = maxCandidates;
+    }
+
+    /**
+     * Set the number of timed runs for each candidate. Each candidate is
+     * executed once more before the timed runs, to compile the kernel.
+     *
+     * @param runs The number of runs
+     * @throws IllegalArgumentException If the value is not positive
+     */
+    public synchronized void setRuns(int runs)
+    {
+        if (runs <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The number of runs must be positive, but is " + runs);
+        }
+        this.runs = runs;
+    }
+
+    /**
+     * Tune the GEMM kernels for the given shape, and apply the best
+     * parameters. If a database directory was set, and the shape has
+     * already been tuned for the device model, then the stored result
+     * is applied and returned.
+     *
+     * @param precision The {@link CLBlastPrecision}
+     * @param layout The {@link CLBlastLayout}
+     * @param a_transpose The {@link CLBlastTranspose} for A
+     * @param b_transpose The {@link CLBlastTranspose} for B
+     * @param m The number of rows of C
+     * @param n The number of columns of C
+     * @param k The inner dimension
+     * @return The result
+     * @throws IllegalArgumentException If the precision is not supported,
+     * or any size is not positive
+     * @throws IllegalStateException If none of the candidates could be
+     * executed. The previous parameters are restored in this case.
+     * @throws CLException If the benchmark buffers cannot be created, or
+     * the best parameters cannot be applied
+     * @throws IOException If the database cannot be read or written
+     */
+    public synchronized Result tuneGemm(int precision, int layout,
+        int a_transpose, int b_transpose, long m, long n, long k)
+        throws IOException
+    {
+        long elementSize = CLBlastTiledGemm.elementSize(precision);
+        if (m <= 0 || n <= 0 || k <= 0)
+        {
+            throw new IllegalArgumentException(
+                "The sizes must be positive, but are m=" + m +
+                ", n=" + n + ", k=" + k);
+        }
+        String shape = "gemm/" + precision + "/" + layout + "/" +
+            a_transpose + "/" + b_transpose + "/" + m + "/" + n + "/" + k;
+
+        Properties shapes = null;
+        if (databaseDirectory != null)
+        {
+            loadDatabase();
+            shapes = readShapes();
+            Result cached = obtainCachedResult(precision, shapes, shape);
+            if (cached != null)
+            {
+                return cached;
+            }
+        }
+
+        GemmBuffers buffers = new GemmBuffers(precision, layout,
+            a_transpose, b_transpose, m, n, k, elementSize);
+        try
+        {
+            Result result = benchmark(precision, buffers, elementSize);
+            if (shapes != null && result.isApplied())
+            {
+                writeDatabase(shapes, shape, result);
+            }
+            return result;
+        }
+        finally
+        {
+            buffers.release();
+        }
+    }
+
+    /**
+     * Benchmark the candidates on the given buffers, and apply the best
+     * one if it is faster than the previous parameters. Otherwise, the
+     * previous parameters are restored.
+     *
+     * @param precision The precision
+     * @param buffers The buffers
+     * @param elementSize The element size
+     * @return The result
+     */
+    private Result benchmark(int precision, GemmBuffers buffers,
+        long elementSize)
+    {
+        String kernels[] = { XGEMM_DIRECT, XGEMM, GEMM_ROUTINE };
+        Candidate previous[] = new Candidate[kernels.length];
+        for (int i = 0; i < kernels.length; i++)
+        {
+            previous[i] = obtainApplied(precision, kernels[i]);
+        }
+        double baselineGflops = measure(precision, buffers);
+
+        List<Candidate> candidates = selectCandidates(elementSize);
+        long directSize = minIndirectSizeForDirect(buffers.mnk());
+        Candidate best = null;
+        double bestGflops = 0.0;
+        Candidate bestDirect = null;
+        double bestDirectGflops = 0.0;
+        Candidate bestIndirect = null;
+        double bestIndirectGflops = 0.0;
+        int measured = 0;
+        for (Candidate candidate : candidates)
+        {
+            boolean direct = candidate.kernel.equals(XGEMM_DIRECT);
+            if (!apply(precision, candidate, direct ? directSize : 0))
+            {
+                continue;
+            }
+            double gflops = measure(precision, buffers);
+            if (Double.isNaN(gflops))
+            {
+                continue;
+            }
+            measured++;
+            if (gflops > bestGflops)
+            {
+                best = candidate;
+                bestGflops = gflops;
+            }
+            if (direct && gflops > bestDirectGflops)
+            {
+                bestDirect = candidate;
+                bestDirectGflops = gflops;
+            }
+            if (!direct && gflops > bestIndirectGflops)
+            {
+                bestIndirect = candidate;
+                bestIndirectGflops = gflops;
+            }
+        }
+        if (best == null)
+        {
+            restore(precision, previous);
+            throw new IllegalStateException(
+                "None of the " + candidates.size() +
+                " candidates could be executed");
+        }
+
+        // The minimum indirect size for the winner is the largest one that
+        // still selects the indirect kernel for this shape, or the smallest
+        // one that selects the direct kernel
+        boolean direct = best.kernel.equals(XGEMM_DIRECT);
+        long minIndirectSize = direct ?
+            directSize : directSize - 1;
+        if (!Double.isNaN(baselineGflops) && bestGflops <= baselineGflops)
+        {
+            // Kernels without previous parameters keep their fastest 
+            // candidate, because the CLBlast defaults cannot be restored
+            Candidate fallback[] = { bestDirect, bestIndirect, 
+                new Candidate(GEMM_ROUTINE, 
+                    new String[] { MIN_INDIRECT_SIZE }, 
+                    new long[] { minIndirectSize }) };
+            for (int i = 0; i < previous.length; i++)
+            {
+                if (previous[i] == null)
+                {
+                    previous[i] = fallback[i];
+                }
+            }
+            restore(precision, previous);
+            return new Result(best.kernel, best.names, best.values,
+                minIndirectSize, bestGflops, baselineGflops, measured, 
+                false, false);
+        }
+        applyChecked(precision, best.kernel, best.names, best.values);
+        applyChecked(precision, GEMM_ROUTINE,
+            new String[] { MIN_INDIRECT_SIZE },
+            new long[] { minIndirectSize });
+        return new Result(best.kernel, best.names, best.values,
+            minIndirectSize, bestGflops, baselineGflops, measured, 
+            false, true);
+    }
+
+    /**
+     * Returns the parameters that have been applied for the given kernel
+     * before the tuning, or <code>null</code> if the kernel still uses
+     * the parameters from the CLBlast database
+     *
+     * @param precision The precision
+     * @param kernel The kernel name
+     * @return The parameters, or <code>null</code>
+     */
+    private Candidate obtainApplied(int precision, String kernel)
+    {
+        Object parameters[] = 
+            CLBlast.getTuningParameters(device, kernel, precision);
+        if (parameters == null)
+        {
+            return null;
+        }
+        return new Candidate(kernel, 
+            (String[])parameters[0], (long[])parameters[1]);
+    }
+
+    /**
+     * Apply the given parameters, skipping <code>null</code> elements.
+     * Parameters that cannot be applied are ignored, because they have
+     * been applied successfully before.
+     *
+     * @param precision The precision
+     * @param parameters The parameters
+     */
+    private void restore(int precision, Candidate parameters[])
+    {
+        for (Candidate candidate : parameters)
+        {
+            if (candidate != null)
+            {
+                apply(precision, candidate.kernel,
+                    candidate.names, candidate.values);
+            }
+        }
+    }
+
+    /**
+     * Apply the given candidate. If the given minimum indirect size is
+     * positive, then it is applied for the GemmRoutine, so that the
+     * direct kernel is used. Otherwise, 0 is applied, so that the
+     * indirect kernel is used.
+     *
+     * @param precision The precision
+     * @param candidate The candidate
+     * @param minIndirectSize The minimum indirect size
+     * @return Whether the parameters could be applied
+     */
+    private boolean apply(int precision, Candidate candidate,
+        long minIndirectSize)
+    {
+        return apply(precision, candidate.kernel,
+            candidate.names, candidate.values) &&
+            apply(precision, GEMM_ROUTINE,
+                new String[] { MIN_INDIRECT_SIZE },
+                new long[] { minIndirectSize });
+    }
+
+    /**
+     * Apply the given parameters with CLBlastOverrideParameters.
+     *
+     * @param precision The precision
+     * @param kernel The kernel name
+     * @param names The parameter names
+     * @param values The parameter values
+     * @return Whether the parameters could be applied
+     */
+    private boolean apply(int precision, String kernel,
+        String names[], long values[])
+    {
+        try
+        {
+            int status = CLBlast.CLBlastOverrideParameters(device, kernel,
+                precision, names.length, names, values);
+            return status == CLBlastStatusCode.CLBlastSuccess;
+        }
+        catch (CLException e)
+        {
+            return false;
+        }
+    }
+
+    /**
+     * Apply the given parameters with CLBlastOverrideParameters, and
+     * throw an exception if this fails
+     *
+     * @param precision The precision
+     * @param kernel The kernel name
+     * @param names The parameter names
+     * @param values The parameter values
+     * @throws CLException If the parameters cannot be applied
+     */
+    private void applyChecked(int precision, String kernel,
+        String names[], long values[])
+    {
+        int status = CLBlast.CLBlastOverrideParameters(device, kernel,
+            precision, names.length, names, values);
+        if (status != CLBlastStatusCode.CLBlastSuccess)
+        {
+            throw new CLException("Could not apply the parameters for " +
+                kernel + ": " + CLBlastStatusCode.stringFor(status), status);
+        }
+    }
+
+    /**
+     * Execute the GEMM on the given buffers once, to compile the kernels,
+     * and then for the configured number of runs, and return the achieved
+     * GFLOP/s. If the GEMM cannot be executed with the current parameters,
+     * then <code>NaN</code> is returned.
+     *
+     * @param precision The precision
+     * @param buffers The buffers
+     * @return The GFLOP/s
+     */
+    private double measure(int precision, GemmBuffers buffers)
+    {
+        try
+        {
+            buffers.enqueueGemm(precision, queue);
+            CLBlastTiledGemm.check(clFinish(queue), "clFinish");
+            long before = System.nanoTime();
+            for (int i = 0; i < runs; i++)
+            {
+                buffers.enqueueGemm(precision, queue);
+            }
+            CLBlastTiledGemm.check(clFinish(queue), "clFinish");
+            long ns = Math.max(1, System.nanoTime() - before);
+            double flops = 2.0 * buffers.mnk() * runs;
+            if (CLBlastTiledGemm.isComplex(precision))
+            {
+                flops *= 4.0;
+            }
+            return flops / ns;
+        }
+        catch (CLException e)
+        {
+            clFinish(queue);
+            return Double.NaN;
+        }
+    }
+
+    /**
+     * Returns the smallest value for the minimum indirect size so that
+     * the direct kernel is used for the given value of m*n*k, i.e. the
+     * smallest value whose third power is larger than m*n*k
+     *
+     * @param mnk The product m*n*k
+     * @return The minimum indirect size
+     */
+    static long minIndirectSizeForDirect(double mnk)
+    {
+        long size = (long)Math.floor(Math.cbrt(mnk));
+        while ((double)size * size * size > mnk)
+        {
+            size--;
+        }
+        while ((double)size * size * size <= mnk)
+        {
+            size++;
+        }
+        return size;
+    }
+
+    /**
+     * Select the candidates for both kernels. All valid parameter sets
+     * are enumerated, and a random subset is selected, with the same
+     * number of candidates for each kernel if possible.
+     *
+     * @param elementSize The element size
+     * @return The candidates
+     */
+    private List<Candidate> selectCandidates(long elementSize)
+    {
+        long maxWorkGroupSize = getSize(device, CL_DEVICE_MAX_WORK_GROUP_SIZE);
+        long localMemSize = getSize(device, CL_DEVICE_LOCAL_MEM_SIZE);
+        long maxLocalElements = localMemSize / elementSize;
+        List<Candidate> direct =
+            createDirectCandidates(maxWorkGroupSize, maxLocalElements);
+        List<Candidate> indirect =
+            createIndirectCandidates(maxWorkGroupSize, maxLocalElements);
+        Random random = new Random(CANDIDATE_SEED);
+        Collections.shuffle(direct, random);
+        Collections.shuffle(indirect, random);
+
+        int directCount = Math.min(direct.size(),
+            Math.max(maxCandidates / 2, maxCandidates - indirect.size()));
+        int indirectCount = Math.min(indirect.size(),
+            maxCandidates - directCount);
+        List<Candidate> candidates = new ArrayList<Candidate>();
+        candidates.addAll(direct.subList(0, directCount));
+        candidates.addAll(indirect.subList(0, indirectCount));
+        return candidates;
+    }
+
+    /**
+     * Create all candidates for the XgemmDirect kernel that satisfy the
+     * constraints of the CLBlast tuner and the device limits
+     *
+     * @param maxWorkGroupSize The maximum work group size
+     * @param maxLocalElements The maximum number of elements in local
+     * memory
+     * @return The candidates
+     */
+    static List<Candidate> createDirectCandidates(
+        long maxWorkGroupSize, long maxLocalElements)
+    {
+        long wgds[] = { 8, 16, 32, 64 };
+        long dims[] = { 8, 16, 32 };
+        long kwids[] = { 2, 8, 16 };
+        long vws[] = { 1, 2, 4, 8 };
+        long pad = 1;
+        List<Candidate> candidates = new ArrayList<Candidate>();
+        for (long wgd : wgds)
+        for (long mdimcd : dims)
+        for (long ndimcd : dims)
+        for (long mdimad : dims)
+        for (long ndimbd : dims)
+        for (long kwid : kwids)
+        for (long vwmd : vws)
+        for (long vwnd : vws)
+        {
+            if (mdimcd * ndimcd > maxWorkGroupSize ||
+                wgd % kwid != 0 ||
+                wgd % (mdimcd * vwmd) != 0 ||
+                wgd % (ndimcd * vwnd) != 0 ||
+                wgd % (mdimad * vwmd) != 0 ||
+                wgd % (ndimbd * vwnd) != 0 ||
+                (mdimcd * ndimcd) % mdimad != 0 ||
+                (mdimcd * ndimcd) % ndimbd != 0 ||
+                wgd % ((mdimcd * ndimcd) / mdimad) != 0 ||
+                wgd % ((mdimcd * ndimcd) / ndimbd) != 0 ||
+                2 * wgd * (wgd + pad) > maxLocalElements)
+            {
+                continue;
+            }
+            long values[] =
+            {
+                kwid, mdimad, mdimcd, ndimbd, ndimcd,
+                pad, pad, vwmd, vwnd, wgd
+            };
+            candidates.add(new Candidate(
+                XGEMM_DIRECT, XGEMM_DIRECT_PARAMETERS, values));
+        }
+        return candidates;
+    }
+
+    /**
+     * Create all candidates for the Xgemm kernel that satisfy the
+     * constraints of the CLBlast tuner and the device limits. Only the
+     * variant with GEMMK=0 and MDIMA=MDIMC, NDIMB=NDIMC is considered.
+     *
+     * @param maxWorkGroupSize The maximum work group size
+     * @param maxLocalElements The maximum number of elements in local
+     * memory
+     * @return The candidates
+     */
+    static List<Candidate> createIndirectCandidates(
+        long maxWorkGroupSize, long maxLocalElements)
+    {
+        long wgs[] = { 16, 32, 64, 128 };
+        long kwgs[] = { 16, 32 };
+        long dims[] = { 8, 16, 32 };
+        long vws[] = { 1, 2, 4, 8 };
+        long flags[] = { 0, 1 };
+        long kwi = 2;
+        List<Candidate> candidates = new ArrayList<Candidate>();
+        for (long mwg : wgs)
+        for (long nwg : wgs)
+        for (long kwg : kwgs)
+        for (long mdimc : dims)
+        for (long ndimc : dims)
+        for (long vwm : vws)
+        for (long vwn : vws)
+        for (long sa : flags)
+        for (long sb : flags)
+        {
+            long localElements = sa * kwg * mwg + sb * kwg * nwg;
+            if (mdimc * ndimc > maxWorkGroupSize ||
+                kwg % kwi != 0 ||
+                mwg % (mdimc * vwm) != 0 ||
+                nwg % (ndimc * vwn) != 0 ||
+                kwg % mdimc != 0 ||
+                kwg % ndimc != 0 ||
+                localElements > maxLocalElements)
+            {
+                continue;
+            }
+            long values[] =
+            {
+                0, 1, kwg, kwi, mdimc, mdimc, mwg,
+                ndimc, ndimc, nwg, sa, sb, 0, 0, vwm, vwn
+            };
+            candidates.add(new Candidate(
+                XGEMM, XGEMM_PARAMETERS, values));
+        }
+        return candidates;
+    }
+
+    /**
+     * If the stored shapes contain the given shape, then apply its stored
+     * parameters and return the result. Otherwise, return
+     * <code>null</code>.
+     *
+     * @param precision The precision
+     * @param shapes The stored shapes
+     * @param shape The shape key
+     * @return The result, or <code>null</code>
+     */
+    private Result obtainCachedResult(
+        int precision, Properties shapes, String shape)
+    {
+        String kernel = shapes.getProperty(shape + ".kernel");
+        String parameters = shapes.getProperty(shape + ".parameters");
+        String minIndirectSizeString =
+            shapes.getProperty(shape + ".minIndirectSize");
+        String gflopsString = shapes.getProperty(shape + ".gflops");
+        if (kernel == null || parameters == null ||
+            minIndirectSizeString == null || gflopsString == null)
+        {
+            return null;
+        }
+        try
+        {
+            String entries[] = parameters.split(",");
+            String names[] = new String[entries.length];
+            long values[] = new long[entries.length];
+            for (int i = 0; i < entries.length; i++)
+            {
+                int index = entries[i].indexOf('=');
+                if (index < 0)
+                {
+                    return null;
+                }
+                names[i] = entries[i].substring(0, index).trim();
+                values[i] = Long.parseLong(
+                    entries[i].substring(index + 1).trim());
+            }
+            long minIndirectSize = Long.parseLong(minIndirectSizeString);
+            double gflops = Double.parseDouble(gflopsString);
+            applyChecked(precision, kernel, names, values);
+            applyChecked(precision, GEMM_ROUTINE,
+                new String[] { MIN_INDIRECT_SIZE },
+                new long[] { minIndirectSize });
+            return new Result(kernel, names, values, minIndirectSize,
+                gflops, Double.NaN, 0, true, true);
+        }
+        catch (NumberFormatException e)
+        {
+            return null;
+        }
+    }
+
+    /**
+     * Load the tuning database for the device model from the database
+     * directory, if it exists and was not loaded yet
+     *
+     * @throws IOException If the database cannot be read
+     */
+    private void loadDatabase() throws IOException
+    {
+        if (databaseLoaded)
+        {
+            return;
+        }
+        File file = getDatabaseFile(".json");
+        if (file.exists())
+        {
+            CLBlast.loadTuningDatabase(device, file);
+        }
+        databaseLoaded = true;
+    }
+
+    /**
+     * Read the tuned shapes for the device model from the database
+     * directory. If the file does not exist, then empty properties are
+     * returned.
+     *
+     * @return The tuned shapes
+     * @throws IOException If the file cannot be read
+     */
+    private Properties readShapes() throws IOException
+    {
+        Properties shapes = new Properties();
+        File file = getDatabaseFile(".shapes.properties");
+        if (file.exists())
+        {
+            InputStream inputStream = new FileInputStream(file);
+            try
+            {
+                shapes.load(inputStream);
+            }
+            finally
+            {
+                inputStream.close();
+            }
+        }
+        return shapes;
+    }
+
+    /**
+     * Store the given result for the given shape, and export the tuning
+     * database for the device into the database directory
+     *
+     * @param shapes The tuned shapes
+     * @param shape The shape key
+     * @param result The result
+     * @throws IOException If the files cannot be written
+     */
+    private void writeDatabase(Properties shapes, String shape,
+        Result result) throws IOException
+    {
+        if (!databaseDirectory.isDirectory() && !databaseDirectory.mkdirs())
+        {
+            throw new IOException(
+                "Could not create directory " + databaseDirectory);
+        }
+        CLBlast.exportTuningDatabase(device, getDatabaseFile(".json"));
+
+        shapes.setProperty(shape + ".kernel", result.getKernel());
+        shapes.setProperty(shape + ".parameters", formatParameters(
+            result.getParameterNames(), result.getParameterValues()));
+        shapes.setProperty(shape + ".minIndirectSize",
+            String.valueOf(result.getMinIndirectSize()));
+        shapes.setProperty(shape + ".gflops",
+            String.valueOf(result.getGflops()));
+        OutputStream outputStream =
+            new FileOutputStream(getDatabaseFile(".shapes.properties"));
+        try
+        {
+            shapes.store(outputStream,
+                "CLBlast GEMM shapes tuned for " + getDeviceName());
+        }
+        finally
+        {
+            outputStream.close();
+        }
+    }
+
+    /**
+     * Returns the file in the database directory for the device model,
+     * with the given extension
+     *
+     * @param extension The extension
+     * @return The file
+     */
+    private File getDatabaseFile(String extension)
+    {
+        String model = getDeviceName().replaceAll("[^A-Za-z0-9._-]", "_");
+        return new File(databaseDirectory, model + extension);
+    }
+
+    /**
+     * Returns the CL_DEVICE_NAME of the device
+     *
+     * @return The device name
+     */
+    private String getDeviceName()
+    {
+        long size[] = new long[1];
+        CLBlastTiledGemm.check(clGetDeviceInfo(
+            device, CL_DEVICE_NAME, 0, null, size), "clGetDeviceInfo");
+        byte buffer[] = new byte[(int)size[0]];
+        CLBlastTiledGemm.check(clGetDeviceInfo(device, CL_DEVICE_NAME,
+            buffer.length, Pointer.to(buffer), null), "clGetDeviceInfo");
+        int length = buffer.length;
+        while (length > 0 && buffer[length - 1] == 0)
+        {
+            length--;
+        }
+        return new String(buffer, 0, length).trim();
+    }
+
+    /**
+     * Returns the value of the given device info, which is a
+     * <code>size_t</code> or <code>cl_ulong</code>
+     *
+     * @param device The device
+     * @param paramName The parameter name
+     * @return The value
+     */
+    private static long getSize(cl_device_id device, int paramName)
+    {
+        long values[] = new long[1];
+        CLBlastTiledGemm.check(clGetDeviceInfo(device, paramName,
+            Sizeof.cl_ulong, Pointer.to(values), null), "clGetDeviceInfo");
+        return values[0];
+    }
+
+    /**
+     * Format the given parameters as a comma-separated list of
+     * <code>name=value</code> entries
+     *
+     * @param names The names
+     * @param values The values
+     * @return The string
+     */
+    static String formatParameters(String names[], long values[])
+    {
+        StringBuilder sb = new StringBuilder();
+        for (int i = 0; i < names.length; i++)
+        {
+            if (i > 0)
+            {
+                sb.append(",");
+            }
+            sb.append(names[i]).append("=").append(values[i]);
+        }
+        return sb.toString();
+    }
+
+    /**
+     * The device buffers for the benchmark of one GEMM shape
+     */
+    private final class GemmBuffers
+    {
+        private final int layout;
+        private final int a_transpose;
+        private final int b_transpose;
+        private final long m;
+        private final long n;
+        private final long k;
+        private final long a_ld;
+        private final long b_ld;
+        private final long c_ld;
+        private final List<cl_mem> buffers = new ArrayList<cl_mem>();
+        private cl_mem a;
+        private cl_mem b;
+        private cl_mem c;
+
+        /**
+         * Creates the buffers for the given shape, and fills them with
+         * a constant value
+         *
+         * @param precision The precision
+         * @param layout The layout
+         * @param a_transpose The transpose mode of A
+         * @param b_transpose The transpose mode of B
+         * @param m The number of rows of C
+         * @param n The number of columns of C
+         * @param k The inner dimension
+         * @param elementSize The element size
+         * @throws CLException If the buffers cannot be created
+         */
+        GemmBuffers(int precision, int layout, int a_transpose,
+            int b_transpose, long m, long n, long k, long elementSize)
+        {
+            this.layout = layout;
+            this.a_transpose = a_transpose;
+            this.b_transpose = b_transpose;
+            this.m = m;
+            this.n = n;
+            this.k = k;
+
+            boolean rowMajor = layout == CLBlastLayout.CLBlastLayoutRowMajor;
+            boolean aTransposed =
+                a_transpose != CLBlastTranspose.CLBlastTransposeNo;
+            boolean bTransposed =
+                b_transpose != CLBlastTranspose.CLBlastTransposeNo;
+            long aRows = aTransposed ? k : m;
+            long aCols = aTransposed ? m : k;
+            long bRows = bTransposed ? n : k;
+            long bCols = bTransposed ? k : n;
+            this.a_ld = rowMajor ? aCols : aRows;
+            this.b_ld = rowMajor ? bCols : bRows;
+            this.c_ld = rowMajor ? n : m;
+            try
+            {
+                this.a = createBuffer(precision, aRows * aCols * elementSize);
+                this.b = createBuffer(precision, bRows * bCols * elementSize);
+                this.c = createBuffer(precision, m * n * elementSize);
+            }
+            catch (CLException e)
+            {
+                release();
+                throw e;
+            }
+        }
+
+        /**
+         * Returns the product m*n*k
+         *
+         * @return The product
+         */
+        double mnk()
+        {
+            return (double)m * n * k;
+        }
+
+        /**
+         * Enqueue the GEMM on the buffers
+         *
+         * @param precision The precision
+         * @param queue The queue
+         * @throws CLException If the CLBlast call fails
+         */
+        void enqueueGemm(int precision, cl_command_queue queue)
+        {
+            CLBlastTiledGemm.enqueueGemm(precision, layout,
+                a_transpose, b_transpose, m, n, k,
+                new double[] { 1.0, 0.0 }, a, a_ld, b, b_ld,
+                new double[] { 0.0, 0.0 }, c, c_ld, queue, null, null);
+        }
+
+        /**
+         * Create a buffer with the given size, fill it with a constant
+         * value, and add it to the list of buffers
+         *
+         * @param precision The precision
+         * @param size The size, in bytes
+         * @return The buffer
+         * @throws CLException If the buffer cannot be created
+         */
+        private cl_mem createBuffer(int precision, long size)
+        {
+            int errorCode[] = new int[1];
+            cl_mem mem = clCreateBuffer(
+                context, CL_MEM_READ_WRITE, size, null, errorCode);
+            CLBlastTiledGemm.check(errorCode[0], "clCreateBuffer");
+            buffers.add(mem);
+
+            Pointer pattern;
+            long patternSize;
+            if (precision == CLBlastPrecision.CLBlastPrecisionSingle ||
+                precision == CLBlastPrecision.CLBlastPrecisionComplexSingle)
+            {
+                pattern = Pointer.to(new float[] { 0.5f });
+                patternSize = Sizeof.cl_float;
+            }
+            else
+            {
+                pattern = Pointer.to(new double[] { 0.5 });
+                patternSize = Sizeof.cl_double;
+            }
+            CLBlastTiledGemm.check(clEnqueueFillBuffer(queue, mem,
+                pattern, patternSize, 0, size, 0, null, null),
+                "clEnqueueFillBuffer");
+            return mem;
+        }
+
+        /**
+         * Release all buffers
+         */
+        void release()
+        {
+            clFinish(queue);
+            for (cl_mem mem : buffers)
+            {
+                clReleaseMemObject(mem);
+            }
+            buffers.clear();
+        }
+    }
+}
@@ -0,0 +1,1115 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_QUEUE_CONTEXT;
+import static org.jocl.CL.CL_SUCCESS;
+import static org.jocl.CL.clBuildProgram;
+import static org.jocl.CL.clCreateKernel;
+import static org.jocl.CL.clCreateProgramWithSource;
+import static org.jocl.CL.clEnqueueMarkerWithWaitList;
+import static org.jocl.CL.clEnqueueNDRangeKernel;
+import static org.jocl.CL.clGetCommandQueueInfo;
+import static org.jocl.CL.clReleaseKernel;
+import static org.jocl.CL.clReleaseProgram;
+import static org.jocl.CL.clSetKernelArg;
+
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import org.jocl.CLException;
+import org.jocl.Pointer;
+import org.jocl.Sizeof;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_event;
+import org.jocl.cl_kernel;
+import org.jocl.cl_mem;
+import org.jocl.cl_program;
+
+/**
+ * A lazily evaluated chain of level-1 operations on vectors with the
+ * same number of elements.
+ * <p>
+ * The operations are only recorded when they are added. When the
+ * expression is evaluated, consecutive element-wise operations (axpy,
+ * scal, copy, swap and had) are combined into a single OpenCL kernel
+ * that is generated for this sequence of operations. This kernel reads
+ * each vector once and writes each modified vector once, instead of
+ * passing over global memory once for each operation. The reductions
+ * (nrm2, dot, asum and sum) are executed with the respective CLBlast
+ * routine, after the preceding element-wise operations.
+ * <p>
+ * Example, computing <code>y = a*x + y; y = b*y; n = nrm2(y)</code>:
+ * <pre><code>
+ * CLBlastVectorExpression expression = new CLBlastVectorExpression(
+ *     queue, CLBlastPrecisionSingle, n);
+ * expression.axpy(a, x, 0, 1, y, 0, 1);
+ * expression.scal(b, y, 0, 1);
+ * expression.nrm2(nrm2_buffer, 0, y, 0, 1);
+ * expression.evaluate(event);
+ * ...
+ * CLBlastVectorExpression.release(context);
+ * </code></pre>
+ * The operations are not combined, but executed with the individual
+ * CLBlast routines, when a group consists of a single operation, when
+ * the same buffer is used with different offsets or increments in one
+ * group, or when the generated kernel can not be built for the device.
+ * Different buffers that refer to overlapping memory, like overlapping
+ * sub-buffers, are not supported for combined operations.
+ * <p>
+ * The queue must be an in-order queue. The generated kernels are cached
+ * for each context, and have to be released with {@link #release}.
+ * Instances of this class are not thread-safe.
+ */
+public final class CLBlastVectorExpression
+{
+    /**
+     * The types of the operations
+     */
+    static final int OPERATION_AXPY = 0;
+    static final int OPERATION_SCAL = 1;
+    static final int OPERATION_COPY = 2;
+    static final int OPERATION_SWAP = 3;
+    static final int OPERATION_HAD = 4;
+    static final int OPERATION_NRM2 = 5;
+    static final int OPERATION_DOT = 6;
+    static final int OPERATION_ASUM = 7;
+    static final int OPERATION_SUM = 8;
+
+    /**
+     * The name of the generated kernels
+     */
+    private static final String KERNEL_NAME = "fusedVectorOperations";
+
+    /**
+     * The kernels that have been generated, for each context, keyed by
+     * the native context handle, and then by the source code. If the
+     * source code could not be built, then the value is <code>null</code>.
+     */
+    private static final Map<Long, Map<String, FusedKernel>> kernels =
+        new HashMap<Long, Map<String, FusedKernel>>();
+
+    /**
+     * A generated kernel, together with its program
+     */
+    private static final class FusedKernel
+    {
+        /**
+         * The program
+         */
+        final cl_program program;
+
+        /**
+         * The kernel
+         */
+        final cl_kernel kernel;
+
+        /**
+         * Creates a new instance
+         *
+         * @param program The program
+         * @param kernel The kernel
+         */
+        FusedKernel(cl_program program, cl_kernel kernel)
+        {
+            this.program = program;
+            this.kernel = kernel;
+        }
+    }
+
+    /**
+     * A recorded operation
+     */
+    static final class Operation
+    {
+        /**
+         * The type of the operation
+         */
+        final int type;
+
+        /**
+         * The scalar arguments
+         */
+        final double alpha;
+        final double beta;
+
+        /**
+         * The vector arguments, in the order of the CLBlast routine
+         */
+        final cl_mem buffers[];
+        final long offsets[];
+        final long incs[];
+
+        /**
+         * The buffer and offset for the result of a reduction
+         */
+        final cl_mem resultBuffer;
+        final long resultOffset;
+
+        /**
+         * The indices of the vectors of a combined operation, for each
+         * of the vector arguments
+         */
+        int views[];
+
+        /**
+         * Creates a new operation
+         *
+         * @param type The type
+         * @param alpha The first scalar
+         * @param beta The second scalar
+         * @param resultBuffer The result buffer of a reduction
+         * @param resultOffset The result offset of a reduction
+         * @param vectors The buffer, offset and increment of each vector
+         */
+        Operation(int type, double alpha, double beta,
+            cl_mem resultBuffer, long resultOffset, Object ... vectors)
+        {
+            this.type = type;
+            this.alpha = alpha;
+            this.beta = beta;
+            this.resultBuffer = resultBuffer;
+            this.resultOffset = resultOffset;
+            int count = vectors.length / 3;
+            this.buffers = new cl_mem[count];
+            this.offsets = new long[count];
+            this.incs = new long[count];
+            for (int i = 0; i < count; i++)
+            {
+                buffers[i] = (cl_mem)vectors[i * 3 + 0];
+                offsets[i] = (Long)vectors[i * 3 + 1];
+                incs[i] = (Long)vectors[i * 3 + 2];
+            }
+        }
+
+        /**
+         * Returns whether this operation can be combined with others
+         *
+         * @return Whether this is an element-wise operation
+         */
+        boolean isElementwise()
+        {
+            return type <= OPERATION_HAD;
+        }
+    }
+
+    /**
+     * The command queue
+     */
+    private final cl_command_queue queue;
+
+    /**
+     * The {@link CLBlastPrecision}
+     */
+    private final int precision;
+
+    /**
+     * The number of elements of the vectors
+     */
+    private final long n;
+
+    /**
+     * The operations that have not been evaluated yet
+     */
+    private final List<Operation> operations;
+
+    /**
+     * Creates a new, empty expression
+     *
+     * @param queue The command queue
+     * @param precision The {@link CLBlastPrecision}. Only half, single
+     * and double precision are supported.
+     * @param n The number of elements of the vectors
+     * @throws IllegalArgumentException If the precision is not supported
+     */
+    public CLBlastVectorExpression(
+        cl_command_queue queue, int precision, long n)
+    {
+        if (precision != CLBlastPrecision.CLBlastPrecisionHalf &&
+            precision != CLBlastPrecision.CLBlastPrecisionSingle &&
+            precision != CLBlastPrecision.CLBlastPrecisionDouble)
+        {
+            throw new IllegalArgumentException(
+                "Only half, single and double precision are supported, " +
+                "but the precision is " + precision);
+        }
+        this.queue = queue;
+        this.precision = precision;
+        this.n = n;
+        this.operations = new ArrayList<Operation>();
+    }
+
+    /**
+     * Adds the operation <code>y = alpha * x + y</code>
+     *
+     * @param alpha The scalar alpha
+     * @param x_buffer The buffer of x
+     * @param x_offset The offset of x
+     * @param x_inc The increment of x
+     * @param y_buffer The buffer of y
+     * @param y_offset The offset of y
+     * @param y_inc The increment of y
+     * @return This expression
+     */
+    public CLBlastVectorExpression axpy(double alpha,
+        cl_mem x_buffer, long x_offset, long x_inc,
+        cl_mem y_buffer, long y_offset, long y_inc)
+    {
+        return add(new Operation(OPERATION_AXPY, alpha, 0.0, null, 0,
+            x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc));
+    }
+
+    /**
+     * Adds the operation <code>x = alpha * x</code>
+     *
+     * @param alpha The scalar alpha
+     * @param x_buffer The buffer of x
+     * @param x_offset The offset of x
+     * @param x_inc The increment of x
+     * @return This expression
+     */
+    public CLBlastVectorExpression scal(double alpha,
+        cl_mem x_buffer, long x_offset, long x_inc)
+    {
+        return add(new Operation(OPERATION_SCAL, alpha, 0.0, null, 0,
+            x_buffer, x_offset, x_inc));
+    }
+
+    /**
+     * Adds the operation <code>y = x</code>
+     *
+     * @param x_buffer The buffer of x
+     * @param x_offset The offset of x
+     * @param x_inc The increment of x
+     * @param y_buffer The buffer of y
+     * @param y_offset The offset of y
+     * @param y_inc The increment of y
+     * @return This expression
+     */
+    public CLBlastVectorExpression copy(
+        cl_mem x_buffer, long x_offset, long x_inc,
+        cl_mem y_buffer, long y_offset, long y_inc)
+    {
+        return add(new Operation(OPERATION_COPY, 0.0, 0.0, null, 0,
+            x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc));
+    }
+
+    /**
+     * Adds the operation that swaps the elements of x and y
+     *
+     * @param x_buffer The buffer of x
+     * @param x_offset The offset of x
+     * @param x_inc The increment of x
+     * @param y_buffer The buffer of y
+     * @param y_offset The offset of y
+     * @param y_inc The increment of y
+     * @return This expression
+     */
+    public CLBlastVectorExpression swap(
+        cl_mem x_buffer, long x_offset, long x_inc,
+        cl_mem y_buffer, long y_offset, long y_inc)
+    {
+        return add(new Operation(OPERATION_SWAP, 0.0, 0.0, null, 0,
+            x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc));
+    }
+
+    /**
+     * Adds the element-wise vector product (Hadamard)
+     * <code>z = alpha * x * y + beta * z</code>
+     *
+     * @param alpha The scalar alpha
+     * @param x_buffer The buffer of x
+     * @param x_offset The offset of x
+     * @param x_inc The increment of x
+     * @param y_buffer The buffer of y
+     * @param y_offset The offset of y
+     * @param y_inc The increment of y
+     * @param beta The scalar beta
+     * @param z_buffer The buffer of z
+     * @param z_offset The offset of z
+     * @param z_inc The increment of z
+     * @return This expression
+     */
+    public CLBlastVectorExpression had(double alpha,
+        cl_mem x_buffer, long x_offset, long x_inc,
+        cl_mem y_buffer, long y_offset, long y_inc,
+        double beta,
+        cl_mem z_buffer, long z_offset, long z_inc)
+    {
+        return add(new Operation(OPERATION_HAD, alpha, beta, null, 0,
+            x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc,
+            z_buffer, z_offset, z_inc));
+    }
+
+    /**
+     * Adds the computation of the euclidean norm of x, which is written
+     * into the given result buffer
+     *
+     * @param nrm2_buffer The result buffer
+     * @param nrm2_offset The result offset
+     * @param x_buffer The buffer of x
+     * @param x_offset The offset of x
+     * @param x_inc The increment of x
+     * @return This expression
+     */
+    public CLBlastVectorExpression nrm2(
+        cl_mem nrm2_buffer, long nrm2_offset,
+        cl_mem x_buffer, long x_offset, long x_inc)
+    {
+        return add(new Operation(OPERATION_NRM2, 0.0, 0.0,
+            nrm2_buffer, nrm2_offset, x_buffer, x_offset, x_inc));
+    }
+
+    /**
+     * Adds the computation of the dot product of x and y, which is
+     * written into the given result buffer
+     *
+     * @param dot_buffer The result buffer
+     * @param dot_offset The result offset
+     * @param x_buffer The buffer of x
+     * @param x_offset The offset of x
+     * @param x_inc The increment of x
+     * @param y_buffer The buffer of y
+     * @param y_offset The offset of y
+     * @param y_inc The increment of y
+     * @return This expression
+     */
+    public CLBlastVectorExpression dot(
+        cl_mem dot_buffer, long dot_offset,
+        cl_mem x_buffer, long x_offset, long x_inc,
+        cl_mem y_buffer, long y_offset, long y_inc)
+    {
+        return add(new Operation(OPERATION_DOT, 0.0, 0.0,
+            dot_buffer, dot_offset, x_buffer, x_offset, x_inc,
+            y_buffer, y_offset, y_inc));
+    }
+
+    /**
+     * Adds the computation of the sum of the absolute values of x, which
+     * is written into the given result buffer
+     *
+     * @param asum_buffer The result buffer
+     * @param asum_offset The result offset
+     * @param x_buffer The buffer of x
+     * @param x_offset The offset of x
+     * @param x_inc The increment of x
+     * @return This expression
+     */
+    public CLBlastVectorExpression asum(
+        cl_mem asum_buffer, long asum_offset,
+        cl_mem x_buffer, long x_offset, long x_inc)
+    {
+        return add(new Operation(OPERATION_ASUM, 0.0, 0.0,
+            asum_buffer, asum_offset, x_buffer, x_offset, x_inc));
+    }
+
+    /**
+     * Adds the computation of the sum of the values of x, which is
+     * written into the given result buffer
+     *
+     * @param sum_buffer The result buffer
+     * @param sum_offset The result offset
+     * @param x_buffer The buffer of x
+     * @param x_offset The offset of x
+     * @param x_inc The increment of x
+     * @return This expression
+     */
+    public CLBlastVectorExpression sum(
+        cl_mem sum_buffer, long sum_offset,
+        cl_mem x_buffer, long x_offset, long x_inc)
+    {
+        return add(new Operation(OPERATION_SUM, 0.0, 0.0,
+            sum_buffer, sum_offset, x_buffer, x_offset, x_inc));
+    }
+
+    /**
+     * Add the given operation
+     *
+     * @param operation The operation
+     * @return This expression
+     */
+    private CLBlastVectorExpression add(Operation operation)
+    {
+        operations.add(operation);
+        return this;
+    }
+
+    /**
+     * Returns the number of operations that have not been evaluated yet
+     *
+     * @return The number of pending operations
+     */
+    public int getPendingOperationCount()
+    {
+        return operations.size();
+    }
+
+    /**
+     * Enqueue all pending operations into the queue. Afterwards, the
+     * expression is empty, and can be used for further operations.
+     *
+     * @param event The event for the last enqueued command. May be
+     * <code>null</code>.
+     * @return The CLBlast status code. If this is not
+     * {@link CLBlastStatusCode#CLBlastSuccess}, then the operations
+     * after the failing one have not been enqueued.
+     */
+    public int evaluate(cl_event event)
+    {
+        List<int[]> groups = createGroups();
+        int status = CLBlastStatusCode.CLBlastSuccess;
+        for (int g = 0; g < groups.size(); g++)
+        {
+            int group[] = groups.get(g);
+            cl_event groupEvent = (g == groups.size() - 1) ? event : null;
+            status = executeGroup(group[0], group[1], groupEvent);
+            if (status != CLBlastStatusCode.CLBlastSuccess)
+            {
+                break;
+            }
+        }
+        if (groups.isEmpty() && event != null)
+        {
+            status = CLBlast.checkResult(
+                clEnqueueMarkerWithWaitList(queue, 0, null, event));
+        }
+        operations.clear();
+        return status;
+    }
+
+    /**
+     * Divide the pending operations into groups, which are given as the
+     * start index (inclusive) and end index (exclusive). Consecutive
+     * element-wise operations are combined into one group, as long as
+     * they each buffer with the same offset and increment. The vector
+     * indices of the operations of each group are assigned here.
+     *
+     * @return The groups
+     */
+    private List<int[]> createGroups()
+    {
+        List<int[]> groups = new ArrayList<int[]>();
+        List<long[]> views = new ArrayList<long[]>();
+        int start = 0;
+        for (int i = 0; i < operations.size(); i++)
+        {
+            Operation operation = operations.get(i);
+            if (!operation.isElementwise())
+            {
+                if (start < i)
+                {
+                    groups.add(new int[] { start, i });
+                }
+                groups.add(new int[] { i, i + 1 });
+                start = i + 1;
+                views.clear();
+                continue;
+            }
+            int operationViews[] = assignViews(operation, views);
+            if (operationViews == null)
+            {
+                groups.add(new int[] { start, i });
+                start = i;
+                views.clear();
+                operationViews = assignViews(operation, views);
+            }
+            operation.views = operationViews;
+        }
+        if (start < operations.size())
+        {
+            groups.add(new int[] { start, operations.size() });
+        }
+        return groups;
+    }
+
+    /**
+     * Returns the indices of the vectors of the given operation in the
+     * given list of vectors, which contains the native buffer handle,
+     * offset and increment of each vector. New vectors are added to the
+     * list. If a buffer of the operation is already contained in the
+     * list with a different offset or increment, then <code>null</code>
+     * is returned, and the list is not modified.
+     *
+     * @param operation The operation
+     * @param views The vectors
+     * @return The vector indices
+     */
+    private static int[] assignViews(Operation operation, List<long[]> views)
+    {
+        int count = operation.buffers.length;
+        long keys[][] = new long[count][];
+        for (int i = 0; i < count; i++)
+        {
+            long handle = CLBlastFast.getHandle(operation.buffers[i]);
+            keys[i] = new long[] {
+                handle, operation.offsets[i], operation.incs[i] };
+            for (long view[] : views)
+            {
+                if (view[0] == handle &&
+                    (view[1] != keys[i][1] || view[2] != keys[i][2]))
+                {
+                    return null;
+                }
+            }
+            for (int j = 0; j < i; j++)
+            {
+                if (keys[j][0] == handle &&
+                    (keys[j][1] != keys[i][1] || keys[j][2] != keys[i][2]))
+                {
+                    return null;
+                }
+            }
+        }
+        int result[] = new int[count];
+        for (int i = 0; i < count; i++)
+        {
+            result[i] = -1;
+            for (int v = 0; v < views.size(); v++)
+            {
+                long view[] = views.get(v);
+                if (view[0] == keys[i][0] &&
+                    view[1] == keys[i][1] && view[2] == keys[i][2])
+                {
+                    result[i] = v;
+                    break;
+                }
+            }
+            if (result[i] == -1)
+            {
+                result[i] = views.size();
+                views.add(keys[i]);
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Execute the operations with the given indices, either with a
+     * generated kernel, or with the individual CLBlast routines
+     *
+     * @param start The start index, inclusive
+     * @param end The end index, exclusive
+     * @param event The event for the last command. May be <code>null</code>.
+     * @return The CLBlast status code
+     */
+    private int executeGroup(int start, int end, cl_event event)
+    {
+        if (end - start > 1 && n > 0)
+        {
+            List<Operation> group = operations.subList(start, end);
+            FusedKernel fusedKernel = obtainKernel(group);
+            if (fusedKernel != null)
+            {
+                return executeFused(fusedKernel, group, event);
+            }
+        }
+        for (int i = start; i < end; i++)
+        {
+            cl_event operationEvent = (i == end - 1) ? event : null;
+            int status = executeSingle(operations.get(i), operationEvent);
+            if (status != CLBlastStatusCode.CLBlastSuccess)
+            {
+                return status;
+            }
+        }
+        return CLBlastStatusCode.CLBlastSuccess;
+    }
+
+    /**
+     * Returns the kernel for the given operations, building it if
+     * necessary. If the kernel can not be built, then <code>null</code>
+     * is returned.
+     *
+     * @param group The operations
+     * @return The kernel
+     */
+    private FusedKernel obtainKernel(List<Operation> group)
+    {
+        int viewCount = 0;
+        for (Operation operation : group)
+        {
+            for (int view : operation.views)
+            {
+                viewCount = Math.max(viewCount, view + 1);
+            }
+        }
+        String source = createSource(precision, group, viewCount);
+        cl_context context = getContext(queue);
+        Long contextKey = CLBlastFast.getHandle(context);
+        synchronized (kernels)
+        {
+            Map<String, FusedKernel> contextKernels = kernels.get(contextKey);
+            if (contextKernels == null)
+            {
+                contextKernels = new HashMap<String, FusedKernel>();
+                kernels.put(contextKey, contextKernels);
+            }
+            if (contextKernels.containsKey(source))
+            {
+                return contextKernels.get(source);
+            }
+            FusedKernel fusedKernel = buildKernel(context, source);
+            contextKernels.put(source, fusedKernel);
+            return fusedKernel;
+        }
+    }
+
+    /**
+     * Build the kernel from the given source code. If this fails, then
+     * <code>null</code> is returned.
+     *
+     * @param context The context
+     * @param source The source code
+     * @return The kernel
+     */
+    private static FusedKernel buildKernel(cl_context context, String source)
+    {
+        cl_program program = null;
+        try
+        {
+            int errorCode[] = new int[1];
+            program = clCreateProgramWithSource(
+                context, 1, new String[] { source }, null, errorCode);
+            if (errorCode[0] != CL_SUCCESS)
+            {
+                return null;
+            }
+            if (clBuildProgram(program, 0, null, null, null, null) != CL_SUCCESS)
+            {
+                clReleaseProgram(program);
+                return null;
+            }
+            cl_kernel kernel = clCreateKernel(program, KERNEL_NAME, errorCode);
+            if (errorCode[0] != CL_SUCCESS)
+            {
+                clReleaseProgram(program);
+                return null;
+            }
+            return new FusedKernel(program, kernel);
+        }
+        catch (CLException e)
+        {
+            if (program != null)
+            {
+                clReleaseProgram(program);
+            }
+            return null;
+        }
+    }
+
+    /**
+     * Enqueue the given kernel for the given operations
+     *
+     * @param fusedKernel The kernel
+     * @param group The operations
+     * @param event The event. May be <code>null</code>.
+     * @return The CLBlast status code
+     */
+    private int executeFused(
+        FusedKernel fusedKernel, List<Operation> group, cl_event event)
+    {
+        List<cl_mem> buffers = new ArrayList<cl_mem>();
+        List<long[]> views = new ArrayList<long[]>();
+        for (Operation operation : group)
+        {
+            for (int i = 0; i < operation.views.length; i++)
+            {
+                if (operation.views[i] == buffers.size())
+                {
+                    buffers.add(operation.buffers[i]);
+                    views.add(new long[] {
+                        operation.offsets[i], operation.incs[i] });
+                }
+            }
+        }
+        cl_kernel kernel = fusedKernel.kernel;
+        synchronized (fusedKernel)
+        {
+            int a = 0;
+            clSetKernelArg(kernel, a++, Sizeof.cl_long,
+                Pointer.to(new long[] { n }));
+            for (int v = 0; v < buffers.size(); v++)
+            {
+                clSetKernelArg(kernel, a++, Sizeof.cl_mem,
+                    Pointer.to(buffers.get(v)));
+                clSetKernelArg(kernel, a++, Sizeof.cl_long,
+                    Pointer.to(new long[] { views.get(v)[0] }));
+                clSetKernelArg(kernel, a++, Sizeof.cl_long,
+                    Pointer.to(new long[] { views.get(v)[1] }));
+            }
+            for (Operation operation : group)
+            {
+                int scalars = scalarCount(operation.type);
+                for (int s = 0; s < scalars; s++)
+                {
+                    double value = (s == 0) ? operation.alpha : operation.beta;
+                    if (precision == CLBlastPrecision.CLBlastPrecisionDouble)
+                    {
+                        clSetKernelArg(kernel, a++, Sizeof.cl_double,
+                            Pointer.to(new double[] { value }));
+                    }
+                    else
+                    {
+                        clSetKernelArg(kernel, a++, Sizeof.cl_float,
+                            Pointer.to(new float[] { (float)value }));
+                    }
+                }
+            }
+            return CLBlast.checkResult(clEnqueueNDRangeKernel(queue, kernel,
+                1, null, new long[] { n }, null, 0, null, event));
+        }
+    }
+
+    /**
+     * Returns the number of scalar arguments of an operation of the
+     * given type
+     *
+     * @param type The type
+     * @return The number of scalars
+     */
+    private static int scalarCount(int type)
+    {
+        switch (type)
+        {
+            case OPERATION_AXPY:
+            case OPERATION_SCAL:
+                return 1;
+            case OPERATION_HAD:
+                return 2;
+            default:
+                return 0;
+        }
+    }
+
+    /**
+     * Create the source code of the kernel for the given element-wise
+     * operations, whose vector indices have been assigned. The kernel
+     * receives the number of elements, then the buffer, offset and
+     * increment of each vector, and then the scalar arguments of the
+     * operations.
+     *
+     * @param precision The {@link CLBlastPrecision}
+     * @param group The operations
+     * @param viewCount The number of vectors
+     * @return The source code
+     */
+    static String createSource(
+        int precision, List<Operation> group, int viewCount)
+    {
+        boolean half = precision == CLBlastPrecision.CLBlastPrecisionHalf;
+        String storageType = half ? "half" :
+            (precision == CLBlastPrecision.CLBlastPrecisionDouble ?
+                "double" : "float");
+        String type = half ? "float" : storageType;
+
+        StringBuilder sb = new StringBuilder();
+        if (precision == CLBlastPrecision.CLBlastPrecisionDouble)
+        {
+            sb.append("#pragma OPENCL EXTENSION cl_khr_fp64 : enable\n");
+        }
+        sb.append("__kernel void " + KERNEL_NAME + "(const long n");
+        for (int v = 0; v < viewCount; v++)
+        {
+            sb.append(",\n    __global " + storageType + " *v" + v +
+                ", const long o" + v + ", const long s" + v);
+        }
+        int scalarIndex = 0;
+        for (Operation operation : group)
+        {
+            for (int s = 0; s < scalarCount(operation.type); s++)
+            {
+                sb.append(",\n    const " + type + " a" + scalarIndex);
+                scalarIndex++;
+            }
+        }
+        sb.append(")\n{\n");
+        sb.append("    const long i = get_global_id(0);\n");
+        sb.append("    if (i >= n) return;\n");
+        for (int v = 0; v < viewCount; v++)
+        {
+            sb.append("    " + type + " r" + v + ";\n");
+        }
+
+        // The vectors that have already been loaded or written
+        boolean available[] = new boolean[viewCount];
+        boolean written[] = new boolean[viewCount];
+        scalarIndex = 0;
+        for (Operation operation : group)
+        {
+            int w[] = operation.views;
+            switch (operation.type)
+            {
+                case OPERATION_AXPY:
+                    load(sb, half, available, w[0], w[1]);
+                    sb.append("    r" + w[1] + " = a" + scalarIndex +
+                        " * r" + w[0] + " + r" + w[1] + ";\n");
+                    written[w[1]] = true;
+                    break;
+                case OPERATION_SCAL:
+                    load(sb, half, available, w[0]);
+                    sb.append("    r" + w[0] + " = a" + scalarIndex +
+                        " * r" + w[0] + ";\n");
+                    written[w[0]] = true;
+                    break;
+                case OPERATION_COPY:
+                    load(sb, half, available, w[0]);
+                    sb.append("    r" + w[1] + " = r" + w[0] + ";\n");
+                    available[w[1]] = true;
+                    written[w[1]] = true;
+                    break;
+                case OPERATION_SWAP:
+                    load(sb, half, available, w[0], w[1]);
+                    sb.append("    { " + type + " t = r" + w[0] + "; r" +
+                        w[0] + " = r" + w[1] + "; r" + w[1] + " = t; }\n");
+                    written[w[0]] = true;
+                    written[w[1]] = true;
+                    break;
+                case OPERATION_HAD:
+                    load(sb, half, available, w[0], w[1], w[2]);
+                    sb.append("    r" + w[2] + " = a" + scalarIndex +
+                        " * r" + w[0] + " * r" + w[1] + " + a" +
+                        (scalarIndex + 1) + " * r" + w[2] + ";\n");
+                    written[w[2]] = true;
+                    break;
+                default:
+                    throw new IllegalArgumentException(
+                        "Not an element-wise operation: " + operation.type);
+            }
+            scalarIndex += scalarCount(operation.type);
+        }
+        for (int v = 0; v < viewCount; v++)
+        {
+            if (written[v])
+            {
+                String index = "o" + v + " + i * s" + v;
+                if (half)
+                {
+                    sb.append("    vstore_half(r" + v + ", " + index +
+                        ", v" + v + ");\n");
+                }
+                else
+                {
+                    sb.append("    v" + v + "[" + index + "] = r" + v + ";\n");
+                }
+            }
+        }
+        sb.append("}\n");
+        return sb.toString();
+    }
+
+    /**
+     * Append the statements that load the given vectors into their
+     * registers, if they have not been loaded or written yet
+     *
+     * @param sb The string builder
+     * @param half Whether the vectors contain half-precision values
+     * @param available Which vectors have been loaded or written
+     * @param views The vector indices
+     */
+    private static void load(StringBuilder sb, boolean half,
+        boolean available[], int ... views)
+    {
+        for (int v : views)
+        {
+            if (!available[v])
+            {
+                String index = "o" + v + " + i * s" + v;
+                if (half)
+                {
+                    sb.append("    r" + v + " = vload_half(" + index +
+                        ", v" + v + ");\n");
+                }
+                else
+                {
+                    sb.append("    r" + v + " = v" + v + "[" + index + "];\n");
+                }
+                available[v] = true;
+            }
+        }
+    }
+
+    /**
+     * Execute the given operation with the CLBlast routine
+     *
+     * @param operation The operation
+     * @param event The event. May be <code>null</code>.
+     * @return The CLBlast status code
+     */
+    private int executeSingle(Operation operation, cl_event event)
+    {
+        cl_mem b[] = operation.buffers;
+        long o[] = operation.offsets;
+        long i[] = operation.incs;
+        cl_mem r = operation.resultBuffer;
+        long ro = operation.resultOffset;
+        float fa = (float)operation.alpha;
+        float fb = (float)operation.beta;
+        double da = operation.alpha;
+        double db = operation.beta;
+        if (precision == CLBlastPrecision.CLBlastPrecisionHalf)
+        {
+            switch (operation.type)
+            {
+                case OPERATION_AXPY:
+                    return CLBlast.CLBlastHaxpy(n, fa,
+                        b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+                case OPERATION_SCAL:
+                    return CLBlast.CLBlastHscal(n, fa,
+                        b[0], o[0], i[0], queue, event);
+                case OPERATION_COPY:
+                    return CLBlast.CLBlastHcopy(n,
+                        b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+                case OPERATION_SWAP:
+                    return CLBlast.CLBlastHswap(n,
+                        b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+                case OPERATION_HAD:
+                    return CLBlast.CLBlastHhad(n, fa, b[0], o[0], i[0],
+                        b[1], o[1], i[1], fb, b[2], o[2], i[2], queue, event);
+                case OPERATION_NRM2:
+                    return CLBlast.CLBlastHnrm2(n, r, ro,
+                        b[0], o[0], i[0], queue, event);
+                case OPERATION_DOT:
+                    return CLBlast.CLBlastHdot(n, r, ro,
+                        b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+                case OPERATION_ASUM:
+                    return CLBlast.CLBlastHasum(n, r, ro,
+                        b[0], o[0], i[0], queue, event);
+                default:
+                    return CLBlast.CLBlastHsum(n, r, ro,
+                        b[0], o[0], i[0], queue, event);
+            }
+        }
+        if (precision == CLBlastPrecision.CLBlastPrecisionSingle)
+        {
+            switch (operation.type)
+            {
+                case OPERATION_AXPY:
+                    return CLBlast.CLBlastSaxpy(n, fa,
+                        b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+                case OPERATION_SCAL:
+                    return CLBlast.CLBlastSscal(n, fa,
+                        b[0], o[0], i[0], queue, event);
+                case OPERATION_COPY:
+                    return CLBlast.CLBlastScopy(n,
+                        b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+                case OPERATION_SWAP:
+                    return CLBlast.CLBlastSswap(n,
+                        b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+                case OPERATION_HAD:
+                    return CLBlast.CLBlastShad(n, fa, b[0], o[0], i[0],
+                        b[1], o[1], i[1], fb, b[2], o[2], i[2], queue, event);
+                case OPERATION_NRM2:
+                    return CLBlast.CLBlastSnrm2(n, r, ro,
+                        b[0], o[0], i[0], queue, event);
+                case OPERATION_DOT:
+                    return CLBlast.CLBlastSdot(n, r, ro,
+                        b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+                case OPERATION_ASUM:
+                    return CLBlast.CLBlastSasum(n, r, ro,
+                        b[0], o[0], i[0], queue, event);
+                default:
+                    return CLBlast.CLBlastSsum(n, r, ro,
+                        b[0], o[0], i[0], queue, event);
+            }
+        }
+        switch (operation.type)
+        {
+            case OPERATION_AXPY:
+                return CLBlast.CLBlastDaxpy(n, da,
+                    b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+            case OPERATION_SCAL:
+                return CLBlast.CLBlastDscal(n, da,
+                    b[0], o[0], i[0], queue, event);
+            case OPERATION_COPY:
+                return CLBlast.CLBlastDcopy(n,
+                    b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+            case OPERATION_SWAP:
+                return CLBlast.CLBlastDswap(n,
+                    b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+            case OPERATION_HAD:
+                return CLBlast.CLBlastDhad(n, da, b[0], o[0], i[0],
+                    b[1], o[1], i[1], db, b[2], o[2], i[2], queue, event);
+            case OPERATION_NRM2:
+                return CLBlast.CLBlastDnrm2(n, r, ro,
+                    b[0], o[0], i[0], queue, event);
+            case OPERATION_DOT:
+                return CLBlast.CLBlastDdot(n, r, ro,
+                    b[0], o[0], i[0], b[1], o[1], i[1], queue, event);
+            case OPERATION_ASUM:
+                return CLBlast.CLBlastDasum(n, r, ro,
+                    b[0], o[0], i[0], queue, event);
+            default:
+                return CLBlast.CLBlastDsum(n, r, ro,
+                    b[0], o[0], i[0], queue, event);
+        }
+    }
+
+    /**
+     * Release all kernels that have been generated for the given
+     * context. This must be called before the context is released.
+     *
+     * @param context The context
+     */
+    public static void release(cl_context context)
+    {
+        Map<String, FusedKernel> contextKernels = null;
+        synchronized (kernels)
+        {
+            contextKernels = kernels.remove(CLBlastFast.getHandle(context));
+        }
+        if (contextKernels == null)
+        {
+            return;
+        }
+        for (FusedKernel fusedKernel : contextKernels.values())
+        {
+            if (fusedKernel != null)
+            {
+                clReleaseKernel(fusedKernel.kernel);
+                clReleaseProgram(fusedKernel.program);
+            }
+        }
+    }
+
+    /**
+     * Returns the context of the given queue
+     *
+     * @param queue The queue
+     * @return The context
+     */
+    private static cl_context getContext(cl_command_queue queue)
+    {
+        cl_context context = new cl_context();
+        CLBlastTiledGemm.check(clGetCommandQueueInfo(queue, CL_QUEUE_CONTEXT,
+            Sizeof.cl_context, Pointer.to(context), null),
+            "clGetCommandQueueInfo");
+        return context;
+    }
+}
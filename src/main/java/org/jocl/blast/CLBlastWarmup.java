@@ -0,0 +1,382 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import java.util.concurrent.CancellationException;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.Future;
+import java.util.concurrent.TimeUnit;
+import java.util.concurrent.TimeoutException;
+
+import org.jocl.cl_context;
+import org.jocl.cl_device_id;
+
+/**
+ * An asynchronous warmup of the CLBlast kernel cache, for a selected set
+ * of routines and precisions.
+ * <p>
+ * In contrast to {@link CLBlast#CLBlastFillCache(cl_device_id)}, which
+ * compiles all kernels for all precisions, this only compiles the kernels
+ * of the given routines, for the given precisions. This is done on a
+ * native background thread, by executing each routine once on a tiny 
+ * problem, using a dedicated command queue and scratch buffers. 
+ * For example:
+ * <pre><code>
+ * CLBlastWarmup warmup = CLBlastWarmup.start(context, device,
+ *     new String[] { "gemm", "gemmBatched", "axpy" },
+ *     new int[] { CLBlastPrecisionSingle, CLBlastPrecisionHalf });
+ * ...
+ * int status = warmup.get();
+ * </code></pre>
+ * The routine names are the names of the CLBlast routines without the
+ * precision prefix: <code>swap, scal, copy, axpy, dot, nrm2, asum, amax,
+ * gemv, ger, gemm, symm, syrk, trsm, had, omatcopy, axpyBatched, 
+ * gemmBatched</code> and <code>gemmStridedBatched</code>. For the complex
+ * precisions, <code>dot</code> and <code>ger</code> refer to 
+ * <code>dotu</code> and <code>geru</code>.
+ * <p>
+ * The result of the future is <code>CLBlastSuccess</code>, or the first
+ * status code that was not <code>CLBlastSuccess</code>. A failing routine
+ * does not stop the warmup of the remaining routines.
+ * <p>
+ * The native resources of the warmup are released with {@link #release()}.
+ * Releasing a warmup that is not done yet cancels it, and returns when 
+ * the routine that is currently compiled is finished. Waiting for the 
+ * result blocks in native code, for at most 100 milliseconds at a 
+ * time. Between these slices, the waiting thread checks whether it was
+ * interrupted with {@link Thread#interrupt()}, or whether the warmup 
+ * was cancelled.
+ */
+public final class CLBlastWarmup implements Future<Integer>
+{
+    // Initialization of the native library
+    static
+    {
+        CLBlast.initialize();
+    }
+    
+    /**
+     * The maximum time, in milliseconds, that a thread waits in native 
+     * code before checking whether it was interrupted
+     */
+    private static final long WAIT_SLICE_MS = 100;
+    
+    /**
+     * The handle of the native warmup task. This is 0 after the warmup
+     * was released.
+     */
+    private long handle;
+    
+    /**
+     * The number of threads that are currently waiting in native code 
+     * for the warmup to be done
+     */
+    private int waiters;
+    
+    /**
+     * The result, once the warmup is done
+     */
+    private Integer result;
+    
+    /**
+     * Whether {@link #cancel(boolean)} was called before the warmup was done
+     */
+    private boolean cancelled;
+    
+    /**
+     * Start the warmup of the given routines for the given precisions, on
+     * the given device, in a background thread.
+     * 
+     * @param context The context
+     * @param device The device
+     * @param routines The routine names, e.g. <code>"gemm"</code>
+     * @param precisions The precisions, as {@link CLBlastPrecision} values
+     * @return The future for the warmup
+     * @throws NullPointerException If any argument is <code>null</code>
+     * @throws IllegalArgumentException If any routine is not known, or a
+     * routine does not support one of the precisions
+     */
+    public static CLBlastWarmup start(cl_context context, 
+        cl_device_id device, String routines[], int precisions[])
+    {
+        return new CLBlastWarmup(
+            startNative(context, device, routines, precisions));
+    }
+    private static native long startNative(cl_context context, 
+        cl_device_id device, String routines[], int precisions[]);
+    
+    /**
+     * Private constructor
+     * 
+     * @param handle The native handle
+     */
+    private CLBlastWarmup(long handle)
+    {
+        this.handle = handle;
+    }
+    
+    /**
+     * Returns the handle of the native warmup task
+     * 
+     * @return The handle
+     * @throws IllegalStateException If the warmup was released
+     */
+    private synchronized long getHandle()
+    {
+        if (handle == 0)
+        {
+            throw new IllegalStateException("The warmup was released");
+        }
+        return handle;
+    }
+    
+    /**
+     * Returns the total number of (routine, precision) combinations that
+     * are warmed up
+     * 
+     * @return The total number
+     * @throws IllegalStateException If the warmup was released
+     */
+    public int getTotal()
+    {
+        return getTotalNative(getHandle());
+    }
+    private static native int getTotalNative(long handle);
+    
+    /**
+     * Returns the number of (routine, precision) combinations that have
+     * already been warmed up
+     * 
+     * @return The number of completed combinations
+     * @throws IllegalStateException If the warmup was released
+     */
+    public int getCompleted()
+    {
+        return getCompletedNative(getHandle());
+    }
+    private static native int getCompletedNative(long handle);
+    
+    /**
+     * Request the cancellation of the warmup. The warmup will stop after
+     * the routine that is currently compiled. The argument is ignored.
+     */
+    @Override
+    public synchronized boolean cancel(boolean mayInterruptIfRunning)
+    {
+        if (isDone())
+        {
+            return false;
+        }
+        cancelNative(handle);
+        cancelled = true;
+        return true;
+    }
+    private static native void cancelNative(long handle);
+
+    @Override
+    public synchronized boolean isCancelled()
+    {
+        return cancelled;
+    }
+
+    @Override
+    public synchronized boolean isDone()
+    {
+        return cancelled || result != null || (handle != 0 && poll(0));
+    }
+
+    @Override
+    public Integer get() throws InterruptedException, ExecutionException
+    {
+        await(-1);
+        return result;
+    }
+
+    @Override
+    public Integer get(long timeout, TimeUnit unit)
+        throws InterruptedException, ExecutionException, TimeoutException
+    {
+        if (!await(Math.max(0, unit.toMillis(timeout))))
+        {
+            throw new TimeoutException(
+                "Warmup not finished after " + timeout + " " + unit);
+        }
+        return result;
+    }
+    
+    /**
+     * Wait for the given time until the warmup is done. 
+     * 
+     * @param timeoutMs The timeout, in milliseconds. If this is negative,
+     * then this waits until the warmup is done.
+     * @return Whether the warmup is done
+     * @throws InterruptedException If the current thread was interrupted
+     * @throws CancellationException If the warmup was cancelled
+     * @throws IllegalStateException If the warmup was released
+     */
+    private boolean await(long timeoutMs) throws InterruptedException
+    {
+        long start = System.nanoTime();
+        long timeoutNs = TimeUnit.MILLISECONDS.toNanos(timeoutMs);
+        while (true)
+        {
+            if (Thread.interrupted())
+            {
+                throw new InterruptedException();
+            }
+            if (isCancelled())
+            {
+                throw new CancellationException("The warmup was cancelled");
+            }
+            long sliceMs = WAIT_SLICE_MS;
+            if (timeoutMs >= 0)
+            {
+                // Round up, so that the last slice does not return early
+                long remainingNs = timeoutNs - (System.nanoTime() - start);
+                if (remainingNs < TimeUnit.MILLISECONDS.toNanos(sliceMs))
+                {
+                    sliceMs = Math.max(0, 
+                        TimeUnit.NANOSECONDS.toMillis(remainingNs + 999999));
+                }
+            }
+            if (poll(sliceMs))
+            {
+                if (isCancelled())
+                {
+                    throw new CancellationException(
+                        "The warmup was cancelled");
+                }
+                return true;
+            }
+            if (timeoutMs >= 0 && System.nanoTime() - start >= timeoutNs)
+            {
+                return false;
+            }
+        }
+    }
+    
+    /**
+     * Wait for the given time until the native task is done, and store
+     * the result if it is done.
+     * 
+     * @param timeoutMs The timeout, in milliseconds. If this is negative,
+     * then this waits until the task is done.
+     * @return Whether the warmup is done
+     * @throws IllegalStateException If the warmup was released
+     */
+    private boolean poll(long timeoutMs)
+    {
+        long currentHandle = 0;
+        synchronized (this)
+        {
+            if (result != null)
+            {
+                return true;
+            }
+            currentHandle = getHandle();
+            waiters++;
+        }
+        int status[] = new int[1];
+        boolean done = false;
+        try
+        {
+            done = waitNative(currentHandle, timeoutMs, status);
+        }
+        finally
+        {
+            synchronized (this)
+            {
+                waiters--;
+                if (done)
+                {
+                    result = status[0];
+                }
+                notifyAll();
+            }
+        }
+        return done;
+    }
+    private static native boolean waitNative(
+        long handle, long timeoutMs, int status[]);
+
+    /**
+     * Release the native resources of this warmup. If the warmup is not
+     * done yet, it is cancelled. This waits until all threads that are
+     * waiting for the warmup have returned. Afterwards, the result of 
+     * a warmup that was done is still available, and all other methods
+     * throw an <code>IllegalStateException</code>. Calling this method 
+     * on a warmup that was already released has no effect.
+     */
+    public void release()
+    {
+        boolean interrupted = false;
+        synchronized (this)
+        {
+            if (handle == 0)
+            {
+                return;
+            }
+            if (!isDone())
+            {
+                cancelNative(handle);
+                cancelled = true;
+            }
+            long currentHandle = handle;
+            handle = 0;
+            while (waiters > 0)
+            {
+                try
+                {
+                    wait();
+                }
+                catch (InterruptedException e)
+                {
+                    interrupted = true;
+                }
+            }
+            releaseNative(currentHandle);
+        }
+        if (interrupted)
+        {
+            Thread.currentThread().interrupt();
+        }
+    }
+    private static native void releaseNative(long handle);
+
+    @Override
+    protected void finalize() throws Throwable
+    {
+        try
+        {
+            release();
+        }
+        finally
+        {
+            super.finalize();
+        }
+    }
+}
@@ -0,0 +1,515 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2016 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_DEVICE_HOST_UNIFIED_MEMORY;
+import static org.jocl.CL.CL_MAP_READ;
+import static org.jocl.CL.CL_MAP_WRITE;
+import static org.jocl.CL.CL_MEM_READ_WRITE;
+import static org.jocl.CL.CL_MEM_USE_HOST_PTR;
+import static org.jocl.CL.CL_QUEUE_CONTEXT;
+import static org.jocl.CL.CL_QUEUE_DEVICE;
+import static org.jocl.CL.clCreateBuffer;
+import static org.jocl.CL.clEnqueueMapBuffer;
+import static org.jocl.CL.clEnqueueUnmapMemObject;
+import static org.jocl.CL.clGetCommandQueueInfo;
+import static org.jocl.CL.clGetDeviceInfo;
+import static org.jocl.CL.clReleaseMemObject;
+
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.CharBuffer;
+import java.nio.DoubleBuffer;
+import java.nio.FloatBuffer;
+import java.nio.IntBuffer;
+import java.nio.LongBuffer;
+import java.nio.ShortBuffer;
+import java.util.HashMap;
+import java.util.Map;
+
+import org.jocl.Pointer;
+import org.jocl.Sizeof;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_device_id;
+import org.jocl.cl_mem;
+
+/**
+ * Zero-copy memory objects for direct buffers, for devices that share
+ * their memory with the host, like integrated GPUs and CPU devices.
+ * <p>
+ * A direct buffer is wrapped into a <code>cl_mem</code> that is created
+ * with <code>CL_MEM_USE_HOST_PTR</code>. The memory objects are cached
+ * for each context by the address and size of the buffer, so that
+ * repeated calls with the same buffer do not create new memory objects.
+ * The ownership of the memory is transferred between the host and the
+ * device by unmapping and mapping the memory object, which does not
+ * copy the data on devices with unified memory:
+ * <pre><code>
+ * ByteBuffer a = CLBlastZeroCopy.allocate(m * k * Sizeof.cl_float);
+ * ...
+ * cl_mem aMem = CLBlastZeroCopy.beginDeviceAccess(queue, a);
+ * ...
+ * CLBlast.CLBlastSgemm(..., aMem, 0, k, ..., queue, null);
+ * CLBlastZeroCopy.endDeviceAccess(queue, a);
+ * // The host may access the buffers here
+ * ...
+ * CLBlastZeroCopy.release(context);
+ * </code></pre>
+ * Most implementations only avoid the copy when the memory is aligned
+ * to {@link #ALIGNMENT} bytes and its size is a multiple of
+ * {@link #SIZE_GRANULARITY} bytes. Buffers that do not meet these
+ * requirements are rejected. Suitable buffers can be created with
+ * {@link #allocate(int)}. Off-heap memory of other kinds can be passed
+ * as a direct <code>ByteBuffer</code> view on this memory.
+ * <p>
+ * The cache keeps a reference to each buffer, so that its memory stays
+ * valid while the memory object exists. The memory objects have to be
+ * released with {@link #release(cl_context)} or
+ * {@link #release(cl_context, Buffer)}.
+ */
+public final class CLBlastZeroCopy
+{
+    /**
+     * The alignment of the memory, in bytes, that is required for
+     * zero-copy memory objects
+     */
+    public static final int ALIGNMENT = 4096;
+
+    /**
+     * The granularity of the size of the memory, in bytes, that is
+     * required for zero-copy memory objects
+     */
+    public static final int SIZE_GRANULARITY = 64;
+
+    /**
+     * A memory object for a direct buffer
+     */
+    private static final class Wrapper
+    {
+        /**
+         * The buffer
+         */
+        final Buffer buffer;
+
+        /**
+         * The memory object
+         */
+        final cl_mem mem;
+
+        /**
+         * The size, in bytes
+         */
+        final long size;
+
+        /**
+         * The mapped memory while the host owns the memory, or
+         * <code>null</code> while the device owns the memory
+         */
+        ByteBuffer mapped;
+
+        /**
+         * Creates a new instance
+         *
+         * @param buffer The buffer
+         * @param mem The memory object
+         * @param size The size
+         */
+        Wrapper(Buffer buffer, cl_mem mem, long size)
+        {
+            this.buffer = buffer;
+            this.mem = mem;
+            this.size = size;
+        }
+    }
+
+    /**
+     * The memory objects, for each context, keyed by the native context
+     * handle, and then by the address and size of the buffer
+     */
+    private static final Map<Long, Map<String, Wrapper>> wrappers =
+        new HashMap<Long, Map<String, Wrapper>>();
+
+    /**
+     * Private constructor to prevent instantiation
+     */
+    private CLBlastZeroCopy()
+    {
+        // Private constructor to prevent instantiation
+    }
+
+    /**
+     * Allocate a direct byte buffer in native byte order with at least
+     * the given size, whose memory is suitable for zero-copy memory
+     * objects. The size is rounded up to a multiple of
+     * {@link #SIZE_GRANULARITY}.
+     *
+     * @param size The size, in bytes
+     * @return The buffer
+     * @throws IllegalArgumentException If the size is negative
+     */
+    public static ByteBuffer allocate(int size)
+    {
+        if (size < 0)
+        {
+            throw new IllegalArgumentException(
+                "The size must not be negative, but is " + size);
+        }
+        int alignedSize = Math.max(SIZE_GRANULARITY, (int)roundUp(
+            size, SIZE_GRANULARITY));
+        ByteBuffer memory = ByteBuffer.allocateDirect(alignedSize + ALIGNMENT);
+        long address = CLBlastFast.getAddress(memory);
+        int padding = (int)(roundUp(address, ALIGNMENT) - address);
+        memory.position(padding);
+        memory.limit(padding + alignedSize);
+        return memory.slice().order(ByteOrder.nativeOrder());
+    }
+
+    /**
+     * Returns whether the given buffer is a direct buffer whose memory is
+     * suitable for zero-copy memory objects
+     *
+     * @param buffer The buffer
+     * @return Whether the buffer is suitable
+     */
+    public static boolean isAligned(Buffer buffer)
+    {
+        if (buffer == null || !buffer.isDirect())
+        {
+            return false;
+        }
+        long address = address(buffer);
+        long size = byteSize(buffer);
+        return address % ALIGNMENT == 0 && size % SIZE_GRANULARITY == 0;
+    }
+
+    /**
+     * Returns whether the device of the given queue shares its memory
+     * with the host, according to <code>CL_DEVICE_HOST_UNIFIED_MEMORY</code>.
+     * Only for such devices, the memory objects of this class avoid
+     * copies.
+     *
+     * @param queue The queue
+     * @return Whether the device has unified memory
+     */
+    public static boolean isHostUnifiedMemory(cl_command_queue queue)
+    {
+        cl_device_id device = new cl_device_id();
+        CLBlastTiledGemm.check(clGetCommandQueueInfo(queue, CL_QUEUE_DEVICE,
+            Sizeof.cl_device_id, Pointer.to(device), null),
+            "clGetCommandQueueInfo");
+        int value[] = new int[1];
+        CLBlastTiledGemm.check(clGetDeviceInfo(device,
+            CL_DEVICE_HOST_UNIFIED_MEMORY, Sizeof.cl_int, Pointer.to(value),
+            null), "clGetDeviceInfo");
+        return value[0] != 0;
+    }
+
+    /**
+     * Returns the memory object for the given buffer, and transfer the
+     * ownership of the memory to the device. The memory object covers
+     * the remaining elements of the buffer, between its position and its
+     * limit, like a <code>Pointer</code> to the buffer.
+     * Until {@link #endDeviceAccess} is called, the host must not
+     * access the buffer. The memory object is created when this method
+     * is called for the first time with the given buffer and the
+     * context of the given queue.
+     *
+     * @param queue The queue
+     * @param buffer The buffer
+     * @return The memory object
+     * @throws IllegalArgumentException If the buffer is not a direct
+     * buffer, or its memory is not suitable for zero-copy memory objects
+     * @throws org.jocl.CLException If an OpenCL call fails
+     */
+    public static cl_mem beginDeviceAccess(
+        cl_command_queue queue, Buffer buffer)
+    {
+        Wrapper wrapper = obtainWrapper(queue, buffer);
+        synchronized (wrapper)
+        {
+            if (wrapper.mapped != null)
+            {
+                CLBlastTiledGemm.check(clEnqueueUnmapMemObject(queue,
+                    wrapper.mem, Pointer.to(wrapper.mapped), 0, null, null),
+                    "clEnqueueUnmapMemObject");
+                wrapper.mapped = null;
+            }
+            return wrapper.mem;
+        }
+    }
+
+    /**
+     * Transfer the ownership of the memory of the given buffer back to
+     * the host. This blocks until all commands in the queue that use
+     * the memory have completed, and the host may access the buffer
+     * afterwards.
+     *
+     * @param queue The queue
+     * @param buffer The buffer
+     * @throws IllegalArgumentException If the buffer is not a direct
+     * buffer, or its memory is not suitable for zero-copy memory objects
+     * @throws org.jocl.CLException If an OpenCL call fails
+     */
+    public static void endDeviceAccess(cl_command_queue queue, Buffer buffer)
+    {
+        Wrapper wrapper = obtainWrapper(queue, buffer);
+        synchronized (wrapper)
+        {
+            map(queue, wrapper);
+        }
+    }
+
+    /**
+     * Map the memory object of the given wrapper, if it is not mapped
+     *
+     * @param queue The queue
+     * @param wrapper The wrapper
+     * @throws org.jocl.CLException If an OpenCL call fails
+     */
+    private static void map(cl_command_queue queue, Wrapper wrapper)
+    {
+        if (wrapper.mapped == null)
+        {
+            int errorCode[] = new int[1];
+            ByteBuffer mapped = clEnqueueMapBuffer(queue, wrapper.mem, true,
+                CL_MAP_READ | CL_MAP_WRITE, 0, wrapper.size, 0, null, null,
+                errorCode);
+            CLBlastTiledGemm.check(errorCode[0], "clEnqueueMapBuffer");
+            wrapper.mapped = mapped;
+        }
+    }
+
+    /**
+     * Returns the wrapper for the given buffer, creating it if necessary.
+     * A new wrapper is mapped, so that the host owns the memory.
+     *
+     * @param queue The queue
+     * @param buffer The buffer
+     * @return The wrapper
+     * @throws IllegalArgumentException If the buffer is not suitable
+     * @throws org.jocl.CLException If an OpenCL call fails
+     */
+    private static Wrapper obtainWrapper(
+        cl_command_queue queue, Buffer buffer)
+    {
+        if (buffer == null || !buffer.isDirect())
+        {
+            throw new IllegalArgumentException(
+                "The buffer must be a direct buffer");
+        }
+        long address = address(buffer);
+        long size = byteSize(buffer);
+        if (address % ALIGNMENT != 0 || size % SIZE_GRANULARITY != 0)
+        {
+            throw new IllegalArgumentException("The buffer memory must " +
+                "be aligned to " + ALIGNMENT + " bytes and have a size " +
+                "that is a multiple of " + SIZE_GRANULARITY + " bytes, " +
+                "but the address is " + Long.toHexString(address) +
+                " and the size is " + size);
+        }
+        cl_context context = getContext(queue);
+        Long contextKey = CLBlastFast.getHandle(context);
+        String key = Long.toHexString(address) + ":" + size;
+        synchronized (wrappers)
+        {
+            Map<String, Wrapper> contextWrappers = wrappers.get(contextKey);
+            if (contextWrappers == null)
+            {
+                contextWrappers = new HashMap<String, Wrapper>();
+                wrappers.put(contextKey, contextWrappers);
+            }
+            Wrapper wrapper = contextWrappers.get(key);
+            if (wrapper == null)
+            {
+                int errorCode[] = new int[1];
+                cl_mem mem = clCreateBuffer(context,
+                    CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, size,
+                    Pointer.to(buffer), errorCode);
+                CLBlastTiledGemm.check(errorCode[0], "clCreateBuffer");
+                wrapper = new Wrapper(buffer, mem, size);
+                map(queue, wrapper);
+                contextWrappers.put(key, wrapper);
+            }
+            return wrapper;
+        }
+    }
+
+    /**
+     * Release the memory object for the given buffer in the given
+     * context, if it exists. The memory must be owned by the host, or
+     * all commands that use the memory object must have completed.
+     *
+     * @param context The context
+     * @param buffer The buffer
+     */
+    public static void release(cl_context context, Buffer buffer)
+    {
+        if (buffer == null || !buffer.isDirect())
+        {
+            return;
+        }
+        long address = address(buffer);
+        long size = byteSize(buffer);
+        String key = Long.toHexString(address) + ":" + size;
+        Wrapper wrapper = null;
+        synchronized (wrappers)
+        {
+            Map<String, Wrapper> contextWrappers =
+                wrappers.get(CLBlastFast.getHandle(context));
+            if (contextWrappers != null)
+            {
+                wrapper = contextWrappers.remove(key);
+            }
+        }
+        if (wrapper != null)
+        {
+            releaseWrapper(wrapper);
+        }
+    }
+
+    /**
+     * Release all memory objects that have been created for the given
+     * context. This must be called before the context is released.
+     *
+     * @param context The context
+     */
+    public static void release(cl_context context)
+    {
+        Map<String, Wrapper> contextWrappers = null;
+        synchronized (wrappers)
+        {
+            contextWrappers = wrappers.remove(CLBlastFast.getHandle(context));
+        }
+        if (contextWrappers == null)
+        {
+            return;
+        }
+        for (Wrapper wrapper : contextWrappers.values())
+        {
+            releaseWrapper(wrapper);
+        }
+    }
+
+    /**
+     * Release the memory object of the given wrapper. A mapped memory
+     * object is released without unmapping it, which is allowed because
+     * it was created with <code>CL_MEM_USE_HOST_PTR</code>, and its
+     * mapped memory is the memory of the buffer.
+     *
+     * @param wrapper The wrapper
+     */
+    private static void releaseWrapper(Wrapper wrapper)
+    {
+        synchronized (wrapper)
+        {
+            wrapper.mapped = null;
+            clReleaseMemObject(wrapper.mem);
+        }
+    }
+
+    /**
+     * Returns the address of the element at the position of the given
+     * direct buffer
+     *
+     * @param buffer The buffer
+     * @return The address
+     */
+    private static long address(Buffer buffer)
+    {
+        return CLBlastFast.getAddress(buffer) +
+            (long)buffer.position() * elementSize(buffer);
+    }
+
+    /**
+     * Returns the size of the remaining elements of the given buffer,
+     * in bytes
+     *
+     * @param buffer The buffer
+     * @return The size
+     */
+    private static long byteSize(Buffer buffer)
+    {
+        return (long)buffer.remaining() * elementSize(buffer);
+    }
+
+    /**
+     * Returns the size of one element of the given buffer, in bytes
+     *
+     * @param buffer The buffer
+     * @return The element size
+     */
+    static int elementSize(Buffer buffer)
+    {
+        if (buffer instanceof ByteBuffer)
+        {
+            return Sizeof.cl_char;
+        }
+        if (buffer instanceof ShortBuffer || buffer instanceof CharBuffer)
+        {
+            return Sizeof.cl_short;
+        }
+        if (buffer instanceof IntBuffer || buffer instanceof FloatBuffer)
+        {
+            return Sizeof.cl_int;
+        }
+        if (buffer instanceof LongBuffer || buffer instanceof DoubleBuffer)
+        {
+            return Sizeof.cl_long;
+        }
+        throw new IllegalArgumentException(
+            "Unsupported buffer type: " + buffer.getClass());
+    }
+
+    /**
+     * Round the given value up to a multiple of the given granularity
+     *
+     * @param value The value
+     * @param granularity The granularity
+     * @return The rounded value
+     */
+    static long roundUp(long value, long granularity)
+    {
+        return ((value + granularity - 1) / granularity) * granularity;
+    }
+
+    /**
+     * Returns the context of the given queue
+     *
+     * @param queue The queue
+     * @return The context
+     */
+    private static cl_context getContext(cl_command_queue queue)
+    {
+        cl_context context = new cl_context();
+        CLBlastTiledGemm.check(clGetCommandQueueInfo(queue, CL_QUEUE_CONTEXT,
+            Sizeof.cl_context, Pointer.to(context), null),
+            "clGetCommandQueueInfo");
+        return context;
+    }
+}
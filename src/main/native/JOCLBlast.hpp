@@ -44,1477 +44,2581 @@ extern "C" {
 JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setLogLevelNative
   (JNIEnv *, jclass, jint);
 
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    setStatisticsEnabledNative
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setStatisticsEnabledNative
+  (JNIEnv *, jclass, jboolean);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    getStatisticsRoutineNamesNative
+ * Signature: ()[Ljava/lang/String;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_getStatisticsRoutineNamesNative
+  (JNIEnv *, jclass);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    getStatisticsNative
+ * Signature: (Z)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_jocl_blast_CLBlast_getStatisticsNative
+  (JNIEnv *, jclass, jboolean);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    setProfilingEnabledNative
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setProfilingEnabledNative
+  (JNIEnv *, jclass, jboolean);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    getProfileNative
+ * Signature: (Z)[Ljava/lang/Object;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_getProfileNative
+  (JNIEnv *, jclass, jboolean);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    setKernelCacheTrackingEnabledNative
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setKernelCacheTrackingEnabledNative
+  (JNIEnv *, jclass, jboolean);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    getKernelCacheNative
+ * Signature: ()[Ljava/lang/Object;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_getKernelCacheNative
+  (JNIEnv *, jclass);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    evictKernelCacheNative
+ * Signature: (JLjava/lang/String;I)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_evictKernelCacheNative
+  (JNIEnv *, jclass, jlong, jstring, jint);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    setKernelCacheLimitNative
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setKernelCacheLimitNative
+  (JNIEnv *, jclass, jint);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    setCallTraceEnabledNative
+ * Signature: (Z)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setCallTraceEnabledNative
+  (JNIEnv *, jclass, jboolean);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    setCallTraceCapacityNative
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setCallTraceCapacityNative
+  (JNIEnv *, jclass, jint);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    getCallTraceNative
+ * Signature: (Z)[Ljava/lang/Object;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_getCallTraceNative
+  (JNIEnv *, jclass, jboolean);
+
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSrotgNative
- * Signature: (Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSrotgNative
-  (JNIEnv *, jclass, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDrotgNative
- * Signature: (Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDrotgNative
-  (JNIEnv *, jclass, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSrotmgNative
- * Signature: (Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSrotmgNative
-  (JNIEnv *, jclass, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDrotmgNative
- * Signature: (Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDrotmgNative
-  (JNIEnv *, jclass, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSrotNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSrotNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDrotNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDrotNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSrotmNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSrotmNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDrotmNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDrotmNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSswapNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSswapNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDswapNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDswapNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCswapNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCswapNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZswapNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZswapNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHswapNative
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHswapNative
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSscalNative
- * Signature: (JFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSscalNative
-  (JNIEnv *, jclass, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDscalNative
- * Signature: (JDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDscalNative
-  (JNIEnv *, jclass, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCscalNative
- * Signature: (J[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (J[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCscalNative
-  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCscalSplitNative
+ * Signature: (JFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCscalSplitNative
+  (JNIEnv *, jclass, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZscalNative
- * Signature: (J[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (J[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZscalNative
-  (JNIEnv *, jclass, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZscalSplitNative
+ * Signature: (JDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZscalSplitNative
+  (JNIEnv *, jclass, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHscalNative
+ * Signature: (JFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHscalNative
+  (JNIEnv *, jclass, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastScopyNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastScopyNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDcopyNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDcopyNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCcopyNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCcopyNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZcopyNative
- * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZcopyNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHcopyNative
+ * Signature: (JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHcopyNative
+  (JNIEnv *, jclass, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSaxpyNative
- * Signature: (JFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSaxpyNative
-  (JNIEnv *, jclass, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDaxpyNative
- * Signature: (JDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDaxpyNative
-  (JNIEnv *, jclass, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCaxpyNative
- * Signature: (J[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (J[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCaxpyNative
-  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCaxpySplitNative
+ * Signature: (JFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCaxpySplitNative
+  (JNIEnv *, jclass, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZaxpyNative
- * Signature: (J[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (J[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZaxpyNative
-  (JNIEnv *, jclass, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZaxpySplitNative
+ * Signature: (JDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZaxpySplitNative
+  (JNIEnv *, jclass, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHaxpyNative
+ * Signature: (JFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHaxpyNative
+  (JNIEnv *, jclass, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSdotNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSdotNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDdotNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDdotNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHdotNative
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHdotNative
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCdotuNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCdotuNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZdotuNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZdotuNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCdotcNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCdotcNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZdotcNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZdotcNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSnrm2Native
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSnrm2Native
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDnrm2Native
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDnrm2Native
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastScnrm2Native
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastScnrm2Native
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDznrm2Native
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDznrm2Native
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHnrm2Native
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHnrm2Native
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSasumNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSasumNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDasumNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDasumNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastScasumNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastScasumNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDzasumNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDzasumNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHasumNative
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHasumNative
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSsumNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSsumNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDsumNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDsumNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastScsumNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastScsumNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDzsumNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDzsumNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHsumNative
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHsumNative
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiSamaxNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiSamaxNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiDamaxNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiDamaxNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiCamaxNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiCamaxNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiZamaxNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiZamaxNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastiHamaxNative
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiHamaxNative
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiSaminNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiSaminNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiDaminNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiDaminNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiCaminNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiCaminNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiZaminNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiZaminNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastiHaminNative
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiHaminNative
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiSmaxNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiSmaxNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiDmaxNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiDmaxNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiCmaxNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiCmaxNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiZmaxNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiZmaxNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastiHmaxNative
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiHmaxNative
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiSminNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiSminNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiDminNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiDminNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiCminNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiCminNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastiZminNative
- * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiZminNative
-  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastiHminNative
+ * Signature: (JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastiHminNative
+  (JNIEnv *, jclass, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSgemvNative
- * Signature: (IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgemvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDgemvNative
- * Signature: (IIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgemvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCgemvNative
- * Signature: (IIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgemvSplitNative
+ * Signature: (IIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemvSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZgemvNative
- * Signature: (IIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgemvSplitNative
+ * Signature: (IIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemvSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHgemvNative
+ * Signature: (IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHgemvNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSgbmvNative
- * Signature: (IIJJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgbmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDgbmvNative
- * Signature: (IIJJJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgbmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCgbmvNative
- * Signature: (IIJJJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgbmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgbmvSplitNative
+ * Signature: (IIJJJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgbmvSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZgbmvNative
- * Signature: (IIJJJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgbmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgbmvSplitNative
+ * Signature: (IIJJJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgbmvSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHgbmvNative
+ * Signature: (IIJJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHgbmvNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastChemvNative
- * Signature: (IIJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChemvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastChemvSplitNative
+ * Signature: (IIJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChemvSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZhemvNative
- * Signature: (IIJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhemvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZhemvSplitNative
+ * Signature: (IIJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhemvSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastChbmvNative
- * Signature: (IIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChbmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastChbmvSplitNative
+ * Signature: (IIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChbmvSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZhbmvNative
- * Signature: (IIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhbmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZhbmvSplitNative
+ * Signature: (IIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhbmvSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastChpmvNative
- * Signature: (IIJ[FLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJ[FLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChpmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jfloatArray, jobject, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloatArray, jobject, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastChpmvSplitNative
+ * Signature: (IIJFFLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChpmvSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jfloat, jobject, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZhpmvNative
- * Signature: (IIJ[DLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJ[DLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhpmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jdoubleArray, jobject, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdoubleArray, jobject, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZhpmvSplitNative
+ * Signature: (IIJDDLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhpmvSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jdouble, jobject, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSsymvNative
- * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSsymvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDsymvNative
- * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDsymvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHsymvNative
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHsymvNative
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSsbmvNative
- * Signature: (IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSsbmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDsbmvNative
- * Signature: (IIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDsbmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHsbmvNative
+ * Signature: (IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHsbmvNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSspmvNative
- * Signature: (IIJFLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJFLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSspmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDspmvNative
- * Signature: (IIJDLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJDLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDspmvNative
-  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHspmvNative
+ * Signature: (IIJFLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHspmvNative
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastStrmvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastStrmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDtrmvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDtrmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCtrmvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtrmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZtrmvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtrmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHtrmvNative
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHtrmvNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastStbmvNative
- * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastStbmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDtbmvNative
- * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDtbmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCtbmvNative
- * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtbmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZtbmvNative
- * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtbmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHtbmvNative
+ * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHtbmvNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastStpmvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastStpmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDtpmvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDtpmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCtpmvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtpmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZtpmvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtpmvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHtpmvNative
+ * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHtpmvNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastStrsvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastStrsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDtrsvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDtrsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCtrsvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtrsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZtrsvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtrsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastStbsvNative
- * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastStbsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDtbsvNative
- * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDtbsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCtbsvNative
- * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtbsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZtbsvNative
- * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtbsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastStpsvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastStpsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDtpsvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDtpsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCtpsvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtpsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZtpsvNative
- * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtpsvNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSgerNative
- * Signature: (IJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgerNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDgerNative
- * Signature: (IJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgerNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHgerNative
+ * Signature: (IJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHgerNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCgeruNative
- * Signature: (IJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgeruNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgeruSplitNative
+ * Signature: (IJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgeruSplitNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZgeruNative
- * Signature: (IJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgeruNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgeruSplitNative
+ * Signature: (IJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgeruSplitNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCgercNative
- * Signature: (IJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgercNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgercSplitNative
+ * Signature: (IJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgercSplitNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZgercNative
- * Signature: (IJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgercNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgercSplitNative
+ * Signature: (IJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgercSplitNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCherNative
- * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCherNative
-  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZherNative
- * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZherNative
-  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastChprNative
- * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChprNative
-  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZhprNative
- * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhprNative
-  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCher2Native
- * Signature: (IIJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCher2Native
-  (JNIEnv *, jclass, jint, jint, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCher2SplitNative
+ * Signature: (IIJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCher2SplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZher2Native
- * Signature: (IIJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZher2Native
-  (JNIEnv *, jclass, jint, jint, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZher2SplitNative
+ * Signature: (IIJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZher2SplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastChpr2Native
- * Signature: (IIJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChpr2Native
-  (JNIEnv *, jclass, jint, jint, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastChpr2SplitNative
+ * Signature: (IIJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChpr2SplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZhpr2Native
- * Signature: (IIJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhpr2Native
-  (JNIEnv *, jclass, jint, jint, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZhpr2SplitNative
+ * Signature: (IIJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhpr2SplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSsyrNative
- * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSsyrNative
-  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDsyrNative
- * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDsyrNative
-  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHsyrNative
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHsyrNative
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSsprNative
- * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSsprNative
-  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDsprNative
- * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDsprNative
-  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHsprNative
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHsprNative
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSsyr2Native
- * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSsyr2Native
-  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDsyr2Native
- * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDsyr2Native
-  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHsyr2Native
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHsyr2Native
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSspr2Native
- * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSspr2Native
-  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDspr2Native
- * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDspr2Native
-  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHspr2Native
+ * Signature: (IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHspr2Native
+  (JNIEnv *, jclass, jint, jint, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSgemmNative
- * Signature: (IIIJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgemmNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDgemmNative
- * Signature: (IIIJJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgemmNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCgemmNative
- * Signature: (IIIJJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgemmSplitNative
+ * Signature: (IIIJJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZgemmNative
- * Signature: (IIIJJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemmNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgemmSplitNative
+ * Signature: (IIIJJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemmSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHgemmNative
+ * Signature: (IIIJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHgemmNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSsymmNative
- * Signature: (IIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSsymmNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDsymmNative
- * Signature: (IIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDsymmNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCsymmNative
- * Signature: (IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCsymmNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
- * Method:    CLBlastZsymmNative
- * Signature: (IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Method:    CLBlastCsymmSplitNative
+ * Signature: (IIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
-JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZsymmNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCsymmSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZsymmNative
+ * Signature: (IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZsymmNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZsymmSplitNative
+ * Signature: (IIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZsymmSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHsymmNative
+ * Signature: (IIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHsymmNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastChemmNative
- * Signature: (IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChemmNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastChemmSplitNative
+ * Signature: (IIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChemmSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZhemmNative
- * Signature: (IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhemmNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZhemmSplitNative
+ * Signature: (IIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhemmSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSsyrkNative
- * Signature: (IIIJJFLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJFLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSsyrkNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDsyrkNative
- * Signature: (IIIJJDLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJDLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDsyrkNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCsyrkNative
- * Signature: (IIIJJ[FLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJ[FLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCsyrkNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCsyrkSplitNative
+ * Signature: (IIIJJFFLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCsyrkSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZsyrkNative
- * Signature: (IIIJJ[DLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJ[DLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZsyrkNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZsyrkSplitNative
+ * Signature: (IIIJJDDLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZsyrkSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHsyrkNative
+ * Signature: (IIIJJFLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHsyrkNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCherkNative
- * Signature: (IIIJJFLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJFLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCherkNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZherkNative
- * Signature: (IIIJJDLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJDLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZherkNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSsyr2kNative
- * Signature: (IIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSsyr2kNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDsyr2kNative
- * Signature: (IIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDsyr2kNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCsyr2kNative
- * Signature: (IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCsyr2kNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCsyr2kSplitNative
+ * Signature: (IIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCsyr2kSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZsyr2kNative
- * Signature: (IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZsyr2kNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZsyr2kSplitNative
+ * Signature: (IIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZsyr2kSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHsyr2kNative
+ * Signature: (IIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHsyr2kNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCher2kNative
- * Signature: (IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCher2kNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCher2kSplitNative
+ * Signature: (IIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCher2kSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZher2kNative
- * Signature: (IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZher2kNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZher2kSplitNative
+ * Signature: (IIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZher2kSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastStrmmNative
- * Signature: (IIIIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastStrmmNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDtrmmNative
- * Signature: (IIIIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDtrmmNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCtrmmNative
- * Signature: (IIIIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtrmmNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCtrmmSplitNative
+ * Signature: (IIIIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtrmmSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZtrmmNative
- * Signature: (IIIIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtrmmNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZtrmmSplitNative
+ * Signature: (IIIIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtrmmSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHtrmmNative
+ * Signature: (IIIIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHtrmmNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastStrsmNative
- * Signature: (IIIIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastStrsmNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDtrsmNative
- * Signature: (IIIIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDtrsmNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCtrsmNative
- * Signature: (IIIIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtrsmNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCtrsmSplitNative
+ * Signature: (IIIIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtrsmSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZtrsmNative
- * Signature: (IIIIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtrsmNative
-  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZtrsmSplitNative
+ * Signature: (IIIIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtrsmSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastShadNative
- * Signature: (JFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastShadNative
-  (JNIEnv *, jclass, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDhadNative
- * Signature: (JDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (JDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDhadNative
-  (JNIEnv *, jclass, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastChadNative
- * Signature: (J[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (J[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChadNative
-  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastChadSplitNative
+ * Signature: (JFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastChadSplitNative
+  (JNIEnv *, jclass, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZhadNative
- * Signature: (J[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (J[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhadNative
-  (JNIEnv *, jclass, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZhadSplitNative
+ * Signature: (JDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZhadSplitNative
+  (JNIEnv *, jclass, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHhadNative
+ * Signature: (JFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHhadNative
+  (JNIEnv *, jclass, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSomatcopyNative
- * Signature: (IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSomatcopyNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDomatcopyNative
- * Signature: (IIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDomatcopyNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastComatcopyNative
- * Signature: (IIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastComatcopyNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastComatcopySplitNative
+ * Signature: (IIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastComatcopySplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZomatcopyNative
- * Signature: (IIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZomatcopyNative
-  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZomatcopySplitNative
+ * Signature: (IIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZomatcopySplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHomatcopyNative
+ * Signature: (IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHomatcopyNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSim2colNative
- * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSim2colNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDim2colNative
- * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDim2colNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCim2colNative
- * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCim2colNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZim2colNative
- * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZim2colNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHim2colNative
+ * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHim2colNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastScol2imNative
- * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastScol2imNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDcol2imNative
- * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDcol2imNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCcol2imNative
- * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCcol2imNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZcol2imNative
- * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZcol2imNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHcol2imNative
+ * Signature: (IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHcol2imNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSconvgemmNative
- * Signature: (IJJJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSconvgemmNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDconvgemmNative
- * Signature: (IJJJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IJJJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDconvgemmNative
-  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHconvgemmNative
+ * Signature: (IJJJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHconvgemmNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSaxpyBatchedNative
- * Signature: (J[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (J[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSaxpyBatchedNative
-  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDaxpyBatchedNative
- * Signature: (J[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (J[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDaxpyBatchedNative
-  (JNIEnv *, jclass, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCaxpyBatchedNative
- * Signature: (J[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (J[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCaxpyBatchedNative
-  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZaxpyBatchedNative
- * Signature: (J[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (J[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZaxpyBatchedNative
-  (JNIEnv *, jclass, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHaxpyBatchedNative
+ * Signature: (J[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHaxpyBatchedNative
+  (JNIEnv *, jclass, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastSaxpyBatchedDirectNative
+ * Signature: (JLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSaxpyBatchedDirectNative
+  (JNIEnv *, jclass, jlong, jobject, jobject, jobject, jlong, jobject, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastDaxpyBatchedDirectNative
+ * Signature: (JLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDaxpyBatchedDirectNative
+  (JNIEnv *, jclass, jlong, jobject, jobject, jobject, jlong, jobject, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCaxpyBatchedDirectNative
+ * Signature: (JLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCaxpyBatchedDirectNative
+  (JNIEnv *, jclass, jlong, jobject, jobject, jobject, jlong, jobject, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZaxpyBatchedDirectNative
+ * Signature: (JLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZaxpyBatchedDirectNative
+  (JNIEnv *, jclass, jlong, jobject, jobject, jobject, jlong, jobject, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHaxpyBatchedDirectNative
+ * Signature: (JLjava/nio/ShortBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHaxpyBatchedDirectNative
+  (JNIEnv *, jclass, jlong, jobject, jobject, jobject, jlong, jobject, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSgemmBatchedNative
- * Signature: (IIIJJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgemmBatchedNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jfloatArray, jobject, jlongArray, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jfloatArray, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDgemmBatchedNative
- * Signature: (IIIJJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[DLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[DLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgemmBatchedNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jdoubleArray, jobject, jlongArray, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jdoubleArray, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCgemmBatchedNative
- * Signature: (IIIJJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmBatchedNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jfloatArray, jobject, jlongArray, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jfloatArray, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZgemmBatchedNative
- * Signature: (IIIJJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[DLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[DLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemmBatchedNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jdoubleArray, jobject, jlongArray, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jdoubleArray, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHgemmBatchedNative
+ * Signature: (IIIJJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHgemmBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jfloatArray, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastSgemmBatchedDirectNative
+ * Signature: (IIIJJJLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgemmBatchedDirectNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jobject, jobject, jobject, jlong, jobject, jobject, jlong, jobject, jobject, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastDgemmBatchedDirectNative
+ * Signature: (IIIJJJLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgemmBatchedDirectNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jobject, jobject, jobject, jlong, jobject, jobject, jlong, jobject, jobject, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgemmBatchedDirectNative
+ * Signature: (IIIJJJLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmBatchedDirectNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jobject, jobject, jobject, jlong, jobject, jobject, jlong, jobject, jobject, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgemmBatchedDirectNative
+ * Signature: (IIIJJJLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemmBatchedDirectNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jobject, jobject, jobject, jlong, jobject, jobject, jlong, jobject, jobject, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHgemmBatchedDirectNative
+ * Signature: (IIIJJJLjava/nio/ShortBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLjava/nio/ShortBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHgemmBatchedDirectNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jobject, jobject, jobject, jlong, jobject, jobject, jlong, jobject, jobject, jobject, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSgemmStridedBatchedNative
- * Signature: (IIIJJJFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgemmStridedBatchedNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastDgemmStridedBatchedNative
- * Signature: (IIIJJJDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJDLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJDLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgemmStridedBatchedNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jdouble, jobject, jlong, jlong, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jdouble, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastCgemmStridedBatchedNative
- * Signature: (IIIJJJ[FLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJ[FLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJ[FLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJ[FLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmStridedBatchedNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgemmStridedBatchedSplitNative
+ * Signature: (IIIJJJFFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmStridedBatchedSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZgemmStridedBatchedNative
- * Signature: (IIIJJJ[DLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJ[DLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ * Signature: (IIIJJJ[DLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJ[DLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
  */
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemmStridedBatchedNative
-  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jlong, jlong, jobject, jobject);
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgemmStridedBatchedSplitNative
+ * Signature: (IIIJJJDDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJDDLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemmStridedBatchedSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHgemmStridedBatchedNative
+ * Signature: (IIIJJJFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHgemmStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastSgemvBatchedNative
+ * Signature: (IIJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgemvBatchedNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jfloatArray, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastDgemvBatchedNative
+ * Signature: (IIJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[DLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgemvBatchedNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jdoubleArray, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgemvBatchedNative
+ * Signature: (IIJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemvBatchedNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jfloatArray, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgemvBatchedNative
+ * Signature: (IIJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[DLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemvBatchedNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jdoubleArray, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastSgemvStridedBatchedNative
+ * Signature: (IIJJFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgemvStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastDgemvStridedBatchedNative
+ * Signature: (IIJJDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJDLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgemvStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jdouble, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgemvStridedBatchedNative
+ * Signature: (IIJJ[FLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJ[FLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemvStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgemvStridedBatchedSplitNative
+ * Signature: (IIJJFFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemvStridedBatchedSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgemvStridedBatchedNative
+ * Signature: (IIJJ[DLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJ[DLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemvStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgemvStridedBatchedSplitNative
+ * Signature: (IIJJDDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJDDLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemvStridedBatchedSplitNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastStrsvBatchedNative
+ * Signature: (IIIIJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastStrsvBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastDtrsvBatchedNative
+ * Signature: (IIIIJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDtrsvBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCtrsvBatchedNative
+ * Signature: (IIIIJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtrsvBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZtrsvBatchedNative
+ * Signature: (IIIIJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtrsvBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastStrsvStridedBatchedNative
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastStrsvStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastDtrsvStridedBatchedNative
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDtrsvStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCtrsvStridedBatchedNative
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCtrsvStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZtrsvStridedBatchedNative
+ * Signature: (IIIIJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZtrsvStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastSgerBatchedNative
+ * Signature: (IJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgerBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastDgerBatchedNative
+ * Signature: (IJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgerBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastSgerStridedBatchedNative
+ * Signature: (IJJFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgerStridedBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloat, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastDgerStridedBatchedNative
+ * Signature: (IJJDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgerStridedBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdouble, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgeruBatchedNative
+ * Signature: (IJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgeruBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgeruBatchedNative
+ * Signature: (IJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgeruBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgeruStridedBatchedNative
+ * Signature: (IJJ[FLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgeruStridedBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgeruStridedBatchedSplitNative
+ * Signature: (IJJFFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgeruStridedBatchedSplitNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgeruStridedBatchedNative
+ * Signature: (IJJ[DLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgeruStridedBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgeruStridedBatchedSplitNative
+ * Signature: (IJJDDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgeruStridedBatchedSplitNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgercBatchedNative
+ * Signature: (IJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgercBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloatArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgercBatchedNative
+ * Signature: (IJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgercBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdoubleArray, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jobject, jlongArray, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgercStridedBatchedNative
+ * Signature: (IJJ[FLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgercStridedBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloatArray, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgercStridedBatchedSplitNative
+ * Signature: (IJJFFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgercStridedBatchedSplitNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgercStridedBatchedNative
+ * Signature: (IJJ[DLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgercStridedBatchedNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgercStridedBatchedSplitNative
+ * Signature: (IJJDDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgercStridedBatchedSplitNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jobject, jlong, jlong, jlong, jlong, jobject, jobjectArray, jobject);
 
 /*
  * Class:     org_jocl_blast_CLBlast
@@ -1540,6 +2644,14 @@ JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgemmWithTempBufferNat
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmWithTempBufferNative
   (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobject, jobject);
 
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgemmWithTempBufferSplitNative
+ * Signature: (IIIJJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;Lorg/jocl/cl_mem;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmWithTempBufferSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobject, jobject);
+
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastZgemmWithTempBufferNative
@@ -1548,6 +2660,70 @@ JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmWithTempBufferNat
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemmWithTempBufferNative
   (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobject, jobject);
 
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgemmWithTempBufferSplitNative
+ * Signature: (IIIJJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;Lorg/jocl/cl_mem;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemmWithTempBufferSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobject, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHgemmWithTempBufferNative
+ * Signature: (IIIJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;Lorg/jocl/cl_mem;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHgemmWithTempBufferNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobject, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastSgemmPooledNative
+ * Signature: (IIIJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastSgemmPooledNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastDgemmPooledNative
+ * Signature: (IIIJJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastDgemmPooledNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgemmPooledNative
+ * Signature: (IIIJJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmPooledNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jlong, jlong, jfloatArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastCgemmPooledSplitNative
+ * Signature: (IIIJJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCgemmPooledSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jlong, jlong, jfloat, jfloat, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgemmPooledNative
+ * Signature: (IIIJJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemmPooledNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jlong, jlong, jdoubleArray, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastZgemmPooledSplitNative
+ * Signature: (IIIJJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZgemmPooledSplitNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jlong, jlong, jdouble, jdouble, jobject, jlong, jlong, jobject, jobjectArray, jobject);
+
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastSGemmTempBufferSizeNative
@@ -1580,6 +2756,14 @@ JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastCGemmTempBufferSizeNat
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastZGemmTempBufferSizeNative
   (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlongArray);
 
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    CLBlastHGemmTempBufferSizeNative
+ * Signature: (IIIJJJJJJJJJLorg/jocl/cl_command_queue;[J)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastHGemmTempBufferSizeNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jlongArray);
+
 /*
  * Class:     org_jocl_blast_CLBlast
  * Method:    CLBlastClearCacheNative
@@ -1604,6 +2788,86 @@ JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastFillCacheNative
 JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_CLBlastOverrideParametersNative
   (JNIEnv *, jclass, jobject, jstring, jint, jlong, jobjectArray, jlongArray);
 
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    setTempBufferPoolLimitNative
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setTempBufferPoolLimitNative
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    setTempBufferPoolMaxOutstandingNative
+ * Signature: (I)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setTempBufferPoolMaxOutstandingNative
+  (JNIEnv *, jclass, jint);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    setTempBufferPoolMaxReuseRatioNative
+ * Signature: (D)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setTempBufferPoolMaxReuseRatioNative
+  (JNIEnv *, jclass, jdouble);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    getTempBufferPoolMaxReuseRatioNative
+ * Signature: ()D
+ */
+JNIEXPORT jdouble JNICALL Java_org_jocl_blast_CLBlast_getTempBufferPoolMaxReuseRatioNative
+  (JNIEnv *, jclass);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    getTempBufferPoolOutstandingNative
+ * Signature: ()I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_getTempBufferPoolOutstandingNative
+  (JNIEnv *, jclass);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    getTempBufferPoolSizeNative
+ * Signature: ()J
+ */
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlast_getTempBufferPoolSizeNative
+  (JNIEnv *, jclass);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    trimTempBufferPoolNative
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_trimTempBufferPoolNative
+  (JNIEnv *, jclass);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    loadTuningDatabaseNative
+ * Signature: (Lorg/jocl/cl_device_id;Ljava/lang/String;)[Ljava/lang/String;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_loadTuningDatabaseNative
+  (JNIEnv *, jclass, jobject, jstring);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    exportTuningDatabaseNative
+ * Signature: (Lorg/jocl/cl_device_id;Ljava/lang/String;)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_exportTuningDatabaseNative
+  (JNIEnv *, jclass, jobject, jstring);
+
+/*
+ * Class:     org_jocl_blast_CLBlast
+ * Method:    getTuningParametersNative
+ * Signature: (Lorg/jocl/cl_device_id;Ljava/lang/String;I)[Ljava/lang/Object;
+ */
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_getTuningParametersNative
+  (JNIEnv *, jclass, jobject, jstring, jint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,189 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlastAsync.hpp"
+#include "JOCLBlastRoutines.hpp"
+#include "JOCLBlastUtils.hpp"
+
+#include <mutex>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+
+// The global reference to the CLBlastAsync class, and the ID of its
+// static method that completes a future. They are obtained on the first
+// call of setCompletionCallbackNative, because the native callback
+// threads can not look up the class with the class loader of the library.
+static jclass CLBlastAsync_Class = nullptr;
+static jmethodID CLBlastAsync_completed = nullptr;
+static std::mutex CLBlastAsync_mutex;
+
+/**
+* The attachment of a native thread to the Java VM. The OpenCL
+* implementation executes the event callbacks on its own threads. Such
+* a thread is attached when the first callback is executed on it, and
+* detached when it terminates, because attaching and detaching the
+* thread for each callback would be expensive.
+*/
+class ThreadAttachment
+{
+public:
+    ~ThreadAttachment()
+    {
+        if (attachedEnv != nullptr)
+        {
+            javaVM->DetachCurrentThread();
+        }
+    }
+
+    /**
+    * Returns the JNIEnv for the current thread, attaching the thread to
+    * the Java VM if necessary. Returns nullptr if the thread could not
+    * be attached.
+    */
+    JNIEnv *getEnv()
+    {
+        if (attachedEnv != nullptr)
+        {
+            return attachedEnv;
+        }
+        JNIEnv *env = nullptr;
+        jint result = javaVM->GetEnv((void**)&env, JNI_VERSION_1_4);
+        if (result == JNI_OK)
+        {
+            // The callback is executed on a Java thread, for example,
+            // when the event was already complete in clSetEventCallback
+            return env;
+        }
+        if (result != JNI_EDETACHED)
+        {
+            return nullptr;
+        }
+        if (javaVM->AttachCurrentThreadAsDaemon((void**)&env, nullptr) != JNI_OK)
+        {
+            return nullptr;
+        }
+        attachedEnv = env;
+        return env;
+    }
+
+private:
+    JNIEnv *attachedEnv = nullptr;
+};
+
+static thread_local ThreadAttachment threadAttachment;
+
+/**
+* Obtain the global reference to the given CLBlastAsync class and the
+* ID of its method that completes a future, if this was not done yet.
+* Returns false if a Java exception was thrown.
+*/
+static bool initCompletion(JNIEnv *env, jclass cls)
+{
+    std::lock_guard<std::mutex> lock(CLBlastAsync_mutex);
+    if (CLBlastAsync_completed != nullptr)
+    {
+        return true;
+    }
+    jmethodID completed = env->GetStaticMethodID(cls, "completed", "(Ljava/util/concurrent/CompletableFuture;I)V");
+    if (completed == nullptr)
+    {
+        return false;
+    }
+    CLBlastAsync_Class = (jclass)env->NewGlobalRef(cls);
+    if (CLBlastAsync_Class == nullptr)
+    {
+        return false;
+    }
+    CLBlastAsync_completed = completed;
+    return true;
+}
+
+/**
+* The callback for an event. The user data is a global reference to the
+* future that has to be completed with the execution status of the event.
+* The callback owns this reference, and one reference to the event.
+*/
+static void CL_CALLBACK completionCallback(cl_event event, cl_int status, void *userData)
+{
+    jobject future = (jobject)userData;
+    JNIEnv *env = threadAttachment.getEnv();
+    if (env == nullptr)
+    {
+        // The global reference can not be deleted without a JNIEnv
+        Logger::log(LOG_ERROR, "Could not attach the event callback thread to the Java VM\n");
+    }
+    else
+    {
+        env->CallStaticVoidMethod(CLBlastAsync_Class, CLBlastAsync_completed, future, (jint)status);
+        if (env->ExceptionCheck())
+        {
+            Logger::log(LOG_ERROR, "An exception was thrown while completing a future in an event callback\n");
+            env->ExceptionDescribe();
+            env->ExceptionClear();
+        }
+        env->DeleteGlobalRef(future);
+    }
+    clReleaseEvent(event);
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastAsync
+* Method:    setCompletionCallbackNative
+* Signature: (JLjava/util/concurrent/CompletableFuture;)I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastAsync_setCompletionCallbackNative
+(JNIEnv *env, jclass cls, jlong event, jobject future)
+{
+    if (!initCompletion(env, cls))
+    {
+        return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    }
+    cl_event event_native = (cl_event)event;
+    jobject future_global = env->NewGlobalRef(future);
+    if (future_global == nullptr)
+    {
+        return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    }
+
+    // The event is retained until the callback was executed, so that
+    // the caller may release it at any time
+    cl_int result = clRetainEvent(event_native);
+    if (result != CL_SUCCESS)
+    {
+        env->DeleteGlobalRef(future_global);
+        return result;
+    }
+    result = clSetEventCallback(event_native, CL_COMPLETE, &completionCallback, future_global);
+    if (result != CL_SUCCESS)
+    {
+        clReleaseEvent(event_native);
+        env->DeleteGlobalRef(future_global);
+    }
+    return result;
+}
@@ -0,0 +1,620 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlastBatched.hpp"
+
+#include <vector>
+
+/**
+* The shape of a GEMM that is equivalent to a GEMV
+*/
+struct GemmShape
+{
+    size_t m;
+    size_t n;
+    size_t k;
+    size_t b_ld;
+    size_t c_ld;
+};
+
+/**
+* Computes the shape of the GEMM with n=1 that is equivalent to a GEMV
+* with the given parameters, where x is the B matrix and y is the C
+* matrix. For row-major matrices, the increments are the leading
+* dimensions of B and C. For column-major matrices, this is only
+* possible when the increments are 1.
+*
+* Returns whether the GEMV can be mapped onto a GEMM.
+*/
+static bool gemvAsGemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose,
+    const size_t m, const size_t n, const size_t x_inc, const size_t y_inc, GemmShape &shape)
+{
+    if (x_inc == 0 || y_inc == 0)
+    {
+        return false;
+    }
+    shape.m = (a_transpose == CLBlastTransposeNo) ? m : n;
+    shape.n = 1;
+    shape.k = (a_transpose == CLBlastTransposeNo) ? n : m;
+    if (layout == CLBlastLayoutRowMajor)
+    {
+        shape.b_ld = x_inc;
+        shape.c_ld = y_inc;
+        return true;
+    }
+    if (x_inc == 1 && y_inc == 1)
+    {
+        shape.b_ld = shape.k;
+        shape.c_ld = shape.m;
+        return true;
+    }
+    return false;
+}
+
+CLBlastStatusCode batchedSgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const float * alphas, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const float * betas, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    GemmShape shape;
+    if (gemvAsGemm(layout, a_transpose, m, n, x_inc, y_inc, shape))
+    {
+        return CLBlastSgemmBatched(layout, a_transpose, CLBlastTransposeNo, shape.m, shape.n, shape.k, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, shape.b_ld, betas, y_buffer, y_offsets, shape.c_ld, batch_count, queue, event);
+    }
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastSgemv(layout, a_transpose, m, n, alphas[i], a_buffer, a_offsets[i], a_ld, x_buffer, x_offsets[i], x_inc, betas[i], y_buffer, y_offsets[i], y_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedDgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const double * alphas, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const double * betas, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    GemmShape shape;
+    if (gemvAsGemm(layout, a_transpose, m, n, x_inc, y_inc, shape))
+    {
+        return CLBlastDgemmBatched(layout, a_transpose, CLBlastTransposeNo, shape.m, shape.n, shape.k, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, shape.b_ld, betas, y_buffer, y_offsets, shape.c_ld, batch_count, queue, event);
+    }
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastDgemv(layout, a_transpose, m, n, alphas[i], a_buffer, a_offsets[i], a_ld, x_buffer, x_offsets[i], x_inc, betas[i], y_buffer, y_offsets[i], y_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedCgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_float2 * alphas, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_float2 * betas, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    GemmShape shape;
+    if (gemvAsGemm(layout, a_transpose, m, n, x_inc, y_inc, shape))
+    {
+        return CLBlastCgemmBatched(layout, a_transpose, CLBlastTransposeNo, shape.m, shape.n, shape.k, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, shape.b_ld, betas, y_buffer, y_offsets, shape.c_ld, batch_count, queue, event);
+    }
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastCgemv(layout, a_transpose, m, n, alphas[i], a_buffer, a_offsets[i], a_ld, x_buffer, x_offsets[i], x_inc, betas[i], y_buffer, y_offsets[i], y_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedZgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_double2 * alphas, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_double2 * betas, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    GemmShape shape;
+    if (gemvAsGemm(layout, a_transpose, m, n, x_inc, y_inc, shape))
+    {
+        return CLBlastZgemmBatched(layout, a_transpose, CLBlastTransposeNo, shape.m, shape.n, shape.k, alphas, a_buffer, a_offsets, a_ld, x_buffer, x_offsets, shape.b_ld, betas, y_buffer, y_offsets, shape.c_ld, batch_count, queue, event);
+    }
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastZgemv(layout, a_transpose, m, n, alphas[i], a_buffer, a_offsets[i], a_ld, x_buffer, x_offsets[i], x_inc, betas[i], y_buffer, y_offsets[i], y_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedSgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const float beta, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    GemmShape shape;
+    if (gemvAsGemm(layout, a_transpose, m, n, x_inc, y_inc, shape))
+    {
+        return CLBlastSgemmStridedBatched(layout, a_transpose, CLBlastTransposeNo, shape.m, shape.n, shape.k, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, shape.b_ld, x_stride, beta, y_buffer, y_offset, shape.c_ld, y_stride, batch_count, queue, event);
+    }
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastSgemv(layout, a_transpose, m, n, alpha, a_buffer, a_offset + i * a_stride, a_ld, x_buffer, x_offset + i * x_stride, x_inc, beta, y_buffer, y_offset + i * y_stride, y_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedDgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const double beta, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    GemmShape shape;
+    if (gemvAsGemm(layout, a_transpose, m, n, x_inc, y_inc, shape))
+    {
+        return CLBlastDgemmStridedBatched(layout, a_transpose, CLBlastTransposeNo, shape.m, shape.n, shape.k, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, shape.b_ld, x_stride, beta, y_buffer, y_offset, shape.c_ld, y_stride, batch_count, queue, event);
+    }
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastDgemv(layout, a_transpose, m, n, alpha, a_buffer, a_offset + i * a_stride, a_ld, x_buffer, x_offset + i * x_stride, x_inc, beta, y_buffer, y_offset + i * y_stride, y_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedCgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_float2 beta, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    GemmShape shape;
+    if (gemvAsGemm(layout, a_transpose, m, n, x_inc, y_inc, shape))
+    {
+        return CLBlastCgemmStridedBatched(layout, a_transpose, CLBlastTransposeNo, shape.m, shape.n, shape.k, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, shape.b_ld, x_stride, beta, y_buffer, y_offset, shape.c_ld, y_stride, batch_count, queue, event);
+    }
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastCgemv(layout, a_transpose, m, n, alpha, a_buffer, a_offset + i * a_stride, a_ld, x_buffer, x_offset + i * x_stride, x_inc, beta, y_buffer, y_offset + i * y_stride, y_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedZgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_double2 beta, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    GemmShape shape;
+    if (gemvAsGemm(layout, a_transpose, m, n, x_inc, y_inc, shape))
+    {
+        return CLBlastZgemmStridedBatched(layout, a_transpose, CLBlastTransposeNo, shape.m, shape.n, shape.k, alpha, a_buffer, a_offset, a_ld, a_stride, x_buffer, x_offset, shape.b_ld, x_stride, beta, y_buffer, y_offset, shape.c_ld, y_stride, batch_count, queue, event);
+    }
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastZgemv(layout, a_transpose, m, n, alpha, a_buffer, a_offset + i * a_stride, a_ld, x_buffer, x_offset + i * x_stride, x_inc, beta, y_buffer, y_offset + i * y_stride, y_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedStrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastStrsv(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets[i], a_ld, x_buffer, x_offsets[i], x_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedDtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastDtrsv(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets[i], a_ld, x_buffer, x_offsets[i], x_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedCtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastCtrsv(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets[i], a_ld, x_buffer, x_offsets[i], x_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedZtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastZtrsv(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offsets[i], a_ld, x_buffer, x_offsets[i], x_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedStrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastStrsv(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset + i * a_stride, a_ld, x_buffer, x_offset + i * x_stride, x_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedDtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastDtrsv(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset + i * a_stride, a_ld, x_buffer, x_offset + i * x_stride, x_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedCtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastCtrsv(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset + i * a_stride, a_ld, x_buffer, x_offset + i * x_stride, x_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedZtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastZtrsv(layout, triangle, a_transpose, diagonal, n, a_buffer, a_offset + i * a_stride, a_ld, x_buffer, x_offset + i * x_stride, x_inc, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedSger(const CLBlastLayout layout, const size_t m, const size_t n, const float * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastSger(layout, m, n, alphas[i], x_buffer, x_offsets[i], x_inc, y_buffer, y_offsets[i], y_inc, a_buffer, a_offsets[i], a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedDger(const CLBlastLayout layout, const size_t m, const size_t n, const double * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastDger(layout, m, n, alphas[i], x_buffer, x_offsets[i], x_inc, y_buffer, y_offsets[i], y_inc, a_buffer, a_offsets[i], a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedSger(const CLBlastLayout layout, const size_t m, const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastSger(layout, m, n, alpha, x_buffer, x_offset + i * x_stride, x_inc, y_buffer, y_offset + i * y_stride, y_inc, a_buffer, a_offset + i * a_stride, a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedDger(const CLBlastLayout layout, const size_t m, const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastDger(layout, m, n, alpha, x_buffer, x_offset + i * x_stride, x_inc, y_buffer, y_offset + i * y_stride, y_inc, a_buffer, a_offset + i * a_stride, a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedCgeru(const CLBlastLayout layout, const size_t m, const size_t n, const cl_float2 * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastCgeru(layout, m, n, alphas[i], x_buffer, x_offsets[i], x_inc, y_buffer, y_offsets[i], y_inc, a_buffer, a_offsets[i], a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedZgeru(const CLBlastLayout layout, const size_t m, const size_t n, const cl_double2 * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastZgeru(layout, m, n, alphas[i], x_buffer, x_offsets[i], x_inc, y_buffer, y_offsets[i], y_inc, a_buffer, a_offsets[i], a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedCgeru(const CLBlastLayout layout, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastCgeru(layout, m, n, alpha, x_buffer, x_offset + i * x_stride, x_inc, y_buffer, y_offset + i * y_stride, y_inc, a_buffer, a_offset + i * a_stride, a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedZgeru(const CLBlastLayout layout, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastZgeru(layout, m, n, alpha, x_buffer, x_offset + i * x_stride, x_inc, y_buffer, y_offset + i * y_stride, y_inc, a_buffer, a_offset + i * a_stride, a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedCgerc(const CLBlastLayout layout, const size_t m, const size_t n, const cl_float2 * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastCgerc(layout, m, n, alphas[i], x_buffer, x_offsets[i], x_inc, y_buffer, y_offsets[i], y_inc, a_buffer, a_offsets[i], a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode batchedZgerc(const CLBlastLayout layout, const size_t m, const size_t n, const cl_double2 * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastZgerc(layout, m, n, alphas[i], x_buffer, x_offsets[i], x_inc, y_buffer, y_offsets[i], y_inc, a_buffer, a_offsets[i], a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedCgerc(const CLBlastLayout layout, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastCgerc(layout, m, n, alpha, x_buffer, x_offset + i * x_stride, x_inc, y_buffer, y_offset + i * y_stride, y_inc, a_buffer, a_offset + i * a_stride, a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
+
+CLBlastStatusCode stridedBatchedZgerc(const CLBlastLayout layout, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event)
+{
+    if (batch_count == 0)
+    {
+        return CLBlastInvalidBatchCount;
+    }
+    BatchEvents batchEvents(batch_count, event);
+    for (size_t i = 0; i < batch_count; i++)
+    {
+        CLBlastStatusCode status = CLBlastZgerc(layout, m, n, alpha, x_buffer, x_offset + i * x_stride, x_inc, y_buffer, y_offset + i * y_stride, y_inc, a_buffer, a_offset + i * a_stride, a_ld, queue, batchEvents.get(i));
+        if (status != CLBlastSuccess)
+        {
+            return status;
+        }
+    }
+    return batchEvents.finish(queue);
+}
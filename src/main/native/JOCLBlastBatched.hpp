@@ -0,0 +1,149 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef JOCL_BLAST_BATCHED_HPP
+#define JOCL_BLAST_BATCHED_HPP
+
+#include <CL/cl.h>
+#include <clblast_c.h>
+
+#include <vector>
+
+/**
+* The events of the individual calls of a batch that is executed as a
+* loop, or of the commands of a command list. When the caller requested an event, each call receives its own
+* event, and the event of the caller is a marker that waits for all of
+* them. This way, the event of the caller is only complete when all
+* calls are complete, also on an out-of-order queue. The events of the
+* individual calls are released when this object is destroyed.
+*/
+class BatchEvents
+{
+public:
+    BatchEvents(const size_t batch_count, cl_event *event) : event(event)
+    {
+        if (event != nullptr)
+        {
+            events.resize(batch_count, nullptr);
+        }
+    }
+
+    ~BatchEvents()
+    {
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            if (events[i] != nullptr) clReleaseEvent(events[i]);
+        }
+    }
+
+    /**
+    * Returns the event that should be passed to the call for the given
+    * batch entry
+    */
+    cl_event *get(const size_t i)
+    {
+        return (event == nullptr) ? nullptr : &events[i];
+    }
+
+    /**
+    * Enqueue the marker that waits for the events of all calls, and
+    * store it as the event of the caller
+    */
+    CLBlastStatusCode finish(cl_command_queue *queue)
+    {
+        if (event == nullptr)
+        {
+            return CLBlastSuccess;
+        }
+        return (CLBlastStatusCode)clEnqueueMarkerWithWaitList(*queue, (cl_uint)events.size(), events.data(), event);
+    }
+
+private:
+    BatchEvents(const BatchEvents&);
+    BatchEvents& operator=(const BatchEvents&);
+
+    cl_event *event;
+    std::vector<cl_event> events;
+};
+
+/**
+* Batched and strided-batched versions of level-2 routines, for which
+* CLBlast itself does not offer batched kernels.
+*
+* The batched versions receive one offset (and one scalar) for each
+* batch entry, like CLBlastXgemmBatched. The strided-batched versions
+* receive a single offset and a stride, like CLBlastXgemmStridedBatched.
+*
+* The GEMV variants are mapped onto the batched GEMM with n=1 when this
+* is equivalent: For row-major matrices, and for column-major matrices
+* with unit increments. All other calls are executed as a loop over the
+* individual routines, inside a single native call. In this case, the
+* event (if it is not nullptr) is a marker that waits for the events of
+* all calls, so that it is also valid on an out-of-order queue.
+*
+* Returns CLBlastInvalidBatchCount if the batch count is 0, or the
+* status of the first call that failed.
+*/
+CLBlastStatusCode batchedSgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const float * alphas, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const float * betas, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode batchedDgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const double * alphas, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const double * betas, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode batchedCgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_float2 * alphas, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_float2 * betas, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode batchedZgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_double2 * alphas, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_double2 * betas, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+
+CLBlastStatusCode stridedBatchedSgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const float beta, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode stridedBatchedDgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const double beta, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode stridedBatchedCgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_float2 beta, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode stridedBatchedZgemv(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_double2 beta, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+
+CLBlastStatusCode batchedStrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode batchedDtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode batchedCtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode batchedZtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+
+CLBlastStatusCode stridedBatchedStrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode stridedBatchedDtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode stridedBatchedCtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode stridedBatchedZtrsv(const CLBlastLayout layout, const CLBlastTriangle triangle, const CLBlastTranspose a_transpose, const CLBlastDiagonal diagonal, const size_t n, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+
+CLBlastStatusCode batchedSger(const CLBlastLayout layout, const size_t m, const size_t n, const float * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode batchedDger(const CLBlastLayout layout, const size_t m, const size_t n, const double * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+
+CLBlastStatusCode stridedBatchedSger(const CLBlastLayout layout, const size_t m, const size_t n, const float alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode stridedBatchedDger(const CLBlastLayout layout, const size_t m, const size_t n, const double alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+
+CLBlastStatusCode batchedCgeru(const CLBlastLayout layout, const size_t m, const size_t n, const cl_float2 * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode batchedZgeru(const CLBlastLayout layout, const size_t m, const size_t n, const cl_double2 * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+
+CLBlastStatusCode stridedBatchedCgeru(const CLBlastLayout layout, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode stridedBatchedZgeru(const CLBlastLayout layout, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+
+CLBlastStatusCode batchedCgerc(const CLBlastLayout layout, const size_t m, const size_t n, const cl_float2 * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode batchedZgerc(const CLBlastLayout layout, const size_t m, const size_t n, const cl_double2 * alphas, const cl_mem x_buffer, const size_t * x_offsets, const size_t x_inc, const cl_mem y_buffer, const size_t * y_offsets, const size_t y_inc, const cl_mem a_buffer, const size_t * a_offsets, const size_t a_ld, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+
+CLBlastStatusCode stridedBatchedCgerc(const CLBlastLayout layout, const size_t m, const size_t n, const cl_float2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode stridedBatchedZgerc(const CLBlastLayout layout, const size_t m, const size_t n, const cl_double2 alpha, const cl_mem x_buffer, const size_t x_offset, const size_t x_inc, const size_t x_stride, const cl_mem y_buffer, const size_t y_offset, const size_t y_inc, const size_t y_stride, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const size_t a_stride, const size_t batch_count, cl_command_queue * queue, cl_event * event);
+
+#endif
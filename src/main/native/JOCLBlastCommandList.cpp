@@ -0,0 +1,1670 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlastCommandList.hpp"
+
+#include <initializer_list>
+#include <vector>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+#include "CLJNIUtils.hpp"
+#include "ConversionsCL.hpp"
+#include "JOCLBlastBatched.hpp"
+#include "JOCLBlastKernelCache.hpp"
+#include "JOCLBlastUtils.hpp"
+#include <clblast_c.h>
+#include <clblast_half.h>
+
+// The records of a command list are stored in a direct buffer that is
+// filled on Java side. Each record consists of
+//
+//   jlong command    : The command identifier
+//   jlong size       : The size of the record, in bytes, including the header
+//   jlong slots[...] : One slot for each argument (two for complex scalars)
+//   arrays...        : The contents of the array arguments
+//
+// Integral arguments are stored as jlong values. Floating point values
+// are stored at the start of their slot. Memory objects are stored as
+// indices into the array of cl_mem objects that is passed to the
+// execution. Array arguments are stored as the byte offset of the array,
+// relative to the first slot. At this offset, the number of elements is
+// stored as a jlong, followed by the elements.
+
+static float slot_float(const jlong *slot)
+{
+    return *(const float*)slot;
+}
+
+static double slot_double(const jlong *slot)
+{
+    return *(const double*)slot;
+}
+
+static cl_float2 slot_float2(const jlong *slot)
+{
+    cl_float2 result;
+    result.s[0] = slot_float(slot + 0);
+    result.s[1] = slot_float(slot + 1);
+    return result;
+}
+
+static cl_double2 slot_double2(const jlong *slot)
+{
+    cl_double2 result;
+    result.s[0] = slot_double(slot + 0);
+    result.s[1] = slot_double(slot + 1);
+    return result;
+}
+
+/**
+* Returns a pointer to the elements of the array that the given slot
+* refers to
+*/
+static const void* slot_array(const jlong *slot)
+{
+    const char *array = (const char*)slot + (size_t)slot[0];
+    return array + sizeof(jlong);
+}
+
+/**
+* Returns the number of elements of the array that the given slot
+* refers to
+*/
+static size_t slot_array_length(const jlong *slot)
+{
+    const char *array = (const char*)slot + (size_t)slot[0];
+    return (size_t)(*(const jlong*)array);
+}
+
+/**
+* Converts the float array that the given slot refers to into the given
+* vector of half values, and returns a pointer to the vector data
+*/
+static const cl_half* slot_half_array(const jlong *slot, std::vector<cl_half> &halfs)
+{
+    const float *floats = (const float*)slot_array(slot);
+    size_t length = slot_array_length(slot);
+    halfs.resize(length);
+    for (size_t i = 0; i < length; i++)
+    {
+        halfs[i] = FloatToHalf(floats[i]);
+    }
+    return halfs.data();
+}
+
+/**
+* Returns a pointer to the size_t values of the long array that the given
+* slot refers to. If size_t does not have the same size as jlong, then
+* the values are converted into the given vector.
+*/
+static const size_t* slot_size_t_array(const jlong *slot, std::vector<size_t> &sizes)
+{
+    const jlong *longs = (const jlong*)slot_array(slot);
+    if (sizeof(size_t) == sizeof(jlong))
+    {
+        return (const size_t*)longs;
+    }
+    size_t length = slot_array_length(slot);
+    sizes.resize(length);
+    for (size_t i = 0; i < length; i++)
+    {
+        sizes[i] = (size_t)longs[i];
+    }
+    return sizes.data();
+}
+
+/**
+* Returns whether all slots with the given indices refer to a valid index
+* in the given array of memory objects. If this is not the case, then an
+* error is logged and false is returned.
+*/
+static bool slot_mems_valid(const jlong *a, const std::vector<cl_mem> &mems, std::initializer_list<size_t> slots)
+{
+    for (size_t slot : slots)
+    {
+        if (a[slot] < 0 || (size_t)a[slot] >= mems.size())
+        {
+            Logger::log(LOG_ERROR, "Invalid memory object index in CLBlastCommandList: %ld\n", (long)a[slot]);
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+* Returns the name of the CLBlast routine that is called for the command
+* with the given identifier, or nullptr if the identifier is not known
+*/
+static const char* commandRoutineName(jlong command)
+{
+    switch (command)
+    {
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SROTG: return "CLBlastSrotg";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DROTG: return "CLBlastDrotg";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SROTMG: return "CLBlastSrotmg";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DROTMG: return "CLBlastDrotmg";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SROT: return "CLBlastSrot";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DROT: return "CLBlastDrot";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SROTM: return "CLBlastSrotm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DROTM: return "CLBlastDrotm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSWAP: return "CLBlastSswap";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSWAP: return "CLBlastDswap";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CSWAP: return "CLBlastCswap";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZSWAP: return "CLBlastZswap";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSWAP: return "CLBlastHswap";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSCAL: return "CLBlastSscal";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSCAL: return "CLBlastDscal";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CSCAL: return "CLBlastCscal";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZSCAL: return "CLBlastZscal";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSCAL: return "CLBlastHscal";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCOPY: return "CLBlastScopy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DCOPY: return "CLBlastDcopy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CCOPY: return "CLBlastCcopy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZCOPY: return "CLBlastZcopy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HCOPY: return "CLBlastHcopy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SAXPY: return "CLBlastSaxpy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DAXPY: return "CLBlastDaxpy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CAXPY: return "CLBlastCaxpy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZAXPY: return "CLBlastZaxpy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HAXPY: return "CLBlastHaxpy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SDOT: return "CLBlastSdot";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DDOT: return "CLBlastDdot";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HDOT: return "CLBlastHdot";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CDOTU: return "CLBlastCdotu";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZDOTU: return "CLBlastZdotu";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CDOTC: return "CLBlastCdotc";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZDOTC: return "CLBlastZdotc";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SNRM2: return "CLBlastSnrm2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DNRM2: return "CLBlastDnrm2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCNRM2: return "CLBlastScnrm2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DZNRM2: return "CLBlastDznrm2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HNRM2: return "CLBlastHnrm2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SASUM: return "CLBlastSasum";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DASUM: return "CLBlastDasum";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCASUM: return "CLBlastScasum";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DZASUM: return "CLBlastDzasum";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HASUM: return "CLBlastHasum";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSUM: return "CLBlastSsum";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSUM: return "CLBlastDsum";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCSUM: return "CLBlastScsum";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DZSUM: return "CLBlastDzsum";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSUM: return "CLBlastHsum";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ISAMAX: return "CLBlastiSamax";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IDAMAX: return "CLBlastiDamax";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ICAMAX: return "CLBlastiCamax";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IZAMAX: return "CLBlastiZamax";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IHAMAX: return "CLBlastiHamax";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ISAMIN: return "CLBlastiSamin";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IDAMIN: return "CLBlastiDamin";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ICAMIN: return "CLBlastiCamin";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IZAMIN: return "CLBlastiZamin";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IHAMIN: return "CLBlastiHamin";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ISMAX: return "CLBlastiSmax";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IDMAX: return "CLBlastiDmax";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ICMAX: return "CLBlastiCmax";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IZMAX: return "CLBlastiZmax";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IHMAX: return "CLBlastiHmax";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ISMIN: return "CLBlastiSmin";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IDMIN: return "CLBlastiDmin";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ICMIN: return "CLBlastiCmin";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IZMIN: return "CLBlastiZmin";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IHMIN: return "CLBlastiHmin";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGEMV: return "CLBlastSgemv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGEMV: return "CLBlastDgemv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGEMV: return "CLBlastCgemv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMV: return "CLBlastZgemv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGEMV: return "CLBlastHgemv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGBMV: return "CLBlastSgbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGBMV: return "CLBlastDgbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGBMV: return "CLBlastCgbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGBMV: return "CLBlastZgbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGBMV: return "CLBlastHgbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHEMV: return "CLBlastChemv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHEMV: return "CLBlastZhemv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHBMV: return "CLBlastChbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHBMV: return "CLBlastZhbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHPMV: return "CLBlastChpmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHPMV: return "CLBlastZhpmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYMV: return "CLBlastSsymv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYMV: return "CLBlastDsymv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYMV: return "CLBlastHsymv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSBMV: return "CLBlastSsbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSBMV: return "CLBlastDsbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSBMV: return "CLBlastHsbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSPMV: return "CLBlastSspmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSPMV: return "CLBlastDspmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSPMV: return "CLBlastHspmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STRMV: return "CLBlastStrmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTRMV: return "CLBlastDtrmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTRMV: return "CLBlastCtrmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTRMV: return "CLBlastZtrmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HTRMV: return "CLBlastHtrmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STBMV: return "CLBlastStbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTBMV: return "CLBlastDtbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTBMV: return "CLBlastCtbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTBMV: return "CLBlastZtbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HTBMV: return "CLBlastHtbmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STPMV: return "CLBlastStpmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTPMV: return "CLBlastDtpmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTPMV: return "CLBlastCtpmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTPMV: return "CLBlastZtpmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HTPMV: return "CLBlastHtpmv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STRSV: return "CLBlastStrsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTRSV: return "CLBlastDtrsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTRSV: return "CLBlastCtrsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTRSV: return "CLBlastZtrsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STBSV: return "CLBlastStbsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTBSV: return "CLBlastDtbsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTBSV: return "CLBlastCtbsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTBSV: return "CLBlastZtbsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STPSV: return "CLBlastStpsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTPSV: return "CLBlastDtpsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTPSV: return "CLBlastCtpsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTPSV: return "CLBlastZtpsv";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGER: return "CLBlastSger";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGER: return "CLBlastDger";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGER: return "CLBlastHger";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGERU: return "CLBlastCgeru";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGERU: return "CLBlastZgeru";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGERC: return "CLBlastCgerc";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGERC: return "CLBlastZgerc";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHER: return "CLBlastCher";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHER: return "CLBlastZher";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHPR: return "CLBlastChpr";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHPR: return "CLBlastZhpr";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHER2: return "CLBlastCher2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHER2: return "CLBlastZher2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHPR2: return "CLBlastChpr2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHPR2: return "CLBlastZhpr2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYR: return "CLBlastSsyr";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYR: return "CLBlastDsyr";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYR: return "CLBlastHsyr";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSPR: return "CLBlastSspr";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSPR: return "CLBlastDspr";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSPR: return "CLBlastHspr";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYR2: return "CLBlastSsyr2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYR2: return "CLBlastDsyr2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYR2: return "CLBlastHsyr2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSPR2: return "CLBlastSspr2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSPR2: return "CLBlastDspr2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSPR2: return "CLBlastHspr2";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGEMM: return "CLBlastSgemm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGEMM: return "CLBlastDgemm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGEMM: return "CLBlastCgemm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMM: return "CLBlastZgemm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGEMM: return "CLBlastHgemm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYMM: return "CLBlastSsymm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYMM: return "CLBlastDsymm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CSYMM: return "CLBlastCsymm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZSYMM: return "CLBlastZsymm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYMM: return "CLBlastHsymm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHEMM: return "CLBlastChemm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHEMM: return "CLBlastZhemm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYRK: return "CLBlastSsyrk";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYRK: return "CLBlastDsyrk";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CSYRK: return "CLBlastCsyrk";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZSYRK: return "CLBlastZsyrk";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYRK: return "CLBlastHsyrk";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHERK: return "CLBlastCherk";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHERK: return "CLBlastZherk";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYR2K: return "CLBlastSsyr2k";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYR2K: return "CLBlastDsyr2k";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CSYR2K: return "CLBlastCsyr2k";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZSYR2K: return "CLBlastZsyr2k";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYR2K: return "CLBlastHsyr2k";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHER2K: return "CLBlastCher2k";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHER2K: return "CLBlastZher2k";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STRMM: return "CLBlastStrmm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTRMM: return "CLBlastDtrmm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTRMM: return "CLBlastCtrmm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTRMM: return "CLBlastZtrmm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HTRMM: return "CLBlastHtrmm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STRSM: return "CLBlastStrsm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTRSM: return "CLBlastDtrsm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTRSM: return "CLBlastCtrsm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTRSM: return "CLBlastZtrsm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SHAD: return "CLBlastShad";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DHAD: return "CLBlastDhad";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHAD: return "CLBlastChad";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHAD: return "CLBlastZhad";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HHAD: return "CLBlastHhad";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SOMATCOPY: return "CLBlastSomatcopy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DOMATCOPY: return "CLBlastDomatcopy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_COMATCOPY: return "CLBlastComatcopy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZOMATCOPY: return "CLBlastZomatcopy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HOMATCOPY: return "CLBlastHomatcopy";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SIM2COL: return "CLBlastSim2col";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DIM2COL: return "CLBlastDim2col";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CIM2COL: return "CLBlastCim2col";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZIM2COL: return "CLBlastZim2col";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HIM2COL: return "CLBlastHim2col";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCOL2IM: return "CLBlastScol2im";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DCOL2IM: return "CLBlastDcol2im";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CCOL2IM: return "CLBlastCcol2im";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZCOL2IM: return "CLBlastZcol2im";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HCOL2IM: return "CLBlastHcol2im";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCONVGEMM: return "CLBlastSconvgemm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DCONVGEMM: return "CLBlastDconvgemm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HCONVGEMM: return "CLBlastHconvgemm";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SAXPYBATCHED: return "CLBlastSaxpyBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DAXPYBATCHED: return "CLBlastDaxpyBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CAXPYBATCHED: return "CLBlastCaxpyBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZAXPYBATCHED: return "CLBlastZaxpyBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HAXPYBATCHED: return "CLBlastHaxpyBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMBATCHED: return "CLBlastSgemmBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMBATCHED: return "CLBlastDgemmBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMBATCHED: return "CLBlastCgemmBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMBATCHED: return "CLBlastZgemmBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMBATCHED: return "CLBlastHgemmBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMSTRIDEDBATCHED: return "CLBlastSgemmStridedBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMSTRIDEDBATCHED: return "CLBlastDgemmStridedBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMSTRIDEDBATCHED: return "CLBlastCgemmStridedBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMSTRIDEDBATCHED: return "CLBlastZgemmStridedBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMSTRIDEDBATCHED: return "CLBlastHgemmStridedBatched";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMWITHTEMPBUFFER: return "CLBlastSgemmWithTempBuffer";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMWITHTEMPBUFFER: return "CLBlastDgemmWithTempBuffer";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMWITHTEMPBUFFER: return "CLBlastCgemmWithTempBuffer";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMWITHTEMPBUFFER: return "CLBlastZgemmWithTempBuffer";
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMWITHTEMPBUFFER: return "CLBlastHgemmWithTempBuffer";
+    }
+    return nullptr;
+}
+
+/**
+* Execute the command with the given identifier, with the arguments
+* from the given slots
+*/
+static CLBlastStatusCode executeCommand(jlong command, const jlong *a, const std::vector<cl_mem> &mems, cl_command_queue *queue, cl_event *event)
+{
+    switch (command)
+    {
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SROTG:
+        {
+            if (!slot_mems_valid(a, mems, { 0, 2, 4, 6 })) return CLBlastInvalidValue;
+            return CLBlastSrotg(mems[(size_t)a[0]], (size_t)a[1], mems[(size_t)a[2]], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DROTG:
+        {
+            if (!slot_mems_valid(a, mems, { 0, 2, 4, 6 })) return CLBlastInvalidValue;
+            return CLBlastDrotg(mems[(size_t)a[0]], (size_t)a[1], mems[(size_t)a[2]], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SROTMG:
+        {
+            if (!slot_mems_valid(a, mems, { 0, 2, 4, 6, 8 })) return CLBlastInvalidValue;
+            return CLBlastSrotmg(mems[(size_t)a[0]], (size_t)a[1], mems[(size_t)a[2]], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DROTMG:
+        {
+            if (!slot_mems_valid(a, mems, { 0, 2, 4, 6, 8 })) return CLBlastInvalidValue;
+            return CLBlastDrotmg(mems[(size_t)a[0]], (size_t)a[1], mems[(size_t)a[2]], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SROT:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastSrot((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], slot_float(a + 7), slot_float(a + 8), queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DROT:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastDrot((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], slot_double(a + 7), slot_double(a + 8), queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SROTM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastSrotm((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DROTM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastDrotm((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSWAP:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastSswap((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSWAP:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastDswap((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CSWAP:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastCswap((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZSWAP:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastZswap((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSWAP:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastHswap((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSCAL:
+        {
+            if (!slot_mems_valid(a, mems, { 2 })) return CLBlastInvalidValue;
+            return CLBlastSscal((size_t)a[0], slot_float(a + 1), mems[(size_t)a[2]], (size_t)a[3], (size_t)a[4], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSCAL:
+        {
+            if (!slot_mems_valid(a, mems, { 2 })) return CLBlastInvalidValue;
+            return CLBlastDscal((size_t)a[0], slot_double(a + 1), mems[(size_t)a[2]], (size_t)a[3], (size_t)a[4], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CSCAL:
+        {
+            if (!slot_mems_valid(a, mems, { 3 })) return CLBlastInvalidValue;
+            return CLBlastCscal((size_t)a[0], slot_float2(a + 1), mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZSCAL:
+        {
+            if (!slot_mems_valid(a, mems, { 3 })) return CLBlastInvalidValue;
+            return CLBlastZscal((size_t)a[0], slot_double2(a + 1), mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSCAL:
+        {
+            if (!slot_mems_valid(a, mems, { 2 })) return CLBlastInvalidValue;
+            return CLBlastHscal((size_t)a[0], FloatToHalf(slot_float(a + 1)), mems[(size_t)a[2]], (size_t)a[3], (size_t)a[4], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCOPY:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastScopy((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DCOPY:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastDcopy((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CCOPY:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastCcopy((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZCOPY:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastZcopy((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HCOPY:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 4 })) return CLBlastInvalidValue;
+            return CLBlastHcopy((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], (size_t)a[3], mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SAXPY:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5 })) return CLBlastInvalidValue;
+            return CLBlastSaxpy((size_t)a[0], slot_float(a + 1), mems[(size_t)a[2]], (size_t)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DAXPY:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5 })) return CLBlastInvalidValue;
+            return CLBlastDaxpy((size_t)a[0], slot_double(a + 1), mems[(size_t)a[2]], (size_t)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CAXPY:
+        {
+            if (!slot_mems_valid(a, mems, { 3, 6 })) return CLBlastInvalidValue;
+            return CLBlastCaxpy((size_t)a[0], slot_float2(a + 1), mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZAXPY:
+        {
+            if (!slot_mems_valid(a, mems, { 3, 6 })) return CLBlastInvalidValue;
+            return CLBlastZaxpy((size_t)a[0], slot_double2(a + 1), mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HAXPY:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5 })) return CLBlastInvalidValue;
+            return CLBlastHaxpy((size_t)a[0], FloatToHalf(slot_float(a + 1)), mems[(size_t)a[2]], (size_t)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SDOT:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3, 6 })) return CLBlastInvalidValue;
+            return CLBlastSdot((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DDOT:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3, 6 })) return CLBlastInvalidValue;
+            return CLBlastDdot((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HDOT:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3, 6 })) return CLBlastInvalidValue;
+            return CLBlastHdot((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CDOTU:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3, 6 })) return CLBlastInvalidValue;
+            return CLBlastCdotu((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZDOTU:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3, 6 })) return CLBlastInvalidValue;
+            return CLBlastZdotu((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CDOTC:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3, 6 })) return CLBlastInvalidValue;
+            return CLBlastCdotc((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZDOTC:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3, 6 })) return CLBlastInvalidValue;
+            return CLBlastZdotc((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SNRM2:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastSnrm2((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DNRM2:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastDnrm2((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCNRM2:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastScnrm2((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DZNRM2:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastDznrm2((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HNRM2:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastHnrm2((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SASUM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastSasum((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DASUM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastDasum((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCASUM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastScasum((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DZASUM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastDzasum((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HASUM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastHasum((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSUM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastSsum((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSUM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastDsum((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCSUM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastScsum((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DZSUM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastDzsum((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSUM:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastHsum((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ISAMAX:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiSamax((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IDAMAX:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiDamax((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ICAMAX:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiCamax((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IZAMAX:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiZamax((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IHAMAX:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiHamax((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ISAMIN:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiSamin((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IDAMIN:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiDamin((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ICAMIN:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiCamin((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IZAMIN:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiZamin((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IHAMIN:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiHamin((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ISMAX:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiSmax((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IDMAX:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiDmax((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ICMAX:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiCmax((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IZMAX:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiZmax((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IHMAX:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiHmax((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ISMIN:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiSmin((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IDMIN:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiDmin((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ICMIN:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiCmin((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IZMIN:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiZmin((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_IHMIN:
+        {
+            if (!slot_mems_valid(a, mems, { 1, 3 })) return CLBlastInvalidValue;
+            return CLBlastiHmin((size_t)a[0], mems[(size_t)a[1]], (size_t)a[2], mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGEMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 12 })) return CLBlastInvalidValue;
+            return CLBlastSgemv((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], slot_float(a + 4), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], slot_float(a + 11), mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGEMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 12 })) return CLBlastInvalidValue;
+            return CLBlastDgemv((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], slot_double(a + 4), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], slot_double(a + 11), mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGEMV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9, 14 })) return CLBlastInvalidValue;
+            return CLBlastCgemv((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], slot_float2(a + 4), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], slot_float2(a + 12), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9, 14 })) return CLBlastInvalidValue;
+            return CLBlastZgemv((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], slot_double2(a + 4), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], slot_double2(a + 12), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGEMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 12 })) return CLBlastInvalidValue;
+            return CLBlastHgemv((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], FloatToHalf(slot_float(a + 4)), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], FloatToHalf(slot_float(a + 11)), mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            return CLBlastSgbmv((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_float(a + 6), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_float(a + 13), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            return CLBlastDgbmv((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_double(a + 6), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_double(a + 13), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11, 16 })) return CLBlastInvalidValue;
+            return CLBlastCgbmv((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_float2(a + 6), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], slot_float2(a + 14), mems[(size_t)a[16]], (size_t)a[17], (size_t)a[18], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11, 16 })) return CLBlastInvalidValue;
+            return CLBlastZgbmv((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_double2(a + 6), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], slot_double2(a + 14), mems[(size_t)a[16]], (size_t)a[17], (size_t)a[18], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            return CLBlastHgbmv((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], FloatToHalf(slot_float(a + 6)), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], FloatToHalf(slot_float(a + 13)), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHEMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 13 })) return CLBlastInvalidValue;
+            return CLBlastChemv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float2(a + 3), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], slot_float2(a + 11), mems[(size_t)a[13]], (size_t)a[14], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHEMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 13 })) return CLBlastInvalidValue;
+            return CLBlastZhemv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double2(a + 3), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], slot_double2(a + 11), mems[(size_t)a[13]], (size_t)a[14], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9, 14 })) return CLBlastInvalidValue;
+            return CLBlastChbmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], (size_t)a[3], slot_float2(a + 4), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], slot_float2(a + 12), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9, 14 })) return CLBlastInvalidValue;
+            return CLBlastZhbmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], (size_t)a[3], slot_double2(a + 4), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], slot_double2(a + 12), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHPMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7, 12 })) return CLBlastInvalidValue;
+            return CLBlastChpmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float2(a + 3), mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], slot_float2(a + 10), mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHPMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7, 12 })) return CLBlastInvalidValue;
+            return CLBlastZhpmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double2(a + 3), mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], slot_double2(a + 10), mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYMV:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 11 })) return CLBlastInvalidValue;
+            return CLBlastSsymv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], slot_float(a + 10), mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYMV:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 11 })) return CLBlastInvalidValue;
+            return CLBlastDsymv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], slot_double(a + 10), mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYMV:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 11 })) return CLBlastInvalidValue;
+            return CLBlastHsymv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], FloatToHalf(slot_float(a + 3)), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], FloatToHalf(slot_float(a + 10)), mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 12 })) return CLBlastInvalidValue;
+            return CLBlastSsbmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], (size_t)a[3], slot_float(a + 4), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], slot_float(a + 11), mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 12 })) return CLBlastInvalidValue;
+            return CLBlastDsbmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], (size_t)a[3], slot_double(a + 4), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], slot_double(a + 11), mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 12 })) return CLBlastInvalidValue;
+            return CLBlastHsbmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], (size_t)a[3], FloatToHalf(slot_float(a + 4)), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], FloatToHalf(slot_float(a + 11)), mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSPMV:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 6, 10 })) return CLBlastInvalidValue;
+            return CLBlastSspmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float(a + 3), mems[(size_t)a[4]], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], slot_float(a + 9), mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSPMV:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 6, 10 })) return CLBlastInvalidValue;
+            return CLBlastDspmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double(a + 3), mems[(size_t)a[4]], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], slot_double(a + 9), mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSPMV:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 6, 10 })) return CLBlastInvalidValue;
+            return CLBlastHspmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], FloatToHalf(slot_float(a + 3)), mems[(size_t)a[4]], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], FloatToHalf(slot_float(a + 9)), mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STRMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastStrmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTRMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastDtrmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTRMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastCtrmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTRMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastZtrmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HTRMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastHtrmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastStbmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastDtbmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastCtbmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastZtbmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HTBMV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastHtbmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STPMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7 })) return CLBlastInvalidValue;
+            return CLBlastStpmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTPMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7 })) return CLBlastInvalidValue;
+            return CLBlastDtpmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTPMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7 })) return CLBlastInvalidValue;
+            return CLBlastCtpmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTPMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7 })) return CLBlastInvalidValue;
+            return CLBlastZtpmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HTPMV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7 })) return CLBlastInvalidValue;
+            return CLBlastHtpmv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STRSV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastStrsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTRSV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastDtrsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTRSV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastCtrsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTRSV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastZtrsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STBSV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastStbsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTBSV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastDtbsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTBSV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastCtbsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTBSV:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastZtbsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STPSV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7 })) return CLBlastInvalidValue;
+            return CLBlastStpsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTPSV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7 })) return CLBlastInvalidValue;
+            return CLBlastDtpsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTPSV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7 })) return CLBlastInvalidValue;
+            return CLBlastCtpsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTPSV:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 7 })) return CLBlastInvalidValue;
+            return CLBlastZtpsv((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (CLBlastDiagonal)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGER:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 10 })) return CLBlastInvalidValue;
+            return CLBlastSger((CLBlastLayout)a[0], (size_t)a[1], (size_t)a[2], slot_float(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGER:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 10 })) return CLBlastInvalidValue;
+            return CLBlastDger((CLBlastLayout)a[0], (size_t)a[1], (size_t)a[2], slot_double(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGER:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 10 })) return CLBlastInvalidValue;
+            return CLBlastHger((CLBlastLayout)a[0], (size_t)a[1], (size_t)a[2], FloatToHalf(slot_float(a + 3)), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGERU:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastCgeru((CLBlastLayout)a[0], (size_t)a[1], (size_t)a[2], slot_float2(a + 3), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGERU:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastZgeru((CLBlastLayout)a[0], (size_t)a[1], (size_t)a[2], slot_double2(a + 3), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGERC:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastCgerc((CLBlastLayout)a[0], (size_t)a[1], (size_t)a[2], slot_float2(a + 3), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGERC:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastZgerc((CLBlastLayout)a[0], (size_t)a[1], (size_t)a[2], slot_double2(a + 3), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHER:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastCher((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHER:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastZher((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHPR:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastChpr((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHPR:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastZhpr((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHER2:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastCher2((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float2(a + 3), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHER2:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastZher2((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double2(a + 3), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHPR2:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastChpr2((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float2(a + 3), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHPR2:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastZhpr2((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double2(a + 3), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYR:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastSsyr((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYR:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastDsyr((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYR:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastHsyr((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], FloatToHalf(slot_float(a + 3)), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSPR:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastSspr((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSPR:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastDspr((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSPR:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7 })) return CLBlastInvalidValue;
+            return CLBlastHspr((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], FloatToHalf(slot_float(a + 3)), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYR2:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 10 })) return CLBlastInvalidValue;
+            return CLBlastSsyr2((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYR2:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 10 })) return CLBlastInvalidValue;
+            return CLBlastDsyr2((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYR2:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 10 })) return CLBlastInvalidValue;
+            return CLBlastHsyr2((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], FloatToHalf(slot_float(a + 3)), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSPR2:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 10 })) return CLBlastInvalidValue;
+            return CLBlastSspr2((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_float(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSPR2:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 10 })) return CLBlastInvalidValue;
+            return CLBlastDspr2((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], slot_double(a + 3), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSPR2:
+        {
+            if (!slot_mems_valid(a, mems, { 4, 7, 10 })) return CLBlastInvalidValue;
+            return CLBlastHspr2((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (size_t)a[2], FloatToHalf(slot_float(a + 3)), mems[(size_t)a[4]], (size_t)a[5], (size_t)a[6], mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGEMM:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            return CLBlastSgemm((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_float(a + 6), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_float(a + 13), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGEMM:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            return CLBlastDgemm((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_double(a + 6), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_double(a + 13), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGEMM:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11, 16 })) return CLBlastInvalidValue;
+            return CLBlastCgemm((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_float2(a + 6), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], slot_float2(a + 14), mems[(size_t)a[16]], (size_t)a[17], (size_t)a[18], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMM:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11, 16 })) return CLBlastInvalidValue;
+            return CLBlastZgemm((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_double2(a + 6), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], slot_double2(a + 14), mems[(size_t)a[16]], (size_t)a[17], (size_t)a[18], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGEMM:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            return CLBlastHgemm((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], FloatToHalf(slot_float(a + 6)), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], FloatToHalf(slot_float(a + 13)), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYMM:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9, 13 })) return CLBlastInvalidValue;
+            return CLBlastSsymm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (size_t)a[3], (size_t)a[4], slot_float(a + 5), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], slot_float(a + 12), mems[(size_t)a[13]], (size_t)a[14], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYMM:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9, 13 })) return CLBlastInvalidValue;
+            return CLBlastDsymm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (size_t)a[3], (size_t)a[4], slot_double(a + 5), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], slot_double(a + 12), mems[(size_t)a[13]], (size_t)a[14], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CSYMM:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 15 })) return CLBlastInvalidValue;
+            return CLBlastCsymm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (size_t)a[3], (size_t)a[4], slot_float2(a + 5), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_float2(a + 13), mems[(size_t)a[15]], (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZSYMM:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 15 })) return CLBlastInvalidValue;
+            return CLBlastZsymm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (size_t)a[3], (size_t)a[4], slot_double2(a + 5), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_double2(a + 13), mems[(size_t)a[15]], (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYMM:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9, 13 })) return CLBlastInvalidValue;
+            return CLBlastHsymm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (size_t)a[3], (size_t)a[4], FloatToHalf(slot_float(a + 5)), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], FloatToHalf(slot_float(a + 12)), mems[(size_t)a[13]], (size_t)a[14], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHEMM:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 15 })) return CLBlastInvalidValue;
+            return CLBlastChemm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (size_t)a[3], (size_t)a[4], slot_float2(a + 5), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_float2(a + 13), mems[(size_t)a[15]], (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHEMM:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 15 })) return CLBlastInvalidValue;
+            return CLBlastZhemm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (size_t)a[3], (size_t)a[4], slot_double2(a + 5), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_double2(a + 13), mems[(size_t)a[15]], (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYRK:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 10 })) return CLBlastInvalidValue;
+            return CLBlastSsyrk((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_float(a + 5), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], slot_float(a + 9), mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYRK:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 10 })) return CLBlastInvalidValue;
+            return CLBlastDsyrk((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_double(a + 5), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], slot_double(a + 9), mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CSYRK:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 12 })) return CLBlastInvalidValue;
+            return CLBlastCsyrk((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_float2(a + 5), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], slot_float2(a + 10), mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZSYRK:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 12 })) return CLBlastInvalidValue;
+            return CLBlastZsyrk((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_double2(a + 5), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], slot_double2(a + 10), mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYRK:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 10 })) return CLBlastInvalidValue;
+            return CLBlastHsyrk((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], FloatToHalf(slot_float(a + 5)), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], FloatToHalf(slot_float(a + 9)), mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHERK:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 10 })) return CLBlastInvalidValue;
+            return CLBlastCherk((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_float(a + 5), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], slot_float(a + 9), mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHERK:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 10 })) return CLBlastInvalidValue;
+            return CLBlastZherk((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_double(a + 5), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], slot_double(a + 9), mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SSYR2K:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9, 13 })) return CLBlastInvalidValue;
+            return CLBlastSsyr2k((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_float(a + 5), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], slot_float(a + 12), mems[(size_t)a[13]], (size_t)a[14], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DSYR2K:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9, 13 })) return CLBlastInvalidValue;
+            return CLBlastDsyr2k((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_double(a + 5), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], slot_double(a + 12), mems[(size_t)a[13]], (size_t)a[14], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CSYR2K:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 15 })) return CLBlastInvalidValue;
+            return CLBlastCsyr2k((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_float2(a + 5), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_float2(a + 13), mems[(size_t)a[15]], (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZSYR2K:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 15 })) return CLBlastInvalidValue;
+            return CLBlastZsyr2k((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_double2(a + 5), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_double2(a + 13), mems[(size_t)a[15]], (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HSYR2K:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9, 13 })) return CLBlastInvalidValue;
+            return CLBlastHsyr2k((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], FloatToHalf(slot_float(a + 5)), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], FloatToHalf(slot_float(a + 12)), mems[(size_t)a[13]], (size_t)a[14], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHER2K:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            return CLBlastCher2k((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_float2(a + 5), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_float(a + 13), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHER2K:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            return CLBlastZher2k((CLBlastLayout)a[0], (CLBlastTriangle)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], slot_double2(a + 5), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_double(a + 13), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STRMM:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastStrmm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (CLBlastTranspose)a[3], (CLBlastDiagonal)a[4], (size_t)a[5], (size_t)a[6], slot_float(a + 7), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTRMM:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastDtrmm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (CLBlastTranspose)a[3], (CLBlastDiagonal)a[4], (size_t)a[5], (size_t)a[6], slot_double(a + 7), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTRMM:
+        {
+            if (!slot_mems_valid(a, mems, { 9, 12 })) return CLBlastInvalidValue;
+            return CLBlastCtrmm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (CLBlastTranspose)a[3], (CLBlastDiagonal)a[4], (size_t)a[5], (size_t)a[6], slot_float2(a + 7), mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTRMM:
+        {
+            if (!slot_mems_valid(a, mems, { 9, 12 })) return CLBlastInvalidValue;
+            return CLBlastZtrmm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (CLBlastTranspose)a[3], (CLBlastDiagonal)a[4], (size_t)a[5], (size_t)a[6], slot_double2(a + 7), mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HTRMM:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastHtrmm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (CLBlastTranspose)a[3], (CLBlastDiagonal)a[4], (size_t)a[5], (size_t)a[6], FloatToHalf(slot_float(a + 7)), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_STRSM:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastStrsm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (CLBlastTranspose)a[3], (CLBlastDiagonal)a[4], (size_t)a[5], (size_t)a[6], slot_float(a + 7), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DTRSM:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11 })) return CLBlastInvalidValue;
+            return CLBlastDtrsm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (CLBlastTranspose)a[3], (CLBlastDiagonal)a[4], (size_t)a[5], (size_t)a[6], slot_double(a + 7), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CTRSM:
+        {
+            if (!slot_mems_valid(a, mems, { 9, 12 })) return CLBlastInvalidValue;
+            return CLBlastCtrsm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (CLBlastTranspose)a[3], (CLBlastDiagonal)a[4], (size_t)a[5], (size_t)a[6], slot_float2(a + 7), mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZTRSM:
+        {
+            if (!slot_mems_valid(a, mems, { 9, 12 })) return CLBlastInvalidValue;
+            return CLBlastZtrsm((CLBlastLayout)a[0], (CLBlastSide)a[1], (CLBlastTriangle)a[2], (CLBlastTranspose)a[3], (CLBlastDiagonal)a[4], (size_t)a[5], (size_t)a[6], slot_double2(a + 7), mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SHAD:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5, 9 })) return CLBlastInvalidValue;
+            return CLBlastShad((size_t)a[0], slot_float(a + 1), mems[(size_t)a[2]], (size_t)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], slot_float(a + 8), mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DHAD:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5, 9 })) return CLBlastInvalidValue;
+            return CLBlastDhad((size_t)a[0], slot_double(a + 1), mems[(size_t)a[2]], (size_t)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], slot_double(a + 8), mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CHAD:
+        {
+            if (!slot_mems_valid(a, mems, { 3, 6, 11 })) return CLBlastInvalidValue;
+            return CLBlastChad((size_t)a[0], slot_float2(a + 1), mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], slot_float2(a + 9), mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZHAD:
+        {
+            if (!slot_mems_valid(a, mems, { 3, 6, 11 })) return CLBlastInvalidValue;
+            return CLBlastZhad((size_t)a[0], slot_double2(a + 1), mems[(size_t)a[3]], (size_t)a[4], (size_t)a[5], mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], slot_double2(a + 9), mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HHAD:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5, 9 })) return CLBlastInvalidValue;
+            return CLBlastHhad((size_t)a[0], FloatToHalf(slot_float(a + 1)), mems[(size_t)a[2]], (size_t)a[3], (size_t)a[4], mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], FloatToHalf(slot_float(a + 8)), mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SOMATCOPY:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastSomatcopy((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], slot_float(a + 4), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DOMATCOPY:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastDomatcopy((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], slot_double(a + 4), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_COMATCOPY:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastComatcopy((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], slot_float2(a + 4), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZOMATCOPY:
+        {
+            if (!slot_mems_valid(a, mems, { 6, 9 })) return CLBlastInvalidValue;
+            return CLBlastZomatcopy((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], slot_double2(a + 4), mems[(size_t)a[6]], (size_t)a[7], (size_t)a[8], mems[(size_t)a[9]], (size_t)a[10], (size_t)a[11], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HOMATCOPY:
+        {
+            if (!slot_mems_valid(a, mems, { 5, 8 })) return CLBlastInvalidValue;
+            return CLBlastHomatcopy((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (size_t)a[2], (size_t)a[3], FloatToHalf(slot_float(a + 4)), mems[(size_t)a[5]], (size_t)a[6], (size_t)a[7], mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SIM2COL:
+        {
+            if (!slot_mems_valid(a, mems, { 12, 14 })) return CLBlastInvalidValue;
+            return CLBlastSim2col((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DIM2COL:
+        {
+            if (!slot_mems_valid(a, mems, { 12, 14 })) return CLBlastInvalidValue;
+            return CLBlastDim2col((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CIM2COL:
+        {
+            if (!slot_mems_valid(a, mems, { 12, 14 })) return CLBlastInvalidValue;
+            return CLBlastCim2col((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZIM2COL:
+        {
+            if (!slot_mems_valid(a, mems, { 12, 14 })) return CLBlastInvalidValue;
+            return CLBlastZim2col((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HIM2COL:
+        {
+            if (!slot_mems_valid(a, mems, { 12, 14 })) return CLBlastInvalidValue;
+            return CLBlastHim2col((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCOL2IM:
+        {
+            if (!slot_mems_valid(a, mems, { 12, 14 })) return CLBlastInvalidValue;
+            return CLBlastScol2im((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DCOL2IM:
+        {
+            if (!slot_mems_valid(a, mems, { 12, 14 })) return CLBlastInvalidValue;
+            return CLBlastDcol2im((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CCOL2IM:
+        {
+            if (!slot_mems_valid(a, mems, { 12, 14 })) return CLBlastInvalidValue;
+            return CLBlastCcol2im((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZCOL2IM:
+        {
+            if (!slot_mems_valid(a, mems, { 12, 14 })) return CLBlastInvalidValue;
+            return CLBlastZcol2im((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HCOL2IM:
+        {
+            if (!slot_mems_valid(a, mems, { 12, 14 })) return CLBlastInvalidValue;
+            return CLBlastHcol2im((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SCONVGEMM:
+        {
+            if (!slot_mems_valid(a, mems, { 14, 16, 18 })) return CLBlastInvalidValue;
+            return CLBlastSconvgemm((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], (size_t)a[12], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], mems[(size_t)a[16]], (size_t)a[17], mems[(size_t)a[18]], (size_t)a[19], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DCONVGEMM:
+        {
+            if (!slot_mems_valid(a, mems, { 14, 16, 18 })) return CLBlastInvalidValue;
+            return CLBlastDconvgemm((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], (size_t)a[12], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], mems[(size_t)a[16]], (size_t)a[17], mems[(size_t)a[18]], (size_t)a[19], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HCONVGEMM:
+        {
+            if (!slot_mems_valid(a, mems, { 14, 16, 18 })) return CLBlastInvalidValue;
+            return CLBlastHconvgemm((CLBlastKernelMode)a[0], (size_t)a[1], (size_t)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (size_t)a[6], (size_t)a[7], (size_t)a[8], (size_t)a[9], (size_t)a[10], (size_t)a[11], (size_t)a[12], (size_t)a[13], mems[(size_t)a[14]], (size_t)a[15], mems[(size_t)a[16]], (size_t)a[17], mems[(size_t)a[18]], (size_t)a[19], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SAXPYBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5 })) return CLBlastInvalidValue;
+            std::vector<size_t> x_offsets_size_t;
+            std::vector<size_t> y_offsets_size_t;
+            return CLBlastSaxpyBatched((size_t)a[0], (const float*)slot_array(a + 1), mems[(size_t)a[2]], slot_size_t_array(a + 3, x_offsets_size_t), (size_t)a[4], mems[(size_t)a[5]], slot_size_t_array(a + 6, y_offsets_size_t), (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DAXPYBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5 })) return CLBlastInvalidValue;
+            std::vector<size_t> x_offsets_size_t;
+            std::vector<size_t> y_offsets_size_t;
+            return CLBlastDaxpyBatched((size_t)a[0], (const double*)slot_array(a + 1), mems[(size_t)a[2]], slot_size_t_array(a + 3, x_offsets_size_t), (size_t)a[4], mems[(size_t)a[5]], slot_size_t_array(a + 6, y_offsets_size_t), (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CAXPYBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5 })) return CLBlastInvalidValue;
+            std::vector<size_t> x_offsets_size_t;
+            std::vector<size_t> y_offsets_size_t;
+            return CLBlastCaxpyBatched((size_t)a[0], (const cl_float2*)slot_array(a + 1), mems[(size_t)a[2]], slot_size_t_array(a + 3, x_offsets_size_t), (size_t)a[4], mems[(size_t)a[5]], slot_size_t_array(a + 6, y_offsets_size_t), (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZAXPYBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5 })) return CLBlastInvalidValue;
+            std::vector<size_t> x_offsets_size_t;
+            std::vector<size_t> y_offsets_size_t;
+            return CLBlastZaxpyBatched((size_t)a[0], (const cl_double2*)slot_array(a + 1), mems[(size_t)a[2]], slot_size_t_array(a + 3, x_offsets_size_t), (size_t)a[4], mems[(size_t)a[5]], slot_size_t_array(a + 6, y_offsets_size_t), (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HAXPYBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 2, 5 })) return CLBlastInvalidValue;
+            std::vector<cl_half> alphas_half;
+            std::vector<size_t> x_offsets_size_t;
+            std::vector<size_t> y_offsets_size_t;
+            return CLBlastHaxpyBatched((size_t)a[0], slot_half_array(a + 1, alphas_half), mems[(size_t)a[2]], slot_size_t_array(a + 3, x_offsets_size_t), (size_t)a[4], mems[(size_t)a[5]], slot_size_t_array(a + 6, y_offsets_size_t), (size_t)a[7], (size_t)a[8], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            std::vector<size_t> a_offsets_size_t;
+            std::vector<size_t> b_offsets_size_t;
+            std::vector<size_t> c_offsets_size_t;
+            return CLBlastSgemmBatched((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (const float*)slot_array(a + 6), mems[(size_t)a[7]], slot_size_t_array(a + 8, a_offsets_size_t), (size_t)a[9], mems[(size_t)a[10]], slot_size_t_array(a + 11, b_offsets_size_t), (size_t)a[12], (const float*)slot_array(a + 13), mems[(size_t)a[14]], slot_size_t_array(a + 15, c_offsets_size_t), (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            std::vector<size_t> a_offsets_size_t;
+            std::vector<size_t> b_offsets_size_t;
+            std::vector<size_t> c_offsets_size_t;
+            return CLBlastDgemmBatched((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (const double*)slot_array(a + 6), mems[(size_t)a[7]], slot_size_t_array(a + 8, a_offsets_size_t), (size_t)a[9], mems[(size_t)a[10]], slot_size_t_array(a + 11, b_offsets_size_t), (size_t)a[12], (const double*)slot_array(a + 13), mems[(size_t)a[14]], slot_size_t_array(a + 15, c_offsets_size_t), (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            std::vector<size_t> a_offsets_size_t;
+            std::vector<size_t> b_offsets_size_t;
+            std::vector<size_t> c_offsets_size_t;
+            return CLBlastCgemmBatched((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (const cl_float2*)slot_array(a + 6), mems[(size_t)a[7]], slot_size_t_array(a + 8, a_offsets_size_t), (size_t)a[9], mems[(size_t)a[10]], slot_size_t_array(a + 11, b_offsets_size_t), (size_t)a[12], (const cl_float2*)slot_array(a + 13), mems[(size_t)a[14]], slot_size_t_array(a + 15, c_offsets_size_t), (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            std::vector<size_t> a_offsets_size_t;
+            std::vector<size_t> b_offsets_size_t;
+            std::vector<size_t> c_offsets_size_t;
+            return CLBlastZgemmBatched((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], (const cl_double2*)slot_array(a + 6), mems[(size_t)a[7]], slot_size_t_array(a + 8, a_offsets_size_t), (size_t)a[9], mems[(size_t)a[10]], slot_size_t_array(a + 11, b_offsets_size_t), (size_t)a[12], (const cl_double2*)slot_array(a + 13), mems[(size_t)a[14]], slot_size_t_array(a + 15, c_offsets_size_t), (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14 })) return CLBlastInvalidValue;
+            std::vector<cl_half> alphas_half;
+            std::vector<size_t> a_offsets_size_t;
+            std::vector<size_t> b_offsets_size_t;
+            std::vector<cl_half> betas_half;
+            std::vector<size_t> c_offsets_size_t;
+            return CLBlastHgemmBatched((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_half_array(a + 6, alphas_half), mems[(size_t)a[7]], slot_size_t_array(a + 8, a_offsets_size_t), (size_t)a[9], mems[(size_t)a[10]], slot_size_t_array(a + 11, b_offsets_size_t), (size_t)a[12], slot_half_array(a + 13, betas_half), mems[(size_t)a[14]], slot_size_t_array(a + 15, c_offsets_size_t), (size_t)a[16], (size_t)a[17], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMSTRIDEDBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 11, 16 })) return CLBlastInvalidValue;
+            return CLBlastSgemmStridedBatched((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_float(a + 6), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], (size_t)a[14], slot_float(a + 15), mems[(size_t)a[16]], (size_t)a[17], (size_t)a[18], (size_t)a[19], (size_t)a[20], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMSTRIDEDBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 11, 16 })) return CLBlastInvalidValue;
+            return CLBlastDgemmStridedBatched((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_double(a + 6), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], (size_t)a[14], slot_double(a + 15), mems[(size_t)a[16]], (size_t)a[17], (size_t)a[18], (size_t)a[19], (size_t)a[20], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMSTRIDEDBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 12, 18 })) return CLBlastInvalidValue;
+            return CLBlastCgemmStridedBatched((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_float2(a + 6), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], (size_t)a[15], slot_float2(a + 16), mems[(size_t)a[18]], (size_t)a[19], (size_t)a[20], (size_t)a[21], (size_t)a[22], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMSTRIDEDBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 12, 18 })) return CLBlastInvalidValue;
+            return CLBlastZgemmStridedBatched((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_double2(a + 6), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], (size_t)a[11], mems[(size_t)a[12]], (size_t)a[13], (size_t)a[14], (size_t)a[15], slot_double2(a + 16), mems[(size_t)a[18]], (size_t)a[19], (size_t)a[20], (size_t)a[21], (size_t)a[22], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMSTRIDEDBATCHED:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 11, 16 })) return CLBlastInvalidValue;
+            return CLBlastHgemmStridedBatched((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], FloatToHalf(slot_float(a + 6)), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], (size_t)a[14], FloatToHalf(slot_float(a + 15)), mems[(size_t)a[16]], (size_t)a[17], (size_t)a[18], (size_t)a[19], (size_t)a[20], queue, event);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMWITHTEMPBUFFER:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14, 17 })) return CLBlastInvalidValue;
+            return CLBlastSgemmWithTempBuffer((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_float(a + 6), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_float(a + 13), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event, mems[(size_t)a[17]]);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMWITHTEMPBUFFER:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14, 17 })) return CLBlastInvalidValue;
+            return CLBlastDgemmWithTempBuffer((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_double(a + 6), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], slot_double(a + 13), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event, mems[(size_t)a[17]]);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMWITHTEMPBUFFER:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11, 16, 19 })) return CLBlastInvalidValue;
+            return CLBlastCgemmWithTempBuffer((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_float2(a + 6), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], slot_float2(a + 14), mems[(size_t)a[16]], (size_t)a[17], (size_t)a[18], queue, event, mems[(size_t)a[19]]);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMWITHTEMPBUFFER:
+        {
+            if (!slot_mems_valid(a, mems, { 8, 11, 16, 19 })) return CLBlastInvalidValue;
+            return CLBlastZgemmWithTempBuffer((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], slot_double2(a + 6), mems[(size_t)a[8]], (size_t)a[9], (size_t)a[10], mems[(size_t)a[11]], (size_t)a[12], (size_t)a[13], slot_double2(a + 14), mems[(size_t)a[16]], (size_t)a[17], (size_t)a[18], queue, event, mems[(size_t)a[19]]);
+        }
+        case org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMWITHTEMPBUFFER:
+        {
+            if (!slot_mems_valid(a, mems, { 7, 10, 14, 17 })) return CLBlastInvalidValue;
+            return CLBlastHgemmWithTempBuffer((CLBlastLayout)a[0], (CLBlastTranspose)a[1], (CLBlastTranspose)a[2], (size_t)a[3], (size_t)a[4], (size_t)a[5], FloatToHalf(slot_float(a + 6)), mems[(size_t)a[7]], (size_t)a[8], (size_t)a[9], mems[(size_t)a[10]], (size_t)a[11], (size_t)a[12], FloatToHalf(slot_float(a + 13)), mems[(size_t)a[14]], (size_t)a[15], (size_t)a[16], queue, event, mems[(size_t)a[17]]);
+        }
+    }
+    Logger::log(LOG_ERROR, "Invalid command in CLBlastCommandList: %ld\n", (long)command);
+    return CLBlastInvalidValue;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastCommandList
+* Method:    executeNative
+* Signature: (Ljava/nio/ByteBuffer;JI[Lorg/jocl/cl_mem;Lorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastCommandList_executeNative(JNIEnv *env, jclass cls, jobject data, jlong dataSize, jint commandCount, jobjectArray mems, jobject queue, jobjectArray waitList, jobject event)
+{
+    // Null-checks for non-primitive arguments
+    if (data == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'data' is null for CLBlastCommandList");
+        return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    }
+    if (mems == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'mems' is null for CLBlastCommandList");
+        return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    }
+    if (queue == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'queue' is null for CLBlastCommandList");
+        return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    }
+    // waitList may be nullptr
+    // event may be nullptr
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing CLBlastCommandList(data=%p, dataSize=%ld, commandCount=%d, mems=%p, queue=%p, waitList=%p, event=%p)\n",
+        data, dataSize, commandCount, mems, queue, waitList, event);
+
+    // Native variable declarations
+    const char * data_native = nullptr;
+    std::vector<cl_mem> mems_native;
+    cl_command_queue * queue_native = nullptr;
+    cl_event * event_native = nullptr;
+
+    // Obtain native variable values
+    data_native = (const char*)env->GetDirectBufferAddress(data);
+    if (data_native == nullptr)
+    {
+        ThrowByName(env, "java/lang/IllegalArgumentException", "The data must be a direct buffer");
+        return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    }
+    jsize memsLength = env->GetArrayLength(mems);
+    mems_native.resize((size_t)memsLength);
+    for (jsize i = 0; i < memsLength; i++)
+    {
+        jobject mem = env->GetObjectArrayElement(mems, i);
+        if (!initNative(env, mem, mems_native[(size_t)i], true)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+        env->DeleteLocalRef(mem);
+    }
+    if (!initNative(env, queue, queue_native, true)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    if (!initNative(env, event, event_native, false)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+
+    // The wait list is enqueued only after all arguments have been
+    // converted, directly before the first command
+    cl_int waitList_result = enqueueWaitList(env, queue_native, waitList);
+    if (waitList_result != CL_SUCCESS) return (jint)waitList_result;
+
+    // Native function calls. Each command receives its own event, and
+    // the event of the caller is a marker that waits for all of them, so
+    // that it also covers all commands on an out-of-order queue.
+    CLBlastStatusCode jniResult_native = CLBlastSuccess;
+    BatchEvents commandEvents((size_t)commandCount, event_native);
+    size_t offset = 0;
+    for (jint i = 0; i < commandCount; i++)
+    {
+        const jlong *record = (const jlong*)(data_native + offset);
+        if (offset + org_jocl_blast_CLBlastCommandList_HEADER_SIZE > (size_t)dataSize ||
+            record[1] < org_jocl_blast_CLBlastCommandList_HEADER_SIZE ||
+            offset + (size_t)record[1] > (size_t)dataSize)
+        {
+            Logger::log(LOG_ERROR, "Invalid record in CLBlastCommandList at offset %ld\n", (long)offset);
+            jniResult_native = CLBlastInvalidValue;
+            break;
+        }
+        jniResult_native = executeCommand(record[0], record + 2, mems_native, queue_native, commandEvents.get((size_t)i));
+        if (jniResult_native != CLBlastSuccess)
+        {
+            break;
+        }
+        trackKernelCacheUse(commandRoutineName(record[0]), *queue_native, jniResult_native);
+        offset += (size_t)record[1];
+    }
+    if (jniResult_native == CLBlastSuccess)
+    {
+        jniResult_native = commandEvents.finish(queue_native);
+    }
+
+    // Write back native variable values
+    if (!releaseNative(env, event_native, event, true)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    jint jniResult = (jint)jniResult_native;
+    return jniResult;
+}
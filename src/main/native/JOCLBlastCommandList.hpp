@@ -0,0 +1,506 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_jocl_blast_CLBlastCommandList */
+
+#ifndef _Included_org_jocl_blast_CLBlastCommandList
+#define _Included_org_jocl_blast_CLBlastCommandList
+#ifdef __cplusplus
+extern "C" {
+#endif
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SROTG
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SROTG 1L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DROTG
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DROTG 2L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SROTMG
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SROTMG 3L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DROTMG
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DROTMG 4L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SROT
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SROT 5L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DROT
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DROT 6L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SROTM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SROTM 7L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DROTM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DROTM 8L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSWAP
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSWAP 9L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSWAP
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSWAP 10L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CSWAP
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CSWAP 11L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZSWAP
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZSWAP 12L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSWAP
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSWAP 13L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSCAL
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSCAL 14L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSCAL
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSCAL 15L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CSCAL
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CSCAL 16L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZSCAL
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZSCAL 17L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSCAL
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSCAL 18L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SCOPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SCOPY 19L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DCOPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DCOPY 20L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CCOPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CCOPY 21L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZCOPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZCOPY 22L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HCOPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HCOPY 23L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SAXPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SAXPY 24L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DAXPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DAXPY 25L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CAXPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CAXPY 26L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZAXPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZAXPY 27L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HAXPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HAXPY 28L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SDOT
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SDOT 29L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DDOT
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DDOT 30L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HDOT
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HDOT 31L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CDOTU
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CDOTU 32L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZDOTU
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZDOTU 33L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CDOTC
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CDOTC 34L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZDOTC
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZDOTC 35L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SNRM2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SNRM2 36L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DNRM2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DNRM2 37L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SCNRM2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SCNRM2 38L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DZNRM2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DZNRM2 39L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HNRM2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HNRM2 40L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SASUM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SASUM 41L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DASUM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DASUM 42L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SCASUM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SCASUM 43L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DZASUM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DZASUM 44L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HASUM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HASUM 45L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSUM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSUM 46L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSUM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSUM 47L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SCSUM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SCSUM 48L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DZSUM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DZSUM 49L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSUM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSUM 50L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ISAMAX
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ISAMAX 51L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IDAMAX
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IDAMAX 52L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ICAMAX
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ICAMAX 53L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IZAMAX
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IZAMAX 54L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IHAMAX
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IHAMAX 55L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ISAMIN
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ISAMIN 56L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IDAMIN
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IDAMIN 57L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ICAMIN
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ICAMIN 58L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IZAMIN
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IZAMIN 59L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IHAMIN
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IHAMIN 60L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ISMAX
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ISMAX 61L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IDMAX
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IDMAX 62L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ICMAX
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ICMAX 63L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IZMAX
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IZMAX 64L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IHMAX
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IHMAX 65L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ISMIN
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ISMIN 66L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IDMIN
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IDMIN 67L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ICMIN
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ICMIN 68L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IZMIN
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IZMIN 69L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_IHMIN
+#define org_jocl_blast_CLBlastCommandList_COMMAND_IHMIN 70L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SGEMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SGEMV 71L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DGEMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DGEMV 72L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CGEMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CGEMV 73L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMV 74L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HGEMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HGEMV 75L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SGBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SGBMV 76L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DGBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DGBMV 77L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CGBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CGBMV 78L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZGBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZGBMV 79L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HGBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HGBMV 80L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHEMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHEMV 81L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHEMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHEMV 82L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHBMV 83L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHBMV 84L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHPMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHPMV 85L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHPMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHPMV 86L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSYMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSYMV 87L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSYMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSYMV 88L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSYMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSYMV 89L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSBMV 90L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSBMV 91L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSBMV 92L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSPMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSPMV 93L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSPMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSPMV 94L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSPMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSPMV 95L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_STRMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_STRMV 96L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DTRMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DTRMV 97L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CTRMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CTRMV 98L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZTRMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZTRMV 99L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HTRMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HTRMV 100L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_STBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_STBMV 101L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DTBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DTBMV 102L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CTBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CTBMV 103L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZTBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZTBMV 104L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HTBMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HTBMV 105L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_STPMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_STPMV 106L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DTPMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DTPMV 107L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CTPMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CTPMV 108L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZTPMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZTPMV 109L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HTPMV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HTPMV 110L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_STRSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_STRSV 111L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DTRSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DTRSV 112L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CTRSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CTRSV 113L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZTRSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZTRSV 114L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_STBSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_STBSV 115L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DTBSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DTBSV 116L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CTBSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CTBSV 117L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZTBSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZTBSV 118L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_STPSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_STPSV 119L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DTPSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DTPSV 120L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CTPSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CTPSV 121L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZTPSV
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZTPSV 122L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SGER
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SGER 123L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DGER
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DGER 124L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HGER
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HGER 125L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CGERU
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CGERU 126L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZGERU
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZGERU 127L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CGERC
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CGERC 128L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZGERC
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZGERC 129L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHER
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHER 130L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHER
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHER 131L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHPR
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHPR 132L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHPR
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHPR 133L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHER2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHER2 134L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHER2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHER2 135L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHPR2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHPR2 136L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHPR2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHPR2 137L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSYR
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSYR 138L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSYR
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSYR 139L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSYR
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSYR 140L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSPR
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSPR 141L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSPR
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSPR 142L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSPR
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSPR 143L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSYR2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSYR2 144L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSYR2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSYR2 145L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSYR2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSYR2 146L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSPR2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSPR2 147L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSPR2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSPR2 148L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSPR2
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSPR2 149L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SGEMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SGEMM 150L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DGEMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DGEMM 151L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CGEMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CGEMM 152L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMM 153L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HGEMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HGEMM 154L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSYMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSYMM 155L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSYMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSYMM 156L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CSYMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CSYMM 157L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZSYMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZSYMM 158L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSYMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSYMM 159L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHEMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHEMM 160L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHEMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHEMM 161L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSYRK
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSYRK 162L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSYRK
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSYRK 163L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CSYRK
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CSYRK 164L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZSYRK
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZSYRK 165L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSYRK
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSYRK 166L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHERK
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHERK 167L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHERK
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHERK 168L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SSYR2K
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SSYR2K 169L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DSYR2K
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DSYR2K 170L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CSYR2K
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CSYR2K 171L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZSYR2K
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZSYR2K 172L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HSYR2K
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HSYR2K 173L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHER2K
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHER2K 174L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHER2K
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHER2K 175L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_STRMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_STRMM 176L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DTRMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DTRMM 177L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CTRMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CTRMM 178L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZTRMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZTRMM 179L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HTRMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HTRMM 180L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_STRSM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_STRSM 181L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DTRSM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DTRSM 182L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CTRSM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CTRSM 183L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZTRSM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZTRSM 184L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SHAD
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SHAD 185L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DHAD
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DHAD 186L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CHAD
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CHAD 187L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZHAD
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZHAD 188L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HHAD
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HHAD 189L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SOMATCOPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SOMATCOPY 190L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DOMATCOPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DOMATCOPY 191L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_COMATCOPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_COMATCOPY 192L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZOMATCOPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZOMATCOPY 193L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HOMATCOPY
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HOMATCOPY 194L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SIM2COL
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SIM2COL 195L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DIM2COL
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DIM2COL 196L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CIM2COL
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CIM2COL 197L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZIM2COL
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZIM2COL 198L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HIM2COL
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HIM2COL 199L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SCOL2IM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SCOL2IM 200L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DCOL2IM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DCOL2IM 201L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CCOL2IM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CCOL2IM 202L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZCOL2IM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZCOL2IM 203L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HCOL2IM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HCOL2IM 204L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SCONVGEMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SCONVGEMM 205L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DCONVGEMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DCONVGEMM 206L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HCONVGEMM
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HCONVGEMM 207L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SAXPYBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SAXPYBATCHED 208L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DAXPYBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DAXPYBATCHED 209L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CAXPYBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CAXPYBATCHED 210L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZAXPYBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZAXPYBATCHED 211L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HAXPYBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HAXPYBATCHED 212L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMBATCHED 213L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMBATCHED 214L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMBATCHED 215L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMBATCHED 216L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMBATCHED 217L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMSTRIDEDBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMSTRIDEDBATCHED 218L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMSTRIDEDBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMSTRIDEDBATCHED 219L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMSTRIDEDBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMSTRIDEDBATCHED 220L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMSTRIDEDBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMSTRIDEDBATCHED 221L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMSTRIDEDBATCHED
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMSTRIDEDBATCHED 222L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMWITHTEMPBUFFER
+#define org_jocl_blast_CLBlastCommandList_COMMAND_SGEMMWITHTEMPBUFFER 223L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMWITHTEMPBUFFER
+#define org_jocl_blast_CLBlastCommandList_COMMAND_DGEMMWITHTEMPBUFFER 224L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMWITHTEMPBUFFER
+#define org_jocl_blast_CLBlastCommandList_COMMAND_CGEMMWITHTEMPBUFFER 225L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMWITHTEMPBUFFER
+#define org_jocl_blast_CLBlastCommandList_COMMAND_ZGEMMWITHTEMPBUFFER 226L
+#undef org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMWITHTEMPBUFFER
+#define org_jocl_blast_CLBlastCommandList_COMMAND_HGEMMWITHTEMPBUFFER 227L
+#undef org_jocl_blast_CLBlastCommandList_HEADER_SIZE
+#define org_jocl_blast_CLBlastCommandList_HEADER_SIZE 16L
+#undef org_jocl_blast_CLBlastCommandList_SLOT_SIZE
+#define org_jocl_blast_CLBlastCommandList_SLOT_SIZE 8L
+/*
+ * Class:     org_jocl_blast_CLBlastCommandList
+ * Method:    executeNative
+ * Signature: (Ljava/nio/ByteBuffer;JI[Lorg/jocl/cl_mem;Lorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastCommandList_executeNative
+  (JNIEnv *, jclass, jobject, jlong, jint, jobjectArray, jobject, jobjectArray, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
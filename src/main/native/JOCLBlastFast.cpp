@@ -0,0 +1,422 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlastFast.hpp"
+#include "JOCLBlastKernelCache.hpp"
+
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+#include "PointerUtils.hpp"
+#include <clblast_c.h>
+#include <clblast_half.h>
+
+// The functions in this file receive the native handles of cl_mem and
+// cl_command_queue objects as jlong values, and pass them directly to
+// CLBlast. There are no null checks and no log messages, in order to
+// keep the per-call overhead as small as possible. The calls are only
+// recorded for the kernel cache accounting, if it is enabled, so that
+// their kernels are compiled again after an eviction.
+
+/**
+* Write the given native event into the given cl_event object,
+* if the object is not nullptr
+*/
+static void writeEvent(JNIEnv *env, jobject event, cl_event event_native)
+{
+    if (event != nullptr)
+    {
+        env->SetLongField(event, NativePointerObject_nativePointer, (jlong)event_native);
+    }
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastFast
+* Method:    getHandleNative
+* Signature: (Lorg/jocl/NativePointerObject;)J
+*/
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastFast_getHandleNative
+(JNIEnv *env, jclass UNUSED(cls), jobject object)
+{
+    return env->GetLongField(object, NativePointerObject_nativePointer);
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastFast
+* Method:    getAddressNative
+* Signature: (Ljava/nio/Buffer;)J
+*/
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastFast_getAddressNative
+(JNIEnv *env, jclass UNUSED(cls), jobject buffer)
+{
+    return (jlong)env->GetDirectBufferAddress(buffer);
+}
+
+
+
+// Swap two vectors: SSWAP/DSWAP
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SswapNative(JNIEnv *env, jclass cls, jlong n, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSswap((size_t)n, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSswap", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DswapNative(JNIEnv *env, jclass cls, jlong n, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDswap((size_t)n, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDswap", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// Vector scaling: SSCAL/DSCAL/HSCAL
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SscalNative(JNIEnv *env, jclass cls, jlong n, jfloat alpha, jlong x_buffer, jlong x_offset, jlong x_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSscal((size_t)n, (float)alpha, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSscal", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DscalNative(JNIEnv *env, jclass cls, jlong n, jdouble alpha, jlong x_buffer, jlong x_offset, jlong x_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDscal((size_t)n, (double)alpha, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDscal", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_HscalNative(JNIEnv *env, jclass cls, jlong n, jfloat alpha, jlong x_buffer, jlong x_offset, jlong x_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastHscal((size_t)n, FloatToHalf((float)alpha), (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastHscal", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// Vector copy: SCOPY/DCOPY
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_ScopyNative(JNIEnv *env, jclass cls, jlong n, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastScopy((size_t)n, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastScopy", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DcopyNative(JNIEnv *env, jclass cls, jlong n, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDcopy((size_t)n, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDcopy", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// Vector-times-constant plus vector: SAXPY/DAXPY/HAXPY
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SaxpyNative(JNIEnv *env, jclass cls, jlong n, jfloat alpha, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSaxpy((size_t)n, (float)alpha, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSaxpy", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DaxpyNative(JNIEnv *env, jclass cls, jlong n, jdouble alpha, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDaxpy((size_t)n, (double)alpha, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDaxpy", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_HaxpyNative(JNIEnv *env, jclass cls, jlong n, jfloat alpha, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastHaxpy((size_t)n, FloatToHalf((float)alpha), (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastHaxpy", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// Dot product of two vectors: SDOT/DDOT
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SdotNative(JNIEnv *env, jclass cls, jlong n, jlong dot_buffer, jlong dot_offset, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSdot((size_t)n, (cl_mem)dot_buffer, (size_t)dot_offset, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSdot", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DdotNative(JNIEnv *env, jclass cls, jlong n, jlong dot_buffer, jlong dot_offset, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDdot((size_t)n, (cl_mem)dot_buffer, (size_t)dot_offset, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDdot", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// Euclidian norm of a vector: SNRM2/DNRM2
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_Snrm2Native(JNIEnv *env, jclass cls, jlong n, jlong nrm2_buffer, jlong nrm2_offset, jlong x_buffer, jlong x_offset, jlong x_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSnrm2((size_t)n, (cl_mem)nrm2_buffer, (size_t)nrm2_offset, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSnrm2", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_Dnrm2Native(JNIEnv *env, jclass cls, jlong n, jlong nrm2_buffer, jlong nrm2_offset, jlong x_buffer, jlong x_offset, jlong x_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDnrm2((size_t)n, (cl_mem)nrm2_buffer, (size_t)nrm2_offset, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDnrm2", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// Absolute sum of values in a vector: SASUM/DASUM
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SasumNative(JNIEnv *env, jclass cls, jlong n, jlong asum_buffer, jlong asum_offset, jlong x_buffer, jlong x_offset, jlong x_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSasum((size_t)n, (cl_mem)asum_buffer, (size_t)asum_offset, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSasum", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DasumNative(JNIEnv *env, jclass cls, jlong n, jlong asum_buffer, jlong asum_offset, jlong x_buffer, jlong x_offset, jlong x_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDasum((size_t)n, (cl_mem)asum_buffer, (size_t)asum_offset, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDasum", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// Index of absolute maximum value in a vector: iSAMAX/iDAMAX
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_iSamaxNative(JNIEnv *env, jclass cls, jlong n, jlong imax_buffer, jlong imax_offset, jlong x_buffer, jlong x_offset, jlong x_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastiSamax((size_t)n, (cl_mem)imax_buffer, (size_t)imax_offset, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastiSamax", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_iDamaxNative(JNIEnv *env, jclass cls, jlong n, jlong imax_buffer, jlong imax_offset, jlong x_buffer, jlong x_offset, jlong x_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastiDamax((size_t)n, (cl_mem)imax_buffer, (size_t)imax_offset, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastiDamax", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// General matrix-vector multiplication: SGEMV/DGEMV/HGEMV
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SgemvNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jlong m, jlong n, jfloat alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong x_buffer, jlong x_offset, jlong x_inc, jfloat beta, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSgemv((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (size_t)m, (size_t)n, (float)alpha, (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (float)beta, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSgemv", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DgemvNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jlong m, jlong n, jdouble alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong x_buffer, jlong x_offset, jlong x_inc, jdouble beta, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDgemv((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (size_t)m, (size_t)n, (double)alpha, (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (double)beta, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDgemv", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_HgemvNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jlong m, jlong n, jfloat alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong x_buffer, jlong x_offset, jlong x_inc, jfloat beta, jlong y_buffer, jlong y_offset, jlong y_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastHgemv((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (size_t)m, (size_t)n, FloatToHalf((float)alpha), (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, FloatToHalf((float)beta), (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastHgemv", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// General rank-1 matrix update: SGER/DGER
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SgerNative(JNIEnv *env, jclass cls, jint layout, jlong m, jlong n, jfloat alpha, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong a_buffer, jlong a_offset, jlong a_ld, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSger((CLBlastLayout)layout, (size_t)m, (size_t)n, (float)alpha, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSger", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DgerNative(JNIEnv *env, jclass cls, jint layout, jlong m, jlong n, jdouble alpha, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jlong a_buffer, jlong a_offset, jlong a_ld, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDger((CLBlastLayout)layout, (size_t)m, (size_t)n, (double)alpha, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDger", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// General matrix-matrix multiplication: SGEMM/DGEMM/HGEMM
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SgemmNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jint b_transpose, jlong m, jlong n, jlong k, jfloat alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong b_buffer, jlong b_offset, jlong b_ld, jfloat beta, jlong c_buffer, jlong c_offset, jlong c_ld, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSgemm((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (CLBlastTranspose)b_transpose, (size_t)m, (size_t)n, (size_t)k, (float)alpha, (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (cl_mem)b_buffer, (size_t)b_offset, (size_t)b_ld, (float)beta, (cl_mem)c_buffer, (size_t)c_offset, (size_t)c_ld, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSgemm", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DgemmNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jint b_transpose, jlong m, jlong n, jlong k, jdouble alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong b_buffer, jlong b_offset, jlong b_ld, jdouble beta, jlong c_buffer, jlong c_offset, jlong c_ld, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDgemm((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (CLBlastTranspose)b_transpose, (size_t)m, (size_t)n, (size_t)k, (double)alpha, (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (cl_mem)b_buffer, (size_t)b_offset, (size_t)b_ld, (double)beta, (cl_mem)c_buffer, (size_t)c_offset, (size_t)c_ld, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDgemm", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_HgemmNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jint b_transpose, jlong m, jlong n, jlong k, jfloat alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong b_buffer, jlong b_offset, jlong b_ld, jfloat beta, jlong c_buffer, jlong c_offset, jlong c_ld, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastHgemm((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (CLBlastTranspose)b_transpose, (size_t)m, (size_t)n, (size_t)k, FloatToHalf((float)alpha), (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (cl_mem)b_buffer, (size_t)b_offset, (size_t)b_ld, FloatToHalf((float)beta), (cl_mem)c_buffer, (size_t)c_offset, (size_t)c_ld, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastHgemm", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// Element-wise vector product (Hadamard): SHAD/DHAD
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_ShadNative(JNIEnv *env, jclass cls, jlong n, jfloat alpha, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jfloat beta, jlong z_buffer, jlong z_offset, jlong z_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastShad((size_t)n, (float)alpha, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, (float)beta, (cl_mem)z_buffer, (size_t)z_offset, (size_t)z_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastShad", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DhadNative(JNIEnv *env, jclass cls, jlong n, jdouble alpha, jlong x_buffer, jlong x_offset, jlong x_inc, jlong y_buffer, jlong y_offset, jlong y_inc, jdouble beta, jlong z_buffer, jlong z_offset, jlong z_inc, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDhad((size_t)n, (double)alpha, (cl_mem)x_buffer, (size_t)x_offset, (size_t)x_inc, (cl_mem)y_buffer, (size_t)y_offset, (size_t)y_inc, (double)beta, (cl_mem)z_buffer, (size_t)z_offset, (size_t)z_inc, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDhad", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// Scaling and out-place transpose/copy (non-BLAS function): SOMATCOPY/DOMATCOPY
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SomatcopyNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jlong m, jlong n, jfloat alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong b_buffer, jlong b_offset, jlong b_ld, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSomatcopy((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (size_t)m, (size_t)n, (float)alpha, (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (cl_mem)b_buffer, (size_t)b_offset, (size_t)b_ld, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSomatcopy", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DomatcopyNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jlong m, jlong n, jdouble alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong b_buffer, jlong b_offset, jlong b_ld, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDomatcopy((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (size_t)m, (size_t)n, (double)alpha, (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (cl_mem)b_buffer, (size_t)b_offset, (size_t)b_ld, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDomatcopy", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+// StridedBatched version of GEMM: SGEMMSTRIDEDBATCHED/DGEMMSTRIDEDBATCHED/HGEMMSTRIDEDBATCHED
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SgemmStridedBatchedNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jint b_transpose, jlong m, jlong n, jlong k, jfloat alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong a_stride, jlong b_buffer, jlong b_offset, jlong b_ld, jlong b_stride, jfloat beta, jlong c_buffer, jlong c_offset, jlong c_ld, jlong c_stride, jlong batch_count, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastSgemmStridedBatched((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (CLBlastTranspose)b_transpose, (size_t)m, (size_t)n, (size_t)k, (float)alpha, (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (size_t)a_stride, (cl_mem)b_buffer, (size_t)b_offset, (size_t)b_ld, (size_t)b_stride, (float)beta, (cl_mem)c_buffer, (size_t)c_offset, (size_t)c_ld, (size_t)c_stride, (size_t)batch_count, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastSgemmStridedBatched", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DgemmStridedBatchedNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jint b_transpose, jlong m, jlong n, jlong k, jdouble alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong a_stride, jlong b_buffer, jlong b_offset, jlong b_ld, jlong b_stride, jdouble beta, jlong c_buffer, jlong c_offset, jlong c_ld, jlong c_stride, jlong batch_count, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastDgemmStridedBatched((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (CLBlastTranspose)b_transpose, (size_t)m, (size_t)n, (size_t)k, (double)alpha, (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (size_t)a_stride, (cl_mem)b_buffer, (size_t)b_offset, (size_t)b_ld, (size_t)b_stride, (double)beta, (cl_mem)c_buffer, (size_t)c_offset, (size_t)c_ld, (size_t)c_stride, (size_t)batch_count, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastDgemmStridedBatched", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
+
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_HgemmStridedBatchedNative(JNIEnv *env, jclass cls, jint layout, jint a_transpose, jint b_transpose, jlong m, jlong n, jlong k, jfloat alpha, jlong a_buffer, jlong a_offset, jlong a_ld, jlong a_stride, jlong b_buffer, jlong b_offset, jlong b_ld, jlong b_stride, jfloat beta, jlong c_buffer, jlong c_offset, jlong c_ld, jlong c_stride, jlong batch_count, jlong queue, jobject event)
+{
+    cl_command_queue queue_native = (cl_command_queue)queue;
+    cl_event event_native = nullptr;
+    CLBlastStatusCode jniResult_native = CLBlastHgemmStridedBatched((CLBlastLayout)layout, (CLBlastTranspose)a_transpose, (CLBlastTranspose)b_transpose, (size_t)m, (size_t)n, (size_t)k, FloatToHalf((float)alpha), (cl_mem)a_buffer, (size_t)a_offset, (size_t)a_ld, (size_t)a_stride, (cl_mem)b_buffer, (size_t)b_offset, (size_t)b_ld, (size_t)b_stride, FloatToHalf((float)beta), (cl_mem)c_buffer, (size_t)c_offset, (size_t)c_ld, (size_t)c_stride, (size_t)batch_count, &queue_native, event == nullptr ? nullptr : &event_native);
+    trackKernelCacheUse("CLBlastHgemmStridedBatched", queue_native, jniResult_native);
+    writeEvent(env, event, event_native);
+    return (jint)jniResult_native;
+}
@@ -0,0 +1,320 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_jocl_blast_CLBlastFast */
+
+#ifndef _Included_org_jocl_blast_CLBlastFast
+#define _Included_org_jocl_blast_CLBlastFast
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    getHandleNative
+ * Signature: (Lorg/jocl/NativePointerObject;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastFast_getHandleNative
+  (JNIEnv *, jclass, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    getAddressNative
+ * Signature: (Ljava/nio/Buffer;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastFast_getAddressNative
+  (JNIEnv *, jclass, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    SswapNative
+ * Signature: (JJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SswapNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DswapNative
+ * Signature: (JJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DswapNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    SscalNative
+ * Signature: (JFJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SscalNative
+  (JNIEnv *, jclass, jlong, jfloat, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DscalNative
+ * Signature: (JDJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DscalNative
+  (JNIEnv *, jclass, jlong, jdouble, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    HscalNative
+ * Signature: (JFJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_HscalNative
+  (JNIEnv *, jclass, jlong, jfloat, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    ScopyNative
+ * Signature: (JJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_ScopyNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DcopyNative
+ * Signature: (JJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DcopyNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    SaxpyNative
+ * Signature: (JFJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SaxpyNative
+  (JNIEnv *, jclass, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DaxpyNative
+ * Signature: (JDJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DaxpyNative
+  (JNIEnv *, jclass, jlong, jdouble, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    HaxpyNative
+ * Signature: (JFJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_HaxpyNative
+  (JNIEnv *, jclass, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    SdotNative
+ * Signature: (JJJJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SdotNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DdotNative
+ * Signature: (JJJJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DdotNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    Snrm2Native
+ * Signature: (JJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_Snrm2Native
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    Dnrm2Native
+ * Signature: (JJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_Dnrm2Native
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    SasumNative
+ * Signature: (JJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SasumNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DasumNative
+ * Signature: (JJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DasumNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    iSamaxNative
+ * Signature: (JJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_iSamaxNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    iDamaxNative
+ * Signature: (JJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_iDamaxNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    SgemvNative
+ * Signature: (IIJJFJJJJJJFJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SgemvNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DgemvNative
+ * Signature: (IIJJDJJJJJJDJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DgemvNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jlong, jlong, jlong, jlong, jlong, jlong, jdouble, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    HgemvNative
+ * Signature: (IIJJFJJJJJJFJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_HgemvNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    SgerNative
+ * Signature: (IJJFJJJJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SgerNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DgerNative
+ * Signature: (IJJDJJJJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DgerNative
+  (JNIEnv *, jclass, jint, jlong, jlong, jdouble, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    SgemmNative
+ * Signature: (IIIJJJFJJJJJJFJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SgemmNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DgemmNative
+ * Signature: (IIIJJJDJJJJJJDJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DgemmNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jlong, jlong, jlong, jlong, jlong, jlong, jdouble, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    HgemmNative
+ * Signature: (IIIJJJFJJJJJJFJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_HgemmNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    ShadNative
+ * Signature: (JFJJJJJJFJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_ShadNative
+  (JNIEnv *, jclass, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DhadNative
+ * Signature: (JDJJJJJJDJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DhadNative
+  (JNIEnv *, jclass, jlong, jdouble, jlong, jlong, jlong, jlong, jlong, jlong, jdouble, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    SomatcopyNative
+ * Signature: (IIJJFJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SomatcopyNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DomatcopyNative
+ * Signature: (IIJJDJJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DomatcopyNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jdouble, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    SgemmStridedBatchedNative
+ * Signature: (IIIJJJFJJJJJJJJFJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_SgemmStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    DgemmStridedBatchedNative
+ * Signature: (IIIJJJDJJJJJJJJDJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_DgemmStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jdouble, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jdouble, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastFast
+ * Method:    HgemmStridedBatchedNative
+ * Signature: (IIIJJJFJJJJJJJJFJJJJJJLorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastFast_HgemmStridedBatchedNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jfloat, jlong, jlong, jlong, jlong, jlong, jlong, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
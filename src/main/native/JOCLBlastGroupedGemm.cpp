@@ -0,0 +1,435 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlastGroupedGemm.hpp"
+#include "JOCLBlastBatched.hpp"
+#include "JOCLBlastKernelCache.hpp"
+#include "JOCLBlastRoutines.hpp"
+#include "JOCLBlastUtils.hpp"
+
+#include <map>
+#include <vector>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+#include "ConversionsCL.hpp"
+
+// The layout of a grouped GEMM plan, which is a Java long[] array:
+//
+//   layout, entryCount, bucketCount,
+//   for each bucket:
+//     a_transpose, b_transpose, m, n, k, a_ld, b_ld, c_ld, count,
+//     the indices of the entries of the bucket
+//
+// The buckets appear in the order of their first entry, and the indices
+// of the entries of a bucket are ascending.
+#define PLAN_HEADER_SIZE 3
+#define PLAN_BUCKET_KEY_SIZE 8
+
+/**
+* The CLBlast functions that are used for one bucket of a grouped GEMM
+* with the scalar type T, and their names for the kernel cache accounting
+*/
+template <typename T>
+struct GroupedGemmFunctions
+{
+    CLBlastStatusCode (*gemm)(CLBlastLayout, CLBlastTranspose, CLBlastTranspose,
+        size_t, size_t, size_t, T, cl_mem, size_t, size_t, cl_mem, size_t, size_t,
+        T, cl_mem, size_t, size_t, cl_command_queue*, cl_event*);
+    CLBlastStatusCode (*batched)(CLBlastLayout, CLBlastTranspose, CLBlastTranspose,
+        size_t, size_t, size_t, const T*, cl_mem, const size_t*, size_t, cl_mem, const size_t*, size_t,
+        const T*, cl_mem, const size_t*, size_t, size_t, cl_command_queue*, cl_event*);
+    CLBlastStatusCode (*stridedBatched)(CLBlastLayout, CLBlastTranspose, CLBlastTranspose,
+        size_t, size_t, size_t, T, cl_mem, size_t, size_t, size_t, cl_mem, size_t, size_t, size_t,
+        T, cl_mem, size_t, size_t, size_t, size_t, cl_command_queue*, cl_event*);
+    const char *gemmName;
+    const char *batchedName;
+    const char *stridedBatchedName;
+};
+
+static const GroupedGemmFunctions<float> groupedGemm_float = { CLBlastSgemm, CLBlastSgemmBatched, CLBlastSgemmStridedBatched, "CLBlastSgemm", "CLBlastSgemmBatched", "CLBlastSgemmStridedBatched" };
+static const GroupedGemmFunctions<double> groupedGemm_double = { CLBlastDgemm, CLBlastDgemmBatched, CLBlastDgemmStridedBatched, "CLBlastDgemm", "CLBlastDgemmBatched", "CLBlastDgemmStridedBatched" };
+static const GroupedGemmFunctions<cl_float2> groupedGemm_float2 = { CLBlastCgemm, CLBlastCgemmBatched, CLBlastCgemmStridedBatched, "CLBlastCgemm", "CLBlastCgemmBatched", "CLBlastCgemmStridedBatched" };
+static const GroupedGemmFunctions<cl_double2> groupedGemm_double2 = { CLBlastZgemm, CLBlastZgemmBatched, CLBlastZgemmStridedBatched, "CLBlastZgemm", "CLBlastZgemmBatched", "CLBlastZgemmStridedBatched" };
+static const GroupedGemmFunctions<cl_half> groupedGemm_half = { CLBlastHgemm, CLBlastHgemmBatched, CLBlastHgemmStridedBatched, "CLBlastHgemm", "CLBlastHgemmBatched", "CLBlastHgemmStridedBatched" };
+
+/**
+* Conversion of the scalar with the given index from the given array of
+* double values, which contains interleaved real and imaginary parts for
+* the complex types
+*/
+static void toScalar(const jdouble *values, size_t index, float &scalar) { scalar = (float)values[index]; }
+static void toScalar(const jdouble *values, size_t index, double &scalar) { scalar = (double)values[index]; }
+static void toScalar(const jdouble *values, size_t index, cl_half &scalar) { scalar = FloatToHalf((float)values[index]); }
+static void toScalar(const jdouble *values, size_t index, cl_float2 &scalar)
+{
+    scalar.s[0] = (float)values[2 * index];
+    scalar.s[1] = (float)values[2 * index + 1];
+}
+static void toScalar(const jdouble *values, size_t index, cl_double2 &scalar)
+{
+    scalar.s[0] = (double)values[2 * index];
+    scalar.s[1] = (double)values[2 * index + 1];
+}
+
+/**
+* Returns the number of double values per scalar for the given type
+*/
+template <typename T> static size_t scalarValues() { return 1; }
+template <> size_t scalarValues<cl_float2>() { return 2; }
+template <> size_t scalarValues<cl_double2>() { return 2; }
+
+/**
+* Returns whether the offsets with the given indices are equally spaced
+* with a non-negative stride, and store the stride in the given value
+*/
+static bool isStrided(const std::vector<jlong> &offsets, const jlong *indices, size_t count, size_t &stride)
+{
+    jlong first = offsets[(size_t)indices[0]];
+    jlong difference = offsets[(size_t)indices[1]] - first;
+    if (difference < 0)
+    {
+        return false;
+    }
+    for (size_t i = 2; i < count; i++)
+    {
+        if (offsets[(size_t)indices[i]] - first != (jlong)i * difference)
+        {
+            return false;
+        }
+    }
+    stride = (size_t)difference;
+    return true;
+}
+
+/**
+* Returns whether the scalars of all entries with the given indices are
+* equal
+*/
+static bool hasUniformScalars(const jdouble *values, size_t valuesPerScalar, const jlong *indices, size_t count)
+{
+    const jdouble *first = values + valuesPerScalar * (size_t)indices[0];
+    for (size_t i = 1; i < count; i++)
+    {
+        const jdouble *other = values + valuesPerScalar * (size_t)indices[i];
+        for (size_t j = 0; j < valuesPerScalar; j++)
+        {
+            if (other[j] != first[j]) return false;
+        }
+    }
+    return true;
+}
+
+/**
+* The arguments of the execution of a grouped GEMM plan
+*/
+struct GroupedGemmArguments
+{
+    const jlong *plan;
+    const jdouble *alphas;
+    const jdouble *betas;
+    cl_mem a_buffer;
+    cl_mem b_buffer;
+    cl_mem c_buffer;
+    std::vector<jlong> a_offsets;
+    std::vector<jlong> b_offsets;
+    std::vector<jlong> c_offsets;
+    cl_command_queue *queue;
+    cl_event *event;
+};
+
+/**
+* Execute the grouped GEMM plan with the given arguments, using one
+* CLBlast call for each bucket: A plain GEMM for a single entry, a
+* strided-batched GEMM when the offsets of all matrices are equally
+* spaced and the scalars are uniform, and a batched GEMM otherwise.
+* Each call receives its own event, and the event of the caller is a
+* marker that waits for all of them.
+*/
+template <typename T>
+static CLBlastStatusCode executeGroupedGemm(const GroupedGemmFunctions<T> &functions, const GroupedGemmArguments &args)
+{
+    const jlong *plan = args.plan;
+    CLBlastLayout layout = (CLBlastLayout)plan[0];
+    size_t bucketCount = (size_t)plan[2];
+    size_t valuesPerScalar = scalarValues<T>();
+    std::vector<T> alphas;
+    std::vector<T> betas;
+    std::vector<size_t> a_offsets;
+    std::vector<size_t> b_offsets;
+    std::vector<size_t> c_offsets;
+    BatchEvents bucketEvents(bucketCount, args.event);
+
+    size_t position = PLAN_HEADER_SIZE;
+    for (size_t b = 0; b < bucketCount; b++)
+    {
+        const jlong *key = plan + position;
+        CLBlastTranspose a_transpose = (CLBlastTranspose)key[0];
+        CLBlastTranspose b_transpose = (CLBlastTranspose)key[1];
+        size_t m = (size_t)key[2];
+        size_t n = (size_t)key[3];
+        size_t k = (size_t)key[4];
+        size_t a_ld = (size_t)key[5];
+        size_t b_ld = (size_t)key[6];
+        size_t c_ld = (size_t)key[7];
+        size_t count = (size_t)key[PLAN_BUCKET_KEY_SIZE];
+        const jlong *indices = key + PLAN_BUCKET_KEY_SIZE + 1;
+        position += PLAN_BUCKET_KEY_SIZE + 1 + count;
+
+        cl_event *event = bucketEvents.get(b);
+        size_t first = (size_t)indices[0];
+        T alpha;
+        T beta;
+        toScalar(args.alphas, first, alpha);
+        toScalar(args.betas, first, beta);
+        CLBlastStatusCode result;
+        const char *name;
+        size_t a_stride = 0;
+        size_t b_stride = 0;
+        size_t c_stride = 0;
+        if (count == 1)
+        {
+            name = functions.gemmName;
+            result = functions.gemm(layout, a_transpose, b_transpose, m, n, k,
+                alpha, args.a_buffer, (size_t)args.a_offsets[first], a_ld,
+                args.b_buffer, (size_t)args.b_offsets[first], b_ld,
+                beta, args.c_buffer, (size_t)args.c_offsets[first], c_ld,
+                args.queue, event);
+        }
+        else if (isStrided(args.a_offsets, indices, count, a_stride) &&
+            isStrided(args.b_offsets, indices, count, b_stride) &&
+            isStrided(args.c_offsets, indices, count, c_stride) &&
+            hasUniformScalars(args.alphas, valuesPerScalar, indices, count) &&
+            hasUniformScalars(args.betas, valuesPerScalar, indices, count))
+        {
+            name = functions.stridedBatchedName;
+            result = functions.stridedBatched(layout, a_transpose, b_transpose, m, n, k,
+                alpha, args.a_buffer, (size_t)args.a_offsets[first], a_ld, a_stride,
+                args.b_buffer, (size_t)args.b_offsets[first], b_ld, b_stride,
+                beta, args.c_buffer, (size_t)args.c_offsets[first], c_ld, c_stride,
+                count, args.queue, event);
+        }
+        else
+        {
+            alphas.resize(count);
+            betas.resize(count);
+            a_offsets.resize(count);
+            b_offsets.resize(count);
+            c_offsets.resize(count);
+            for (size_t i = 0; i < count; i++)
+            {
+                size_t index = (size_t)indices[i];
+                toScalar(args.alphas, index, alphas[i]);
+                toScalar(args.betas, index, betas[i]);
+                a_offsets[i] = (size_t)args.a_offsets[index];
+                b_offsets[i] = (size_t)args.b_offsets[index];
+                c_offsets[i] = (size_t)args.c_offsets[index];
+            }
+            name = functions.batchedName;
+            result = functions.batched(layout, a_transpose, b_transpose, m, n, k,
+                alphas.data(), args.a_buffer, a_offsets.data(), a_ld,
+                args.b_buffer, b_offsets.data(), b_ld,
+                betas.data(), args.c_buffer, c_offsets.data(), c_ld,
+                count, args.queue, event);
+        }
+        if (result != CLBlastSuccess)
+        {
+            return result;
+        }
+        trackKernelCacheUse(name, *args.queue, result);
+    }
+    return bucketEvents.finish(args.queue);
+}
+
+/**
+* Copy the contents of the given Java array into the given vector.
+* Returns false if a Java exception was thrown.
+*/
+static bool readLongArray(JNIEnv *env, jlongArray array, std::vector<jlong> &values)
+{
+    jsize length = env->GetArrayLength(array);
+    values.resize((size_t)length);
+    env->GetLongArrayRegion(array, 0, length, values.data());
+    return !env->ExceptionCheck();
+}
+
+/**
+* Copy the contents of the given Java array into the given vector.
+* Returns false if a Java exception was thrown.
+*/
+static bool readDoubleArray(JNIEnv *env, jdoubleArray array, std::vector<jdouble> &values)
+{
+    jsize length = env->GetArrayLength(array);
+    values.resize((size_t)length);
+    env->GetDoubleArrayRegion(array, 0, length, values.data());
+    return !env->ExceptionCheck();
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlastGroupedGemm
+* Method:    createPlanNative
+* Signature: (I[I[I[J[J[J[J[J[J)[J
+*/
+JNIEXPORT jlongArray JNICALL Java_org_jocl_blast_CLBlastGroupedGemm_createPlanNative
+(JNIEnv *env, jclass UNUSED(cls), jint layout, jintArray a_transposes, jintArray b_transposes,
+    jlongArray m, jlongArray n, jlongArray k, jlongArray a_ld, jlongArray b_ld, jlongArray c_ld)
+{
+    jsize count = env->GetArrayLength(m);
+    std::vector<jint> transposes((size_t)count * 2);
+    env->GetIntArrayRegion(a_transposes, 0, count, transposes.data());
+    env->GetIntArrayRegion(b_transposes, 0, count, transposes.data() + count);
+    std::vector<jlong> shapes[6];
+    jlongArray shapeArrays[6] = { m, n, k, a_ld, b_ld, c_ld };
+    for (int i = 0; i < 6; i++)
+    {
+        if (!readLongArray(env, shapeArrays[i], shapes[i])) return nullptr;
+    }
+    if (env->ExceptionCheck()) return nullptr;
+
+    // Assign each entry to the bucket of its parameters, where the
+    // buckets are numbered in the order of their first entry
+    typedef std::vector<jlong> BucketKey;
+    std::map<BucketKey, size_t> bucketIndices;
+    std::vector<BucketKey> bucketKeys;
+    std::vector<std::vector<jlong> > bucketEntries;
+    for (jsize i = 0; i < count; i++)
+    {
+        BucketKey key(PLAN_BUCKET_KEY_SIZE);
+        key[0] = transposes[(size_t)i];
+        key[1] = transposes[(size_t)(count + i)];
+        for (int j = 0; j < 6; j++)
+        {
+            key[2 + j] = shapes[j][(size_t)i];
+        }
+        std::map<BucketKey, size_t>::iterator it = bucketIndices.find(key);
+        size_t bucket;
+        if (it == bucketIndices.end())
+        {
+            bucket = bucketKeys.size();
+            bucketIndices[key] = bucket;
+            bucketKeys.push_back(key);
+            bucketEntries.push_back(std::vector<jlong>());
+        }
+        else
+        {
+            bucket = it->second;
+        }
+        bucketEntries[bucket].push_back((jlong)i);
+    }
+
+    std::vector<jlong> plan;
+    plan.push_back((jlong)layout);
+    plan.push_back((jlong)count);
+    plan.push_back((jlong)bucketKeys.size());
+    for (size_t b = 0; b < bucketKeys.size(); b++)
+    {
+        plan.insert(plan.end(), bucketKeys[b].begin(), bucketKeys[b].end());
+        plan.push_back((jlong)bucketEntries[b].size());
+        plan.insert(plan.end(), bucketEntries[b].begin(), bucketEntries[b].end());
+    }
+    Logger::log(LOG_DEBUGTRACE, "Created grouped GEMM plan with %d buckets for %d entries\n",
+        (int)bucketKeys.size(), (int)count);
+
+    jlongArray result = env->NewLongArray((jsize)plan.size());
+    if (result == nullptr) return nullptr;
+    env->SetLongArrayRegion(result, 0, (jsize)plan.size(), plan.data());
+    return result;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastGroupedGemm
+* Method:    executeNative
+* Signature: ([JI[DLorg/jocl/cl_mem;[JLorg/jocl/cl_mem;[J[DLorg/jocl/cl_mem;[JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastGroupedGemm_executeNative
+(JNIEnv *env, jclass UNUSED(cls), jlongArray plan, jint precision, jdoubleArray alphas,
+    jobject a_buffer, jlongArray a_offsets, jobject b_buffer, jlongArray b_offsets,
+    jdoubleArray betas, jobject c_buffer, jlongArray c_offsets,
+    jobject queue, jobjectArray waitList, jobject event)
+{
+    GroupedGemmArguments args;
+    args.a_buffer = nullptr;
+    args.b_buffer = nullptr;
+    args.c_buffer = nullptr;
+    args.queue = nullptr;
+    args.event = nullptr;
+    if (!initNative(env, a_buffer, args.a_buffer, true)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    if (!initNative(env, b_buffer, args.b_buffer, true)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    if (!initNative(env, c_buffer, args.c_buffer, true)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    if (!initNative(env, queue, args.queue, true)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    if (!initNative(env, event, args.event, false)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    if (!readLongArray(env, a_offsets, args.a_offsets)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    if (!readLongArray(env, b_offsets, args.b_offsets)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    if (!readLongArray(env, c_offsets, args.c_offsets)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+
+    std::vector<jlong> plan_native;
+    std::vector<jdouble> alphas_native;
+    std::vector<jdouble> betas_native;
+    if (!readLongArray(env, plan, plan_native)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    if (!readDoubleArray(env, alphas, alphas_native)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    if (!readDoubleArray(env, betas, betas_native)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    args.plan = plan_native.data();
+    args.alphas = alphas_native.data();
+    args.betas = betas_native.data();
+
+    switch (precision)
+    {
+        case CLBlastPrecisionHalf:
+        case CLBlastPrecisionSingle:
+        case CLBlastPrecisionDouble:
+        case CLBlastPrecisionComplexSingle:
+        case CLBlastPrecisionComplexDouble:
+            break;
+        default:
+            return CLBlastNotImplemented;
+    }
+
+    // The wait list is enqueued only after all arguments have been
+    // converted, directly before the GEMM calls
+    cl_int waitList_result = enqueueWaitList(env, args.queue, waitList);
+    if (waitList_result != CL_SUCCESS)
+    {
+        return (jint)waitList_result;
+    }
+
+    CLBlastStatusCode result;
+    switch (precision)
+    {
+        case CLBlastPrecisionHalf: result = executeGroupedGemm(groupedGemm_half, args); break;
+        case CLBlastPrecisionSingle: result = executeGroupedGemm(groupedGemm_float, args); break;
+        case CLBlastPrecisionDouble: result = executeGroupedGemm(groupedGemm_double, args); break;
+        case CLBlastPrecisionComplexSingle: result = executeGroupedGemm(groupedGemm_float2, args); break;
+        case CLBlastPrecisionComplexDouble: result = executeGroupedGemm(groupedGemm_double2, args); break;
+        default: result = CLBlastNotImplemented; break;
+    }
+
+    if (!releaseNative(env, args.event, event, true)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    return (jint)result;
+}
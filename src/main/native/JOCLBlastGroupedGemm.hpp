@@ -0,0 +1,56 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_jocl_blast_CLBlastGroupedGemm */
+
+#ifndef _Included_org_jocl_blast_CLBlastGroupedGemm
+#define _Included_org_jocl_blast_CLBlastGroupedGemm
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_jocl_blast_CLBlastGroupedGemm
+ * Method:    createPlanNative
+ * Signature: (I[I[I[J[J[J[J[J[J)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_org_jocl_blast_CLBlastGroupedGemm_createPlanNative
+  (JNIEnv *, jclass, jint, jintArray, jintArray, jlongArray, jlongArray, jlongArray, jlongArray, jlongArray, jlongArray);
+
+/*
+ * Class:     org_jocl_blast_CLBlastGroupedGemm
+ * Method:    executeNative
+ * Signature: ([JI[DLorg/jocl/cl_mem;[JLorg/jocl/cl_mem;[J[DLorg/jocl/cl_mem;[JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastGroupedGemm_executeNative
+  (JNIEnv *, jclass, jlongArray, jint, jdoubleArray, jobject, jlongArray, jobject, jlongArray, jdoubleArray, jobject, jlongArray, jobject, jobjectArray, jobject);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,590 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlast.hpp"
+#include "JOCLBlastKernelCache.hpp"
+#include "JOCLBlastRoutines.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+
+std::atomic<bool> kernelCacheTrackingEnabled(false);
+
+// The number of values that are passed to Java for each entry: The
+// device handle, the precision, the number of calls, the time since
+// the last call, in nanoseconds, and whether the kernels can be
+// compiled again after an eviction
+#define KERNEL_CACHE_ENTRY_VALUES 5
+
+/**
+* The key of an entry of the kernel cache accounting: The device and
+* the context, and the operation and precision that determine the 
+* compiled kernels. CLBlast caches the programs for each context, so
+* the same device in two contexts has two entries.
+*/
+struct KernelCacheKey
+{
+    cl_device_id device;
+    cl_context context;
+    std::string operation;
+    CLBlastPrecision precision;
+
+    bool operator<(const KernelCacheKey &other) const
+    {
+        if (device != other.device) return device < other.device;
+        if (context != other.context) return context < other.context;
+        if (precision != other.precision) return precision < other.precision;
+        return operation < other.operation;
+    }
+};
+
+/**
+* An entry of the kernel cache accounting. The context of the key is
+* retained as long as the entry exists, so that the kernels can be 
+* compiled again after the cache was cleared.
+*/
+struct KernelCacheEntry
+{
+    int64_t calls;
+    std::chrono::steady_clock::time_point lastUse;
+};
+
+static std::map<KernelCacheKey, KernelCacheEntry> kernelCacheEntries;
+static std::mutex kernelCacheMutex;
+
+// The maximum number of entries, or 0 if the number is not limited
+static size_t kernelCacheLimit = 0;
+
+// The time when the limit was last found to be exceeded, or changed
+static std::chrono::steady_clock::time_point lastKernelCacheLimitCheck;
+
+// The names of the devices, which are only queried once per device
+static std::map<cl_device_id, std::string> kernelCacheDeviceNames;
+
+/**
+* Returns the name of the given device. The kernel cache mutex must
+* be held.
+*/
+static std::string obtainDeviceName(cl_device_id device)
+{
+    std::map<cl_device_id, std::string>::const_iterator it = kernelCacheDeviceNames.find(device);
+    if (it != kernelCacheDeviceNames.end())
+    {
+        return it->second;
+    }
+    std::string name;
+    size_t size = 0;
+    if (clGetDeviceInfo(device, CL_DEVICE_NAME, 0, nullptr, &size) == CL_SUCCESS && size > 0)
+    {
+        std::vector<char> buffer(size);
+        if (clGetDeviceInfo(device, CL_DEVICE_NAME, size, buffer.data(), nullptr) == CL_SUCCESS)
+        {
+            name = std::string(buffer.data());
+        }
+    }
+    kernelCacheDeviceNames[device] = name;
+    return name;
+}
+
+/**
+* Split a routine name like "CLBlastSgemmBatched" or "CLBlastiCamax"
+* into the name of the operation that determines the compiled kernels
+* and the precision. The variants of a routine that use the same
+* kernels, like the dotu and dotc routines, or the GEMM routines with
+* temporary buffers, are mapped to the same operation. Returns false
+* if the routine does not compile kernels.
+*/
+static bool parseRoutineName(const char *routineName, std::string &operation, CLBlastPrecision &precision)
+{
+    std::string name(routineName);
+    const std::string prefix = "CLBlast";
+    if (name.compare(0, prefix.size(), prefix) != 0)
+    {
+        return false;
+    }
+    name = name.substr(prefix.size());
+    if (name.size() > 1 && name[0] == 'i')
+    {
+        name = name.substr(1);
+    }
+    if (name.size() < 2)
+    {
+        return false;
+    }
+    switch (name[0])
+    {
+        case 'H': precision = CLBlastPrecisionHalf; break;
+        case 'S': precision = CLBlastPrecisionSingle; break;
+        case 'D': precision = CLBlastPrecisionDouble; break;
+        case 'C': precision = CLBlastPrecisionComplexSingle; break;
+        case 'Z': precision = CLBlastPrecisionComplexDouble; break;
+        default: return false;
+    }
+    operation = name.substr(1);
+
+    // Functions like CLBlastSGemmTempBufferSize do not compile kernels
+    if (operation[0] < 'a' || operation[0] > 'z')
+    {
+        return false;
+    }
+
+    // The real-valued routines for complex vectors, like CLBlastScasum
+    if (operation.size() > 4 && (operation[0] == 'c' || operation[0] == 'z'))
+    {
+        std::string rest = operation.substr(1);
+        if (rest == "asum" || rest == "nrm2" || rest == "sum")
+        {
+            precision = (precision == CLBlastPrecisionSingle) ?
+                CLBlastPrecisionComplexSingle : CLBlastPrecisionComplexDouble;
+            operation = rest;
+        }
+    }
+    const std::string suffixes[] = { "WithTempBuffer", "Pooled" };
+    for (size_t i = 0; i < 2; i++)
+    {
+        const std::string &suffix = suffixes[i];
+        if (operation.size() > suffix.size() &&
+            operation.compare(operation.size() - suffix.size(), suffix.size(), suffix) == 0)
+        {
+            operation = operation.substr(0, operation.size() - suffix.size());
+        }
+    }
+    if (operation == "dotu" || operation == "dotc") operation = "dot";
+    if (operation == "geru" || operation == "gerc") operation = "ger";
+    return true;
+}
+
+/**
+* Obtain the operations whose kernels may be compiled by a call of the
+* given operation. The batched level-2 routines are executed as a loop
+* over the level-2 routine. The batched GEMV is executed with the
+* (strided) batched GEMM instead, when it can be mapped onto it, so the
+* kernels of both operations may be used.
+*/
+static void kernelOperations(const std::string &operation, std::vector<std::string> &operations)
+{
+    operations.clear();
+    const std::string suffixes[] = { "StridedBatched", "Batched" };
+    for (size_t i = 0; i < 2; i++)
+    {
+        const std::string &suffix = suffixes[i];
+        if (operation.size() <= suffix.size() ||
+            operation.compare(operation.size() - suffix.size(), suffix.size(), suffix) != 0)
+        {
+            continue;
+        }
+        std::string base = operation.substr(0, operation.size() - suffix.size());
+        if (base == "gemv")
+        {
+            operations.push_back("gemm" + suffix);
+            operations.push_back(base);
+            return;
+        }
+        if (base == "trsv")
+        {
+            operations.push_back(base);
+            return;
+        }
+        if (base == "ger" || base == "geru" || base == "gerc")
+        {
+            operations.push_back("ger");
+            return;
+        }
+        break;
+    }
+    operations.push_back(operation);
+}
+
+/**
+* An eviction that has been prepared while the kernel cache mutex was
+* held, and that is performed after the mutex was released: The
+* contexts of the removed entries, and the warmup requests for the
+* entries that are kept. The contexts of the requests are retained.
+*/
+struct KernelCacheEviction
+{
+    int evicted;
+    std::vector<cl_context> releasedContexts;
+    std::vector<WarmupRequest> requests;
+
+    KernelCacheEviction() : evicted(0) {}
+};
+
+/**
+* Prepare the eviction of the entries for which the given predicate is
+* true. Since CLBlast can only clear the whole cache, the entries that
+* are kept have to be compiled again with the warmup. If one of them
+* belongs to an operation that the warmup can not compile, then nothing
+* is evicted. The kernel cache mutex must be held.
+*/
+template <typename Predicate>
+static KernelCacheEviction prepareKernelCacheEviction(Predicate predicate)
+{
+    KernelCacheEviction eviction;
+    std::map<KernelCacheKey, KernelCacheEntry>::iterator it;
+    bool matched = false;
+    for (it = kernelCacheEntries.begin(); it != kernelCacheEntries.end(); ++it)
+    {
+        if (predicate(it->first, it->second))
+        {
+            matched = true;
+        }
+        else if (!canWarmup(it->first.operation, it->first.precision))
+        {
+            Logger::log(LOG_DEBUG, "Not evicting kernel cache entries, because the kernels for %s with precision %d can not be compiled again\n",
+                it->first.operation.c_str(), (int)it->first.precision);
+            return eviction;
+        }
+    }
+    if (!matched)
+    {
+        return eviction;
+    }
+    it = kernelCacheEntries.begin();
+    while (it != kernelCacheEntries.end())
+    {
+        if (predicate(it->first, it->second))
+        {
+            eviction.releasedContexts.push_back(it->first.context);
+            it = kernelCacheEntries.erase(it);
+            eviction.evicted++;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    // The entries that are kept are compiled again in their context,
+    // grouped by device and context
+    for (it = kernelCacheEntries.begin(); it != kernelCacheEntries.end(); ++it)
+    {
+        if (eviction.requests.empty() || 
+            eviction.requests.back().device != it->first.device ||
+            eviction.requests.back().context != it->first.context)
+        {
+            WarmupRequest request;
+            request.context = it->first.context;
+            request.device = it->first.device;
+            clRetainContext(request.context);
+            eviction.requests.push_back(request);
+        }
+        eviction.requests.back().operations.push_back(it->first.operation);
+        eviction.requests.back().precisions.push_back(it->first.precision);
+    }
+    return eviction;
+}
+
+/**
+* Perform the given eviction: Clear the CLBlast kernel cache, start the
+* warmup for the entries that are kept, and release the contexts. The
+* kernel cache mutex must not be held, so that the routine calls are not
+* blocked by this. Returns the number of removed entries.
+*/
+static int performKernelCacheEviction(const KernelCacheEviction &eviction)
+{
+    if (eviction.evicted == 0)
+    {
+        return 0;
+    }
+    CLBlastClearCache();
+    for (size_t i = 0; i < eviction.requests.size(); i++)
+    {
+        startBackgroundWarmup(eviction.requests[i]);
+        clReleaseContext(eviction.requests[i].context);
+    }
+    for (size_t i = 0; i < eviction.releasedContexts.size(); i++)
+    {
+        clReleaseContext(eviction.releasedContexts[i]);
+    }
+    Logger::log(LOG_DEBUG, "Evicted %d kernel cache entries, recompiling the remaining entries\n",
+        eviction.evicted);
+    return eviction.evicted;
+}
+
+/**
+* A predicate that is true for the entries that have not been used since
+* the given time
+*/
+struct UnusedSince
+{
+    std::chrono::steady_clock::time_point time;
+
+    bool operator()(const KernelCacheKey &UNUSED(key), const KernelCacheEntry &entry) const
+    {
+        return entry.lastUse <= time;
+    }
+};
+
+/**
+* A predicate that is true for the entries that match the given device,
+* operation and precision, where a value of nullptr, an empty string
+* or 0 matches all entries
+*/
+struct KernelCacheFilter
+{
+    cl_device_id device;
+    std::string operation;
+    int precision;
+
+    bool operator()(const KernelCacheKey &key, const KernelCacheEntry &UNUSED(entry)) const
+    {
+        return (device == nullptr || key.device == device) &&
+            (operation.empty() || key.operation == operation) &&
+            (precision == 0 || (int)key.precision == precision);
+    }
+};
+
+/**
+* Prepare the eviction of the least recently used entries when there are
+* more entries than the limit. The number of entries is reduced to three
+* quarters of the limit, so that not every new entry causes the cache to
+* be cleared. Only the entries that have not been used since the limit
+* was last found to be exceeded are evicted, and only when they are at
+* least a quarter of the limit, so that a working set that is larger than
+* the limit does not cause the cache to be cleared and compiled again
+* repeatedly. The kernel cache mutex must be held.
+*/
+static KernelCacheEviction prepareKernelCacheLimit()
+{
+    if (kernelCacheLimit == 0 || kernelCacheEntries.size() <= kernelCacheLimit)
+    {
+        return KernelCacheEviction();
+    }
+    size_t keep = kernelCacheLimit - kernelCacheLimit / 4;
+    size_t minimum = std::max((size_t)1, kernelCacheLimit / 4);
+    std::vector<std::chrono::steady_clock::time_point> times;
+    std::map<KernelCacheKey, KernelCacheEntry>::const_iterator it;
+    for (it = kernelCacheEntries.begin(); it != kernelCacheEntries.end(); ++it)
+    {
+        if (it->second.lastUse <= lastKernelCacheLimitCheck)
+        {
+            times.push_back(it->second.lastUse);
+        }
+    }
+    lastKernelCacheLimitCheck = std::chrono::steady_clock::now();
+    if (times.size() < minimum)
+    {
+        return KernelCacheEviction();
+    }
+    std::sort(times.begin(), times.end());
+    size_t count = std::min(times.size(), kernelCacheEntries.size() - keep);
+    UnusedSince predicate;
+    predicate.time = times[count - 1];
+    return prepareKernelCacheEviction(predicate);
+}
+
+void recordKernelCacheUse(const Routine &routine,
+    const ArgumentKind *kinds, int count, const NativeValue *nativeValues)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (kinds[i] == ARGUMENT_QUEUE || kinds[i] == ARGUMENT_QUEUE_WAIT_LIST)
+        {
+            recordKernelCacheUse(routine.name, *nativeValues[i].queue);
+            return;
+        }
+    }
+}
+
+void recordKernelCacheUse(const char *routineName, cl_command_queue queue)
+{
+    KernelCacheKey key;
+    std::string operation;
+    if (routineName == nullptr || queue == nullptr || !parseRoutineName(routineName, operation, key.precision))
+    {
+        return;
+    }
+    if (clGetCommandQueueInfo(queue, CL_QUEUE_DEVICE, sizeof(cl_device_id), &key.device, nullptr) != CL_SUCCESS ||
+        clGetCommandQueueInfo(queue, CL_QUEUE_CONTEXT, sizeof(cl_context), &key.context, nullptr) != CL_SUCCESS)
+    {
+        return;
+    }
+    std::vector<std::string> operations;
+    kernelOperations(operation, operations);
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    KernelCacheEviction eviction;
+    {
+        std::lock_guard<std::mutex> lock(kernelCacheMutex);
+        bool added = false;
+        for (size_t i = 0; i < operations.size(); i++)
+        {
+            key.operation = operations[i];
+            std::map<KernelCacheKey, KernelCacheEntry>::iterator it = kernelCacheEntries.find(key);
+            if (it != kernelCacheEntries.end())
+            {
+                it->second.calls++;
+                it->second.lastUse = now;
+                continue;
+            }
+            KernelCacheEntry entry;
+            clRetainContext(key.context);
+            entry.calls = 1;
+            entry.lastUse = now;
+            kernelCacheEntries[key] = entry;
+            added = true;
+        }
+        if (!added)
+        {
+            return;
+        }
+        eviction = prepareKernelCacheLimit();
+    }
+    performKernelCacheEviction(eviction);
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    setKernelCacheTrackingEnabledNative
+* Signature: (Z)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setKernelCacheTrackingEnabledNative
+(JNIEnv *env, jclass UNUSED(cls), jboolean enabled)
+{
+    Logger::log(LOG_TRACE, "Executing setKernelCacheTrackingEnabled(enabled=%d)\n", (int)enabled);
+    kernelCacheTrackingEnabled.store(enabled == JNI_TRUE);
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    setKernelCacheLimitNative
+* Signature: (I)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setKernelCacheLimitNative
+(JNIEnv *env, jclass UNUSED(cls), jint limit)
+{
+    Logger::log(LOG_TRACE, "Executing setKernelCacheLimit(limit=%d)\n", (int)limit);
+    KernelCacheEviction eviction;
+    {
+        std::lock_guard<std::mutex> lock(kernelCacheMutex);
+        kernelCacheLimit = (size_t)limit;
+        lastKernelCacheLimitCheck = std::chrono::steady_clock::now();
+        eviction = prepareKernelCacheLimit();
+    }
+    performKernelCacheEviction(eviction);
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    evictKernelCacheNative
+* Signature: (JLjava/lang/String;I)I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_evictKernelCacheNative
+(JNIEnv *env, jclass UNUSED(cls), jlong device, jstring operation, jint precision)
+{
+    Logger::log(LOG_TRACE, "Executing evictKernelCache(device=%p, operation=%p, precision=%d)\n",
+        (void*)device, (void*)operation, (int)precision);
+    KernelCacheFilter filter;
+    filter.device = (cl_device_id)device;
+    filter.precision = (int)precision;
+    if (operation != nullptr)
+    {
+        char *operation_native = nullptr;
+        if (!initNative(env, operation, operation_native, true)) return 0;
+        filter.operation = operation_native;
+        releaseNative(env, operation_native, operation, false);
+    }
+    KernelCacheEviction eviction;
+    {
+        std::lock_guard<std::mutex> lock(kernelCacheMutex);
+        eviction = prepareKernelCacheEviction(filter);
+    }
+    return (jint)performKernelCacheEviction(eviction);
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    getKernelCacheNative
+* Signature: ()[Ljava/lang/Object;
+*/
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_getKernelCacheNative
+(JNIEnv *env, jclass UNUSED(cls))
+{
+    Logger::log(LOG_TRACE, "Executing getKernelCache()\n");
+
+    // Copy the entries, so that the JNI calls are not done while the
+    // routine calls are blocked
+    std::vector<std::pair<KernelCacheKey, KernelCacheEntry> > entries;
+    std::vector<std::string> deviceNames;
+    {
+        std::lock_guard<std::mutex> lock(kernelCacheMutex);
+        entries.assign(kernelCacheEntries.begin(), kernelCacheEntries.end());
+        for (size_t i = 0; i < entries.size(); i++)
+        {
+            deviceNames.push_back(obtainDeviceName(entries[i].first.device));
+        }
+    }
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    // The result contains a String[] with the device name and operation
+    // of each entry, and a long[] with the values of each entry
+    jclass Object_Class = env->FindClass("java/lang/Object");
+    if (Object_Class == nullptr) return nullptr;
+    jclass String_Class = env->FindClass("java/lang/String");
+    if (String_Class == nullptr) return nullptr;
+    jobjectArray result = env->NewObjectArray(2, Object_Class, nullptr);
+    if (result == nullptr) return nullptr;
+    jsize entryCount = (jsize)entries.size();
+    jobjectArray strings = env->NewObjectArray(entryCount * 2, String_Class, nullptr);
+    if (strings == nullptr) return nullptr;
+    std::vector<jlong> values;
+    values.reserve(entries.size() * KERNEL_CACHE_ENTRY_VALUES);
+    for (jsize i = 0; i < entryCount; i++)
+    {
+        const KernelCacheKey &key = entries[i].first;
+        const KernelCacheEntry &entry = entries[i].second;
+        const std::string *keyStrings[] = { &deviceNames[(size_t)i], &key.operation };
+        for (int j = 0; j < 2; j++)
+        {
+            jstring string = env->NewStringUTF(keyStrings[j]->c_str());
+            if (string == nullptr) return nullptr;
+            env->SetObjectArrayElement(strings, i * 2 + j, string);
+            env->DeleteLocalRef(string);
+        }
+        values.push_back((jlong)key.device);
+        values.push_back((jlong)key.precision);
+        values.push_back((jlong)entry.calls);
+        values.push_back((jlong)std::chrono::duration_cast<std::chrono::nanoseconds>(now - entry.lastUse).count());
+        values.push_back(canWarmup(key.operation, key.precision) ? 1 : 0);
+    }
+    jlongArray valuesArray = env->NewLongArray((jsize)values.size());
+    if (valuesArray == nullptr) return nullptr;
+    env->SetLongArrayRegion(valuesArray, 0, (jsize)values.size(), values.data());
+    env->SetObjectArrayElement(result, 0, strings);
+    env->SetObjectArrayElement(result, 1, valuesArray);
+    return result;
+}
@@ -0,0 +1,99 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef JOCL_BLAST_KERNEL_CACHE_HPP
+#define JOCL_BLAST_KERNEL_CACHE_HPP
+
+#include <CL/cl.h>
+#include <clblast_c.h>
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+// The accounting of the CLBlast kernel cache. The calls of the routines
+// are recorded in JOCLBlastKernelCache.cpp, by recordKernelCacheUse,
+// which is declared in JOCLBlastRoutines.hpp. Since CLBlast can only
+// clear its whole cache, the kernels that should be kept after an
+// eviction are compiled again, with the warmup from JOCLBlastWarmup.cpp.
+// An eviction is only done when the warmup can compile all of them.
+// The calls that do not use callRoutine, like the CLBlastFast methods,
+// the command lists, the reductions, the grouped GEMMs and the plans,
+// record their calls with trackKernelCacheUse.
+
+// Whether the use of the kernel cache is recorded
+extern std::atomic<bool> kernelCacheTrackingEnabled;
+
+/**
+* Record that the kernels of the CLBlast routine with the given name,
+* like "CLBlastSgemm", have been used on the device of the given queue.
+* When the number of recorded entries exceeds the limit, the least
+* recently used entries are evicted.
+*/
+void recordKernelCacheUse(const char *routineName, cl_command_queue queue);
+
+/**
+* Record the call of the CLBlast routine with the given name on the
+* given queue with recordKernelCacheUse, if the call was successful
+* and the kernel cache tracking is enabled
+*/
+inline void trackKernelCacheUse(const char *routineName, cl_command_queue queue, CLBlastStatusCode result)
+{
+    if (result == CLBlastSuccess && kernelCacheTrackingEnabled.load(std::memory_order_relaxed))
+    {
+        recordKernelCacheUse(routineName, queue);
+    }
+}
+
+/**
+* The operations and precisions whose kernels should be compiled for
+* one device in one context, with the names of the operations that are used by
+* CLBlastWarmup
+*/
+struct WarmupRequest
+{
+    cl_context context;
+    cl_device_id device;
+    std::vector<std::string> operations;
+    std::vector<CLBlastPrecision> precisions;
+};
+
+/**
+* Start a warmup for the given request on a background thread. The
+* operations that can not be warmed up are skipped, and their kernels
+* will be compiled on their next call. Returns whether the thread was
+* started.
+*/
+bool startBackgroundWarmup(const WarmupRequest &request);
+
+/**
+* Returns whether the kernels of the given operation and precision can
+* be compiled with startBackgroundWarmup
+*/
+bool canWarmup(const std::string &operation, CLBlastPrecision precision);
+
+#endif
@@ -0,0 +1,414 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlastNatives.hpp"
+#include "JOCLBlast.hpp"
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+
+// The table of all native methods of the org.jocl.blast.CLBlast class.
+// The names and signatures are the ones from the JNI header JOCLBlast.hpp.
+static const JNINativeMethod CLBlast_nativeMethods[] =
+{
+    { (char*)"setLogLevelNative", (char*)"(I)V", (void*)&Java_org_jocl_blast_CLBlast_setLogLevelNative },
+    { (char*)"setStatisticsEnabledNative", (char*)"(Z)V", (void*)&Java_org_jocl_blast_CLBlast_setStatisticsEnabledNative },
+    { (char*)"getStatisticsRoutineNamesNative", (char*)"()[Ljava/lang/String;", (void*)&Java_org_jocl_blast_CLBlast_getStatisticsRoutineNamesNative },
+    { (char*)"getStatisticsNative", (char*)"(Z)[J", (void*)&Java_org_jocl_blast_CLBlast_getStatisticsNative },
+    { (char*)"setProfilingEnabledNative", (char*)"(Z)V", (void*)&Java_org_jocl_blast_CLBlast_setProfilingEnabledNative },
+    { (char*)"getProfileNative", (char*)"(Z)[Ljava/lang/Object;", (void*)&Java_org_jocl_blast_CLBlast_getProfileNative },
+    { (char*)"setKernelCacheTrackingEnabledNative", (char*)"(Z)V", (void*)&Java_org_jocl_blast_CLBlast_setKernelCacheTrackingEnabledNative },
+    { (char*)"getKernelCacheNative", (char*)"()[Ljava/lang/Object;", (void*)&Java_org_jocl_blast_CLBlast_getKernelCacheNative },
+    { (char*)"evictKernelCacheNative", (char*)"(JLjava/lang/String;I)I", (void*)&Java_org_jocl_blast_CLBlast_evictKernelCacheNative },
+    { (char*)"setKernelCacheLimitNative", (char*)"(I)V", (void*)&Java_org_jocl_blast_CLBlast_setKernelCacheLimitNative },
+    { (char*)"setCallTraceEnabledNative", (char*)"(Z)V", (void*)&Java_org_jocl_blast_CLBlast_setCallTraceEnabledNative },
+    { (char*)"setCallTraceCapacityNative", (char*)"(I)V", (void*)&Java_org_jocl_blast_CLBlast_setCallTraceCapacityNative },
+    { (char*)"getCallTraceNative", (char*)"(Z)[Ljava/lang/Object;", (void*)&Java_org_jocl_blast_CLBlast_getCallTraceNative },
+    { (char*)"CLBlastSrotgNative", (char*)"(Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSrotgNative },
+    { (char*)"CLBlastDrotgNative", (char*)"(Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDrotgNative },
+    { (char*)"CLBlastSrotmgNative", (char*)"(Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSrotmgNative },
+    { (char*)"CLBlastDrotmgNative", (char*)"(Lorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDrotmgNative },
+    { (char*)"CLBlastSrotNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSrotNative },
+    { (char*)"CLBlastDrotNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDrotNative },
+    { (char*)"CLBlastSrotmNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSrotmNative },
+    { (char*)"CLBlastDrotmNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDrotmNative },
+    { (char*)"CLBlastSswapNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSswapNative },
+    { (char*)"CLBlastDswapNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDswapNative },
+    { (char*)"CLBlastCswapNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCswapNative },
+    { (char*)"CLBlastZswapNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZswapNative },
+    { (char*)"CLBlastHswapNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHswapNative },
+    { (char*)"CLBlastSscalNative", (char*)"(JFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSscalNative },
+    { (char*)"CLBlastDscalNative", (char*)"(JDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDscalNative },
+    { (char*)"CLBlastCscalNative", (char*)"(J[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCscalNative },
+    { (char*)"CLBlastCscalSplitNative", (char*)"(JFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCscalSplitNative },
+    { (char*)"CLBlastZscalNative", (char*)"(J[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZscalNative },
+    { (char*)"CLBlastZscalSplitNative", (char*)"(JDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZscalSplitNative },
+    { (char*)"CLBlastHscalNative", (char*)"(JFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHscalNative },
+    { (char*)"CLBlastScopyNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastScopyNative },
+    { (char*)"CLBlastDcopyNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDcopyNative },
+    { (char*)"CLBlastCcopyNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCcopyNative },
+    { (char*)"CLBlastZcopyNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZcopyNative },
+    { (char*)"CLBlastHcopyNative", (char*)"(JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHcopyNative },
+    { (char*)"CLBlastSaxpyNative", (char*)"(JFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSaxpyNative },
+    { (char*)"CLBlastDaxpyNative", (char*)"(JDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDaxpyNative },
+    { (char*)"CLBlastCaxpyNative", (char*)"(J[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCaxpyNative },
+    { (char*)"CLBlastCaxpySplitNative", (char*)"(JFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCaxpySplitNative },
+    { (char*)"CLBlastZaxpyNative", (char*)"(J[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZaxpyNative },
+    { (char*)"CLBlastZaxpySplitNative", (char*)"(JDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZaxpySplitNative },
+    { (char*)"CLBlastHaxpyNative", (char*)"(JFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHaxpyNative },
+    { (char*)"CLBlastSdotNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSdotNative },
+    { (char*)"CLBlastDdotNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDdotNative },
+    { (char*)"CLBlastHdotNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHdotNative },
+    { (char*)"CLBlastCdotuNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCdotuNative },
+    { (char*)"CLBlastZdotuNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZdotuNative },
+    { (char*)"CLBlastCdotcNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCdotcNative },
+    { (char*)"CLBlastZdotcNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZdotcNative },
+    { (char*)"CLBlastSnrm2Native", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSnrm2Native },
+    { (char*)"CLBlastDnrm2Native", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDnrm2Native },
+    { (char*)"CLBlastScnrm2Native", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastScnrm2Native },
+    { (char*)"CLBlastDznrm2Native", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDznrm2Native },
+    { (char*)"CLBlastHnrm2Native", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHnrm2Native },
+    { (char*)"CLBlastSasumNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSasumNative },
+    { (char*)"CLBlastDasumNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDasumNative },
+    { (char*)"CLBlastScasumNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastScasumNative },
+    { (char*)"CLBlastDzasumNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDzasumNative },
+    { (char*)"CLBlastHasumNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHasumNative },
+    { (char*)"CLBlastSsumNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSsumNative },
+    { (char*)"CLBlastDsumNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDsumNative },
+    { (char*)"CLBlastScsumNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastScsumNative },
+    { (char*)"CLBlastDzsumNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDzsumNative },
+    { (char*)"CLBlastHsumNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHsumNative },
+    { (char*)"CLBlastiSamaxNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiSamaxNative },
+    { (char*)"CLBlastiDamaxNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiDamaxNative },
+    { (char*)"CLBlastiCamaxNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiCamaxNative },
+    { (char*)"CLBlastiZamaxNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiZamaxNative },
+    { (char*)"CLBlastiHamaxNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiHamaxNative },
+    { (char*)"CLBlastiSaminNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiSaminNative },
+    { (char*)"CLBlastiDaminNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiDaminNative },
+    { (char*)"CLBlastiCaminNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiCaminNative },
+    { (char*)"CLBlastiZaminNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiZaminNative },
+    { (char*)"CLBlastiHaminNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiHaminNative },
+    { (char*)"CLBlastiSmaxNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiSmaxNative },
+    { (char*)"CLBlastiDmaxNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiDmaxNative },
+    { (char*)"CLBlastiCmaxNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiCmaxNative },
+    { (char*)"CLBlastiZmaxNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiZmaxNative },
+    { (char*)"CLBlastiHmaxNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiHmaxNative },
+    { (char*)"CLBlastiSminNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiSminNative },
+    { (char*)"CLBlastiDminNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiDminNative },
+    { (char*)"CLBlastiCminNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiCminNative },
+    { (char*)"CLBlastiZminNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiZminNative },
+    { (char*)"CLBlastiHminNative", (char*)"(JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastiHminNative },
+    { (char*)"CLBlastSgemvNative", (char*)"(IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgemvNative },
+    { (char*)"CLBlastDgemvNative", (char*)"(IIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgemvNative },
+    { (char*)"CLBlastCgemvNative", (char*)"(IIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemvNative },
+    { (char*)"CLBlastCgemvSplitNative", (char*)"(IIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemvSplitNative },
+    { (char*)"CLBlastZgemvNative", (char*)"(IIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemvNative },
+    { (char*)"CLBlastZgemvSplitNative", (char*)"(IIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemvSplitNative },
+    { (char*)"CLBlastHgemvNative", (char*)"(IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHgemvNative },
+    { (char*)"CLBlastSgbmvNative", (char*)"(IIJJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgbmvNative },
+    { (char*)"CLBlastDgbmvNative", (char*)"(IIJJJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgbmvNative },
+    { (char*)"CLBlastCgbmvNative", (char*)"(IIJJJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgbmvNative },
+    { (char*)"CLBlastCgbmvSplitNative", (char*)"(IIJJJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgbmvSplitNative },
+    { (char*)"CLBlastZgbmvNative", (char*)"(IIJJJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgbmvNative },
+    { (char*)"CLBlastZgbmvSplitNative", (char*)"(IIJJJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgbmvSplitNative },
+    { (char*)"CLBlastHgbmvNative", (char*)"(IIJJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHgbmvNative },
+    { (char*)"CLBlastChemvNative", (char*)"(IIJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChemvNative },
+    { (char*)"CLBlastChemvSplitNative", (char*)"(IIJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChemvSplitNative },
+    { (char*)"CLBlastZhemvNative", (char*)"(IIJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhemvNative },
+    { (char*)"CLBlastZhemvSplitNative", (char*)"(IIJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhemvSplitNative },
+    { (char*)"CLBlastChbmvNative", (char*)"(IIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChbmvNative },
+    { (char*)"CLBlastChbmvSplitNative", (char*)"(IIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChbmvSplitNative },
+    { (char*)"CLBlastZhbmvNative", (char*)"(IIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhbmvNative },
+    { (char*)"CLBlastZhbmvSplitNative", (char*)"(IIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhbmvSplitNative },
+    { (char*)"CLBlastChpmvNative", (char*)"(IIJ[FLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChpmvNative },
+    { (char*)"CLBlastChpmvSplitNative", (char*)"(IIJFFLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChpmvSplitNative },
+    { (char*)"CLBlastZhpmvNative", (char*)"(IIJ[DLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhpmvNative },
+    { (char*)"CLBlastZhpmvSplitNative", (char*)"(IIJDDLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhpmvSplitNative },
+    { (char*)"CLBlastSsymvNative", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSsymvNative },
+    { (char*)"CLBlastDsymvNative", (char*)"(IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDsymvNative },
+    { (char*)"CLBlastHsymvNative", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHsymvNative },
+    { (char*)"CLBlastSsbmvNative", (char*)"(IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSsbmvNative },
+    { (char*)"CLBlastDsbmvNative", (char*)"(IIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDsbmvNative },
+    { (char*)"CLBlastHsbmvNative", (char*)"(IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHsbmvNative },
+    { (char*)"CLBlastSspmvNative", (char*)"(IIJFLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSspmvNative },
+    { (char*)"CLBlastDspmvNative", (char*)"(IIJDLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDspmvNative },
+    { (char*)"CLBlastHspmvNative", (char*)"(IIJFLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHspmvNative },
+    { (char*)"CLBlastStrmvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastStrmvNative },
+    { (char*)"CLBlastDtrmvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDtrmvNative },
+    { (char*)"CLBlastCtrmvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtrmvNative },
+    { (char*)"CLBlastZtrmvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtrmvNative },
+    { (char*)"CLBlastHtrmvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHtrmvNative },
+    { (char*)"CLBlastStbmvNative", (char*)"(IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastStbmvNative },
+    { (char*)"CLBlastDtbmvNative", (char*)"(IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDtbmvNative },
+    { (char*)"CLBlastCtbmvNative", (char*)"(IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtbmvNative },
+    { (char*)"CLBlastZtbmvNative", (char*)"(IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtbmvNative },
+    { (char*)"CLBlastHtbmvNative", (char*)"(IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHtbmvNative },
+    { (char*)"CLBlastStpmvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastStpmvNative },
+    { (char*)"CLBlastDtpmvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDtpmvNative },
+    { (char*)"CLBlastCtpmvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtpmvNative },
+    { (char*)"CLBlastZtpmvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtpmvNative },
+    { (char*)"CLBlastHtpmvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHtpmvNative },
+    { (char*)"CLBlastStrsvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastStrsvNative },
+    { (char*)"CLBlastDtrsvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDtrsvNative },
+    { (char*)"CLBlastCtrsvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtrsvNative },
+    { (char*)"CLBlastZtrsvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtrsvNative },
+    { (char*)"CLBlastStbsvNative", (char*)"(IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastStbsvNative },
+    { (char*)"CLBlastDtbsvNative", (char*)"(IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDtbsvNative },
+    { (char*)"CLBlastCtbsvNative", (char*)"(IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtbsvNative },
+    { (char*)"CLBlastZtbsvNative", (char*)"(IIIIJJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtbsvNative },
+    { (char*)"CLBlastStpsvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastStpsvNative },
+    { (char*)"CLBlastDtpsvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDtpsvNative },
+    { (char*)"CLBlastCtpsvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtpsvNative },
+    { (char*)"CLBlastZtpsvNative", (char*)"(IIIIJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtpsvNative },
+    { (char*)"CLBlastSgerNative", (char*)"(IJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgerNative },
+    { (char*)"CLBlastDgerNative", (char*)"(IJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgerNative },
+    { (char*)"CLBlastHgerNative", (char*)"(IJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHgerNative },
+    { (char*)"CLBlastCgeruNative", (char*)"(IJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgeruNative },
+    { (char*)"CLBlastCgeruSplitNative", (char*)"(IJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgeruSplitNative },
+    { (char*)"CLBlastZgeruNative", (char*)"(IJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgeruNative },
+    { (char*)"CLBlastZgeruSplitNative", (char*)"(IJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgeruSplitNative },
+    { (char*)"CLBlastCgercNative", (char*)"(IJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgercNative },
+    { (char*)"CLBlastCgercSplitNative", (char*)"(IJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgercSplitNative },
+    { (char*)"CLBlastZgercNative", (char*)"(IJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgercNative },
+    { (char*)"CLBlastZgercSplitNative", (char*)"(IJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgercSplitNative },
+    { (char*)"CLBlastCherNative", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCherNative },
+    { (char*)"CLBlastZherNative", (char*)"(IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZherNative },
+    { (char*)"CLBlastChprNative", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChprNative },
+    { (char*)"CLBlastZhprNative", (char*)"(IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhprNative },
+    { (char*)"CLBlastCher2Native", (char*)"(IIJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCher2Native },
+    { (char*)"CLBlastCher2SplitNative", (char*)"(IIJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCher2SplitNative },
+    { (char*)"CLBlastZher2Native", (char*)"(IIJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZher2Native },
+    { (char*)"CLBlastZher2SplitNative", (char*)"(IIJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZher2SplitNative },
+    { (char*)"CLBlastChpr2Native", (char*)"(IIJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChpr2Native },
+    { (char*)"CLBlastChpr2SplitNative", (char*)"(IIJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChpr2SplitNative },
+    { (char*)"CLBlastZhpr2Native", (char*)"(IIJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhpr2Native },
+    { (char*)"CLBlastZhpr2SplitNative", (char*)"(IIJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhpr2SplitNative },
+    { (char*)"CLBlastSsyrNative", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSsyrNative },
+    { (char*)"CLBlastDsyrNative", (char*)"(IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDsyrNative },
+    { (char*)"CLBlastHsyrNative", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHsyrNative },
+    { (char*)"CLBlastSsprNative", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSsprNative },
+    { (char*)"CLBlastDsprNative", (char*)"(IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDsprNative },
+    { (char*)"CLBlastHsprNative", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHsprNative },
+    { (char*)"CLBlastSsyr2Native", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSsyr2Native },
+    { (char*)"CLBlastDsyr2Native", (char*)"(IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDsyr2Native },
+    { (char*)"CLBlastHsyr2Native", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHsyr2Native },
+    { (char*)"CLBlastSspr2Native", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSspr2Native },
+    { (char*)"CLBlastDspr2Native", (char*)"(IIJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDspr2Native },
+    { (char*)"CLBlastHspr2Native", (char*)"(IIJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHspr2Native },
+    { (char*)"CLBlastSgemmNative", (char*)"(IIIJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgemmNative },
+    { (char*)"CLBlastDgemmNative", (char*)"(IIIJJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgemmNative },
+    { (char*)"CLBlastCgemmNative", (char*)"(IIIJJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemmNative },
+    { (char*)"CLBlastCgemmSplitNative", (char*)"(IIIJJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemmSplitNative },
+    { (char*)"CLBlastZgemmNative", (char*)"(IIIJJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemmNative },
+    { (char*)"CLBlastZgemmSplitNative", (char*)"(IIIJJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemmSplitNative },
+    { (char*)"CLBlastHgemmNative", (char*)"(IIIJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHgemmNative },
+    { (char*)"CLBlastSsymmNative", (char*)"(IIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSsymmNative },
+    { (char*)"CLBlastDsymmNative", (char*)"(IIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDsymmNative },
+    { (char*)"CLBlastCsymmNative", (char*)"(IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCsymmNative },
+    { (char*)"CLBlastCsymmSplitNative", (char*)"(IIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCsymmSplitNative },
+    { (char*)"CLBlastZsymmNative", (char*)"(IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZsymmNative },
+    { (char*)"CLBlastZsymmSplitNative", (char*)"(IIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZsymmSplitNative },
+    { (char*)"CLBlastHsymmNative", (char*)"(IIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHsymmNative },
+    { (char*)"CLBlastChemmNative", (char*)"(IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChemmNative },
+    { (char*)"CLBlastChemmSplitNative", (char*)"(IIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChemmSplitNative },
+    { (char*)"CLBlastZhemmNative", (char*)"(IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhemmNative },
+    { (char*)"CLBlastZhemmSplitNative", (char*)"(IIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhemmSplitNative },
+    { (char*)"CLBlastSsyrkNative", (char*)"(IIIJJFLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSsyrkNative },
+    { (char*)"CLBlastDsyrkNative", (char*)"(IIIJJDLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDsyrkNative },
+    { (char*)"CLBlastCsyrkNative", (char*)"(IIIJJ[FLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCsyrkNative },
+    { (char*)"CLBlastCsyrkSplitNative", (char*)"(IIIJJFFLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCsyrkSplitNative },
+    { (char*)"CLBlastZsyrkNative", (char*)"(IIIJJ[DLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZsyrkNative },
+    { (char*)"CLBlastZsyrkSplitNative", (char*)"(IIIJJDDLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZsyrkSplitNative },
+    { (char*)"CLBlastHsyrkNative", (char*)"(IIIJJFLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHsyrkNative },
+    { (char*)"CLBlastCherkNative", (char*)"(IIIJJFLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCherkNative },
+    { (char*)"CLBlastZherkNative", (char*)"(IIIJJDLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZherkNative },
+    { (char*)"CLBlastSsyr2kNative", (char*)"(IIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSsyr2kNative },
+    { (char*)"CLBlastDsyr2kNative", (char*)"(IIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDsyr2kNative },
+    { (char*)"CLBlastCsyr2kNative", (char*)"(IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCsyr2kNative },
+    { (char*)"CLBlastCsyr2kSplitNative", (char*)"(IIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCsyr2kSplitNative },
+    { (char*)"CLBlastZsyr2kNative", (char*)"(IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZsyr2kNative },
+    { (char*)"CLBlastZsyr2kSplitNative", (char*)"(IIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZsyr2kSplitNative },
+    { (char*)"CLBlastHsyr2kNative", (char*)"(IIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHsyr2kNative },
+    { (char*)"CLBlastCher2kNative", (char*)"(IIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCher2kNative },
+    { (char*)"CLBlastCher2kSplitNative", (char*)"(IIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCher2kSplitNative },
+    { (char*)"CLBlastZher2kNative", (char*)"(IIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZher2kNative },
+    { (char*)"CLBlastZher2kSplitNative", (char*)"(IIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZher2kSplitNative },
+    { (char*)"CLBlastStrmmNative", (char*)"(IIIIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastStrmmNative },
+    { (char*)"CLBlastDtrmmNative", (char*)"(IIIIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDtrmmNative },
+    { (char*)"CLBlastCtrmmNative", (char*)"(IIIIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtrmmNative },
+    { (char*)"CLBlastCtrmmSplitNative", (char*)"(IIIIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtrmmSplitNative },
+    { (char*)"CLBlastZtrmmNative", (char*)"(IIIIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtrmmNative },
+    { (char*)"CLBlastZtrmmSplitNative", (char*)"(IIIIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtrmmSplitNative },
+    { (char*)"CLBlastHtrmmNative", (char*)"(IIIIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHtrmmNative },
+    { (char*)"CLBlastStrsmNative", (char*)"(IIIIIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastStrsmNative },
+    { (char*)"CLBlastDtrsmNative", (char*)"(IIIIIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDtrsmNative },
+    { (char*)"CLBlastCtrsmNative", (char*)"(IIIIIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtrsmNative },
+    { (char*)"CLBlastCtrsmSplitNative", (char*)"(IIIIIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtrsmSplitNative },
+    { (char*)"CLBlastZtrsmNative", (char*)"(IIIIIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtrsmNative },
+    { (char*)"CLBlastZtrsmSplitNative", (char*)"(IIIIIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtrsmSplitNative },
+    { (char*)"CLBlastShadNative", (char*)"(JFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastShadNative },
+    { (char*)"CLBlastDhadNative", (char*)"(JDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDhadNative },
+    { (char*)"CLBlastChadNative", (char*)"(J[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChadNative },
+    { (char*)"CLBlastChadSplitNative", (char*)"(JFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastChadSplitNative },
+    { (char*)"CLBlastZhadNative", (char*)"(J[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhadNative },
+    { (char*)"CLBlastZhadSplitNative", (char*)"(JDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZhadSplitNative },
+    { (char*)"CLBlastHhadNative", (char*)"(JFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHhadNative },
+    { (char*)"CLBlastSomatcopyNative", (char*)"(IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSomatcopyNative },
+    { (char*)"CLBlastDomatcopyNative", (char*)"(IIJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDomatcopyNative },
+    { (char*)"CLBlastComatcopyNative", (char*)"(IIJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastComatcopyNative },
+    { (char*)"CLBlastComatcopySplitNative", (char*)"(IIJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastComatcopySplitNative },
+    { (char*)"CLBlastZomatcopyNative", (char*)"(IIJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZomatcopyNative },
+    { (char*)"CLBlastZomatcopySplitNative", (char*)"(IIJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZomatcopySplitNative },
+    { (char*)"CLBlastHomatcopyNative", (char*)"(IIJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHomatcopyNative },
+    { (char*)"CLBlastSim2colNative", (char*)"(IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSim2colNative },
+    { (char*)"CLBlastDim2colNative", (char*)"(IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDim2colNative },
+    { (char*)"CLBlastCim2colNative", (char*)"(IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCim2colNative },
+    { (char*)"CLBlastZim2colNative", (char*)"(IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZim2colNative },
+    { (char*)"CLBlastHim2colNative", (char*)"(IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHim2colNative },
+    { (char*)"CLBlastScol2imNative", (char*)"(IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastScol2imNative },
+    { (char*)"CLBlastDcol2imNative", (char*)"(IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDcol2imNative },
+    { (char*)"CLBlastCcol2imNative", (char*)"(IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCcol2imNative },
+    { (char*)"CLBlastZcol2imNative", (char*)"(IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZcol2imNative },
+    { (char*)"CLBlastHcol2imNative", (char*)"(IJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHcol2imNative },
+    { (char*)"CLBlastSconvgemmNative", (char*)"(IJJJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSconvgemmNative },
+    { (char*)"CLBlastDconvgemmNative", (char*)"(IJJJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDconvgemmNative },
+    { (char*)"CLBlastHconvgemmNative", (char*)"(IJJJJJJJJJJJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHconvgemmNative },
+    { (char*)"CLBlastSaxpyBatchedNative", (char*)"(J[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSaxpyBatchedNative },
+    { (char*)"CLBlastDaxpyBatchedNative", (char*)"(J[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDaxpyBatchedNative },
+    { (char*)"CLBlastCaxpyBatchedNative", (char*)"(J[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCaxpyBatchedNative },
+    { (char*)"CLBlastZaxpyBatchedNative", (char*)"(J[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZaxpyBatchedNative },
+    { (char*)"CLBlastHaxpyBatchedNative", (char*)"(J[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHaxpyBatchedNative },
+    { (char*)"CLBlastSaxpyBatchedDirectNative", (char*)"(JLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSaxpyBatchedDirectNative },
+    { (char*)"CLBlastDaxpyBatchedDirectNative", (char*)"(JLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDaxpyBatchedDirectNative },
+    { (char*)"CLBlastCaxpyBatchedDirectNative", (char*)"(JLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCaxpyBatchedDirectNative },
+    { (char*)"CLBlastZaxpyBatchedDirectNative", (char*)"(JLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZaxpyBatchedDirectNative },
+    { (char*)"CLBlastHaxpyBatchedDirectNative", (char*)"(JLjava/nio/ShortBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHaxpyBatchedDirectNative },
+    { (char*)"CLBlastSgemmBatchedNative", (char*)"(IIIJJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgemmBatchedNative },
+    { (char*)"CLBlastDgemmBatchedNative", (char*)"(IIIJJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[DLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgemmBatchedNative },
+    { (char*)"CLBlastCgemmBatchedNative", (char*)"(IIIJJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemmBatchedNative },
+    { (char*)"CLBlastZgemmBatchedNative", (char*)"(IIIJJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[DLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemmBatchedNative },
+    { (char*)"CLBlastHgemmBatchedNative", (char*)"(IIIJJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHgemmBatchedNative },
+    { (char*)"CLBlastSgemmBatchedDirectNative", (char*)"(IIIJJJLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgemmBatchedDirectNative },
+    { (char*)"CLBlastDgemmBatchedDirectNative", (char*)"(IIIJJJLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgemmBatchedDirectNative },
+    { (char*)"CLBlastCgemmBatchedDirectNative", (char*)"(IIIJJJLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLjava/nio/FloatBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemmBatchedDirectNative },
+    { (char*)"CLBlastZgemmBatchedDirectNative", (char*)"(IIIJJJLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLjava/nio/DoubleBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemmBatchedDirectNative },
+    { (char*)"CLBlastHgemmBatchedDirectNative", (char*)"(IIIJJJLjava/nio/ShortBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLorg/jocl/cl_mem;Ljava/nio/LongBuffer;JLjava/nio/ShortBuffer;Lorg/jocl/cl_mem;Ljava/nio/LongBuffer;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHgemmBatchedDirectNative },
+    { (char*)"CLBlastSgemmStridedBatchedNative", (char*)"(IIIJJJFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgemmStridedBatchedNative },
+    { (char*)"CLBlastDgemmStridedBatchedNative", (char*)"(IIIJJJDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJDLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgemmStridedBatchedNative },
+    { (char*)"CLBlastCgemmStridedBatchedNative", (char*)"(IIIJJJ[FLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJ[FLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemmStridedBatchedNative },
+    { (char*)"CLBlastCgemmStridedBatchedSplitNative", (char*)"(IIIJJJFFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemmStridedBatchedSplitNative },
+    { (char*)"CLBlastZgemmStridedBatchedNative", (char*)"(IIIJJJ[DLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJ[DLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemmStridedBatchedNative },
+    { (char*)"CLBlastZgemmStridedBatchedSplitNative", (char*)"(IIIJJJDDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJDDLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemmStridedBatchedSplitNative },
+    { (char*)"CLBlastHgemmStridedBatchedNative", (char*)"(IIIJJJFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHgemmStridedBatchedNative },
+    { (char*)"CLBlastSgemvBatchedNative", (char*)"(IIJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgemvBatchedNative },
+    { (char*)"CLBlastDgemvBatchedNative", (char*)"(IIJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[DLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgemvBatchedNative },
+    { (char*)"CLBlastCgemvBatchedNative", (char*)"(IIJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[FLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemvBatchedNative },
+    { (char*)"CLBlastZgemvBatchedNative", (char*)"(IIJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJ[DLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemvBatchedNative },
+    { (char*)"CLBlastSgemvStridedBatchedNative", (char*)"(IIJJFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgemvStridedBatchedNative },
+    { (char*)"CLBlastDgemvStridedBatchedNative", (char*)"(IIJJDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJDLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgemvStridedBatchedNative },
+    { (char*)"CLBlastCgemvStridedBatchedNative", (char*)"(IIJJ[FLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJ[FLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemvStridedBatchedNative },
+    { (char*)"CLBlastCgemvStridedBatchedSplitNative", (char*)"(IIJJFFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJFFLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemvStridedBatchedSplitNative },
+    { (char*)"CLBlastZgemvStridedBatchedNative", (char*)"(IIJJ[DLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJ[DLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemvStridedBatchedNative },
+    { (char*)"CLBlastZgemvStridedBatchedSplitNative", (char*)"(IIJJDDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJDDLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemvStridedBatchedSplitNative },
+    { (char*)"CLBlastStrsvBatchedNative", (char*)"(IIIIJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastStrsvBatchedNative },
+    { (char*)"CLBlastDtrsvBatchedNative", (char*)"(IIIIJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDtrsvBatchedNative },
+    { (char*)"CLBlastCtrsvBatchedNative", (char*)"(IIIIJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtrsvBatchedNative },
+    { (char*)"CLBlastZtrsvBatchedNative", (char*)"(IIIIJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtrsvBatchedNative },
+    { (char*)"CLBlastStrsvStridedBatchedNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastStrsvStridedBatchedNative },
+    { (char*)"CLBlastDtrsvStridedBatchedNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDtrsvStridedBatchedNative },
+    { (char*)"CLBlastCtrsvStridedBatchedNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCtrsvStridedBatchedNative },
+    { (char*)"CLBlastZtrsvStridedBatchedNative", (char*)"(IIIIJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZtrsvStridedBatchedNative },
+    { (char*)"CLBlastSgerBatchedNative", (char*)"(IJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgerBatchedNative },
+    { (char*)"CLBlastDgerBatchedNative", (char*)"(IJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgerBatchedNative },
+    { (char*)"CLBlastSgerStridedBatchedNative", (char*)"(IJJFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgerStridedBatchedNative },
+    { (char*)"CLBlastDgerStridedBatchedNative", (char*)"(IJJDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgerStridedBatchedNative },
+    { (char*)"CLBlastCgeruBatchedNative", (char*)"(IJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgeruBatchedNative },
+    { (char*)"CLBlastZgeruBatchedNative", (char*)"(IJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgeruBatchedNative },
+    { (char*)"CLBlastCgeruStridedBatchedNative", (char*)"(IJJ[FLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgeruStridedBatchedNative },
+    { (char*)"CLBlastCgeruStridedBatchedSplitNative", (char*)"(IJJFFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgeruStridedBatchedSplitNative },
+    { (char*)"CLBlastZgeruStridedBatchedNative", (char*)"(IJJ[DLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgeruStridedBatchedNative },
+    { (char*)"CLBlastZgeruStridedBatchedSplitNative", (char*)"(IJJDDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgeruStridedBatchedSplitNative },
+    { (char*)"CLBlastCgercBatchedNative", (char*)"(IJJ[FLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgercBatchedNative },
+    { (char*)"CLBlastZgercBatchedNative", (char*)"(IJJ[DLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJLorg/jocl/cl_mem;[JJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgercBatchedNative },
+    { (char*)"CLBlastCgercStridedBatchedNative", (char*)"(IJJ[FLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgercStridedBatchedNative },
+    { (char*)"CLBlastCgercStridedBatchedSplitNative", (char*)"(IJJFFLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgercStridedBatchedSplitNative },
+    { (char*)"CLBlastZgercStridedBatchedNative", (char*)"(IJJ[DLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgercStridedBatchedNative },
+    { (char*)"CLBlastZgercStridedBatchedSplitNative", (char*)"(IJJDDLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJLorg/jocl/cl_mem;JJJJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgercStridedBatchedSplitNative },
+    { (char*)"CLBlastSgemmWithTempBufferNative", (char*)"(IIIJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;Lorg/jocl/cl_mem;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgemmWithTempBufferNative },
+    { (char*)"CLBlastDgemmWithTempBufferNative", (char*)"(IIIJJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;Lorg/jocl/cl_mem;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgemmWithTempBufferNative },
+    { (char*)"CLBlastCgemmWithTempBufferNative", (char*)"(IIIJJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;Lorg/jocl/cl_mem;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemmWithTempBufferNative },
+    { (char*)"CLBlastCgemmWithTempBufferSplitNative", (char*)"(IIIJJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;Lorg/jocl/cl_mem;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemmWithTempBufferSplitNative },
+    { (char*)"CLBlastZgemmWithTempBufferNative", (char*)"(IIIJJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;Lorg/jocl/cl_mem;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemmWithTempBufferNative },
+    { (char*)"CLBlastZgemmWithTempBufferSplitNative", (char*)"(IIIJJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;Lorg/jocl/cl_mem;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemmWithTempBufferSplitNative },
+    { (char*)"CLBlastHgemmWithTempBufferNative", (char*)"(IIIJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;Lorg/jocl/cl_mem;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHgemmWithTempBufferNative },
+    { (char*)"CLBlastSgemmPooledNative", (char*)"(IIIJJJFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSgemmPooledNative },
+    { (char*)"CLBlastDgemmPooledNative", (char*)"(IIIJJJDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDgemmPooledNative },
+    { (char*)"CLBlastCgemmPooledNative", (char*)"(IIIJJJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[FLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemmPooledNative },
+    { (char*)"CLBlastCgemmPooledSplitNative", (char*)"(IIIJJJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJFFLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCgemmPooledSplitNative },
+    { (char*)"CLBlastZgemmPooledNative", (char*)"(IIIJJJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJ[DLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemmPooledNative },
+    { (char*)"CLBlastZgemmPooledSplitNative", (char*)"(IIIJJJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJDDLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;Lorg/jocl/cl_event;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZgemmPooledSplitNative },
+    { (char*)"CLBlastSGemmTempBufferSizeNative", (char*)"(IIIJJJJJJJJJLorg/jocl/cl_command_queue;[J)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastSGemmTempBufferSizeNative },
+    { (char*)"CLBlastDGemmTempBufferSizeNative", (char*)"(IIIJJJJJJJJJLorg/jocl/cl_command_queue;[J)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastDGemmTempBufferSizeNative },
+    { (char*)"CLBlastCGemmTempBufferSizeNative", (char*)"(IIIJJJJJJJJJLorg/jocl/cl_command_queue;[J)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastCGemmTempBufferSizeNative },
+    { (char*)"CLBlastZGemmTempBufferSizeNative", (char*)"(IIIJJJJJJJJJLorg/jocl/cl_command_queue;[J)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastZGemmTempBufferSizeNative },
+    { (char*)"CLBlastHGemmTempBufferSizeNative", (char*)"(IIIJJJJJJJJJLorg/jocl/cl_command_queue;[J)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastHGemmTempBufferSizeNative },
+    { (char*)"CLBlastClearCacheNative", (char*)"()I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastClearCacheNative },
+    { (char*)"CLBlastFillCacheNative", (char*)"(Lorg/jocl/cl_device_id;)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastFillCacheNative },
+    { (char*)"CLBlastOverrideParametersNative", (char*)"(Lorg/jocl/cl_device_id;Ljava/lang/String;IJ[Ljava/lang/String;[J)I", (void*)&Java_org_jocl_blast_CLBlast_CLBlastOverrideParametersNative },
+    { (char*)"setTempBufferPoolLimitNative", (char*)"(J)V", (void*)&Java_org_jocl_blast_CLBlast_setTempBufferPoolLimitNative },
+    { (char*)"setTempBufferPoolMaxOutstandingNative", (char*)"(I)V", (void*)&Java_org_jocl_blast_CLBlast_setTempBufferPoolMaxOutstandingNative },
+    { (char*)"setTempBufferPoolMaxReuseRatioNative", (char*)"(D)V", (void*)&Java_org_jocl_blast_CLBlast_setTempBufferPoolMaxReuseRatioNative },
+    { (char*)"getTempBufferPoolMaxReuseRatioNative", (char*)"()D", (void*)&Java_org_jocl_blast_CLBlast_getTempBufferPoolMaxReuseRatioNative },
+    { (char*)"getTempBufferPoolOutstandingNative", (char*)"()I", (void*)&Java_org_jocl_blast_CLBlast_getTempBufferPoolOutstandingNative },
+    { (char*)"getTempBufferPoolSizeNative", (char*)"()J", (void*)&Java_org_jocl_blast_CLBlast_getTempBufferPoolSizeNative },
+    { (char*)"trimTempBufferPoolNative", (char*)"()V", (void*)&Java_org_jocl_blast_CLBlast_trimTempBufferPoolNative },
+    { (char*)"loadTuningDatabaseNative", (char*)"(Lorg/jocl/cl_device_id;Ljava/lang/String;)[Ljava/lang/String;", (void*)&Java_org_jocl_blast_CLBlast_loadTuningDatabaseNative },
+    { (char*)"exportTuningDatabaseNative", (char*)"(Lorg/jocl/cl_device_id;Ljava/lang/String;)V", (void*)&Java_org_jocl_blast_CLBlast_exportTuningDatabaseNative },
+    { (char*)"getTuningParametersNative", (char*)"(Lorg/jocl/cl_device_id;Ljava/lang/String;I)[Ljava/lang/Object;", (void*)&Java_org_jocl_blast_CLBlast_getTuningParametersNative },
+};
+
+bool registerNatives(JNIEnv *env)
+{
+    jclass cls = env->FindClass("org/jocl/blast/CLBlast");
+    if (cls == nullptr)
+    {
+        env->ExceptionClear();
+        Logger::log(LOG_WARNING, "Could not find the CLBlast class, native methods will be resolved on their first call\n");
+        return false;
+    }
+    jint count = (jint)(sizeof(CLBlast_nativeMethods) / sizeof(CLBlast_nativeMethods[0]));
+    jint result = env->RegisterNatives(cls, CLBlast_nativeMethods, count);
+    env->DeleteLocalRef(cls);
+    if (result != JNI_OK)
+    {
+        env->ExceptionClear();
+        Logger::log(LOG_WARNING, "Could not register the native methods of CLBlast, they will be resolved on their first call\n");
+        return false;
+    }
+    Logger::log(LOG_DEBUGTRACE, "Registered %d native methods of CLBlast\n", (int)count);
+    return true;
+}
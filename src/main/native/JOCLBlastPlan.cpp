@@ -0,0 +1,465 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlastPlan.hpp"
+#include "JOCLBlastKernelCache.hpp"
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+#include "PointerUtils.hpp"
+#include <clblast_c.h>
+#include <clblast_half.h>
+
+// The plans in this file store the parameters of a routine call that
+// do not change between calls, together with the unwrapped cl_mem
+// handles, which are retained as long as the plan exists. When a plan
+// is executed, only the plan handle, the scalars and offsets, and the
+// queue and event are passed from Java. Like the functions of
+// JOCLBlastFast.cpp, executions are not logged, and not recorded in the
+// statistics, the profile or the call trace. They are only recorded for
+// the kernel cache accounting, if it is enabled. The null checks are
+// done on the Java side.
+
+/**
+* A GEMM with fixed layout, transposes, sizes, buffers and leading
+* dimensions
+*/
+struct GemmPlan
+{
+    CLBlastPrecision precision;
+    CLBlastLayout layout;
+    CLBlastTranspose a_transpose;
+    CLBlastTranspose b_transpose;
+    size_t m;
+    size_t n;
+    size_t k;
+    cl_mem a_buffer;
+    size_t a_ld;
+    cl_mem b_buffer;
+    size_t b_ld;
+    cl_mem c_buffer;
+    size_t c_ld;
+};
+
+/**
+* A GEMV with fixed layout, transpose, sizes, buffers, leading dimension
+* and increments
+*/
+struct GemvPlan
+{
+    CLBlastPrecision precision;
+    CLBlastLayout layout;
+    CLBlastTranspose a_transpose;
+    size_t m;
+    size_t n;
+    cl_mem a_buffer;
+    size_t a_ld;
+    cl_mem x_buffer;
+    size_t x_inc;
+    cl_mem y_buffer;
+    size_t y_inc;
+};
+
+/**
+* A convgemm with fixed convolution parameters and buffers
+*/
+struct ConvgemmPlan
+{
+    CLBlastPrecision precision;
+    CLBlastKernelMode kernel_mode;
+    size_t channels;
+    size_t height;
+    size_t width;
+    size_t kernel_h;
+    size_t kernel_w;
+    size_t pad_h;
+    size_t pad_w;
+    size_t stride_h;
+    size_t stride_w;
+    size_t dilation_h;
+    size_t dilation_w;
+    size_t num_kernels;
+    size_t batch_count;
+    cl_mem im_buffer;
+    cl_mem kernel_buffer;
+    cl_mem result_buffer;
+};
+
+/**
+* Returns the retained cl_mem of the given Java cl_mem object
+*/
+static cl_mem retainMem(JNIEnv *env, jobject mem)
+{
+    cl_mem mem_native = (cl_mem)env->GetLongField(mem, NativePointerObject_nativePointer);
+    clRetainMemObject(mem_native);
+    return mem_native;
+}
+
+/**
+* Write the given native event into the given cl_event object,
+* if the object is not nullptr
+*/
+static void writeEvent(JNIEnv *env, jobject event, cl_event event_native)
+{
+    if (event != nullptr)
+    {
+        env->SetLongField(event, NativePointerObject_nativePointer, (jlong)event_native);
+    }
+}
+
+/**
+* Returns the complex value with the given real and imaginary part
+*/
+static cl_float2 complexFloat(jdouble real, jdouble imag)
+{
+    cl_float2 result;
+    result.s[0] = (float)real;
+    result.s[1] = (float)imag;
+    return result;
+}
+
+static cl_double2 complexDouble(jdouble real, jdouble imag)
+{
+    cl_double2 result;
+    result.s[0] = (double)real;
+    result.s[1] = (double)imag;
+    return result;
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlastGemmPlan
+* Method:    createNative
+* Signature: (IIIIJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;J)J
+*/
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastGemmPlan_createNative
+(JNIEnv *env, jclass UNUSED(cls), jint precision, jint layout, jint a_transpose, jint b_transpose,
+    jlong m, jlong n, jlong k, jobject a_buffer, jlong a_ld, jobject b_buffer, jlong b_ld,
+    jobject c_buffer, jlong c_ld)
+{
+    Logger::log(LOG_TRACE, "Executing CLBlastGemmPlan.create(precision=%d, m=%lld, n=%lld, k=%lld)\n",
+        (int)precision, (long long)m, (long long)n, (long long)k);
+    GemmPlan *plan = new GemmPlan();
+    plan->precision = (CLBlastPrecision)precision;
+    plan->layout = (CLBlastLayout)layout;
+    plan->a_transpose = (CLBlastTranspose)a_transpose;
+    plan->b_transpose = (CLBlastTranspose)b_transpose;
+    plan->m = (size_t)m;
+    plan->n = (size_t)n;
+    plan->k = (size_t)k;
+    plan->a_buffer = retainMem(env, a_buffer);
+    plan->a_ld = (size_t)a_ld;
+    plan->b_buffer = retainMem(env, b_buffer);
+    plan->b_ld = (size_t)b_ld;
+    plan->c_buffer = retainMem(env, c_buffer);
+    plan->c_ld = (size_t)c_ld;
+    return (jlong)plan;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastGemmPlan
+* Method:    executeNative
+* Signature: (JDDDDJJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastGemmPlan_executeNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle, jdouble alpha_real, jdouble alpha_imag,
+    jdouble beta_real, jdouble beta_imag, jlong a_offset, jlong b_offset, jlong c_offset,
+    jobject queue, jobject event)
+{
+    const GemmPlan &p = *(const GemmPlan*)handle;
+    cl_command_queue queue_native = (cl_command_queue)env->GetLongField(queue, NativePointerObject_nativePointer);
+    cl_event event_native = nullptr;
+    cl_event *event_pointer = event == nullptr ? nullptr : &event_native;
+    CLBlastStatusCode result = CLBlastNotImplemented;
+    const char *name = nullptr;
+    switch (p.precision)
+    {
+        case CLBlastPrecisionHalf:
+            name = "CLBlastHgemm";
+            result = CLBlastHgemm(p.layout, p.a_transpose, p.b_transpose, p.m, p.n, p.k,
+                FloatToHalf((float)alpha_real), p.a_buffer, (size_t)a_offset, p.a_ld,
+                p.b_buffer, (size_t)b_offset, p.b_ld, FloatToHalf((float)beta_real),
+                p.c_buffer, (size_t)c_offset, p.c_ld, &queue_native, event_pointer);
+            break;
+        case CLBlastPrecisionSingle:
+            name = "CLBlastSgemm";
+            result = CLBlastSgemm(p.layout, p.a_transpose, p.b_transpose, p.m, p.n, p.k,
+                (float)alpha_real, p.a_buffer, (size_t)a_offset, p.a_ld,
+                p.b_buffer, (size_t)b_offset, p.b_ld, (float)beta_real,
+                p.c_buffer, (size_t)c_offset, p.c_ld, &queue_native, event_pointer);
+            break;
+        case CLBlastPrecisionDouble:
+            name = "CLBlastDgemm";
+            result = CLBlastDgemm(p.layout, p.a_transpose, p.b_transpose, p.m, p.n, p.k,
+                (double)alpha_real, p.a_buffer, (size_t)a_offset, p.a_ld,
+                p.b_buffer, (size_t)b_offset, p.b_ld, (double)beta_real,
+                p.c_buffer, (size_t)c_offset, p.c_ld, &queue_native, event_pointer);
+            break;
+        case CLBlastPrecisionComplexSingle:
+            name = "CLBlastCgemm";
+            result = CLBlastCgemm(p.layout, p.a_transpose, p.b_transpose, p.m, p.n, p.k,
+                complexFloat(alpha_real, alpha_imag), p.a_buffer, (size_t)a_offset, p.a_ld,
+                p.b_buffer, (size_t)b_offset, p.b_ld, complexFloat(beta_real, beta_imag),
+                p.c_buffer, (size_t)c_offset, p.c_ld, &queue_native, event_pointer);
+            break;
+        case CLBlastPrecisionComplexDouble:
+            name = "CLBlastZgemm";
+            result = CLBlastZgemm(p.layout, p.a_transpose, p.b_transpose, p.m, p.n, p.k,
+                complexDouble(alpha_real, alpha_imag), p.a_buffer, (size_t)a_offset, p.a_ld,
+                p.b_buffer, (size_t)b_offset, p.b_ld, complexDouble(beta_real, beta_imag),
+                p.c_buffer, (size_t)c_offset, p.c_ld, &queue_native, event_pointer);
+            break;
+        default:
+            break;
+    }
+    trackKernelCacheUse(name, queue_native, result);
+    writeEvent(env, event, event_native);
+    return (jint)result;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastGemmPlan
+* Method:    releaseNative
+* Signature: (J)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastGemmPlan_releaseNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle)
+{
+    GemmPlan *plan = (GemmPlan*)handle;
+    clReleaseMemObject(plan->a_buffer);
+    clReleaseMemObject(plan->b_buffer);
+    clReleaseMemObject(plan->c_buffer);
+    delete plan;
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlastGemvPlan
+* Method:    createNative
+* Signature: (IIIJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;J)J
+*/
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastGemvPlan_createNative
+(JNIEnv *env, jclass UNUSED(cls), jint precision, jint layout, jint a_transpose,
+    jlong m, jlong n, jobject a_buffer, jlong a_ld, jobject x_buffer, jlong x_inc,
+    jobject y_buffer, jlong y_inc)
+{
+    Logger::log(LOG_TRACE, "Executing CLBlastGemvPlan.create(precision=%d, m=%lld, n=%lld)\n",
+        (int)precision, (long long)m, (long long)n);
+    GemvPlan *plan = new GemvPlan();
+    plan->precision = (CLBlastPrecision)precision;
+    plan->layout = (CLBlastLayout)layout;
+    plan->a_transpose = (CLBlastTranspose)a_transpose;
+    plan->m = (size_t)m;
+    plan->n = (size_t)n;
+    plan->a_buffer = retainMem(env, a_buffer);
+    plan->a_ld = (size_t)a_ld;
+    plan->x_buffer = retainMem(env, x_buffer);
+    plan->x_inc = (size_t)x_inc;
+    plan->y_buffer = retainMem(env, y_buffer);
+    plan->y_inc = (size_t)y_inc;
+    return (jlong)plan;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastGemvPlan
+* Method:    executeNative
+* Signature: (JDDDDJJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastGemvPlan_executeNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle, jdouble alpha_real, jdouble alpha_imag,
+    jdouble beta_real, jdouble beta_imag, jlong a_offset, jlong x_offset, jlong y_offset,
+    jobject queue, jobject event)
+{
+    const GemvPlan &p = *(const GemvPlan*)handle;
+    cl_command_queue queue_native = (cl_command_queue)env->GetLongField(queue, NativePointerObject_nativePointer);
+    cl_event event_native = nullptr;
+    cl_event *event_pointer = event == nullptr ? nullptr : &event_native;
+    CLBlastStatusCode result = CLBlastNotImplemented;
+    const char *name = nullptr;
+    switch (p.precision)
+    {
+        case CLBlastPrecisionHalf:
+            name = "CLBlastHgemv";
+            result = CLBlastHgemv(p.layout, p.a_transpose, p.m, p.n,
+                FloatToHalf((float)alpha_real), p.a_buffer, (size_t)a_offset, p.a_ld,
+                p.x_buffer, (size_t)x_offset, p.x_inc, FloatToHalf((float)beta_real),
+                p.y_buffer, (size_t)y_offset, p.y_inc, &queue_native, event_pointer);
+            break;
+        case CLBlastPrecisionSingle:
+            name = "CLBlastSgemv";
+            result = CLBlastSgemv(p.layout, p.a_transpose, p.m, p.n,
+                (float)alpha_real, p.a_buffer, (size_t)a_offset, p.a_ld,
+                p.x_buffer, (size_t)x_offset, p.x_inc, (float)beta_real,
+                p.y_buffer, (size_t)y_offset, p.y_inc, &queue_native, event_pointer);
+            break;
+        case CLBlastPrecisionDouble:
+            name = "CLBlastDgemv";
+            result = CLBlastDgemv(p.layout, p.a_transpose, p.m, p.n,
+                (double)alpha_real, p.a_buffer, (size_t)a_offset, p.a_ld,
+                p.x_buffer, (size_t)x_offset, p.x_inc, (double)beta_real,
+                p.y_buffer, (size_t)y_offset, p.y_inc, &queue_native, event_pointer);
+            break;
+        case CLBlastPrecisionComplexSingle:
+            name = "CLBlastCgemv";
+            result = CLBlastCgemv(p.layout, p.a_transpose, p.m, p.n,
+                complexFloat(alpha_real, alpha_imag), p.a_buffer, (size_t)a_offset, p.a_ld,
+                p.x_buffer, (size_t)x_offset, p.x_inc, complexFloat(beta_real, beta_imag),
+                p.y_buffer, (size_t)y_offset, p.y_inc, &queue_native, event_pointer);
+            break;
+        case CLBlastPrecisionComplexDouble:
+            name = "CLBlastZgemv";
+            result = CLBlastZgemv(p.layout, p.a_transpose, p.m, p.n,
+                complexDouble(alpha_real, alpha_imag), p.a_buffer, (size_t)a_offset, p.a_ld,
+                p.x_buffer, (size_t)x_offset, p.x_inc, complexDouble(beta_real, beta_imag),
+                p.y_buffer, (size_t)y_offset, p.y_inc, &queue_native, event_pointer);
+            break;
+        default:
+            break;
+    }
+    trackKernelCacheUse(name, queue_native, result);
+    writeEvent(env, event, event_native);
+    return (jint)result;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastGemvPlan
+* Method:    releaseNative
+* Signature: (J)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastGemvPlan_releaseNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle)
+{
+    GemvPlan *plan = (GemvPlan*)handle;
+    clReleaseMemObject(plan->a_buffer);
+    clReleaseMemObject(plan->x_buffer);
+    clReleaseMemObject(plan->y_buffer);
+    delete plan;
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlastConvgemmPlan
+* Method:    createNative
+* Signature: (IIJJJJJJJJJJJJJLorg/jocl/cl_mem;Lorg/jocl/cl_mem;Lorg/jocl/cl_mem;)J
+*/
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastConvgemmPlan_createNative
+(JNIEnv *env, jclass UNUSED(cls), jint precision, jint kernel_mode, jlong channels,
+    jlong height, jlong width, jlong kernel_h, jlong kernel_w, jlong pad_h, jlong pad_w,
+    jlong stride_h, jlong stride_w, jlong dilation_h, jlong dilation_w, jlong num_kernels,
+    jlong batch_count, jobject im_buffer, jobject kernel_buffer, jobject result_buffer)
+{
+    Logger::log(LOG_TRACE, "Executing CLBlastConvgemmPlan.create(precision=%d, channels=%lld, height=%lld, width=%lld)\n",
+        (int)precision, (long long)channels, (long long)height, (long long)width);
+    ConvgemmPlan *plan = new ConvgemmPlan();
+    plan->precision = (CLBlastPrecision)precision;
+    plan->kernel_mode = (CLBlastKernelMode)kernel_mode;
+    plan->channels = (size_t)channels;
+    plan->height = (size_t)height;
+    plan->width = (size_t)width;
+    plan->kernel_h = (size_t)kernel_h;
+    plan->kernel_w = (size_t)kernel_w;
+    plan->pad_h = (size_t)pad_h;
+    plan->pad_w = (size_t)pad_w;
+    plan->stride_h = (size_t)stride_h;
+    plan->stride_w = (size_t)stride_w;
+    plan->dilation_h = (size_t)dilation_h;
+    plan->dilation_w = (size_t)dilation_w;
+    plan->num_kernels = (size_t)num_kernels;
+    plan->batch_count = (size_t)batch_count;
+    plan->im_buffer = retainMem(env, im_buffer);
+    plan->kernel_buffer = retainMem(env, kernel_buffer);
+    plan->result_buffer = retainMem(env, result_buffer);
+    return (jlong)plan;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastConvgemmPlan
+* Method:    executeNative
+* Signature: (JJJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastConvgemmPlan_executeNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle, jlong im_offset, jlong kernel_offset,
+    jlong result_offset, jobject queue, jobject event)
+{
+    const ConvgemmPlan &p = *(const ConvgemmPlan*)handle;
+    cl_command_queue queue_native = (cl_command_queue)env->GetLongField(queue, NativePointerObject_nativePointer);
+    cl_event event_native = nullptr;
+    cl_event *event_pointer = event == nullptr ? nullptr : &event_native;
+    CLBlastStatusCode result = CLBlastNotImplemented;
+    const char *name = nullptr;
+    switch (p.precision)
+    {
+        case CLBlastPrecisionHalf:
+            name = "CLBlastHconvgemm";
+            result = CLBlastHconvgemm(p.kernel_mode, p.channels, p.height, p.width,
+                p.kernel_h, p.kernel_w, p.pad_h, p.pad_w, p.stride_h, p.stride_w,
+                p.dilation_h, p.dilation_w, p.num_kernels, p.batch_count,
+                p.im_buffer, (size_t)im_offset, p.kernel_buffer, (size_t)kernel_offset,
+                p.result_buffer, (size_t)result_offset, &queue_native, event_pointer);
+            break;
+        case CLBlastPrecisionSingle:
+            name = "CLBlastSconvgemm";
+            result = CLBlastSconvgemm(p.kernel_mode, p.channels, p.height, p.width,
+                p.kernel_h, p.kernel_w, p.pad_h, p.pad_w, p.stride_h, p.stride_w,
+                p.dilation_h, p.dilation_w, p.num_kernels, p.batch_count,
+                p.im_buffer, (size_t)im_offset, p.kernel_buffer, (size_t)kernel_offset,
+                p.result_buffer, (size_t)result_offset, &queue_native, event_pointer);
+            break;
+        case CLBlastPrecisionDouble:
+            name = "CLBlastDconvgemm";
+            result = CLBlastDconvgemm(p.kernel_mode, p.channels, p.height, p.width,
+                p.kernel_h, p.kernel_w, p.pad_h, p.pad_w, p.stride_h, p.stride_w,
+                p.dilation_h, p.dilation_w, p.num_kernels, p.batch_count,
+                p.im_buffer, (size_t)im_offset, p.kernel_buffer, (size_t)kernel_offset,
+                p.result_buffer, (size_t)result_offset, &queue_native, event_pointer);
+            break;
+        default:
+            break;
+    }
+    trackKernelCacheUse(name, queue_native, result);
+    writeEvent(env, event, event_native);
+    return (jint)result;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastConvgemmPlan
+* Method:    releaseNative
+* Signature: (J)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastConvgemmPlan_releaseNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle)
+{
+    ConvgemmPlan *plan = (ConvgemmPlan*)handle;
+    clReleaseMemObject(plan->im_buffer);
+    clReleaseMemObject(plan->kernel_buffer);
+    clReleaseMemObject(plan->result_buffer);
+    delete plan;
+}
@@ -0,0 +1,112 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for classes org_jocl_blast_CLBlastGemmPlan, org_jocl_blast_CLBlastGemvPlan and org_jocl_blast_CLBlastConvgemmPlan */
+
+#ifndef _Included_org_jocl_blast_CLBlastPlan
+#define _Included_org_jocl_blast_CLBlastPlan
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_jocl_blast_CLBlastGemmPlan
+ * Method:    createNative
+ * Signature: (IIIIJJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastGemmPlan_createNative
+  (JNIEnv *, jclass, jint, jint, jint, jint, jlong, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastGemmPlan
+ * Method:    executeNative
+ * Signature: (JDDDDJJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastGemmPlan_executeNative
+  (JNIEnv *, jclass, jlong, jdouble, jdouble, jdouble, jdouble, jlong, jlong, jlong, jobject, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastGemmPlan
+ * Method:    releaseNative
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastGemmPlan_releaseNative
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastGemvPlan
+ * Method:    createNative
+ * Signature: (IIIJJLorg/jocl/cl_mem;JLorg/jocl/cl_mem;JLorg/jocl/cl_mem;J)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastGemvPlan_createNative
+  (JNIEnv *, jclass, jint, jint, jint, jlong, jlong, jobject, jlong, jobject, jlong, jobject, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastGemvPlan
+ * Method:    executeNative
+ * Signature: (JDDDDJJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastGemvPlan_executeNative
+  (JNIEnv *, jclass, jlong, jdouble, jdouble, jdouble, jdouble, jlong, jlong, jlong, jobject, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastGemvPlan
+ * Method:    releaseNative
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastGemvPlan_releaseNative
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastConvgemmPlan
+ * Method:    createNative
+ * Signature: (IIJJJJJJJJJJJJJLorg/jocl/cl_mem;Lorg/jocl/cl_mem;Lorg/jocl/cl_mem;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastConvgemmPlan_createNative
+  (JNIEnv *, jclass, jint, jint, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jlong, jobject, jobject, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastConvgemmPlan
+ * Method:    executeNative
+ * Signature: (JJJJLorg/jocl/cl_command_queue;Lorg/jocl/cl_event;)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastConvgemmPlan_executeNative
+  (JNIEnv *, jclass, jlong, jlong, jlong, jlong, jobject, jobject);
+
+/*
+ * Class:     org_jocl_blast_CLBlastConvgemmPlan
+ * Method:    releaseNative
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastConvgemmPlan_releaseNative
+  (JNIEnv *, jclass, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,716 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlast.hpp"
+#include "JOCLBlastRoutines.hpp"
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+
+// The number of buckets of the duration histograms. Bucket i contains
+// the durations d with 2^i <= d < 2^(i+1) nanoseconds, where bucket 0
+// also contains the durations below 1 nanosecond.
+#define PROFILE_BUCKET_COUNT 48
+
+// The number of values that are passed to Java for each profile entry:
+// calls, total, minimum and maximum duration, FLOPs and bytes per call,
+// followed by the histogram buckets
+#define PROFILE_ENTRY_VALUES (6 + PROFILE_BUCKET_COUNT)
+
+std::atomic<bool> profilingEnabled(false);
+
+/**
+* The key of a profile entry: The routine name, the name of the device,
+* and the dimensions of the call
+*/
+struct ProfileKey
+{
+    std::string routine;
+    std::string device;
+    std::string shape;
+
+    bool operator<(const ProfileKey &other) const
+    {
+        if (routine != other.routine) return routine < other.routine;
+        if (device != other.device) return device < other.device;
+        return shape < other.shape;
+    }
+};
+
+/**
+* The device times that have been recorded for one profile key
+*/
+struct ProfileEntry
+{
+    int64_t calls;
+    int64_t totalNanos;
+    int64_t minNanos;
+    int64_t maxNanos;
+    int64_t flops;
+    int64_t bytes;
+    int64_t buckets[PROFILE_BUCKET_COUNT];
+};
+
+/**
+* The data of one profiled call that is passed to the event callback
+*/
+struct ProfileRecord
+{
+    ProfileKey key;
+    int64_t flops;
+    int64_t bytes;
+    cl_event marker;
+};
+
+// The profile entries. They are written from the event callbacks, which
+// may be called from arbitrary threads.
+static std::map<ProfileKey, ProfileEntry> profileEntries;
+static std::mutex profileEntriesMutex;
+
+// The names of the devices, which are only queried once per device
+static std::map<cl_device_id, std::string> deviceNames;
+static std::mutex deviceNamesMutex;
+
+/**
+* Returns the name of the device of the given queue
+*/
+static std::string obtainDeviceName(cl_command_queue queue)
+{
+    cl_device_id device = nullptr;
+    if (clGetCommandQueueInfo(queue, CL_QUEUE_DEVICE, sizeof(cl_device_id), &device, nullptr) != CL_SUCCESS)
+    {
+        return std::string();
+    }
+    std::lock_guard<std::mutex> lock(deviceNamesMutex);
+    std::map<cl_device_id, std::string>::const_iterator it = deviceNames.find(device);
+    if (it != deviceNames.end())
+    {
+        return it->second;
+    }
+    std::string name;
+    size_t size = 0;
+    if (clGetDeviceInfo(device, CL_DEVICE_NAME, 0, nullptr, &size) == CL_SUCCESS && size > 0)
+    {
+        std::vector<char> buffer(size);
+        if (clGetDeviceInfo(device, CL_DEVICE_NAME, size, buffer.data(), nullptr) == CL_SUCCESS)
+        {
+            name = std::string(buffer.data());
+        }
+    }
+    deviceNames[device] = name;
+    return name;
+}
+
+/**
+* Returns whether the given name is the name of a parameter that
+* describes the dimensions of a call
+*/
+static bool isDimension(const std::string &name)
+{
+    static const char *dimensionNames[] =
+    {
+        "m", "n", "k", "kl", "ku", "batch_count",
+        "channels", "height", "width", "kernel_h", "kernel_w",
+        "pad_h", "pad_w", "stride_h", "stride_w",
+        "dilation_h", "dilation_w", "num_kernels"
+    };
+    for (size_t i = 0; i < sizeof(dimensionNames) / sizeof(dimensionNames[0]); i++)
+    {
+        if (name == dimensionNames[i])
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+* The dimensions of a call, as they are obtained from the size
+* parameters with the names that are listed in isDimension
+*/
+class ProfileShape
+{
+public:
+    ProfileShape() : left(true) {}
+
+    void put(const std::string &name, size_t value)
+    {
+        values[name] = (int64_t)value;
+    }
+
+    int64_t get(const char *name) const
+    {
+        std::map<std::string, int64_t>::const_iterator it = values.find(name);
+        return it == values.end() ? 0 : it->second;
+    }
+
+    bool has(const char *name) const
+    {
+        return values.find(name) != values.end();
+    }
+
+    // Whether the side parameter, if present, was CLBlastSideLeft
+    bool left;
+
+    // The dimensions, in the order of the parameters
+    std::vector<std::string> order;
+
+private:
+    std::map<std::string, int64_t> values;
+};
+
+/**
+* Returns the output size of a convolution along one dimension
+*/
+static int64_t convolutionOutputSize(int64_t size, int64_t kernel, int64_t pad, int64_t stride, int64_t dilation)
+{
+    int64_t extent = dilation * (kernel - 1) + 1;
+    if (stride <= 0 || size + 2 * pad < extent)
+    {
+        return 0;
+    }
+    return (size + 2 * pad - extent) / stride + 1;
+}
+
+/**
+* Compute the number of floating point operations and the number of
+* elements that are read or written by one call of the routine with
+* the given name (without the "CLBlast" prefix and the precision), for
+* real values. These are the usual estimates that are used for BLAS
+* benchmarks. Returns false if the routine is not known.
+*/
+static bool computeRealCost(const std::string &family, const ProfileShape &shape,
+    int64_t &flops, int64_t &elements)
+{
+    const int64_t m = shape.get("m");
+    const int64_t n = shape.get("n");
+    const int64_t k = shape.get("k");
+    const bool left = shape.left;
+
+    // Level 3
+    if (family == "gemm" || family == "gemmWithTempBuffer" || family == "gemmPooled")
+    {
+        flops = 2 * m * n * k;
+        elements = m * k + k * n + 2 * m * n;
+    }
+    else if (family == "symm" || family == "hemm")
+    {
+        int64_t ka = left ? m : n;
+        flops = 2 * ka * m * n;
+        elements = ka * ka + 3 * m * n;
+    }
+    else if (family == "syrk" || family == "herk")
+    {
+        flops = n * (n + 1) * k;
+        elements = n * k + n * (n + 1);
+    }
+    else if (family == "syr2k" || family == "her2k")
+    {
+        flops = 2 * n * (n + 1) * k;
+        elements = 2 * n * k + n * (n + 1);
+    }
+    else if (family == "trmm" || family == "trsm")
+    {
+        int64_t ka = left ? m : n;
+        flops = ka * ka * (left ? n : m);
+        elements = ka * (ka + 1) / 2 + 2 * m * n;
+    }
+
+    // Level 2
+    else if (family == "gemv")
+    {
+        flops = 2 * m * n;
+        elements = m * n + m + n + m;
+    }
+    else if (family == "gbmv")
+    {
+        int64_t bands = shape.get("kl") + shape.get("ku") + 1;
+        flops = 2 * bands * n;
+        elements = bands * n + m + n + m;
+    }
+    else if (family == "symv" || family == "hemv" || family == "spmv" || family == "hpmv")
+    {
+        flops = 2 * n * n;
+        elements = n * (n + 1) / 2 + 3 * n;
+    }
+    else if (family == "sbmv" || family == "hbmv")
+    {
+        flops = 2 * n * (2 * k + 1);
+        elements = n * (k + 1) + 3 * n;
+    }
+    else if (family == "trmv" || family == "tpmv" || family == "trsv" || family == "tpsv")
+    {
+        flops = n * n;
+        elements = n * (n + 1) / 2 + 2 * n;
+    }
+    else if (family == "tbmv" || family == "tbsv")
+    {
+        flops = n * (2 * k + 1);
+        elements = n * (k + 1) + 2 * n;
+    }
+    else if (family == "ger" || family == "geru" || family == "gerc")
+    {
+        flops = 2 * m * n;
+        elements = 2 * m * n + m + n;
+    }
+    else if (family == "syr" || family == "her" || family == "spr" || family == "hpr")
+    {
+        flops = n * (n + 1);
+        elements = n * (n + 1) + n;
+    }
+    else if (family == "syr2" || family == "her2" || family == "spr2" || family == "hpr2")
+    {
+        flops = 2 * n * (n + 1);
+        elements = n * (n + 1) + 2 * n;
+    }
+
+    // Level 1
+    else if (family == "axpy")
+    {
+        flops = 2 * n;
+        elements = 3 * n;
+    }
+    else if (family == "scal")
+    {
+        flops = n;
+        elements = 2 * n;
+    }
+    else if (family == "copy")
+    {
+        flops = 0;
+        elements = 2 * n;
+    }
+    else if (family == "swap")
+    {
+        flops = 0;
+        elements = 4 * n;
+    }
+    else if (family == "dot" || family == "dotu" || family == "dotc")
+    {
+        flops = 2 * n;
+        elements = 2 * n;
+    }
+    else if (family == "nrm2")
+    {
+        flops = 2 * n;
+        elements = n;
+    }
+    else if (family == "asum" || family == "sum" ||
+        family == "amax" || family == "amin" || family == "max" || family == "min")
+    {
+        flops = n;
+        elements = n;
+    }
+    else if (family == "had")
+    {
+        flops = 4 * n;
+        elements = 4 * n;
+    }
+    else if (family == "rot" || family == "rotm")
+    {
+        flops = 6 * n;
+        elements = 4 * n;
+    }
+    else if (family == "rotg" || family == "rotmg")
+    {
+        flops = 0;
+        elements = 0;
+    }
+
+    // Extensions
+    else if (family == "omatcopy")
+    {
+        flops = m * n;
+        elements = 2 * m * n;
+    }
+    else if (family == "im2col" || family == "col2im" || family == "convgemm")
+    {
+        int64_t channels = shape.get("channels");
+        int64_t kernelH = shape.get("kernel_h");
+        int64_t kernelW = shape.get("kernel_w");
+        int64_t outputH = convolutionOutputSize(shape.get("height"), kernelH,
+            shape.get("pad_h"), shape.get("stride_h"), shape.get("dilation_h"));
+        int64_t outputW = convolutionOutputSize(shape.get("width"), kernelW,
+            shape.get("pad_w"), shape.get("stride_w"), shape.get("dilation_w"));
+        int64_t imageSize = channels * shape.get("height") * shape.get("width");
+        int64_t patchSize = channels * kernelH * kernelW;
+        int64_t outputSize = outputH * outputW;
+        if (family == "convgemm")
+        {
+            // The batch count is applied by the caller
+            int64_t numKernels = shape.get("num_kernels");
+            flops = 2 * numKernels * patchSize * outputSize;
+            elements = imageSize + numKernels * outputSize + numKernels * patchSize;
+        }
+        else
+        {
+            flops = 0;
+            elements = imageSize + patchSize * outputSize;
+        }
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+/**
+* Compute the number of floating point operations and the number of
+* bytes of one call of the routine with the given name. Complex
+* multiply-add operations are counted as 4 real ones, and the results
+* of the batched routines are multiplied with the batch count. Returns
+* false if the routine is not known.
+*/
+static bool computeCost(const char *routineName, const ProfileShape &shape,
+    int64_t &flops, int64_t &bytes)
+{
+    // Split a name like "CLBlastiSamax" or "CLBlastScasum" into the
+    // precision and the name of the operation
+    std::string name(routineName);
+    const std::string prefix = "CLBlast";
+    if (name.compare(0, prefix.size(), prefix) != 0)
+    {
+        return false;
+    }
+    name = name.substr(prefix.size());
+    if (name.size() > 1 && name[0] == 'i')
+    {
+        name = name.substr(1);
+    }
+    if (name.empty())
+    {
+        return false;
+    }
+    int64_t elementSize = 0;
+    bool complex = false;
+    switch (name[0])
+    {
+        case 'H': elementSize = 2; break;
+        case 'S': elementSize = 4; break;
+        case 'D': elementSize = 8; break;
+        case 'C': elementSize = 8; complex = true; break;
+        case 'Z': elementSize = 16; complex = true; break;
+        default: return false;
+    }
+    std::string family = name.substr(1);
+
+    // The real-valued routines for complex vectors, like CLBlastScasum
+    if (family.size() > 4 && (family[0] == 'c' || family[0] == 'z'))
+    {
+        std::string rest = family.substr(1);
+        if (rest == "asum" || rest == "nrm2" || rest == "sum")
+        {
+            elementSize *= 2;
+            complex = true;
+            family = rest;
+        }
+    }
+    // The batched routines
+    int64_t batchCount = 1;
+    const std::string suffixes[] = { "StridedBatched", "Batched" };
+    for (size_t i = 0; i < 2; i++)
+    {
+        const std::string &suffix = suffixes[i];
+        if (family.size() > suffix.size() &&
+            family.compare(family.size() - suffix.size(), suffix.size(), suffix) == 0)
+        {
+            family = family.substr(0, family.size() - suffix.size());
+            batchCount = shape.get("batch_count");
+            break;
+        }
+    }
+    if (family == "convgemm")
+    {
+        batchCount = shape.get("batch_count");
+    }
+
+    int64_t elements = 0;
+    if (!computeRealCost(family, shape, flops, elements))
+    {
+        return false;
+    }
+    if (complex)
+    {
+        bool reduction = (family == "asum" || family == "sum" ||
+            family == "amax" || family == "amin" || family == "max" || family == "min");
+        flops *= reduction ? 2 : 4;
+    }
+    flops *= batchCount;
+    bytes = elements * elementSize * batchCount;
+    return true;
+}
+
+/**
+* Add the given device time to the profile entries
+*/
+static void recordProfile(const ProfileRecord &record, int64_t nanos)
+{
+    int bucket = 0;
+    while (bucket < PROFILE_BUCKET_COUNT - 1 && (nanos >> (bucket + 1)) > 0)
+    {
+        bucket++;
+    }
+    std::lock_guard<std::mutex> lock(profileEntriesMutex);
+    std::map<ProfileKey, ProfileEntry>::iterator it = profileEntries.find(record.key);
+    if (it == profileEntries.end())
+    {
+        ProfileEntry entry = {};
+        entry.minNanos = nanos;
+        entry.maxNanos = nanos;
+        entry.flops = record.flops;
+        entry.bytes = record.bytes;
+        it = profileEntries.insert(std::make_pair(record.key, entry)).first;
+    }
+    ProfileEntry &entry = it->second;
+    entry.calls++;
+    entry.totalNanos += nanos;
+    if (nanos < entry.minNanos) entry.minNanos = nanos;
+    if (nanos > entry.maxNanos) entry.maxNanos = nanos;
+    entry.buckets[bucket]++;
+}
+
+/**
+* The callback for the event of a profiled call. It computes the device
+* time from the end of the marker that was enqueued before the call to
+* the end of the event of the call, so that all kernels of routines that
+* enqueue several kernels are covered. If the marker does not provide a
+* usable time stamp, then the start of the event is used instead.
+*/
+static void CL_CALLBACK profilingCallback(cl_event event, cl_int status, void *userData)
+{
+    ProfileRecord *record = (ProfileRecord*)userData;
+    if (status == CL_COMPLETE)
+    {
+        cl_ulong start = 0;
+        cl_ulong end = 0;
+        cl_ulong markerEnd = 0;
+        cl_int startResult = clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &start, nullptr);
+        cl_int endResult = clGetEventProfilingInfo(event, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &end, nullptr);
+        if (record->marker != nullptr &&
+            clGetEventProfilingInfo(record->marker, CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &markerEnd, nullptr) == CL_SUCCESS &&
+            markerEnd != 0 && markerEnd <= start)
+        {
+            start = markerEnd;
+        }
+        if (startResult == CL_SUCCESS && endResult == CL_SUCCESS && end >= start)
+        {
+            recordProfile(*record, (int64_t)(end - start));
+        }
+    }
+    if (record->marker != nullptr)
+    {
+        clReleaseEvent(record->marker);
+    }
+    clReleaseEvent(event);
+    delete record;
+}
+
+void ProfilingScope::begin()
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (kinds[i] == ARGUMENT_QUEUE || kinds[i] == ARGUMENT_QUEUE_WAIT_LIST)
+        {
+            queue = *nativeValues[i].queue;
+        }
+        else if (kinds[i] == ARGUMENT_EVENT)
+        {
+            eventIndex = i;
+        }
+    }
+    if (queue == nullptr || eventIndex == -1)
+    {
+        return;
+    }
+    cl_command_queue_properties properties = 0;
+    if (clGetCommandQueueInfo(queue, CL_QUEUE_PROPERTIES, sizeof(properties), &properties, nullptr) != CL_SUCCESS ||
+        (properties & CL_QUEUE_PROFILING_ENABLE) == 0)
+    {
+        return;
+    }
+    if (clEnqueueMarkerWithWaitList(queue, 0, nullptr, &marker) != CL_SUCCESS)
+    {
+        marker = nullptr;
+    }
+    if (nativeValues[eventIndex].event == nullptr)
+    {
+        nativeValues[eventIndex].event = &internalEvent;
+    }
+    active = true;
+}
+
+void ProfilingScope::end(CLBlastStatusCode result)
+{
+    cl_event *eventPointer = nativeValues[eventIndex].event;
+    bool internal = (eventPointer == &internalEvent);
+    if (internal)
+    {
+        // The null event from Java is written back as usual
+        nativeValues[eventIndex].event = nullptr;
+    }
+    cl_event event = *eventPointer;
+    if (result != CLBlastSuccess || event == nullptr)
+    {
+        if (marker != nullptr) clReleaseEvent(marker);
+        if (internal && event != nullptr) clReleaseEvent(event);
+        return;
+    }
+
+    // Collect the dimensions of the call
+    ProfileShape shape;
+    std::string shapeString;
+    int index = 0;
+    for (int i = 0; i < count; i++)
+    {
+        if (kinds[i] == ARGUMENT_SIZE || kinds[i] == ARGUMENT_ENUM)
+        {
+            std::string name = parameterName(routine.parameterNames, index);
+            if (kinds[i] == ARGUMENT_SIZE && isDimension(name))
+            {
+                shape.put(name, nativeValues[i].size);
+                if (!shapeString.empty()) shapeString += ", ";
+                shapeString += name + "=" + std::to_string((long long)nativeValues[i].size);
+            }
+            else if (kinds[i] == ARGUMENT_ENUM && name == "side")
+            {
+                shape.left = (nativeValues[i].enumeration == CLBlastSideLeft);
+                if (!shapeString.empty()) shapeString += ", ";
+                shapeString += shape.left ? "side=left" : "side=right";
+            }
+        }
+        index += parameterCount(kinds[i]);
+    }
+    ProfileRecord *record = new ProfileRecord();
+    record->key.routine = routine.name;
+    record->key.device = obtainDeviceName(queue);
+    record->key.shape = shapeString;
+    record->flops = 0;
+    record->bytes = 0;
+    computeCost(routine.name, shape, record->flops, record->bytes);
+    record->marker = marker;
+
+    // The callback releases the event. For an event that is passed to
+    // Java, an additional reference is retained for the callback.
+    if (!internal)
+    {
+        clRetainEvent(event);
+    }
+    if (clSetEventCallback(event, CL_COMPLETE, profilingCallback, record) != CL_SUCCESS)
+    {
+        Logger::log(LOG_DEBUG, "Could not set the profiling callback for %s\n", routine.name);
+        if (marker != nullptr) clReleaseEvent(marker);
+        clReleaseEvent(event);
+        delete record;
+    }
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    setProfilingEnabledNative
+* Signature: (Z)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setProfilingEnabledNative
+(JNIEnv *env, jclass UNUSED(cls), jboolean enabled)
+{
+    Logger::log(LOG_TRACE, "Executing setProfilingEnabled(enabled=%d)\n", (int)enabled);
+    profilingEnabled.store(enabled == JNI_TRUE);
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    getProfileNative
+* Signature: (Z)[Ljava/lang/Object;
+*/
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_getProfileNative
+(JNIEnv *env, jclass UNUSED(cls), jboolean reset)
+{
+    Logger::log(LOG_TRACE, "Executing getProfile(reset=%d)\n", (int)reset);
+
+    // Copy the entries, so that the JNI calls are not done while the
+    // callbacks are blocked
+    std::vector<std::pair<ProfileKey, ProfileEntry> > entries;
+    {
+        std::lock_guard<std::mutex> lock(profileEntriesMutex);
+        entries.assign(profileEntries.begin(), profileEntries.end());
+        if (reset == JNI_TRUE)
+        {
+            profileEntries.clear();
+        }
+    }
+
+    // The result contains a String[] with the routine name, device name
+    // and shape of each entry, and a long[] with the values of each entry
+    jclass Object_Class = env->FindClass("java/lang/Object");
+    if (Object_Class == nullptr) return nullptr;
+    jclass String_Class = env->FindClass("java/lang/String");
+    if (String_Class == nullptr) return nullptr;
+    jobjectArray result = env->NewObjectArray(2, Object_Class, nullptr);
+    if (result == nullptr) return nullptr;
+    jsize entryCount = (jsize)entries.size();
+    jobjectArray strings = env->NewObjectArray(entryCount * 3, String_Class, nullptr);
+    if (strings == nullptr) return nullptr;
+    std::vector<jlong> values;
+    values.reserve(entries.size() * PROFILE_ENTRY_VALUES);
+    for (jsize i = 0; i < entryCount; i++)
+    {
+        const ProfileKey &key = entries[i].first;
+        const ProfileEntry &entry = entries[i].second;
+        const std::string *keyStrings[] = { &key.routine, &key.device, &key.shape };
+        for (int j = 0; j < 3; j++)
+        {
+            jstring string = env->NewStringUTF(keyStrings[j]->c_str());
+            if (string == nullptr) return nullptr;
+            env->SetObjectArrayElement(strings, i * 3 + j, string);
+            env->DeleteLocalRef(string);
+        }
+        values.push_back((jlong)entry.calls);
+        values.push_back((jlong)entry.totalNanos);
+        values.push_back((jlong)entry.minNanos);
+        values.push_back((jlong)entry.maxNanos);
+        values.push_back((jlong)entry.flops);
+        values.push_back((jlong)entry.bytes);
+        for (int b = 0; b < PROFILE_BUCKET_COUNT; b++)
+        {
+            values.push_back((jlong)entry.buckets[b]);
+        }
+    }
+    jlongArray valuesArray = env->NewLongArray((jsize)values.size());
+    if (valuesArray == nullptr) return nullptr;
+    env->SetLongArrayRegion(valuesArray, 0, (jsize)values.size(), values.data());
+    env->SetObjectArrayElement(result, 0, strings);
+    env->SetObjectArrayElement(result, 1, valuesArray);
+    return result;
+}
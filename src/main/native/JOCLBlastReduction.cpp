@@ -0,0 +1,737 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2015-2018 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "JOCLBlastReduction.hpp"
+
+#include <string.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+#include "PointerUtils.hpp"
+#include "CLJNIUtils.hpp"
+#include "ConversionsCL.hpp"
+#include "JOCLBlastKernelCache.hpp"
+#include "JOCLBlastStatistics.hpp"
+#include "JOCLBlastUtils.hpp"
+#include <clblast_c.h>
+
+// The size of a single result slot, in bytes. This is sufficient for a
+// double value, and keeps the slots aligned for all result types.
+#define REDUCTION_SLOT_SIZE 16
+
+// The number of result slots in each block of result buffers
+#define REDUCTION_SLOTS_PER_BLOCK 256
+
+/**
+* The type of the value that a reduction routine writes into its
+* result buffer
+*/
+enum ReductionType
+{
+    REDUCTION_FLOAT,
+    REDUCTION_DOUBLE,
+    REDUCTION_INDEX
+};
+
+/**
+* Information about a reduction routine
+*/
+struct ReductionRoutine
+{
+    const char *name;
+    StatisticsRoutine statistics;
+    ReductionType type;
+    bool hasY;
+};
+
+// The reduction routines. The order must match the order of the routine
+// constants in CLBlastReduction.java
+static const ReductionRoutine reductionRoutines[] =
+{
+    { "CLBlastSdot", STATISTICS_CLBlastSdot, REDUCTION_FLOAT, true },
+    { "CLBlastDdot", STATISTICS_CLBlastDdot, REDUCTION_DOUBLE, true },
+    { "CLBlastSnrm2", STATISTICS_CLBlastSnrm2, REDUCTION_FLOAT, false },
+    { "CLBlastDnrm2", STATISTICS_CLBlastDnrm2, REDUCTION_DOUBLE, false },
+    { "CLBlastScnrm2", STATISTICS_CLBlastScnrm2, REDUCTION_FLOAT, false },
+    { "CLBlastDznrm2", STATISTICS_CLBlastDznrm2, REDUCTION_DOUBLE, false },
+    { "CLBlastSasum", STATISTICS_CLBlastSasum, REDUCTION_FLOAT, false },
+    { "CLBlastDasum", STATISTICS_CLBlastDasum, REDUCTION_DOUBLE, false },
+    { "CLBlastScasum", STATISTICS_CLBlastScasum, REDUCTION_FLOAT, false },
+    { "CLBlastDzasum", STATISTICS_CLBlastDzasum, REDUCTION_DOUBLE, false },
+    { "CLBlastSsum", STATISTICS_CLBlastSsum, REDUCTION_FLOAT, false },
+    { "CLBlastDsum", STATISTICS_CLBlastDsum, REDUCTION_DOUBLE, false },
+    { "CLBlastScsum", STATISTICS_CLBlastScsum, REDUCTION_FLOAT, false },
+    { "CLBlastDzsum", STATISTICS_CLBlastDzsum, REDUCTION_DOUBLE, false },
+    { "CLBlastiSamax", STATISTICS_CLBlastiSamax, REDUCTION_INDEX, false },
+    { "CLBlastiDamax", STATISTICS_CLBlastiDamax, REDUCTION_INDEX, false },
+    { "CLBlastiCamax", STATISTICS_CLBlastiCamax, REDUCTION_INDEX, false },
+    { "CLBlastiZamax", STATISTICS_CLBlastiZamax, REDUCTION_INDEX, false },
+    { "CLBlastiSamin", STATISTICS_CLBlastiSamin, REDUCTION_INDEX, false },
+    { "CLBlastiDamin", STATISTICS_CLBlastiDamin, REDUCTION_INDEX, false },
+    { "CLBlastiCamin", STATISTICS_CLBlastiCamin, REDUCTION_INDEX, false },
+    { "CLBlastiZamin", STATISTICS_CLBlastiZamin, REDUCTION_INDEX, false },
+    { "CLBlastiSmax", STATISTICS_CLBlastiSmax, REDUCTION_INDEX, false },
+    { "CLBlastiDmax", STATISTICS_CLBlastiDmax, REDUCTION_INDEX, false },
+    { "CLBlastiCmax", STATISTICS_CLBlastiCmax, REDUCTION_INDEX, false },
+    { "CLBlastiZmax", STATISTICS_CLBlastiZmax, REDUCTION_INDEX, false },
+    { "CLBlastiSmin", STATISTICS_CLBlastiSmin, REDUCTION_INDEX, false },
+    { "CLBlastiDmin", STATISTICS_CLBlastiDmin, REDUCTION_INDEX, false },
+    { "CLBlastiCmin", STATISTICS_CLBlastiCmin, REDUCTION_INDEX, false },
+    { "CLBlastiZmin", STATISTICS_CLBlastiZmin, REDUCTION_INDEX, false },
+};
+
+// The number of reduction routines
+#define NUM_REDUCTION_ROUTINES ((jint)(sizeof(reductionRoutines) / sizeof(reductionRoutines[0])))
+
+/**
+* A block of result slots. The routines write their results into the
+* device buffer. The results are read into the pinned buffer, which is
+* mapped once when the block is created, and stays mapped until the
+* block is released. The context and device are stored, so that a queue
+* for unmapping the buffer can be created when the block is released.
+* They are not retained, because the buffers keep the context alive.
+*/
+struct ReductionBlock
+{
+    cl_mem device;
+    cl_mem pinned;
+    cl_context context;
+    cl_device_id mapDevice;
+    unsigned char *host;
+};
+
+/**
+* The result slots of one context. The idle slots are handed out in
+* the order in which they have been returned, so that the slots are
+* used like a ring buffer.
+*/
+struct ContextReductionSlots
+{
+    ContextReductionSlots() : used(0) {}
+
+    std::vector<ReductionBlock> blocks;
+    std::deque<size_t> idle;
+    size_t used;
+};
+
+/**
+* A result slot that was obtained with acquireReductionSlot
+*/
+struct ReductionSlot
+{
+    cl_context context;
+    size_t index;
+    cl_mem device;
+    size_t offset;
+    unsigned char *host;
+};
+
+/**
+* The state of an asynchronous reduction. It is shared between the Java
+* object and the callback of the event of the read operation.
+*/
+struct ReductionTask
+{
+    ReductionTask() : type(REDUCTION_FLOAT), done(false), status(CL_SUCCESS), value(0.0) {}
+
+    ReductionType type;
+    ReductionSlot slot;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool done;
+    cl_int status;
+    double value;
+};
+
+/**
+* The arguments of a reduction call, after they have been converted
+*/
+struct ReductionCall
+{
+    jint id;
+    const ReductionRoutine *routine;
+    size_t n;
+    cl_mem x;
+    size_t x_offset;
+    size_t x_inc;
+    cl_mem y;
+    size_t y_offset;
+    size_t y_inc;
+    cl_command_queue *queue;
+};
+
+// The mutex protecting the result slots
+static std::mutex slotsMutex;
+
+// The result slots for each context
+static std::map<cl_context, ContextReductionSlots> contextSlots;
+
+/**
+* Call the CLBlast function for the reduction routine with the given ID
+*/
+static CLBlastStatusCode callReductionRoutine(jint id, size_t n,
+    cl_mem result, size_t result_offset,
+    cl_mem x, size_t x_offset, size_t x_inc,
+    cl_mem y, size_t y_offset, size_t y_inc,
+    cl_command_queue *queue)
+{
+    switch (id)
+    {
+        case 0: return CLBlastSdot(n, result, result_offset, x, x_offset, x_inc, y, y_offset, y_inc, queue, nullptr);
+        case 1: return CLBlastDdot(n, result, result_offset, x, x_offset, x_inc, y, y_offset, y_inc, queue, nullptr);
+        case 2: return CLBlastSnrm2(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 3: return CLBlastDnrm2(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 4: return CLBlastScnrm2(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 5: return CLBlastDznrm2(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 6: return CLBlastSasum(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 7: return CLBlastDasum(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 8: return CLBlastScasum(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 9: return CLBlastDzasum(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 10: return CLBlastSsum(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 11: return CLBlastDsum(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 12: return CLBlastScsum(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 13: return CLBlastDzsum(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 14: return CLBlastiSamax(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 15: return CLBlastiDamax(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 16: return CLBlastiCamax(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 17: return CLBlastiZamax(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 18: return CLBlastiSamin(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 19: return CLBlastiDamin(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 20: return CLBlastiCamin(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 21: return CLBlastiZamin(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 22: return CLBlastiSmax(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 23: return CLBlastiDmax(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 24: return CLBlastiCmax(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 25: return CLBlastiZmax(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 26: return CLBlastiSmin(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 27: return CLBlastiDmin(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 28: return CLBlastiCmin(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+        case 29: return CLBlastiZmin(n, result, result_offset, x, x_offset, x_inc, queue, nullptr);
+    }
+    return CLBlastInvalidValue;
+}
+
+/**
+* Returns the size of the value that is written by a routine with the
+* given result type, in bytes
+*/
+static size_t reductionElementSize(ReductionType type)
+{
+    return type == REDUCTION_DOUBLE ? sizeof(cl_double) : sizeof(cl_float);
+}
+
+/**
+* Returns the value of the given type that is stored at the given host
+* pointer, converted to double. This is exact for all result types.
+*/
+static double reductionValue(ReductionType type, const unsigned char *host)
+{
+    switch (type)
+    {
+        case REDUCTION_FLOAT:
+        {
+            cl_float value;
+            memcpy(&value, host, sizeof(value));
+            return (double)value;
+        }
+        case REDUCTION_DOUBLE:
+        {
+            cl_double value;
+            memcpy(&value, host, sizeof(value));
+            return (double)value;
+        }
+        case REDUCTION_INDEX:
+        {
+            cl_uint value;
+            memcpy(&value, host, sizeof(value));
+            return (double)value;
+        }
+    }
+    return 0.0;
+}
+
+/**
+* Release the buffers of the given block
+*/
+static void releaseReductionBlock(ReductionBlock &block)
+{
+    if (block.host != nullptr)
+    {
+        cl_int error = CL_SUCCESS;
+        cl_command_queue queue = clCreateCommandQueue(block.context, block.mapDevice, 0, &error);
+        if (error == CL_SUCCESS)
+        {
+            clEnqueueUnmapMemObject(queue, block.pinned, block.host, 0, nullptr, nullptr);
+            clFinish(queue);
+            clReleaseCommandQueue(queue);
+        }
+        else
+        {
+            Logger::log(LOG_ERROR, "Could not create queue for unmapping reduction results: %d\n", (int)error);
+        }
+    }
+    if (block.pinned != nullptr) clReleaseMemObject(block.pinned);
+    if (block.device != nullptr) clReleaseMemObject(block.device);
+}
+
+/**
+* Create a new block of result slots for the given context. The pinned
+* buffer is mapped using the given queue, which is only used for this
+* call.
+*/
+static cl_int createReductionBlock(cl_context context, cl_command_queue queue, ReductionBlock &block)
+{
+    size_t size = REDUCTION_SLOT_SIZE * REDUCTION_SLOTS_PER_BLOCK;
+    block.device = nullptr;
+    block.pinned = nullptr;
+    block.context = context;
+    block.mapDevice = nullptr;
+    block.host = nullptr;
+
+    cl_int error = clGetCommandQueueInfo(queue, CL_QUEUE_DEVICE, sizeof(cl_device_id), &block.mapDevice, nullptr);
+    if (error == CL_SUCCESS)
+    {
+        block.device = clCreateBuffer(context, CL_MEM_READ_WRITE, size, nullptr, &error);
+    }
+    if (error == CL_SUCCESS)
+    {
+        block.pinned = clCreateBuffer(context, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, size, nullptr, &error);
+    }
+    if (error == CL_SUCCESS)
+    {
+        block.host = (unsigned char*)clEnqueueMapBuffer(queue, block.pinned, CL_TRUE,
+            CL_MAP_READ | CL_MAP_WRITE, 0, size, 0, nullptr, nullptr, &error);
+    }
+    if (error != CL_SUCCESS)
+    {
+        Logger::log(LOG_ERROR, "Could not create reduction result buffers: %d\n", (int)error);
+        block.host = nullptr;
+        releaseReductionBlock(block);
+        return error;
+    }
+    return CL_SUCCESS;
+}
+
+/**
+* Fill the given slot with the data of the slot with the given index
+*/
+static void initReductionSlot(const ContextReductionSlots &slots, cl_context context, size_t index, ReductionSlot &slot)
+{
+    const ReductionBlock &block = slots.blocks[index / REDUCTION_SLOTS_PER_BLOCK];
+    slot.context = context;
+    slot.index = index;
+    slot.device = block.device;
+    slot.offset = (index % REDUCTION_SLOTS_PER_BLOCK) * REDUCTION_SLOT_SIZE;
+    slot.host = block.host + slot.offset;
+}
+
+/**
+* Obtain an idle result slot for the context of the given queue. If
+* there is no idle slot, then a new block of slots is created.
+*/
+static cl_int acquireReductionSlot(cl_command_queue queue, ReductionSlot &slot)
+{
+    cl_context context = nullptr;
+    cl_int error = clGetCommandQueueInfo(queue, CL_QUEUE_CONTEXT, sizeof(cl_context), &context, nullptr);
+    if (error != CL_SUCCESS) return error;
+    {
+        std::lock_guard<std::mutex> lock(slotsMutex);
+        ContextReductionSlots &slots = contextSlots[context];
+        if (!slots.idle.empty())
+        {
+            size_t index = slots.idle.front();
+            slots.idle.pop_front();
+            slots.used++;
+            initReductionSlot(slots, context, index, slot);
+            return CL_SUCCESS;
+        }
+    }
+    ReductionBlock block;
+    error = createReductionBlock(context, queue, block);
+    if (error != CL_SUCCESS) return error;
+
+    std::lock_guard<std::mutex> lock(slotsMutex);
+    ContextReductionSlots &slots = contextSlots[context];
+    size_t first = slots.blocks.size() * REDUCTION_SLOTS_PER_BLOCK;
+    slots.blocks.push_back(block);
+    for (size_t i = 1; i < REDUCTION_SLOTS_PER_BLOCK; i++)
+    {
+        slots.idle.push_back(first + i);
+    }
+    slots.used++;
+    initReductionSlot(slots, context, first, slot);
+    return CL_SUCCESS;
+}
+
+/**
+* Return the given slot to the idle slots of its context
+*/
+static void releaseReductionSlot(const ReductionSlot &slot)
+{
+    std::lock_guard<std::mutex> lock(slotsMutex);
+    ContextReductionSlots &slots = contextSlots[slot.context];
+    slots.idle.push_back(slot.index);
+    slots.used--;
+}
+
+/**
+* Throw a CLException for the given status, by calling the throwStatus
+* method of the CLBlastReduction class. If an exception is already
+* pending, then nothing is done.
+*/
+static void throwReductionStatus(JNIEnv *env, jclass cls, const char *function, cl_int status)
+{
+    if (env->ExceptionCheck())
+    {
+        return;
+    }
+    jmethodID method = env->GetStaticMethodID(cls, "throwStatus", "(Ljava/lang/String;I)V");
+    if (method == nullptr)
+    {
+        return;
+    }
+    jstring name = env->NewStringUTF(function);
+    if (name == nullptr)
+    {
+        return;
+    }
+    env->CallStaticVoidMethod(cls, method, name, (jint)status);
+    env->DeleteLocalRef(name);
+}
+
+/**
+* Convert the arguments of a reduction call. Returns false if a Java
+* exception was thrown because an argument was invalid.
+*/
+static bool initReductionCall(JNIEnv *env, jint routine, jlong n,
+    jobject x_buffer, jlong x_offset, jlong x_inc,
+    jobject y_buffer, jlong y_offset, jlong y_inc,
+    jobject queue, ReductionCall &call)
+{
+    if (routine < 0 || routine >= NUM_REDUCTION_ROUTINES)
+    {
+        ThrowByName(env, "java/lang/IllegalArgumentException", "Invalid reduction routine");
+        return false;
+    }
+    const ReductionRoutine *reductionRoutine = &reductionRoutines[routine];
+    if (x_buffer == nullptr)
+    {
+        std::string message = std::string("Parameter 'x_buffer' is null for ") + reductionRoutine->name;
+        ThrowByName(env, "java/lang/NullPointerException", message.c_str());
+        return false;
+    }
+    if (reductionRoutine->hasY && y_buffer == nullptr)
+    {
+        std::string message = std::string("Parameter 'y_buffer' is null for ") + reductionRoutine->name;
+        ThrowByName(env, "java/lang/NullPointerException", message.c_str());
+        return false;
+    }
+    if (queue == nullptr)
+    {
+        std::string message = std::string("Parameter 'queue' is null for ") + reductionRoutine->name;
+        ThrowByName(env, "java/lang/NullPointerException", message.c_str());
+        return false;
+    }
+
+    Logger::log(LOG_TRACE, "Executing %s result(n=%ld, x_buffer=%p, x_offset=%ld, x_inc=%ld, y_buffer=%p, y_offset=%ld, y_inc=%ld, queue=%p)\n",
+        reductionRoutine->name, (long)n, x_buffer, (long)x_offset, (long)x_inc, y_buffer, (long)y_offset, (long)y_inc, queue);
+
+    call.id = routine;
+    call.routine = reductionRoutine;
+    call.n = (size_t)n;
+    call.x = nullptr;
+    call.x_offset = (size_t)x_offset;
+    call.x_inc = (size_t)x_inc;
+    call.y = nullptr;
+    call.y_offset = (size_t)y_offset;
+    call.y_inc = (size_t)y_inc;
+    call.queue = nullptr;
+    if (!initNative(env, x_buffer, call.x, true)) return false;
+    if (reductionRoutine->hasY)
+    {
+        if (!initNative(env, y_buffer, call.y, true)) return false;
+    }
+    if (!initNative(env, queue, call.queue, true)) return false;
+    return true;
+}
+
+/**
+* Enqueue the wait list, the reduction routine that writes into the
+* given slot, and the read operation that copies the result into the
+* pinned host memory of the slot.
+*/
+static cl_int enqueueReduction(JNIEnv *env, const ReductionCall &call, jobjectArray waitList,
+    const ReductionSlot &slot, cl_bool blocking, cl_event *readEvent)
+{
+    size_t elementSize = reductionElementSize(call.routine->type);
+    {
+        StatisticsScope statisticsScope(call.routine->statistics);
+        cl_int waitList_result = enqueueWaitList(env, call.queue, waitList);
+        if (waitList_result != CL_SUCCESS) return waitList_result;
+
+        statisticsScope.beginCall();
+        CLBlastStatusCode result = callReductionRoutine(call.id, call.n,
+            slot.device, slot.offset / elementSize,
+            call.x, call.x_offset, call.x_inc,
+            call.y, call.y_offset, call.y_inc, call.queue);
+        statisticsScope.endCall(result);
+        if (result != CLBlastSuccess) return (cl_int)result;
+        trackKernelCacheUse(call.routine->name, *call.queue, result);
+    }
+    return clEnqueueReadBuffer(*call.queue, slot.device, blocking, slot.offset, elementSize, slot.host, 0, nullptr, readEvent);
+}
+
+/**
+* Store the result of the given task, return its slot, and notify all
+* threads that are waiting for the task. The status is the execution
+* status of the read operation.
+*/
+static void completeReductionTask(ReductionTask &task, cl_int status)
+{
+    double value = status == CL_COMPLETE ? reductionValue(task.type, task.slot.host) : 0.0;
+    releaseReductionSlot(task.slot);
+    std::lock_guard<std::mutex> lock(task.mutex);
+    task.done = true;
+    task.status = status < 0 ? status : CL_SUCCESS;
+    task.value = value;
+    task.condition.notify_all();
+}
+
+/**
+* The callback that completes a task when its read operation is complete
+*/
+static void CL_CALLBACK reductionCallback(cl_event event, cl_int status, void *userData)
+{
+    std::shared_ptr<ReductionTask> *task = (std::shared_ptr<ReductionTask>*)userData;
+    completeReductionTask(**task, status);
+    clReleaseEvent(event);
+    delete task;
+}
+
+/**
+* Returns the task for the given handle
+*/
+static std::shared_ptr<ReductionTask> &getReductionTask(jlong handle)
+{
+    return *((std::shared_ptr<ReductionTask>*)handle);
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlastReduction
+* Method:    reduceNative
+* Signature: (IJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;)D
+*/
+JNIEXPORT jdouble JNICALL Java_org_jocl_blast_CLBlastReduction_reduceNative
+(JNIEnv *env, jclass cls, jint routine, jlong n, jobject x_buffer, jlong x_offset, jlong x_inc,
+    jobject y_buffer, jlong y_offset, jlong y_inc, jobject queue, jobjectArray waitList)
+{
+    ReductionCall call;
+    if (!initReductionCall(env, routine, n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, call))
+    {
+        return 0.0;
+    }
+    ReductionSlot slot;
+    cl_int result = acquireReductionSlot(*call.queue, slot);
+    if (result != CL_SUCCESS)
+    {
+        throwReductionStatus(env, cls, call.routine->name, result);
+        return 0.0;
+    }
+    result = enqueueReduction(env, call, waitList, slot, CL_TRUE, nullptr);
+    double value = 0.0;
+    if (result == CL_SUCCESS)
+    {
+        value = reductionValue(call.routine->type, slot.host);
+    }
+    else
+    {
+        // Make sure that nothing is still writing into the slot
+        clFinish(*call.queue);
+    }
+    releaseReductionSlot(slot);
+    if (result != CL_SUCCESS)
+    {
+        throwReductionStatus(env, cls, call.routine->name, result);
+    }
+    return (jdouble)value;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastReduction
+* Method:    reduceAsyncNative
+* Signature: (IJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;)J
+*/
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastReduction_reduceAsyncNative
+(JNIEnv *env, jclass cls, jint routine, jlong n, jobject x_buffer, jlong x_offset, jlong x_inc,
+    jobject y_buffer, jlong y_offset, jlong y_inc, jobject queue, jobjectArray waitList)
+{
+    ReductionCall call;
+    if (!initReductionCall(env, routine, n, x_buffer, x_offset, x_inc, y_buffer, y_offset, y_inc, queue, call))
+    {
+        return 0;
+    }
+    std::shared_ptr<ReductionTask> *handle = new (std::nothrow) std::shared_ptr<ReductionTask>(new (std::nothrow) ReductionTask());
+    if (handle == nullptr || handle->get() == nullptr)
+    {
+        delete handle;
+        ThrowByName(env, "java/lang/OutOfMemoryError", "Out of memory during CLBlastReduction");
+        return 0;
+    }
+    std::shared_ptr<ReductionTask> task = *handle;
+    task->type = call.routine->type;
+    cl_int result = acquireReductionSlot(*call.queue, task->slot);
+    if (result != CL_SUCCESS)
+    {
+        delete handle;
+        throwReductionStatus(env, cls, call.routine->name, result);
+        return 0;
+    }
+    cl_event readEvent = nullptr;
+    result = enqueueReduction(env, call, waitList, task->slot, CL_FALSE, &readEvent);
+    if (result != CL_SUCCESS)
+    {
+        // Make sure that nothing is still writing into the slot
+        clFinish(*call.queue);
+        releaseReductionSlot(task->slot);
+        delete handle;
+        throwReductionStatus(env, cls, call.routine->name, result);
+        return 0;
+    }
+    clFlush(*call.queue);
+
+    // Complete the task in the callback of the read event. If the
+    // callback cannot be registered, then wait for the event here.
+    std::shared_ptr<ReductionTask> *callbackTask = new (std::nothrow) std::shared_ptr<ReductionTask>(task);
+    if (callbackTask == nullptr ||
+        clSetEventCallback(readEvent, CL_COMPLETE, reductionCallback, callbackTask) != CL_SUCCESS)
+    {
+        delete callbackTask;
+        cl_int status = clWaitForEvents(1, &readEvent);
+        completeReductionTask(*task, status);
+        clReleaseEvent(readEvent);
+    }
+    return (jlong)handle;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastReduction
+* Method:    waitNative
+* Signature: (JJ)Z
+*/
+JNIEXPORT jboolean JNICALL Java_org_jocl_blast_CLBlastReduction_waitNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle, jlong timeoutMs)
+{
+    std::shared_ptr<ReductionTask> &task = getReductionTask(handle);
+    std::unique_lock<std::mutex> lock(task->mutex);
+    if (!task->done && timeoutMs > 0)
+    {
+        task->condition.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+            [&task] { return task->done; });
+    }
+    return task->done ? JNI_TRUE : JNI_FALSE;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastReduction
+* Method:    getStatusNative
+* Signature: (J)I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastReduction_getStatusNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle)
+{
+    std::shared_ptr<ReductionTask> &task = getReductionTask(handle);
+    std::lock_guard<std::mutex> lock(task->mutex);
+    return (jint)task->status;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastReduction
+* Method:    getValueNative
+* Signature: (J)D
+*/
+JNIEXPORT jdouble JNICALL Java_org_jocl_blast_CLBlastReduction_getValueNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle)
+{
+    std::shared_ptr<ReductionTask> &task = getReductionTask(handle);
+    std::lock_guard<std::mutex> lock(task->mutex);
+    return (jdouble)task->value;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastReduction
+* Method:    releaseNative
+* Signature: (J)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastReduction_releaseNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle)
+{
+    delete ((std::shared_ptr<ReductionTask>*)handle);
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastReduction
+* Method:    trimNative
+* Signature: ()V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastReduction_trimNative
+(JNIEnv *env, jclass UNUSED(cls))
+{
+    Logger::log(LOG_TRACE, "Executing CLBlastReduction trim()\n");
+    std::vector<ReductionBlock> released;
+    {
+        std::lock_guard<std::mutex> lock(slotsMutex);
+        std::map<cl_context, ContextReductionSlots>::iterator it = contextSlots.begin();
+        while (it != contextSlots.end())
+        {
+            if (it->second.used == 0)
+            {
+                released.insert(released.end(), it->second.blocks.begin(), it->second.blocks.end());
+                contextSlots.erase(it++);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+    for (size_t i = 0; i < released.size(); i++)
+    {
+        releaseReductionBlock(released[i]);
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2015-2018 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_jocl_blast_CLBlastReduction */
+
+#ifndef _Included_org_jocl_blast_CLBlastReduction
+#define _Included_org_jocl_blast_CLBlastReduction
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_jocl_blast_CLBlastReduction
+ * Method:    reduceNative
+ * Signature: (IJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;)D
+ */
+JNIEXPORT jdouble JNICALL Java_org_jocl_blast_CLBlastReduction_reduceNative
+  (JNIEnv *, jclass, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray);
+
+/*
+ * Class:     org_jocl_blast_CLBlastReduction
+ * Method:    reduceAsyncNative
+ * Signature: (IJLorg/jocl/cl_mem;JJLorg/jocl/cl_mem;JJLorg/jocl/cl_command_queue;[Lorg/jocl/cl_event;)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastReduction_reduceAsyncNative
+  (JNIEnv *, jclass, jint, jlong, jobject, jlong, jlong, jobject, jlong, jlong, jobject, jobjectArray);
+
+/*
+ * Class:     org_jocl_blast_CLBlastReduction
+ * Method:    waitNative
+ * Signature: (JJ)Z
+ */
+JNIEXPORT jboolean JNICALL Java_org_jocl_blast_CLBlastReduction_waitNative
+  (JNIEnv *, jclass, jlong, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastReduction
+ * Method:    getStatusNative
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastReduction_getStatusNative
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastReduction
+ * Method:    getValueNative
+ * Signature: (J)D
+ */
+JNIEXPORT jdouble JNICALL Java_org_jocl_blast_CLBlastReduction_getValueNative
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastReduction
+ * Method:    releaseNative
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastReduction_releaseNative
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastReduction
+ * Method:    trimNative
+ * Signature: ()V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastReduction_trimNative
+  (JNIEnv *, jclass);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,487 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlastRoutines.hpp"
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <string>
+#include <new>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+
+std::atomic<bool> routineTraceEnabled(false);
+
+int parameterCount(ArgumentKind kind)
+{
+    switch (kind)
+    {
+        case ARGUMENT_COMPLEX_FLOAT:
+        case ARGUMENT_COMPLEX_DOUBLE:
+        case ARGUMENT_QUEUE_WAIT_LIST:
+            return 2;
+        default:
+            return 1;
+    }
+}
+
+/**
+* Returns whether the Java argument of the given kind is a primitive value
+*/
+static bool isPrimitive(ArgumentKind kind)
+{
+    switch (kind)
+    {
+        case ARGUMENT_SIZE:
+        case ARGUMENT_ENUM:
+        case ARGUMENT_FLOAT:
+        case ARGUMENT_DOUBLE:
+        case ARGUMENT_HALF:
+        case ARGUMENT_COMPLEX_FLOAT:
+        case ARGUMENT_COMPLEX_DOUBLE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+std::string parameterName(const char *names, int index)
+{
+    const char *name = names;
+    for (int i = 0; i < index && name != nullptr; i++)
+    {
+        name = strchr(name, ',');
+        if (name != nullptr) name++;
+    }
+    if (name == nullptr)
+    {
+        return std::string();
+    }
+    while (*name == ' ')
+    {
+        name++;
+    }
+    const char *end = strchr(name, ',');
+    if (end == nullptr)
+    {
+        end = name + strlen(name);
+    }
+    return std::string(name, end);
+}
+
+/**
+* Append "<name>=<value>" for the given parameter to the given message,
+* where the value is formatted with the given format
+*/
+static void appendParameter(std::string &message, const char *names, int index, const char *format, ...)
+{
+    if (index > 0)
+    {
+        message += ", ";
+    }
+    message += parameterName(names, index);
+    message += '=';
+
+    char buffer[64];
+    va_list args;
+    va_start(args, format);
+    vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    message += buffer;
+}
+
+/**
+* Print the trace log message for a call to the given routine
+*/
+static void logArguments(const Routine &routine,
+    const ArgumentKind *kinds, int count, const JavaArgument *javaArguments)
+{
+    const char *names = routine.parameterNames;
+    std::string message;
+    int index = 0;
+    for (int i = 0; i < count; i++)
+    {
+        const JavaValue &value = javaArguments[i].value;
+        const JavaValue &extra = javaArguments[i].extra;
+        switch (kinds[i])
+        {
+            case ARGUMENT_SIZE:
+                appendParameter(message, names, index, "%lld", (long long)value.l);
+                break;
+            case ARGUMENT_ENUM:
+                appendParameter(message, names, index, "%d", (int)value.i);
+                break;
+            case ARGUMENT_FLOAT:
+            case ARGUMENT_HALF:
+                appendParameter(message, names, index, "%f", (double)value.f);
+                break;
+            case ARGUMENT_DOUBLE:
+                appendParameter(message, names, index, "%f", (double)value.d);
+                break;
+            case ARGUMENT_COMPLEX_FLOAT:
+                appendParameter(message, names, index, "%f", (double)value.f);
+                appendParameter(message, names, index + 1, "%f", (double)extra.f);
+                break;
+            case ARGUMENT_COMPLEX_DOUBLE:
+                appendParameter(message, names, index, "%f", (double)value.d);
+                appendParameter(message, names, index + 1, "%f", (double)extra.d);
+                break;
+            case ARGUMENT_QUEUE_WAIT_LIST:
+                appendParameter(message, names, index, "%p", (void*)value.object);
+                appendParameter(message, names, index + 1, "%p", (void*)extra.object);
+                break;
+            default:
+                appendParameter(message, names, index, "%p", (void*)value.object);
+                break;
+        }
+        index += parameterCount(kinds[i]);
+    }
+    Logger::log(LOG_TRACE, "Executing %s(%s)\n", routine.name, message.c_str());
+}
+
+bool checkArguments(JNIEnv *env, const Routine &routine,
+    const ArgumentKind *kinds, int count, const JavaArgument *javaArguments)
+{
+    int index = 0;
+    for (int i = 0; i < count; i++)
+    {
+        ArgumentKind kind = kinds[i];
+        if (!isPrimitive(kind) && kind != ARGUMENT_EVENT && javaArguments[i].value.object == nullptr)
+        {
+            std::string message = "Parameter '" + parameterName(routine.parameterNames, index) +
+                "' is null for " + routine.name;
+            ThrowByName(env, "java/lang/NullPointerException", message.c_str());
+            return false;
+        }
+        index += parameterCount(kind);
+    }
+    if (routineTraceEnabled.load(std::memory_order_relaxed))
+    {
+        logArguments(routine, kinds, count, javaArguments);
+    }
+    return true;
+}
+
+jint initArguments(JNIEnv *env,
+    const ArgumentKind *kinds, int count, const JavaArgument *javaArguments, NativeValue *nativeValues)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const JavaValue &value = javaArguments[i].value;
+        const JavaValue &extra = javaArguments[i].extra;
+        NativeValue &native = nativeValues[i];
+        bool success = true;
+        switch (kinds[i])
+        {
+            case ARGUMENT_SIZE:
+                native.size = (size_t)value.l;
+                break;
+            case ARGUMENT_ENUM:
+                native.enumeration = (int)value.i;
+                break;
+            case ARGUMENT_FLOAT:
+                native.f = (float)value.f;
+                break;
+            case ARGUMENT_DOUBLE:
+                native.d = (double)value.d;
+                break;
+            case ARGUMENT_HALF:
+                native.half = FloatToHalf((float)value.f);
+                break;
+            case ARGUMENT_COMPLEX_FLOAT:
+                native.float2.s[0] = (float)value.f;
+                native.float2.s[1] = (float)extra.f;
+                break;
+            case ARGUMENT_COMPLEX_DOUBLE:
+                native.double2.s[0] = (double)value.d;
+                native.double2.s[1] = (double)extra.d;
+                break;
+            case ARGUMENT_MEM:
+                native.mem = nullptr;
+                success = initNative(env, value.object, native.mem, true);
+                break;
+            case ARGUMENT_DEVICE:
+                native.device = nullptr;
+                success = initNative(env, value.object, native.device, true);
+                break;
+            case ARGUMENT_QUEUE:
+                native.queue = nullptr;
+                success = initNative(env, value.object, native.queue, true);
+                break;
+            case ARGUMENT_QUEUE_WAIT_LIST:
+                // The wait list is enqueued later, in enqueueWaitLists
+                native.queue = nullptr;
+                success = initNative(env, value.object, native.queue, true);
+                break;
+            case ARGUMENT_EVENT:
+                native.event = nullptr;
+                success = initNative(env, value.object, native.event, false);
+                break;
+            case ARGUMENT_FLOAT2_VALUE:
+                success = initNative(env, (jfloatArray)value.object, native.float2, true);
+                break;
+            case ARGUMENT_DOUBLE2_VALUE:
+                success = initNative(env, (jdoubleArray)value.object, native.double2, true);
+                break;
+            case ARGUMENT_FLOAT_ARRAY:
+                native.floats = nullptr;
+                success = initNative(env, (jfloatArray)value.object, native.floats, true);
+                break;
+            case ARGUMENT_DOUBLE_ARRAY:
+                native.doubles = nullptr;
+                success = initNative(env, (jdoubleArray)value.object, native.doubles, true);
+                break;
+            case ARGUMENT_FLOAT2_ARRAY:
+                native.float2s = nullptr;
+                success = initNative(env, (jfloatArray)value.object, native.float2s, true);
+                break;
+            case ARGUMENT_DOUBLE2_ARRAY:
+                native.double2s = nullptr;
+                success = initNative(env, (jdoubleArray)value.object, native.double2s, true);
+                break;
+            case ARGUMENT_HALF_ARRAY:
+                native.halfs = nullptr;
+                success = initNative_half(env, (jfloatArray)value.object, native.halfs, true);
+                break;
+            case ARGUMENT_SIZE_ARRAY:
+                native.sizes = nullptr;
+                success = initNative_size_t(env, (jlongArray)value.object, native.sizes, true);
+                break;
+            case ARGUMENT_DIRECT_FLOAT:
+                success = initNative_direct(env, value.object, sizeof(jfloat), native.floats, (size_t)extra.l);
+                break;
+            case ARGUMENT_DIRECT_DOUBLE:
+                success = initNative_direct(env, value.object, sizeof(jdouble), native.doubles, (size_t)extra.l);
+                break;
+            case ARGUMENT_DIRECT_FLOAT2:
+                success = initNative_direct(env, value.object, sizeof(jfloat), native.float2s, (size_t)extra.l);
+                break;
+            case ARGUMENT_DIRECT_DOUBLE2:
+                success = initNative_direct(env, value.object, sizeof(jdouble), native.double2s, (size_t)extra.l);
+                break;
+            case ARGUMENT_DIRECT_HALF:
+                success = initNative_direct(env, value.object, sizeof(jshort), native.halfs, (size_t)extra.l);
+                break;
+            case ARGUMENT_DIRECT_SIZE:
+                success = initNative_direct_size_t(env, value.object, native.sizes, (size_t)extra.l);
+                break;
+        }
+        if (!success) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+    }
+    return CL_SUCCESS;
+}
+
+jint enqueueWaitLists(JNIEnv *env,
+    const ArgumentKind *kinds, int count, const JavaArgument *javaArguments, NativeValue *nativeValues)
+{
+    for (int i = 0; i < count; i++)
+    {
+        if (kinds[i] != ARGUMENT_QUEUE_WAIT_LIST) continue;
+        jobjectArray waitList = (jobjectArray)javaArguments[i].extra.object;
+        cl_int result = enqueueWaitList(env, nativeValues[i].queue, waitList);
+        if (result != CL_SUCCESS) return (jint)result;
+    }
+    return CL_SUCCESS;
+}
+
+bool releaseArguments(JNIEnv *env,
+    const ArgumentKind *kinds, int count, const JavaArgument *javaArguments, NativeValue *nativeValues)
+{
+    for (int i = 0; i < count; i++)
+    {
+        const JavaValue &value = javaArguments[i].value;
+        NativeValue &native = nativeValues[i];
+        bool success = true;
+        switch (kinds[i])
+        {
+            case ARGUMENT_EVENT:
+                success = releaseNative(env, native.event, value.object, true);
+                break;
+            case ARGUMENT_FLOAT2_VALUE:
+                success = releaseNative(env, native.float2, (jfloatArray)value.object, true);
+                break;
+            case ARGUMENT_DOUBLE2_VALUE:
+                success = releaseNative(env, native.double2, (jdoubleArray)value.object, true);
+                break;
+            case ARGUMENT_FLOAT_ARRAY:
+                success = releaseNative(env, native.floats, (jfloatArray)value.object, true);
+                break;
+            case ARGUMENT_DOUBLE_ARRAY:
+                success = releaseNative(env, native.doubles, (jdoubleArray)value.object, true);
+                break;
+            case ARGUMENT_FLOAT2_ARRAY:
+                success = releaseNative(env, native.float2s, (jfloatArray)value.object, true);
+                break;
+            case ARGUMENT_DOUBLE2_ARRAY:
+                success = releaseNative(env, native.double2s, (jdoubleArray)value.object, true);
+                break;
+            case ARGUMENT_HALF_ARRAY:
+                success = releaseNative_half(env, native.halfs, (jfloatArray)value.object, false);
+                break;
+            case ARGUMENT_SIZE_ARRAY:
+                success = releaseNative_size_t(env, native.sizes, (jlongArray)value.object, false);
+                break;
+            case ARGUMENT_DIRECT_SIZE:
+                success = releaseNative_direct_size_t(env, native.sizes, value.object);
+                break;
+            default:
+                // Primitive values, read-only native pointers and
+                // direct buffers do not have to be written back
+                break;
+        }
+        if (!success) return false;
+    }
+    return true;
+}
+
+
+
+/**
+* Initialize the given native cl_half array from the given Java float
+* array. The native array is allocated here, and must be freed with
+* releaseNative_half. If 'fill' is true, then the values of the Java
+* array are converted into half-precision values and written into
+* the native array.
+*/
+bool initNative_half(JNIEnv *env, jfloatArray javaArray, cl_half* &nativeArray, bool fill)
+{
+    if (javaArray == nullptr)
+    {
+        nativeArray = nullptr;
+        return true;
+    }
+    jsize length = env->GetArrayLength(javaArray);
+    nativeArray = new (std::nothrow) cl_half[(size_t)length];
+    if (nativeArray == nullptr)
+    {
+        ThrowByName(env, "java/lang/OutOfMemoryError",
+            "Out of memory during half array creation");
+        return false;
+    }
+    if (fill)
+    {
+        jfloat *javaArrayElements = (jfloat*)env->GetPrimitiveArrayCritical(javaArray, nullptr);
+        if (javaArrayElements == nullptr)
+        {
+            delete[] nativeArray;
+            nativeArray = nullptr;
+            return false;
+        }
+        for (jsize i = 0; i < length; i++)
+        {
+            nativeArray[i] = FloatToHalf((float)javaArrayElements[i]);
+        }
+        env->ReleasePrimitiveArrayCritical(javaArray, javaArrayElements, JNI_ABORT);
+    }
+    return true;
+}
+
+/**
+* Release the given native cl_half array. If 'writeBack' is true, then
+* the values of the native array are converted into float values and
+* written into the given Java array.
+*/
+bool releaseNative_half(JNIEnv *env, cl_half* &nativeArray, jfloatArray javaArray, bool writeBack)
+{
+    if (javaArray == nullptr)
+    {
+        delete[] nativeArray;
+        nativeArray = nullptr;
+        return true;
+    }
+    if (writeBack)
+    {
+        jsize length = env->GetArrayLength(javaArray);
+        jfloat *javaArrayElements = (jfloat*)env->GetPrimitiveArrayCritical(javaArray, nullptr);
+        if (javaArrayElements == nullptr)
+        {
+            delete[] nativeArray;
+            nativeArray = nullptr;
+            return false;
+        }
+        for (jsize i = 0; i < length; i++)
+        {
+            javaArrayElements[i] = (jfloat)HalfToFloat(nativeArray[i]);
+        }
+        env->ReleasePrimitiveArrayCritical(javaArray, javaArrayElements, 0);
+    }
+    delete[] nativeArray;
+    nativeArray = nullptr;
+    return true;
+}
+
+
+
+
+/**
+* Initialize the given native size_t array from the given direct
+* LongBuffer. If size_t has the same size as jlong, then the array
+* will point to the contents of the buffer. Otherwise, the values
+* will be converted into a newly allocated array, which is deleted
+* in releaseNative_direct_size_t.
+*/
+bool initNative_direct_size_t(JNIEnv *env, jobject buffer, size_t* &nativeArray, size_t count)
+{
+    nativeArray = nullptr;
+    jlong *longs = nullptr;
+    if (!initNative_direct(env, buffer, sizeof(jlong), longs, count))
+    {
+        return false;
+    }
+    if (sizeof(size_t) == sizeof(jlong))
+    {
+        nativeArray = (size_t*)longs;
+        return true;
+    }
+    nativeArray = new (std::nothrow) size_t[count];
+    if (nativeArray == nullptr)
+    {
+        ThrowByName(env, "java/lang/OutOfMemoryError",
+            "Out of memory during size_t array creation");
+        return false;
+    }
+    for (size_t i = 0; i < count; i++)
+    {
+        nativeArray[i] = (size_t)longs[i];
+    }
+    return true;
+}
+
+/**
+* Release the given native size_t array that was initialized with
+* initNative_direct_size_t
+*/
+bool releaseNative_direct_size_t(JNIEnv *env, size_t* &nativeArray, jobject buffer)
+{
+    if (sizeof(size_t) != sizeof(jlong))
+    {
+        delete[] nativeArray;
+    }
+    nativeArray = nullptr;
+    return true;
+}
@@ -0,0 +1,655 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef JOCL_BLAST_ROUTINES_HPP
+#define JOCL_BLAST_ROUTINES_HPP
+
+#include <jni.h>
+#include <CL/cl.h>
+#include <clblast_c.h>
+#include <clblast_half.h>
+
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+
+#include "JNIUtils.hpp"
+#include "ConversionsCL.hpp"
+#include "JOCLBlastKernelCache.hpp"
+#include "JOCLBlastStatistics.hpp"
+#include "JOCLBlastUtils.hpp"
+
+// The generic wrapper for the CLBlast routines. Each JNI function only
+// describes its routine with a Routine structure, and passes its Java
+// arguments to callRoutine. The types of the native parameters of the
+// CLBlast function and the types of the Java arguments determine a
+// table of ArgumentKind values at compile time. The null checks, the
+// log message and the conversion of the arguments are implemented once
+// for all routines, based on this table. Only the call of the CLBlast
+// function itself is specific for each routine.
+
+// The field IDs of the 'position' and 'limit' fields of java.nio.Buffer
+extern jfieldID Buffer_position;
+extern jfieldID Buffer_limit;
+
+// Whether trace log messages are printed for the routine calls. This
+// avoids assembling the message when the log level is lower.
+extern std::atomic<bool> routineTraceEnabled;
+
+/**
+* The description of a routine: The name that appears in the log and
+* in exception messages, the ID for the statistics, and the
+* comma-separated names of all Java parameters of the JNI function
+*/
+struct Routine
+{
+    const char *name;
+    StatisticsRoutine statistics;
+    const char *parameterNames;
+};
+
+/**
+* Initialize the given native cl_half array from the given Java float
+* array. The native array is allocated here, and must be freed with
+* releaseNative_half. If 'fill' is true, then the values of the Java
+* array are converted into half-precision values and written into
+* the native array.
+*/
+bool initNative_half(JNIEnv *env, jfloatArray javaArray, cl_half* &nativeArray, bool fill);
+
+/**
+* Release the given native cl_half array. If 'writeBack' is true, then
+* the values of the native array are converted into float values and
+* written into the given Java array.
+*/
+bool releaseNative_half(JNIEnv *env, cl_half* &nativeArray, jfloatArray javaArray, bool writeBack);
+
+/**
+* Initialize the given native array to point to the contents of the
+* given direct buffer, starting at the position of the buffer, without
+* copying the data. The 'bufferElementSize' is the size of one element
+* of the buffer, in bytes. This will throw an IllegalArgumentException
+* and return false if the buffer is not direct, or if it does not have
+* enough remaining elements, between its position and its limit, to
+* provide 'count' elements of type T.
+*/
+template <typename T>
+bool initNative_direct(JNIEnv *env, jobject buffer, size_t bufferElementSize, T* &nativeArray, size_t count)
+{
+    nativeArray = nullptr;
+    char *address = (char*)env->GetDirectBufferAddress(buffer);
+    if (address == nullptr)
+    {
+        ThrowByName(env, "java/lang/IllegalArgumentException",
+            "The buffer must be a direct buffer");
+        return false;
+    }
+    jint position = env->GetIntField(buffer, Buffer_position);
+    jint limit = env->GetIntField(buffer, Buffer_limit);
+    size_t remainingBytes = (size_t)(limit - position) * bufferElementSize;
+    if (remainingBytes < count * sizeof(T))
+    {
+        ThrowByName(env, "java/lang/IllegalArgumentException",
+            "The buffer does not have enough remaining elements");
+        return false;
+    }
+    nativeArray = (T*)(address + (size_t)position * bufferElementSize);
+    return true;
+}
+
+/**
+* Initialize the given native size_t array from the given direct
+* LongBuffer. If size_t has the same size as jlong, then the array
+* will point to the contents of the buffer. Otherwise, the values
+* will be converted into a newly allocated array, which is deleted
+* in releaseNative_direct_size_t.
+*/
+bool initNative_direct_size_t(JNIEnv *env, jobject buffer, size_t* &nativeArray, size_t count);
+
+/**
+* Release the given native size_t array that was initialized with
+* initNative_direct_size_t
+*/
+bool releaseNative_direct_size_t(JNIEnv *env, size_t* &nativeArray, jobject buffer);
+
+
+
+// =================================================================================================
+// Java arguments that consist of more than one JNI parameter
+// =================================================================================================
+
+/**
+* A command queue, together with the wait list whose events have to be
+* complete before the routine is executed
+*/
+struct JavaQueue
+{
+    JavaQueue(jobject queue, jobjectArray waitList) : queue(queue), waitList(waitList) {}
+    jobject queue;
+    jobjectArray waitList;
+};
+
+/**
+* A complex scalar that is given as separate real and imaginary parts
+*/
+template <typename T>
+struct JavaComplex
+{
+    JavaComplex(T real, T imag) : real(real), imag(imag) {}
+    T real;
+    T imag;
+};
+
+/**
+* A direct buffer that has to provide the given number of elements
+*/
+struct JavaDirectBuffer
+{
+    JavaDirectBuffer(jobject buffer, jlong count) : buffer(buffer), count(count) {}
+    jobject buffer;
+    jlong count;
+};
+
+
+
+
+
+// =================================================================================================
+// The conversions of the arguments
+// =================================================================================================
+
+/**
+* The kinds of arguments, each describing the conversion of a Java
+* argument into the native parameter of a CLBlast function
+*/
+enum ArgumentKind
+{
+    ARGUMENT_SIZE,              // long -> size_t
+    ARGUMENT_ENUM,              // int -> CLBlast enum
+    ARGUMENT_FLOAT,             // float -> float
+    ARGUMENT_DOUBLE,            // double -> double
+    ARGUMENT_HALF,              // float -> cl_half
+    ARGUMENT_COMPLEX_FLOAT,     // float, float -> cl_float2
+    ARGUMENT_COMPLEX_DOUBLE,    // double, double -> cl_double2
+    ARGUMENT_MEM,               // cl_mem -> cl_mem
+    ARGUMENT_DEVICE,            // cl_device_id -> cl_device_id
+    ARGUMENT_QUEUE,             // cl_command_queue -> cl_command_queue*
+    ARGUMENT_QUEUE_WAIT_LIST,   // cl_command_queue, cl_event[] -> cl_command_queue*
+    ARGUMENT_EVENT,             // cl_event -> cl_event*, written back
+    ARGUMENT_FLOAT2_VALUE,      // float[] -> cl_float2
+    ARGUMENT_DOUBLE2_VALUE,     // double[] -> cl_double2
+    ARGUMENT_FLOAT_ARRAY,       // float[] -> float*
+    ARGUMENT_DOUBLE_ARRAY,      // double[] -> double*
+    ARGUMENT_FLOAT2_ARRAY,      // float[] -> cl_float2*
+    ARGUMENT_DOUBLE2_ARRAY,     // double[] -> cl_double2*
+    ARGUMENT_HALF_ARRAY,        // float[] -> cl_half*
+    ARGUMENT_SIZE_ARRAY,        // long[] -> size_t*
+    ARGUMENT_DIRECT_FLOAT,      // FloatBuffer -> float*
+    ARGUMENT_DIRECT_DOUBLE,     // DoubleBuffer -> double*
+    ARGUMENT_DIRECT_FLOAT2,     // FloatBuffer -> cl_float2*
+    ARGUMENT_DIRECT_DOUBLE2,    // DoubleBuffer -> cl_double2*
+    ARGUMENT_DIRECT_HALF,       // ShortBuffer -> cl_half*
+    ARGUMENT_DIRECT_SIZE        // LongBuffer -> size_t*
+};
+
+/**
+* The value of a Java argument. The 'extra' value is the second part
+* of arguments that consist of two JNI parameters: The wait list of
+* a queue, the imaginary part of a complex scalar, or the required
+* number of elements of a direct buffer.
+*/
+union JavaValue
+{
+    jlong l;
+    jint i;
+    jfloat f;
+    jdouble d;
+    jobject object;
+};
+
+struct JavaArgument
+{
+    JavaValue value;
+    JavaValue extra;
+};
+
+inline JavaArgument javaArgument(jlong value) { JavaArgument a; a.value.l = value; return a; }
+inline JavaArgument javaArgument(jint value) { JavaArgument a; a.value.i = value; return a; }
+inline JavaArgument javaArgument(jfloat value) { JavaArgument a; a.value.f = value; return a; }
+inline JavaArgument javaArgument(jdouble value) { JavaArgument a; a.value.d = value; return a; }
+inline JavaArgument javaArgument(jobject value) { JavaArgument a; a.value.object = value; return a; }
+
+inline JavaArgument javaArgument(const JavaQueue &value)
+{
+    JavaArgument a;
+    a.value.object = value.queue;
+    a.extra.object = value.waitList;
+    return a;
+}
+
+inline JavaArgument javaArgument(const JavaComplex<jfloat> &value)
+{
+    JavaArgument a;
+    a.value.f = value.real;
+    a.extra.f = value.imag;
+    return a;
+}
+
+inline JavaArgument javaArgument(const JavaComplex<jdouble> &value)
+{
+    JavaArgument a;
+    a.value.d = value.real;
+    a.extra.d = value.imag;
+    return a;
+}
+
+inline JavaArgument javaArgument(const JavaDirectBuffer &value)
+{
+    JavaArgument a;
+    a.value.object = value.buffer;
+    a.extra.l = value.count;
+    return a;
+}
+
+/**
+* The native value of an argument
+*/
+union NativeValue
+{
+    size_t size;
+    int enumeration;
+    float f;
+    double d;
+    cl_half half;
+    cl_float2 float2;
+    cl_double2 double2;
+    cl_mem mem;
+    cl_device_id device;
+    cl_command_queue *queue;
+    cl_event *event;
+    float *floats;
+    double *doubles;
+    cl_float2 *float2s;
+    cl_double2 *double2s;
+    cl_half *halfs;
+    size_t *sizes;
+};
+
+/**
+* Returns the native value as a parameter of type T for the CLBlast
+* function
+*/
+template <typename T>
+inline T nativeParameter(const NativeValue &value)
+{
+    static_assert(sizeof(T) <= sizeof(NativeValue), "Invalid native parameter type");
+    T result;
+    memcpy(&result, &value, sizeof(T));
+    return result;
+}
+
+/**
+* The kind of the argument for the native parameter type N and the Java
+* argument type J. There is no general definition, so a routine with a
+* combination of types that is not covered here does not compile.
+*/
+template <typename N, typename J>
+struct ArgumentKindOf;
+
+#define JOCL_BLAST_ARGUMENT_KIND(N, J, KIND) \
+    template <> struct ArgumentKindOf<N, J> { static const ArgumentKind value = KIND; };
+
+JOCL_BLAST_ARGUMENT_KIND(size_t, jlong, ARGUMENT_SIZE)
+JOCL_BLAST_ARGUMENT_KIND(CLBlastLayout, jint, ARGUMENT_ENUM)
+JOCL_BLAST_ARGUMENT_KIND(CLBlastTranspose, jint, ARGUMENT_ENUM)
+JOCL_BLAST_ARGUMENT_KIND(CLBlastTriangle, jint, ARGUMENT_ENUM)
+JOCL_BLAST_ARGUMENT_KIND(CLBlastSide, jint, ARGUMENT_ENUM)
+JOCL_BLAST_ARGUMENT_KIND(CLBlastDiagonal, jint, ARGUMENT_ENUM)
+JOCL_BLAST_ARGUMENT_KIND(CLBlastKernelMode, jint, ARGUMENT_ENUM)
+JOCL_BLAST_ARGUMENT_KIND(float, jfloat, ARGUMENT_FLOAT)
+JOCL_BLAST_ARGUMENT_KIND(double, jdouble, ARGUMENT_DOUBLE)
+JOCL_BLAST_ARGUMENT_KIND(cl_half, jfloat, ARGUMENT_HALF)
+JOCL_BLAST_ARGUMENT_KIND(cl_float2, JavaComplex<jfloat>, ARGUMENT_COMPLEX_FLOAT)
+JOCL_BLAST_ARGUMENT_KIND(cl_double2, JavaComplex<jdouble>, ARGUMENT_COMPLEX_DOUBLE)
+JOCL_BLAST_ARGUMENT_KIND(cl_mem, jobject, ARGUMENT_MEM)
+JOCL_BLAST_ARGUMENT_KIND(cl_device_id, jobject, ARGUMENT_DEVICE)
+JOCL_BLAST_ARGUMENT_KIND(cl_command_queue*, jobject, ARGUMENT_QUEUE)
+JOCL_BLAST_ARGUMENT_KIND(cl_command_queue*, JavaQueue, ARGUMENT_QUEUE_WAIT_LIST)
+JOCL_BLAST_ARGUMENT_KIND(cl_event*, jobject, ARGUMENT_EVENT)
+JOCL_BLAST_ARGUMENT_KIND(cl_float2, jfloatArray, ARGUMENT_FLOAT2_VALUE)
+JOCL_BLAST_ARGUMENT_KIND(cl_double2, jdoubleArray, ARGUMENT_DOUBLE2_VALUE)
+JOCL_BLAST_ARGUMENT_KIND(float*, jfloatArray, ARGUMENT_FLOAT_ARRAY)
+JOCL_BLAST_ARGUMENT_KIND(double*, jdoubleArray, ARGUMENT_DOUBLE_ARRAY)
+JOCL_BLAST_ARGUMENT_KIND(cl_float2*, jfloatArray, ARGUMENT_FLOAT2_ARRAY)
+JOCL_BLAST_ARGUMENT_KIND(cl_double2*, jdoubleArray, ARGUMENT_DOUBLE2_ARRAY)
+JOCL_BLAST_ARGUMENT_KIND(cl_half*, jfloatArray, ARGUMENT_HALF_ARRAY)
+JOCL_BLAST_ARGUMENT_KIND(size_t*, jlongArray, ARGUMENT_SIZE_ARRAY)
+JOCL_BLAST_ARGUMENT_KIND(float*, JavaDirectBuffer, ARGUMENT_DIRECT_FLOAT)
+JOCL_BLAST_ARGUMENT_KIND(double*, JavaDirectBuffer, ARGUMENT_DIRECT_DOUBLE)
+JOCL_BLAST_ARGUMENT_KIND(cl_float2*, JavaDirectBuffer, ARGUMENT_DIRECT_FLOAT2)
+JOCL_BLAST_ARGUMENT_KIND(cl_double2*, JavaDirectBuffer, ARGUMENT_DIRECT_DOUBLE2)
+JOCL_BLAST_ARGUMENT_KIND(cl_half*, JavaDirectBuffer, ARGUMENT_DIRECT_HALF)
+JOCL_BLAST_ARGUMENT_KIND(size_t*, JavaDirectBuffer, ARGUMENT_DIRECT_SIZE)
+
+#undef JOCL_BLAST_ARGUMENT_KIND
+
+/**
+* The type in which the value of a native parameter is stored. This
+* removes the 'const' from pointers to constant values.
+*/
+template <typename T> struct NativeStorage { typedef T type; };
+template <typename T> struct NativeStorage<const T*> { typedef T* type; };
+
+/**
+* Perform the null checks for the given Java arguments of the given
+* routine, and print the trace log message. If an argument is nullptr
+* where this is not allowed, then a NullPointerException is thrown and
+* false is returned.
+*/
+bool checkArguments(JNIEnv *env, const Routine &routine,
+    const ArgumentKind *kinds, int count, const JavaArgument *javaArguments);
+
+/**
+* Obtain the native values for the given Java arguments. Returns
+* CL_SUCCESS, or the error code that has to be returned to Java.
+*/
+jint initArguments(JNIEnv *env,
+    const ArgumentKind *kinds, int count, const JavaArgument *javaArguments, NativeValue *nativeValues);
+
+/**
+* Enqueue the barriers for the wait lists among the given arguments,
+* after initArguments converted all of them. Returns CL_SUCCESS, or
+* the error code that has to be returned to Java.
+*/
+jint enqueueWaitLists(JNIEnv *env,
+    const ArgumentKind *kinds, int count, const JavaArgument *javaArguments, NativeValue *nativeValues);
+
+/**
+* Write back the native values into the given Java arguments where
+* necessary, and release the native values. Returns whether this
+* succeeded.
+*/
+bool releaseArguments(JNIEnv *env,
+    const ArgumentKind *kinds, int count, const JavaArgument *javaArguments, NativeValue *nativeValues);
+
+/**
+* Returns the number of Java parameters of an argument of the given kind
+*/
+int parameterCount(ArgumentKind kind);
+
+/**
+* Returns the parameter name with the given index from the given
+* comma-separated parameter names
+*/
+std::string parameterName(const char *names, int index);
+
+
+
+// =================================================================================================
+// Device-side profiling
+// =================================================================================================
+
+// Whether the device-side profiling is enabled
+extern std::atomic<bool> profilingEnabled;
+
+/**
+* The device-side profiling of a single routine call. It is created
+* after the arguments have been converted, and only does something when
+* the profiling is enabled and the queue was created with profiling
+* enabled. In this case, it enqueues a marker before the call, and
+* makes sure that the call produces an event, even when no event was
+* given from Java. When the call succeeded, a callback is attached to
+* this event, which records the device time, together with the FLOP
+* and byte counts that are computed from the dimensions of the call.
+*/
+class ProfilingScope
+{
+public:
+    ProfilingScope(const Routine &routine,
+        const ArgumentKind *kinds, int count, NativeValue *nativeValues) :
+        active(false),
+        routine(routine),
+        kinds(kinds),
+        count(count),
+        nativeValues(nativeValues),
+        eventIndex(-1),
+        queue(nullptr),
+        marker(nullptr),
+        internalEvent(nullptr)
+    {
+        if (profilingEnabled.load(std::memory_order_relaxed))
+        {
+            begin();
+        }
+    }
+
+    void endCall(CLBlastStatusCode result)
+    {
+        if (active)
+        {
+            end(result);
+        }
+    }
+
+private:
+    ProfilingScope(const ProfilingScope&);
+    ProfilingScope& operator=(const ProfilingScope&);
+
+    void begin();
+    void end(CLBlastStatusCode result);
+
+    bool active;
+    const Routine &routine;
+    const ArgumentKind *kinds;
+    int count;
+    NativeValue *nativeValues;
+    int eventIndex;
+    cl_command_queue queue;
+    cl_event marker;
+    cl_event internalEvent;
+};
+
+
+
+// =================================================================================================
+// Call trace
+// =================================================================================================
+
+// Whether the routine calls are recorded in the call trace
+extern std::atomic<bool> callTraceEnabled;
+
+/**
+* The call trace record of a single routine call. When the call trace
+* is enabled, it measures the host time of the call, and appends a
+* binary record with the routine, the status, the timestamps and all
+* arguments of the call to the call trace ring buffer. The arguments
+* contain the scalar and shape values, the contents of host arrays, the
+* identity and size of memory objects, and the identity of the queue.
+*/
+class CallTraceScope
+{
+public:
+    CallTraceScope(JNIEnv *env, const Routine &routine, const ArgumentKind *kinds, int count,
+        const JavaArgument *javaArguments, const NativeValue *nativeValues) :
+        active(callTraceEnabled.load(std::memory_order_relaxed)),
+        env(env),
+        routine(routine),
+        kinds(kinds),
+        count(count),
+        javaArguments(javaArguments),
+        nativeValues(nativeValues)
+    {
+    }
+
+    void beginCall()
+    {
+        if (active)
+        {
+            start = std::chrono::steady_clock::now();
+        }
+    }
+
+    void endCall(CLBlastStatusCode result)
+    {
+        if (active)
+        {
+            record(result);
+        }
+    }
+
+private:
+    CallTraceScope(const CallTraceScope&);
+    CallTraceScope& operator=(const CallTraceScope&);
+
+    void record(CLBlastStatusCode result);
+
+    bool active;
+    JNIEnv *env;
+    const Routine &routine;
+    const ArgumentKind *kinds;
+    int count;
+    const JavaArgument *javaArguments;
+    const NativeValue *nativeValues;
+    std::chrono::steady_clock::time_point start;
+};
+
+
+
+// =================================================================================================
+// Kernel cache accounting
+// =================================================================================================
+
+/**
+* Record that the kernels of the given routine have been used on the
+* device of the queue that is contained in the given native values.
+* When the number of recorded entries exceeds the limit, the least
+* recently used entries are evicted.
+*/
+void recordKernelCacheUse(const Routine &routine,
+    const ArgumentKind *kinds, int count, const NativeValue *nativeValues);
+
+
+
+// =================================================================================================
+// The call of a routine
+// =================================================================================================
+
+template <size_t... I>
+struct IndexSequence {};
+
+template <size_t N, size_t... I>
+struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, I...> {};
+
+template <size_t... I>
+struct MakeIndexSequence<0, I...>
+{
+    typedef IndexSequence<I...> type;
+};
+
+/**
+* Implementation of callRoutine, with the indices of the arguments
+*/
+template <typename... NativeTypes, typename... JavaTypes, size_t... I>
+inline jint invokeRoutine(JNIEnv *env, const Routine &routine,
+    CLBlastStatusCode (*function)(NativeTypes...), IndexSequence<I...>,
+    const JavaTypes&... values)
+{
+    static const ArgumentKind kinds[] = {
+        ArgumentKindOf<typename NativeStorage<NativeTypes>::type, JavaTypes>::value... };
+    const int count = (int)sizeof...(I);
+    JavaArgument javaArguments[] = { javaArgument(values)... };
+    NativeValue nativeValues[sizeof...(I)];
+
+    // Null-checks and log message
+    if (!checkArguments(env, routine, kinds, count, javaArguments)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+
+    // Statistics for this call, if they are enabled
+    StatisticsScope statisticsScope(routine.statistics);
+
+    // Obtain native variable values
+    jint status = initArguments(env, kinds, count, javaArguments, nativeValues);
+    if (status != CL_SUCCESS) return status;
+
+    // Wait lists, only after all other arguments have been converted
+    status = enqueueWaitLists(env, kinds, count, javaArguments, nativeValues);
+    if (status != CL_SUCCESS)
+    {
+        releaseArguments(env, kinds, count, javaArguments, nativeValues);
+        return status;
+    }
+
+    // Device-side profiling for this call, if it is enabled
+    ProfilingScope profilingScope(routine, kinds, count, nativeValues);
+
+    // Call trace record for this call, if it is enabled
+    CallTraceScope traceScope(env, routine, kinds, count, javaArguments, nativeValues);
+
+    // Native function call
+    traceScope.beginCall();
+    statisticsScope.beginCall();
+    CLBlastStatusCode result = function(nativeParameter<NativeTypes>(nativeValues[I])...);
+    statisticsScope.endCall(result);
+    profilingScope.endCall(result);
+    traceScope.endCall(result);
+
+    // Kernel cache accounting for this call, if it is enabled
+    if (result == CLBlastSuccess && kernelCacheTrackingEnabled.load(std::memory_order_relaxed))
+    {
+        recordKernelCacheUse(routine, kinds, count, nativeValues);
+    }
+
+    // Write back native variable values
+    if (!releaseArguments(env, kinds, count, javaArguments, nativeValues)) return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+
+    // Return the result
+    return (jint)result;
+}
+
+/**
+* Call the given CLBlast function with the native values of the given
+* Java arguments. This performs the null checks, prints the log message,
+* records the statistics, and writes back the native values after the
+* call. It attaches the device-side profiling callback if profiling
+* is enabled, and records the call in the call trace if the trace is
+* enabled. The Java arguments are given in the order of the parameters
+* of the CLBlast function. The queue and its wait list are given as a
+* JavaQueue, split complex scalars as a JavaComplex, and direct buffers
+* as a JavaDirectBuffer.
+*/
+template <typename... NativeTypes, typename... JavaTypes>
+inline jint callRoutine(JNIEnv *env, const Routine &routine,
+    CLBlastStatusCode (*function)(NativeTypes...), const JavaTypes&... values)
+{
+    static_assert(sizeof...(NativeTypes) == sizeof...(JavaTypes),
+        "The number of arguments must match the number of parameters");
+    static_assert(sizeof...(JavaTypes) > 0, "Routines without parameters are not supported");
+    return invokeRoutine(env, routine, function,
+        typename MakeIndexSequence<sizeof...(JavaTypes)>::type(), values...);
+}
+
+#endif
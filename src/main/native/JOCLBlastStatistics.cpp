@@ -0,0 +1,447 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlast.hpp"
+#include "JOCLBlastStatistics.hpp"
+
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+
+// The names of the routines, in the order of the StatisticsRoutine IDs
+static const char *statisticsRoutineNames[STATISTICS_COUNT] =
+{
+    "CLBlastSrotg",
+    "CLBlastDrotg",
+    "CLBlastSrotmg",
+    "CLBlastDrotmg",
+    "CLBlastSrot",
+    "CLBlastDrot",
+    "CLBlastSrotm",
+    "CLBlastDrotm",
+    "CLBlastSswap",
+    "CLBlastDswap",
+    "CLBlastCswap",
+    "CLBlastZswap",
+    "CLBlastHswap",
+    "CLBlastSscal",
+    "CLBlastDscal",
+    "CLBlastCscal",
+    "CLBlastZscal",
+    "CLBlastHscal",
+    "CLBlastScopy",
+    "CLBlastDcopy",
+    "CLBlastCcopy",
+    "CLBlastZcopy",
+    "CLBlastHcopy",
+    "CLBlastSaxpy",
+    "CLBlastDaxpy",
+    "CLBlastCaxpy",
+    "CLBlastZaxpy",
+    "CLBlastHaxpy",
+    "CLBlastSdot",
+    "CLBlastDdot",
+    "CLBlastHdot",
+    "CLBlastCdotu",
+    "CLBlastZdotu",
+    "CLBlastCdotc",
+    "CLBlastZdotc",
+    "CLBlastSnrm2",
+    "CLBlastDnrm2",
+    "CLBlastScnrm2",
+    "CLBlastDznrm2",
+    "CLBlastHnrm2",
+    "CLBlastSasum",
+    "CLBlastDasum",
+    "CLBlastScasum",
+    "CLBlastDzasum",
+    "CLBlastHasum",
+    "CLBlastSsum",
+    "CLBlastDsum",
+    "CLBlastScsum",
+    "CLBlastDzsum",
+    "CLBlastHsum",
+    "CLBlastiSamax",
+    "CLBlastiDamax",
+    "CLBlastiCamax",
+    "CLBlastiZamax",
+    "CLBlastiHamax",
+    "CLBlastiSamin",
+    "CLBlastiDamin",
+    "CLBlastiCamin",
+    "CLBlastiZamin",
+    "CLBlastiHamin",
+    "CLBlastiSmax",
+    "CLBlastiDmax",
+    "CLBlastiCmax",
+    "CLBlastiZmax",
+    "CLBlastiHmax",
+    "CLBlastiSmin",
+    "CLBlastiDmin",
+    "CLBlastiCmin",
+    "CLBlastiZmin",
+    "CLBlastiHmin",
+    "CLBlastSgemv",
+    "CLBlastDgemv",
+    "CLBlastCgemv",
+    "CLBlastZgemv",
+    "CLBlastHgemv",
+    "CLBlastSgbmv",
+    "CLBlastDgbmv",
+    "CLBlastCgbmv",
+    "CLBlastZgbmv",
+    "CLBlastHgbmv",
+    "CLBlastChemv",
+    "CLBlastZhemv",
+    "CLBlastChbmv",
+    "CLBlastZhbmv",
+    "CLBlastChpmv",
+    "CLBlastZhpmv",
+    "CLBlastSsymv",
+    "CLBlastDsymv",
+    "CLBlastHsymv",
+    "CLBlastSsbmv",
+    "CLBlastDsbmv",
+    "CLBlastHsbmv",
+    "CLBlastSspmv",
+    "CLBlastDspmv",
+    "CLBlastHspmv",
+    "CLBlastStrmv",
+    "CLBlastDtrmv",
+    "CLBlastCtrmv",
+    "CLBlastZtrmv",
+    "CLBlastHtrmv",
+    "CLBlastStbmv",
+    "CLBlastDtbmv",
+    "CLBlastCtbmv",
+    "CLBlastZtbmv",
+    "CLBlastHtbmv",
+    "CLBlastStpmv",
+    "CLBlastDtpmv",
+    "CLBlastCtpmv",
+    "CLBlastZtpmv",
+    "CLBlastHtpmv",
+    "CLBlastStrsv",
+    "CLBlastDtrsv",
+    "CLBlastCtrsv",
+    "CLBlastZtrsv",
+    "CLBlastStbsv",
+    "CLBlastDtbsv",
+    "CLBlastCtbsv",
+    "CLBlastZtbsv",
+    "CLBlastStpsv",
+    "CLBlastDtpsv",
+    "CLBlastCtpsv",
+    "CLBlastZtpsv",
+    "CLBlastSger",
+    "CLBlastDger",
+    "CLBlastHger",
+    "CLBlastCgeru",
+    "CLBlastZgeru",
+    "CLBlastCgerc",
+    "CLBlastZgerc",
+    "CLBlastCher",
+    "CLBlastZher",
+    "CLBlastChpr",
+    "CLBlastZhpr",
+    "CLBlastCher2",
+    "CLBlastZher2",
+    "CLBlastChpr2",
+    "CLBlastZhpr2",
+    "CLBlastSsyr",
+    "CLBlastDsyr",
+    "CLBlastHsyr",
+    "CLBlastSspr",
+    "CLBlastDspr",
+    "CLBlastHspr",
+    "CLBlastSsyr2",
+    "CLBlastDsyr2",
+    "CLBlastHsyr2",
+    "CLBlastSspr2",
+    "CLBlastDspr2",
+    "CLBlastHspr2",
+    "CLBlastSgemm",
+    "CLBlastDgemm",
+    "CLBlastCgemm",
+    "CLBlastZgemm",
+    "CLBlastHgemm",
+    "CLBlastSsymm",
+    "CLBlastDsymm",
+    "CLBlastCsymm",
+    "CLBlastZsymm",
+    "CLBlastHsymm",
+    "CLBlastChemm",
+    "CLBlastZhemm",
+    "CLBlastSsyrk",
+    "CLBlastDsyrk",
+    "CLBlastCsyrk",
+    "CLBlastZsyrk",
+    "CLBlastHsyrk",
+    "CLBlastCherk",
+    "CLBlastZherk",
+    "CLBlastSsyr2k",
+    "CLBlastDsyr2k",
+    "CLBlastCsyr2k",
+    "CLBlastZsyr2k",
+    "CLBlastHsyr2k",
+    "CLBlastCher2k",
+    "CLBlastZher2k",
+    "CLBlastStrmm",
+    "CLBlastDtrmm",
+    "CLBlastCtrmm",
+    "CLBlastZtrmm",
+    "CLBlastHtrmm",
+    "CLBlastStrsm",
+    "CLBlastDtrsm",
+    "CLBlastCtrsm",
+    "CLBlastZtrsm",
+    "CLBlastShad",
+    "CLBlastDhad",
+    "CLBlastChad",
+    "CLBlastZhad",
+    "CLBlastHhad",
+    "CLBlastSomatcopy",
+    "CLBlastDomatcopy",
+    "CLBlastComatcopy",
+    "CLBlastZomatcopy",
+    "CLBlastHomatcopy",
+    "CLBlastSim2col",
+    "CLBlastDim2col",
+    "CLBlastCim2col",
+    "CLBlastZim2col",
+    "CLBlastHim2col",
+    "CLBlastScol2im",
+    "CLBlastDcol2im",
+    "CLBlastCcol2im",
+    "CLBlastZcol2im",
+    "CLBlastHcol2im",
+    "CLBlastSconvgemm",
+    "CLBlastDconvgemm",
+    "CLBlastHconvgemm",
+    "CLBlastSaxpyBatched",
+    "CLBlastDaxpyBatched",
+    "CLBlastCaxpyBatched",
+    "CLBlastZaxpyBatched",
+    "CLBlastHaxpyBatched",
+    "CLBlastSaxpyBatchedDirect",
+    "CLBlastDaxpyBatchedDirect",
+    "CLBlastCaxpyBatchedDirect",
+    "CLBlastZaxpyBatchedDirect",
+    "CLBlastHaxpyBatchedDirect",
+    "CLBlastSgemmBatched",
+    "CLBlastDgemmBatched",
+    "CLBlastCgemmBatched",
+    "CLBlastZgemmBatched",
+    "CLBlastHgemmBatched",
+    "CLBlastSgemmBatchedDirect",
+    "CLBlastDgemmBatchedDirect",
+    "CLBlastCgemmBatchedDirect",
+    "CLBlastZgemmBatchedDirect",
+    "CLBlastHgemmBatchedDirect",
+    "CLBlastSgemmStridedBatched",
+    "CLBlastDgemmStridedBatched",
+    "CLBlastCgemmStridedBatched",
+    "CLBlastZgemmStridedBatched",
+    "CLBlastHgemmStridedBatched",
+    "CLBlastSgemmWithTempBuffer",
+    "CLBlastDgemmWithTempBuffer",
+    "CLBlastCgemmWithTempBuffer",
+    "CLBlastZgemmWithTempBuffer",
+    "CLBlastHgemmWithTempBuffer",
+    "CLBlastSgemmPooled",
+    "CLBlastDgemmPooled",
+    "CLBlastCgemmPooled",
+    "CLBlastZgemmPooled",
+    "CLBlastSgemvBatched",
+    "CLBlastDgemvBatched",
+    "CLBlastCgemvBatched",
+    "CLBlastZgemvBatched",
+    "CLBlastSgemvStridedBatched",
+    "CLBlastDgemvStridedBatched",
+    "CLBlastCgemvStridedBatched",
+    "CLBlastZgemvStridedBatched",
+    "CLBlastStrsvBatched",
+    "CLBlastDtrsvBatched",
+    "CLBlastCtrsvBatched",
+    "CLBlastZtrsvBatched",
+    "CLBlastStrsvStridedBatched",
+    "CLBlastDtrsvStridedBatched",
+    "CLBlastCtrsvStridedBatched",
+    "CLBlastZtrsvStridedBatched",
+    "CLBlastSgerBatched",
+    "CLBlastDgerBatched",
+    "CLBlastSgerStridedBatched",
+    "CLBlastDgerStridedBatched",
+    "CLBlastCgeruBatched",
+    "CLBlastZgeruBatched",
+    "CLBlastCgeruStridedBatched",
+    "CLBlastZgeruStridedBatched",
+    "CLBlastCgercBatched",
+    "CLBlastZgercBatched",
+    "CLBlastCgercStridedBatched",
+    "CLBlastZgercStridedBatched",
+    "CLBlastSGemmTempBufferSize",
+    "CLBlastDGemmTempBufferSize",
+    "CLBlastCGemmTempBufferSize",
+    "CLBlastZGemmTempBufferSize",
+    "CLBlastHGemmTempBufferSize",
+    "CLBlastClearCache",
+    "CLBlastFillCache",
+    "CLBlastOverrideParameters",
+};
+
+/**
+* The statistics of a single routine
+*/
+struct RoutineStatistics
+{
+    std::atomic<int64_t> calls;
+    std::atomic<int64_t> failures;
+    std::atomic<int64_t> unwrapNanos;
+    std::atomic<int64_t> callNanos;
+};
+
+// The statistics for each routine
+static RoutineStatistics routineStatistics[STATISTICS_COUNT];
+
+// The number of occurrences of each status code other than CLBlastSuccess.
+// This is only accessed when a call failed, so a mutex is sufficient.
+static std::map<int, int64_t> statusCounts;
+static std::mutex statusCountsMutex;
+
+std::atomic<bool> statisticsEnabled(false);
+
+void recordStatistics(StatisticsRoutine routine,
+    int64_t unwrapNanos, int64_t callNanos, CLBlastStatusCode status)
+{
+    RoutineStatistics &statistics = routineStatistics[routine];
+    statistics.calls.fetch_add(1, std::memory_order_relaxed);
+    statistics.unwrapNanos.fetch_add(unwrapNanos, std::memory_order_relaxed);
+    statistics.callNanos.fetch_add(callNanos, std::memory_order_relaxed);
+    if (status != CLBlastSuccess)
+    {
+        statistics.failures.fetch_add(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(statusCountsMutex);
+        statusCounts[(int)status]++;
+    }
+}
+
+/**
+* Returns the value of the given counter. If 'reset' is true, then the
+* counter is reset to 0.
+*/
+static int64_t obtainCounter(std::atomic<int64_t> &counter, bool reset)
+{
+    if (reset)
+    {
+        return counter.exchange(0, std::memory_order_relaxed);
+    }
+    return counter.load(std::memory_order_relaxed);
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    setStatisticsEnabledNative
+* Signature: (Z)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setStatisticsEnabledNative
+(JNIEnv *env, jclass UNUSED(cls), jboolean enabled)
+{
+    Logger::log(LOG_TRACE, "Executing setStatisticsEnabled(enabled=%d)\n", (int)enabled);
+    statisticsEnabled.store(enabled == JNI_TRUE);
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    getStatisticsRoutineNamesNative
+* Signature: ()[Ljava/lang/String;
+*/
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_getStatisticsRoutineNamesNative
+(JNIEnv *env, jclass UNUSED(cls))
+{
+    jclass String_Class = env->FindClass("java/lang/String");
+    if (String_Class == nullptr) return nullptr;
+    jobjectArray names = env->NewObjectArray(STATISTICS_COUNT, String_Class, nullptr);
+    if (names == nullptr) return nullptr;
+    for (int i = 0; i < STATISTICS_COUNT; i++)
+    {
+        jstring name = env->NewStringUTF(statisticsRoutineNames[i]);
+        if (name == nullptr) return nullptr;
+        env->SetObjectArrayElement(names, i, name);
+        env->DeleteLocalRef(name);
+    }
+    return names;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    getStatisticsNative
+* Signature: (Z)[J
+*/
+JNIEXPORT jlongArray JNICALL Java_org_jocl_blast_CLBlast_getStatisticsNative
+(JNIEnv *env, jclass UNUSED(cls), jboolean reset)
+{
+    Logger::log(LOG_TRACE, "Executing getStatistics(reset=%d)\n", (int)reset);
+
+    // The result contains the calls, failures, unwrap time and call time
+    // for each routine, followed by (status, count) pairs
+    bool doReset = (reset == JNI_TRUE);
+    std::vector<jlong> values;
+    values.reserve(STATISTICS_COUNT * 4);
+    for (int i = 0; i < STATISTICS_COUNT; i++)
+    {
+        RoutineStatistics &statistics = routineStatistics[i];
+        values.push_back((jlong)obtainCounter(statistics.calls, doReset));
+        values.push_back((jlong)obtainCounter(statistics.failures, doReset));
+        values.push_back((jlong)obtainCounter(statistics.unwrapNanos, doReset));
+        values.push_back((jlong)obtainCounter(statistics.callNanos, doReset));
+    }
+    {
+        std::lock_guard<std::mutex> lock(statusCountsMutex);
+        for (std::map<int, int64_t>::const_iterator it = statusCounts.begin();
+            it != statusCounts.end(); ++it)
+        {
+            values.push_back((jlong)it->first);
+            values.push_back((jlong)it->second);
+        }
+        if (doReset)
+        {
+            statusCounts.clear();
+        }
+    }
+
+    jlongArray result = env->NewLongArray((jsize)values.size());
+    if (result == nullptr) return nullptr;
+    env->SetLongArrayRegion(result, 0, (jsize)values.size(), values.data());
+    return result;
+}
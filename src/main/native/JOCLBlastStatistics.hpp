@@ -0,0 +1,414 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef JOCL_BLAST_STATISTICS_HPP
+#define JOCL_BLAST_STATISTICS_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+#include <clblast_c.h>
+
+/**
+* The IDs of the routines for which statistics are collected. The order
+* must match the order of the names in JOCLBlastStatistics.cpp
+*/
+enum StatisticsRoutine
+{
+    STATISTICS_CLBlastSrotg,
+    STATISTICS_CLBlastDrotg,
+    STATISTICS_CLBlastSrotmg,
+    STATISTICS_CLBlastDrotmg,
+    STATISTICS_CLBlastSrot,
+    STATISTICS_CLBlastDrot,
+    STATISTICS_CLBlastSrotm,
+    STATISTICS_CLBlastDrotm,
+    STATISTICS_CLBlastSswap,
+    STATISTICS_CLBlastDswap,
+    STATISTICS_CLBlastCswap,
+    STATISTICS_CLBlastZswap,
+    STATISTICS_CLBlastHswap,
+    STATISTICS_CLBlastSscal,
+    STATISTICS_CLBlastDscal,
+    STATISTICS_CLBlastCscal,
+    STATISTICS_CLBlastZscal,
+    STATISTICS_CLBlastHscal,
+    STATISTICS_CLBlastScopy,
+    STATISTICS_CLBlastDcopy,
+    STATISTICS_CLBlastCcopy,
+    STATISTICS_CLBlastZcopy,
+    STATISTICS_CLBlastHcopy,
+    STATISTICS_CLBlastSaxpy,
+    STATISTICS_CLBlastDaxpy,
+    STATISTICS_CLBlastCaxpy,
+    STATISTICS_CLBlastZaxpy,
+    STATISTICS_CLBlastHaxpy,
+    STATISTICS_CLBlastSdot,
+    STATISTICS_CLBlastDdot,
+    STATISTICS_CLBlastHdot,
+    STATISTICS_CLBlastCdotu,
+    STATISTICS_CLBlastZdotu,
+    STATISTICS_CLBlastCdotc,
+    STATISTICS_CLBlastZdotc,
+    STATISTICS_CLBlastSnrm2,
+    STATISTICS_CLBlastDnrm2,
+    STATISTICS_CLBlastScnrm2,
+    STATISTICS_CLBlastDznrm2,
+    STATISTICS_CLBlastHnrm2,
+    STATISTICS_CLBlastSasum,
+    STATISTICS_CLBlastDasum,
+    STATISTICS_CLBlastScasum,
+    STATISTICS_CLBlastDzasum,
+    STATISTICS_CLBlastHasum,
+    STATISTICS_CLBlastSsum,
+    STATISTICS_CLBlastDsum,
+    STATISTICS_CLBlastScsum,
+    STATISTICS_CLBlastDzsum,
+    STATISTICS_CLBlastHsum,
+    STATISTICS_CLBlastiSamax,
+    STATISTICS_CLBlastiDamax,
+    STATISTICS_CLBlastiCamax,
+    STATISTICS_CLBlastiZamax,
+    STATISTICS_CLBlastiHamax,
+    STATISTICS_CLBlastiSamin,
+    STATISTICS_CLBlastiDamin,
+    STATISTICS_CLBlastiCamin,
+    STATISTICS_CLBlastiZamin,
+    STATISTICS_CLBlastiHamin,
+    STATISTICS_CLBlastiSmax,
+    STATISTICS_CLBlastiDmax,
+    STATISTICS_CLBlastiCmax,
+    STATISTICS_CLBlastiZmax,
+    STATISTICS_CLBlastiHmax,
+    STATISTICS_CLBlastiSmin,
+    STATISTICS_CLBlastiDmin,
+    STATISTICS_CLBlastiCmin,
+    STATISTICS_CLBlastiZmin,
+    STATISTICS_CLBlastiHmin,
+    STATISTICS_CLBlastSgemv,
+    STATISTICS_CLBlastDgemv,
+    STATISTICS_CLBlastCgemv,
+    STATISTICS_CLBlastZgemv,
+    STATISTICS_CLBlastHgemv,
+    STATISTICS_CLBlastSgbmv,
+    STATISTICS_CLBlastDgbmv,
+    STATISTICS_CLBlastCgbmv,
+    STATISTICS_CLBlastZgbmv,
+    STATISTICS_CLBlastHgbmv,
+    STATISTICS_CLBlastChemv,
+    STATISTICS_CLBlastZhemv,
+    STATISTICS_CLBlastChbmv,
+    STATISTICS_CLBlastZhbmv,
+    STATISTICS_CLBlastChpmv,
+    STATISTICS_CLBlastZhpmv,
+    STATISTICS_CLBlastSsymv,
+    STATISTICS_CLBlastDsymv,
+    STATISTICS_CLBlastHsymv,
+    STATISTICS_CLBlastSsbmv,
+    STATISTICS_CLBlastDsbmv,
+    STATISTICS_CLBlastHsbmv,
+    STATISTICS_CLBlastSspmv,
+    STATISTICS_CLBlastDspmv,
+    STATISTICS_CLBlastHspmv,
+    STATISTICS_CLBlastStrmv,
+    STATISTICS_CLBlastDtrmv,
+    STATISTICS_CLBlastCtrmv,
+    STATISTICS_CLBlastZtrmv,
+    STATISTICS_CLBlastHtrmv,
+    STATISTICS_CLBlastStbmv,
+    STATISTICS_CLBlastDtbmv,
+    STATISTICS_CLBlastCtbmv,
+    STATISTICS_CLBlastZtbmv,
+    STATISTICS_CLBlastHtbmv,
+    STATISTICS_CLBlastStpmv,
+    STATISTICS_CLBlastDtpmv,
+    STATISTICS_CLBlastCtpmv,
+    STATISTICS_CLBlastZtpmv,
+    STATISTICS_CLBlastHtpmv,
+    STATISTICS_CLBlastStrsv,
+    STATISTICS_CLBlastDtrsv,
+    STATISTICS_CLBlastCtrsv,
+    STATISTICS_CLBlastZtrsv,
+    STATISTICS_CLBlastStbsv,
+    STATISTICS_CLBlastDtbsv,
+    STATISTICS_CLBlastCtbsv,
+    STATISTICS_CLBlastZtbsv,
+    STATISTICS_CLBlastStpsv,
+    STATISTICS_CLBlastDtpsv,
+    STATISTICS_CLBlastCtpsv,
+    STATISTICS_CLBlastZtpsv,
+    STATISTICS_CLBlastSger,
+    STATISTICS_CLBlastDger,
+    STATISTICS_CLBlastHger,
+    STATISTICS_CLBlastCgeru,
+    STATISTICS_CLBlastZgeru,
+    STATISTICS_CLBlastCgerc,
+    STATISTICS_CLBlastZgerc,
+    STATISTICS_CLBlastCher,
+    STATISTICS_CLBlastZher,
+    STATISTICS_CLBlastChpr,
+    STATISTICS_CLBlastZhpr,
+    STATISTICS_CLBlastCher2,
+    STATISTICS_CLBlastZher2,
+    STATISTICS_CLBlastChpr2,
+    STATISTICS_CLBlastZhpr2,
+    STATISTICS_CLBlastSsyr,
+    STATISTICS_CLBlastDsyr,
+    STATISTICS_CLBlastHsyr,
+    STATISTICS_CLBlastSspr,
+    STATISTICS_CLBlastDspr,
+    STATISTICS_CLBlastHspr,
+    STATISTICS_CLBlastSsyr2,
+    STATISTICS_CLBlastDsyr2,
+    STATISTICS_CLBlastHsyr2,
+    STATISTICS_CLBlastSspr2,
+    STATISTICS_CLBlastDspr2,
+    STATISTICS_CLBlastHspr2,
+    STATISTICS_CLBlastSgemm,
+    STATISTICS_CLBlastDgemm,
+    STATISTICS_CLBlastCgemm,
+    STATISTICS_CLBlastZgemm,
+    STATISTICS_CLBlastHgemm,
+    STATISTICS_CLBlastSsymm,
+    STATISTICS_CLBlastDsymm,
+    STATISTICS_CLBlastCsymm,
+    STATISTICS_CLBlastZsymm,
+    STATISTICS_CLBlastHsymm,
+    STATISTICS_CLBlastChemm,
+    STATISTICS_CLBlastZhemm,
+    STATISTICS_CLBlastSsyrk,
+    STATISTICS_CLBlastDsyrk,
+    STATISTICS_CLBlastCsyrk,
+    STATISTICS_CLBlastZsyrk,
+    STATISTICS_CLBlastHsyrk,
+    STATISTICS_CLBlastCherk,
+    STATISTICS_CLBlastZherk,
+    STATISTICS_CLBlastSsyr2k,
+    STATISTICS_CLBlastDsyr2k,
+    STATISTICS_CLBlastCsyr2k,
+    STATISTICS_CLBlastZsyr2k,
+    STATISTICS_CLBlastHsyr2k,
+    STATISTICS_CLBlastCher2k,
+    STATISTICS_CLBlastZher2k,
+    STATISTICS_CLBlastStrmm,
+    STATISTICS_CLBlastDtrmm,
+    STATISTICS_CLBlastCtrmm,
+    STATISTICS_CLBlastZtrmm,
+    STATISTICS_CLBlastHtrmm,
+    STATISTICS_CLBlastStrsm,
+    STATISTICS_CLBlastDtrsm,
+    STATISTICS_CLBlastCtrsm,
+    STATISTICS_CLBlastZtrsm,
+    STATISTICS_CLBlastShad,
+    STATISTICS_CLBlastDhad,
+    STATISTICS_CLBlastChad,
+    STATISTICS_CLBlastZhad,
+    STATISTICS_CLBlastHhad,
+    STATISTICS_CLBlastSomatcopy,
+    STATISTICS_CLBlastDomatcopy,
+    STATISTICS_CLBlastComatcopy,
+    STATISTICS_CLBlastZomatcopy,
+    STATISTICS_CLBlastHomatcopy,
+    STATISTICS_CLBlastSim2col,
+    STATISTICS_CLBlastDim2col,
+    STATISTICS_CLBlastCim2col,
+    STATISTICS_CLBlastZim2col,
+    STATISTICS_CLBlastHim2col,
+    STATISTICS_CLBlastScol2im,
+    STATISTICS_CLBlastDcol2im,
+    STATISTICS_CLBlastCcol2im,
+    STATISTICS_CLBlastZcol2im,
+    STATISTICS_CLBlastHcol2im,
+    STATISTICS_CLBlastSconvgemm,
+    STATISTICS_CLBlastDconvgemm,
+    STATISTICS_CLBlastHconvgemm,
+    STATISTICS_CLBlastSaxpyBatched,
+    STATISTICS_CLBlastDaxpyBatched,
+    STATISTICS_CLBlastCaxpyBatched,
+    STATISTICS_CLBlastZaxpyBatched,
+    STATISTICS_CLBlastHaxpyBatched,
+    STATISTICS_CLBlastSaxpyBatchedDirect,
+    STATISTICS_CLBlastDaxpyBatchedDirect,
+    STATISTICS_CLBlastCaxpyBatchedDirect,
+    STATISTICS_CLBlastZaxpyBatchedDirect,
+    STATISTICS_CLBlastHaxpyBatchedDirect,
+    STATISTICS_CLBlastSgemmBatched,
+    STATISTICS_CLBlastDgemmBatched,
+    STATISTICS_CLBlastCgemmBatched,
+    STATISTICS_CLBlastZgemmBatched,
+    STATISTICS_CLBlastHgemmBatched,
+    STATISTICS_CLBlastSgemmBatchedDirect,
+    STATISTICS_CLBlastDgemmBatchedDirect,
+    STATISTICS_CLBlastCgemmBatchedDirect,
+    STATISTICS_CLBlastZgemmBatchedDirect,
+    STATISTICS_CLBlastHgemmBatchedDirect,
+    STATISTICS_CLBlastSgemmStridedBatched,
+    STATISTICS_CLBlastDgemmStridedBatched,
+    STATISTICS_CLBlastCgemmStridedBatched,
+    STATISTICS_CLBlastZgemmStridedBatched,
+    STATISTICS_CLBlastHgemmStridedBatched,
+    STATISTICS_CLBlastSgemmWithTempBuffer,
+    STATISTICS_CLBlastDgemmWithTempBuffer,
+    STATISTICS_CLBlastCgemmWithTempBuffer,
+    STATISTICS_CLBlastZgemmWithTempBuffer,
+    STATISTICS_CLBlastHgemmWithTempBuffer,
+    STATISTICS_CLBlastSgemmPooled,
+    STATISTICS_CLBlastDgemmPooled,
+    STATISTICS_CLBlastCgemmPooled,
+    STATISTICS_CLBlastZgemmPooled,
+    STATISTICS_CLBlastSgemvBatched,
+    STATISTICS_CLBlastDgemvBatched,
+    STATISTICS_CLBlastCgemvBatched,
+    STATISTICS_CLBlastZgemvBatched,
+    STATISTICS_CLBlastSgemvStridedBatched,
+    STATISTICS_CLBlastDgemvStridedBatched,
+    STATISTICS_CLBlastCgemvStridedBatched,
+    STATISTICS_CLBlastZgemvStridedBatched,
+    STATISTICS_CLBlastStrsvBatched,
+    STATISTICS_CLBlastDtrsvBatched,
+    STATISTICS_CLBlastCtrsvBatched,
+    STATISTICS_CLBlastZtrsvBatched,
+    STATISTICS_CLBlastStrsvStridedBatched,
+    STATISTICS_CLBlastDtrsvStridedBatched,
+    STATISTICS_CLBlastCtrsvStridedBatched,
+    STATISTICS_CLBlastZtrsvStridedBatched,
+    STATISTICS_CLBlastSgerBatched,
+    STATISTICS_CLBlastDgerBatched,
+    STATISTICS_CLBlastSgerStridedBatched,
+    STATISTICS_CLBlastDgerStridedBatched,
+    STATISTICS_CLBlastCgeruBatched,
+    STATISTICS_CLBlastZgeruBatched,
+    STATISTICS_CLBlastCgeruStridedBatched,
+    STATISTICS_CLBlastZgeruStridedBatched,
+    STATISTICS_CLBlastCgercBatched,
+    STATISTICS_CLBlastZgercBatched,
+    STATISTICS_CLBlastCgercStridedBatched,
+    STATISTICS_CLBlastZgercStridedBatched,
+    STATISTICS_CLBlastSGemmTempBufferSize,
+    STATISTICS_CLBlastDGemmTempBufferSize,
+    STATISTICS_CLBlastCGemmTempBufferSize,
+    STATISTICS_CLBlastZGemmTempBufferSize,
+    STATISTICS_CLBlastHGemmTempBufferSize,
+    STATISTICS_CLBlastClearCache,
+    STATISTICS_CLBlastFillCache,
+    STATISTICS_CLBlastOverrideParameters,
+    STATISTICS_COUNT
+};
+
+/**
+* Whether the collection of statistics is enabled
+*/
+extern std::atomic<bool> statisticsEnabled;
+
+/**
+* Record the statistics of a single call of the given routine. The
+* given unwrap time is the time that was spent for converting the
+* arguments, and the call time is the time that was spent inside
+* the CLBlast function.
+*/
+void recordStatistics(StatisticsRoutine routine,
+    int64_t unwrapNanos, int64_t callNanos, CLBlastStatusCode status);
+
+/**
+* Returns the current value of the monotonic clock, in nanoseconds
+*/
+inline int64_t statisticsNanoTime()
+{
+    return (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+* A scope for the statistics of a single routine call. It is created
+* before the arguments are converted. The time between beginCall and
+* endCall is the time spent inside the CLBlast function. The remaining
+* time until the destruction of the scope is attributed to the argument
+* conversion. If the statistics are disabled, then this only checks the
+* flag once.
+*/
+class StatisticsScope
+{
+public:
+    explicit StatisticsScope(StatisticsRoutine routine) :
+        routine(routine),
+        enabled(statisticsEnabled.load(std::memory_order_relaxed)),
+        called(false),
+        status(CLBlastSuccess),
+        startNanos(0),
+        callStartNanos(0),
+        callEndNanos(0)
+    {
+        if (enabled)
+        {
+            startNanos = statisticsNanoTime();
+        }
+    }
+
+    ~StatisticsScope()
+    {
+        if (enabled && called)
+        {
+            int64_t endNanos = statisticsNanoTime();
+            int64_t callNanos = callEndNanos - callStartNanos;
+            int64_t unwrapNanos = (endNanos - startNanos) - callNanos;
+            recordStatistics(routine, unwrapNanos, callNanos, status);
+        }
+    }
+
+    void beginCall()
+    {
+        if (enabled)
+        {
+            callStartNanos = statisticsNanoTime();
+        }
+    }
+
+    void endCall(CLBlastStatusCode result)
+    {
+        if (enabled)
+        {
+            callEndNanos = statisticsNanoTime();
+            called = true;
+            status = result;
+        }
+    }
+
+private:
+    StatisticsScope(const StatisticsScope&);
+    StatisticsScope& operator=(const StatisticsScope&);
+
+    StatisticsRoutine routine;
+    bool enabled;
+    bool called;
+    CLBlastStatusCode status;
+    int64_t startNanos;
+    int64_t callStartNanos;
+    int64_t callEndNanos;
+};
+
+#endif
@@ -0,0 +1,509 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlast.hpp"
+#include "JOCLBlastTempBufferPool.hpp"
+
+#include <map>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+
+// The maximum number of cached temporary buffer sizes. When this is 
+// exceeded, the cache is cleared.
+#define MAX_CACHED_TEMP_BUFFER_SIZES 4096
+
+/**
+* The arguments of a GEMM call that determine the size of the
+* temporary buffer
+*/
+struct TempBufferKey
+{
+    cl_device_id device;
+    int precision;
+    int layout;
+    int a_transpose;
+    int b_transpose;
+    size_t values[9];
+
+    bool operator<(const TempBufferKey &other) const
+    {
+        if (device != other.device) return device < other.device;
+        if (precision != other.precision) return precision < other.precision;
+        if (layout != other.layout) return layout < other.layout;
+        if (a_transpose != other.a_transpose) return a_transpose < other.a_transpose;
+        if (b_transpose != other.b_transpose) return b_transpose < other.b_transpose;
+        for (int i = 0; i < 9; i++)
+        {
+            if (values[i] != other.values[i]) return values[i] < other.values[i];
+        }
+        return false;
+    }
+};
+
+/**
+* The idle buffers of one context, sorted by their size
+*/
+struct ContextTempBuffers
+{
+    ContextTempBuffers() : idleBytes(0) {}
+
+    std::multimap<size_t, cl_mem> idle;
+    size_t idleBytes;
+};
+
+// The mutex protecting all state of the pool
+static std::mutex poolMutex;
+
+// The cached temporary buffer sizes
+static std::map<TempBufferKey, size_t> tempBufferSizes;
+
+// The idle buffers for each context
+static std::map<cl_context, ContextTempBuffers> contextTempBuffers;
+
+// The maximum number of bytes of idle buffers that are kept for each
+// context. Requests for larger buffers are not served by the pool.
+static size_t maxIdleBytes = 256 * 1024 * 1024;
+
+// The maximum number of buffers that may be checked out of the pool at
+// the same time. When this is reached, further requests are not served 
+// by the pool until a buffer is returned.
+static size_t maxOutstandingBuffers = 16;
+
+// The number of buffers that are currently checked out of the pool
+static size_t outstandingBuffers = 0;
+
+// The maximum ratio between the size of an idle buffer and the requested
+// size for which the idle buffer is reused. Larger idle buffers are left
+// in the pool, and a new buffer is created instead.
+static double maxReuseRatio = 2.0;
+
+/**
+* Query the size of the temporary buffer with the CLBlast function
+* for the given precision
+*/
+static CLBlastStatusCode queryTempBufferSize(const TempBufferKey &key,
+    cl_command_queue *queue, size_t *size)
+{
+    CLBlastLayout layout = (CLBlastLayout)key.layout;
+    CLBlastTranspose a_transpose = (CLBlastTranspose)key.a_transpose;
+    CLBlastTranspose b_transpose = (CLBlastTranspose)key.b_transpose;
+    const size_t *v = key.values;
+    switch (key.precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSGemmTempBufferSize(layout, a_transpose, b_transpose, v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], queue, size);
+        case CLBlastPrecisionDouble:
+            return CLBlastDGemmTempBufferSize(layout, a_transpose, b_transpose, v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], queue, size);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCGemmTempBufferSize(layout, a_transpose, b_transpose, v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], queue, size);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZGemmTempBufferSize(layout, a_transpose, b_transpose, v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], queue, size);
+        case CLBlastPrecisionHalf:
+            return CLBlastHGemmTempBufferSize(layout, a_transpose, b_transpose, v[0], v[1], v[2], v[3], v[4], v[5], v[6], v[7], v[8], queue, size);
+    }
+    return CLBlastInvalidValue;
+}
+
+CLBlastStatusCode acquireGemmTempBuffer(CLBlastPrecision precision,
+    CLBlastLayout layout, CLBlastTranspose a_transpose, CLBlastTranspose b_transpose,
+    size_t m, size_t n, size_t k,
+    size_t a_offset, size_t a_ld, size_t b_offset, size_t b_ld, size_t c_offset, size_t c_ld,
+    cl_command_queue *queue, TempBuffer &tempBuffer)
+{
+    tempBuffer.context = nullptr;
+    tempBuffer.buffer = nullptr;
+    tempBuffer.size = 0;
+
+    cl_context context = nullptr;
+    cl_device_id device = nullptr;
+    cl_int error = clGetCommandQueueInfo(*queue, CL_QUEUE_CONTEXT, sizeof(cl_context), &context, nullptr);
+    if (error != CL_SUCCESS) return (CLBlastStatusCode)error;
+    error = clGetCommandQueueInfo(*queue, CL_QUEUE_DEVICE, sizeof(cl_device_id), &device, nullptr);
+    if (error != CL_SUCCESS) return (CLBlastStatusCode)error;
+
+    TempBufferKey key;
+    key.device = device;
+    key.precision = (int)precision;
+    key.layout = (int)layout;
+    key.a_transpose = (int)a_transpose;
+    key.b_transpose = (int)b_transpose;
+    size_t values[9] = { m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld };
+    for (int i = 0; i < 9; i++)
+    {
+        key.values[i] = values[i];
+    }
+
+    // Look up the required size, or query it
+    size_t size = 0;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        std::map<TempBufferKey, size_t>::const_iterator it = tempBufferSizes.find(key);
+        if (it != tempBufferSizes.end())
+        {
+            size = it->second;
+            cached = true;
+        }
+    }
+    if (!cached)
+    {
+        CLBlastStatusCode result = queryTempBufferSize(key, queue, &size);
+        if (result != CLBlastSuccess) return result;
+        std::lock_guard<std::mutex> lock(poolMutex);
+        if (tempBufferSizes.size() >= MAX_CACHED_TEMP_BUFFER_SIZES)
+        {
+            tempBufferSizes.clear();
+        }
+        tempBufferSizes[key] = size;
+    }
+    if (size == 0)
+    {
+        return CLBlastSuccess;
+    }
+
+    // Take the smallest idle buffer that is large enough, unless it is more
+    // than maxReuseRatio times larger than required, or create a new one.
+    // Buffers that exceed the limit are not pooled, and neither are requests
+    // when too many buffers are checked out. In both cases, CLBlast will 
+    // allocate the temporary memory internally.
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        if (size > maxIdleBytes || outstandingBuffers >= maxOutstandingBuffers)
+        {
+            return CLBlastSuccess;
+        }
+        outstandingBuffers++;
+        ContextTempBuffers &buffers = contextTempBuffers[context];
+        std::multimap<size_t, cl_mem>::iterator it = buffers.idle.lower_bound(size);
+        if (it != buffers.idle.end() && (double)it->first <= (double)size * maxReuseRatio)
+        {
+            tempBuffer.context = context;
+            tempBuffer.buffer = it->second;
+            tempBuffer.size = it->first;
+            buffers.idleBytes -= it->first;
+            buffers.idle.erase(it);
+            return CLBlastSuccess;
+        }
+    }
+    cl_mem buffer = clCreateBuffer(context, CL_MEM_READ_WRITE, size, nullptr, &error);
+    if (error != CL_SUCCESS)
+    {
+        Logger::log(LOG_ERROR, "Could not create temporary buffer of %ld bytes: %d\n", (long)size, (int)error);
+        std::lock_guard<std::mutex> lock(poolMutex);
+        outstandingBuffers--;
+        return (CLBlastStatusCode)error;
+    }
+    tempBuffer.context = context;
+    tempBuffer.buffer = buffer;
+    tempBuffer.size = size;
+    return CLBlastSuccess;
+}
+
+/**
+* Return the given buffer to the idle buffers of the given context, or
+* release it if this would exceed the limit
+*/
+static void returnTempBuffer(cl_context context, cl_mem buffer, size_t size)
+{
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        outstandingBuffers--;
+        ContextTempBuffers &buffers = contextTempBuffers[context];
+        if (buffers.idleBytes + size <= maxIdleBytes)
+        {
+            buffers.idle.insert(std::make_pair(size, buffer));
+            buffers.idleBytes += size;
+            return;
+        }
+    }
+    clReleaseMemObject(buffer);
+}
+
+/**
+* The data that is passed to the callback that returns a buffer
+*/
+struct TempBufferCallbackData
+{
+    TempBuffer tempBuffer;
+    bool ownsEvent;
+};
+
+/**
+* The callback that returns a buffer to the pool when the GEMM is complete
+*/
+static void CL_CALLBACK tempBufferCallback(cl_event event, cl_int UNUSED(status), void *userData)
+{
+    TempBufferCallbackData *data = (TempBufferCallbackData*)userData;
+    returnTempBuffer(data->tempBuffer.context, data->tempBuffer.buffer, data->tempBuffer.size);
+    if (data->ownsEvent)
+    {
+        clReleaseEvent(event);
+    }
+    delete data;
+}
+
+void releaseGemmTempBuffer(TempBuffer &tempBuffer, CLBlastStatusCode status,
+    cl_command_queue *queue, cl_event event, bool ownsEvent)
+{
+    if (tempBuffer.buffer == nullptr)
+    {
+        if (ownsEvent && event != nullptr) clReleaseEvent(event);
+        return;
+    }
+    if (status == CLBlastSuccess && event != nullptr)
+    {
+        TempBufferCallbackData *data = new (std::nothrow) TempBufferCallbackData();
+        if (data != nullptr)
+        {
+            data->tempBuffer = tempBuffer;
+            data->ownsEvent = ownsEvent;
+            if (clSetEventCallback(event, CL_COMPLETE, tempBufferCallback, data) == CL_SUCCESS)
+            {
+                tempBuffer.buffer = nullptr;
+                return;
+            }
+            delete data;
+        }
+        clWaitForEvents(1, &event);
+    }
+    else
+    {
+        clFinish(*queue);
+    }
+    if (ownsEvent && event != nullptr) clReleaseEvent(event);
+    returnTempBuffer(tempBuffer.context, tempBuffer.buffer, tempBuffer.size);
+    tempBuffer.buffer = nullptr;
+}
+
+/**
+* Implementation of the pooled GEMM functions, with the plain GEMM and
+* the GEMM with temporary buffer for the scalar type T
+*/
+template <typename T>
+static CLBlastStatusCode pooledGemm(const CLBlastPrecision precision,
+    CLBlastStatusCode (*gemm)(CLBlastLayout, CLBlastTranspose, CLBlastTranspose,
+        size_t, size_t, size_t, T, cl_mem, size_t, size_t, cl_mem, size_t, size_t,
+        T, cl_mem, size_t, size_t, cl_command_queue*, cl_event*),
+    CLBlastStatusCode (*gemmWithTempBuffer)(CLBlastLayout, CLBlastTranspose, CLBlastTranspose,
+        size_t, size_t, size_t, T, cl_mem, size_t, size_t, cl_mem, size_t, size_t,
+        T, cl_mem, size_t, size_t, cl_command_queue*, cl_event*, cl_mem),
+    const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose,
+    const size_t m, const size_t n, const size_t k,
+    const T alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld,
+    const cl_mem b_buffer, const size_t b_offset, const size_t b_ld,
+    const T beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld,
+    cl_command_queue *queue, cl_event *event)
+{
+    TempBuffer tempBuffer;
+    CLBlastStatusCode result = acquireGemmTempBuffer(precision, layout, a_transpose, b_transpose,
+        m, n, k, a_offset, a_ld, b_offset, b_ld, c_offset, c_ld, queue, tempBuffer);
+    if (result != CLBlastSuccess)
+    {
+        return result;
+    }
+
+    // The call always receives an event, so that the buffer can be
+    // returned to the pool when the call is complete
+    cl_event callEvent = nullptr;
+    if (tempBuffer.buffer == nullptr)
+    {
+        result = gemm(layout, a_transpose, b_transpose, m, n, k,
+            alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+            beta, c_buffer, c_offset, c_ld, queue, &callEvent);
+    }
+    else
+    {
+        result = gemmWithTempBuffer(layout, a_transpose, b_transpose, m, n, k,
+            alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld,
+            beta, c_buffer, c_offset, c_ld, queue, &callEvent, tempBuffer.buffer);
+    }
+    if (event != nullptr)
+    {
+        *event = callEvent;
+    }
+    releaseGemmTempBuffer(tempBuffer, result, queue, callEvent, event == nullptr);
+    return result;
+}
+
+CLBlastStatusCode pooledSgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, cl_command_queue * queue, cl_event * event)
+{
+    return pooledGemm<float>(CLBlastPrecisionSingle, CLBlastSgemm, CLBlastSgemmWithTempBuffer,
+        layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event);
+}
+
+CLBlastStatusCode pooledDgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, cl_command_queue * queue, cl_event * event)
+{
+    return pooledGemm<double>(CLBlastPrecisionDouble, CLBlastDgemm, CLBlastDgemmWithTempBuffer,
+        layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event);
+}
+
+CLBlastStatusCode pooledCgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, cl_command_queue * queue, cl_event * event)
+{
+    return pooledGemm<cl_float2>(CLBlastPrecisionComplexSingle, CLBlastCgemm, CLBlastCgemmWithTempBuffer,
+        layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event);
+}
+
+CLBlastStatusCode pooledZgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, cl_command_queue * queue, cl_event * event)
+{
+    return pooledGemm<cl_double2>(CLBlastPrecisionComplexDouble, CLBlastZgemm, CLBlastZgemmWithTempBuffer,
+        layout, a_transpose, b_transpose, m, n, k, alpha, a_buffer, a_offset, a_ld, b_buffer, b_offset, b_ld, beta, c_buffer, c_offset, c_ld, queue, event);
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    setTempBufferPoolLimitNative
+* Signature: (J)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setTempBufferPoolLimitNative
+(JNIEnv *env, jclass UNUSED(cls), jlong limit)
+{
+    Logger::log(LOG_TRACE, "Executing setTempBufferPoolLimit(limit=%ld)\n", (long)limit);
+
+    // Remove the largest idle buffers of each context until its idle 
+    // buffers no longer exceed the new limit
+    std::vector<cl_mem> released;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        maxIdleBytes = (size_t)limit;
+        for (std::map<cl_context, ContextTempBuffers>::iterator it = contextTempBuffers.begin();
+            it != contextTempBuffers.end(); ++it)
+        {
+            ContextTempBuffers &buffers = it->second;
+            while (buffers.idleBytes > maxIdleBytes)
+            {
+                std::multimap<size_t, cl_mem>::iterator largest = --buffers.idle.end();
+                buffers.idleBytes -= largest->first;
+                released.push_back(largest->second);
+                buffers.idle.erase(largest);
+            }
+        }
+    }
+    for (size_t i = 0; i < released.size(); i++)
+    {
+        clReleaseMemObject(released[i]);
+    }
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    setTempBufferPoolMaxOutstandingNative
+* Signature: (I)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setTempBufferPoolMaxOutstandingNative
+(JNIEnv *env, jclass UNUSED(cls), jint count)
+{
+    Logger::log(LOG_TRACE, "Executing setTempBufferPoolMaxOutstanding(count=%d)\n", (int)count);
+    std::lock_guard<std::mutex> lock(poolMutex);
+    maxOutstandingBuffers = (size_t)count;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    setTempBufferPoolMaxReuseRatioNative
+* Signature: (D)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setTempBufferPoolMaxReuseRatioNative
+(JNIEnv *env, jclass UNUSED(cls), jdouble ratio)
+{
+    Logger::log(LOG_TRACE, "Executing setTempBufferPoolMaxReuseRatio(ratio=%f)\n", (double)ratio);
+    std::lock_guard<std::mutex> lock(poolMutex);
+    maxReuseRatio = (double)ratio;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    getTempBufferPoolMaxReuseRatioNative
+* Signature: ()D
+*/
+JNIEXPORT jdouble JNICALL Java_org_jocl_blast_CLBlast_getTempBufferPoolMaxReuseRatioNative
+(JNIEnv *env, jclass UNUSED(cls))
+{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    return (jdouble)maxReuseRatio;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    getTempBufferPoolOutstandingNative
+* Signature: ()I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlast_getTempBufferPoolOutstandingNative
+(JNIEnv *env, jclass UNUSED(cls))
+{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    return (jint)outstandingBuffers;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    getTempBufferPoolSizeNative
+* Signature: ()J
+*/
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlast_getTempBufferPoolSizeNative
+(JNIEnv *env, jclass UNUSED(cls))
+{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    size_t result = 0;
+    for (std::map<cl_context, ContextTempBuffers>::const_iterator it = contextTempBuffers.begin();
+        it != contextTempBuffers.end(); ++it)
+    {
+        result += it->second.idleBytes;
+    }
+    return (jlong)result;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    trimTempBufferPoolNative
+* Signature: ()V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_trimTempBufferPoolNative
+(JNIEnv *env, jclass UNUSED(cls))
+{
+    Logger::log(LOG_TRACE, "Executing trimTempBufferPool()\n");
+    std::map<cl_context, ContextTempBuffers> released;
+    {
+        std::lock_guard<std::mutex> lock(poolMutex);
+        released.swap(contextTempBuffers);
+        tempBufferSizes.clear();
+    }
+    for (std::map<cl_context, ContextTempBuffers>::const_iterator it = released.begin();
+        it != released.end(); ++it)
+    {
+        for (std::multimap<size_t, cl_mem>::const_iterator b = it->second.idle.begin();
+            b != it->second.idle.end(); ++b)
+        {
+            clReleaseMemObject(b->second);
+        }
+    }
+}
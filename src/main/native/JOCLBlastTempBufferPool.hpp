@@ -0,0 +1,79 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef JOCL_BLAST_TEMP_BUFFER_POOL_HPP
+#define JOCL_BLAST_TEMP_BUFFER_POOL_HPP
+
+#include <CL/cl.h>
+#include <clblast_c.h>
+
+/**
+* A temporary buffer for a GEMM call that was obtained from the pool. If
+* the buffer is nullptr, then no temporary buffer is required, or the
+* required size exceeds the limit of the pool. In both cases, the plain
+* CLBlastXgemm function should be called.
+*/
+struct TempBuffer
+{
+    cl_context context;
+    cl_mem buffer;
+    size_t size;
+};
+
+/**
+* Obtain a temporary buffer for a GEMM call with the given precision
+* and arguments. The required size is queried with CLBlastXGemmTempBufferSize
+* once for each combination of device and arguments, and cached afterwards.
+*/
+CLBlastStatusCode acquireGemmTempBuffer(CLBlastPrecision precision,
+    CLBlastLayout layout, CLBlastTranspose a_transpose, CLBlastTranspose b_transpose,
+    size_t m, size_t n, size_t k,
+    size_t a_offset, size_t a_ld, size_t b_offset, size_t b_ld, size_t c_offset, size_t c_ld,
+    cl_command_queue *queue, TempBuffer &tempBuffer);
+
+/**
+* Return the given temporary buffer to the pool, as soon as the given
+* event is complete. If 'ownsEvent' is true, then the event is released
+* afterwards. If the call that used the buffer failed, then the queue
+* is finished before the buffer is returned.
+*/
+void releaseGemmTempBuffer(TempBuffer &tempBuffer, CLBlastStatusCode status,
+    cl_command_queue *queue, cl_event event, bool ownsEvent);
+
+/**
+* GEMM functions with the signature of CLBlastXgemm that obtain their
+* temporary buffer from the pool. When no temporary buffer is required,
+* or the required size exceeds the limit of the pool, then the plain
+* CLBlastXgemm function is called. The buffer is returned to the pool
+* when the event of the call is complete.
+*/
+CLBlastStatusCode pooledSgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const float alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const float beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode pooledDgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const double alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const double beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode pooledCgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_float2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_float2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, cl_command_queue * queue, cl_event * event);
+CLBlastStatusCode pooledZgemm(const CLBlastLayout layout, const CLBlastTranspose a_transpose, const CLBlastTranspose b_transpose, const size_t m, const size_t n, const size_t k, const cl_double2 alpha, const cl_mem a_buffer, const size_t a_offset, const size_t a_ld, const cl_mem b_buffer, const size_t b_offset, const size_t b_ld, const cl_double2 beta, cl_mem c_buffer, const size_t c_offset, const size_t c_ld, cl_command_queue * queue, cl_event * event);
+
+#endif
@@ -0,0 +1,430 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlast.hpp"
+#include "JOCLBlastRoutines.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+
+// The default capacity of the call trace ring buffer, in bytes
+#define CALL_TRACE_DEFAULT_CAPACITY (16 * 1024 * 1024)
+
+// The size of the header of each record: The record size (uint32), the
+// routine index (uint16), the argument count (uint16), the status
+// (int32), the timestamp and the host duration in nanoseconds (int64)
+#define CALL_TRACE_HEADER_SIZE 28
+
+std::atomic<bool> callTraceEnabled(false);
+
+// The mutex that protects the ring buffer, the routine names and the
+// counters of the call trace
+static std::mutex callTraceMutex;
+
+// The ring buffer with the records. The oldest record starts at the
+// head, and the records occupy 'callTraceUsed' bytes, wrapping around
+// at the end of the buffer. The buffer is allocated when the trace is
+// enabled for the first time.
+static std::vector<unsigned char> callTraceRing;
+static size_t callTraceCapacity = CALL_TRACE_DEFAULT_CAPACITY;
+static size_t callTraceHead = 0;
+static size_t callTraceUsed = 0;
+
+// The number of records that are contained in the ring buffer, and the
+// number of records that have been overwritten since the last reset
+static jlong callTraceRecordCount = 0;
+static jlong callTraceDroppedCount = 0;
+
+// The time that the timestamps of the records refer to
+static std::chrono::steady_clock::time_point callTraceStart;
+
+// The routine names that the routine indices of the records refer to.
+// They are not cleared when the trace is reset, so that the indices
+// remain valid.
+static std::vector<std::string> callTraceRoutineNames;
+static std::map<const Routine*, uint16_t> callTraceRoutineIndices;
+
+// The buffer into which each record is assembled before it is copied
+// into the ring buffer
+static thread_local std::vector<unsigned char> callTraceRecord;
+
+/**
+* Append the given value to the given record
+*/
+template <typename T>
+static void appendValue(std::vector<unsigned char> &record, T value)
+{
+    size_t offset = record.size();
+    record.resize(offset + sizeof(T));
+    memcpy(&record[offset], &value, sizeof(T));
+}
+
+/**
+* Append the given number of bytes to the given record
+*/
+static void appendBytes(std::vector<unsigned char> &record, const void *data, size_t size)
+{
+    size_t offset = record.size();
+    record.resize(offset + size);
+    if (size > 0)
+    {
+        memcpy(&record[offset], data, size);
+    }
+}
+
+/**
+* Append the length and the elements of the given Java array to the
+* given record, using the given function for obtaining the elements
+*/
+template <typename ArrayType, typename ElementType>
+static void appendArray(JNIEnv *env, std::vector<unsigned char> &record, jobject object,
+    void (JNIEnv::*getRegion)(ArrayType, jsize, jsize, ElementType*))
+{
+    ArrayType array = (ArrayType)object;
+    jsize length = env->GetArrayLength(array);
+    appendValue<int32_t>(record, (int32_t)length);
+    size_t offset = record.size();
+    record.resize(offset + length * sizeof(ElementType));
+    if (length > 0)
+    {
+        (env->*getRegion)(array, 0, length, (ElementType*)&record[offset]);
+    }
+}
+
+/**
+* Returns the index of the given routine in the routine names. The call
+* trace mutex must be held.
+*/
+static uint16_t routineIndex(const Routine &routine)
+{
+    std::map<const Routine*, uint16_t>::iterator it = callTraceRoutineIndices.find(&routine);
+    if (it != callTraceRoutineIndices.end())
+    {
+        return it->second;
+    }
+    uint16_t index = (uint16_t)callTraceRoutineNames.size();
+    callTraceRoutineNames.push_back(routine.name);
+    callTraceRoutineIndices[&routine] = index;
+    return index;
+}
+
+/**
+* Remove all records from the ring buffer. The call trace mutex must be
+* held.
+*/
+static void resetCallTrace()
+{
+    callTraceHead = 0;
+    callTraceUsed = 0;
+    callTraceRecordCount = 0;
+    callTraceDroppedCount = 0;
+    callTraceStart = std::chrono::steady_clock::now();
+}
+
+/**
+* Copy the given number of bytes from/to the ring buffer, starting at
+* the given position, wrapping around at the end of the ring buffer
+*/
+static void readRing(size_t position, void *target, size_t size)
+{
+    size_t capacity = callTraceRing.size();
+    size_t first = std::min(size, capacity - position);
+    memcpy(target, &callTraceRing[position], first);
+    memcpy((unsigned char*)target + first, &callTraceRing[0], size - first);
+}
+
+static void writeRing(size_t position, const void *source, size_t size)
+{
+    size_t capacity = callTraceRing.size();
+    size_t first = std::min(size, capacity - position);
+    memcpy(&callTraceRing[position], source, first);
+    memcpy(&callTraceRing[0], (const unsigned char*)source + first, size - first);
+}
+
+/**
+* Append the given record to the ring buffer, removing the oldest
+* records until there is enough space. Records that are larger than the
+* ring buffer are dropped. The call trace mutex must be held.
+*/
+static void appendRecord(const std::vector<unsigned char> &record)
+{
+    size_t capacity = callTraceRing.size();
+    if (record.size() > capacity)
+    {
+        callTraceDroppedCount++;
+        return;
+    }
+    while (callTraceUsed + record.size() > capacity)
+    {
+        uint32_t oldSize = 0;
+        readRing(callTraceHead, &oldSize, sizeof(uint32_t));
+        callTraceHead = (callTraceHead + oldSize) % capacity;
+        callTraceUsed -= oldSize;
+        callTraceRecordCount--;
+        callTraceDroppedCount++;
+    }
+    writeRing((callTraceHead + callTraceUsed) % capacity, record.data(), record.size());
+    callTraceUsed += record.size();
+    callTraceRecordCount++;
+}
+
+void CallTraceScope::record(CLBlastStatusCode result)
+{
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+
+    // Assemble the arguments of the record. The scalar values and the
+    // contents of host arrays are taken from the Java arguments, so that
+    // they can be passed to the same Java methods during a replay. For
+    // memory objects, the handle and the size are recorded. The handles
+    // only serve as identities, so that a replay can use the same
+    // synthetic buffer wherever the same memory object was used.
+    std::vector<unsigned char> &data = callTraceRecord;
+    data.resize(CALL_TRACE_HEADER_SIZE);
+    for (int i = 0; i < count; i++)
+    {
+        const JavaValue &value = javaArguments[i].value;
+        const JavaValue &extra = javaArguments[i].extra;
+        const NativeValue &native = nativeValues[i];
+        appendValue<uint8_t>(data, (uint8_t)kinds[i]);
+        switch (kinds[i])
+        {
+            case ARGUMENT_SIZE:
+                appendValue<int64_t>(data, (int64_t)value.l);
+                break;
+            case ARGUMENT_ENUM:
+                appendValue<int32_t>(data, (int32_t)value.i);
+                break;
+            case ARGUMENT_FLOAT:
+            case ARGUMENT_HALF:
+                appendValue<float>(data, (float)value.f);
+                break;
+            case ARGUMENT_DOUBLE:
+                appendValue<double>(data, (double)value.d);
+                break;
+            case ARGUMENT_COMPLEX_FLOAT:
+                appendValue<float>(data, (float)value.f);
+                appendValue<float>(data, (float)extra.f);
+                break;
+            case ARGUMENT_COMPLEX_DOUBLE:
+                appendValue<double>(data, (double)value.d);
+                appendValue<double>(data, (double)extra.d);
+                break;
+            case ARGUMENT_MEM:
+            {
+                size_t size = 0;
+                clGetMemObjectInfo(native.mem, CL_MEM_SIZE, sizeof(size_t), &size, nullptr);
+                appendValue<int64_t>(data, (int64_t)(intptr_t)native.mem);
+                appendValue<int64_t>(data, (int64_t)size);
+                break;
+            }
+            case ARGUMENT_DEVICE:
+                appendValue<int64_t>(data, (int64_t)(intptr_t)native.device);
+                break;
+            case ARGUMENT_QUEUE:
+                appendValue<int64_t>(data, (int64_t)(intptr_t)*native.queue);
+                break;
+            case ARGUMENT_QUEUE_WAIT_LIST:
+            {
+                jsize waitListLength = extra.object == nullptr ? -1 :
+                    env->GetArrayLength((jobjectArray)extra.object);
+                appendValue<int64_t>(data, (int64_t)(intptr_t)*native.queue);
+                appendValue<int32_t>(data, (int32_t)waitListLength);
+                break;
+            }
+            case ARGUMENT_EVENT:
+                appendValue<uint8_t>(data, value.object == nullptr ? 0 : 1);
+                break;
+            case ARGUMENT_FLOAT2_VALUE:
+            case ARGUMENT_FLOAT_ARRAY:
+            case ARGUMENT_FLOAT2_ARRAY:
+            case ARGUMENT_HALF_ARRAY:
+                appendArray(env, data, value.object, &JNIEnv::GetFloatArrayRegion);
+                break;
+            case ARGUMENT_DOUBLE2_VALUE:
+            case ARGUMENT_DOUBLE_ARRAY:
+            case ARGUMENT_DOUBLE2_ARRAY:
+                appendArray(env, data, value.object, &JNIEnv::GetDoubleArrayRegion);
+                break;
+            case ARGUMENT_SIZE_ARRAY:
+                appendArray(env, data, value.object, &JNIEnv::GetLongArrayRegion);
+                break;
+            case ARGUMENT_DIRECT_FLOAT:
+                appendValue<int32_t>(data, (int32_t)extra.l);
+                appendBytes(data, native.floats, (size_t)extra.l * sizeof(float));
+                break;
+            case ARGUMENT_DIRECT_DOUBLE:
+                appendValue<int32_t>(data, (int32_t)extra.l);
+                appendBytes(data, native.doubles, (size_t)extra.l * sizeof(double));
+                break;
+            case ARGUMENT_DIRECT_FLOAT2:
+                appendValue<int32_t>(data, (int32_t)(extra.l * 2));
+                appendBytes(data, native.float2s, (size_t)extra.l * sizeof(cl_float2));
+                break;
+            case ARGUMENT_DIRECT_DOUBLE2:
+                appendValue<int32_t>(data, (int32_t)(extra.l * 2));
+                appendBytes(data, native.double2s, (size_t)extra.l * sizeof(cl_double2));
+                break;
+            case ARGUMENT_DIRECT_HALF:
+                appendValue<int32_t>(data, (int32_t)extra.l);
+                appendBytes(data, native.halfs, (size_t)extra.l * sizeof(cl_half));
+                break;
+            case ARGUMENT_DIRECT_SIZE:
+                appendValue<int32_t>(data, (int32_t)extra.l);
+                for (jlong j = 0; j < extra.l; j++)
+                {
+                    appendValue<int64_t>(data, (int64_t)native.sizes[j]);
+                }
+                break;
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(callTraceMutex);
+    if (callTraceRing.empty())
+    {
+        return;
+    }
+    uint32_t size = (uint32_t)data.size();
+    uint16_t index = routineIndex(routine);
+    uint16_t argumentCount = (uint16_t)count;
+    int32_t status = (int32_t)result;
+    int64_t timestamp = (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(start - callTraceStart).count();
+    int64_t duration = (int64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    memcpy(&data[0], &size, sizeof(uint32_t));
+    memcpy(&data[4], &index, sizeof(uint16_t));
+    memcpy(&data[6], &argumentCount, sizeof(uint16_t));
+    memcpy(&data[8], &status, sizeof(int32_t));
+    memcpy(&data[12], &timestamp, sizeof(int64_t));
+    memcpy(&data[20], &duration, sizeof(int64_t));
+    appendRecord(data);
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    setCallTraceEnabledNative
+* Signature: (Z)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setCallTraceEnabledNative
+(JNIEnv *env, jclass UNUSED(cls), jboolean enabled)
+{
+    Logger::log(LOG_TRACE, "Executing setCallTraceEnabled(enabled=%d)\n", (int)enabled);
+    std::lock_guard<std::mutex> lock(callTraceMutex);
+    if (enabled == JNI_TRUE && callTraceRing.empty())
+    {
+        callTraceRing.resize(callTraceCapacity);
+        resetCallTrace();
+    }
+    callTraceEnabled.store(enabled == JNI_TRUE);
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    setCallTraceCapacityNative
+* Signature: (I)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_setCallTraceCapacityNative
+(JNIEnv *env, jclass UNUSED(cls), jint capacity)
+{
+    Logger::log(LOG_TRACE, "Executing setCallTraceCapacity(capacity=%d)\n", (int)capacity);
+    std::lock_guard<std::mutex> lock(callTraceMutex);
+    callTraceCapacity = (size_t)capacity;
+    if (!callTraceRing.empty())
+    {
+        std::vector<unsigned char>(callTraceCapacity).swap(callTraceRing);
+    }
+    resetCallTrace();
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    getCallTraceNative
+* Signature: (Z)[Ljava/lang/Object;
+*/
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_getCallTraceNative
+(JNIEnv *env, jclass UNUSED(cls), jboolean reset)
+{
+    Logger::log(LOG_TRACE, "Executing getCallTrace(reset=%d)\n", (int)reset);
+
+    // Copy the records, so that the JNI calls are not done while the
+    // routine calls are blocked
+    std::vector<std::string> names;
+    std::vector<unsigned char> records;
+    jlong counts[2];
+    {
+        std::lock_guard<std::mutex> lock(callTraceMutex);
+        names = callTraceRoutineNames;
+        records.resize(callTraceUsed);
+        if (callTraceUsed > 0)
+        {
+            readRing(callTraceHead, records.data(), callTraceUsed);
+        }
+        counts[0] = callTraceRecordCount;
+        counts[1] = callTraceDroppedCount;
+        if (reset == JNI_TRUE)
+        {
+            resetCallTrace();
+        }
+    }
+
+    // The result contains a String[] with the routine names, a byte[]
+    // with the records, and a long[] with the number of records and the
+    // number of dropped records
+    jclass Object_Class = env->FindClass("java/lang/Object");
+    if (Object_Class == nullptr) return nullptr;
+    jclass String_Class = env->FindClass("java/lang/String");
+    if (String_Class == nullptr) return nullptr;
+    jobjectArray result = env->NewObjectArray(3, Object_Class, nullptr);
+    if (result == nullptr) return nullptr;
+    jobjectArray namesArray = env->NewObjectArray((jsize)names.size(), String_Class, nullptr);
+    if (namesArray == nullptr) return nullptr;
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        jstring name = env->NewStringUTF(names[i].c_str());
+        if (name == nullptr) return nullptr;
+        env->SetObjectArrayElement(namesArray, (jsize)i, name);
+        env->DeleteLocalRef(name);
+    }
+    jbyteArray recordsArray = env->NewByteArray((jsize)records.size());
+    if (recordsArray == nullptr) return nullptr;
+    env->SetByteArrayRegion(recordsArray, 0, (jsize)records.size(), (const jbyte*)records.data());
+    jlongArray countsArray = env->NewLongArray(2);
+    if (countsArray == nullptr) return nullptr;
+    env->SetLongArrayRegion(countsArray, 0, 2, counts);
+    env->SetObjectArrayElement(result, 0, namesArray);
+    env->SetObjectArrayElement(result, 1, recordsArray);
+    env->SetObjectArrayElement(result, 2, countsArray);
+    return result;
+}
@@ -0,0 +1,695 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlast.hpp"
+#include "JOCLBlastTuning.hpp"
+
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <fstream>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+#include "CLJNIUtils.hpp"
+#include "ConversionsCL.hpp"
+
+// The tuning parameters of one kernel, sorted by their name
+typedef std::map<std::string, size_t> TuningParameters;
+
+// The tuning parameters of all kernels of one device, for each
+// combination of kernel name and precision
+typedef std::map<std::pair<std::string, int>, TuningParameters> TuningDatabase;
+
+// The tuning parameters that have been applied for each device
+static std::map<cl_device_id, TuningDatabase> tuningDatabases;
+static std::mutex tuningDatabasesMutex;
+
+void recordTuningParameters(cl_device_id device, const char *kernelName,
+    CLBlastPrecision precision, size_t numParameters,
+    const char **names, const size_t *values)
+{
+    TuningParameters parameters;
+    for (size_t i = 0; i < numParameters; i++)
+    {
+        parameters[names[i]] = values[i];
+    }
+    std::lock_guard<std::mutex> lock(tuningDatabasesMutex);
+    tuningDatabases[device][std::make_pair(std::string(kernelName), (int)precision)] = parameters;
+}
+
+
+
+//============================================================================
+// A minimal JSON parser, sufficient for reading tuning databases
+
+/**
+* A JSON value
+*/
+struct JsonValue
+{
+    enum Type { JSON_NULL, JSON_BOOLEAN, JSON_NUMBER, JSON_STRING, JSON_ARRAY, JSON_OBJECT };
+
+    JsonValue() : type(JSON_NULL), number(0.0) {}
+
+    Type type;
+    double number;
+    std::string string;
+    std::vector<JsonValue> elements;
+    std::vector<std::pair<std::string, JsonValue> > members;
+
+    /**
+    * Returns the member with the given name, or nullptr if this is
+    * not an object or there is no such member
+    */
+    const JsonValue* member(const char *name) const
+    {
+        for (size_t i = 0; i < members.size(); i++)
+        {
+            if (members[i].first == name)
+            {
+                return &members[i].second;
+            }
+        }
+        return nullptr;
+    }
+};
+
+/**
+* A recursive descent parser for JSON values. On failure, the error
+* message and the position where the error occurred are available.
+*/
+class JsonParser
+{
+public:
+    explicit JsonParser(const std::string &text) : text(text), position(0) {}
+
+    bool parse(JsonValue &value)
+    {
+        if (!parseValue(value, 0)) return false;
+        skipWhitespace();
+        if (position != text.size()) return fail("Unexpected trailing characters");
+        return true;
+    }
+
+    const std::string& getError() const { return error; }
+    size_t getPosition() const { return position; }
+
+private:
+    const std::string &text;
+    size_t position;
+    std::string error;
+
+    bool fail(const char *message)
+    {
+        error = message;
+        return false;
+    }
+
+    void skipWhitespace()
+    {
+        while (position < text.size() &&
+            (text[position] == ' ' || text[position] == '\t' ||
+             text[position] == '\n' || text[position] == '\r'))
+        {
+            position++;
+        }
+    }
+
+    bool consume(const char *literal)
+    {
+        size_t length = strlen(literal);
+        if (text.compare(position, length, literal) != 0) return false;
+        position += length;
+        return true;
+    }
+
+    bool parseValue(JsonValue &value, int depth)
+    {
+        if (depth > 64) return fail("Nesting too deep");
+        skipWhitespace();
+        if (position >= text.size()) return fail("Unexpected end of input");
+        char c = text[position];
+        if (c == '{') return parseObject(value, depth);
+        if (c == '[') return parseArray(value, depth);
+        if (c == '"')
+        {
+            value.type = JsonValue::JSON_STRING;
+            return parseString(value.string);
+        }
+        if (consume("true") || consume("false"))
+        {
+            value.type = JsonValue::JSON_BOOLEAN;
+            value.number = (c == 't') ? 1.0 : 0.0;
+            return true;
+        }
+        if (consume("null"))
+        {
+            value.type = JsonValue::JSON_NULL;
+            return true;
+        }
+        const char *start = text.c_str() + position;
+        char *end = nullptr;
+        value.number = strtod(start, &end);
+        if (end == start) return fail("Unexpected character");
+        value.type = JsonValue::JSON_NUMBER;
+        position += (size_t)(end - start);
+        return true;
+    }
+
+    bool parseString(std::string &result)
+    {
+        position++;
+        while (position < text.size())
+        {
+            char c = text[position++];
+            if (c == '"') return true;
+            if (c != '\\')
+            {
+                result += c;
+                continue;
+            }
+            if (position >= text.size()) break;
+            char e = text[position++];
+            switch (e)
+            {
+                case '"': result += '"'; break;
+                case '\\': result += '\\'; break;
+                case '/': result += '/'; break;
+                case 'b': result += '\b'; break;
+                case 'f': result += '\f'; break;
+                case 'n': result += '\n'; break;
+                case 'r': result += '\r'; break;
+                case 't': result += '\t'; break;
+                case 'u':
+                {
+                    // Only ASCII is relevant for tuning databases
+                    if (position + 4 > text.size()) return fail("Invalid escape sequence");
+                    unsigned long code = strtoul(text.substr(position, 4).c_str(), nullptr, 16);
+                    result += (code < 0x80) ? (char)code : '?';
+                    position += 4;
+                    break;
+                }
+                default: return fail("Invalid escape sequence");
+            }
+        }
+        return fail("Unterminated string");
+    }
+
+    bool parseArray(JsonValue &value, int depth)
+    {
+        value.type = JsonValue::JSON_ARRAY;
+        position++;
+        skipWhitespace();
+        if (consume("]")) return true;
+        while (true)
+        {
+            value.elements.push_back(JsonValue());
+            if (!parseValue(value.elements.back(), depth + 1)) return false;
+            skipWhitespace();
+            if (consume("]")) return true;
+            if (!consume(",")) return fail("Expected ',' or ']'");
+        }
+    }
+
+    bool parseObject(JsonValue &value, int depth)
+    {
+        value.type = JsonValue::JSON_OBJECT;
+        position++;
+        skipWhitespace();
+        if (consume("}")) return true;
+        while (true)
+        {
+            skipWhitespace();
+            if (position >= text.size() || text[position] != '"') return fail("Expected member name");
+            std::string name;
+            if (!parseString(name)) return false;
+            skipWhitespace();
+            if (!consume(":")) return fail("Expected ':'");
+            value.members.push_back(std::make_pair(name, JsonValue()));
+            if (!parseValue(value.members.back().second, depth + 1)) return false;
+            skipWhitespace();
+            if (consume("}")) return true;
+            if (!consume(",")) return fail("Expected ',' or '}'");
+        }
+    }
+};
+
+
+
+//============================================================================
+// Conversion of JSON values into tuning database entries
+
+/**
+* A single entry of a tuning database
+*/
+struct TuningEntry
+{
+    std::string kernel;
+    int precision;
+    TuningParameters parameters;
+};
+
+/**
+* Obtain an unsigned integer from the given JSON value, which may be
+* a number or a string containing a number
+*/
+static bool toSize(const JsonValue *value, size_t &result)
+{
+    if (value == nullptr) return false;
+    if (value->type == JsonValue::JSON_NUMBER)
+    {
+        if (value->number < 0) return false;
+        result = (size_t)value->number;
+        return true;
+    }
+    if (value->type == JsonValue::JSON_STRING)
+    {
+        char *end = nullptr;
+        unsigned long long number = strtoull(value->string.c_str(), &end, 10);
+        if (end == value->string.c_str() || *end != '\0') return false;
+        result = (size_t)number;
+        return true;
+    }
+    return false;
+}
+
+/**
+* Convert a kernel family name of the CLBlast tuner, like "xgemm_direct_1"
+* or "xgemv_fast", into the kernel name that is expected by
+* CLBlastOverrideParameters, like "XgemmDirect" or "XgemvFast"
+*/
+static std::string kernelNameForFamily(const std::string &family)
+{
+    std::string result;
+    std::stringstream stream(family);
+    std::string part;
+    while (std::getline(stream, part, '_'))
+    {
+        if (part.empty() || part.find_first_not_of("0123456789") == std::string::npos)
+        {
+            continue;
+        }
+        part[0] = (char)toupper(part[0]);
+        result += part;
+    }
+    return result;
+}
+
+/**
+* Convert the given JSON value into a tuning entry. The value may either
+* be an object with "kernel", "precision" and "parameters" (as written by
+* exportTuningDatabase), or the output of the CLBlast tuner, with
+* "kernel_family", "precision" and "best_parameters".
+*/
+static bool toTuningEntry(const JsonValue &value, TuningEntry &entry)
+{
+    if (value.type != JsonValue::JSON_OBJECT) return false;
+    size_t precision = 0;
+    if (!toSize(value.member("precision"), precision)) return false;
+    entry.precision = (int)precision;
+
+    const JsonValue *kernel = value.member("kernel");
+    const JsonValue *parameters = value.member("parameters");
+    if (kernel != nullptr && kernel->type == JsonValue::JSON_STRING &&
+        parameters != nullptr && parameters->type == JsonValue::JSON_OBJECT)
+    {
+        entry.kernel = kernel->string;
+        for (size_t i = 0; i < parameters->members.size(); i++)
+        {
+            size_t parameterValue = 0;
+            if (!toSize(&parameters->members[i].second, parameterValue)) return false;
+            entry.parameters[parameters->members[i].first] = parameterValue;
+        }
+        return true;
+    }
+
+    const JsonValue *family = value.member("kernel_family");
+    const JsonValue *bestParameters = value.member("best_parameters");
+    if (family != nullptr && family->type == JsonValue::JSON_STRING &&
+        bestParameters != nullptr && bestParameters->type == JsonValue::JSON_STRING)
+    {
+        entry.kernel = kernelNameForFamily(family->string);
+        std::stringstream stream(bestParameters->string);
+        std::string token;
+        while (stream >> token)
+        {
+            size_t separator = token.find('=');
+            if (separator == std::string::npos) return false;
+            std::string name = token.substr(0, separator);
+            if (name == "PRECISION") continue;
+            JsonValue number;
+            number.type = JsonValue::JSON_STRING;
+            number.string = token.substr(separator + 1);
+            size_t parameterValue = 0;
+            if (!toSize(&number, parameterValue)) return false;
+            entry.parameters[name] = parameterValue;
+        }
+        return !entry.kernel.empty();
+    }
+    return false;
+}
+
+/**
+* Collect the tuning entries from the given JSON root value. This may be
+* an object with an "entries" array, an array of entries, or a single
+* entry. Returns the index of the first invalid entry, or -1 if all
+* entries are valid.
+*/
+static int toTuningEntries(const JsonValue &root, std::vector<TuningEntry> &entries)
+{
+    const JsonValue *list = &root;
+    const JsonValue *member = root.member("entries");
+    if (member != nullptr && member->type == JsonValue::JSON_ARRAY)
+    {
+        list = member;
+    }
+    if (list->type != JsonValue::JSON_ARRAY)
+    {
+        entries.resize(1);
+        return toTuningEntry(root, entries[0]) ? -1 : 0;
+    }
+    entries.resize(list->elements.size());
+    for (size_t i = 0; i < list->elements.size(); i++)
+    {
+        if (!toTuningEntry(list->elements[i], entries[i])) return (int)i;
+    }
+    return -1;
+}
+
+/**
+* Write the given string as a JSON string literal into the given stream
+*/
+static void writeJsonString(std::ostream &stream, const std::string &s)
+{
+    stream << '"';
+    for (size_t i = 0; i < s.size(); i++)
+    {
+        if (s[i] == '"' || s[i] == '\\') stream << '\\';
+        stream << s[i];
+    }
+    stream << '"';
+}
+
+/**
+* Throw a java.io.IOException with the given message and file name
+*/
+static void throwIOException(JNIEnv *env, const char *message, const char *fileName)
+{
+    std::string text = std::string(message) + ": " + fileName;
+    ThrowByName(env, "java/io/IOException", text.c_str());
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    loadTuningDatabaseNative
+* Signature: (Lorg/jocl/cl_device_id;Ljava/lang/String;)[Ljava/lang/String;
+*/
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_loadTuningDatabaseNative
+(JNIEnv *env, jclass UNUSED(cls), jobject device, jstring fileName)
+{
+    // Null-checks for non-primitive arguments
+    if (device == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'device' is null for loadTuningDatabase");
+        return nullptr;
+    }
+    if (fileName == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'fileName' is null for loadTuningDatabase");
+        return nullptr;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing loadTuningDatabase(device=%p, fileName=%p)\n",
+        device, fileName);
+
+    // Native variable declarations
+    cl_device_id device_native = nullptr;
+    char * fileName_native = nullptr;
+
+    // Obtain native variable values
+    if (!initNative(env, device, device_native, true)) return nullptr;
+    if (!initNative(env, fileName, fileName_native, true)) return nullptr;
+    std::string fileNameString = fileName_native;
+    releaseNative(env, fileName_native, fileName, false);
+
+    // Read and parse the file
+    std::ifstream file(fileNameString.c_str(), std::ios::in | std::ios::binary);
+    if (!file)
+    {
+        throwIOException(env, "Could not open tuning database", fileNameString.c_str());
+        return nullptr;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::string text = contents.str();
+    JsonValue root;
+    JsonParser parser(text);
+    if (!parser.parse(root))
+    {
+        std::stringstream message;
+        message << "Invalid tuning database (" << parser.getError()
+            << " at offset " << parser.getPosition() << ")";
+        throwIOException(env, message.str().c_str(), fileNameString.c_str());
+        return nullptr;
+    }
+    std::vector<TuningEntry> entries;
+    int invalidIndex = toTuningEntries(root, entries);
+    if (invalidIndex >= 0)
+    {
+        std::stringstream message;
+        message << "Invalid tuning database (invalid entry " << invalidIndex << ")";
+        throwIOException(env, message.str().c_str(), fileNameString.c_str());
+        return nullptr;
+    }
+
+    // Apply all entries, and collect the names of the ones that
+    // have been applied successfully
+    std::vector<std::string> applied;
+    for (size_t i = 0; i < entries.size(); i++)
+    {
+        const TuningEntry &entry = entries[i];
+        std::vector<const char*> names;
+        std::vector<size_t> values;
+        for (TuningParameters::const_iterator it = entry.parameters.begin();
+            it != entry.parameters.end(); ++it)
+        {
+            names.push_back(it->first.c_str());
+            values.push_back(it->second);
+        }
+        CLBlastStatusCode result = CLBlastOverrideParameters(device_native,
+            entry.kernel.c_str(), (CLBlastPrecision)entry.precision,
+            names.size(), names.data(), values.data());
+        if (result != CLBlastSuccess)
+        {
+            Logger::log(LOG_ERROR, "Could not apply tuning parameters for %s with precision %d: %d\n",
+                entry.kernel.c_str(), entry.precision, (int)result);
+            continue;
+        }
+        recordTuningParameters(device_native, entry.kernel.c_str(),
+            (CLBlastPrecision)entry.precision, names.size(), names.data(), values.data());
+        std::stringstream name;
+        name << entry.kernel << "/" << entry.precision;
+        applied.push_back(name.str());
+    }
+
+    // Return the result
+    jclass String_Class = env->FindClass("java/lang/String");
+    if (String_Class == nullptr) return nullptr;
+    jobjectArray result = env->NewObjectArray((jsize)applied.size(), String_Class, nullptr);
+    if (result == nullptr) return nullptr;
+    for (size_t i = 0; i < applied.size(); i++)
+    {
+        jstring name = env->NewStringUTF(applied[i].c_str());
+        if (name == nullptr) return nullptr;
+        env->SetObjectArrayElement(result, (jsize)i, name);
+        env->DeleteLocalRef(name);
+    }
+    return result;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    exportTuningDatabaseNative
+* Signature: (Lorg/jocl/cl_device_id;Ljava/lang/String;)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlast_exportTuningDatabaseNative
+(JNIEnv *env, jclass UNUSED(cls), jobject device, jstring fileName)
+{
+    // Null-checks for non-primitive arguments
+    if (device == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'device' is null for exportTuningDatabase");
+        return;
+    }
+    if (fileName == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'fileName' is null for exportTuningDatabase");
+        return;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing exportTuningDatabase(device=%p, fileName=%p)\n",
+        device, fileName);
+
+    // Native variable declarations
+    cl_device_id device_native = nullptr;
+    char * fileName_native = nullptr;
+
+    // Obtain native variable values
+    if (!initNative(env, device, device_native, true)) return;
+    if (!initNative(env, fileName, fileName_native, true)) return;
+    std::string fileNameString = fileName_native;
+    releaseNative(env, fileName_native, fileName, false);
+
+    // Obtain a copy of the database of the device
+    TuningDatabase database;
+    {
+        std::lock_guard<std::mutex> lock(tuningDatabasesMutex);
+        std::map<cl_device_id, TuningDatabase>::const_iterator it = tuningDatabases.find(device_native);
+        if (it != tuningDatabases.end())
+        {
+            database = it->second;
+        }
+    }
+
+    // Write the database
+    std::stringstream stream;
+    stream << "{\n  \"entries\": [";
+    for (TuningDatabase::const_iterator it = database.begin(); it != database.end(); ++it)
+    {
+        stream << (it == database.begin() ? "\n" : ",\n");
+        stream << "    {\n      \"kernel\": ";
+        writeJsonString(stream, it->first.first);
+        stream << ",\n      \"precision\": " << it->first.second;
+        stream << ",\n      \"parameters\": {";
+        const TuningParameters &parameters = it->second;
+        for (TuningParameters::const_iterator p = parameters.begin(); p != parameters.end(); ++p)
+        {
+            stream << (p == parameters.begin() ? "\n        " : ",\n        ");
+            writeJsonString(stream, p->first);
+            stream << ": " << p->second;
+        }
+        stream << "\n      }\n    }";
+    }
+    stream << "\n  ]\n}\n";
+
+    std::ofstream file(fileNameString.c_str(), std::ios::out | std::ios::binary);
+    if (!file)
+    {
+        throwIOException(env, "Could not create tuning database", fileNameString.c_str());
+        return;
+    }
+    file << stream.str();
+    if (!file)
+    {
+        throwIOException(env, "Could not write tuning database", fileNameString.c_str());
+    }
+}
+
+/*
+* Class:     org_jocl_blast_CLBlast
+* Method:    getTuningParametersNative
+* Signature: (Lorg/jocl/cl_device_id;Ljava/lang/String;I)[Ljava/lang/Object;
+*/
+JNIEXPORT jobjectArray JNICALL Java_org_jocl_blast_CLBlast_getTuningParametersNative
+(JNIEnv *env, jclass UNUSED(cls), jobject device, jstring kernelName, jint precision)
+{
+    // Null-checks for non-primitive arguments
+    if (device == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'device' is null for getTuningParameters");
+        return nullptr;
+    }
+    if (kernelName == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'kernelName' is null for getTuningParameters");
+        return nullptr;
+    }
+
+    // Native variable declarations
+    cl_device_id device_native = nullptr;
+    char * kernelName_native = nullptr;
+
+    // Obtain native variable values
+    if (!initNative(env, device, device_native, true)) return nullptr;
+    if (!initNative(env, kernelName, kernelName_native, true)) return nullptr;
+    std::string kernelNameString = kernelName_native;
+    releaseNative(env, kernelName_native, kernelName, false);
+
+    // Obtain a copy of the recorded parameters
+    TuningParameters parameters;
+    {
+        std::lock_guard<std::mutex> lock(tuningDatabasesMutex);
+        std::map<cl_device_id, TuningDatabase>::const_iterator it = tuningDatabases.find(device_native);
+        if (it == tuningDatabases.end())
+        {
+            return nullptr;
+        }
+        TuningDatabase::const_iterator entry = it->second.find(std::make_pair(kernelNameString, (int)precision));
+        if (entry == it->second.end())
+        {
+            return nullptr;
+        }
+        parameters = entry->second;
+    }
+
+    // Return the names and values
+    jclass Object_Class = env->FindClass("java/lang/Object");
+    if (Object_Class == nullptr) return nullptr;
+    jclass String_Class = env->FindClass("java/lang/String");
+    if (String_Class == nullptr) return nullptr;
+    jobjectArray names = env->NewObjectArray((jsize)parameters.size(), String_Class, nullptr);
+    if (names == nullptr) return nullptr;
+    jlongArray values = env->NewLongArray((jsize)parameters.size());
+    if (values == nullptr) return nullptr;
+    jsize index = 0;
+    for (TuningParameters::const_iterator p = parameters.begin(); p != parameters.end(); ++p)
+    {
+        jstring name = env->NewStringUTF(p->first.c_str());
+        if (name == nullptr) return nullptr;
+        env->SetObjectArrayElement(names, index, name);
+        env->DeleteLocalRef(name);
+        jlong value = (jlong)p->second;
+        env->SetLongArrayRegion(values, index, 1, &value);
+        index++;
+    }
+    jobjectArray result = env->NewObjectArray(2, Object_Class, nullptr);
+    if (result == nullptr) return nullptr;
+    env->SetObjectArrayElement(result, 0, names);
+    env->SetObjectArrayElement(result, 1, values);
+    return result;
+}
@@ -0,0 +1,85 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlastUtils.hpp"
+
+#include <stdio.h>
+#include <vector>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+#include "PointerUtils.hpp"
+
+cl_int enqueueWaitList(JNIEnv *env, cl_command_queue *queue, jobjectArray waitList)
+{
+    if (waitList == nullptr)
+    {
+        return CL_SUCCESS;
+    }
+    jsize length = env->GetArrayLength(waitList);
+    if (length == 0)
+    {
+        return CL_SUCCESS;
+    }
+    std::vector<cl_event> events((size_t)length);
+    for (jsize i = 0; i < length; i++)
+    {
+        jobject event = env->GetObjectArrayElement(waitList, i);
+        if (event == nullptr)
+        {
+            ThrowByName(env, "java/lang/NullPointerException", "Element of 'waitList' is null");
+            return JOCL_BLAST_STATUS_INTERNAL_ERROR;
+        }
+        events[(size_t)i] = (cl_event)env->GetLongField(event, NativePointerObject_nativePointer);
+        env->DeleteLocalRef(event);
+    }
+    cl_int result = clEnqueueBarrierWithWaitList(*queue, (cl_uint)length, events.data(), nullptr);
+    if (result != CL_SUCCESS)
+    {
+        Logger::log(LOG_ERROR, "Could not enqueue barrier for wait list: %d\n", (int)result);
+    }
+    return result;
+}
+
+bool checkArrayLength(JNIEnv *env, jarray array, jlong required, const char *name, const char *function)
+{
+    if (array == nullptr)
+    {
+        return true;
+    }
+    jsize length = env->GetArrayLength(array);
+    if (required < 0 || (jlong)length < required)
+    {
+        char message[256];
+        snprintf(message, sizeof(message), "Parameter '%s' for %s has %ld elements, but %ld are required",
+            name, function, (long)length, (long)required);
+        ThrowByName(env, "java/lang/IllegalArgumentException", message);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,65 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef JOCL_BLAST_UTILS_HPP
+#define JOCL_BLAST_UTILS_HPP
+
+#include <jni.h>
+#include <CL/cl.h>
+
+// The status that is returned when a Java exception was thrown. This is
+// the value of CLBlast.JOCL_BLAST_STATUS_INTERNAL_ERROR on Java side.
+#define JOCL_BLAST_STATUS_INTERNAL_ERROR -32786
+
+// The Java VM, which is stored in JNI_OnLoad, so that native threads,
+// like the ones that execute event callbacks, can attach to it
+extern JavaVM *javaVM;
+
+/**
+* Enqueue a barrier into the given queue that waits for all events of
+* the given Java array of cl_event objects. If the array is nullptr or
+* empty, then nothing is enqueued. All elements are checked before the
+* barrier is enqueued. Callers convert and validate all other arguments
+* first, and call this directly before the CLBlast function, so that no
+* barrier is left in the queue when the call is not made.
+*
+* Returns CL_SUCCESS, the error code of clEnqueueBarrierWithWaitList,
+* or JOCL_BLAST_STATUS_INTERNAL_ERROR if a Java exception was thrown
+* because an element of the array was null.
+*/
+cl_int enqueueWaitList(JNIEnv *env, cl_command_queue *queue, jobjectArray waitList);
+
+/**
+* Make sure that the given Java array has at least the given number of
+* elements. If this is not the case, then an IllegalArgumentException
+* is thrown, mentioning the given parameter and function name, and
+* false is returned. A null array is accepted here, because it is
+* reported by the null checks of the routine call.
+*/
+bool checkArrayLength(JNIEnv *env, jarray array, jlong required, const char *name, const char *function);
+
+#endif
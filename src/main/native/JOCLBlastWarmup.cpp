@@ -0,0 +1,907 @@
+/*
+* JOCLBlast - Java bindings for CLBlast
+*
+* Copyright (c) 2016-2018 Marco Hutter - http://www.jocl.org
+*
+* Permission is hereby granted, free of charge, to any person
+* obtaining a copy of this software and associated documentation
+* files (the "Software"), to deal in the Software without
+* restriction, including without limitation the rights to use,
+* copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the
+* Software is furnished to do so, subject to the following
+* conditions:
+*
+* The above copyright notice and this permission notice shall be
+* included in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+* OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+* HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+* WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+* FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+* OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#include "JOCLBlastWarmup.hpp"
+#include "JOCLBlastKernelCache.hpp"
+
+#include <stdio.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+
+#include "Logger.hpp"
+#include "JOCLCommon.hpp"
+#include "JNIUtils.hpp"
+#include "PointerUtils.hpp"
+#include "CLJNIUtils.hpp"
+#include "ConversionsCL.hpp"
+#include <clblast_c.h>
+#include <clblast_half.h>
+
+// The vector length and matrix size that are used for the warmup calls.
+// The kernels are compiled for the device and precision independent of
+// the problem size, so a tiny problem is sufficient.
+#define WARMUP_N 8
+
+// The size of each of the warmup buffers, in bytes. This is sufficient
+// for a WARMUP_N x WARMUP_N matrix of complex double values.
+#define WARMUP_BUFFER_SIZE (WARMUP_N * WARMUP_N * 16)
+
+// The largest timeout for waiting for a warmup, in milliseconds. Larger
+// timeouts wait until the warmup is done, because they could overflow 
+// the computation of the time point in condition_variable::wait_for.
+#define WARMUP_MAX_TIMEOUT_MS (1000LL * 60 * 60 * 24 * 365)
+
+// The scalar values that are passed to the warmup calls
+static const cl_float2 complexOne_float = {{ 1.0f, 0.0f }};
+static const cl_float2 complexZero_float = {{ 0.0f, 0.0f }};
+static const cl_double2 complexOne_double = {{ 1.0, 0.0 }};
+static const cl_double2 complexZero_double = {{ 0.0, 0.0 }};
+static const cl_half halfOne = FloatToHalf(1.0f);
+static const cl_half halfZero = FloatToHalf(0.0f);
+
+/**
+* The scratch buffers and the queue that are used for the warmup calls
+*/
+struct WarmupBuffers
+{
+    cl_command_queue *queue;
+    cl_mem a;
+    cl_mem b;
+    cl_mem c;
+    cl_mem x;
+    cl_mem y;
+    cl_mem s;
+};
+
+static CLBlastStatusCode warmup_swap(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSswap(WARMUP_N, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDswap(WARMUP_N, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCswap(WARMUP_N, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZswap(WARMUP_N, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHswap(WARMUP_N, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_scal(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSscal(WARMUP_N, 1.0f, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDscal(WARMUP_N, 1.0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCscal(WARMUP_N, complexOne_float, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZscal(WARMUP_N, complexOne_double, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHscal(WARMUP_N, halfOne, b.x, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_copy(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastScopy(WARMUP_N, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDcopy(WARMUP_N, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCcopy(WARMUP_N, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZcopy(WARMUP_N, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHcopy(WARMUP_N, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_axpy(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSaxpy(WARMUP_N, 1.0f, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDaxpy(WARMUP_N, 1.0, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCaxpy(WARMUP_N, complexOne_float, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZaxpy(WARMUP_N, complexOne_double, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHaxpy(WARMUP_N, halfOne, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_dot(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSdot(WARMUP_N, b.s, 0, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDdot(WARMUP_N, b.s, 0, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCdotu(WARMUP_N, b.s, 0, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZdotu(WARMUP_N, b.s, 0, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHdot(WARMUP_N, b.s, 0, b.x, 0, 1, b.y, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_nrm2(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSnrm2(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDnrm2(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastScnrm2(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastDznrm2(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHnrm2(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_asum(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSasum(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDasum(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastScasum(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastDzasum(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHasum(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_amax(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastiSamax(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastiDamax(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastiCamax(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastiZamax(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastiHamax(WARMUP_N, b.s, 0, b.x, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_gemv(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSgemv(CLBlastLayoutRowMajor, CLBlastTransposeNo, WARMUP_N, WARMUP_N, 1.0f, b.a, 0, WARMUP_N, b.x, 0, 1, 0.0f, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDgemv(CLBlastLayoutRowMajor, CLBlastTransposeNo, WARMUP_N, WARMUP_N, 1.0, b.a, 0, WARMUP_N, b.x, 0, 1, 0.0, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCgemv(CLBlastLayoutRowMajor, CLBlastTransposeNo, WARMUP_N, WARMUP_N, complexOne_float, b.a, 0, WARMUP_N, b.x, 0, 1, complexZero_float, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZgemv(CLBlastLayoutRowMajor, CLBlastTransposeNo, WARMUP_N, WARMUP_N, complexOne_double, b.a, 0, WARMUP_N, b.x, 0, 1, complexZero_double, b.y, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHgemv(CLBlastLayoutRowMajor, CLBlastTransposeNo, WARMUP_N, WARMUP_N, halfOne, b.a, 0, WARMUP_N, b.x, 0, 1, halfZero, b.y, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_ger(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSger(CLBlastLayoutRowMajor, WARMUP_N, WARMUP_N, 1.0f, b.x, 0, 1, b.y, 0, 1, b.a, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDger(CLBlastLayoutRowMajor, WARMUP_N, WARMUP_N, 1.0, b.x, 0, 1, b.y, 0, 1, b.a, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCgeru(CLBlastLayoutRowMajor, WARMUP_N, WARMUP_N, complexOne_float, b.x, 0, 1, b.y, 0, 1, b.a, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZgeru(CLBlastLayoutRowMajor, WARMUP_N, WARMUP_N, complexOne_double, b.x, 0, 1, b.y, 0, 1, b.a, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHger(CLBlastLayoutRowMajor, WARMUP_N, WARMUP_N, halfOne, b.x, 0, 1, b.y, 0, 1, b.a, 0, WARMUP_N, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_gemm(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSgemm(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, 1.0f, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, 0.0f, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDgemm(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, 1.0, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, 0.0, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCgemm(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, complexOne_float, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, complexZero_float, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZgemm(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, complexOne_double, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, complexZero_double, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHgemm(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, halfOne, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, halfZero, b.c, 0, WARMUP_N, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_symm(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSsymm(CLBlastLayoutRowMajor, CLBlastSideLeft, CLBlastTriangleUpper, WARMUP_N, WARMUP_N, 1.0f, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, 0.0f, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDsymm(CLBlastLayoutRowMajor, CLBlastSideLeft, CLBlastTriangleUpper, WARMUP_N, WARMUP_N, 1.0, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, 0.0, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCsymm(CLBlastLayoutRowMajor, CLBlastSideLeft, CLBlastTriangleUpper, WARMUP_N, WARMUP_N, complexOne_float, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, complexZero_float, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZsymm(CLBlastLayoutRowMajor, CLBlastSideLeft, CLBlastTriangleUpper, WARMUP_N, WARMUP_N, complexOne_double, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, complexZero_double, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHsymm(CLBlastLayoutRowMajor, CLBlastSideLeft, CLBlastTriangleUpper, WARMUP_N, WARMUP_N, halfOne, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, halfZero, b.c, 0, WARMUP_N, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_syrk(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSsyrk(CLBlastLayoutRowMajor, CLBlastTriangleUpper, CLBlastTransposeNo, WARMUP_N, WARMUP_N, 1.0f, b.a, 0, WARMUP_N, 0.0f, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDsyrk(CLBlastLayoutRowMajor, CLBlastTriangleUpper, CLBlastTransposeNo, WARMUP_N, WARMUP_N, 1.0, b.a, 0, WARMUP_N, 0.0, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCsyrk(CLBlastLayoutRowMajor, CLBlastTriangleUpper, CLBlastTransposeNo, WARMUP_N, WARMUP_N, complexOne_float, b.a, 0, WARMUP_N, complexZero_float, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZsyrk(CLBlastLayoutRowMajor, CLBlastTriangleUpper, CLBlastTransposeNo, WARMUP_N, WARMUP_N, complexOne_double, b.a, 0, WARMUP_N, complexZero_double, b.c, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHsyrk(CLBlastLayoutRowMajor, CLBlastTriangleUpper, CLBlastTransposeNo, WARMUP_N, WARMUP_N, halfOne, b.a, 0, WARMUP_N, halfZero, b.c, 0, WARMUP_N, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_trsm(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastStrsm(CLBlastLayoutRowMajor, CLBlastSideLeft, CLBlastTriangleUpper, CLBlastTransposeNo, CLBlastDiagonalUnit, WARMUP_N, WARMUP_N, 1.0f, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDtrsm(CLBlastLayoutRowMajor, CLBlastSideLeft, CLBlastTriangleUpper, CLBlastTransposeNo, CLBlastDiagonalUnit, WARMUP_N, WARMUP_N, 1.0, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCtrsm(CLBlastLayoutRowMajor, CLBlastSideLeft, CLBlastTriangleUpper, CLBlastTransposeNo, CLBlastDiagonalUnit, WARMUP_N, WARMUP_N, complexOne_float, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZtrsm(CLBlastLayoutRowMajor, CLBlastSideLeft, CLBlastTriangleUpper, CLBlastTransposeNo, CLBlastDiagonalUnit, WARMUP_N, WARMUP_N, complexOne_double, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_had(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastShad(WARMUP_N, 1.0f, b.x, 0, 1, b.y, 0, 1, 0.0f, b.c, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDhad(WARMUP_N, 1.0, b.x, 0, 1, b.y, 0, 1, 0.0, b.c, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastChad(WARMUP_N, complexOne_float, b.x, 0, 1, b.y, 0, 1, complexZero_float, b.c, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZhad(WARMUP_N, complexOne_double, b.x, 0, 1, b.y, 0, 1, complexZero_double, b.c, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHhad(WARMUP_N, halfOne, b.x, 0, 1, b.y, 0, 1, halfZero, b.c, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_omatcopy(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSomatcopy(CLBlastLayoutRowMajor, CLBlastTransposeNo, WARMUP_N, WARMUP_N, 1.0f, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDomatcopy(CLBlastLayoutRowMajor, CLBlastTransposeNo, WARMUP_N, WARMUP_N, 1.0, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastComatcopy(CLBlastLayoutRowMajor, CLBlastTransposeNo, WARMUP_N, WARMUP_N, complexOne_float, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZomatcopy(CLBlastLayoutRowMajor, CLBlastTransposeNo, WARMUP_N, WARMUP_N, complexOne_double, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHomatcopy(CLBlastLayoutRowMajor, CLBlastTransposeNo, WARMUP_N, WARMUP_N, halfOne, b.a, 0, WARMUP_N, b.b, 0, WARMUP_N, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_axpyBatched(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    const size_t offset = 0;
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+        {
+            const float alpha = 1.0f;
+            return CLBlastSaxpyBatched(WARMUP_N, &alpha, b.x, &offset, 1, b.y, &offset, 1, 1, b.queue, nullptr);
+        }
+        case CLBlastPrecisionDouble:
+        {
+            const double alpha = 1.0;
+            return CLBlastDaxpyBatched(WARMUP_N, &alpha, b.x, &offset, 1, b.y, &offset, 1, 1, b.queue, nullptr);
+        }
+        case CLBlastPrecisionComplexSingle:
+        {
+            const cl_float2 alpha = complexOne_float;
+            return CLBlastCaxpyBatched(WARMUP_N, &alpha, b.x, &offset, 1, b.y, &offset, 1, 1, b.queue, nullptr);
+        }
+        case CLBlastPrecisionComplexDouble:
+        {
+            const cl_double2 alpha = complexOne_double;
+            return CLBlastZaxpyBatched(WARMUP_N, &alpha, b.x, &offset, 1, b.y, &offset, 1, 1, b.queue, nullptr);
+        }
+        case CLBlastPrecisionHalf:
+        {
+            const cl_half alpha = halfOne;
+            return CLBlastHaxpyBatched(WARMUP_N, &alpha, b.x, &offset, 1, b.y, &offset, 1, 1, b.queue, nullptr);
+        }
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_gemmBatched(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    const size_t offset = 0;
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+        {
+            const float alpha = 1.0f;
+            const float beta = 0.0f;
+            return CLBlastSgemmBatched(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, &alpha, b.a, &offset, WARMUP_N, b.b, &offset, WARMUP_N, &beta, b.c, &offset, WARMUP_N, 1, b.queue, nullptr);
+        }
+        case CLBlastPrecisionDouble:
+        {
+            const double alpha = 1.0;
+            const double beta = 0.0;
+            return CLBlastDgemmBatched(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, &alpha, b.a, &offset, WARMUP_N, b.b, &offset, WARMUP_N, &beta, b.c, &offset, WARMUP_N, 1, b.queue, nullptr);
+        }
+        case CLBlastPrecisionComplexSingle:
+        {
+            const cl_float2 alpha = complexOne_float;
+            const cl_float2 beta = complexZero_float;
+            return CLBlastCgemmBatched(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, &alpha, b.a, &offset, WARMUP_N, b.b, &offset, WARMUP_N, &beta, b.c, &offset, WARMUP_N, 1, b.queue, nullptr);
+        }
+        case CLBlastPrecisionComplexDouble:
+        {
+            const cl_double2 alpha = complexOne_double;
+            const cl_double2 beta = complexZero_double;
+            return CLBlastZgemmBatched(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, &alpha, b.a, &offset, WARMUP_N, b.b, &offset, WARMUP_N, &beta, b.c, &offset, WARMUP_N, 1, b.queue, nullptr);
+        }
+        case CLBlastPrecisionHalf:
+        {
+            const cl_half alpha = halfOne;
+            const cl_half beta = halfZero;
+            return CLBlastHgemmBatched(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, &alpha, b.a, &offset, WARMUP_N, b.b, &offset, WARMUP_N, &beta, b.c, &offset, WARMUP_N, 1, b.queue, nullptr);
+        }
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+static CLBlastStatusCode warmup_gemmStridedBatched(CLBlastPrecision precision, const WarmupBuffers &b)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionSingle:
+            return CLBlastSgemmStridedBatched(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, 1.0f, b.a, 0, WARMUP_N, 0, b.b, 0, WARMUP_N, 0, 0.0f, b.c, 0, WARMUP_N, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionDouble:
+            return CLBlastDgemmStridedBatched(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, 1.0, b.a, 0, WARMUP_N, 0, b.b, 0, WARMUP_N, 0, 0.0, b.c, 0, WARMUP_N, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexSingle:
+            return CLBlastCgemmStridedBatched(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, complexOne_float, b.a, 0, WARMUP_N, 0, b.b, 0, WARMUP_N, 0, complexZero_float, b.c, 0, WARMUP_N, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionComplexDouble:
+            return CLBlastZgemmStridedBatched(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, complexOne_double, b.a, 0, WARMUP_N, 0, b.b, 0, WARMUP_N, 0, complexZero_double, b.c, 0, WARMUP_N, 0, 1, b.queue, nullptr);
+        case CLBlastPrecisionHalf:
+            return CLBlastHgemmStridedBatched(CLBlastLayoutRowMajor, CLBlastTransposeNo, CLBlastTransposeNo, WARMUP_N, WARMUP_N, WARMUP_N, halfOne, b.a, 0, WARMUP_N, 0, b.b, 0, WARMUP_N, 0, halfZero, b.c, 0, WARMUP_N, 0, 1, b.queue, nullptr);
+        default:
+            return CLBlastNotImplemented;
+    }
+}
+
+/**
+* A routine that can be warmed up
+*/
+struct WarmupRoutine
+{
+    // The name of the routine, without the precision prefix
+    const char *name;
+
+    // The prefixes of the precisions that are supported
+    const char *precisions;
+
+    // The function that performs a single, tiny call of the routine
+    CLBlastStatusCode (*function)(CLBlastPrecision precision, const WarmupBuffers &b);
+};
+
+// The routines that can be warmed up
+static const WarmupRoutine warmupRoutines[] =
+{
+    { "swap", "SDCZH", warmup_swap },
+    { "scal", "SDCZH", warmup_scal },
+    { "copy", "SDCZH", warmup_copy },
+    { "axpy", "SDCZH", warmup_axpy },
+    { "dot", "SDCZH", warmup_dot },
+    { "nrm2", "SDCZH", warmup_nrm2 },
+    { "asum", "SDCZH", warmup_asum },
+    { "amax", "SDCZH", warmup_amax },
+    { "gemv", "SDCZH", warmup_gemv },
+    { "ger", "SDCZH", warmup_ger },
+    { "gemm", "SDCZH", warmup_gemm },
+    { "symm", "SDCZH", warmup_symm },
+    { "syrk", "SDCZH", warmup_syrk },
+    { "trsm", "SDCZ", warmup_trsm },
+    { "had", "SDCZH", warmup_had },
+    { "omatcopy", "SDCZH", warmup_omatcopy },
+    { "axpyBatched", "SDCZH", warmup_axpyBatched },
+    { "gemmBatched", "SDCZH", warmup_gemmBatched },
+    { "gemmStridedBatched", "SDCZH", warmup_gemmStridedBatched },
+};
+
+/**
+* Returns the routine with the given name, or nullptr if there is none
+*/
+static const WarmupRoutine* findWarmupRoutine(const char *name)
+{
+    for (size_t i = 0; i < sizeof(warmupRoutines) / sizeof(warmupRoutines[0]); i++)
+    {
+        if (strcmp(warmupRoutines[i].name, name) == 0)
+        {
+            return &warmupRoutines[i];
+        }
+    }
+    return nullptr;
+}
+
+/**
+* Returns the prefix character of the given precision, or 0 if the
+* precision is not valid
+*/
+static char precisionPrefix(jint precision)
+{
+    switch (precision)
+    {
+        case CLBlastPrecisionHalf: return 'H';
+        case CLBlastPrecisionSingle: return 'S';
+        case CLBlastPrecisionDouble: return 'D';
+        case CLBlastPrecisionComplexSingle: return 'C';
+        case CLBlastPrecisionComplexDouble: return 'Z';
+    }
+    return 0;
+}
+
+/**
+* A single routine and precision that should be warmed up
+*/
+struct WarmupItem
+{
+    const WarmupRoutine *routine;
+    CLBlastPrecision precision;
+};
+
+/**
+* The state of a warmup that is executed on a background thread. This
+* is shared between the thread and the Java object, and deleted when
+* both of them have released it.
+*/
+struct WarmupTask
+{
+    WarmupTask() : completed(0), cancelled(false), done(false), status(CLBlastSuccess) {}
+
+    cl_context context;
+    cl_device_id device;
+    std::vector<WarmupItem> items;
+
+    std::atomic<jint> completed;
+    std::atomic<bool> cancelled;
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool done;
+    CLBlastStatusCode status;
+
+    /**
+    * Mark this task as done, with the given status, and notify all
+    * threads that are waiting for it
+    */
+    void finish(CLBlastStatusCode result)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (status == CLBlastSuccess)
+        {
+            status = result;
+        }
+        done = true;
+        condition.notify_all();
+    }
+};
+
+/**
+* Create the command queue for the warmup calls. This uses
+* clCreateCommandQueueWithProperties when the device supports OpenCL 2.0.
+* The deprecated clCreateCommandQueue is still used for older devices,
+* because calling the 2.0 function on a 1.x platform is not supported,
+* and the OpenCL library on MacOS does not offer it at all.
+*/
+static cl_command_queue createWarmupQueue(cl_context context, cl_device_id device, cl_int *error)
+{
+#if defined(CL_VERSION_2_0) && !defined(__APPLE__)
+    char version[256] = { 0 };
+    int major = 0;
+    int minor = 0;
+    if (clGetDeviceInfo(device, CL_DEVICE_VERSION, sizeof(version) - 1, version, nullptr) == CL_SUCCESS &&
+        sscanf(version, "OpenCL %d.%d", &major, &minor) == 2 && major >= 2)
+    {
+        return clCreateCommandQueueWithProperties(context, device, nullptr, error);
+    }
+#endif
+    return clCreateCommandQueue(context, device, 0, error);
+}
+
+/**
+* Execute the given warmup task. This is the body of the background thread.
+* The first non-success status is stored as the status of the task, but
+* the remaining items are still executed.
+*/
+static void runWarmup(std::shared_ptr<WarmupTask> task)
+{
+    cl_int error = CL_SUCCESS;
+    cl_command_queue queue = createWarmupQueue(task->context, task->device, &error);
+    if (error != CL_SUCCESS)
+    {
+        Logger::log(LOG_ERROR, "Could not create queue for warmup: %d\n", (int)error);
+        clReleaseContext(task->context);
+        task->finish((CLBlastStatusCode)error);
+        return;
+    }
+    cl_mem mems[6] = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr };
+    for (int i = 0; i < 6 && error == CL_SUCCESS; i++)
+    {
+        mems[i] = clCreateBuffer(task->context, CL_MEM_READ_WRITE, WARMUP_BUFFER_SIZE, nullptr, &error);
+    }
+    CLBlastStatusCode status = (CLBlastStatusCode)error;
+    if (error == CL_SUCCESS)
+    {
+        WarmupBuffers buffers = { &queue, mems[0], mems[1], mems[2], mems[3], mems[4], mems[5] };
+        for (size_t i = 0; i < task->items.size(); i++)
+        {
+            if (task->cancelled.load())
+            {
+                break;
+            }
+            const WarmupItem &item = task->items[i];
+            CLBlastStatusCode result = item.routine->function(item.precision, buffers);
+            clFinish(queue);
+            if (result != CLBlastSuccess)
+            {
+                Logger::log(LOG_ERROR, "Warmup of %s with precision %d failed: %d\n",
+                    item.routine->name, (int)item.precision, (int)result);
+                if (status == CLBlastSuccess)
+                {
+                    status = result;
+                }
+            }
+            task->completed.fetch_add(1);
+        }
+    }
+    else
+    {
+        Logger::log(LOG_ERROR, "Could not create buffers for warmup: %d\n", (int)error);
+    }
+    for (int i = 0; i < 6; i++)
+    {
+        if (mems[i] != nullptr)
+        {
+            clReleaseMemObject(mems[i]);
+        }
+    }
+    clReleaseCommandQueue(queue);
+    clReleaseContext(task->context);
+    task->finish(status);
+}
+
+/**
+* Start the background thread for the given task. The context is
+* retained until the thread has finished. Returns whether the thread
+* was started.
+*/
+static bool startWarmupThread(std::shared_ptr<WarmupTask> task)
+{
+    clRetainContext(task->context);
+    try
+    {
+        std::thread thread(runWarmup, task);
+        thread.detach();
+    }
+    catch (const std::system_error&)
+    {
+        clReleaseContext(task->context);
+        return false;
+    }
+    return true;
+}
+
+bool canWarmup(const std::string &operation, CLBlastPrecision precision)
+{
+    const WarmupRoutine *warmupRoutine = findWarmupRoutine(operation.c_str());
+    char prefix = precisionPrefix(precision);
+    return warmupRoutine != nullptr && prefix != 0 && strchr(warmupRoutine->precisions, prefix) != nullptr;
+}
+
+bool startBackgroundWarmup(const WarmupRequest &request)
+{
+    std::shared_ptr<WarmupTask> task = std::make_shared<WarmupTask>();
+    task->context = request.context;
+    task->device = request.device;
+    for (size_t i = 0; i < request.operations.size(); i++)
+    {
+        if (!canWarmup(request.operations[i], request.precisions[i]))
+        {
+            continue;
+        }
+        const WarmupRoutine *warmupRoutine = findWarmupRoutine(request.operations[i].c_str());
+        WarmupItem item = { warmupRoutine, request.precisions[i] };
+        task->items.push_back(item);
+    }
+    if (task->items.empty())
+    {
+        return true;
+    }
+    return startWarmupThread(task);
+}
+
+/**
+* Returns the task for the given handle
+*/
+static std::shared_ptr<WarmupTask>& getTask(jlong handle)
+{
+    return *((std::shared_ptr<WarmupTask>*)handle);
+}
+
+
+
+/*
+* Class:     org_jocl_blast_CLBlastWarmup
+* Method:    startNative
+* Signature: (Lorg/jocl/cl_context;Lorg/jocl/cl_device_id;[Ljava/lang/String;[I)J
+*/
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastWarmup_startNative
+(JNIEnv *env, jclass UNUSED(cls), jobject context, jobject device, jobjectArray routines, jintArray precisions)
+{
+    // Null-checks for non-primitive arguments
+    if (context == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'context' is null for CLBlastWarmup");
+        return 0;
+    }
+    if (device == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'device' is null for CLBlastWarmup");
+        return 0;
+    }
+    if (routines == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'routines' is null for CLBlastWarmup");
+        return 0;
+    }
+    if (precisions == nullptr)
+    {
+        ThrowByName(env, "java/lang/NullPointerException", "Parameter 'precisions' is null for CLBlastWarmup");
+        return 0;
+    }
+
+    // Log message
+    Logger::log(LOG_TRACE, "Executing CLBlastWarmup(context=%p, device=%p, routines=%p, precisions=%p)\n",
+        context, device, routines, precisions);
+
+    // Native variable declarations
+    std::shared_ptr<WarmupTask> task = std::make_shared<WarmupTask>();
+
+    // Obtain native variable values
+    task->context = (cl_context)env->GetLongField(context, NativePointerObject_nativePointer);
+    if (!initNative(env, device, task->device, true)) return 0;
+    jsize precisionsLength = env->GetArrayLength(precisions);
+    std::vector<jint> precisionValues((size_t)precisionsLength);
+    env->GetIntArrayRegion(precisions, 0, precisionsLength, precisionValues.data());
+    jsize routinesLength = env->GetArrayLength(routines);
+    for (jsize i = 0; i < routinesLength; i++)
+    {
+        jstring routine = (jstring)env->GetObjectArrayElement(routines, i);
+        if (routine == nullptr)
+        {
+            ThrowByName(env, "java/lang/NullPointerException", "Element of 'routines' is null for CLBlastWarmup");
+            return 0;
+        }
+        std::string name;
+        char *routine_native = nullptr;
+        if (!initNative(env, routine, routine_native, true)) return 0;
+        name = routine_native;
+        releaseNative(env, routine_native, routine, false);
+        env->DeleteLocalRef(routine);
+
+        const WarmupRoutine *warmupRoutine = findWarmupRoutine(name.c_str());
+        if (warmupRoutine == nullptr)
+        {
+            std::string message = "Unknown routine for CLBlastWarmup: " + name;
+            ThrowByName(env, "java/lang/IllegalArgumentException", message.c_str());
+            return 0;
+        }
+        for (size_t j = 0; j < precisionValues.size(); j++)
+        {
+            char prefix = precisionPrefix(precisionValues[j]);
+            if (prefix == 0 || strchr(warmupRoutine->precisions, prefix) == nullptr)
+            {
+                std::string message = "Unsupported precision for CLBlastWarmup of " + name;
+                ThrowByName(env, "java/lang/IllegalArgumentException", message.c_str());
+                return 0;
+            }
+            WarmupItem item = { warmupRoutine, (CLBlastPrecision)precisionValues[j] };
+            task->items.push_back(item);
+        }
+    }
+
+    if (!startWarmupThread(task))
+    {
+        ThrowByName(env, "java/lang/IllegalStateException", "Could not start thread for CLBlastWarmup");
+        return 0;
+    }
+    return (jlong)(new std::shared_ptr<WarmupTask>(task));
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastWarmup
+* Method:    getTotalNative
+* Signature: (J)I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastWarmup_getTotalNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle)
+{
+    return (jint)getTask(handle)->items.size();
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastWarmup
+* Method:    getCompletedNative
+* Signature: (J)I
+*/
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastWarmup_getCompletedNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle)
+{
+    return getTask(handle)->completed.load();
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastWarmup
+* Method:    cancelNative
+* Signature: (J)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastWarmup_cancelNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle)
+{
+    getTask(handle)->cancelled.store(true);
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastWarmup
+* Method:    waitNative
+* Signature: (JJ[I)Z
+*/
+JNIEXPORT jboolean JNICALL Java_org_jocl_blast_CLBlastWarmup_waitNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle, jlong timeoutMs, jintArray status)
+{
+    // A negative timeout waits until the task is done. A timeout of 0
+    // only checks whether the task is done.
+    std::shared_ptr<WarmupTask> task = getTask(handle);
+    std::unique_lock<std::mutex> lock(task->mutex);
+    if (timeoutMs < 0 || timeoutMs > WARMUP_MAX_TIMEOUT_MS)
+    {
+        task->condition.wait(lock, [&task] { return task->done; });
+    }
+    else
+    {
+        task->condition.wait_for(lock, std::chrono::milliseconds(timeoutMs),
+            [&task] { return task->done; });
+    }
+    if (!task->done)
+    {
+        return JNI_FALSE;
+    }
+    if (status != nullptr)
+    {
+        jint result = (jint)task->status;
+        env->SetIntArrayRegion(status, 0, 1, &result);
+    }
+    return JNI_TRUE;
+}
+
+/*
+* Class:     org_jocl_blast_CLBlastWarmup
+* Method:    releaseNative
+* Signature: (J)V
+*/
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastWarmup_releaseNative
+(JNIEnv *env, jclass UNUSED(cls), jlong handle)
+{
+    delete ((std::shared_ptr<WarmupTask>*)handle);
+}
@@ -0,0 +1,88 @@
+/*
+ * JOCLBlast - Java bindings for CLBlast
+ *
+ * Copyright (c) 2015-2018 Marco Hutter - http://www.jocl.org
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/* DO NOT EDIT THIS FILE - it is machine generated */
+#include <jni.h>
+/* Header for class org_jocl_blast_CLBlastWarmup */
+
+#ifndef _Included_org_jocl_blast_CLBlastWarmup
+#define _Included_org_jocl_blast_CLBlastWarmup
+#ifdef __cplusplus
+extern "C" {
+#endif
+/*
+ * Class:     org_jocl_blast_CLBlastWarmup
+ * Method:    startNative
+ * Signature: (Lorg/jocl/cl_context;Lorg/jocl/cl_device_id;[Ljava/lang/String;[I)J
+ */
+JNIEXPORT jlong JNICALL Java_org_jocl_blast_CLBlastWarmup_startNative
+  (JNIEnv *, jclass, jobject, jobject, jobjectArray, jintArray);
+
+/*
+ * Class:     org_jocl_blast_CLBlastWarmup
+ * Method:    getTotalNative
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastWarmup_getTotalNative
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastWarmup
+ * Method:    getCompletedNative
+ * Signature: (J)I
+ */
+JNIEXPORT jint JNICALL Java_org_jocl_blast_CLBlastWarmup_getCompletedNative
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastWarmup
+ * Method:    cancelNative
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastWarmup_cancelNative
+  (JNIEnv *, jclass, jlong);
+
+/*
+ * Class:     org_jocl_blast_CLBlastWarmup
+ * Method:    waitNative
+ * Signature: (JJ[I)Z
+ */
+JNIEXPORT jboolean JNICALL Java_org_jocl_blast_CLBlastWarmup_waitNative
+  (JNIEnv *, jclass, jlong, jlong, jintArray);
+
+/*
+ * Class:     org_jocl_blast_CLBlastWarmup
+ * Method:    releaseNative
+ * Signature: (J)V
+ */
+JNIEXPORT void JNICALL Java_org_jocl_blast_CLBlastWarmup_releaseNative
+  (JNIEnv *, jclass, jlong);
+
+#ifdef __cplusplus
+}
+#endif
+#endif
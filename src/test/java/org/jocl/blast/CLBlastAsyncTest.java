@@ -0,0 +1,45 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+
+import java.util.concurrent.CompletableFuture;
+
+import org.jocl.CL;
+import org.junit.Test;
+
+/**
+ * Tests for the completion of the futures of the CLBlastAsync
+ */
+public class CLBlastAsyncTest
+{
+    @Test
+    public void testFailedEnqueueCompletesWithStatus()
+    {
+        CompletableFuture<Integer> future = CLBlastAsync.submit(null,
+            event -> CLBlastStatusCode.CLBlastInvalidValue);
+        assertTrue(future.isDone());
+        assertEquals(CLBlastStatusCode.CLBlastInvalidValue,
+            (int)future.getNow(null));
+    }
+
+    @Test
+    public void testExceptionCompletesExceptionally()
+    {
+        CompletableFuture<Integer> future = CLBlastAsync.submit(null,
+            event -> { throw new IllegalStateException(); });
+        assertTrue(future.isCompletedExceptionally());
+    }
+
+    @Test
+    public void testCompleted()
+    {
+        CompletableFuture<Integer> success = new CompletableFuture<>();
+        CLBlastAsync.completed(success, CL.CL_COMPLETE);
+        assertEquals(CLBlastStatusCode.CLBlastSuccess, (int)success.getNow(null));
+
+        CompletableFuture<Integer> failure = new CompletableFuture<>();
+        CLBlastAsync.completed(failure, CL.CL_OUT_OF_RESOURCES);
+        assertTrue(failure.isCompletedExceptionally());
+    }
+}
@@ -0,0 +1,63 @@
+package org.jocl.blast;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_mem;
+import org.junit.Test;
+
+/**
+ * Tests for the argument checks of the batched GEMV, TRSV and GER 
+ */
+public class CLBlastBatchedTest
+{
+    private static final int ROW_MAJOR = CLBlastLayout.CLBlastLayoutRowMajor;
+    private static final int NO = CLBlastTranspose.CLBlastTransposeNo;
+    private static final int UPPER = CLBlastTriangle.CLBlastTriangleUpper;
+    private static final int NON_UNIT = CLBlastDiagonal.CLBlastDiagonalNonUnit;
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testGemvBatchedTooFewOffsets()
+    {
+        CLBlast.CLBlastSgemvBatched(ROW_MAJOR, NO, 4, 4, 
+            new float[3], new cl_mem(), new long[2], 4, 
+            new cl_mem(), new long[3], 1, 
+            new float[3], new cl_mem(), new long[3], 1, 
+            3, new cl_command_queue(), null);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testGemvBatchedNegativeCount()
+    {
+        CLBlast.CLBlastSgemvBatched(ROW_MAJOR, NO, 4, 4, 
+            new float[1], new cl_mem(), new long[1], 4, 
+            new cl_mem(), new long[1], 1, 
+            new float[1], new cl_mem(), new long[1], 1, 
+            -1, new cl_command_queue(), null);
+    }
+
+    @Test(expected = NullPointerException.class)
+    public void testGemvStridedBatchedNullQueue()
+    {
+        CLBlast.CLBlastSgemvStridedBatched(ROW_MAJOR, NO, 4, 4, 
+            1.0f, new cl_mem(), 0, 4, 16, 
+            new cl_mem(), 0, 1, 4, 
+            0.0f, new cl_mem(), 0, 1, 4, 
+            3, null, null);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testTrsvBatchedTooFewOffsets()
+    {
+        CLBlast.CLBlastStrsvBatched(ROW_MAJOR, UPPER, NO, NON_UNIT, 4, 
+            new cl_mem(), new long[3], 4, new cl_mem(), new long[2], 1, 
+            3, new cl_command_queue(), null);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testGerBatchedTooFewAlphas()
+    {
+        CLBlast.CLBlastSgerBatched(ROW_MAJOR, 4, 4, new float[2], 
+            new cl_mem(), new long[3], 1, new cl_mem(), new long[3], 1, 
+            new cl_mem(), new long[3], 4, 
+            3, new cl_command_queue(), null);
+    }
+}
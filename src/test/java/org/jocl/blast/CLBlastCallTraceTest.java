@@ -0,0 +1,110 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.IOException;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+
+import org.junit.Test;
+
+/**
+ * Tests for the parsing of the records in the CLBlastCallTrace
+ */
+public class CLBlastCallTraceTest
+{
+    private static byte[] createRecords()
+    {
+        ByteBuffer bb = ByteBuffer.allocate(256).order(ByteOrder.nativeOrder());
+
+        // A record with a size, a float array, a memory object, a queue
+        // with a wait list, and an event
+        int start = bb.position();
+        bb.putInt(0);
+        bb.putShort((short)0);
+        bb.putShort((short)5);
+        bb.putInt(CLBlastStatusCode.CLBlastSuccess);
+        bb.putLong(1000);
+        bb.putLong(250);
+        bb.put((byte)CLBlastCallTrace.ARGUMENT_SIZE).putLong(42);
+        bb.put((byte)CLBlastCallTrace.ARGUMENT_FLOAT_ARRAY).putInt(2);
+        bb.putFloat(1.5f).putFloat(2.5f);
+        bb.put((byte)CLBlastCallTrace.ARGUMENT_MEM).putLong(0x1234).putLong(4096);
+        bb.put((byte)CLBlastCallTrace.ARGUMENT_QUEUE_WAIT_LIST);
+        bb.putLong(0x55).putInt(-1);
+        bb.put((byte)CLBlastCallTrace.ARGUMENT_EVENT).put((byte)0);
+        bb.putInt(start, bb.position() - start);
+
+        // A record of a failed call with a direct buffer of sizes
+        start = bb.position();
+        bb.putInt(0);
+        bb.putShort((short)1);
+        bb.putShort((short)1);
+        bb.putInt(CLBlastStatusCode.CLBlastInvalidValue);
+        bb.putLong(2000);
+        bb.putLong(100);
+        bb.put((byte)CLBlastCallTrace.ARGUMENT_DIRECT_SIZE).putInt(3);
+        bb.putLong(7).putLong(9).putLong(11);
+        bb.putInt(start, bb.position() - start);
+
+        byte records[] = new byte[bb.position()];
+        bb.flip();
+        bb.get(records);
+        return records;
+    }
+
+    private static void checkTrace(CLBlastCallTrace trace)
+    {
+        assertEquals(2, trace.getCalls().size());
+        assertEquals(3, trace.getDroppedCount());
+
+        CLBlastCallTrace.Call call = trace.getCalls().get(0);
+        assertEquals("CLBlastSaxpyBatched", call.getRoutine());
+        assertEquals(CLBlastStatusCode.CLBlastSuccess, call.getStatus());
+        assertEquals(1000, call.getTimestampNanos());
+        assertEquals(250, call.getDurationNanos());
+        assertEquals(5, call.getArgumentCount());
+        assertEquals(42L, call.getValue(0));
+        assertArrayEquals(new float[] { 1.5f, 2.5f }, 
+            (float[])call.getValue(1), 0.0f);
+        assertArrayEquals(new long[] { 4096 }, call.getMemorySizes());
+        assertArrayEquals(new long[] { 0x55, -1 }, (long[])call.getValue(3));
+        assertEquals(Boolean.FALSE, call.getValue(4));
+
+        call = trace.getCalls().get(1);
+        assertEquals("CLBlastSgemm", call.getRoutine());
+        assertEquals(CLBlastStatusCode.CLBlastInvalidValue, call.getStatus());
+        assertArrayEquals(new long[] { 7, 9, 11 }, (long[])call.getValue(0));
+    }
+
+    @Test
+    public void testParse()
+    {
+        String names[] = { "CLBlastSaxpyBatched", "CLBlastSgemm" };
+        CLBlastCallTrace trace = new CLBlastCallTrace(
+            names, createRecords(), new long[] { 2, 3 });
+        checkTrace(trace);
+    }
+
+    @Test
+    public void testWriteRead() throws IOException
+    {
+        String names[] = { "CLBlastSaxpyBatched", "CLBlastSgemm" };
+        CLBlastCallTrace trace = new CLBlastCallTrace(
+            names, createRecords(), new long[] { 2, 3 });
+        ByteArrayOutputStream baos = new ByteArrayOutputStream();
+        trace.write(baos);
+        CLBlastCallTrace readTrace = CLBlastCallTrace.read(
+            new ByteArrayInputStream(baos.toByteArray()));
+        checkTrace(readTrace);
+    }
+
+    @Test(expected = IOException.class)
+    public void testReadInvalid() throws IOException
+    {
+        CLBlastCallTrace.read(new ByteArrayInputStream(new byte[16]));
+    }
+}
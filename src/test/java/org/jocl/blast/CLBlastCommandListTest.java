@@ -0,0 +1,44 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+
+import org.jocl.cl_mem;
+import org.junit.Test;
+
+/**
+ * Basic tests for the recording of commands in a CLBlastCommandList
+ */
+public class CLBlastCommandListTest
+{
+    @Test
+    public void testRecordAndClear()
+    {
+        cl_mem a = new cl_mem();
+        cl_mem b = new cl_mem();
+        cl_mem c = new cl_mem();
+        CLBlastCommandList commandList = new CLBlastCommandList(16);
+        commandList
+            .Sgemm(CLBlastLayout.CLBlastLayoutRowMajor,
+                CLBlastTranspose.CLBlastTransposeNo,
+                CLBlastTranspose.CLBlastTransposeNo,
+                4, 4, 4, 1.0f, a, 0, 4, b, 0, 4, 0.0f, c, 0, 4)
+            .Saxpy(16, 2.0f, c, 0, 1, a, 0, 1)
+            .CgemmBatched(CLBlastLayout.CLBlastLayoutRowMajor,
+                CLBlastTranspose.CLBlastTransposeNo,
+                CLBlastTranspose.CLBlastTransposeNo,
+                2, 2, 2, new float[] { 1, 0, 1, 0 }, a, new long[] { 0, 4 },
+                2, b, new long[] { 0, 4 }, 2, new float[] { 0, 0, 0, 0 },
+                c, new long[] { 0, 4 }, 2, 2);
+        assertEquals(3, commandList.size());
+
+        commandList.clear();
+        assertEquals(0, commandList.size());
+    }
+
+    @Test(expected = NullPointerException.class)
+    public void testNullMem()
+    {
+        CLBlastCommandList commandList = new CLBlastCommandList();
+        commandList.Sscal(16, 2.0f, null, 0, 1);
+    }
+}
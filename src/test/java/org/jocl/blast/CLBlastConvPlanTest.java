@@ -0,0 +1,30 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+
+import org.junit.Test;
+
+/**
+ * Tests for the output size computation of the CLBlastConvPlan
+ */
+public class CLBlastConvPlanTest
+{
+    @Test
+    public void testOutputSizeSamePadding()
+    {
+        assertEquals(64, CLBlastConvPlan.outputSize(64, 3, 1, 1, 1));
+    }
+
+    @Test
+    public void testOutputSizeStrideAndDilation()
+    {
+        // Extent of the dilated kernel is 2 * (3 - 1) + 1 = 5
+        assertEquals(14, CLBlastConvPlan.outputSize(32, 3, 0, 2, 2));
+    }
+
+    @Test
+    public void testOutputSizeKernelLargerThanImage()
+    {
+        assertEquals(0, CLBlastConvPlan.outputSize(2, 5, 0, 1, 1));
+    }
+}
@@ -0,0 +1,88 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+
+import org.junit.Test;
+
+/**
+ * Tests for the host-side block factorizations of the
+ * CLBlastFactorization
+ */
+public class CLBlastFactorizationTest
+{
+    private static CLBlastFactorization.Block createBlock(
+        boolean colMajor, double values[][])
+    {
+        CLBlastFactorization.Block block = new CLBlastFactorization.Block(
+            CLBlastPrecision.CLBlastPrecisionDouble, colMajor, 0, 0,
+            values.length, values[0].length);
+        for (int i = 0; i < values.length; i++)
+        {
+            for (int j = 0; j < values[i].length; j++)
+            {
+                block.set(i, j, values[i][j]);
+            }
+        }
+        return block;
+    }
+
+    @Test
+    public void testCholesky()
+    {
+        // A = L * L^T with L = [[2,0,0],[1,3,0],[2,1,1]]
+        double a[][] = { { 4, 2, 4 }, { 2, 10, 5 }, { 4, 5, 6 } };
+        for (boolean colMajor : new boolean[] { true, false })
+        {
+            CLBlastFactorization.Block block = createBlock(colMajor, a);
+            assertEquals(0, CLBlastFactorization.factorCholesky(block));
+            assertEquals(2.0, block.get(0, 0), 1e-12);
+            assertEquals(1.0, block.get(1, 0), 1e-12);
+            assertEquals(3.0, block.get(1, 1), 1e-12);
+            assertEquals(2.0, block.get(2, 0), 1e-12);
+            assertEquals(1.0, block.get(2, 1), 1e-12);
+            assertEquals(1.0, block.get(2, 2), 1e-12);
+
+            // The upper triangle is not modified
+            assertEquals(2.0, block.get(0, 1), 0.0);
+        }
+    }
+
+    @Test
+    public void testCholeskyNotPositiveDefinite()
+    {
+        double a[][] = { { 1, 2 }, { 2, 1 } };
+        CLBlastFactorization.Block block = createBlock(true, a);
+        assertEquals(2, CLBlastFactorization.factorCholesky(block));
+    }
+
+    @Test
+    public void testLuPivoting()
+    {
+        // The panel of a 3x2 matrix, where the second row has the
+        // largest element in the first column
+        double a[][] = { { 1, 2 }, { 4, 2 }, { 2, 3 } };
+        CLBlastFactorization.Block block = createBlock(false, a);
+        int ipiv[] = new int[2];
+        assertEquals(0, CLBlastFactorization.factorLu(block, ipiv, 0));
+        assertArrayEquals(new int[] { 2, 3 }, ipiv);
+
+        // P * A = L * U with U = [[4,2],[0,2]], and the multipliers
+        // 0.5 and 0.25 in L
+        assertEquals(4.0, block.get(0, 0), 1e-12);
+        assertEquals(2.0, block.get(0, 1), 1e-12);
+        assertEquals(0.5, block.get(1, 0), 1e-12);
+        assertEquals(2.0, block.get(1, 1), 1e-12);
+        assertEquals(0.25, block.get(2, 0), 1e-12);
+        assertEquals(0.75, block.get(2, 1), 1e-12);
+    }
+
+    @Test
+    public void testLuSingular()
+    {
+        double a[][] = { { 0, 1 }, { 0, 2 } };
+        CLBlastFactorization.Block block = createBlock(true, a);
+        int ipiv[] = new int[2];
+        assertEquals(1, CLBlastFactorization.factorLu(block, ipiv, 0));
+    }
+}
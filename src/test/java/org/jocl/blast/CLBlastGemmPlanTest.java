@@ -0,0 +1,75 @@
+package org.jocl.blast;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_mem;
+import org.junit.Test;
+
+/**
+ * Tests for the parameter validation of the CLBlastGemmPlan
+ */
+public class CLBlastGemmPlanTest
+{
+    private static final int SINGLE = CLBlastPrecision.CLBlastPrecisionSingle;
+    private static final int ROW_MAJOR = CLBlastLayout.CLBlastLayoutRowMajor;
+    private static final int COL_MAJOR = CLBlastLayout.CLBlastLayoutColMajor;
+    private static final int NO = CLBlastTranspose.CLBlastTransposeNo;
+    private static final int YES = CLBlastTranspose.CLBlastTransposeYes;
+
+    @Test
+    public void testLeadingDimensionMinimum()
+    {
+        CLBlastGemmPlan.checkLeadingDimension(16, 16, "a_ld");
+        CLBlastGemmPlan.checkLeadingDimension(1, 0, "c_ld");
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testLeadingDimensionTooSmall()
+    {
+        CLBlastGemmPlan.checkLeadingDimension(0, 0, "c_ld");
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testColumnMajorLeadingDimensionOfA()
+    {
+        // Column-major, A not transposed: lda must be at least m = 16
+        CLBlastGemmPlan.create(SINGLE, COL_MAJOR, NO, NO, 16, 8, 4,
+            1.0, new cl_mem(), 0, 4, new cl_mem(), 0, 4, 0.0, 
+            new cl_mem(), 0, 16);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testRowMajorTransposedLeadingDimensionOfB()
+    {
+        // Row-major, B transposed: ldb must be at least k = 4
+        CLBlastGemmPlan.create(SINGLE, ROW_MAJOR, NO, YES, 16, 8, 4,
+            1.0, new cl_mem(), 0, 4, new cl_mem(), 0, 2, 0.0, 
+            new cl_mem(), 0, 8);
+    }
+
+    @Test(expected = NullPointerException.class)
+    public void testNullBuffer()
+    {
+        CLBlastGemmPlan.create(SINGLE, ROW_MAJOR, NO, NO, 16, 8, 4,
+            1.0, new cl_mem(), 0, 4, null, 0, 8, 0.0, 
+            new cl_mem(), 0, 8);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testComplexConvgemmPrecision()
+    {
+        CLBlastGemmPlan.checkPrecision(
+            CLBlastPrecision.CLBlastPrecisionComplexSingle, false);
+    }
+
+    @Test(expected = IllegalStateException.class)
+    public void testExecuteReleased()
+    {
+        CLBlastGemmPlan.checkExecute(true, new cl_command_queue());
+    }
+
+    @Test(expected = NullPointerException.class)
+    public void testExecuteNullQueue()
+    {
+        CLBlastGemmPlan.checkExecute(false, null);
+    }
+}
@@ -0,0 +1,42 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertSame;
+
+import org.junit.Test;
+
+/**
+ * Tests for the bucketing of the entries of the CLBlastGroupedGemm
+ */
+public class CLBlastGroupedGemmTest
+{
+    private static final int ROW_MAJOR = CLBlastLayout.CLBlastLayoutRowMajor;
+    private static final int NO = CLBlastTranspose.CLBlastTransposeNo;
+    private static final int YES = CLBlastTranspose.CLBlastTransposeYes;
+
+    @Test
+    public void testBucketing()
+    {
+        int a_transposes[] = { NO, NO, YES, NO };
+        int b_transposes[] = { NO, NO, NO, NO };
+        long m[] = { 16, 32, 16, 16 };
+        long n[] = { 8, 8, 8, 8 };
+        long k[] = { 4, 4, 4, 4 };
+        long ld[] = { 16, 16, 16, 16 };
+        CLBlastGroupedGemm plan = CLBlastGroupedGemm.get(ROW_MAJOR,
+            a_transposes, b_transposes, m, n, k, ld, ld, ld);
+        assertEquals(4, plan.getEntryCount());
+        assertEquals(3, plan.getCallCount());
+        assertSame(plan, CLBlastGroupedGemm.get(ROW_MAJOR,
+            a_transposes, b_transposes, m, n, k, ld, ld, ld));
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testMismatchedLengths()
+    {
+        long one[] = { 1 };
+        long two[] = { 1, 1 };
+        CLBlastGroupedGemm.get(ROW_MAJOR,
+            new int[] { NO }, new int[] { NO }, one, two, one, one, one, one);
+    }
+}
@@ -0,0 +1,91 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+
+import java.nio.FloatBuffer;
+
+import org.junit.Test;
+
+/**
+ * Tests for the chunk arithmetic and the size checks of the CLBlastHost
+ */
+public class CLBlastHostTest
+{
+    @Test
+    public void testSpan()
+    {
+        // The last row only needs 'cols' elements
+        assertEquals(3 * 8 + 5, CLBlastHost.span(4, 5, 8));
+        assertEquals(0, CLBlastHost.span(0, 5, 8));
+        assertEquals(0, CLBlastHost.span(4, 0, 8));
+    }
+
+    @Test
+    public void testSpanLarge()
+    {
+        // Must not overflow for more than Integer.MAX_VALUE elements
+        assertEquals(65535L * 65536 + 65536, 
+            CLBlastHost.span(65536, 65536, 65536));
+    }
+
+    @Test
+    public void testChunkRows()
+    {
+        // 1024 bytes per row, 4096 bytes per chunk
+        assertEquals(4, 
+            CLBlastHost.chunkRows(100, false, 256, 128, 4096));
+        assertEquals(4, 
+            CLBlastHost.chunkRows(100, false, 128, 256, 4096));
+    }
+
+    @Test
+    public void testChunkRowsAtMostM()
+    {
+        assertEquals(3, 
+            CLBlastHost.chunkRows(3, false, 16, 16, 1024 * 1024));
+    }
+
+    @Test
+    public void testChunkRowsAtLeastOne()
+    {
+        // A single row exceeds the chunk size
+        assertEquals(1, 
+            CLBlastHost.chunkRows(100, false, 4096, 4096, 1024));
+    }
+
+    @Test
+    public void testChunkRowsTransposed()
+    {
+        // A transposed A is not split
+        assertEquals(100, 
+            CLBlastHost.chunkRows(100, true, 4096, 4096, 1024));
+    }
+
+    @Test
+    public void testCheckSize()
+    {
+        CLBlastHost.checkSize(FloatBuffer.allocate(3 * 8 + 5), 4, 5, 8, "a");
+    }
+
+    @Test
+    public void testCheckSizeRemaining()
+    {
+        FloatBuffer buffer = FloatBuffer.allocate(3 * 8 + 6);
+        buffer.position(1);
+        CLBlastHost.checkSize(buffer, 4, 5, 8, "a");
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testCheckSizeTooSmall()
+    {
+        FloatBuffer buffer = FloatBuffer.allocate(3 * 8 + 5);
+        buffer.position(1);
+        CLBlastHost.checkSize(buffer, 4, 5, 8, "a");
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testCheckSizeLeadingDimension()
+    {
+        CLBlastHost.checkSize(FloatBuffer.allocate(64), 4, 5, 4, "a");
+    }
+}
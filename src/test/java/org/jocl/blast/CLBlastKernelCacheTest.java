@@ -0,0 +1,50 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.util.Map;
+
+import org.junit.Test;
+
+/**
+ * Tests for the evaluation of the accounting in the CLBlastKernelCache
+ */
+public class CLBlastKernelCacheTest
+{
+    @Test
+    public void testEntries()
+    {
+        String strings[] = { 
+            "DeviceA", "gemm", 
+            "DeviceA", "axpy", 
+            "DeviceB", "gemm" 
+        };
+        long values[] = {
+            100, CLBlastPrecision.CLBlastPrecisionSingle, 5, 1000, 1,
+            100, CLBlastPrecision.CLBlastPrecisionDouble, 1, 2000, 1,
+            200, CLBlastPrecision.CLBlastPrecisionSingle, 7, 3000, 0,
+        };
+        CLBlastKernelCache cache = new CLBlastKernelCache(strings, values);
+        assertEquals(3, cache.getSize());
+
+        CLBlastKernelCache.Entry entry = cache.getEntries().get(2);
+        assertEquals("DeviceB", entry.getDevice());
+        assertEquals(200, entry.getDeviceHandle());
+        assertEquals("gemm", entry.getOperation());
+        assertEquals(CLBlastPrecision.CLBlastPrecisionSingle, 
+            entry.getPrecision());
+        assertEquals(7, entry.getCalls());
+        assertEquals(3000, entry.getIdleNanos());
+        assertFalse(entry.isRebuildable());
+        assertTrue(cache.getEntries().get(0).isRebuildable());
+
+        Map<String, Integer> byDevice = cache.getSizeByDevice();
+        assertEquals(Integer.valueOf(2), byDevice.get("DeviceA"));
+        assertEquals(Integer.valueOf(1), byDevice.get("DeviceB"));
+        Map<String, Integer> byOperation = cache.getSizeByOperation();
+        assertEquals(Integer.valueOf(2), byOperation.get("gemm"));
+        assertEquals(Integer.valueOf(1), byOperation.get("axpy"));
+    }
+}
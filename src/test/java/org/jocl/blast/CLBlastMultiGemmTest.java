@@ -0,0 +1,43 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertArrayEquals;
+import static org.junit.Assert.assertEquals;
+
+import org.junit.Test;
+
+/**
+ * Tests for the partitioning of the rows in the multi-device GEMM
+ */
+public class CLBlastMultiGemmTest
+{
+    @Test
+    public void testPartitionEqualWeights()
+    {
+        long rows[] = CLBlastMultiGemm.partition(10, 
+            new double[] { 0.25, 0.25, 0.25, 0.25 });
+        assertArrayEquals(new long[] { 3, 3, 2, 2 }, rows);
+    }
+
+    @Test
+    public void testPartitionWeighted()
+    {
+        long rows[] = CLBlastMultiGemm.partition(1000, 
+            new double[] { 0.5, 0.3, 0.2 });
+        assertArrayEquals(new long[] { 500, 300, 200 }, rows);
+    }
+
+    @Test
+    public void testPartitionFewerRowsThanDevices()
+    {
+        long rows[] = CLBlastMultiGemm.partition(1, 
+            new double[] { 0.2, 0.5, 0.3 });
+        assertArrayEquals(new long[] { 0, 1, 0 }, rows);
+        long sum = 0;
+        for (long r : CLBlastMultiGemm.partition(7, 
+            new double[] { 1.0 / 3, 1.0 / 3, 1.0 / 3 }))
+        {
+            sum += r;
+        }
+        assertEquals(7, sum);
+    }
+}
@@ -0,0 +1,44 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+
+import org.junit.Test;
+
+/**
+ * Tests for the evaluation of the profile data in the CLBlastProfile
+ */
+public class CLBlastProfileTest
+{
+    private static final int ENTRY_VALUES = 6 + CLBlastProfile.BUCKET_COUNT;
+
+    @Test
+    public void testEntryThroughput()
+    {
+        String strings[] = { "CLBlastSgemm", "Device", "m=10, n=20, k=30" };
+        long values[] = new long[ENTRY_VALUES];
+        values[0] = 2;     // calls
+        values[1] = 8000;  // total nanoseconds
+        values[2] = 3000;  // minimum nanoseconds
+        values[3] = 5000;  // maximum nanoseconds
+        values[4] = 12000; // FLOPs per call
+        values[5] = 5200;  // bytes per call
+        values[6 + 11] = 1;
+        values[6 + 12] = 1;
+
+        CLBlastProfile profile = new CLBlastProfile(strings, values);
+        assertEquals(1, profile.getEntries("CLBlastSgemm").size());
+        CLBlastProfile.Entry entry = profile.getEntries().get(0);
+        assertEquals("m=10, n=20, k=30", entry.getShape());
+        assertEquals(3.0, entry.getGflops(), 1e-9);
+        assertEquals(4.0, entry.getPeakGflops(), 1e-9);
+        assertEquals(1.3, entry.getBandwidth(), 1e-9);
+        assertEquals(1, entry.getHistogram()[12]);
+    }
+
+    @Test
+    public void testBucketMinNanos()
+    {
+        assertEquals(0, CLBlastProfile.getBucketMinNanos(0));
+        assertEquals(4096, CLBlastProfile.getBucketMinNanos(12));
+    }
+}
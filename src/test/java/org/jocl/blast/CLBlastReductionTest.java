@@ -0,0 +1,46 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_mem;
+import org.junit.Test;
+
+/**
+ * Tests for the argument checks and the result conversion of the 
+ * CLBlastReduction
+ */
+public class CLBlastReductionTest
+{
+    @Test
+    public void testToResult()
+    {
+        assertEquals(Float.valueOf(1.5f), 
+            CLBlastReduction.toResult(CLBlastReduction.TYPE_FLOAT, 1.5));
+        assertEquals(Double.valueOf(0.1), 
+            CLBlastReduction.toResult(CLBlastReduction.TYPE_DOUBLE, 0.1));
+        assertEquals(Long.valueOf(123456789012L), 
+            CLBlastReduction.toResult(CLBlastReduction.TYPE_INDEX, 
+                123456789012.0));
+    }
+
+    @Test(expected = NullPointerException.class)
+    public void testNullX()
+    {
+        CLBlastReduction.Sdot(4, null, 0, 1, 
+            new cl_mem(), 0, 1, new cl_command_queue());
+    }
+
+    @Test(expected = NullPointerException.class)
+    public void testNullY()
+    {
+        CLBlastReduction.DdotAsync(4, new cl_mem(), 0, 1, 
+            null, 0, 1, new cl_command_queue());
+    }
+
+    @Test(expected = NullPointerException.class)
+    public void testNullQueue()
+    {
+        CLBlastReduction.Snrm2Async(4, new cl_mem(), 0, 1, null);
+    }
+}
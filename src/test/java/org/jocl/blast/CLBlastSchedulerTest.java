@@ -0,0 +1,128 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertTrue;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.RejectedExecutionException;
+import java.util.concurrent.TimeUnit;
+
+import org.jocl.cl_command_queue;
+import org.jocl.cl_event;
+import org.junit.Test;
+
+/**
+ * Tests for the distribution of operations in the CLBlastScheduler. 
+ * These tests do not enqueue anything, and use queue objects that are 
+ * only used for identifying the worker that executed an operation.
+ */
+public class CLBlastSchedulerTest
+{
+    @Test
+    public void testAllOperationsAreExecuted() throws Exception
+    {
+        cl_command_queue queues[] = { 
+            new cl_command_queue(), new cl_command_queue() };
+        CLBlastScheduler scheduler = 
+            new CLBlastScheduler(queues, false, 0);
+        final List<cl_command_queue> usedQueues = 
+            new ArrayList<cl_command_queue>();
+        List<CLBlastScheduler.Submission> submissions = 
+            new ArrayList<CLBlastScheduler.Submission>();
+        for (int i = 0; i < 100; i++)
+        {
+            submissions.add(scheduler.submit(new CLBlastScheduler.Operation()
+            {
+                @Override
+                public int execute(cl_command_queue queue, cl_event event)
+                {
+                    synchronized (usedQueues)
+                    {
+                        usedQueues.add(queue);
+                    }
+                    return CLBlastStatusCode.CLBlastSuccess;
+                }
+            }));
+        }
+        for (CLBlastScheduler.Submission submission : submissions)
+        {
+            assertNotNull(submission.get(10, TimeUnit.SECONDS));
+            assertEquals(Integer.valueOf(CLBlastStatusCode.CLBlastSuccess), 
+                submission.getStatus());
+        }
+        scheduler.shutdown();
+        assertEquals(100, usedQueues.size());
+        for (cl_command_queue queue : usedQueues)
+        {
+            assertTrue(queue == queues[0] || queue == queues[1]);
+        }
+    }
+
+    @Test
+    public void testBlockedWorkerIsStolenFrom() throws Exception
+    {
+        cl_command_queue queues[] = { 
+            new cl_command_queue(), new cl_command_queue() };
+        CLBlastScheduler scheduler = 
+            new CLBlastScheduler(queues, false, 0);
+        final CountDownLatch release = new CountDownLatch(1);
+        final CountDownLatch executed = new CountDownLatch(10);
+        
+        // The first operation goes to the first worker, and blocks it
+        CLBlastScheduler.Submission blocking = 
+            scheduler.submit(new CLBlastScheduler.Operation()
+        {
+            @Override
+            public int execute(cl_command_queue queue, cl_event event)
+            {
+                try
+                {
+                    release.await();
+                }
+                catch (InterruptedException e)
+                {
+                    Thread.currentThread().interrupt();
+                }
+                return CLBlastStatusCode.CLBlastSuccess;
+            }
+        });
+        
+        // Half of these go to the first worker, and must be stolen
+        for (int i = 0; i < 10; i++)
+        {
+            scheduler.submit(new CLBlastScheduler.Operation()
+            {
+                @Override
+                public int execute(cl_command_queue queue, cl_event event)
+                {
+                    executed.countDown();
+                    return CLBlastStatusCode.CLBlastSuccess;
+                }
+            });
+        }
+        assertTrue(executed.await(10, TimeUnit.SECONDS));
+        assertTrue(scheduler.getStealCount() > 0);
+        release.countDown();
+        blocking.get(10, TimeUnit.SECONDS);
+        scheduler.shutdown();
+    }
+
+    @Test(expected = RejectedExecutionException.class)
+    public void testSubmitAfterShutdown()
+    {
+        CLBlastScheduler scheduler = new CLBlastScheduler(
+            new cl_command_queue[] { new cl_command_queue() }, false, 0);
+        scheduler.shutdown();
+        scheduler.submit(new CLBlastScheduler.Operation()
+        {
+            @Override
+            public int execute(cl_command_queue queue, cl_event event)
+            {
+                return CLBlastStatusCode.CLBlastSuccess;
+            }
+        });
+    }
+}
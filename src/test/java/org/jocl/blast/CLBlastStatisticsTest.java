@@ -0,0 +1,38 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertNotNull;
+import static org.junit.Assert.assertNull;
+
+import org.junit.Test;
+
+/**
+ * Basic tests for the collection of statistics
+ */
+public class CLBlastStatisticsTest
+{
+    @Test
+    public void testStatistics()
+    {
+        CLBlast.setStatisticsEnabled(true);
+        try
+        {
+            CLBlast.resetStatistics();
+            CLBlast.CLBlastClearCache();
+            CLBlast.CLBlastClearCache();
+
+            CLBlastStatistics statistics = CLBlast.getStatistics(true);
+            CLBlastStatistics.Routine routine =
+                statistics.getRoutine("CLBlastClearCache");
+            assertNotNull(routine);
+            assertEquals(2, routine.getCalls());
+
+            statistics = CLBlast.getStatistics();
+            assertNull(statistics.getRoutine("CLBlastClearCache"));
+        }
+        finally
+        {
+            CLBlast.setStatisticsEnabled(false);
+        }
+    }
+}
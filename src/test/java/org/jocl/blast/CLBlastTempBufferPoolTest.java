@@ -0,0 +1,185 @@
+package org.jocl.blast;
+
+import static org.jocl.CL.CL_CONTEXT_PLATFORM;
+import static org.jocl.CL.CL_DEVICE_TYPE_ALL;
+import static org.jocl.CL.CL_MEM_READ_WRITE;
+import static org.jocl.CL.clCreateBuffer;
+import static org.jocl.CL.clCreateCommandQueue;
+import static org.jocl.CL.clCreateContext;
+import static org.jocl.CL.clFinish;
+import static org.jocl.CL.clGetDeviceIDs;
+import static org.jocl.CL.clGetPlatformIDs;
+import static org.jocl.CL.clReleaseCommandQueue;
+import static org.jocl.CL.clReleaseContext;
+import static org.jocl.CL.clReleaseMemObject;
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertTrue;
+import static org.junit.Assume.assumeTrue;
+
+import org.jocl.Sizeof;
+import org.jocl.cl_command_queue;
+import org.jocl.cl_context;
+import org.jocl.cl_context_properties;
+import org.jocl.cl_device_id;
+import org.jocl.cl_mem;
+import org.jocl.cl_platform_id;
+import org.junit.After;
+import org.junit.Test;
+
+/**
+ * Tests for the limits and the argument checks of the pool of temporary
+ * buffers of the CLBlastXgemmPooled routines. The tests that execute a
+ * GEMM are skipped when there is no OpenCL device.
+ */
+public class CLBlastTempBufferPoolTest
+{
+    private static final int ROW_MAJOR = CLBlastLayout.CLBlastLayoutRowMajor;
+    private static final int NO = CLBlastTranspose.CLBlastTransposeNo;
+    private static final long DEFAULT_LIMIT = 256L * 1024 * 1024;
+    private static final int DEFAULT_MAX_OUTSTANDING = 16;
+    private static final double DEFAULT_MAX_REUSE_RATIO = 2.0;
+    
+    // A GEMM size that requires a temporary buffer on most devices
+    private static final int SIZE = 1000;
+
+    private cl_context context;
+    private cl_command_queue queue;
+    private cl_mem memA;
+    private cl_mem memB;
+    private cl_mem memC;
+
+    @After
+    public void tearDown()
+    {
+        CLBlast.trimTempBufferPool();
+        CLBlast.setTempBufferPoolLimit(DEFAULT_LIMIT);
+        CLBlast.setTempBufferPoolMaxOutstanding(DEFAULT_MAX_OUTSTANDING);
+        CLBlast.setTempBufferPoolMaxReuseRatio(DEFAULT_MAX_REUSE_RATIO);
+        if (context != null)
+        {
+            clReleaseMemObject(memA);
+            clReleaseMemObject(memB);
+            clReleaseMemObject(memC);
+            clReleaseCommandQueue(queue);
+            clReleaseContext(context);
+        }
+    }
+    
+    /**
+     * Create the context, queue and GEMM buffers for the first device, 
+     * or skip the test if there is no OpenCL device
+     */
+    private void initCL()
+    {
+        int numPlatforms[] = new int[1];
+        clGetPlatformIDs(0, null, numPlatforms);
+        assumeTrue(numPlatforms[0] > 0);
+        cl_platform_id platforms[] = new cl_platform_id[numPlatforms[0]];
+        clGetPlatformIDs(platforms.length, platforms, null);
+        int numDevices[] = new int[1];
+        clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, 0, null, numDevices);
+        assumeTrue(numDevices[0] > 0);
+        cl_device_id devices[] = new cl_device_id[numDevices[0]];
+        clGetDeviceIDs(platforms[0], CL_DEVICE_TYPE_ALL, devices.length, 
+            devices, null);
+        cl_context_properties contextProperties = new cl_context_properties();
+        contextProperties.addProperty(CL_CONTEXT_PLATFORM, platforms[0]);
+        context = clCreateContext(contextProperties, 1, 
+            new cl_device_id[] { devices[0] }, null, null, null);
+        queue = clCreateCommandQueue(context, devices[0], 0, null);
+        long bytes = (long)SIZE * SIZE * Sizeof.cl_float;
+        memA = clCreateBuffer(context, CL_MEM_READ_WRITE, bytes, null, null);
+        memB = clCreateBuffer(context, CL_MEM_READ_WRITE, bytes, null, null);
+        memC = clCreateBuffer(context, CL_MEM_READ_WRITE, bytes, null, null);
+    }
+    
+    /**
+     * Execute a pooled SGEMM with the GEMM buffers, and wait until it
+     * is complete
+     */
+    private void sgemmPooled()
+    {
+        CLBlast.CLBlastSgemmPooled(ROW_MAJOR, NO, NO, SIZE, SIZE, SIZE, 
+            1.0f, memA, 0, SIZE, memB, 0, SIZE, 
+            0.0f, memC, 0, SIZE, queue, null);
+        clFinish(queue);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testNegativeLimit()
+    {
+        CLBlast.setTempBufferPoolLimit(-1);
+    }
+
+    @Test
+    public void testTrimEmptiesPool()
+    {
+        CLBlast.setTempBufferPoolLimit(0);
+        CLBlast.trimTempBufferPool();
+        assertEquals(0, CLBlast.getTempBufferPoolSize());
+    }
+
+    @Test
+    public void testNoOutstandingBuffersWhenIdle()
+    {
+        assertEquals(0, CLBlast.getTempBufferPoolOutstanding());
+    }
+
+    @Test
+    public void testZeroMaxOutstandingBypassesPool()
+    {
+        initCL();
+        CLBlast.trimTempBufferPool();
+        CLBlast.setTempBufferPoolMaxOutstanding(0);
+        sgemmPooled();
+        assertEquals(0, CLBlast.getTempBufferPoolOutstanding());
+        assertEquals(0, CLBlast.getTempBufferPoolSize());
+    }
+
+    @Test
+    public void testLoweredLimitTrimsPool()
+    {
+        initCL();
+        CLBlast.trimTempBufferPool();
+        sgemmPooled();
+        long size = CLBlast.getTempBufferPoolSize();
+        assumeTrue(size > 0);
+        CLBlast.setTempBufferPoolLimit(size - 1);
+        assertTrue(CLBlast.getTempBufferPoolSize() <= size - 1);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testNegativeMaxOutstanding()
+    {
+        CLBlast.setTempBufferPoolMaxOutstanding(-1);
+    }
+
+    @Test
+    public void testMaxReuseRatio()
+    {
+        CLBlast.setTempBufferPoolMaxReuseRatio(1.0);
+        assertEquals(1.0, CLBlast.getTempBufferPoolMaxReuseRatio(), 0.0);
+        CLBlast.setTempBufferPoolMaxReuseRatio(3.5);
+        assertEquals(3.5, CLBlast.getTempBufferPoolMaxReuseRatio(), 0.0);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testMaxReuseRatioTooSmall()
+    {
+        CLBlast.setTempBufferPoolMaxReuseRatio(0.5);
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testMaxReuseRatioNaN()
+    {
+        CLBlast.setTempBufferPoolMaxReuseRatio(Double.NaN);
+    }
+
+    @Test(expected = NullPointerException.class)
+    public void testPooledNullQueue()
+    {
+        CLBlast.CLBlastSgemmPooled(ROW_MAJOR, NO, NO, 4, 4, 4, 
+            1.0f, new cl_mem(), 0, 4, new cl_mem(), 0, 4, 
+            0.0f, new cl_mem(), 0, 4, null, null);
+    }
+}
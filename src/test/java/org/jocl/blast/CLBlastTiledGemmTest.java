@@ -0,0 +1,44 @@
+package org.jocl.blast;
+
+import java.nio.ByteBuffer;
+import java.nio.FloatBuffer;
+
+import org.junit.Test;
+
+/**
+ * Tests for the size checks of the CLBlastTiledGemm
+ */
+public class CLBlastTiledGemmTest
+{
+    private static FloatBuffer createBuffer(int size)
+    {
+        return ByteBuffer.allocateDirect(size * 4).asFloatBuffer();
+    }
+
+    @Test
+    public void testCheckSize()
+    {
+        // The last row only needs 'cols' elements
+        CLBlastTiledGemm.checkSize(createBuffer(3 * 8 + 5), 4, 5, 8, 1, "a");
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testCheckSizeTooSmall()
+    {
+        CLBlastTiledGemm.checkSize(createBuffer(3 * 8 + 4), 4, 5, 8, 1, "a");
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testCheckSizeNotDirect()
+    {
+        CLBlastTiledGemm.checkSize(FloatBuffer.allocate(64), 4, 5, 8, 1, "a");
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testCheckSizeLargerThanBuffer()
+    {
+        // 65536 x 32768 complex elements exceed Integer.MAX_VALUE floats
+        CLBlastTiledGemm.checkSize(
+            createBuffer(16), 65536, 32768, 32768, 2, "c");
+    }
+}
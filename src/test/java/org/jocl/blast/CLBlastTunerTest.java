@@ -0,0 +1,63 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import org.junit.Test;
+
+/**
+ * Tests for the parts of the GEMM tuner that do not require a device
+ */
+public class CLBlastTunerTest
+{
+    @Test
+    public void testMinIndirectSizeForDirect()
+    {
+        // The direct kernel is used when m*n*k < size^3
+        assertEquals(11, CLBlastTuner.minIndirectSizeForDirect(1000));
+        assertEquals(11, CLBlastTuner.minIndirectSizeForDirect(1001));
+        assertEquals(10, CLBlastTuner.minIndirectSizeForDirect(999));
+        long size = CLBlastTuner.minIndirectSizeForDirect(3072.0 * 77 * 768);
+        assertTrue((double)size * size * size > 3072.0 * 77 * 768);
+        assertTrue((double)(size - 1) * (size - 1) * (size - 1) <= 
+            3072.0 * 77 * 768);
+    }
+
+    @Test
+    public void testCandidatesRespectDeviceLimits()
+    {
+        int unlimitedDirect = 
+            CLBlastTuner.createDirectCandidates(1024, 1 << 20).size();
+        int limitedDirect = 
+            CLBlastTuner.createDirectCandidates(64, 1024).size();
+        assertTrue(unlimitedDirect > 0);
+        assertTrue(limitedDirect > 0);
+        assertTrue(limitedDirect < unlimitedDirect);
+
+        int unlimitedIndirect = 
+            CLBlastTuner.createIndirectCandidates(1024, 1 << 20).size();
+        int limitedIndirect = 
+            CLBlastTuner.createIndirectCandidates(64, 1024).size();
+        assertTrue(unlimitedIndirect > 0);
+        assertTrue(limitedIndirect > 0);
+        assertTrue(limitedIndirect < unlimitedIndirect);
+    }
+
+    @Test
+    public void testFormatParameters()
+    {
+        assertEquals("KWID=2,WGD=32", CLBlastTuner.formatParameters(
+            new String[] { "KWID", "WGD" }, new long[] { 2, 32 }));
+    }
+
+    @Test
+    public void testResultNotApplied()
+    {
+        CLBlastTuner.Result result = new CLBlastTuner.Result("Xgemm",
+            new String[] { "KWG" }, new long[] { 16 }, 64, 90.0, 100.0, 
+            8, false, false);
+        assertFalse(result.isApplied());
+        assertTrue(result.toString().endsWith(", not applied"));
+    }
+}
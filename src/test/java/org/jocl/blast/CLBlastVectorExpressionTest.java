@@ -0,0 +1,77 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+import static org.junit.Assert.assertFalse;
+import static org.junit.Assert.assertTrue;
+
+import java.util.Arrays;
+import java.util.List;
+
+import org.jocl.cl_mem;
+import org.junit.Test;
+
+/**
+ * Tests for the source code generation of the CLBlastVectorExpression
+ */
+public class CLBlastVectorExpressionTest
+{
+    private static int count(String s, String part)
+    {
+        int count = 0;
+        int index = s.indexOf(part);
+        while (index != -1)
+        {
+            count++;
+            index = s.indexOf(part, index + 1);
+        }
+        return count;
+    }
+
+    private static List<CLBlastVectorExpression.Operation> axpyThenScal()
+    {
+        cl_mem x = new cl_mem();
+        cl_mem y = new cl_mem();
+        CLBlastVectorExpression.Operation axpy =
+            new CLBlastVectorExpression.Operation(
+                CLBlastVectorExpression.OPERATION_AXPY, 2.0, 0.0, null, 0,
+                x, 0L, 1L, y, 0L, 1L);
+        axpy.views = new int[] { 0, 1 };
+        CLBlastVectorExpression.Operation scal =
+            new CLBlastVectorExpression.Operation(
+                CLBlastVectorExpression.OPERATION_SCAL, 3.0, 0.0, null, 0,
+                y, 0L, 1L);
+        scal.views = new int[] { 1 };
+        return Arrays.asList(axpy, scal);
+    }
+
+    @Test
+    public void testEachVectorIsLoadedOnceAndStoredOnce()
+    {
+        String source = CLBlastVectorExpression.createSource(
+            CLBlastPrecision.CLBlastPrecisionSingle, axpyThenScal(), 2);
+        assertEquals(1, count(source, "r0 = v0["));
+        assertEquals(1, count(source, "r1 = v1["));
+        assertEquals(0, count(source, "v0[o0 + i * s0] = r0"));
+        assertEquals(1, count(source, "v1[o1 + i * s1] = r1"));
+        assertFalse(source.contains("cl_khr_fp64"));
+    }
+
+    @Test
+    public void testDoublePrecisionEnablesExtension()
+    {
+        String source = CLBlastVectorExpression.createSource(
+            CLBlastPrecision.CLBlastPrecisionDouble, axpyThenScal(), 2);
+        assertTrue(source.contains("cl_khr_fp64"));
+        assertTrue(source.contains("const double a1"));
+    }
+
+    @Test
+    public void testHalfPrecisionComputesInFloat()
+    {
+        String source = CLBlastVectorExpression.createSource(
+            CLBlastPrecision.CLBlastPrecisionHalf, axpyThenScal(), 2);
+        assertEquals(2, count(source, "vload_half("));
+        assertEquals(1, count(source, "vstore_half("));
+        assertTrue(source.contains("float r1;"));
+    }
+}
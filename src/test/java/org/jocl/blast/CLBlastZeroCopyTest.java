@@ -0,0 +1,40 @@
+package org.jocl.blast;
+
+import static org.junit.Assert.assertEquals;
+
+import java.nio.ByteBuffer;
+import java.nio.CharBuffer;
+import java.nio.DoubleBuffer;
+import java.nio.FloatBuffer;
+
+import org.junit.Test;
+
+/**
+ * Tests for the host-side checks of the CLBlastZeroCopy
+ */
+public class CLBlastZeroCopyTest
+{
+    @Test
+    public void testElementSize()
+    {
+        assertEquals(1, CLBlastZeroCopy.elementSize(ByteBuffer.allocate(1)));
+        assertEquals(2, CLBlastZeroCopy.elementSize(CharBuffer.allocate(1)));
+        assertEquals(4, CLBlastZeroCopy.elementSize(FloatBuffer.allocate(1)));
+        assertEquals(8, CLBlastZeroCopy.elementSize(DoubleBuffer.allocate(1)));
+    }
+
+    @Test
+    public void testRoundUp()
+    {
+        assertEquals(0, CLBlastZeroCopy.roundUp(0, 64));
+        assertEquals(64, CLBlastZeroCopy.roundUp(1, 64));
+        assertEquals(4096, CLBlastZeroCopy.roundUp(4096, 4096));
+        assertEquals(8192, CLBlastZeroCopy.roundUp(4097, 4096));
+    }
+
+    @Test(expected = IllegalArgumentException.class)
+    public void testRejectsHeapBuffer()
+    {
+        CLBlastZeroCopy.beginDeviceAccess(null, FloatBuffer.allocate(16));
+    }
+}